@@ -0,0 +1,197 @@
+// Heap allocation tracking per subsystem
+
+#include "alloc_track.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace {
+
+std::atomic<int> g_subsystem{ ALLOC_OTHER };
+
+const char* subsystem_names[ALLOC_SUBSYSTEM_COUNT] = { "Other", "Import", "IBL", "Frame", "GUI" };
+
+#ifdef VRM_VIEWER_ALLOC_TRACKING
+
+struct SubsystemCounters {
+    std::atomic<uint64_t> count{ 0 };
+    std::atomic<uint64_t> bytes{ 0 };
+    std::atomic<uint64_t> live_bytes{ 0 };
+    std::atomic<uint64_t> peak_live_bytes{ 0 };
+};
+
+SubsystemCounters g_counters[ALLOC_SUBSYSTEM_COUNT];
+
+// Sits right before every block handed out, so a free finds its size and
+// subsystem without a lookup
+struct AllocHeader {
+    uint64_t size;
+    uint32_t subsystem;
+    uint32_t offset;  // From the malloc'd pointer to the block
+};
+static_assert(sizeof(AllocHeader) == 16, "AllocHeader must keep blocks 16-byte aligned");
+
+void* tracked_alloc(size_t size, size_t alignment) {
+    if (alignment < alignof(std::max_align_t)) {
+        alignment = alignof(std::max_align_t);
+    }
+    size_t padding = sizeof(AllocHeader) + (alignment > sizeof(AllocHeader) ? alignment : 0);
+    if (size > SIZE_MAX - padding) {
+        return nullptr;
+    }
+    uint8_t* raw = (uint8_t*)malloc(size + padding);
+    if (!raw) {
+        return nullptr;
+    }
+    uintptr_t block = ((uintptr_t)raw + sizeof(AllocHeader) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+
+    int subsystem = g_subsystem.load(std::memory_order_relaxed);
+    AllocHeader* header = (AllocHeader*)block - 1;
+    header->size = size;
+    header->subsystem = (uint32_t)subsystem;
+    header->offset = (uint32_t)(block - (uintptr_t)raw);
+
+    SubsystemCounters& counters = g_counters[subsystem];
+    counters.count.fetch_add(1, std::memory_order_relaxed);
+    counters.bytes.fetch_add(size, std::memory_order_relaxed);
+    uint64_t live = counters.live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    uint64_t peak = counters.peak_live_bytes.load(std::memory_order_relaxed);
+    while (live > peak && !counters.peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+    return (void*)block;
+}
+
+void tracked_free(void* ptr) {
+    if (!ptr) {
+        return;
+    }
+    AllocHeader* header = (AllocHeader*)ptr - 1;
+    g_counters[header->subsystem].live_bytes.fetch_sub(header->size, std::memory_order_relaxed);
+    free((uint8_t*)ptr - header->offset);
+}
+
+size_t tracked_size(void* ptr) {
+    return (size_t)((AllocHeader*)ptr - 1)->size;
+}
+
+#endif
+
+} // namespace
+
+bool alloc_tracking_enabled() {
+#ifdef VRM_VIEWER_ALLOC_TRACKING
+    return true;
+#else
+    return false;
+#endif
+}
+
+const char* alloc_subsystem_name(AllocSubsystem subsystem) {
+    return subsystem_names[subsystem];
+}
+
+AllocStats alloc_stats(AllocSubsystem subsystem) {
+    AllocStats stats = {};
+#ifdef VRM_VIEWER_ALLOC_TRACKING
+    const SubsystemCounters& counters = g_counters[subsystem];
+    stats.count = counters.count.load(std::memory_order_relaxed);
+    stats.bytes = counters.bytes.load(std::memory_order_relaxed);
+    stats.live_bytes = counters.live_bytes.load(std::memory_order_relaxed);
+    stats.peak_live_bytes = counters.peak_live_bytes.load(std::memory_order_relaxed);
+#else
+    (void)subsystem;
+#endif
+    return stats;
+}
+
+void alloc_reset_peak(AllocSubsystem subsystem) {
+#ifdef VRM_VIEWER_ALLOC_TRACKING
+    SubsystemCounters& counters = g_counters[subsystem];
+    counters.peak_live_bytes.store(counters.live_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+#else
+    (void)subsystem;
+#endif
+}
+
+AllocSubsystem alloc_set_subsystem(AllocSubsystem subsystem) {
+    return (AllocSubsystem)g_subsystem.exchange(subsystem, std::memory_order_relaxed);
+}
+
+#ifdef VRM_VIEWER_ALLOC_TRACKING
+
+void* alloc_track_malloc(size_t size) {
+    return tracked_alloc(size, 0);
+}
+
+void* alloc_track_realloc(void* ptr, size_t size) {
+    if (!ptr) {
+        return tracked_alloc(size, 0);
+    }
+    void* block = tracked_alloc(size, 0);
+    if (block) {
+        size_t old_size = tracked_size(ptr);
+        memcpy(block, ptr, old_size < size ? old_size : size);
+        tracked_free(ptr);
+    }
+    return block;
+}
+
+void alloc_track_free(void* ptr) {
+    tracked_free(ptr);
+}
+
+// ============================================================================
+// Global operator new/delete
+// ============================================================================
+
+static void* tracked_new(size_t size, size_t alignment) {
+    void* block = tracked_alloc(size, alignment);
+    if (!block) {
+        throw std::bad_alloc();
+    }
+    return block;
+}
+
+void* operator new(size_t size) { return tracked_new(size, 0); }
+void* operator new[](size_t size) { return tracked_new(size, 0); }
+void* operator new(size_t size, std::align_val_t align) { return tracked_new(size, (size_t)align); }
+void* operator new[](size_t size, std::align_val_t align) { return tracked_new(size, (size_t)align); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return tracked_alloc(size, 0); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return tracked_alloc(size, 0); }
+void* operator new(size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return tracked_alloc(size, (size_t)align);
+}
+void* operator new[](size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return tracked_alloc(size, (size_t)align);
+}
+
+void operator delete(void* ptr) noexcept { tracked_free(ptr); }
+void operator delete[](void* ptr) noexcept { tracked_free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { tracked_free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { tracked_free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { tracked_free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { tracked_free(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { tracked_free(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { tracked_free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { tracked_free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { tracked_free(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { tracked_free(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { tracked_free(ptr); }
+
+#else
+
+void* alloc_track_malloc(size_t size) {
+    return malloc(size);
+}
+
+void* alloc_track_realloc(void* ptr, size_t size) {
+    return realloc(ptr, size);
+}
+
+void alloc_track_free(void* ptr) {
+    free(ptr);
+}
+
+#endif
@@ -0,0 +1,58 @@
+// Heap allocation tracking per subsystem (no sokol dependency). Built with
+// VRM_VIEWER_ALLOC_TRACKING, the global operator new/delete, stb_image and
+// cgltf allocate through here and every allocation is attributed to the
+// subsystem scope active when it was made: count, bytes, and the live and
+// peak live bytes of what that subsystem still holds. Without it the scopes
+// cost one relaxed store and the stats stay zero.
+//
+// The scope is process-wide rather than per thread: parallel-util starts
+// fresh threads on every call, and their allocations belong to the scope
+// that started them.
+#ifndef ALLOC_TRACK_H
+#define ALLOC_TRACK_H
+
+#include <cstddef>
+#include <cstdint>
+
+enum AllocSubsystem {
+    ALLOC_OTHER,
+    ALLOC_IMPORT,
+    ALLOC_IBL,
+    ALLOC_FRAME,
+    ALLOC_GUI,
+    ALLOC_SUBSYSTEM_COUNT
+};
+
+struct AllocStats {
+    uint64_t count;  // Allocations made in the subsystem's scopes
+    uint64_t bytes;  // Bytes requested by them
+    uint64_t live_bytes;  // Of those, still allocated
+    uint64_t peak_live_bytes;  // Highest live_bytes since the last alloc_reset_peak()
+};
+
+// True when built with VRM_VIEWER_ALLOC_TRACKING
+bool alloc_tracking_enabled();
+
+const char* alloc_subsystem_name(AllocSubsystem subsystem);
+AllocStats alloc_stats(AllocSubsystem subsystem);
+void alloc_reset_peak(AllocSubsystem subsystem);
+
+// Make subsystem the active scope; returns the previous one
+AllocSubsystem alloc_set_subsystem(AllocSubsystem subsystem);
+
+struct AllocScope {
+    AllocSubsystem previous;
+
+    explicit AllocScope(AllocSubsystem subsystem) : previous(alloc_set_subsystem(subsystem)) {}
+    ~AllocScope() { alloc_set_subsystem(previous); }
+    AllocScope(const AllocScope&) = delete;
+    AllocScope& operator=(const AllocScope&) = delete;
+};
+
+// malloc-style entry points for C libraries' allocator hooks; blocks from
+// these must be released with alloc_track_free()
+void* alloc_track_malloc(size_t size);
+void* alloc_track_realloc(void* ptr, size_t size);
+void alloc_track_free(void* ptr);
+
+#endif // ALLOC_TRACK_H
@@ -0,0 +1,78 @@
+// Timing reports shared by the benchmark tools
+
+#include "bench_report.h"
+#include "importer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+double bench_percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    double rank = p * (sorted.size() - 1);
+    size_t lo = (size_t)rank;
+    size_t hi = std::min(lo + 1, sorted.size() - 1);
+    return sorted[lo] + (sorted[hi] - sorted[lo]) * (rank - lo);
+}
+
+BenchStats bench_stats(std::vector<double> samples) {
+    BenchStats stats = {};
+    if (samples.empty()) {
+        return stats;
+    }
+    std::sort(samples.begin(), samples.end());
+    double sum = 0.0;
+    for (double s : samples) {
+        sum += s;
+    }
+    stats.mean = sum / samples.size();
+    double variance = 0.0;
+    for (double s : samples) {
+        variance += (s - stats.mean) * (s - stats.mean);
+    }
+    stats.stddev = samples.size() > 1 ? sqrt(variance / (samples.size() - 1)) : 0.0;
+    stats.min = samples.front();
+    stats.max = samples.back();
+    stats.median = bench_percentile(samples, 0.5);
+    stats.p90 = bench_percentile(samples, 0.9);
+    stats.p99 = bench_percentile(samples, 0.99);
+    return stats;
+}
+
+bool bench_write_json(const char* path, const nlohmann::ordered_json& settings,
+                      const std::vector<BenchResult>& results) {
+    nlohmann::ordered_json report;
+    report["schema"] = "vrm_bench/1";
+#ifdef NDEBUG
+    report["build"] = "release";
+#else
+    report["build"] = "debug";
+#endif
+    report["hardware_threads"] = std::thread::hardware_concurrency();
+    for (const auto& item : settings.items()) {
+        report[item.key()] = item.value();
+    }
+    report["unit"] = "ms";
+    nlohmann::ordered_json benchmarks = nlohmann::ordered_json::array();
+    for (const BenchResult& result : results) {
+        BenchStats stats = bench_stats(result.samples_ms);
+        benchmarks.push_back({
+            { "name", result.name },
+            { "items", result.items },
+            { "min", stats.min },
+            { "median", stats.median },
+            { "mean", stats.mean },
+            { "stddev", stats.stddev },
+            { "p90", stats.p90 },
+            { "p99", stats.p99 },
+            { "max", stats.max },
+            { "samples", result.samples_ms },
+        });
+    }
+    report["benchmarks"] = benchmarks;
+
+    std::string text = report.dump(2) + "\n";
+    return write_file_utf8(path, text.data(), text.size());
+}
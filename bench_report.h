@@ -0,0 +1,34 @@
+// Timing reports shared by vrm_bench, the headless viewer and replay
+// benchmarks (no sokol dependency): summary statistics and the
+// "vrm_bench/1" JSON layout, so reports from any of them can be compared
+// benchmark by benchmark.
+#ifndef BENCH_REPORT_H
+#define BENCH_REPORT_H
+
+#include "nlohmann/json.hpp"
+
+#include <string>
+#include <vector>
+
+struct BenchResult {
+    std::string name;
+    double items;  // Work per repetition (vertices, texels, tasks, ...), 0 if not meaningful
+    std::vector<double> samples_ms;
+};
+
+struct BenchStats {
+    double min, median, mean, stddev, p90, p99, max;
+};
+
+// Linear interpolation between the closest ranks of sorted samples
+double bench_percentile(const std::vector<double>& sorted, double p);
+
+// All zero for no samples
+BenchStats bench_stats(std::vector<double> samples);
+
+// Writes schema, build type and hardware threads, then settings' keys,
+// then the unit and one entry per result with its stats and samples
+bool bench_write_json(const char* path, const nlohmann::ordered_json& settings,
+                      const std::vector<BenchResult>& results);
+
+#endif // BENCH_REPORT_H
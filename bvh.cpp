@@ -0,0 +1,628 @@
+// Triangle bounding volume hierarchy and the CPU ray queries built on it
+
+#include "bvh.h"
+#include "trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <thread>
+#include "parallel-util.hpp"
+
+namespace {
+
+const int BIN_COUNT = 16;
+const uint32_t MAX_LEAF_TRIANGLES = 8;  // Larger leaves are split even when SAH prefers a leaf
+const int MAX_DEPTH = 64;  // Traversal stack size
+const float PI = 3.14159265358979f;
+
+struct Aabb {
+    float min[3] = { INFINITY, INFINITY, INFINITY };
+    float max[3] = { -INFINITY, -INFINITY, -INFINITY };
+
+    void grow(const float* p) {
+        for (int a = 0; a < 3; a++) {
+            min[a] = std::min(min[a], p[a]);
+            max[a] = std::max(max[a], p[a]);
+        }
+    }
+    void grow(const Aabb& b) {
+        for (int a = 0; a < 3; a++) {
+            min[a] = std::min(min[a], b.min[a]);
+            max[a] = std::max(max[a], b.max[a]);
+        }
+    }
+    float area() const {
+        float d[3] = { max[0] - min[0], max[1] - min[1], max[2] - min[2] };
+        return d[0] < 0.0f ? 0.0f : 2.0f * (d[0] * d[1] + d[1] * d[2] + d[2] * d[0]);
+    }
+};
+
+struct BuildTriangle {
+    Aabb bounds;
+    float centroid[3];
+};
+
+struct Bin {
+    Aabb bounds;
+    uint32_t count = 0;
+};
+
+// Node bounds and centroid bounds over a range of triangles
+struct RangeInfo {
+    Aabb bounds;
+    Aabb centroids;
+};
+
+// SAH bins of every axis
+struct BinSet {
+    Bin bins[3][BIN_COUNT];
+};
+
+struct SubtreeTask {
+    uint32_t node;
+    size_t begin, end;
+    int depth;
+};
+
+// Run fn(chunk_begin, chunk_end, chunk) over [begin, end) split into chunk_count pieces
+template <typename Callable>
+void for_chunks(size_t begin, size_t end, int chunk_count, Callable fn) {
+    size_t n = end - begin;
+    auto run = [&](int c) {
+        TRACE_ZONE("bvh chunk");
+        fn(begin + n * c / chunk_count, begin + n * (c + 1) / chunk_count, c);
+    };
+    if (chunk_count > 1) {
+        parallelutil::parallel_for(chunk_count, run);
+    } else {
+        run(0);
+    }
+}
+
+struct Builder {
+    const std::vector<BuildTriangle>& triangles;
+    std::vector<uint32_t>& refs;
+    std::vector<BvhNode>& nodes;
+    std::vector<SubtreeTask>* deferred;  // Subtrees left for parallel building, null inside them
+    size_t defer_below;
+    int thread_count;
+    BinSet scratch;
+
+    int chunks_for(size_t count) const {
+        return deferred && count >= BVH_PARALLEL_MIN_TRIANGLES ? thread_count : 1;
+    }
+
+    void bounds_of(size_t begin, size_t end, RangeInfo& info) const {
+        auto accumulate = [&](size_t b, size_t e, Aabb& bounds, Aabb& centroids) {
+            for (size_t i = b; i < e; i++) {
+                bounds.grow(triangles[refs[i]].bounds);
+                centroids.grow(triangles[refs[i]].centroid);
+            }
+        };
+        int chunk_count = chunks_for(end - begin);
+        if (chunk_count == 1) {
+            accumulate(begin, end, info.bounds, info.centroids);
+            return;
+        }
+        std::vector<Aabb> bounds(chunk_count), centroids(chunk_count);
+        for_chunks(begin, end, chunk_count, [&](size_t b, size_t e, int c) { accumulate(b, e, bounds[c], centroids[c]); });
+        for (int c = 0; c < chunk_count; c++) {
+            info.bounds.grow(bounds[c]);
+            info.centroids.grow(centroids[c]);
+        }
+    }
+
+    int bin_of(const float* centroid, const RangeInfo& info, int axis) const {
+        float extent = info.centroids.max[axis] - info.centroids.min[axis];
+        int b = (int)((centroid[axis] - info.centroids.min[axis]) * (BIN_COUNT / extent));
+        return std::clamp(b, 0, BIN_COUNT - 1);
+    }
+
+    // Bins are only needed until the range is partitioned, so one set per
+    // builder is reused at every level
+    void bin(size_t begin, size_t end, const RangeInfo& info, BinSet& set) const {
+        auto accumulate = [&](size_t b, size_t e, Bin (&bins)[3][BIN_COUNT]) {
+            for (size_t i = b; i < e; i++) {
+                const BuildTriangle& tri = triangles[refs[i]];
+                for (int axis = 0; axis < 3; axis++) {
+                    if (info.centroids.max[axis] > info.centroids.min[axis]) {
+                        Bin& bin = bins[axis][bin_of(tri.centroid, info, axis)];
+                        bin.bounds.grow(tri.bounds);
+                        bin.count++;
+                    }
+                }
+            }
+        };
+        set = BinSet();
+        int chunk_count = chunks_for(end - begin);
+        if (chunk_count == 1) {
+            accumulate(begin, end, set.bins);
+            return;
+        }
+        std::vector<BinSet> partial(chunk_count);
+        for_chunks(begin, end, chunk_count, [&](size_t b, size_t e, int c) { accumulate(b, e, partial[c].bins); });
+        for (int c = 0; c < chunk_count; c++) {
+            for (int axis = 0; axis < 3; axis++) {
+                for (int b = 0; b < BIN_COUNT; b++) {
+                    set.bins[axis][b].bounds.grow(partial[c].bins[axis][b].bounds);
+                    set.bins[axis][b].count += partial[c].bins[axis][b].count;
+                }
+            }
+        }
+    }
+
+    void make_leaf(uint32_t node, size_t begin, size_t end) {
+        nodes[node].first = (uint32_t)begin;
+        nodes[node].count = (uint32_t)(end - begin);
+    }
+
+    void build(uint32_t node, size_t begin, size_t end, int depth) {
+        RangeInfo info;
+        bounds_of(begin, end, info);
+        memcpy(nodes[node].min, info.bounds.min, sizeof(info.bounds.min));
+        memcpy(nodes[node].max, info.bounds.max, sizeof(info.bounds.max));
+        size_t count = end - begin;
+        if (count <= 2 || depth >= MAX_DEPTH - 1) {
+            make_leaf(node, begin, end);
+            return;
+        }
+        if (deferred && count < defer_below) {
+            deferred->push_back({ node, begin, end, depth });
+            return;
+        }
+
+        // Cheapest bin boundary by the surface area heuristic, with
+        // traversal and intersection costed equally
+        BinSet& set = scratch;
+        bin(begin, end, info, set);
+        int best_axis = -1, best_split = 0;
+        float best_cost = INFINITY;
+        for (int axis = 0; axis < 3; axis++) {
+            if (info.centroids.max[axis] <= info.centroids.min[axis]) {
+                continue;
+            }
+            float right_cost[BIN_COUNT];
+            Aabb right;
+            uint32_t right_count = 0;
+            for (int b = BIN_COUNT - 1; b > 0; b--) {
+                right.grow(set.bins[axis][b].bounds);
+                right_count += set.bins[axis][b].count;
+                right_cost[b] = right.area() * right_count;
+            }
+            Aabb left;
+            uint32_t left_count = 0;
+            for (int b = 1; b < BIN_COUNT; b++) {
+                left.grow(set.bins[axis][b - 1].bounds);
+                left_count += set.bins[axis][b - 1].count;
+                float cost = left.area() * left_count + right_cost[b];
+                if (left_count > 0 && left_count < count && cost < best_cost) {
+                    best_cost = cost;
+                    best_axis = axis;
+                    best_split = b;
+                }
+            }
+        }
+        float area = info.bounds.area();
+        bool split_pays = best_axis >= 0 && (area <= 0.0f || 1.0f + best_cost / area < (float)count);
+        if (!split_pays && count <= MAX_LEAF_TRIANGLES) {
+            make_leaf(node, begin, end);
+            return;
+        }
+
+        size_t mid;
+        if (best_axis >= 0) {
+            mid = std::partition(refs.begin() + begin, refs.begin() + end, [&](uint32_t t) {
+                      return bin_of(triangles[t].centroid, info, best_axis) < best_split;
+                  }) - refs.begin();
+        } else {
+            mid = begin + count / 2;  // Coincident centroids: any split is as good
+        }
+
+        uint32_t left = (uint32_t)nodes.size();
+        nodes.emplace_back();
+        nodes.emplace_back();
+        nodes[node].first = left;
+        nodes[node].count = 0;
+        build(left, begin, mid, depth + 1);
+        build(left + 1, mid, end, depth + 1);
+    }
+};
+
+// Cranley-Patterson rotation of each vertex's sample set, so neighbouring
+// vertices do not repeat the same directions
+uint32_t hash32(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7FEB352Du;
+    x ^= x >> 15;
+    x *= 0x846CA68Bu;
+    x ^= x >> 16;
+    return x;
+}
+
+// Van der Corput sequence, the second coordinate of Hammersley points
+float radical_inverse(uint32_t i) {
+    i = (i << 16) | (i >> 16);
+    i = ((i & 0x55555555u) << 1) | ((i & 0xAAAAAAAAu) >> 1);
+    i = ((i & 0x33333333u) << 2) | ((i & 0xCCCCCCCCu) >> 2);
+    i = ((i & 0x0F0F0F0Fu) << 4) | ((i & 0xF0F0F0F0u) >> 4);
+    i = ((i & 0x00FF00FFu) << 8) | ((i & 0xFF00FF00u) >> 8);
+    return (float)i * 2.3283064365386963e-10f;
+}
+
+} // namespace
+
+void bvh_build(Bvh& bvh, const float* positions, size_t vertex_count, const uint32_t* indices, size_t index_count) {
+    TRACE_ZONE("bvh_build");
+    bvh.nodes.clear();
+    bvh.triangles.clear();
+    bvh.corners.clear();
+
+    std::vector<BuildTriangle> triangles(index_count / 3);
+    std::vector<uint8_t> valid(triangles.size());
+    auto prepare = [&](int t) {
+        const uint32_t* tri = indices + (size_t)t * 3;
+        valid[t] = tri[0] < vertex_count && tri[1] < vertex_count && tri[2] < vertex_count;
+        if (!valid[t]) {
+            return;
+        }
+        BuildTriangle& out = triangles[t];
+        for (int c = 0; c < 3; c++) {
+            out.bounds.grow(positions + (size_t)tri[c] * 3);
+        }
+        for (int a = 0; a < 3; a++) {
+            out.centroid[a] = (out.bounds.min[a] + out.bounds.max[a]) * 0.5f;
+        }
+    };
+    if (triangles.size() >= BVH_PARALLEL_MIN_TRIANGLES) {
+        parallelutil::parallel_for((int)triangles.size(), prepare);
+    } else {
+        for (size_t t = 0; t < triangles.size(); t++) {
+            prepare((int)t);
+        }
+    }
+    std::vector<uint32_t> refs;
+    refs.reserve(triangles.size());
+    for (size_t t = 0; t < triangles.size(); t++) {
+        if (valid[t]) {
+            refs.push_back((uint32_t)t);
+        }
+    }
+    if (refs.empty()) {
+        return;
+    }
+
+    // The top levels split the whole range with threads binning in
+    // parallel; the subtrees below them are then built concurrently, each
+    // into its own node array, and spliced behind the top levels
+    int thread_count = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<SubtreeTask> tasks;
+    bvh.nodes.reserve(refs.size() * 2 / 3);
+    bvh.nodes.emplace_back();
+    Builder top = { triangles, refs, bvh.nodes, &tasks, std::max<size_t>(refs.size() / (thread_count * 4), 1024),
+                    thread_count, {} };
+    top.build(0, 0, refs.size(), 0);
+
+    std::vector<std::vector<BvhNode>> subtrees(tasks.size());
+    if (!tasks.empty()) {
+        parallelutil::queue_based_parallel_for((int)tasks.size(), [&](int i) {
+            TRACE_ZONE("bvh subtree");
+            const SubtreeTask& task = tasks[i];
+            subtrees[i].reserve((task.end - task.begin) * 2 / 3 + 1);
+            subtrees[i].push_back(bvh.nodes[task.node]);
+            Builder sub = { triangles, refs, subtrees[i], nullptr, 0, 1, {} };
+            sub.build(0, task.begin, task.end, task.depth);
+        });
+    }
+    for (size_t i = 0; i < tasks.size(); i++) {
+        // Local node 0 replaces the placeholder, the rest are appended
+        uint32_t base = (uint32_t)bvh.nodes.size() - 1;
+        for (BvhNode& node : subtrees[i]) {
+            if (node.count == 0) {
+                node.first += base;
+            }
+        }
+        bvh.nodes[tasks[i].node] = subtrees[i][0];
+        bvh.nodes.insert(bvh.nodes.end(), subtrees[i].begin() + 1, subtrees[i].end());
+    }
+
+    bvh.triangles = std::move(refs);
+    bvh.corners.resize(bvh.triangles.size() * 9);
+    for (size_t i = 0; i < bvh.triangles.size(); i++) {
+        const uint32_t* tri = indices + (size_t)bvh.triangles[i] * 3;
+        const float* p[3] = { positions + (size_t)tri[0] * 3, positions + (size_t)tri[1] * 3,
+                              positions + (size_t)tri[2] * 3 };
+        float* out = bvh.corners.data() + i * 9;
+        for (int a = 0; a < 3; a++) {
+            out[a] = p[0][a];
+            out[3 + a] = p[1][a] - p[0][a];
+            out[6 + a] = p[2][a] - p[0][a];
+        }
+    }
+}
+
+void bvh_refit(Bvh& bvh, const float* positions, const uint32_t* indices) {
+    for (size_t i = 0; i < bvh.triangles.size(); i++) {
+        const uint32_t* tri = indices + (size_t)bvh.triangles[i] * 3;
+        float* out = bvh.corners.data() + i * 9;
+        for (int a = 0; a < 3; a++) {
+            out[a] = positions[(size_t)tri[0] * 3 + a];
+            out[3 + a] = positions[(size_t)tri[1] * 3 + a] - out[a];
+            out[6 + a] = positions[(size_t)tri[2] * 3 + a] - out[a];
+        }
+    }
+    // Children always follow their parent, so a reverse sweep sees them first
+    for (size_t n = bvh.nodes.size(); n-- > 0;) {
+        BvhNode& node = bvh.nodes[n];
+        Aabb bounds;
+        if (node.count > 0) {
+            for (uint32_t t = node.first; t < node.first + node.count; t++) {
+                const float* c = bvh.corners.data() + (size_t)t * 9;
+                float p1[3] = { c[0] + c[3], c[1] + c[4], c[2] + c[5] };
+                float p2[3] = { c[0] + c[6], c[1] + c[7], c[2] + c[8] };
+                bounds.grow(c);
+                bounds.grow(p1);
+                bounds.grow(p2);
+            }
+        } else {
+            for (uint32_t child = node.first; child < node.first + 2; child++) {
+                bounds.grow(bvh.nodes[child].min);
+                bounds.grow(bvh.nodes[child].max);
+            }
+        }
+        memcpy(node.min, bounds.min, sizeof(bounds.min));
+        memcpy(node.max, bounds.max, sizeof(bounds.max));
+    }
+}
+
+bool bvh_intersect(const Bvh& bvh, const float origin[3], const float dir[3], float tmax, BvhTriangleFilter filter,
+                   void* user, BvhHit* hit) {
+    if (bvh.nodes.empty()) {
+        return false;
+    }
+    float inv_dir[3];
+    for (int a = 0; a < 3; a++) {
+        inv_dir[a] = 1.0f / (fabsf(dir[a]) > 1e-20f ? dir[a] : (dir[a] < 0.0f ? -1e-20f : 1e-20f));
+    }
+    // Entry distance of the ray into a node within the current closest hit, or INFINITY
+    auto enter = [&](const BvhNode& node) {
+        float t_near = 0.0f, t_far = tmax;
+        for (int a = 0; a < 3; a++) {
+            float t0 = (node.min[a] - origin[a]) * inv_dir[a];
+            float t1 = (node.max[a] - origin[a]) * inv_dir[a];
+            t_near = std::max(t_near, std::min(t0, t1));
+            t_far = std::min(t_far, std::max(t0, t1));
+        }
+        return t_near <= t_far ? t_near : INFINITY;
+    };
+
+    bool found = false;
+    uint32_t stack[MAX_DEPTH];
+    int stack_size = 0;
+    uint32_t node_index = 0;
+    if (enter(bvh.nodes[0]) == INFINITY) {
+        return false;
+    }
+    for (;;) {
+        const BvhNode& node = bvh.nodes[node_index];
+        if (node.count == 0) {
+            // Visit the nearer child first and skip children behind the closest hit
+            float t_left = enter(bvh.nodes[node.first]);
+            float t_right = enter(bvh.nodes[node.first + 1]);
+            uint32_t near_child = t_left <= t_right ? node.first : node.first + 1;
+            uint32_t far_child = t_left <= t_right ? node.first + 1 : node.first;
+            float t_far_child = std::max(t_left, t_right);
+            if (std::min(t_left, t_right) != INFINITY) {
+                if (t_far_child != INFINITY) {
+                    stack[stack_size++] = far_child;
+                }
+                node_index = near_child;
+                continue;
+            }
+        } else {
+            for (uint32_t t = node.first; t < node.first + node.count; t++) {
+                const float* c = bvh.corners.data() + (size_t)t * 9;
+                float p[3] = { dir[1] * c[8] - dir[2] * c[7], dir[2] * c[6] - dir[0] * c[8], dir[0] * c[7] - dir[1] * c[6] };
+                float det = c[3] * p[0] + c[4] * p[1] + c[5] * p[2];
+                if (fabsf(det) <= 1e-20f) {
+                    continue;
+                }
+                float inv_det = 1.0f / det;
+                float s[3] = { origin[0] - c[0], origin[1] - c[1], origin[2] - c[2] };
+                float u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * inv_det;
+                float q[3] = { s[1] * c[5] - s[2] * c[4], s[2] * c[3] - s[0] * c[5], s[0] * c[4] - s[1] * c[3] };
+                float v = (dir[0] * q[0] + dir[1] * q[1] + dir[2] * q[2]) * inv_det;
+                float dist = (c[6] * q[0] + c[7] * q[1] + c[8] * q[2]) * inv_det;
+                if (u < 0.0f || v < 0.0f || u + v > 1.0f || dist <= 0.0f || dist >= tmax) {
+                    continue;
+                }
+                if (filter && !filter(bvh.triangles[t], user)) {
+                    continue;
+                }
+                tmax = dist;
+                hit->triangle = bvh.triangles[t];
+                hit->t = dist;
+                hit->u = u;
+                hit->v = v;
+                found = true;
+            }
+        }
+        // Pop, dropping nodes the closest hit has moved in front of
+        do {
+            if (stack_size == 0) {
+                return found;
+            }
+            node_index = stack[--stack_size];
+        } while (enter(bvh.nodes[node_index]) == INFINITY);
+    }
+}
+
+uint32_t bvh_occluded(const Bvh& bvh, const BvhRayPacket& packet) {
+    const int N = BVH_PACKET_SIZE;
+    const uint32_t all = (1u << N) - 1;
+    if (bvh.nodes.empty()) {
+        return 0;
+    }
+    float inv_dir[3][N];
+    for (int a = 0; a < 3; a++) {
+        for (int i = 0; i < N; i++) {
+            float d = packet.dir[a][i];
+            inv_dir[a][i] = 1.0f / (fabsf(d) > 1e-20f ? d : (d < 0.0f ? -1e-20f : 1e-20f));
+        }
+    }
+
+    float mean_dir[3] = { 0.0f, 0.0f, 0.0f };
+    for (int a = 0; a < 3; a++) {
+        for (int i = 0; i < N; i++) {
+            mean_dir[a] += packet.dir[a][i];
+        }
+    }
+
+    uint32_t occluded = 0;
+    uint32_t stack[MAX_DEPTH];
+    int stack_size = 0;
+    uint32_t node_index = 0;
+    for (;;) {
+        const BvhNode& node = bvh.nodes[node_index];
+        int lane_hit[N];
+        for (int i = 0; i < N; i++) {
+            float t0 = (node.min[0] - packet.origin[0][i]) * inv_dir[0][i];
+            float t1 = (node.max[0] - packet.origin[0][i]) * inv_dir[0][i];
+            float t2 = (node.min[1] - packet.origin[1][i]) * inv_dir[1][i];
+            float t3 = (node.max[1] - packet.origin[1][i]) * inv_dir[1][i];
+            float t4 = (node.min[2] - packet.origin[2][i]) * inv_dir[2][i];
+            float t5 = (node.max[2] - packet.origin[2][i]) * inv_dir[2][i];
+            float t_near = std::max(std::max(std::min(t0, t1), std::min(t2, t3)), std::max(std::min(t4, t5), 0.0f));
+            float t_far = std::min(std::min(std::max(t0, t1), std::max(t2, t3)), std::min(std::max(t4, t5), packet.tmax[i]));
+            lane_hit[i] = t_near <= t_far;
+        }
+        uint32_t active = 0;
+        for (int i = 0; i < N; i++) {
+            active |= (uint32_t)lane_hit[i] << i;
+        }
+        active &= ~occluded;
+
+        if (active && node.count == 0) {
+            // Nearer child first along the packet's mean direction, so
+            // occluders close to the origins end lanes early
+            const BvhNode& left = bvh.nodes[node.first];
+            const BvhNode& right = bvh.nodes[node.first + 1];
+            float order = 0.0f;
+            for (int a = 0; a < 3; a++) {
+                order += (right.min[a] + right.max[a] - left.min[a] - left.max[a]) * mean_dir[a];
+            }
+            bool right_first = order < 0.0f;
+            stack[stack_size++] = node.first + (right_first ? 0 : 1);
+            node_index = node.first + (right_first ? 1 : 0);
+            continue;
+        }
+        if (active) {
+            for (uint32_t t = node.first; t < node.first + node.count; t++) {
+                // Moller-Trumbore across the lanes
+                const float* c = bvh.corners.data() + (size_t)t * 9;
+                for (int i = 0; i < N; i++) {
+                    float dx = packet.dir[0][i], dy = packet.dir[1][i], dz = packet.dir[2][i];
+                    float px = dy * c[8] - dz * c[7], py = dz * c[6] - dx * c[8], pz = dx * c[7] - dy * c[6];
+                    float det = c[3] * px + c[4] * py + c[5] * pz;
+                    float inv_det = 1.0f / det;
+                    float sx = packet.origin[0][i] - c[0], sy = packet.origin[1][i] - c[1], sz = packet.origin[2][i] - c[2];
+                    float u = (sx * px + sy * py + sz * pz) * inv_det;
+                    float qx = sy * c[5] - sz * c[4], qy = sz * c[3] - sx * c[5], qz = sx * c[4] - sy * c[3];
+                    float v = (dx * qx + dy * qy + dz * qz) * inv_det;
+                    float dist = (c[6] * qx + c[7] * qy + c[8] * qz) * inv_det;
+                    lane_hit[i] = (fabsf(det) > 1e-20f) & (u >= 0.0f) & (v >= 0.0f) & (u + v <= 1.0f) & (dist > 0.0f) &
+                                  (dist < packet.tmax[i]);
+                }
+                for (int i = 0; i < N; i++) {
+                    occluded |= (uint32_t)lane_hit[i] << i;
+                }
+            }
+            if (occluded == all) {
+                return occluded;
+            }
+        }
+        if (stack_size == 0) {
+            return occluded;
+        }
+        node_index = stack[--stack_size];
+    }
+}
+
+OcclusionBakeStats bake_vertex_occlusion(const Bvh& bvh, const float* positions, const float* normals,
+                                         size_t vertex_count, int rays, float distance, float* occlusion) {
+    TRACE_ZONE("bake_vertex_occlusion");
+    const int N = BVH_PACKET_SIZE;
+    auto start = std::chrono::steady_clock::now();
+    int packet_count = std::max(1, (rays + N - 1) / N);
+    int ray_count = packet_count * N;
+
+    // Hammersley points, mapped per vertex onto the cosine-weighted hemisphere
+    std::vector<float> base_u(ray_count), base_v(ray_count);
+    for (int r = 0; r < ray_count; r++) {
+        base_u[r] = (r + 0.5f) / ray_count;
+        base_v[r] = radical_inverse((uint32_t)r);
+    }
+    float bias = distance * 1e-3f;  // Keeps rays from hitting the triangles they start on
+
+    const size_t chunk = 64;
+    std::atomic<uint64_t> traced{ 0 };
+    auto bake_chunk = [&](int c) {
+        TRACE_ZONE("occlusion chunk");
+        uint64_t chunk_rays = 0;
+        size_t end = std::min(vertex_count, (size_t)(c + 1) * chunk);
+        for (size_t v = (size_t)c * chunk; v < end; v++) {
+            const float* p = positions + v * 3;
+            float n[3] = { normals[v * 3 + 0], normals[v * 3 + 1], normals[v * 3 + 2] };
+            float len = sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            if (bvh.nodes.empty() || !(len > 1e-12f)) {
+                occlusion[v] = 1.0f;
+                continue;
+            }
+            for (int a = 0; a < 3; a++) {
+                n[a] /= len;
+            }
+            // Orthonormal basis around the normal (Duff et al. 2017)
+            float sign = n[2] >= 0.0f ? 1.0f : -1.0f;
+            float a = -1.0f / (sign + n[2]);
+            float b = n[0] * n[1] * a;
+            float tx[3] = { 1.0f + sign * n[0] * n[0] * a, sign * b, -sign * n[0] };
+            float bx[3] = { b, sign + n[1] * n[1] * a, -n[1] };
+
+            uint32_t h = hash32((uint32_t)v);
+            float shift_u = (h & 0xFFFF) / 65536.0f, shift_v = (h >> 16) / 65536.0f;
+            int hits = 0;
+            BvhRayPacket packet;
+            for (int k = 0; k < packet_count; k++) {
+                for (int i = 0; i < N; i++) {
+                    int r = k * N + i;
+                    float u = base_u[r] + shift_u, w = base_v[r] + shift_v;
+                    u -= u >= 1.0f ? 1.0f : 0.0f;
+                    w -= w >= 1.0f ? 1.0f : 0.0f;
+                    float radius = sqrtf(u), phi = 2.0f * PI * w;
+                    float lx = radius * cosf(phi), ly = radius * sinf(phi), lz = sqrtf(std::max(0.0f, 1.0f - u));
+                    for (int axis = 0; axis < 3; axis++) {
+                        packet.origin[axis][i] = p[axis] + n[axis] * bias;
+                        packet.dir[axis][i] = tx[axis] * lx + bx[axis] * ly + n[axis] * lz;
+                    }
+                    packet.tmax[i] = distance;
+                }
+                hits += std::popcount(bvh_occluded(bvh, packet));
+            }
+            occlusion[v] = 1.0f - (float)hits / ray_count;
+            chunk_rays += ray_count;
+        }
+        traced += chunk_rays;
+    };
+    int chunk_count = (int)((vertex_count + chunk - 1) / chunk);
+    if (chunk_count > 0) {
+        parallelutil::queue_based_parallel_for(chunk_count, bake_chunk);
+    }
+
+    OcclusionBakeStats stats;
+    stats.rays = traced;
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
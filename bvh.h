@@ -0,0 +1,71 @@
+// Triangle bounding volume hierarchy and the CPU ray queries built on it
+// (no sokol dependency): ambient occlusion baking at import and picking
+#ifndef BVH_H
+#define BVH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Rays traced together; a packet shares one traversal of the tree and each
+// step loops over the lanes in structure-of-arrays form, which the compiler
+// turns into SIMD on every target without intrinsics
+#define BVH_PACKET_SIZE 8
+
+// Triangles from which building splits work across threads
+#define BVH_PARALLEL_MIN_TRIANGLES 16384
+
+struct BvhNode {
+    float min[3];
+    uint32_t first;  // Inner node: left child (right child follows it); leaf: first triangle
+    float max[3];
+    uint32_t count;  // Triangles in a leaf, 0 for inner nodes
+};
+
+struct Bvh {
+    std::vector<BvhNode> nodes;  // nodes[0] is the root, empty for an empty mesh
+    std::vector<uint32_t> triangles;  // Source triangle of each leaf slot
+    std::vector<float> corners;  // Per leaf slot: v0, v1 - v0, v2 - v0 (9 floats)
+};
+
+struct BvhRayPacket {
+    float origin[3][BVH_PACKET_SIZE];
+    float dir[3][BVH_PACKET_SIZE];
+    float tmax[BVH_PACKET_SIZE];
+};
+
+// Binned SAH build over an indexed triangle list (float3 positions);
+// triangles with an out-of-range index are left out
+void bvh_build(Bvh& bvh, const float* positions, size_t vertex_count, const uint32_t* indices, size_t index_count);
+
+// Refit node bounds and leaf triangles to moved positions, keeping the
+// tree; cheaper than a rebuild for deforming meshes whose triangles stay
+// roughly where they were. indices must be the ones the tree was built from.
+void bvh_refit(Bvh& bvh, const float* positions, const uint32_t* indices);
+
+// Closest hit of one ray (either side) in (0, tmax). filter, if given,
+// rejects triangles by source index, e.g. geometry that is not drawn.
+typedef bool (*BvhTriangleFilter)(uint32_t triangle, void* user);
+struct BvhHit {
+    uint32_t triangle;  // Source triangle
+    float t;
+    float u, v;  // Barycentrics of corners 1 and 2
+};
+bool bvh_intersect(const Bvh& bvh, const float origin[3], const float dir[3], float tmax, BvhTriangleFilter filter,
+                   void* user, BvhHit* hit);
+
+// Bit i set when ray i of the packet hits any triangle (either side) in (0, tmax)
+uint32_t bvh_occluded(const Bvh& bvh, const BvhRayPacket& packet);
+
+// Per-vertex ambient occlusion: the fraction of rays cast from each vertex
+// over the cosine-weighted hemisphere around its normal that escape within
+// distance. rays is rounded up to whole packets. occlusion receives 1 for
+// open vertices down to 0 for fully enclosed ones.
+struct OcclusionBakeStats {
+    uint64_t rays;
+    double seconds;
+};
+OcclusionBakeStats bake_vertex_occlusion(const Bvh& bvh, const float* positions, const float* normals,
+                                         size_t vertex_count, int rays, float distance, float* occlusion);
+
+#endif // BVH_H
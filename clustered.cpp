@@ -0,0 +1,368 @@
+// Clustered light assignment
+
+#include "clustered.h"
+#include "trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+const float PI = 3.14159265358979f;
+
+// Bounding sphere of a light's reach; spot cones get the tighter sphere
+// around the cone and its cap (apex and rim for narrow cones, the rim
+// circle for wide ones)
+void light_bounds(const PunctualLight& light, float center[3], float* radius) {
+    float cos_outer = light.spot_scale > 0.0f ? -light.spot_offset / light.spot_scale : -1.0f;
+    float along = 0.0f;
+    *radius = light.range;
+    if (cos_outer >= 0.70710678f) {
+        along = light.range / (2.0f * cos_outer);
+        *radius = along;
+    } else if (cos_outer > 0.0f) {
+        along = light.range * cos_outer;
+        *radius = light.range * sqrtf(1.0f - cos_outer * cos_outer);
+    }
+    for (int a = 0; a < 3; a++) {
+        center[a] = light.position[a] + light.direction[a] * along;
+    }
+}
+
+void transform_point(const float m[16], const float p[3], float out[3]) {
+    for (int a = 0; a < 3; a++) {
+        out[a] = m[a] * p[0] + m[4 + a] * p[1] + m[8 + a] * p[2] + m[12 + a];
+    }
+}
+
+// Depth where slice k starts; slice 0 starts at the camera
+float slice_start(const ClusterFrustum& frustum, int k) {
+    if (k == 0) {
+        return 0.0f;
+    }
+    return frustum.z_near * powf(frustum.z_far / frustum.z_near, (float)k / CLUSTER_GRID_Z);
+}
+
+// View-space extent along one axis of the cells between ndc lo and hi over
+// depths [near, far]: the cell edges are planes through the camera
+void cell_extent(float lo, float hi, float scale, float near_depth, float far_depth, float* min, float* max) {
+    *min = std::min(lo * near_depth, lo * far_depth) * scale;
+    *max = std::max(hi * near_depth, hi * far_depth) * scale;
+}
+
+// Distance from v to [lo, hi]
+inline float outside(float v, float lo, float hi) {
+    return std::max(std::max(lo - v, v - hi), 0.0f);
+}
+
+void assign_slice(ClusterGrid& grid, const ClusterFrustum& frustum, int k) {
+    TRACE_ZONE("cluster slice");
+    ClusterSliceScratch& s = grid.slices[k];
+    size_t light_count = grid.view_x.size();
+    float depth_lo = slice_start(frustum, k);
+    float depth_hi = slice_start(frustum, k + 1);
+    s.indices.clear();
+    s.max_cluster_lights = 0;
+    s.overflowed_clusters = 0;
+    s.dropped_lights = 0;
+
+    // Lights overlapping the slice's depth range. Each pass computes a mask
+    // over structure-of-arrays lanes (vectorized by the compiler), then
+    // compacts the survivors without branching.
+    s.mask.resize(light_count);
+    for (size_t i = 0; i < light_count; i++) {
+        float d = outside(grid.view_depth[i], depth_lo, depth_hi);
+        s.mask[i] = d * d < grid.view_radius[i] * grid.view_radius[i];
+    }
+    s.x.resize(light_count);
+    s.y.resize(light_count);
+    s.depth_dist2.resize(light_count);
+    s.radius2.resize(light_count);
+    s.light.resize(light_count);
+    size_t candidates = 0;
+    for (size_t i = 0; i < light_count; i++) {
+        float d = outside(grid.view_depth[i], depth_lo, depth_hi);
+        s.x[candidates] = grid.view_x[i];
+        s.y[candidates] = grid.view_y[i];
+        s.depth_dist2[candidates] = d * d;
+        s.radius2[candidates] = grid.view_radius[i] * grid.view_radius[i];
+        s.light[candidates] = (uint32_t)i;
+        candidates += s.mask[i];
+    }
+
+    // Sized by the light count rather than this frame's candidates, and the
+    // lists for the worst case, so moving lights never grow them
+    s.row_x.resize(light_count);
+    s.row_dist2.resize(light_count);
+    s.row_radius2.resize(light_count);
+    s.row_light.resize(light_count);
+    s.nearest.resize(light_count);
+    s.indices.reserve(CLUSTER_GRID_X * CLUSTER_GRID_Y * std::min(light_count, (size_t)CLUSTER_MAX_LIGHTS) +
+                      light_count);
+    float scale_x = 1.0f / frustum.proj_x, scale_y = 1.0f / frustum.proj_y;
+    for (int ty = 0; ty < CLUSTER_GRID_Y; ty++) {
+        float y_lo, y_hi;
+        cell_extent(-1.0f + 2.0f * ty / CLUSTER_GRID_Y, -1.0f + 2.0f * (ty + 1) / CLUSTER_GRID_Y, scale_y, depth_lo,
+                    depth_hi, &y_lo, &y_hi);
+        size_t row_count = 0;
+        for (size_t i = 0; i < candidates; i++) {
+            float d = outside(s.y[i], y_lo, y_hi);
+            s.mask[i] = s.depth_dist2[i] + d * d < s.radius2[i];
+        }
+        for (size_t i = 0; i < candidates; i++) {
+            float d = outside(s.y[i], y_lo, y_hi);
+            s.row_x[row_count] = s.x[i];
+            s.row_dist2[row_count] = s.depth_dist2[i] + d * d;
+            s.row_radius2[row_count] = s.radius2[i];
+            s.row_light[row_count] = s.light[i];
+            row_count += s.mask[i];
+        }
+
+        for (int tx = 0; tx < CLUSTER_GRID_X; tx++) {
+            uint32_t* range = &grid.ranges[2 * (((size_t)k * CLUSTER_GRID_Y + ty) * CLUSTER_GRID_X + tx)];
+            range[0] = (uint32_t)s.indices.size();
+            range[1] = 0;
+            if (row_count == 0) {
+                continue;
+            }
+            float x_lo, x_hi;
+            cell_extent(-1.0f + 2.0f * tx / CLUSTER_GRID_X, -1.0f + 2.0f * (tx + 1) / CLUSTER_GRID_X, scale_x,
+                        depth_lo, depth_hi, &x_lo, &x_hi);
+            for (size_t i = 0; i < row_count; i++) {
+                float d = outside(s.row_x[i], x_lo, x_hi);
+                s.mask[i] = s.row_dist2[i] + d * d < s.row_radius2[i];
+            }
+            size_t first = s.indices.size();
+            s.indices.resize(first + row_count);
+            uint32_t* out = s.indices.data() + first;
+            uint32_t count = 0;
+            for (size_t i = 0; i < row_count; i++) {
+                out[count] = s.row_light[i];
+                count += s.mask[i];
+            }
+            s.max_cluster_lights = std::max(s.max_cluster_lights, count);
+            if (count > CLUSTER_MAX_LIGHTS) {
+                // Keep the lights with the smallest distance to the cell
+                // relative to their range, the least attenuated, so a light
+                // is dropped only where it adds the least rather than by its
+                // index, which popped lights along cell seams
+                size_t n = 0;
+                for (size_t i = 0; i < row_count; i++) {
+                    if (s.mask[i]) {
+                        float d = outside(s.row_x[i], x_lo, x_hi);
+                        float reach = (s.row_dist2[i] + d * d) / s.row_radius2[i];
+                        uint32_t bits;
+                        memcpy(&bits, &reach, sizeof(bits));  // Ordered like the float, as reach >= 0
+                        s.nearest[n++] = (uint64_t)bits << 32 | s.row_light[i];
+                    }
+                }
+                std::nth_element(s.nearest.begin(), s.nearest.begin() + CLUSTER_MAX_LIGHTS, s.nearest.begin() + n);
+                for (int j = 0; j < CLUSTER_MAX_LIGHTS; j++) {
+                    out[j] = (uint32_t)s.nearest[j];
+                }
+                s.overflowed_clusters++;
+                s.dropped_lights += count - CLUSTER_MAX_LIGHTS;
+                count = CLUSTER_MAX_LIGHTS;
+            }
+            s.indices.resize(first + count);
+            range[1] = count;
+        }
+    }
+}
+
+// ============================================================================
+// Slice workers
+// ============================================================================
+
+// Assignment runs every frame, and parallel-util starts new threads (and
+// queues) on every call, which allocates each frame. These threads start
+// on first use and live until exit; the calling thread works too.
+struct SliceJob {
+    void (*task)(void* context, int index);
+    void* context;
+    int count;
+};
+
+std::mutex g_workers_mutex;
+std::condition_variable g_workers_wake;  // A job was posted, or quit
+std::condition_variable g_workers_done;  // busy reached 0
+std::vector<std::thread> g_workers;
+bool g_workers_started = false;
+bool g_workers_quit = false;
+SliceJob g_job;
+uint64_t g_job_generation = 0;
+int g_workers_busy = 0;  // Workers yet to finish the current job
+std::atomic<int> g_next_index{ 0 };
+
+void run_job(const SliceJob& job) {
+    for (int k = g_next_index.fetch_add(1); k < job.count; k = g_next_index.fetch_add(1)) {
+        job.task(job.context, k);
+    }
+}
+
+void worker_loop() {
+    trace_set_thread_name("cluster worker");
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(g_workers_mutex);
+    for (;;) {
+        g_workers_wake.wait(lock, [&] { return g_workers_quit || g_job_generation != seen; });
+        if (g_workers_quit) {
+            return;
+        }
+        seen = g_job_generation;
+        SliceJob job = g_job;
+        lock.unlock();
+        run_job(job);
+        lock.lock();
+        if (--g_workers_busy == 0) {
+            g_workers_done.notify_one();
+        }
+    }
+}
+
+// Runs task(context, k) for every k in [0, count) and returns when all are done
+void run_on_workers(int count, void (*task)(void*, int), void* context) {
+    SliceJob job = { task, context, count };
+    {
+        std::lock_guard<std::mutex> lock(g_workers_mutex);
+        if (!g_workers_started) {
+            g_workers_started = true;
+            unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+            for (unsigned t = 1; t < std::min(threads, (unsigned)CLUSTER_GRID_Z); t++) {
+                g_workers.emplace_back(worker_loop);
+            }
+        }
+        g_job = job;
+        g_next_index.store(0);
+        g_workers_busy = (int)g_workers.size();
+        g_job_generation++;
+    }
+    g_workers_wake.notify_all();
+    run_job(job);
+    std::unique_lock<std::mutex> lock(g_workers_mutex);
+    g_workers_done.wait(lock, [] { return g_workers_busy == 0; });
+}
+
+// Workers still waiting at exit would terminate the process
+struct WorkersShutdown {
+    ~WorkersShutdown() {
+        {
+            std::lock_guard<std::mutex> lock(g_workers_mutex);
+            g_workers_quit = true;
+        }
+        g_workers_wake.notify_all();
+        for (std::thread& worker : g_workers) {
+            worker.join();
+        }
+    }
+} g_workers_shutdown;
+
+} // namespace
+
+void punctual_light_point(PunctualLight& light, const float position[3], float range, const float color[3]) {
+    for (int a = 0; a < 3; a++) {
+        light.position[a] = position[a];
+        light.color[a] = color[a];
+        light.direction[a] = 0.0f;
+    }
+    light.direction[1] = -1.0f;
+    light.range = range;
+    light.spot_scale = 0.0f;
+    light.spot_offset = 1.0f;
+}
+
+void punctual_light_spot(PunctualLight& light, const float position[3], const float direction[3], float range,
+                         const float color[3], float inner_angle, float outer_angle) {
+    punctual_light_point(light, position, range, color);
+    float length = sqrtf(direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2]);
+    for (int a = 0; a < 3; a++) {
+        light.direction[a] = length > 0.0f ? direction[a] / length : (a == 1 ? -1.0f : 0.0f);
+    }
+    outer_angle = std::clamp(outer_angle, 0.0f, PI * 0.5f);
+    float cos_outer = cosf(outer_angle);
+    float cos_inner = cosf(std::clamp(inner_angle, 0.0f, outer_angle));
+    light.spot_scale = 1.0f / std::max(cos_inner - cos_outer, 0.001f);
+    light.spot_offset = -cos_outer * light.spot_scale;
+}
+
+void cluster_fit_depth(ClusterFrustum& frustum, const PunctualLight* lights, size_t light_count) {
+    float far_depth = frustum.z_near * 2.0f;
+    for (size_t i = 0; i < light_count; i++) {
+        float center[3], radius, view[3];
+        light_bounds(lights[i], center, &radius);
+        transform_point(frustum.view, center, view);
+        far_depth = std::max(far_depth, -view[2] + radius);
+    }
+    frustum.z_far = std::min(far_depth, frustum.z_far);
+}
+
+ClusterStats cluster_assign_lights(ClusterGrid& grid, const ClusterFrustum& frustum, const PunctualLight* lights,
+                                   size_t light_count) {
+    TRACE_ZONE("cluster_assign_lights");
+    auto start = std::chrono::steady_clock::now();
+    ClusterStats stats = {};
+    float log_ratio = logf(frustum.z_far / frustum.z_near);
+    grid.depth_scale = CLUSTER_GRID_Z / log_ratio;
+    grid.depth_bias = -logf(frustum.z_near) * grid.depth_scale;
+    grid.ranges.resize(CLUSTER_COUNT * 2);
+    grid.slices.resize(CLUSTER_GRID_Z);
+
+    grid.view_x.resize(light_count);
+    grid.view_y.resize(light_count);
+    grid.view_depth.resize(light_count);
+    grid.view_radius.resize(light_count);
+    for (size_t i = 0; i < light_count; i++) {
+        float center[3], radius, view[3];
+        light_bounds(lights[i], center, &radius);
+        transform_point(frustum.view, center, view);
+        grid.view_x[i] = view[0];
+        grid.view_y[i] = view[1];
+        grid.view_depth[i] = -view[2];
+        grid.view_radius[i] = radius;
+    }
+
+    // Slices are independent: each fills its own clusters' ranges and list
+    if (light_count >= CLUSTER_PARALLEL_MIN_LIGHTS) {
+        struct Context {
+            ClusterGrid* grid;
+            const ClusterFrustum* frustum;
+        } context = { &grid, &frustum };
+        run_on_workers(CLUSTER_GRID_Z, [](void* c, int k) {
+            Context* context = (Context*)c;
+            assign_slice(*context->grid, *context->frustum, k);
+        }, &context);
+    } else {
+        for (int k = 0; k < CLUSTER_GRID_Z; k++) {
+            assign_slice(grid, frustum, k);
+        }
+    }
+
+    // Concatenate the slice lists, rebasing their offsets
+    size_t total = 0;
+    for (const ClusterSliceScratch& s : grid.slices) {
+        total += s.indices.size();
+    }
+    grid.indices.resize(total);
+    uint32_t base = 0;
+    for (int k = 0; k < CLUSTER_GRID_Z; k++) {
+        const ClusterSliceScratch& s = grid.slices[k];
+        std::copy(s.indices.begin(), s.indices.end(), grid.indices.begin() + base);
+        uint32_t* range = &grid.ranges[2 * (size_t)k * CLUSTER_GRID_Y * CLUSTER_GRID_X];
+        for (int c = 0; c < CLUSTER_GRID_Y * CLUSTER_GRID_X; c++) {
+            range[2 * c] += base;
+        }
+        base += (uint32_t)s.indices.size();
+        stats.max_cluster_lights = std::max(stats.max_cluster_lights, s.max_cluster_lights);
+        stats.overflowed_clusters += s.overflowed_clusters;
+        stats.dropped_lights += s.dropped_lights;
+    }
+    stats.list_entries = (uint32_t)total;
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
@@ -0,0 +1,92 @@
+// Clustered light assignment (no sokol dependency): the view frustum is cut
+// into a grid of froxels and every frame each froxel gets the compact list of
+// punctual lights whose range reaches it, so the shaders only loop over the
+// lights of the pixel's cluster
+#ifndef CLUSTERED_H
+#define CLUSTERED_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Froxel grid: screen tiles along x and y, exponential depth slices along z
+#define CLUSTER_GRID_X 16
+#define CLUSTER_GRID_Y 9
+#define CLUSTER_GRID_Z 24
+#define CLUSTER_COUNT (CLUSTER_GRID_X * CLUSTER_GRID_Y * CLUSTER_GRID_Z)
+
+// Lights kept per cluster, which bounds the per-pixel cost however many
+// lights the scene has. An overflowing cluster keeps the lights nearest to
+// it relative to their range, the ones its pixels receive the most from.
+#define CLUSTER_MAX_LIGHTS 64
+
+// Lights in the scene, the size of the light storage buffer
+#define CLUSTER_MAX_SCENE_LIGHTS 1024
+
+// Lights from which slices are assigned on several threads (kept from the
+// first such frame to exit)
+#define CLUSTER_PARALLEL_MIN_LIGHTS 64
+
+// Point or spot light, laid out like the shaders' punctual_light (std430).
+// Attenuation follows KHR_lights_punctual: smooth falloff to 0 at range.
+struct PunctualLight {
+    float position[3];
+    float range;
+    float color[3];  // Linear RGB times intensity
+    float spot_scale;  // Cone falloff: clamp(cos * scale + offset, 0, 1)^2; 0 for point lights
+    float direction[3];  // Spot axis, normalized
+    float spot_offset;  // 1 for point lights
+};
+
+void punctual_light_point(PunctualLight& light, const float position[3], float range, const float color[3]);
+void punctual_light_spot(PunctualLight& light, const float position[3], const float direction[3], float range,
+                         const float color[3], float inner_angle, float outer_angle);
+
+struct ClusterFrustum {
+    float view[16];  // World to view, column-major; the camera looks down -z
+    float proj_x, proj_y;  // Projection scale: ndc.xy = view.xy * proj / depth
+    float z_near, z_far;  // Depths split into slices; slice 0 reaches the camera
+};
+
+struct ClusterStats {
+    uint32_t list_entries;  // Light indices over all clusters
+    uint32_t max_cluster_lights;  // Before dropping
+    uint32_t overflowed_clusters;  // Clusters with lights dropped
+    uint32_t dropped_lights;  // List entries those clusters dropped
+    double seconds;
+};
+
+// Working set of one depth slice
+struct ClusterSliceScratch {
+    std::vector<float> x, y, depth_dist2, radius2;  // Lights overlapping the slice
+    std::vector<uint32_t> light;
+    std::vector<float> row_x, row_dist2, row_radius2;  // Of those, the ones overlapping the current tile row
+    std::vector<uint32_t> row_light;
+    std::vector<uint8_t> mask;
+    std::vector<uint64_t> nearest;  // Sort keys of an overflowing cluster's lights
+    std::vector<uint32_t> indices;  // Lists of the slice's clusters
+    uint32_t max_cluster_lights;
+    uint32_t overflowed_clusters;
+    uint32_t dropped_lights;
+};
+
+// Light lists of one frame. Cluster (z * CLUSTER_GRID_Y + y) * CLUSTER_GRID_X + x
+// lists indices[ranges[2 * c]] .. + ranges[2 * c + 1]. The scratch vectors keep
+// their capacity across frames so steady assignment does not allocate.
+struct ClusterGrid {
+    std::vector<uint32_t> ranges;  // Offset and count per cluster
+    std::vector<uint32_t> indices;  // Light indices of all clusters, cluster by cluster
+    float depth_scale, depth_bias;  // slice = log(depth) * scale + bias
+
+    std::vector<float> view_x, view_y, view_depth, view_radius;  // Light bounding spheres in view space
+    std::vector<ClusterSliceScratch> slices;
+};
+
+// Depth slice boundaries tight around the lights in view: near is fixed by
+// the frustum, far is the deepest light sphere, capped at frustum.z_far
+void cluster_fit_depth(ClusterFrustum& frustum, const PunctualLight* lights, size_t light_count);
+
+ClusterStats cluster_assign_lights(ClusterGrid& grid, const ClusterFrustum& frustum, const PunctualLight* lights,
+                                   size_t light_count);
+
+#endif // CLUSTERED_H
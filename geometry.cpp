@@ -0,0 +1,415 @@
+// CPU mesh processing shared by the viewer importer and the offline tools
+
+#include "geometry.h"
+#include "trace.h"
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "parallel-util.hpp"
+
+namespace {
+
+struct Vec3 {
+    float x, y, z;
+};
+
+Vec3 load3(const float* p, size_t i) {
+    return { p[i * 3 + 0], p[i * 3 + 1], p[i * 3 + 2] };
+}
+
+Vec3 sub(Vec3 a, Vec3 b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+Vec3 add(Vec3 a, Vec3 b) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+Vec3 scale(Vec3 a, float s) { return { a.x * s, a.y * s, a.z * s }; }
+float dot(Vec3 a, Vec3 b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+Vec3 cross(Vec3 a, Vec3 b) { return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+
+// Unit vector, or zero for degenerate input
+Vec3 normalize(Vec3 a) {
+    float len = sqrtf(dot(a, a));
+    return len > 1e-20f ? scale(a, 1.0f / len) : Vec3{ 0.0f, 0.0f, 0.0f };
+}
+
+float angle_between(Vec3 a, Vec3 b) {
+    float d = dot(normalize(a), normalize(b));
+    return acosf(d < -1.0f ? -1.0f : (d > 1.0f ? 1.0f : d));
+}
+
+// Run fn(i) for i in [0, n), across threads when the mesh is large
+template <typename Callable>
+void for_each_index(size_t n, size_t triangle_count, Callable fn) {
+    if (triangle_count >= GEOMETRY_PARALLEL_MIN_TRIANGLES && n > 0) {
+        parallelutil::parallel_for((int)n, [&](int i) { fn((size_t)i); });
+    } else {
+        for (size_t i = 0; i < n; i++) {
+            fn(i);
+        }
+    }
+}
+
+// Triangle corners grouped by vertex (CSR), so per-vertex sums are gathers
+// that run in parallel without write conflicts
+struct CornerTable {
+    std::vector<uint32_t> offsets;  // vertex_count + 1
+    std::vector<uint32_t> corners;
+};
+
+CornerTable build_corner_table(const uint32_t* indices, size_t corner_count, size_t vertex_count) {
+    CornerTable table;
+    table.offsets.assign(vertex_count + 1, 0);
+    for (size_t c = 0; c < corner_count; c++) {
+        size_t v = indices ? indices[c] : c;
+        if (v < vertex_count) {
+            table.offsets[v + 1]++;
+        }
+    }
+    for (size_t v = 0; v < vertex_count; v++) {
+        table.offsets[v + 1] += table.offsets[v];
+    }
+    table.corners.resize(table.offsets[vertex_count]);
+    std::vector<uint32_t> fill(table.offsets.begin(), table.offsets.end() - 1);
+    for (size_t c = 0; c < corner_count; c++) {
+        size_t v = indices ? indices[c] : c;
+        if (v < vertex_count) {
+            table.corners[fill[v]++] = (uint32_t)c;
+        }
+    }
+    return table;
+}
+
+// A triangle with an out-of-range index contributes nothing
+bool triangle_vertices(const uint32_t* indices, size_t t, size_t vertex_count, size_t v[3]) {
+    for (int k = 0; k < 3; k++) {
+        v[k] = indices ? indices[t * 3 + k] : t * 3 + k;
+        if (v[k] >= vertex_count) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Any unit vector perpendicular to n
+Vec3 perpendicular(Vec3 n) {
+    Vec3 axis = fabsf(n.x) < 0.9f ? Vec3{ 1.0f, 0.0f, 0.0f } : Vec3{ 0.0f, 1.0f, 0.0f };
+    return normalize(cross(cross(n, axis), n));
+}
+
+} // namespace
+
+void generate_normals(const float* positions, size_t vertex_count,
+                      const uint32_t* indices, size_t index_count, float* normals) {
+    TRACE_ZONE("generate_normals");
+    size_t triangle_count = index_count / 3;
+    std::vector<Vec3> corner_normals(triangle_count * 3, Vec3{ 0.0f, 0.0f, 0.0f });
+    for_each_index(triangle_count, triangle_count, [&](size_t t) {
+        size_t v[3];
+        if (!triangle_vertices(indices, t, vertex_count, v)) {
+            return;
+        }
+        Vec3 p[3] = { load3(positions, v[0]), load3(positions, v[1]), load3(positions, v[2]) };
+        Vec3 face = normalize(cross(sub(p[1], p[0]), sub(p[2], p[0])));
+        for (int k = 0; k < 3; k++) {
+            float angle = angle_between(sub(p[(k + 1) % 3], p[k]), sub(p[(k + 2) % 3], p[k]));
+            corner_normals[t * 3 + k] = scale(face, angle);
+        }
+    });
+
+    CornerTable table = build_corner_table(indices, triangle_count * 3, vertex_count);
+    for_each_index(vertex_count, triangle_count, [&](size_t v) {
+        Vec3 sum = { 0.0f, 0.0f, 0.0f };
+        for (uint32_t i = table.offsets[v]; i < table.offsets[v + 1]; i++) {
+            sum = add(sum, corner_normals[table.corners[i]]);
+        }
+        Vec3 n = normalize(sum);
+        if (dot(n, n) == 0.0f) {
+            n = { 0.0f, 1.0f, 0.0f };
+        }
+        normals[v * 3 + 0] = n.x;
+        normals[v * 3 + 1] = n.y;
+        normals[v * 3 + 2] = n.z;
+    });
+}
+
+void generate_tangents(const float* positions, const float* normals, const float* uvs, size_t vertex_count,
+                       const uint32_t* indices, size_t index_count, float* tangents) {
+    TRACE_ZONE("generate_tangents");
+    size_t triangle_count = index_count / 3;
+    std::vector<Vec3> corner_tangents(triangle_count * 3, Vec3{ 0.0f, 0.0f, 0.0f });
+    std::vector<Vec3> corner_bitangents(triangle_count * 3, Vec3{ 0.0f, 0.0f, 0.0f });
+    for_each_index(triangle_count, triangle_count, [&](size_t t) {
+        size_t v[3];
+        if (!triangle_vertices(indices, t, vertex_count, v)) {
+            return;
+        }
+        Vec3 p[3] = { load3(positions, v[0]), load3(positions, v[1]), load3(positions, v[2]) };
+        Vec3 e1 = sub(p[1], p[0]);
+        Vec3 e2 = sub(p[2], p[0]);
+        float du1 = uvs[v[1] * 2 + 0] - uvs[v[0] * 2 + 0];
+        float dv1 = uvs[v[1] * 2 + 1] - uvs[v[0] * 2 + 1];
+        float du2 = uvs[v[2] * 2 + 0] - uvs[v[0] * 2 + 0];
+        float dv2 = uvs[v[2] * 2 + 1] - uvs[v[0] * 2 + 1];
+        float r = du1 * dv2 - du2 * dv1;
+        if (fabsf(r) < 1e-20f) {
+            return;  // No UV parameterization on this face
+        }
+        // Only directions matter; the sign of r carries the UV winding
+        Vec3 face_t = normalize(scale(sub(scale(e1, dv2), scale(e2, dv1)), 1.0f / r));
+        Vec3 face_b = normalize(scale(sub(scale(e2, du1), scale(e1, du2)), 1.0f / r));
+        for (int k = 0; k < 3; k++) {
+            Vec3 n = load3(normals, v[k]);
+            float angle = angle_between(sub(p[(k + 1) % 3], p[k]), sub(p[(k + 2) % 3], p[k]));
+            Vec3 t_proj = normalize(sub(face_t, scale(n, dot(n, face_t))));
+            Vec3 b_proj = normalize(sub(face_b, scale(n, dot(n, face_b))));
+            corner_tangents[t * 3 + k] = scale(t_proj, angle);
+            corner_bitangents[t * 3 + k] = scale(b_proj, angle);
+        }
+    });
+
+    CornerTable table = build_corner_table(indices, triangle_count * 3, vertex_count);
+    for_each_index(vertex_count, triangle_count, [&](size_t v) {
+        Vec3 sum_t = { 0.0f, 0.0f, 0.0f };
+        Vec3 sum_b = { 0.0f, 0.0f, 0.0f };
+        for (uint32_t i = table.offsets[v]; i < table.offsets[v + 1]; i++) {
+            sum_t = add(sum_t, corner_tangents[table.corners[i]]);
+            sum_b = add(sum_b, corner_bitangents[table.corners[i]]);
+        }
+        Vec3 n = load3(normals, v);
+        Vec3 t = normalize(sub(sum_t, scale(n, dot(n, sum_t))));
+        if (dot(t, t) == 0.0f) {
+            t = perpendicular(n);
+        }
+        if (dot(t, t) == 0.0f) {
+            t = { 1.0f, 0.0f, 0.0f };
+        }
+        float w = dot(cross(n, t), sum_b) < 0.0f ? -1.0f : 1.0f;
+        tangents[v * 4 + 0] = t.x;
+        tangents[v * 4 + 1] = t.y;
+        tangents[v * 4 + 2] = t.z;
+        tangents[v * 4 + 3] = w;
+    });
+}
+
+// ============================================================================
+// Vertex welding
+// ============================================================================
+
+size_t weld_vertices(void* vertices, size_t vertex_count, size_t stride, uint32_t* remap) {
+    uint8_t* bytes = (uint8_t*)vertices;
+    size_t triangle_count = vertex_count / 3;
+    std::vector<uint64_t> hashes(vertex_count);
+    for_each_index(vertex_count, triangle_count, [&](size_t v) {
+        const uint8_t* vertex = bytes + v * stride;
+        uint64_t hash = 14695981039346656037ull;
+        for (size_t i = 0; i < stride; i++) {
+            hash = (hash ^ vertex[i]) * 1099511628211ull;
+        }
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 33;
+        hashes[v] = hash;
+    });
+
+    // Shard by the top hash bits so shards deduplicate independently. Each
+    // shard lists its vertices in order, so the first occurrence wins.
+    const int shard_bits = triangle_count >= GEOMETRY_PARALLEL_MIN_TRIANGLES ? 6 : 0;
+    const size_t shard_count = (size_t)1 << shard_bits;
+    auto shard_of = [&](size_t v) { return shard_bits ? (size_t)(hashes[v] >> (64 - shard_bits)) : 0; };
+    std::vector<uint32_t> shard_offsets(shard_count + 1, 0);
+    for (size_t v = 0; v < vertex_count; v++) {
+        shard_offsets[shard_of(v) + 1]++;
+    }
+    for (size_t s = 0; s < shard_count; s++) {
+        shard_offsets[s + 1] += shard_offsets[s];
+    }
+    std::vector<uint32_t> shard_vertices(vertex_count);
+    std::vector<uint32_t> fill(shard_offsets.begin(), shard_offsets.end() - 1);
+    for (size_t v = 0; v < vertex_count; v++) {
+        shard_vertices[fill[shard_of(v)]++] = (uint32_t)v;
+    }
+
+    std::vector<uint32_t> first(vertex_count);
+    for_each_index(shard_count, triangle_count, [&](size_t s) {
+        size_t count = shard_offsets[s + 1] - shard_offsets[s];
+        size_t table_size = 1;
+        while (table_size < count * 2) {
+            table_size *= 2;
+        }
+        const uint32_t empty = UINT32_MAX;
+        std::vector<uint32_t> table(table_size, empty);
+        for (size_t i = shard_offsets[s]; i < shard_offsets[s + 1]; i++) {
+            uint32_t v = shard_vertices[i];
+            for (size_t slot = hashes[v] & (table_size - 1);; slot = (slot + 1) & (table_size - 1)) {
+                uint32_t other = table[slot];
+                if (other == empty) {
+                    table[slot] = v;
+                    first[v] = v;
+                    break;
+                }
+                if (hashes[other] == hashes[v] && memcmp(bytes + (size_t)other * stride, bytes + (size_t)v * stride, stride) == 0) {
+                    first[v] = other;
+                    break;
+                }
+            }
+        }
+    });
+
+    size_t unique = 0;
+    for (size_t v = 0; v < vertex_count; v++) {
+        if (first[v] == v) {
+            if (unique != v) {
+                memmove(bytes + unique * stride, bytes + v * stride, stride);
+            }
+            remap[v] = (uint32_t)unique++;
+        } else {
+            remap[v] = remap[first[v]];
+        }
+    }
+    return unique;
+}
+
+// ============================================================================
+// Vertex cache optimization
+// ============================================================================
+
+static const int kCacheSize = 32;  // Simulated LRU cache for scoring
+
+// Tom Forsyth, "Linear-Speed Vertex Cache Optimisation"
+static float vertex_score(int cache_position, uint32_t remaining_valence) {
+    if (remaining_valence == 0) {
+        return -1.0f;
+    }
+    float score = 0.0f;
+    if (cache_position >= 0) {
+        if (cache_position < 3) {
+            score = 0.75f;  // Last triangle's vertices, deliberately below the best cached ones
+        } else {
+            score = powf(1.0f - (cache_position - 3) * (1.0f / (kCacheSize - 3)), 1.5f);
+        }
+    }
+    return score + 2.0f * powf((float)remaining_valence, -0.5f);
+}
+
+void optimize_vertex_cache(std::vector<uint32_t>& indices, size_t vertex_count) {
+    TRACE_ZONE("optimize_vertex_cache");
+    const size_t tri_count = indices.size() / 3;
+    if (tri_count == 0) {
+        return;
+    }
+
+    // Triangle adjacency per vertex; valence counts the triangles not yet emitted
+    std::vector<uint32_t> valence(vertex_count, 0);
+    for (uint32_t index : indices) {
+        valence[index]++;
+    }
+    std::vector<uint32_t> offsets(vertex_count + 1, 0);
+    for (size_t v = 0; v < vertex_count; v++) {
+        offsets[v + 1] = offsets[v] + valence[v];
+    }
+    std::vector<uint32_t> adjacency(indices.size());
+    std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+    for (size_t t = 0; t < tri_count; t++) {
+        for (int k = 0; k < 3; k++) {
+            uint32_t v = indices[t * 3 + k];
+            adjacency[fill[v]++] = (uint32_t)t;
+        }
+    }
+
+    std::vector<int> cache_position(vertex_count, -1);
+    std::vector<float> vscore(vertex_count);
+    for (size_t v = 0; v < vertex_count; v++) {
+        vscore[v] = vertex_score(-1, valence[v]);
+    }
+    std::vector<float> tscore(tri_count);
+    std::vector<uint8_t> emitted(tri_count, 0);
+    for (size_t t = 0; t < tri_count; t++) {
+        tscore[t] = vscore[indices[t * 3]] + vscore[indices[t * 3 + 1]] + vscore[indices[t * 3 + 2]];
+    }
+
+    std::vector<uint32_t> out;
+    out.reserve(indices.size());
+    std::vector<uint32_t> cache, next_cache;
+    size_t scan = 0;
+    int64_t best = -1;
+    while (out.size() < indices.size()) {
+        if (best < 0) {
+            // Nothing adjacent to the cache left: continue in input order
+            while (emitted[scan]) {
+                scan++;
+            }
+            best = (int64_t)scan;
+        }
+
+        const uint32_t* tri = &indices[best * 3];
+        emitted[best] = 1;
+        out.insert(out.end(), tri, tri + 3);
+
+        // Remove the triangle from its vertices' live adjacency
+        for (int k = 0; k < 3; k++) {
+            uint32_t v = tri[k];
+            uint32_t* list = &adjacency[offsets[v]];
+            for (uint32_t i = 0; i < valence[v]; i++) {
+                if (list[i] == (uint32_t)best) {
+                    list[i] = list[valence[v] - 1];
+                    break;
+                }
+            }
+            valence[v]--;
+        }
+
+        // LRU cache: the triangle's vertices move to the front
+        next_cache.assign(tri, tri + 3);
+        for (uint32_t v : cache) {
+            if (v != tri[0] && v != tri[1] && v != tri[2]) {
+                next_cache.push_back(v);
+            }
+        }
+        for (size_t i = kCacheSize; i < next_cache.size(); i++) {
+            cache_position[next_cache[i]] = -1;
+        }
+
+        // Rescore touched vertices and propagate into their live triangles
+        best = -1;
+        float best_score = -1.0f;
+        for (size_t i = 0; i < next_cache.size(); i++) {
+            uint32_t v = next_cache[i];
+            int position = i < (size_t)kCacheSize ? (int)i : -1;
+            cache_position[v] = position;
+            float score = vertex_score(position, valence[v]);
+            float delta = score - vscore[v];
+            vscore[v] = score;
+            for (uint32_t j = 0; j < valence[v]; j++) {
+                uint32_t t = adjacency[offsets[v] + j];
+                tscore[t] += delta;
+            }
+        }
+        for (size_t i = 0; i < next_cache.size() && i < (size_t)kCacheSize; i++) {
+            uint32_t v = next_cache[i];
+            for (uint32_t j = 0; j < valence[v]; j++) {
+                uint32_t t = adjacency[offsets[v] + j];
+                if (tscore[t] > best_score) {
+                    best_score = tscore[t];
+                    best = t;
+                }
+            }
+        }
+        if (next_cache.size() > (size_t)kCacheSize) {
+            next_cache.resize(kCacheSize);
+        }
+        cache.swap(next_cache);
+    }
+    indices.swap(out);
+}
+
+float average_cache_miss_ratio(const std::vector<uint32_t>& indices, size_t vertex_count) {
+    const int fifo_size = 16;
+    std::vector<uint32_t> timestamp(vertex_count, 0);
+    uint32_t time = fifo_size + 1;
+    size_t misses = 0;
+    for (uint32_t index : indices) {
+        if (time - timestamp[index] > (uint32_t)fifo_size) {
+            timestamp[index] = time++;
+            misses++;
+        }
+    }
+    return indices.empty() ? 0.0f : (float)misses / (float)(indices.size() / 3);
+}
@@ -5,6 +5,7 @@
 #include "sokol_gfx.h"
 #include "sokol_log.h"
 #include "util/sokol_gl.h"
+#include "gui_retain.h"
 
 // Font rendering
 #include "fontstash.h"
@@ -23,6 +24,16 @@
 // Font ID
 #define FONT_ID_BODY 0
 
+// First text row id of each panel section; Clay ids must be unique
+#define TEXT_ROW_MODEL 0
+#define TEXT_ROW_TEXTURES 10
+#define TEXT_ROW_PICK 30
+#define TEXT_ROW_ALLOCS 60
+#define TEXT_ROW_LIGHTS 70
+_Static_assert(TEXT_ROW_TEXTURES + 1 + GUI_MAX_TEXTURE_ROWS <= TEXT_ROW_PICK, "texture rows overlap pick rows");
+_Static_assert(TEXT_ROW_PICK + GUI_MAX_PICK_ROWS <= TEXT_ROW_ALLOCS, "pick rows overlap allocation rows");
+_Static_assert(TEXT_ROW_ALLOCS + GUI_MAX_ALLOC_ROWS <= TEXT_ROW_LIGHTS, "allocation rows overlap light rows");
+
 // Fonts array
 static sclay_font_t fonts[1];
 
@@ -41,6 +52,20 @@ static Clay_Color COLOR_TOGGLE_OFF = { 60, 60, 70, 255 };
 // Current GUI state pointer for slider interactions
 static GuiState* g_current_state = NULL;
 
+// Retained rendering: the panel's geometry is recorded into its own sokol-gl
+// context and replayed every frame. Layout and recording only run again when
+// input reaches the panel or the displayed state changes.
+static sgl_context g_gui_context;
+static int g_gui_dirty = 1;
+static uint64_t g_state_hash = 0;
+static Clay_BoundingBox g_panel_box;  // Of the last layout, in layout units
+static int g_pointer_over_panel = 0;
+
+// Slider dragged since a press on its track; it follows the pointer until
+// release, wherever the pointer goes
+static int g_active_slider = -1;
+static int g_press_started = 0;  // A press the next layout has not seen
+
 // Helper: Create Clay_String from C string
 static Clay_String make_string(const char* str) {
     Clay_String result;
@@ -84,16 +109,19 @@ static void gui_render_slider(int id, const char* label, float* value, float min
     
     // Check hover and handle interaction after layout
     bool isHovered = Clay_PointerOver(trackId);
+    if (g_press_started && isHovered) {
+        g_active_slider = id;
+    }
     
-    // If mouse is pressed and hovering this slider, update value
-    if (g_current_state && g_current_state->mouse_pressed && isHovered) {
+    // While this slider is dragged, update value
+    if (g_current_state && g_current_state->mouse_pressed && g_active_slider == id) {
         Clay_ElementData elemData = Clay_GetElementData(trackId);
         if (elemData.found) {
             update_slider_from_mouse(value, min_val, max_val, elemData.boundingBox, g_current_state->mouse_x);
         }
     }
     
-    Clay_Color trackColor = isHovered ? COLOR_BG_SLIDER_HOVER : COLOR_BG_SLIDER_TRACK;
+    Clay_Color trackColor = isHovered || g_active_slider == id ? COLOR_BG_SLIDER_HOVER : COLOR_BG_SLIDER_TRACK;
     
     CLAY(CLAY_IDI("SliderRow", id), {
         .layout = { 
@@ -290,9 +318,82 @@ static Clay_RenderCommandArray create_gui_layout(GuiState* state) {
                     
                     char mesh_info[64];
                     snprintf(mesh_info, sizeof(mesh_info), "%d", state->mesh_count);
-                    gui_render_text_row(0, "Meshes:", mesh_info);
-                    gui_render_text_row(1, "Format:", state->is_vrm_model ? "VRM" : "GLTF/GLB");
+                    gui_render_text_row(TEXT_ROW_MODEL, "Meshes:", mesh_info);
+                    gui_render_text_row(TEXT_ROW_MODEL + 1, "Format:", state->is_vrm_model ? "VRM" : "GLTF/GLB");
                     gui_render_toggle(50, "Toon Shader", &state->use_toon_shader);
+                    if (state->has_first_person) {
+                        static char head_info[64];
+                        snprintf(head_info, sizeof(head_info), "%d tris", state->head_triangle_count);
+                        gui_render_toggle(51, "First Person", &state->first_person);
+                        gui_render_text_row(TEXT_ROW_MODEL + 2, "Head hidden:", head_info);
+                    }
+                }
+            }
+            
+            // Texture stats
+            if (state->model_loaded && state->texture_count > 0) {
+                CLAY(CLAY_ID("TextureStats"), {
+                    .layout = { 
+                        .sizing = { .width = CLAY_SIZING_GROW(0), .height = CLAY_SIZING_FIT(0) },
+                        .padding = CLAY_PADDING_ALL(6),
+                        .childGap = 2,
+                        .layoutDirection = CLAY_TOP_TO_BOTTOM
+                    },
+                    .backgroundColor = COLOR_BG_HEADER,
+                    .cornerRadius = CLAY_CORNER_RADIUS(6)
+                }) {
+                    Clay_TextElementConfig* cfg = CLAY_TEXT_CONFIG({ .fontId = FONT_ID_BODY, .fontSize = 13, .textColor = COLOR_ACCENT });
+                    CLAY_TEXT(CLAY_STRING("Textures"), cfg);
+                    
+                    static char memory_info[64];
+                    snprintf(memory_info, sizeof(memory_info), "%d, %.0f / %.0f MB", state->texture_count,
+                             state->texture_memory_mb, state->texture_budget_mb);
+                    gui_render_text_row(TEXT_ROW_TEXTURES, "Resident:", memory_info);
+                    for (int i = 0; i < state->texture_row_count; i++) {
+                        gui_render_text_row(TEXT_ROW_TEXTURES + 1 + i, state->texture_row_labels[i], state->texture_row_values[i]);
+                    }
+                }
+            }
+            
+            // Picked draw
+            if (state->model_loaded && state->pick_row_count > 0) {
+                CLAY(CLAY_ID("PickInfo"), {
+                    .layout = { 
+                        .sizing = { .width = CLAY_SIZING_GROW(0), .height = CLAY_SIZING_FIT(0) },
+                        .padding = CLAY_PADDING_ALL(6),
+                        .childGap = 2,
+                        .layoutDirection = CLAY_TOP_TO_BOTTOM
+                    },
+                    .backgroundColor = COLOR_BG_HEADER,
+                    .cornerRadius = CLAY_CORNER_RADIUS(6)
+                }) {
+                    Clay_TextElementConfig* cfg = CLAY_TEXT_CONFIG({ .fontId = FONT_ID_BODY, .fontSize = 13, .textColor = COLOR_ACCENT });
+                    CLAY_TEXT(CLAY_STRING("Picked"), cfg);
+                    
+                    for (int i = 0; i < state->pick_row_count; i++) {
+                        gui_render_text_row(TEXT_ROW_PICK + i, state->pick_row_labels[i], state->pick_row_values[i]);
+                    }
+                }
+            }
+            
+            // Heap allocations
+            if (state->alloc_row_count > 0) {
+                CLAY(CLAY_ID("AllocStats"), {
+                    .layout = { 
+                        .sizing = { .width = CLAY_SIZING_GROW(0), .height = CLAY_SIZING_FIT(0) },
+                        .padding = CLAY_PADDING_ALL(6),
+                        .childGap = 2,
+                        .layoutDirection = CLAY_TOP_TO_BOTTOM
+                    },
+                    .backgroundColor = COLOR_BG_HEADER,
+                    .cornerRadius = CLAY_CORNER_RADIUS(6)
+                }) {
+                    Clay_TextElementConfig* cfg = CLAY_TEXT_CONFIG({ .fontId = FONT_ID_BODY, .fontSize = 13, .textColor = COLOR_ACCENT });
+                    CLAY_TEXT(CLAY_STRING("Memory"), cfg);
+                    
+                    for (int i = 0; i < state->alloc_row_count; i++) {
+                        gui_render_text_row(TEXT_ROW_ALLOCS + i, state->alloc_row_labels[i], state->alloc_row_values[i]);
+                    }
                 }
             }
             
@@ -315,6 +416,36 @@ static Clay_RenderCommandArray create_gui_layout(GuiState* state) {
                 gui_render_slider(102, "LOD", &state->skybox_lod, 0.0f, 5.0f, "%.0f");  // 0=env, 1-5=prefilter mips
             }
             
+            // Staging lights
+            CLAY(CLAY_ID("LightSettings"), {
+                .layout = { 
+                    .sizing = { .width = CLAY_SIZING_GROW(0), .height = CLAY_SIZING_FIT(0) },
+                    .padding = CLAY_PADDING_ALL(6),
+                    .childGap = 2,
+                    .layoutDirection = CLAY_TOP_TO_BOTTOM
+                },
+                .backgroundColor = COLOR_BG_HEADER,
+                .cornerRadius = CLAY_CORNER_RADIUS(6)
+            }) {
+                Clay_TextElementConfig* cfg = CLAY_TEXT_CONFIG({ .fontId = FONT_ID_BODY, .fontSize = 13, .textColor = COLOR_ACCENT });
+                CLAY_TEXT(CLAY_STRING("Lights"), cfg);
+                
+                gui_render_slider(300, "Count", &state->light_count, 0.0f, 256.0f, "%.0f");
+                gui_render_slider(301, "Intensity", &state->light_intensity, 0.0f, 10.0f, "%.2f");
+                gui_render_slider(302, "Range", &state->light_range, 0.05f, 2.0f, "%.2f");
+                gui_render_toggle(303, "Animate", &state->animate_lights);
+                if (state->light_count >= 0.5f) {
+                    static char cluster_info[64];
+                    static char assign_info[64];
+                    snprintf(cluster_info, sizeof(cluster_info), "max %d, %d over cap, %d dropped",
+                             state->light_cluster_max, state->light_overflowed_clusters, state->light_dropped);
+                    snprintf(assign_info, sizeof(assign_info), "%.2f ms, %d entries", state->light_assign_ms,
+                             state->light_list_entries);
+                    gui_render_text_row(TEXT_ROW_LIGHTS, "Per cluster:", cluster_info);
+                    gui_render_text_row(TEXT_ROW_LIGHTS + 1, "Assign:", assign_info);
+                }
+            }
+            
             // Toon settings (show when toon shader is enabled)
             if (state->use_toon_shader) {
                 CLAY(CLAY_ID("ToonSettings"), {
@@ -355,7 +486,8 @@ static Clay_RenderCommandArray create_gui_layout(GuiState* state) {
                 
                 CLAY_TEXT(CLAY_STRING("Controls"), cfgTitle);
                 CLAY_TEXT(CLAY_STRING("Drag: Rotate | Scroll: Zoom | R: Reset"), cfgHelp);
-                CLAY_TEXT(CLAY_STRING("G: GUI | S: Skybox | T: Toon/PBR"), cfgHelp);
+                CLAY_TEXT(CLAY_STRING("Click: Inspect draw under cursor"), cfgHelp);
+                CLAY_TEXT(CLAY_STRING("G: GUI | S: Skybox | T: Toon/PBR | F: 1st person"), cfgHelp);
             }
             
             // Spacer
@@ -377,11 +509,60 @@ static Clay_RenderCommandArray create_gui_layout(GuiState* state) {
     return Clay_EndLayout();
 }
 
+// FNV-1a over what the panel displays: the state with its string pointers
+// and mouse fields zeroed, plus the text the pointers point to
+static uint64_t hash_bytes(uint64_t hash, const void* data, size_t size) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+static uint64_t hash_string(uint64_t hash, const char* str) {
+    return str ? hash_bytes(hash, str, strlen(str) + 1) : hash;
+}
+
+static uint64_t gui_state_hash(const GuiState* state) {
+    // memcpy keeps the padding as the caller left it, so equal states hash equally
+    GuiState displayed;
+    memcpy(&displayed, state, sizeof(displayed));
+    memset(displayed.texture_row_labels, 0, sizeof(displayed.texture_row_labels));
+    memset(displayed.texture_row_values, 0, sizeof(displayed.texture_row_values));
+    memset(displayed.pick_row_labels, 0, sizeof(displayed.pick_row_labels));
+    memset(displayed.pick_row_values, 0, sizeof(displayed.pick_row_values));
+    memset(displayed.alloc_row_labels, 0, sizeof(displayed.alloc_row_labels));
+    memset(displayed.alloc_row_values, 0, sizeof(displayed.alloc_row_values));
+    displayed.gui_hovered = 0;
+    displayed.mouse_pressed = 0;
+    displayed.mouse_x = 0.0f;
+    displayed.mouse_y = 0.0f;
+    uint64_t hash = hash_bytes(14695981039346656037ull, &displayed, sizeof(displayed));
+    for (int i = 0; i < state->texture_row_count; i++) {
+        hash = hash_string(hash, state->texture_row_labels[i]);
+        hash = hash_string(hash, state->texture_row_values[i]);
+    }
+    for (int i = 0; i < state->pick_row_count; i++) {
+        hash = hash_string(hash, state->pick_row_labels[i]);
+        hash = hash_string(hash, state->pick_row_values[i]);
+    }
+    for (int i = 0; i < state->alloc_row_count; i++) {
+        hash = hash_string(hash, state->alloc_row_labels[i]);
+        hash = hash_string(hash, state->alloc_row_values[i]);
+    }
+    return hash;
+}
+
 void gui_init(void) {
     sgl_desc_t sgl_desc = {0};
     sgl_desc.logger.func = slog_func;
     sgl_setup(&sgl_desc);
     
+    // Same formats as the default context, so sokol_clay's and fontstash's
+    // pipelines draw into it
+    g_gui_context = sgl_make_context(&(sgl_context_desc_t){ 0 });
+    gui_retain_commands(g_gui_context);
+    
     sclay_setup();
     uint64_t clay_memory_size = Clay_MinMemorySize();
     Clay_Arena clay_arena = Clay_CreateArenaWithCapacityAndMemory(clay_memory_size, malloc(clay_memory_size));
@@ -393,32 +574,90 @@ void gui_init(void) {
 
 void gui_shutdown(void) {
     sclay_shutdown();
+    sgl_destroy_context(g_gui_context);
     sgl_shutdown();
 }
 
 int gui_handle_event(const sapp_event* ev) {
     sclay_handle_event(ev);
+    
+    // Pointer movement away from the panel (camera drags) leaves it as is
+    switch (ev->type) {
+        case SAPP_EVENTTYPE_MOUSE_MOVE:
+        case SAPP_EVENTTYPE_MOUSE_SCROLL: {
+            float dpi_scale = sapp_dpi_scale();
+            int over = point_in_box(ev->mouse_x / dpi_scale, ev->mouse_y / dpi_scale, g_panel_box);
+            if (over || g_pointer_over_panel || g_active_slider >= 0) {
+                g_gui_dirty = 1;
+            }
+            g_pointer_over_panel = over;
+            break;
+        }
+        case SAPP_EVENTTYPE_MOUSE_DOWN:
+            g_press_started = 1;
+            g_gui_dirty = 1;
+            break;
+        case SAPP_EVENTTYPE_MOUSE_UP:
+            g_active_slider = -1;
+            g_gui_dirty = 1;
+            break;
+        case SAPP_EVENTTYPE_MOUSE_LEAVE:
+        case SAPP_EVENTTYPE_RESIZED:
+        case SAPP_EVENTTYPE_RESTORED:
+            g_gui_dirty = 1;
+            break;
+        default:
+            break;
+    }
     return 0;
 }
 
 void gui_new_frame(void) {
-    sclay_new_frame();
+    // Pointer and window size only matter to the next layout
+    if (g_gui_dirty) {
+        sclay_new_frame();
+    }
 }
 
 int gui_render(GuiState* state) {
-    if (!state->show_gui) return 0;
-    
-    Clay_RenderCommandArray render_commands = create_gui_layout(state);
+    if (!state->show_gui) {
+        g_gui_dirty = 1;  // Record afresh when shown again
+        g_press_started = 0;
+        g_active_slider = -1;
+        return 0;
+    }
     
-    sgl_matrix_mode_modelview();
-    sgl_load_identity();
+    uint64_t hash = gui_state_hash(state);
+    if (hash != g_state_hash) {
+        g_state_hash = hash;
+        g_gui_dirty = 1;
+    }
     
-    sclay_render(render_commands, fonts);
-    sgl_draw();
+    if (g_gui_dirty) {
+        g_gui_dirty = 0;
+        Clay_RenderCommandArray render_commands = create_gui_layout(state);
+        g_press_started = 0;
+        Clay_ElementData panel = Clay_GetElementData(Clay__HashString(CLAY_STRING("LeftPanel"), 0));
+        if (panel.found) {
+            g_panel_box = panel.boundingBox;
+        }
+        
+        sgl_set_context(g_gui_context);
+        gui_rewind_commands(g_gui_context);
+        sgl_defaults();
+        sgl_matrix_mode_modelview();
+        sgl_load_identity();
+        sclay_render(render_commands, fonts);
+        sgl_set_context(sgl_default_context());
+        
+        // Values this layout edits change the hash, so the next frame lays
+        // out again and shows them
+    }
+    sgl_context_draw(g_gui_context);
     
     return 0;
 }
 
 int gui_is_hovered(void) {
-    return Clay_PointerOver(Clay__HashString(CLAY_STRING("LeftPanel"), 0));
+    return g_active_slider >= 0 || Clay_PointerOver(Clay__HashString(CLAY_STRING("LeftPanel"), 0));
 }
@@ -9,6 +9,10 @@
 extern "C" {
 #endif
 
+#define GUI_MAX_TEXTURE_ROWS 6
+#define GUI_MAX_PICK_ROWS 14
+#define GUI_MAX_ALLOC_ROWS 6
+
 // GUI state that can be modified by GUI interactions
 typedef struct {
     // Model info
@@ -19,6 +23,30 @@ typedef struct {
     // Shader selection (modifiable via GUI)
     int use_toon_shader;  // 0 = PBR, 1 = Toon
     
+    // VRM first-person view (modifiable via GUI)
+    int has_first_person;
+    int first_person;
+    int head_triangle_count;  // Triangles hidden in first-person view
+    
+    // Texture import stats (largest textures first)
+    int texture_count;
+    float texture_memory_mb;
+    float texture_budget_mb;
+    int texture_row_count;
+    const char* texture_row_labels[GUI_MAX_TEXTURE_ROWS];
+    const char* texture_row_values[GUI_MAX_TEXTURE_ROWS];
+    
+    // Draw picked by clicking on the model, no rows when nothing is picked
+    int pick_row_count;
+    const char* pick_row_labels[GUI_MAX_PICK_ROWS];
+    const char* pick_row_values[GUI_MAX_PICK_ROWS];
+    
+    // Heap allocations per subsystem, no rows unless built with allocation
+    // tracking
+    int alloc_row_count;
+    const char* alloc_row_labels[GUI_MAX_ALLOC_ROWS];
+    const char* alloc_row_values[GUI_MAX_ALLOC_ROWS];
+    
     // Skybox settings (modifiable via GUI)
     int show_skybox;
     float skybox_exposure;
@@ -32,6 +60,18 @@ typedef struct {
     float toon_rim_softness;
     float toon_spec_intensity;
     
+    // Staging point/spot lights (modifiable via GUI) and their clustered
+    // assignment in the last frame
+    float light_count;
+    float light_intensity;
+    float light_range;  // Fraction of the model radius
+    int animate_lights;
+    int light_list_entries;
+    int light_cluster_max;
+    int light_overflowed_clusters;
+    int light_dropped;  // List entries cut by the per-cluster cap
+    float light_assign_ms;
+    
     // GUI state
     int show_gui;
     int gui_hovered;
@@ -58,7 +98,7 @@ void gui_new_frame(void);
 // Returns 1 if any value was modified, 0 otherwise
 int gui_render(GuiState* state);
 
-// Check if mouse is over GUI panel
+// Check if mouse is over GUI panel, or dragging one of its sliders
 int gui_is_hovered(void);
 
 #ifdef __cplusplus
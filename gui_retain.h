@@ -0,0 +1,52 @@
+// Retained sokol_gl contexts for the GUI: lets a context keep its recorded
+// commands across sg_commit() so they can be drawn again on later frames
+// without being recorded again. sokol_gl.h has no such mode; this is viewer
+// code kept outside 3rd_party/, which stays an unmodified upstream copy.
+//
+// The implementation uses sokol_gl.h internals: _sgl_lookup_context(),
+// _sgl_make_commit_listener(), _sgl_rewind() and the commit listener that
+// sgl_make_context() registers for every context to rewind it. Recheck them
+// whenever sokol_gl.h is updated.
+//
+// Include after sokol_gl.h. impl.c defines GUI_RETAIN_IMPL and includes it
+// after the sokol_gl implementation.
+#ifndef GUI_RETAIN_H
+#define GUI_RETAIN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Stop sg_commit() from rewinding ctx; its commands stay until
+// gui_rewind_commands()
+void gui_retain_commands(sgl_context ctx);
+
+// Drop the commands and vertices recorded into ctx
+void gui_rewind_commands(sgl_context ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_RETAIN_H
+
+#ifdef GUI_RETAIN_IMPL
+#ifndef GUI_RETAIN_IMPL_INCLUDED
+#define GUI_RETAIN_IMPL_INCLUDED
+
+void gui_retain_commands(sgl_context ctx_id) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        sg_remove_commit_listener(_sgl_make_commit_listener(ctx));
+    }
+}
+
+void gui_rewind_commands(sgl_context ctx_id) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_rewind(ctx);
+    }
+}
+
+#endif // GUI_RETAIN_IMPL_INCLUDED
+#endif // GUI_RETAIN_IMPL
@@ -0,0 +1,401 @@
+// Headless viewer driver: runs the viewer's init, load and frame code on
+// sokol's dummy backend, without a window or GPU
+//
+//   vrm_viewer_headless [options] [viewer options] [model.vrm|glb|gltf]
+//
+// Options the driver does not know go to the viewer's command line, so the
+// model, IBL quality, shader and swapchain size are set as for vrm_viewer.
+// Frames advance the clock by a fixed 1/60 s, so light animation replays
+// identically from run to run. Prints load time and the per-frame cost of
+// building and submitting the frame (there is no GPU work to wait for).
+// --replay <input file> with --bench <out.json> replays a recording and
+// stops when it ends; without -n, a replay or benchmark runs to its end
+// whatever its length, and a run cut short by -n fails.
+//
+// --soak <cycles> with -m <model> (repeatable) drops the models one after
+// another, cycle after cycle, and fails if live sokol resources change from
+// cycle to cycle, if RSS or the heap grow monotonically, or if sokol-gfx
+// logs an error such as an exhausted resource pool. A normal run fails on
+// sokol-gfx errors too.
+
+#include "sokol_app.h"
+#include "sokol_gfx.h"
+#include "headless.h"
+#include "alloc_track.h"
+#include "bench_report.h"
+#include "log.h"
+#include "viewer_options.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+// ============================================================================
+// sokol_app stand-ins
+// ============================================================================
+
+static struct {
+    int width = 1280;
+    int height = 720;
+    double frame_duration = 1.0 / 60.0;
+    bool quit_requested = false;
+    std::string dropped_file;
+} app;
+
+int sapp_width(void) { return app.width; }
+float sapp_widthf(void) { return (float)app.width; }
+int sapp_height(void) { return app.height; }
+float sapp_heightf(void) { return (float)app.height; }
+float sapp_dpi_scale(void) { return 1.0f; }
+double sapp_frame_duration(void) { return app.frame_duration; }
+void sapp_request_quit(void) { app.quit_requested = true; }
+int sapp_get_num_dropped_files(void) { return app.dropped_file.empty() ? 0 : 1; }
+const char* sapp_get_dropped_file_path(int index) { return index == 0 ? app.dropped_file.c_str() : ""; }
+
+sapp_environment sapp_get_environment(void) {
+    sapp_environment env = {};
+    env.defaults.color_format = SAPP_PIXELFORMAT_RGBA8;
+    env.defaults.depth_format = SAPP_PIXELFORMAT_DEPTH_STENCIL;
+    env.defaults.sample_count = 1;
+    return env;
+}
+
+sapp_swapchain sapp_get_swapchain(void) {
+    sapp_swapchain swapchain = {};
+    swapchain.width = app.width;
+    swapchain.height = app.height;
+    swapchain.sample_count = 1;
+    swapchain.color_format = SAPP_PIXELFORMAT_RGBA8;
+    swapchain.depth_format = SAPP_PIXELFORMAT_DEPTH_STENCIL;
+    return swapchain;
+}
+
+// ============================================================================
+// Driver
+// ============================================================================
+
+struct Options {
+    int frames = 0;  // 0: until the replay or benchmark ends, else 300
+    int warmup = 10;  // Frames before timing starts
+    bool check_allocs = false;
+    int soak_cycles = 0;
+    std::vector<std::string> soak_models;
+};
+
+static void print_usage() {
+    printf("Usage: vrm_viewer_headless [options] [viewer options] [model.vrm|glb|gltf]\n");
+    printf("  -n <frames>                  Timed frames (default: 300, or to the end of a replay)\n");
+    printf("  -w <frames>                  Untimed warmup frames first (default: 10)\n");
+    printf("  --check-allocs               Fail if a frame allocates once input and loads settle\n");
+    printf("                               (needs a VRM_VIEWER_ALLOC_TRACKING build)\n");
+    printf("  --soak <cycles>              Load the -m models in turn this many times and check\n");
+    printf("                               resources, RSS and heap for growth\n");
+    printf("  -m <model>                   Model for --soak (repeatable)\n");
+    printf("Viewer options:\n");
+    viewer_options_print_usage();
+}
+
+// ============================================================================
+// Soak
+// ============================================================================
+
+// Frames after each load, so deferred texture decodes and uploads run
+#define SOAK_FRAMES_PER_LOAD 3
+
+// Growth below this is page and allocator noise, not a leak
+#define SOAK_GROWTH_TOLERANCE_MB 1.0
+
+enum SoakResource { SOAK_BUFFERS, SOAK_IMAGES, SOAK_SAMPLERS, SOAK_VIEWS, SOAK_SHADERS, SOAK_PIPELINES, SOAK_RESOURCE_COUNT };
+
+static const char* const soak_resource_names[SOAK_RESOURCE_COUNT] = {
+    "buffers", "images", "samplers", "views", "shaders", "pipelines",
+};
+
+struct SoakSample {
+    int cycle;
+    double rss_mb;  // 0 where unknown
+    double heap_used_mb;  // malloc's main arena and mmapped blocks, 0 where unknown
+    double heap_free_mb;  // Free but held by the main arena
+    double tracked_mb;  // Live tracked allocations (allocation tracking builds)
+    uint32_t live[SOAK_RESOURCE_COUNT];
+};
+
+static double resident_mb() {
+#if defined(__linux__)
+    FILE* file = fopen("/proc/self/statm", "r");
+    if (!file) {
+        return 0.0;
+    }
+    unsigned long long size = 0, resident = 0;
+    int fields = fscanf(file, "%llu %llu", &size, &resident);
+    fclose(file);
+    return fields == 2 ? resident * (double)sysconf(_SC_PAGESIZE) / (1024.0 * 1024.0) : 0.0;
+#else
+    return 0.0;
+#endif
+}
+
+static SoakSample take_soak_sample(int cycle) {
+    SoakSample sample = {};
+    sample.cycle = cycle;
+    sample.rss_mb = resident_mb();
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 33)
+    struct mallinfo2 info = mallinfo2();
+    sample.heap_used_mb = (info.uordblks + info.hblkhd) / (1024.0 * 1024.0);
+    sample.heap_free_mb = info.fordblks / (1024.0 * 1024.0);
+#endif
+    if (alloc_tracking_enabled()) {
+        uint64_t live = 0;
+        for (int i = 0; i < ALLOC_SUBSYSTEM_COUNT; i++) {
+            live += alloc_stats((AllocSubsystem)i).live_bytes;
+        }
+        sample.tracked_mb = live / (1024.0 * 1024.0);
+    }
+    sg_stats stats = sg_query_stats();
+    sample.live[SOAK_BUFFERS] = stats.total.buffers.alive;
+    sample.live[SOAK_IMAGES] = stats.total.images.alive;
+    sample.live[SOAK_SAMPLERS] = stats.total.samplers.alive;
+    sample.live[SOAK_VIEWS] = stats.total.views.alive;
+    sample.live[SOAK_SHADERS] = stats.total.shaders.alive;
+    sample.live[SOAK_PIPELINES] = stats.total.pipelines.alive;
+    return sample;
+}
+
+static void print_soak_sample(const SoakSample& sample) {
+    double fragmentation = sample.heap_used_mb + sample.heap_free_mb > 0.0
+                               ? sample.heap_free_mb / (sample.heap_used_mb + sample.heap_free_mb) * 100.0
+                               : 0.0;
+    printf("%8d %9.1f %9.1f %9.1f %6.1f%% %9.1f", sample.cycle, sample.rss_mb, sample.heap_used_mb,
+           sample.heap_free_mb, fragmentation, sample.tracked_mb);
+    for (int r = 0; r < SOAK_RESOURCE_COUNT; r++) {
+        printf(" %9u", sample.live[r]);
+    }
+    printf("\n");
+    fflush(stdout);
+}
+
+// Growth that never reverses: every sample of the second half above every
+// sample of the first, by more than the tolerance. Noise that comes and
+// goes does not trip it.
+static bool grows_monotonically(const std::vector<SoakSample>& samples, double SoakSample::*metric) {
+    size_t half = samples.size() / 2;
+    double first_max = 0.0, second_min = 0.0;
+    for (size_t i = 0; i < samples.size(); i++) {
+        double value = samples[i].*metric;
+        if (i < half) {
+            first_max = i == 0 ? value : std::max(first_max, value);
+        } else {
+            second_min = i == half ? value : std::min(second_min, value);
+        }
+    }
+    return second_min > first_max + SOAK_GROWTH_TOLERANCE_MB;
+}
+
+static bool soak(const sapp_desc& desc, const Options& options) {
+    // Viewer log lines go out on a background thread; keep them ahead of the table
+    log_flush();
+    printf("%8s %9s %9s %9s %7s %9s", "cycle", "rss MB", "heap MB", "free MB", "frag", "tracked");
+    for (int r = 0; r < SOAK_RESOURCE_COUNT; r++) {
+        printf(" %9s", soak_resource_names[r]);
+    }
+    printf("\n");
+
+    // The first cycles fill caches and pools; growth is judged after them
+    int warmup_cycles = std::max(1, options.soak_cycles / 10);
+    int print_every = std::max(1, options.soak_cycles / 20);
+    std::vector<SoakSample> samples;
+    samples.reserve(options.soak_cycles);  // Growing it would show up as a leak
+    for (int cycle = 1; cycle <= options.soak_cycles && !app.quit_requested; cycle++) {
+        for (const std::string& model : options.soak_models) {
+            app.dropped_file = model;
+            sapp_event event = {};
+            event.type = SAPP_EVENTTYPE_FILES_DROPPED;
+            desc.event_cb(&event);
+            app.dropped_file.clear();
+            ViewerStats stats = {};
+            viewer_stats(stats);
+            if (stats.load_failed) {
+                log_flush();
+                fprintf(stderr, "%s failed to load in cycle %d\n", model.c_str(), cycle);
+                return false;
+            }
+            for (int frame = 0; frame < SOAK_FRAMES_PER_LOAD; frame++) {
+                desc.frame_cb();
+            }
+        }
+        SoakSample sample = take_soak_sample(cycle);
+        if (cycle == 1 || cycle % print_every == 0 || cycle == options.soak_cycles) {
+            log_flush();
+            print_soak_sample(sample);
+        }
+        if (cycle > warmup_cycles) {
+            samples.push_back(sample);
+        }
+    }
+
+    ViewerStats stats = {};
+    viewer_stats(stats);
+    if (stats.gfx_errors > 0) {
+        fprintf(stderr, "sokol-gfx logged %u error(s); resources were not created\n", stats.gfx_errors);
+        printf("\nSoak FAILED\n");
+        return false;
+    }
+    if (samples.size() < 4) {
+        printf("\nToo few cycles after warmup to judge growth; run more than %d\n", warmup_cycles + 3);
+        return true;
+    }
+    bool passed = true;
+    // Every cycle ends on the same model, so it should hold the same resources
+    for (int r = 0; r < SOAK_RESOURCE_COUNT; r++) {
+        for (const SoakSample& sample : samples) {
+            if (sample.live[r] != samples.front().live[r]) {
+                fprintf(stderr, "Live %s changed from %u after cycle %d to %u after cycle %d\n", soak_resource_names[r],
+                        samples.front().live[r], samples.front().cycle, sample.live[r], sample.cycle);
+                passed = false;
+                break;
+            }
+        }
+    }
+    const struct {
+        const char* name;
+        double SoakSample::*metric;
+    } metrics[] = {
+        { "RSS", &SoakSample::rss_mb },
+        { "Heap in use", &SoakSample::heap_used_mb },
+        { "Free heap held (fragmentation)", &SoakSample::heap_free_mb },
+        { "Tracked live allocations", &SoakSample::tracked_mb },
+    };
+    for (const auto& metric : metrics) {
+        if (grows_monotonically(samples, metric.metric)) {
+            fprintf(stderr, "%s grows monotonically: %.1f MB after cycle %d, %.1f MB after cycle %d\n", metric.name,
+                    samples.front().*metric.metric, samples.front().cycle, samples.back().*metric.metric,
+                    samples.back().cycle);
+            passed = false;
+        }
+    }
+    printf("\nSoak %s: %zu cycles of %zu model(s) checked after %d warmup cycles\n", passed ? "passed" : "FAILED",
+           samples.size(), options.soak_models.size(), warmup_cycles);
+    return passed;
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    std::vector<char*> viewer_args = { argv[0] };
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-n" && i + 1 < argc) {
+            options.frames = std::max(1, atoi(argv[++i]));
+        } else if (arg == "-w" && i + 1 < argc) {
+            options.warmup = std::max(0, atoi(argv[++i]));
+        } else if (arg == "--check-allocs") {
+            options.check_allocs = true;
+        } else if (arg == "--soak" && i + 1 < argc) {
+            options.soak_cycles = std::max(1, atoi(argv[++i]));
+        } else if (arg == "-m" && i + 1 < argc) {
+            options.soak_models.push_back(argv[++i]);
+        } else if (arg == "-h" || arg == "--help") {
+            print_usage();
+            return 0;
+        } else {
+            viewer_args.push_back(argv[i]);
+        }
+    }
+    if (options.check_allocs && !alloc_tracking_enabled()) {
+        fprintf(stderr, "--check-allocs needs a build configured with -DVRM_VIEWER_ALLOC_TRACKING=ON\n");
+        return 2;
+    }
+    if (options.soak_cycles > 0 && options.soak_models.empty()) {
+        fprintf(stderr, "--soak needs at least one -m <model>\n");
+        return 2;
+    }
+
+    sapp_desc desc = sokol_main((int)viewer_args.size(), viewer_args.data());
+    app.width = desc.width;
+    app.height = desc.height;
+    desc.init_cb();
+
+    ViewerStats stats = {};
+    viewer_stats(stats);
+    if (stats.load_failed) {
+        log_flush();
+        fprintf(stderr, "The model failed to load\n");
+        desc.cleanup_cb();
+        return 1;
+    }
+    double load_ms = stats.model_loaded ? stats.load_ms : 0.0;
+    if (options.soak_cycles > 0) {
+        bool passed = soak(desc, options);
+        desc.cleanup_cb();
+        return passed ? 0 : 1;
+    }
+
+    // A replay or benchmark runs to its end unless -n says otherwise
+    bool to_replay_end = options.frames == 0 && stats.replaying;
+    if (options.frames == 0) {
+        options.frames = 300;
+    }
+    std::vector<double> frame_ms;
+    frame_ms.reserve(options.frames);
+    for (int i = 0; (to_replay_end || i < options.warmup + options.frames) && !app.quit_requested; i++) {
+        auto start = std::chrono::steady_clock::now();
+        desc.frame_cb();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (i >= options.warmup) {
+            frame_ms.push_back(ms);
+        }
+        if (to_replay_end) {
+            viewer_stats(stats);
+            if (!stats.replaying) {
+                break;
+            }
+        }
+    }
+    viewer_stats(stats);
+    desc.cleanup_cb();
+
+    BenchStats frame_stats = bench_stats(frame_ms);
+    printf("\n");
+    if (load_ms > 0.0) {
+        printf("%-16s %10.2f ms\n", "load", load_ms);
+    }
+    printf("%-16s %10zu\n", "frames", frame_ms.size());
+    printf("%-16s %10.3f ms\n", "frame mean", frame_stats.mean);
+    printf("%-16s %10.3f ms\n", "frame p50", frame_stats.median);
+    printf("%-16s %10.3f ms\n", "frame p90", frame_stats.p90);
+    printf("%-16s %10.3f ms\n", "frame p99", frame_stats.p99);
+    printf("%-16s %10.3f ms\n", "frame max", frame_stats.max);
+    printf("%-16s %10d\n", "draws/frame", stats.draws);
+    printf("%-16s %10llu\n", "triangles/frame", (unsigned long long)stats.triangles);
+    if (alloc_tracking_enabled()) {
+        printf("%-16s %10llu\n", "allocs/frame", (unsigned long long)stats.frame_allocs);
+    }
+
+    if (stats.replaying) {
+        fprintf(stderr, "Stopped after %d frames, before the replay ended; raise -n or leave it out\n",
+                options.warmup + (int)frame_ms.size());
+        return 1;
+    }
+    if (stats.gfx_errors > 0) {
+        fprintf(stderr, "sokol-gfx logged %u error(s)\n", stats.gfx_errors);
+        return 1;
+    }
+    if (stats.bench_failed) {
+        fprintf(stderr, "The benchmark report was not written\n");
+        return 1;
+    }
+    if (options.check_allocs && stats.steady_frame_allocated) {
+        fprintf(stderr, "A steady-state frame allocated\n");
+        return 1;
+    }
+    return 0;
+}
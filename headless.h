@@ -0,0 +1,26 @@
+// Headless viewer: main.cpp on sokol's dummy backend, driven by
+// headless.cpp in place of sokol_app. The driver stands in for the few
+// sapp_* functions the viewer and sokol_glue call, feeds the viewer's
+// init/event/frame/cleanup callbacks, and reads back what each frame did.
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+#include <cstdint>
+
+struct ViewerStats {
+    bool model_loaded;
+    int draws;  // Model draws submitted by the last frame
+    uint64_t triangles;  // Triangles in those draws
+    uint64_t frame_allocs;  // Heap allocations in the last frame (allocation tracking builds)
+    bool steady_frame_allocated;  // A frame after input and loads settled allocated
+    double load_ms;  // The last model load
+    bool load_failed;  // The last model load failed
+    bool replaying;  // A --replay or --bench run has frames left
+    bool bench_failed;  // The benchmark report could not be written
+    uint32_t gfx_errors;  // Errors sokol-gfx has logged since init
+};
+
+// Defined in main.cpp
+void viewer_stats(ViewerStats& out);
+
+#endif // HEADLESS_H
@@ -0,0 +1,371 @@
+// Image-based lighting bakes
+
+#include "ibl.h"
+#include "trace.h"
+
+#include "HandmadeMath.h"
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include "parallel-util.hpp"
+
+namespace {
+
+// Sample equirectangular HDR texture with bilinear filtering
+// dir: normalized direction vector in world space
+HMM_Vec3 sample_equirectangular(const float* hdr_data, int width, int height, HMM_Vec3 dir) {
+    // Convert direction to spherical coordinates
+    // theta: polar angle from +Y axis (0 = top, PI = bottom)
+    // phi: azimuthal angle around Y axis
+    float theta = acosf(HMM_Clamp(-1.0f, dir.Y, 1.0f));  // [0, PI]
+    float phi = atan2f(dir.X, -dir.Z);  // [-PI, PI], note: -Z is forward
+    
+    // Convert to UV coordinates
+    float u = (phi + HMM_PI32) / (2.0f * HMM_PI32);  // [0, 1]
+    float v = theta / HMM_PI32;  // [0, 1]
+    
+    // Bilinear filtering with proper wrap/clamp
+    float px = u * width - 0.5f;
+    float py = v * height - 0.5f;
+    
+    // Wrap helper for horizontal (longitude wraps around)
+    auto wrap_x = [width](int x) -> int {
+        return ((x % width) + width) % width;
+    };
+    
+    // Clamp helper for vertical (latitude clamps at poles)
+    auto clamp_y = [height](int y) -> int {
+        return HMM_Clamp(0, y, height - 1);
+    };
+    
+    int x0 = (int)floorf(px);
+    int y0 = (int)floorf(py);
+    int x1 = x0 + 1;
+    int y1 = y0 + 1;
+    
+    float fx = px - x0;
+    float fy = py - y0;
+    
+    // Sample 4 pixels with wrap/clamp
+    auto sample_pixel = [&](int x, int y) -> HMM_Vec3 {
+        int sx = wrap_x(x);
+        int sy = clamp_y(y);
+        int idx = (sy * width + sx) * 3;
+        return HMM_V3(hdr_data[idx], hdr_data[idx + 1], hdr_data[idx + 2]);
+    };
+    
+    HMM_Vec3 c00 = sample_pixel(x0, y0);
+    HMM_Vec3 c10 = sample_pixel(x1, y0);
+    HMM_Vec3 c01 = sample_pixel(x0, y1);
+    HMM_Vec3 c11 = sample_pixel(x1, y1);
+    
+    // Bilinear interpolation using HMM_LerpV3
+    HMM_Vec3 c0 = HMM_LerpV3(c00, fx, c10);
+    HMM_Vec3 c1 = HMM_LerpV3(c01, fx, c11);
+    return HMM_LerpV3(c0, fy, c1);
+}
+
+// Get cubemap face direction from face index and UV coordinates
+// UV is in [-1, 1] range, returns normalized direction vector
+HMM_Vec3 get_cubemap_direction(int face, float u, float v) {
+    HMM_Vec3 dir;
+    switch (face) {
+        case 0: dir = HMM_V3( 1.0f, -v, -u); break;  // +X
+        case 1: dir = HMM_V3(-1.0f, -v,  u); break;  // -X
+        case 2: dir = HMM_V3( u,  1.0f,  v); break;  // +Y
+        case 3: dir = HMM_V3( u, -1.0f, -v); break;  // -Y
+        case 4: dir = HMM_V3( u, -v,  1.0f); break;  // +Z
+        case 5: dir = HMM_V3(-u, -v, -1.0f); break;  // -Z
+        default: dir = HMM_V3(0, 0, 1); break;
+    }
+    return HMM_NormV3(dir);
+}
+
+// Build orthonormal tangent space basis from normal vector
+void build_tangent_space(HMM_Vec3 N, HMM_Vec3* T, HMM_Vec3* B) {
+    // Choose an up vector that's not parallel to N
+    HMM_Vec3 up = (fabsf(N.Y) < 0.999f) ? HMM_V3(0, 1, 0) : HMM_V3(1, 0, 0);
+    *B = HMM_NormV3(HMM_Cross(N, up));
+    *T = HMM_Cross(*B, N);
+}
+
+// Transform tangent space direction to world space
+HMM_Vec3 tangent_to_world(HMM_Vec3 local, HMM_Vec3 T, HMM_Vec3 B, HMM_Vec3 N) {
+    return HMM_AddV3(HMM_AddV3(
+        HMM_MulV3F(T, local.X),
+        HMM_MulV3F(B, local.Y)),
+        HMM_MulV3F(N, local.Z));
+}
+
+// Reflect vector V around normal N
+HMM_Vec3 reflect(HMM_Vec3 V, HMM_Vec3 N) {
+    return HMM_SubV3(HMM_MulV3F(N, 2.0f * HMM_DotV3(V, N)), V);
+}
+
+
+} // namespace
+
+bool ibl_settings_preset(const char* name, IblSettings& out) {
+    static const struct {
+        const char* name;
+        IblSettings settings;
+    } presets[] = {
+        { "low", { 256, 16, 32, 128, 16 } },
+        { "medium", { 512, 32, 64, 256, 64 } },
+        { "high", { 1024, 64, 256, 512, 128 } },
+    };
+    for (const auto& preset : presets) {
+        if (strcmp(preset.name, name) == 0) {
+            out = preset.settings;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ibl_environment_cubemap(const float* hdr_data, int hdr_width, int hdr_height, int size, std::vector<float>& out) {
+    TRACE_ZONE("ibl_environment_cubemap");
+    const int face_size = size * size * 4;  // RGBA32F per face
+    out.resize((size_t)face_size * 6);  // 6 faces
+    
+    // Rows are the tasks, so each worker's share shows up in a trace
+    auto shade = [&](int face_y, int x) {
+        int face = face_y / size;
+        int y = face_y % size;
+        float* face_data = out.data() + face * face_size;
+        
+        // Convert pixel coordinates to UV in [-1, 1] range
+        float u = (x + 0.5f) / size * 2.0f - 1.0f;
+        float v = (y + 0.5f) / size * 2.0f - 1.0f;
+        
+        // Get direction and sample HDR
+        HMM_Vec3 dir = get_cubemap_direction(face, u, v);
+        HMM_Vec3 color = sample_equirectangular(hdr_data, hdr_width, hdr_height, dir);
+        
+        // Store HDR values
+        int idx = (y * size + x) * 4;
+        face_data[idx + 0] = color.X;
+        face_data[idx + 1] = color.Y;
+        face_data[idx + 2] = color.Z;
+        face_data[idx + 3] = 1.0f;
+    };
+    parallelutil::parallel_for(6 * size, [&](int row) {
+        TRACE_ZONE("ibl_environment_cubemap row");
+        for (int col = 0; col < size; col++) {
+            shade(row, col);
+        }
+    });
+}
+
+void ibl_irradiance_map(const float* hdr_data, int hdr_width, int hdr_height, int size, int samples,
+                        std::vector<float>& out) {
+    TRACE_ZONE("ibl_irradiance_map");
+    const int face_size = size * size * 4;
+    out.resize((size_t)face_size * 6);
+    
+    auto shade = [&](int face_y, int x) {
+        int face = face_y / size;
+        int y = face_y % size;
+        float* face_data = out.data() + face * face_size;
+        
+        float u = (x + 0.5f) / size * 2.0f - 1.0f;
+        float v = (y + 0.5f) / size * 2.0f - 1.0f;
+        
+        // Get normal direction for this cubemap pixel
+        HMM_Vec3 N = get_cubemap_direction(face, u, v);
+        
+        // Build tangent space
+        HMM_Vec3 T, B;
+        build_tangent_space(N, &T, &B);
+        
+        // Sample hemisphere around normal
+        HMM_Vec3 irradiance = HMM_V3(0, 0, 0);
+        const int num_samples = samples;
+        std::mt19937 rng(static_cast<unsigned int>(face * size * size + y * size + x));
+        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+        
+        for (int i = 0; i < num_samples; i++) {
+            float Xi1 = dist(rng);
+            float Xi2 = dist(rng);
+            
+            // Cosine-weighted hemisphere sampling
+            float phi = 2.0f * HMM_PI32 * Xi1;
+            float cosTheta = sqrtf(Xi2);
+            float sinTheta = sqrtf(1.0f - Xi2);
+            
+            // Local direction in tangent space
+            HMM_Vec3 local_dir = HMM_V3(sinTheta * cosf(phi), sinTheta * sinf(phi), cosTheta);
+            
+            // Transform to world space
+            HMM_Vec3 L = HMM_NormV3(tangent_to_world(local_dir, T, B, N));
+            
+            // Sample environment and accumulate
+            HMM_Vec3 sample_color = sample_equirectangular(hdr_data, hdr_width, hdr_height, L);
+            irradiance = HMM_AddV3(irradiance, sample_color);
+        }
+        
+        // Average samples
+        irradiance = HMM_MulV3F(irradiance, 1.0f / num_samples);
+        
+        // Store HDR values
+        int idx = (y * size + x) * 4;
+        face_data[idx + 0] = irradiance.X;
+        face_data[idx + 1] = irradiance.Y;
+        face_data[idx + 2] = irradiance.Z;
+        face_data[idx + 3] = 1.0f;
+    };
+    parallelutil::parallel_for(6 * size, [&](int row) {
+        TRACE_ZONE("ibl_irradiance_map row");
+        for (int col = 0; col < size; col++) {
+            shade(row, col);
+        }
+    });
+}
+
+int ibl_prefilter_mip_count(int base_size) {
+    int num_mips = 0;
+    int temp_size = base_size;
+    while (temp_size >= 8 && num_mips < IBL_PREFILTER_MAX_MIPS) {
+        num_mips++;
+        temp_size /= 2;
+    }
+    return num_mips;
+}
+
+float ibl_prefilter_roughness(int mip, int mip_count) {
+    float roughness = mip_count > 1 ? (float)mip / (float)(mip_count - 1) : 0.0f;  // 0.0 to 1.0
+    
+    // Ensure minimum roughness to avoid singularities
+    return HMM_MAX(roughness, 0.01f);
+}
+
+void ibl_prefilter_mip(const float* hdr_data, int hdr_width, int hdr_height, int mip_size, float roughness,
+                       int base_samples, float* out) {
+    TRACE_ZONE("ibl_prefilter_mip");
+    const int face_size = mip_size * mip_size * 4;
+    
+    // More samples for rougher surfaces (they need more averaging)
+    const int num_samples = base_samples + (int)(roughness * 3 * base_samples);  // 64-256 at medium quality
+    
+    auto shade = [&](int face_y, int x) {
+        int face = face_y / mip_size;
+        int y = face_y % mip_size;
+        float* face_data = out + face * face_size;
+        
+        float u = (x + 0.5f) / mip_size * 2.0f - 1.0f;
+        float v = (y + 0.5f) / mip_size * 2.0f - 1.0f;
+        
+        HMM_Vec3 R = get_cubemap_direction(face, u, v);
+        HMM_Vec3 T, B;
+        build_tangent_space(R, &T, &B);
+        
+        // Use roughness^2 for GGX (remapped roughness)
+        float a = roughness * roughness;
+        float a2 = a * a;
+        
+        HMM_Vec3 prefiltered = HMM_V3(0, 0, 0);
+        float total_weight = 0.0f;
+        std::mt19937 rng(static_cast<unsigned int>(face * mip_size * mip_size + y * mip_size + x));
+        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+        
+        for (int i = 0; i < num_samples; i++) {
+            float Xi1 = dist(rng);
+            float Xi2 = dist(rng);
+            
+            // GGX importance sampling
+            float phi = 2.0f * HMM_PI32 * Xi1;
+            float cosTheta = sqrtf((1.0f - Xi2) / (1.0f + (a2 - 1.0f) * Xi2));
+            float sinTheta = sqrtf(1.0f - cosTheta * cosTheta);
+            
+            HMM_Vec3 H_local = HMM_V3(sinTheta * cosf(phi), sinTheta * sinf(phi), cosTheta);
+            HMM_Vec3 H = tangent_to_world(H_local, T, B, R);
+            HMM_Vec3 L = HMM_NormV3(reflect(R, H));
+            
+            float NdotL = HMM_MAX(0.0f, HMM_DotV3(R, L));
+            if (NdotL > 0.0f) {
+                HMM_Vec3 sample_color = sample_equirectangular(hdr_data, hdr_width, hdr_height, L);
+                prefiltered = HMM_AddV3(prefiltered, HMM_MulV3F(sample_color, NdotL));
+                total_weight += NdotL;
+            }
+        }
+        
+        if (total_weight > 0.0f) {
+            prefiltered = HMM_MulV3F(prefiltered, 1.0f / total_weight);
+        }
+        
+        int idx = (y * mip_size + x) * 4;
+        face_data[idx + 0] = prefiltered.X;
+        face_data[idx + 1] = prefiltered.Y;
+        face_data[idx + 2] = prefiltered.Z;
+        face_data[idx + 3] = 1.0f;
+    };
+    parallelutil::parallel_for(6 * mip_size, [&](int row) {
+        TRACE_ZONE("ibl_prefilter_mip row");
+        for (int col = 0; col < mip_size; col++) {
+            shade(row, col);
+        }
+    });
+}
+
+void ibl_brdf_lut(int size, std::vector<uint8_t>& rgba) {
+    TRACE_ZONE("ibl_brdf_lut");
+    std::vector<float> lut_data((size_t)size * size * 2);
+    
+    auto shade = [&](int x, int y) {
+        float NdotV = (x + 0.5f) / size;
+        float roughness = (y + 0.5f) / size;
+        
+        // View vector in tangent space (N = (0,0,1))
+        HMM_Vec3 V = HMM_V3(sqrtf(1.0f - NdotV * NdotV), 0.0f, NdotV);
+        float A = 0.0f, B = 0.0f;
+        
+        std::mt19937 rng(static_cast<unsigned int>(x * size + y));
+        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+        
+        const int num_samples = 1024;
+        for (int i = 0; i < num_samples; i++) {
+            float Xi1 = dist(rng);
+            float Xi2 = dist(rng);
+            
+            // GGX importance sampling
+            float a = roughness * roughness;
+            float phi = 2.0f * HMM_PI32 * Xi1;
+            float cosTheta = sqrtf((1.0f - Xi2) / (1.0f + (a * a - 1.0f) * Xi2));
+            float sinTheta = sqrtf(1.0f - cosTheta * cosTheta);
+            
+            // Half vector in tangent space
+            HMM_Vec3 H = HMM_V3(cosf(phi) * sinTheta, sinf(phi) * sinTheta, cosTheta);
+            
+            float NdotH = H.Z;  // N = (0,0,1) in tangent space
+            float VdotH = HMM_DotV3(V, H);
+            
+            if (NdotH > 0.0f && VdotH > 0.0f) {
+                // Simplified geometry term
+                float G = HMM_MIN(2.0f * NdotH / VdotH, 1.0f);
+                float G_Vis = G * VdotH / (NdotH * NdotV);
+                float Fc = powf(HMM_MAX(1.0f - VdotH, 0.0f), 5.0f);
+                A += (1.0f - Fc) * G_Vis;
+                B += Fc * G_Vis;
+            }
+        }
+        
+        lut_data[(y * size + x) * 2 + 0] = A / num_samples;
+        lut_data[(y * size + x) * 2 + 1] = B / num_samples;
+    };
+    parallelutil::parallel_for(size, [&](int row) {
+        TRACE_ZONE("ibl_brdf_lut row");
+        for (int col = 0; col < size; col++) {
+            shade(col, row);
+        }
+    });
+    
+    // Convert to RGBA8 format
+    rgba.resize((size_t)size * size * 4);
+    for (int i = 0; i < size * size; i++) {
+        rgba[i * 4 + 0] = (uint8_t)HMM_MIN(lut_data[i * 2 + 0] * 255.0f, 255.0f);
+        rgba[i * 4 + 1] = (uint8_t)HMM_MIN(lut_data[i * 2 + 1] * 255.0f, 255.0f);
+        rgba[i * 4 + 2] = 0;
+        rgba[i * 4 + 3] = 255;
+    }
+}
@@ -0,0 +1,49 @@
+// Image-based lighting bakes (no sokol dependency): an equirectangular HDR
+// environment (RGB float, V = 0 at the top) is resampled into the cubemaps
+// the PBR shaders read. Cubemaps are RGBA32F with the faces in +X, -X, +Y,
+// -Y, +Z, -Z order, the layout of one sokol cube image mip level.
+#ifndef IBL_H
+#define IBL_H
+
+#include <cstdint>
+#include <vector>
+
+// Prefilter mips the shaders address (MAX_REFLECTION_LOD + 1)
+#define IBL_PREFILTER_MAX_MIPS 5
+
+// Bake resolutions and sample counts
+struct IblSettings {
+    int environment_size;
+    int irradiance_size;
+    int irradiance_samples;  // Per texel
+    int prefilter_size;  // Base mip, at least 128 so all IBL_PREFILTER_MAX_MIPS exist
+    int prefilter_samples;  // Per texel at roughness 0, four times as many at 1
+};
+
+// "low", "medium" (the viewer's default) or "high"; false for other names
+bool ibl_settings_preset(const char* name, IblSettings& out);
+
+// Environment cubemap for the skybox, bilinearly resampled
+void ibl_environment_cubemap(const float* hdr_data, int hdr_width, int hdr_height, int size, std::vector<float>& out);
+
+// Diffuse irradiance: cosine-weighted hemisphere average per texel
+void ibl_irradiance_map(const float* hdr_data, int hdr_width, int hdr_height, int size, int samples,
+                        std::vector<float>& out);
+
+// Mip levels of a prefilter map of base_size, halving down to 8x8
+int ibl_prefilter_mip_count(int base_size);
+
+// Roughness a prefilter mip is convolved for: 0 at mip 0 to 1 at the last
+float ibl_prefilter_roughness(int mip, int mip_count);
+
+// One prefilter mip (mip_size^2 * 6 texels into out): GGX importance
+// sampled specular convolution for roughness, base_samples per texel at
+// roughness 0 rising linearly to four times that at 1
+void ibl_prefilter_mip(const float* hdr_data, int hdr_width, int hdr_height, int mip_size, float roughness,
+                       int base_samples, float* out);
+
+// Split-sum BRDF LUT, RGBA8 with scale in R and bias in G (NdotV along x,
+// roughness along y)
+void ibl_brdf_lut(int size, std::vector<uint8_t>& rgba);
+
+#endif // IBL_H
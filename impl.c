@@ -1,9 +1,18 @@
+#ifdef VRM_VIEWER_HEADLESS
+// No window: sokol_app's declarations only, headless.cpp provides the
+// functions the viewer and sokol_glue call
+#include "sokol_app.h"
+#define SOKOL_IMPL
+#else
 #define SOKOL_IMPL
 #include "sokol_app.h"
+#endif
 #include "sokol_gfx.h"
 #include "sokol_log.h"
 #include "sokol_glue.h"
 #include "util/sokol_gl.h"
+#define GUI_RETAIN_IMPL
+#include "gui_retain.h"
 
 // Font rendering
 #define FONTSTASH_IMPLEMENTATION
@@ -16,7 +25,3 @@
 #include "clay.h"
 #define SOKOL_CLAY_IMPL
 #include "sokol_clay.h"
-
-#define STB_IMAGE_IMPLEMENTATION
-#define STBI_WINDOWS_UTF8
-#include "stb_image.h"
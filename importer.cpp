@@ -0,0 +1,468 @@
+// CPU-side GLTF/GLB/VRM import shared by the viewer and the offline tools
+
+#define CGLTF_IMPLEMENTATION
+#include "importer.h"
+#include "alloc_track.h"
+#include "trace.h"
+
+#define STB_IMAGE_IMPLEMENTATION
+#define STBI_WINDOWS_UTF8
+#define STBI_MALLOC(size) alloc_track_malloc(size)
+#define STBI_REALLOC(ptr, size) alloc_track_realloc(ptr, size)
+#define STBI_FREE(ptr) alloc_track_free(ptr)
+#include "stb_image.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+// ============================================================================
+// UTF-8 file reading support for Windows
+// ============================================================================
+
+#ifdef _WIN32
+static std::wstring utf8_to_wstring(const char* utf8_str) {
+    if (!utf8_str || !*utf8_str) return L"";
+    int len = MultiByteToWideChar(CP_UTF8, 0, utf8_str, -1, nullptr, 0);
+    if (len <= 0) return L"";
+    std::wstring result(len - 1, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, utf8_str, -1, &result[0], len);
+    return result;
+}
+
+bool read_file_utf8(const char* filepath, std::vector<uint8_t>& out_data) {
+    std::wstring wpath = utf8_to_wstring(filepath);
+    HANDLE hFile = CreateFileW(wpath.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                               nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (hFile == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(hFile, &fileSize)) {
+        CloseHandle(hFile);
+        return false;
+    }
+
+    out_data.resize((size_t)fileSize.QuadPart);
+    DWORD bytesRead;
+    BOOL success = ReadFile(hFile, out_data.data(), (DWORD)fileSize.QuadPart, &bytesRead, nullptr);
+    CloseHandle(hFile);
+
+    return success && bytesRead == fileSize.QuadPart;
+}
+
+FILE* fopen_utf8(const char* filepath, const char* mode) {
+    std::wstring wpath = utf8_to_wstring(filepath);
+    std::wstring wmode = utf8_to_wstring(mode);
+    return _wfopen(wpath.c_str(), wmode.c_str());
+}
+#else
+bool read_file_utf8(const char* filepath, std::vector<uint8_t>& out_data) {
+    FILE* f = fopen(filepath, "rb");
+    if (!f) return false;
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    out_data.resize(size);
+    size_t read = fread(out_data.data(), 1, size, f);
+    fclose(f);
+
+    return read == (size_t)size;
+}
+
+FILE* fopen_utf8(const char* filepath, const char* mode) {
+    return fopen(filepath, mode);
+}
+#endif
+
+bool write_file_utf8(const char* filepath, const void* data, size_t size) {
+    FILE* f = fopen_utf8(filepath, "wb");
+    if (!f) return false;
+    size_t written = fwrite(data, 1, size, f);
+    return fclose(f) == 0 && written == size;
+}
+
+std::string resolve_uri_path(const char* base_path, const char* uri) {
+    std::string path = base_path;
+    size_t last_slash = path.find_last_of("/\\");
+    if (last_slash != std::string::npos) {
+        path = path.substr(0, last_slash + 1);
+    } else {
+        path = "";
+    }
+    return path + uri;
+}
+
+// ============================================================================
+// GLTF/GLB/VRM Loading
+// ============================================================================
+
+// Custom cgltf file read callback for UTF-8 path support
+static cgltf_result cgltf_read_file_utf8(const cgltf_memory_options* memory_options,
+                                          const cgltf_file_options* file_options,
+                                          const char* path, cgltf_size* size, void** data) {
+    (void)file_options;
+
+    std::vector<uint8_t> file_data;
+    if (!read_file_utf8(path, file_data)) {
+        return cgltf_result_file_not_found;
+    }
+
+    void* (*memory_alloc)(void*, cgltf_size) = memory_options->alloc ? memory_options->alloc : &cgltf_default_alloc;
+    void* result = memory_alloc(memory_options->user_data, file_data.size());
+    if (!result) {
+        return cgltf_result_out_of_memory;
+    }
+
+    memcpy(result, file_data.data(), file_data.size());
+    *size = file_data.size();
+    *data = result;
+
+    return cgltf_result_success;
+}
+
+static void cgltf_release_file_utf8(const cgltf_memory_options* memory_options,
+                                     const cgltf_file_options* file_options, void* data) {
+    (void)file_options;
+    void (*memory_free)(void*, void*) = memory_options->free ? memory_options->free : &cgltf_default_free;
+    memory_free(memory_options->user_data, data);
+}
+
+cgltf_data* import_gltf(const char* filepath, std::string& error) {
+    TRACE_ZONE("import_gltf");
+    cgltf_options options = {};
+    options.memory.alloc = [](void*, cgltf_size size) { return alloc_track_malloc(size); };
+    options.memory.free = [](void*, void* ptr) { alloc_track_free(ptr); };
+    options.file.read = cgltf_read_file_utf8;
+    options.file.release = cgltf_release_file_utf8;
+
+    cgltf_data* data = nullptr;
+
+    // The JSON and GLB binary chunk point into the file memory, which
+    // cgltf_parse_file hands to the cgltf_data (freed by cgltf_free)
+    cgltf_result result = cgltf_parse_file(&options, filepath, &data);
+    if (result == cgltf_result_file_not_found || result == cgltf_result_io_error) {
+        error = "Failed to read model file";
+        return nullptr;
+    }
+    if (result != cgltf_result_success) {
+        error = "Failed to parse GLTF file";
+        return nullptr;
+    }
+
+    // Load buffers (uses our custom file read callback for external files)
+    result = cgltf_load_buffers(&options, data, filepath);
+    if (result != cgltf_result_success) {
+        error = "Failed to load GLTF buffers";
+        cgltf_free(data);
+        return nullptr;
+    }
+    return data;
+}
+
+bool is_vrm_data(const cgltf_data* data) {
+    for (size_t i = 0; i < data->extensions_used_count; i++) {
+        if (strstr(data->extensions_used[i], "VRM") || strstr(data->extensions_used[i], "vrm")) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const cgltf_extension* find_extension(const cgltf_extension* extensions, cgltf_size count, const char* name) {
+    for (cgltf_size i = 0; i < count; i++) {
+        if (extensions[i].name && strcmp(extensions[i].name, name) == 0) {
+            return &extensions[i];
+        }
+    }
+    return nullptr;
+}
+
+const uint8_t* image_buffer_view_bytes(const cgltf_image* image, size_t* size) {
+    const cgltf_buffer_view* view = image->buffer_view;
+    if (!view || !view->buffer->data) {
+        return nullptr;
+    }
+    *size = view->size;
+    return (const uint8_t*)view->buffer->data + view->offset;
+}
+
+uint64_t hash_bytes(const uint8_t* data, size_t size) {
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+// ============================================================================
+// Vertex and index conversion
+// ============================================================================
+
+// Rotate (and scale) a direction by the node matrix and renormalize it,
+// falling back when it degenerates
+static void transform_direction(const float m[16], const float in[3], const float fallback[3], float out[3]) {
+    float x = m[0] * in[0] + m[4] * in[1] + m[8] * in[2];
+    float y = m[1] * in[0] + m[5] * in[1] + m[9] * in[2];
+    float z = m[2] * in[0] + m[6] * in[1] + m[10] * in[2];
+    float len = sqrtf(x * x + y * y + z * z);
+    if (len > 0.0001f) {
+        out[0] = x / len;
+        out[1] = y / len;
+        out[2] = z / len;
+    } else {
+        memcpy(out, fallback, sizeof(float) * 3);
+    }
+}
+
+void convert_vertices(const cgltf_accessor* positions, const cgltf_accessor* normals, const cgltf_accessor* uvs,
+                      const cgltf_accessor* tangents, const float* generated_normals, const float* generated_tangents,
+                      const float node_matrix[16], const float* uv_rect, std::vector<Vertex>& vertices,
+                      float bounds_min[3], float bounds_max[3]) {
+    static const float up[3] = { 0.0f, 1.0f, 0.0f };
+    static const float right[3] = { 1.0f, 0.0f, 0.0f };
+    const float* m = node_matrix;
+    size_t vertex_count = positions->count;
+    vertices.resize(vertex_count);
+
+    for (size_t vi = 0; vi < vertex_count; vi++) {
+        float pos[3] = { 0, 0, 0 };
+        cgltf_accessor_read_float(positions, vi, pos, 3);
+        Vertex& v = vertices[vi];
+        for (int a = 0; a < 3; a++) {
+            v.pos[a] = m[a] * pos[0] + m[4 + a] * pos[1] + m[8 + a] * pos[2] + m[12 + a];
+            bounds_min[a] = std::min(bounds_min[a], v.pos[a]);
+            bounds_max[a] = std::max(bounds_max[a], v.pos[a]);
+        }
+    }
+
+    if (normals || generated_normals) {
+        for (size_t vi = 0; vi < vertex_count; vi++) {
+            float normal[3] = { 0, 1, 0 };
+            if (normals) {
+                cgltf_accessor_read_float(normals, vi, normal, 3);
+            } else {
+                memcpy(normal, &generated_normals[vi * 3], sizeof(normal));
+            }
+            transform_direction(m, normal, up, vertices[vi].normal);
+        }
+    } else {
+        for (Vertex& v : vertices) {
+            memcpy(v.normal, up, sizeof(v.normal));
+        }
+    }
+
+    // UVs, clamped into the atlas rectangle of an atlased material
+    for (size_t vi = 0; vi < vertex_count; vi++) {
+        float uv[2] = { 0, 0 };
+        if (uvs) {
+            cgltf_accessor_read_float(uvs, vi, uv, 2);
+        }
+        if (uv_rect) {
+            uv[0] = uv_rect[0] + std::clamp(uv[0], 0.0f, 1.0f) * uv_rect[2];
+            uv[1] = uv_rect[1] + std::clamp(uv[1], 0.0f, 1.0f) * uv_rect[3];
+        }
+        vertices[vi].uv[0] = uv[0];
+        vertices[vi].uv[1] = uv[1];
+    }
+
+    if (tangents || generated_tangents) {
+        for (size_t vi = 0; vi < vertex_count; vi++) {
+            float tangent[4] = { 1, 0, 0, 1 };
+            if (tangents) {
+                cgltf_accessor_read_float(tangents, vi, tangent, 4);
+            } else {
+                memcpy(tangent, &generated_tangents[vi * 4], sizeof(tangent));
+            }
+            transform_direction(m, tangent, right, vertices[vi].tangent);
+            vertices[vi].tangent[3] = tangent[3];  // Sign for bitangent
+        }
+    } else {
+        // No normal map samples it
+        for (Vertex& v : vertices) {
+            memcpy(v.tangent, right, sizeof(right));
+            v.tangent[3] = 1.0f;
+        }
+    }
+
+    // Unoccluded until the model's occlusion is baked
+    for (Vertex& v : vertices) {
+        v.occlusion = 1.0f;
+    }
+}
+
+void convert_indices(const cgltf_accessor* indices, size_t vertex_count, std::vector<uint32_t>& out) {
+    if (!indices) {
+        out.resize(vertex_count);
+        for (size_t i = 0; i < vertex_count; i++) {
+            out[i] = (uint32_t)i;
+        }
+        return;
+    }
+    out.resize(indices->count);
+    for (size_t i = 0; i < indices->count; i++) {
+        out[i] = (uint32_t)cgltf_accessor_read_index(indices, i);
+    }
+}
+
+// ============================================================================
+// Texture atlas
+// ============================================================================
+
+namespace {
+
+struct SkylineSegment {
+    int x, y, width;
+};
+
+// Lowest y at which a width-wide rect can rest starting at segment i
+int skyline_fit(const std::vector<SkylineSegment>& skyline, size_t i, int width, int atlas_width) {
+    if (skyline[i].x + width > atlas_width) {
+        return -1;
+    }
+    int y = 0;
+    int remaining = width;
+    for (size_t j = i; remaining > 0 && j < skyline.size(); j++) {
+        y = std::max(y, skyline[j].y);
+        remaining -= skyline[j].width;
+    }
+    return y;
+}
+
+void skyline_add(std::vector<SkylineSegment>& skyline, size_t i, int x, int y, int width) {
+    skyline.insert(skyline.begin() + i, { x, y, width });
+    // Trim the segments now covered by the new one
+    for (size_t j = i + 1; j < skyline.size();) {
+        int end = x + width;
+        if (skyline[j].x >= end) {
+            break;
+        }
+        int overlap = end - skyline[j].x;
+        if (overlap >= skyline[j].width) {
+            skyline.erase(skyline.begin() + j);
+        } else {
+            skyline[j].x += overlap;
+            skyline[j].width -= overlap;
+            break;
+        }
+    }
+    for (size_t j = 0; j + 1 < skyline.size();) {
+        if (skyline[j].y == skyline[j + 1].y) {
+            skyline[j].width += skyline[j + 1].width;
+            skyline.erase(skyline.begin() + j + 1);
+        } else {
+            j++;
+        }
+    }
+}
+
+int skyline_pack(std::vector<AtlasRect>& rects, const std::vector<size_t>& order, int padding,
+                 int atlas_width, int atlas_height) {
+    std::vector<SkylineSegment> skyline = { { 0, 0, atlas_width } };
+    int placed = 0;
+    for (size_t r : order) {
+        AtlasRect& rect = rects[r];
+        rect.placed = false;
+        int w = rect.width + padding * 2;
+        int h = rect.height + padding * 2;
+        size_t best = skyline.size();
+        int best_y = 0;
+        for (size_t i = 0; i < skyline.size(); i++) {
+            int y = skyline_fit(skyline, i, w, atlas_width);
+            if (y >= 0 && y + h <= atlas_height && (best == skyline.size() || y < best_y)) {
+                best = i;
+                best_y = y;
+            }
+        }
+        if (best == skyline.size()) {
+            continue;
+        }
+        rect.x = skyline[best].x + padding;
+        rect.y = best_y + padding;
+        rect.placed = true;
+        skyline_add(skyline, best, skyline[best].x, best_y + h, w);
+        placed++;
+    }
+    return placed;
+}
+
+// Source texel for a coordinate past the image edge under a glTF wrap mode
+int wrap_texel(int i, int size, int wrap) {
+    switch (wrap) {
+        case 10497:  // REPEAT
+            return ((i % size) + size) % size;
+        case 33648: {  // MIRRORED_REPEAT
+            int period = size * 2;
+            int m = ((i % period) + period) % period;
+            return m < size ? m : period - 1 - m;
+        }
+        default:  // CLAMP_TO_EDGE
+            return std::min(std::max(i, 0), size - 1);
+    }
+}
+
+} // namespace
+
+int pack_atlas(std::vector<AtlasRect>& rects, int padding, int max_size, int* atlas_width, int* atlas_height) {
+    // Tallest first keeps the skyline flat
+    std::vector<size_t> order(rects.size());
+    size_t area = 0;
+    for (size_t i = 0; i < rects.size(); i++) {
+        order[i] = i;
+        area += (size_t)(rects[i].width + padding * 2) * (rects[i].height + padding * 2);
+    }
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return rects[a].height != rects[b].height ? rects[a].height > rects[b].height : rects[a].width > rects[b].width;
+    });
+
+    // Grow from the smallest power of two that could hold the total area,
+    // doubling width then height, until everything fits or max_size is reached
+    int width = 1, height = 1;
+    while ((size_t)width * height < area && (width < max_size || height < max_size)) {
+        if (width <= height && width < max_size) {
+            width *= 2;
+        } else {
+            height *= 2;
+        }
+    }
+    int placed = 0;
+    for (;;) {
+        placed = skyline_pack(rects, order, padding, width, height);
+        if (placed == (int)rects.size() || (width >= max_size && height >= max_size)) {
+            break;
+        }
+        if (width <= height && width < max_size) {
+            width *= 2;
+        } else {
+            height *= 2;
+        }
+    }
+    *atlas_width = width;
+    *atlas_height = height;
+    return placed;
+}
+
+void blit_atlas_rect(uint8_t* atlas, int atlas_width, const uint8_t* src, const AtlasRect& rect,
+                     int padding, int wrap_s, int wrap_t) {
+    for (int y = -padding; y < rect.height + padding; y++) {
+        int sy = wrap_texel(y, rect.height, wrap_t);
+        uint8_t* dst_row = atlas + ((size_t)(rect.y + y) * atlas_width + rect.x) * 4;
+        const uint8_t* src_row = src + (size_t)sy * rect.width * 4;
+        memcpy(dst_row, src_row, (size_t)rect.width * 4);
+        for (int x = -padding; x < 0; x++) {
+            memcpy(dst_row + x * 4, src_row + wrap_texel(x, rect.width, wrap_s) * 4, 4);
+        }
+        for (int x = rect.width; x < rect.width + padding; x++) {
+            memcpy(dst_row + x * 4, src_row + wrap_texel(x, rect.width, wrap_s) * 4, 4);
+        }
+    }
+}
@@ -0,0 +1,91 @@
+// CPU-side GLTF/GLB/VRM import shared by the viewer and the offline tools
+// (no sokol dependency): UTF-8 file access, cgltf parsing and lookups
+#ifndef IMPORTER_H
+#define IMPORTER_H
+
+#include "cgltf/cgltf.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// UTF-8 file access
+// ============================================================================
+
+bool read_file_utf8(const char* filepath, std::vector<uint8_t>& out_data);
+bool write_file_utf8(const char* filepath, const void* data, size_t size);
+FILE* fopen_utf8(const char* filepath, const char* mode);
+
+// glTF image/buffer URIs are relative to the model file
+std::string resolve_uri_path(const char* base_path, const char* uri);
+
+// ============================================================================
+// GLTF/GLB/VRM
+// ============================================================================
+
+// Parse a GLTF/GLB/VRM file and load its buffers. Returns nullptr and fills
+// error on failure; release the result with cgltf_free().
+cgltf_data* import_gltf(const char* filepath, std::string& error);
+
+// True if the file declares a VRM 0.x or 1.0 extension
+bool is_vrm_data(const cgltf_data* data);
+
+const cgltf_extension* find_extension(const cgltf_extension* extensions, cgltf_size count, const char* name);
+
+// Encoded bytes of an image stored in a buffer view, or nullptr for URI images
+const uint8_t* image_buffer_view_bytes(const cgltf_image* image, size_t* size);
+
+// FNV-1a, used to find byte-identical images and buffer data
+uint64_t hash_bytes(const uint8_t* data, size_t size);
+
+// ============================================================================
+// Vertex and index conversion
+// ============================================================================
+
+// The viewer's vertex layout, uploaded as converted
+struct Vertex {
+    float pos[3];
+    float normal[3];
+    float uv[2];
+    float tangent[4];  // xyz = tangent, w = sign for bitangent
+    float occlusion;   // Baked ambient occlusion, 1 = unoccluded
+};
+
+// World-space vertices of a primitive. node_matrix (column major) moves
+// positions, normals and tangents, which are renormalized. Without an
+// accessor, normals and tangents come from generated_normals (float3) and
+// generated_tangents (float4) if given, else default to +Y and +X. uv_rect
+// (u, v, width, height), if given, maps clamped UVs into an atlas
+// rectangle. Occlusion starts at 1; bounds_min and bounds_max grow to the
+// positions.
+void convert_vertices(const cgltf_accessor* positions, const cgltf_accessor* normals, const cgltf_accessor* uvs,
+                      const cgltf_accessor* tangents, const float* generated_normals, const float* generated_tangents,
+                      const float node_matrix[16], const float* uv_rect, std::vector<Vertex>& vertices,
+                      float bounds_min[3], float bounds_max[3]);
+
+// 32-bit indices of a primitive, or 0..vertex_count-1 if it has none
+void convert_indices(const cgltf_accessor* indices, size_t vertex_count, std::vector<uint32_t>& out);
+
+// ============================================================================
+// Texture atlas
+// ============================================================================
+
+struct AtlasRect {
+    int width, height;  // Content size, padding excluded
+    int x, y;           // Content origin in the atlas, valid when placed
+    bool placed;
+};
+
+// Skyline bottom-left packing into the smallest power-of-two atlas up to
+// max_size. Each rect gets padding texels on every side. Rects that do not
+// fit keep placed = false; returns the number placed.
+int pack_atlas(std::vector<AtlasRect>& rects, int padding, int max_size, int* atlas_width, int* atlas_height);
+
+// Copy an RGBA8 image into an atlas, filling the padding the way a sampler
+// with the given glTF wrap modes reads past the image edges
+void blit_atlas_rect(uint8_t* atlas, int atlas_width, const uint8_t* src, const AtlasRect& rect,
+                     int padding, int wrap_s, int wrap_t);
+
+#endif // IMPORTER_H
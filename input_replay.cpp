@@ -0,0 +1,200 @@
+// Input recording and replay for the viewer
+
+#include "input_replay.h"
+#include "importer.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+struct EventTypeName {
+    sapp_event_type type;
+    const char* name;
+};
+
+const EventTypeName event_type_names[] = {
+    { SAPP_EVENTTYPE_KEY_DOWN, "key_down" },
+    { SAPP_EVENTTYPE_KEY_UP, "key_up" },
+    { SAPP_EVENTTYPE_CHAR, "char" },
+    { SAPP_EVENTTYPE_MOUSE_DOWN, "mouse_down" },
+    { SAPP_EVENTTYPE_MOUSE_UP, "mouse_up" },
+    { SAPP_EVENTTYPE_MOUSE_MOVE, "mouse_move" },
+    { SAPP_EVENTTYPE_MOUSE_SCROLL, "mouse_scroll" },
+    { SAPP_EVENTTYPE_FILES_DROPPED, "drop" },
+};
+
+const char* event_type_name(sapp_event_type type) {
+    for (const EventTypeName& entry : event_type_names) {
+        if (entry.type == type) {
+            return entry.name;
+        }
+    }
+    return nullptr;
+}
+
+bool parse_event(const char* line, RecordedEvent& out) {
+    char name[16];
+    int consumed = 0;
+    if (sscanf(line, "%u %15s %n", &out.frame, name, &consumed) != 2) {
+        return false;
+    }
+    out.event = {};
+    const char* args = line + consumed;
+    sapp_event& ev = out.event;
+    int code = 0, button = 0;
+    unsigned modifiers = 0;
+    if (strcmp(name, "key_down") == 0 || strcmp(name, "key_up") == 0) {
+        ev.type = name[4] == 'd' ? SAPP_EVENTTYPE_KEY_DOWN : SAPP_EVENTTYPE_KEY_UP;
+        if (sscanf(args, "%d %u", &code, &modifiers) != 2) {
+            return false;
+        }
+        ev.key_code = (sapp_keycode)code;
+    } else if (strcmp(name, "char") == 0) {
+        ev.type = SAPP_EVENTTYPE_CHAR;
+        if (sscanf(args, "%u %u", &ev.char_code, &modifiers) != 2) {
+            return false;
+        }
+    } else if (strcmp(name, "mouse_down") == 0 || strcmp(name, "mouse_up") == 0) {
+        ev.type = name[6] == 'd' ? SAPP_EVENTTYPE_MOUSE_DOWN : SAPP_EVENTTYPE_MOUSE_UP;
+        if (sscanf(args, "%d %f %f %u", &button, &ev.mouse_x, &ev.mouse_y, &modifiers) != 4) {
+            return false;
+        }
+        ev.mouse_button = (sapp_mousebutton)button;
+    } else if (strcmp(name, "mouse_move") == 0) {
+        ev.type = SAPP_EVENTTYPE_MOUSE_MOVE;
+        if (sscanf(args, "%f %f %f %f %u", &ev.mouse_x, &ev.mouse_y, &ev.mouse_dx, &ev.mouse_dy, &modifiers) != 5) {
+            return false;
+        }
+    } else if (strcmp(name, "mouse_scroll") == 0) {
+        ev.type = SAPP_EVENTTYPE_MOUSE_SCROLL;
+        if (sscanf(args, "%f %f %f %f %u", &ev.scroll_x, &ev.scroll_y, &ev.mouse_x, &ev.mouse_y, &modifiers) != 5) {
+            return false;
+        }
+    } else if (strcmp(name, "drop") == 0) {
+        ev.type = SAPP_EVENTTYPE_FILES_DROPPED;
+        out.dropped_file = args;
+        return !out.dropped_file.empty();
+    } else {
+        return false;
+    }
+    ev.modifiers = modifiers;
+    return true;
+}
+
+} // namespace
+
+bool input_recording_add(InputRecording& recording, uint32_t frame, const sapp_event& event,
+                         const char* dropped_file) {
+    if (!event_type_name(event.type) || (event.type == SAPP_EVENTTYPE_FILES_DROPPED && !dropped_file)) {
+        return false;
+    }
+    RecordedEvent recorded = { frame, event, {} };
+    if (event.type == SAPP_EVENTTYPE_FILES_DROPPED) {
+        recorded.dropped_file = dropped_file;
+    }
+    recording.events.push_back(std::move(recorded));
+    return true;
+}
+
+bool input_recording_save(const char* path, const InputRecording& recording) {
+    FILE* file = fopen_utf8(path, "wb");
+    if (!file) {
+        return false;
+    }
+    fprintf(file, "vrm_input 1\n");
+    for (const RecordedEvent& recorded : recording.events) {
+        const sapp_event& ev = recorded.event;
+        fprintf(file, "%u %s ", recorded.frame, event_type_name(ev.type));
+        switch (ev.type) {
+            case SAPP_EVENTTYPE_KEY_DOWN:
+            case SAPP_EVENTTYPE_KEY_UP:
+                fprintf(file, "%d %u\n", (int)ev.key_code, ev.modifiers);
+                break;
+            case SAPP_EVENTTYPE_CHAR:
+                fprintf(file, "%u %u\n", ev.char_code, ev.modifiers);
+                break;
+            case SAPP_EVENTTYPE_MOUSE_DOWN:
+            case SAPP_EVENTTYPE_MOUSE_UP:
+                fprintf(file, "%d %g %g %u\n", (int)ev.mouse_button, ev.mouse_x, ev.mouse_y, ev.modifiers);
+                break;
+            case SAPP_EVENTTYPE_MOUSE_MOVE:
+                fprintf(file, "%g %g %g %g %u\n", ev.mouse_x, ev.mouse_y, ev.mouse_dx, ev.mouse_dy, ev.modifiers);
+                break;
+            case SAPP_EVENTTYPE_MOUSE_SCROLL:
+                fprintf(file, "%g %g %g %g %u\n", ev.scroll_x, ev.scroll_y, ev.mouse_x, ev.mouse_y, ev.modifiers);
+                break;
+            default:
+                fprintf(file, "%s\n", recorded.dropped_file.c_str());
+                break;
+        }
+    }
+    fprintf(file, "end %u\n", recording.frames);
+    return fclose(file) == 0;
+}
+
+bool input_recording_load(const char* path, InputRecording& recording, std::string& error) {
+    std::vector<uint8_t> bytes;
+    if (!read_file_utf8(path, bytes)) {
+        error = std::string(path) + ": cannot read file";
+        return false;
+    }
+    recording = InputRecording();
+    std::string text(bytes.begin(), bytes.end());
+    size_t pos = 0;
+    int line_number = 0;
+    bool header = false;
+    bool ended = false;
+    while (pos < text.size()) {
+        size_t end = text.find('\n', pos);
+        if (end == std::string::npos) {
+            end = text.size();
+        }
+        std::string line = text.substr(pos, end - pos);
+        pos = end + 1;
+        line_number++;
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        size_t first = line.find_first_not_of(" \t");
+        if (first == std::string::npos || line[first] == '#') {
+            continue;
+        }
+
+        auto fail = [&](const char* what) {
+            error = std::string(path) + ":" + std::to_string(line_number) + ": " + what;
+            return false;
+        };
+        if (!header) {
+            if (line != "vrm_input 1") {
+                return fail("not a vrm_input 1 file");
+            }
+            header = true;
+            continue;
+        }
+        if (ended) {
+            return fail("entries after end");
+        }
+        if (sscanf(line.c_str(), "end %u", &recording.frames) == 1) {
+            ended = true;
+            continue;
+        }
+        RecordedEvent recorded;
+        if (!parse_event(line.c_str(), recorded)) {
+            return fail("malformed event");
+        }
+        if (!recording.events.empty() && recorded.frame < recording.events.back().frame) {
+            return fail("events out of frame order");
+        }
+        recording.events.push_back(std::move(recorded));
+    }
+    if (!header) {
+        error = std::string(path) + ": empty file";
+        return false;
+    }
+    if (!ended) {
+        // Without an end line, stop with the last event's frame
+        recording.frames = recording.events.empty() ? 0 : recording.events.back().frame + 1;
+    }
+    return true;
+}
@@ -0,0 +1,53 @@
+// Input recording and replay for the viewer: the events event() handles,
+// each stamped with the frame it arrived before, saved as a small text file
+// and replayed at the same frames with a fixed timestep. Two builds replaying
+// one file see the same camera drags, zooms, clicks, key presses and model
+// drops, so their frame timings can be compared.
+//
+// One event per line, "#" starts a comment:
+//
+//   vrm_input 1
+//   <frame> key_down <key_code> <modifiers>
+//   <frame> key_up <key_code> <modifiers>
+//   <frame> char <char_code> <modifiers>
+//   <frame> mouse_down <button> <x> <y> <modifiers>
+//   <frame> mouse_up <button> <x> <y> <modifiers>
+//   <frame> mouse_move <x> <y> <dx> <dy> <modifiers>
+//   <frame> mouse_scroll <scroll_x> <scroll_y> <x> <y> <modifiers>
+//   <frame> drop <path to the end of the line>
+//   end <frames>
+//
+// Without the end line a replay stops after the last event's frame.
+//
+// Codes are sokol_app's (sapp_keycode, sapp_mousebutton, SAPP_MODIFIER_*),
+// so files can also be written by hand or generated.
+#ifndef INPUT_REPLAY_H
+#define INPUT_REPLAY_H
+
+#include "sokol_app.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct RecordedEvent {
+    uint32_t frame;  // Delivered before this frame
+    sapp_event event;
+    std::string dropped_file;  // SAPP_EVENTTYPE_FILES_DROPPED only
+};
+
+struct InputRecording {
+    std::vector<RecordedEvent> events;  // In frame order
+    uint32_t frames = 0;  // Length of the recording; replays run this many frames
+};
+
+// False for event types the viewer ignores (resize, focus, touches, ...)
+bool input_recording_add(InputRecording& recording, uint32_t frame, const sapp_event& event,
+                         const char* dropped_file);
+
+bool input_recording_save(const char* path, const InputRecording& recording);
+
+// error names the file and line of the first malformed entry
+bool input_recording_load(const char* path, InputRecording& recording, std::string& error);
+
+#endif // INPUT_REPLAY_H
@@ -0,0 +1,376 @@
+// Structured logging
+
+#include "log.h"
+#include "importer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Milliseconds the drain thread sleeps between passes
+#define LOG_DRAIN_INTERVAL_MS 5
+
+std::atomic<int> g_log_level{ LOG_INFO };
+
+namespace {
+
+struct LogRecord {
+    uint64_t time_ns;  // steady_clock
+    LogLevel level;
+    char thread[32];  // The lane's name when the record was written
+    int field_count;
+    LogField fields[LOG_MAX_FIELDS];  // STRING fields hold their offset into text in i
+    char text[LOG_TEXT_BYTES];  // Message, then string field values, NUL separated
+};
+
+// One producer (the owning thread) and one consumer (the drain): head and
+// tail count the records ever written and read. in_use hands the lane from
+// one owner to the next; name belongs to the owner.
+struct LogLane {
+    std::vector<LogRecord> records;
+    std::atomic<uint64_t> head{ 0 };
+    std::atomic<uint64_t> tail{ 0 };
+    std::atomic<uint64_t> dropped{ 0 };
+    std::atomic<bool> in_use{ false };
+    uint64_t drain_end = 0;  // head when the current drain began (drain only)
+    char name[32] = {};
+};
+
+// Lanes are never freed. g_lane_count publishes g_lanes[0, count); adding a
+// lane is the only step that locks.
+std::mutex g_add_lane_mutex;
+std::unique_ptr<LogLane> g_lanes[LOG_MAX_LANES];
+std::atomic<int> g_lane_count{ 0 };
+std::atomic<uint64_t> g_dropped_without_lane{ 0 };
+
+// Frees the thread's lane when the thread exits
+struct LaneHandle {
+    LogLane* lane = nullptr;
+
+    ~LaneHandle() {
+        if (lane) {
+            lane->in_use.store(false, std::memory_order_release);
+        }
+    }
+};
+
+thread_local LaneHandle t_lane;
+
+// nullptr when all LOG_MAX_LANES lanes are taken
+LogLane* thread_lane() {
+    if (t_lane.lane) {
+        return t_lane.lane;
+    }
+    int index = -1;
+    int count = g_lane_count.load(std::memory_order_acquire);
+    for (int i = 0; i < count && index < 0; i++) {
+        bool expected = false;
+        if (!g_lanes[i]->in_use.load(std::memory_order_relaxed) &&
+            g_lanes[i]->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            index = i;
+        }
+    }
+    if (index < 0) {
+        std::lock_guard<std::mutex> lock(g_add_lane_mutex);
+        count = g_lane_count.load(std::memory_order_relaxed);
+        if (count == LOG_MAX_LANES) {
+            return nullptr;
+        }
+        g_lanes[count] = std::make_unique<LogLane>();
+        g_lanes[count]->records.resize(LOG_RECORDS_PER_LANE);
+        g_lanes[count]->in_use.store(true, std::memory_order_relaxed);
+        g_lane_count.store(count + 1, std::memory_order_release);
+        index = count;
+    }
+    t_lane.lane = g_lanes[index].get();
+    snprintf(t_lane.lane->name, sizeof(t_lane.lane->name), "thread %d", index);
+    return t_lane.lane;
+}
+
+uint64_t steady_ns() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Copies s into text at offset, truncating to fit; returns the offset after
+// its terminator. Offsets past the end read as the final empty string.
+size_t copy_text(char* text, size_t offset, const char* s) {
+    if (offset >= LOG_TEXT_BYTES) {
+        offset = LOG_TEXT_BYTES - 1;
+    }
+    size_t room = LOG_TEXT_BYTES - 1 - offset;
+    size_t length = 0;
+    while (length < room && s[length]) {
+        length++;
+    }
+    memcpy(text + offset, s, length);
+    text[offset + length] = '\0';
+    return offset + length + 1;
+}
+
+const char* level_name(LogLevel level) {
+    switch (level) {
+        case LOG_DEBUG: return "debug";
+        case LOG_INFO: return "info";
+        case LOG_WARN: return "warn";
+        default: return "error";
+    }
+}
+
+// Drain state, guarded by g_drain_mutex
+std::mutex g_drain_mutex;
+std::string g_console_prefix;
+FILE* g_json_file = nullptr;
+
+// Drain thread
+std::mutex g_wake_mutex;
+std::condition_variable g_wake;
+bool g_running = false;
+std::atomic<bool> g_started{ false };
+std::thread g_drain_thread;
+
+void write_console(const LogRecord& record) {
+    fputs(g_console_prefix.c_str(), stdout);
+    if (record.level != LOG_INFO) {
+        printf("%s: ", record.level == LOG_WARN ? "warning" : level_name(record.level));
+    }
+    fputs(record.text, stdout);
+    for (int i = 0; i < record.field_count; i++) {
+        const LogField& field = record.fields[i];
+        switch (field.type) {
+            case LogField::INT: printf(" %s=%lld", field.key, (long long)field.i); break;
+            case LogField::FLOAT: printf(" %s=%g", field.key, field.f); break;
+            case LogField::STRING: printf(" %s=%s", field.key, record.text + field.i); break;
+        }
+    }
+    fputc('\n', stdout);
+}
+
+void write_json_string(FILE* file, const char* s) {
+    fputc('"', file);
+    for (; *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            fputc('\\', file);
+            fputc(c, file);
+        } else if (c < 0x20) {
+            fprintf(file, "\\u%04x", c);
+        } else {
+            fputc(c, file);
+        }
+    }
+    fputc('"', file);
+}
+
+void write_json(const LogRecord& record, double unix_seconds) {
+    fprintf(g_json_file, "{\"ts\":%.6f,\"level\":\"%s\",\"thread\":", unix_seconds, level_name(record.level));
+    write_json_string(g_json_file, record.thread);
+    fputs(",\"msg\":", g_json_file);
+    write_json_string(g_json_file, record.text);
+    for (int i = 0; i < record.field_count; i++) {
+        const LogField& field = record.fields[i];
+        fputc(',', g_json_file);
+        write_json_string(g_json_file, field.key);
+        fputc(':', g_json_file);
+        switch (field.type) {
+            case LogField::INT: fprintf(g_json_file, "%lld", (long long)field.i); break;
+            case LogField::FLOAT:
+                // JSON has no NaN or infinity
+                if (field.f == field.f && field.f - field.f == 0.0) {
+                    fprintf(g_json_file, "%.17g", field.f);
+                } else {
+                    fputs("null", g_json_file);
+                }
+                break;
+            case LogField::STRING: write_json_string(g_json_file, record.text + field.i); break;
+        }
+    }
+    fputs("}\n", g_json_file);
+}
+
+void drain_loop() {
+    std::unique_lock<std::mutex> lock(g_wake_mutex);
+    while (g_running) {
+        g_wake.wait_for(lock, std::chrono::milliseconds(LOG_DRAIN_INTERVAL_MS));
+        lock.unlock();
+        log_flush();
+        lock.lock();
+    }
+}
+
+// A drain thread still running at exit would terminate the process
+struct LogShutdown {
+    ~LogShutdown() { log_stop(); }
+} g_log_shutdown;
+
+} // namespace
+
+void log_record(LogLevel level, const char* message, std::initializer_list<LogField> fields) {
+    LogLane* lane = thread_lane();
+    uint64_t head = lane ? lane->head.load(std::memory_order_relaxed) : 0;
+    if (!lane) {
+        g_dropped_without_lane.fetch_add(1, std::memory_order_relaxed);
+    } else if (head - lane->tail.load(std::memory_order_acquire) >= LOG_RECORDS_PER_LANE) {
+        lane->dropped.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        LogRecord& record = lane->records[head % LOG_RECORDS_PER_LANE];
+        record.time_ns = steady_ns();
+        record.level = level;
+        memcpy(record.thread, lane->name, sizeof(record.thread));
+        size_t used = copy_text(record.text, 0, message);
+        record.field_count = 0;
+        for (const LogField& field : fields) {
+            if (record.field_count == LOG_MAX_FIELDS) {
+                break;
+            }
+            LogField& out = record.fields[record.field_count++];
+            out = field;
+            if (field.type == LogField::STRING) {
+                out.i = (int64_t)std::min(used, (size_t)LOG_TEXT_BYTES - 1);
+                used = copy_text(record.text, used, field.s ? field.s : "");
+            }
+        }
+        lane->head.store(head + 1, std::memory_order_release);
+    }
+    if (!g_started.load(std::memory_order_acquire)) {
+        log_flush();
+    }
+}
+
+void log_set_level(LogLevel level) {
+    g_log_level.store(level, std::memory_order_relaxed);
+}
+
+LogLevel log_get_level() {
+    return (LogLevel)g_log_level.load(std::memory_order_relaxed);
+}
+
+const char* log_level_name(LogLevel level) {
+    return level_name(level);
+}
+
+bool log_parse_level(const char* name, LogLevel& out) {
+    for (int level = LOG_DEBUG; level <= LOG_ERROR; level++) {
+        if (strcmp(name, level_name((LogLevel)level)) == 0) {
+            out = (LogLevel)level;
+            return true;
+        }
+    }
+    return false;
+}
+
+void log_start(const char* console_prefix) {
+    {
+        std::lock_guard<std::mutex> lock(g_drain_mutex);
+        g_console_prefix = console_prefix;
+    }
+    std::lock_guard<std::mutex> lock(g_wake_mutex);
+    if (g_running) {
+        return;
+    }
+    g_running = true;
+    g_drain_thread = std::thread(drain_loop);
+    g_started.store(true, std::memory_order_release);
+}
+
+void log_stop() {
+    {
+        std::lock_guard<std::mutex> lock(g_wake_mutex);
+        if (!g_running) {
+            return;
+        }
+        g_running = false;
+    }
+    g_wake.notify_one();
+    g_drain_thread.join();
+    g_started.store(false, std::memory_order_release);
+    log_flush();
+
+    std::lock_guard<std::mutex> lock(g_drain_mutex);
+    if (g_json_file) {
+        fclose(g_json_file);
+        g_json_file = nullptr;
+    }
+}
+
+// Merges the lanes' pending records by time, in place, so a drain never
+// allocates. Takes no lane lock: threads claim, free and write lanes while
+// it runs.
+void log_flush() {
+    std::lock_guard<std::mutex> drain_lock(g_drain_mutex);
+    int lane_count = g_lane_count.load(std::memory_order_acquire);
+    uint64_t dropped = g_dropped_without_lane.exchange(0, std::memory_order_relaxed);
+    for (int l = 0; l < lane_count; l++) {
+        LogLane& lane = *g_lanes[l];
+        lane.drain_end = lane.head.load(std::memory_order_acquire);
+        dropped += lane.dropped.exchange(0, std::memory_order_relaxed);
+    }
+    uint64_t now_steady = steady_ns();
+    double now_unix = std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+    bool wrote = false;
+    for (;;) {
+        LogLane* next = nullptr;
+        uint64_t next_time = 0;
+        for (int l = 0; l < lane_count; l++) {
+            LogLane* lane = g_lanes[l].get();
+            uint64_t tail = lane->tail.load(std::memory_order_relaxed);
+            if (tail < lane->drain_end) {
+                uint64_t time = lane->records[tail % LOG_RECORDS_PER_LANE].time_ns;
+                if (!next || time < next_time) {
+                    next = lane;
+                    next_time = time;
+                }
+            }
+        }
+        if (!next) {
+            break;
+        }
+        uint64_t tail = next->tail.load(std::memory_order_relaxed);
+        const LogRecord& record = next->records[tail % LOG_RECORDS_PER_LANE];
+        write_console(record);
+        if (g_json_file) {
+            write_json(record, now_unix - (double)(now_steady - record.time_ns) * 1e-9);
+        }
+        next->tail.store(tail + 1, std::memory_order_release);
+        wrote = true;
+    }
+    if (dropped > 0) {
+        printf("%swarning: %llu log record(s) dropped, a ring was full or no lane was free\n", g_console_prefix.c_str(),
+               (unsigned long long)dropped);
+        wrote = true;
+    }
+    if (wrote) {
+        fflush(stdout);
+        if (g_json_file) {
+            fflush(g_json_file);
+        }
+    }
+}
+
+bool log_open_json(const char* path) {
+    FILE* file = fopen_utf8(path, "wb");
+    if (!file) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(g_drain_mutex);
+    if (g_json_file) {
+        fclose(g_json_file);
+    }
+    g_json_file = file;
+    return true;
+}
+
+// Records copy the name when written, so the drain never reads it
+void log_set_thread_name(const char* name) {
+    LogLane* lane = thread_lane();
+    if (lane) {
+        snprintf(lane->name, sizeof(lane->name), "%s", name);
+    }
+}
@@ -0,0 +1,112 @@
+// Structured logging (no sokol dependency): a record is a level, a message
+// and up to LOG_MAX_FIELDS key/value fields. log_write() copies it into the
+// calling thread's ring buffer without locking or allocating, and a
+// background thread started by log_start() drains the rings in time order
+// to the console and, optionally, a JSON-lines file. Records below the
+// level set with log_set_level() cost one relaxed atomic load.
+//
+// Rings belong to lanes like trace.h's, since parallel-util threads come
+// and go: a thread takes a free lane on its first record and gives it back
+// on exit, each with one atomic flag operation; only growing the lane table
+// locks, and the drain never blocks a logging thread. A full ring, or a
+// thread finding all LOG_MAX_LANES lanes taken, drops records and counts
+// them rather than block.
+// Without log_start() every record is written out before log_write()
+// returns, so tools and early startup need no setup.
+#ifndef LOG_H
+#define LOG_H
+
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+
+#define LOG_MAX_FIELDS 6
+#define LOG_TEXT_BYTES 240  // Message and string field values, truncated to fit
+#define LOG_RECORDS_PER_LANE 1024
+#define LOG_MAX_LANES 256  // Threads logging at once
+
+enum LogLevel {
+    LOG_DEBUG,
+    LOG_INFO,
+    LOG_WARN,
+    LOG_ERROR,
+};
+
+struct LogField {
+    enum Type : uint8_t { INT, FLOAT, STRING };
+
+    const char* key;  // Must outlive the log (string literals)
+    Type type;
+    union {
+        int64_t i;
+        double f;
+        const char* s;  // Copied by log_write()
+    };
+};
+
+inline LogField log_int(const char* key, int64_t value) {
+    LogField field;
+    field.key = key;
+    field.type = LogField::INT;
+    field.i = value;
+    return field;
+}
+
+inline LogField log_float(const char* key, double value) {
+    LogField field;
+    field.key = key;
+    field.type = LogField::FLOAT;
+    field.f = value;
+    return field;
+}
+
+inline LogField log_str(const char* key, const char* value) {
+    LogField field;
+    field.key = key;
+    field.type = LogField::STRING;
+    field.s = value;
+    return field;
+}
+
+extern std::atomic<int> g_log_level;
+
+inline bool log_enabled(LogLevel level) {
+    return (int)level >= g_log_level.load(std::memory_order_relaxed);
+}
+
+void log_record(LogLevel level, const char* message, std::initializer_list<LogField> fields);
+
+// Fields beyond LOG_MAX_FIELDS are dropped
+inline void log_write(LogLevel level, const char* message, std::initializer_list<LogField> fields = {}) {
+    if (log_enabled(level)) {
+        log_record(level, message, fields);
+    }
+}
+
+// Default LOG_INFO; may change at any time, from any thread
+void log_set_level(LogLevel level);
+LogLevel log_get_level();
+
+// "debug", "info", "warn" or "error"
+const char* log_level_name(LogLevel level);
+
+// "debug", "info", "warn" or "error"
+bool log_parse_level(const char* name, LogLevel& out);
+
+// Start the drain thread; console lines begin with console_prefix
+void log_start(const char* console_prefix);
+
+// Write everything logged so far, stop the drain thread and close the
+// JSON-lines file. Logging afterwards is synchronous again.
+void log_stop();
+
+// Write everything logged before the call
+void log_flush();
+
+// Also write every record as one JSON object per line
+bool log_open_json(const char* path);
+
+// Thread label in JSON records (default "thread <lane>")
+void log_set_thread_name(const char* name);
+
+#endif // LOG_H
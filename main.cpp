@@ -11,9 +11,23 @@
 
 // GUI (Clay-based, compiled as C)
 #include "gui.h"
+#include "input_replay.h"
+#ifdef VRM_VIEWER_HEADLESS
+#include "headless.h"
+#endif
 
-#define CGLTF_IMPLEMENTATION
-#include "cgltf/cgltf.h"
+// GLTF/VRM import (cgltf, shared with the offline tools)
+#include "importer.h"
+#include "alloc_track.h"
+#include "bench_report.h"
+#include "bvh.h"
+#include "clustered.h"
+#include "geometry.h"
+#include "ibl.h"
+#include "model_cache.h"
+#include "log.h"
+#include "trace.h"
+#include "viewer_options.h"
 
 #include "nlohmann/json.hpp"
 
@@ -21,23 +35,23 @@
 #define USE_VRMC_VRM_1_0
 #include <VRMC/VRM.h>
 
-#define STBI_WINDOWS_UTF8
 #include "stb_image.h"
 
 #include <vector>
 #include <string>
 #include <cstdio>
+#include <cstdlib>
+#include <cstdarg>
 #include <cmath>
-#include <random>
 #include <thread>
+#include <unordered_map>
+#include <map>
+#include <tuple>
+#include <cstring>
+#include <algorithm>
+#include <chrono>
 #include "parallel-util.hpp"
 
-#ifdef _WIN32
-#define WIN32_LEAN_AND_MEAN
-#define NOMINMAX
-#include <windows.h>
-#endif
-
 // ============================================================================
 // Shader (generated by sokol-shdc)
 // ============================================================================
@@ -50,11 +64,11 @@
 // Mesh structure for rendering
 // ============================================================================
 
-struct Vertex {
-    float pos[3];
-    float normal[3];
-    float uv[2];
-    float tangent[4];  // xyz = tangent, w = sign for bitangent
+// Optional MToon textures, each one selects the textured toon shader variant
+enum {
+    MTOON_FEATURE_SHADE_TEXTURE = 1 << 0,
+    MTOON_FEATURE_RIM_TEXTURE = 1 << 1,
+    MTOON_FEATURE_MATCAP_TEXTURE = 1 << 2,
 };
 
 struct PBRMaterial {
@@ -75,30 +89,224 @@ struct PBRMaterial {
     HMM_Vec3 emissive_factor;
     
     bool is_vrm;  // Use toon shader for VRM models
-    float toon_ramp_steps;
-    float toon_rim_power;
-    float toon_rim_strength;
+    
+    // MToon (toon shader only)
+    sg_image shade_multiply_tex;
+    sg_view shade_multiply_view;
+    sg_image rim_multiply_tex;
+    sg_view rim_multiply_view;
+    sg_image matcap_tex;
+    sg_view matcap_view;
+    int toon_material_index;  // Row in Model::toon_materials
+    uint32_t mtoon_features;  // MTOON_FEATURE_* bits
+};
+
+// VRM first-person mesh annotation (0.x firstPersonFlag / 1.0 firstPerson type)
+enum FirstPersonFlag {
+    FIRST_PERSON_BOTH,
+    FIRST_PERSON_THIRD_PERSON_ONLY,
+    FIRST_PERSON_FIRST_PERSON_ONLY,
+    FIRST_PERSON_AUTO,
 };
 
 struct RenderMesh {
-    sg_buffer vertex_buffer;
+    sg_buffer vertex_buffer;  // Owned by Model::vertex_buffers
     sg_buffer index_buffer;
     int num_indices;
     bool has_indices;
     int num_vertices;
-    PBRMaterial material;
+    int material_index;  // Into Model::materials
+
+    // First-person visibility. For split Auto meshes the head-weighted
+    // triangles are moved behind the first first_person_index_count indices.
+    FirstPersonFlag first_person;
+    int first_person_index_count;
+
+    // Shown in the inspection panel when picked
+    std::string source;  // Primitives merged into this draw
+    std::string material_name;  // Of the first merged primitive
+};
+
+// GPU texture shared by deduplicated materials. Every unique material that
+// samples it holds one reference; the last release destroys it.
+struct TextureRef {
+    sg_image image;
+    sg_view view;
+    int ref_count;
+};
+
+// Which shader variants sample an image
+enum {
+    TEXTURE_USE_PBR = 1 << 0,
+    TEXTURE_USE_TOON = 1 << 1,
+};
+
+// Texture roles, each with its own import resolution cap
+enum TextureRole {
+    TEXTURE_ROLE_BASE_COLOR,
+    TEXTURE_ROLE_METALLIC_ROUGHNESS,
+    TEXTURE_ROLE_NORMAL,
+    TEXTURE_ROLE_OCCLUSION,
+    TEXTURE_ROLE_EMISSIVE,
+    TEXTURE_ROLE_MTOON,  // Shade, rim and matcap
+    TEXTURE_ROLE_COUNT,
+};
+
+static const char* texture_role_names[TEXTURE_ROLE_COUNT] = {
+    "Base", "MetalRough", "Normal", "Occlusion", "Emissive", "MToon",
+};
+
+// Import-time texture limits. Images are halved during decode until they fit
+// the cap of their most demanding role, then the largest ones are halved
+// further until the model fits the memory budget.
+struct TextureImportSettings {
+    int max_size[TEXTURE_ROLE_COUNT];
+    size_t budget_bytes;
+    int min_size;  // Budget reduction stops at this size
+    int atlas_source_max;  // Larger base color images are never atlased, 0 disables atlasing
+    int atlas_padding;     // Texels around each atlased image
+};
+
+// Import-time per-vertex ambient occlusion, multiplied into the ambient
+// term of both shaders. Rays reach distance_fraction of the model's bounds
+// diagonal.
+struct OcclusionBakeSettings {
+    int rays;  // Per vertex, 0 disables baking
+    float distance_fraction;
+};
+
+// Staging rig of point and spot lights placed around the model (GUI). Range
+// is a fraction of the model radius; intensity is the brightness at half the
+// radius from a light.
+struct StagingLights {
+    int count;
+    float intensity;
+    float range_fraction;
+    bool animate;  // Orbit the model over time
+};
+
+// Image only the inactive shader samples: handles are allocated at load and
+// the encoded bytes kept until a shader switch needs the decoded texture
+struct PendingTexture {
+    sg_image image;
+    sg_view view;
+    uint32_t uses;  // TEXTURE_USE_* bits
+    int skip_mips;  // Halvings applied during decode
+    std::vector<uint8_t> bytes;
+};
+
+// Label/value line of the inspection panel
+struct InspectRow {
+    char label[24];
+    char value[64];
+};
+
+// Chosen import resolution of one texture, shown in the stats panel
+struct TextureStat {
+    int source_width, source_height;
+    int width, height;
+    char label[32];
+    char value[48];
+};
+
+// Base color images packed into one atlas at import. Materials that differ
+// only in their base color image then deduplicate into one, and primitives of
+// a mesh sharing it are drawn together.
+struct TextureAtlas {
+    std::vector<AtlasRect> rects;
+    std::vector<size_t> rect_images;     // Source glTF image of each rect
+    std::vector<int> image_rects;        // Per glTF image: rect index or -1
+    std::vector<int> material_rects;     // Per glTF material: rect of its base color image or -1
+    std::vector<int> wrap_s, wrap_t;     // Per rect, from the base color sampler
+    int width, height;
+};
+
+// Attributes generated for a glTF primitive that lacks them, in object space
+struct GeneratedAttributes {
+    std::vector<float> normals;   // float3 per vertex, empty when the primitive has normals
+    std::vector<float> tangents;  // float4 per vertex, empty when not generated
 };
 
+// CPU-side draw awaiting upload: indices into a vertex pool, the converted
+// vertices shared by primitives that read the same accessors. Indices list
+// the first-person range first, followed by the head triangles hidden in
+// first-person view.
+struct MeshBatch {
+    int pool;
+    int scope;  // Merge scope: node index, or -1 for static primitives merged model-wide
+    std::vector<uint32_t> indices;
+    int first_person_index_count;
+    FirstPersonFlag first_person;
+    int material_index;
+    std::vector<std::string> sources;  // "node#primitive" of each merged primitive
+    std::string material_name;
+};
+
+// One row of the toon storage buffer. The shader struct's alignment
+// attribute would be dropped as a std::vector argument; wrapping it keeps
+// both the alignment and the tight row stride.
+struct ToonMaterialRow {
+    toon_toon_material_t params;
+};
+static_assert(sizeof(ToonMaterialRow) == sizeof(toon_toon_material_t), "toon rows must stay tightly packed");
+
 struct Model {
     std::vector<RenderMesh> meshes;
+    std::vector<sg_buffer> vertex_buffers;  // Shared by the meshes drawing from them
+    std::vector<PBRMaterial> materials;  // Deduplicated by content
+    std::unordered_map<uint32_t, TextureRef> textures;  // Keyed by sg_image id, defaults excluded
+    std::vector<PendingTexture> pending_textures;
+    std::vector<TextureStat> texture_stats;  // Largest first
+    size_t texture_bytes;  // RGBA8 footprint of all textures at their import resolution
     HMM_Vec3 center;
     float radius;
+    
+    // Packed toon/MToon parameters, one row per material, read by the toon
+    // shaders from a storage buffer indexed per draw
+    std::vector<ToonMaterialRow> toon_materials;
+    sg_buffer toon_material_buffer;
+    sg_view toon_material_view;
+
+    // First-person camera (VRM only)
+    bool has_first_person;
+    HMM_Vec3 head_position;
+    float forward_azimuth;  // Camera azimuth looking along the avatar's forward axis
+    int num_triangles;
+    int num_head_triangles;  // Triangles hidden in first-person view
+
+    // All draws in world space, for picking. Triangles are numbered by draw:
+    // mesh i owns [draw_first_triangle[i], draw_first_triangle[i + 1]).
+    // The BVH is built from triangle_positions and triangle_indices by the
+    // occlusion bake or the first pick, whichever needs it first, and the
+    // triangles are then released.
+    Bvh bvh;
+    bool bvh_built;
+    std::vector<float> triangle_positions;
+    std::vector<uint32_t> triangle_indices;
+    std::vector<uint32_t> draw_first_triangle;
 };
 
 // ============================================================================
 // Global state
 // ============================================================================
 
+// Frames after the last input or model load until frame() is expected to
+// stop allocating
+#define STEADY_FRAME_WARMUP 3
+
+// sokol-gfx pool sizes. sokol's default of 128 each is too small for a
+// model with a few hundred draws or textures. The largest vrm_synth presets
+// ("textures" and "huge", 200 draws and 200 textures each) keep 408
+// buffers, 209 images and 213 views alive, so these leave about twofold
+// headroom.
+#define GFX_BUFFER_POOL_SIZE 1024
+#define GFX_IMAGE_POOL_SIZE 512
+#define GFX_VIEW_POOL_SIZE 512
+
+// Statistics that change every frame refresh in the GUI this often; every
+// change lays the retained panel out and records it again
+#define GUI_STATS_REFRESH_SECONDS 0.5f
+
 static struct {
     // Old simple pipeline
     sg_pipeline pip;
@@ -107,8 +315,14 @@ static struct {
     // PBR pipelines
     sg_pipeline pbr_pip;
     sg_pipeline toon_pip;
+    sg_pipeline mtoon_pip;  // Toon variant with shade/rim/matcap textures
     sg_pipeline skybox_pip;
     
+    // Same shaders adding the clustered point/spot lights, used while any exist
+    sg_pipeline pbr_clustered_pip;
+    sg_pipeline toon_clustered_pip;
+    sg_pipeline mtoon_clustered_pip;
+    
     // Default textures
     sg_image default_texture;
     sg_view default_texture_view;
@@ -131,21 +345,46 @@ static struct {
     sg_buffer skybox_vertex_buffer;
     sg_buffer skybox_index_buffer;
     
+    // Scene point/spot lights, binned into froxels every frame and streamed
+    // to the clustered shaders
+    StagingLights staging_lights;
+    std::vector<PunctualLight> lights;
+    ClusterGrid light_grid;
+    ClusterStats light_stats;
+    ClusterStats shown_light_stats;  // In the GUI, refreshed every GUI_STATS_REFRESH_SECONDS
+    float light_stats_shown_time;
+    sg_buffer light_buffer;
+    sg_view light_view;
+    sg_buffer light_cluster_buffer;
+    sg_view light_cluster_view;
+    sg_buffer light_index_buffer;
+    sg_view light_index_view;
+    
     Model model;
     bool model_loaded;
     bool is_vrm_model;
     bool use_toon_shader;  // Manual override for shader selection
+    TextureImportSettings texture_import;
+    OcclusionBakeSettings occlusion_bake;
     
     // Camera
     float cam_distance;
     float cam_azimuth;
     float cam_elevation;
     HMM_Vec3 cam_target;
-    
+    bool first_person;  // View from the avatar's head, hiding head geometry
+    HMM_Mat4 view_proj;  // Of the last frame, to unproject clicks
+
     // Input
     bool mouse_down;
     float last_mouse_x;
     float last_mouse_y;
+    float press_x, press_y;  // Where the left button went down; releasing nearby is a click
+
+    // Picking: the draw under the last click, described in the inspection panel
+    int picked_mesh;  // -1 when nothing is picked
+    InspectRow pick_rows[GUI_MAX_PICK_ROWS];
+    int pick_row_count;
     
     // Animation
     float time;
@@ -166,6 +405,44 @@ static struct {
     float toon_rim_threshold;
     float toon_rim_softness;
     float toon_spec_intensity;
+
+    // Command line and environment, read by init and each model load
+    ViewerOptions options;
+
+    // Timeline capture, written as Chrome trace JSON when it stops
+    std::string trace_path;
+
+    // Heap allocations (VRM_VIEWER_ALLOC_TRACKING builds): the last frame's,
+    // frames since the last input or load, and the stats panel rows
+    uint64_t frame_alloc_count;
+    uint64_t frame_alloc_bytes;
+    int steady_frames;
+    bool steady_alloc_reported;  // A steady frame allocated; logged once
+    InspectRow alloc_rows[GUI_MAX_ALLOC_ROWS];
+
+    // Submitted by the last frame's model pass
+    int frame_draws;
+    uint64_t frame_triangles;
+
+    // Errors sokol-gfx has logged, such as exhausted resource pools
+    uint32_t gfx_errors;
+
+    // The last load_model call
+    double load_ms;
+    bool load_failed;
+
+    // Input recording and replay, timed into a benchmark report when
+    // options.bench_path names one
+    uint32_t frame_index;  // Frames run since init
+    InputRecording recording;  // Being recorded or replayed
+    std::string record_path;
+    bool replaying;
+    size_t replay_next;  // Next recorded event to deliver
+    std::string replay_name;  // The replay file's base name, for benchmark names
+    std::string bench_path;
+    bool bench_failed;
+    std::vector<double> replay_frame_ms;
+    std::vector<double> replay_input_ms;
 } state;
 
 // ============================================================================
@@ -173,70 +450,14 @@ static struct {
 // ============================================================================
 
 static void log_message(const char* msg) {
-    printf("[VRM Viewer] %s\n", msg);
-}
-
-// ============================================================================
-// UTF-8 file reading support for Windows
-// ============================================================================
-
-#ifdef _WIN32
-static std::wstring utf8_to_wstring(const char* utf8_str) {
-    if (!utf8_str || !*utf8_str) return L"";
-    int len = MultiByteToWideChar(CP_UTF8, 0, utf8_str, -1, nullptr, 0);
-    if (len <= 0) return L"";
-    std::wstring result(len - 1, L'\0');
-    MultiByteToWideChar(CP_UTF8, 0, utf8_str, -1, &result[0], len);
-    return result;
-}
-
-static bool read_file_utf8(const char* filepath, std::vector<uint8_t>& out_data) {
-    std::wstring wpath = utf8_to_wstring(filepath);
-    HANDLE hFile = CreateFileW(wpath.c_str(), GENERIC_READ, FILE_SHARE_READ, 
-                               nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
-    if (hFile == INVALID_HANDLE_VALUE) {
-        return false;
-    }
-    
-    LARGE_INTEGER fileSize;
-    if (!GetFileSizeEx(hFile, &fileSize)) {
-        CloseHandle(hFile);
-        return false;
-    }
-    
-    out_data.resize((size_t)fileSize.QuadPart);
-    DWORD bytesRead;
-    BOOL success = ReadFile(hFile, out_data.data(), (DWORD)fileSize.QuadPart, &bytesRead, nullptr);
-    CloseHandle(hFile);
-    
-    return success && bytesRead == fileSize.QuadPart;
-}
-
-static FILE* fopen_utf8(const char* filepath, const char* mode) {
-    std::wstring wpath = utf8_to_wstring(filepath);
-    std::wstring wmode = utf8_to_wstring(mode);
-    return _wfopen(wpath.c_str(), wmode.c_str());
-}
-#else
-static bool read_file_utf8(const char* filepath, std::vector<uint8_t>& out_data) {
-    FILE* f = fopen(filepath, "rb");
-    if (!f) return false;
-    
-    fseek(f, 0, SEEK_END);
-    long size = ftell(f);
-    fseek(f, 0, SEEK_SET);
-    
-    out_data.resize(size);
-    size_t read = fread(out_data.data(), 1, size, f);
-    fclose(f);
-    
-    return read == (size_t)size;
+    log_write(LOG_INFO, msg);
 }
 
-static FILE* fopen_utf8(const char* filepath, const char* mode) {
-    return fopen(filepath, mode);
+// "1234 allocs, 56.7 MB, peak 8.9 MB" for the stats panel
+static void format_alloc_stats(char* out, size_t size, uint64_t count, uint64_t bytes, uint64_t peak_bytes) {
+    snprintf(out, size, "%llu allocs, %.1f MB, peak %.1f MB", (unsigned long long)count,
+             bytes / (1024.0 * 1024.0), peak_bytes / (1024.0 * 1024.0));
 }
-#endif
 
 static sg_view create_texture_view(sg_image img, int num_mips = 1) {
     sg_view_desc view_desc = {};
@@ -259,431 +480,134 @@ static sg_image create_default_white_texture() {
     return sg_make_image(&desc);
 }
 
-static sg_image load_texture_from_buffer(const uint8_t* data, size_t size) {
-    int width, height, channels;
-    stbi_set_flip_vertically_on_load(0);
-    uint8_t* pixels = stbi_load_from_memory(data, (int)size, &width, &height, &channels, 4);
-    if (!pixels) {
-        log_message("Failed to load texture from buffer");
-        return state.default_texture;
+// One mip step down with a 2x2 box filter (odd edges clamp)
+static void downsample_rgba8(const uint8_t* src, int width, int height, std::vector<uint8_t>& dst,
+                             int& out_width, int& out_height) {
+    out_width = HMM_MAX(width / 2, 1);
+    out_height = HMM_MAX(height / 2, 1);
+    dst.resize((size_t)out_width * out_height * 4);
+    int dst_width = out_width;
+    parallelutil::parallel_for(out_height, [&](int y) {
+        int y0 = HMM_MIN(y * 2, height - 1);
+        int y1 = HMM_MIN(y * 2 + 1, height - 1);
+        for (int x = 0; x < dst_width; x++) {
+            int x0 = HMM_MIN(x * 2, width - 1);
+            int x1 = HMM_MIN(x * 2 + 1, width - 1);
+            for (int c = 0; c < 4; c++) {
+                int sum = src[((size_t)y0 * width + x0) * 4 + c] + src[((size_t)y0 * width + x1) * 4 + c] +
+                          src[((size_t)y1 * width + x0) * 4 + c] + src[((size_t)y1 * width + x1) * 4 + c];
+                dst[((size_t)y * dst_width + x) * 4 + c] = (uint8_t)((sum + 2) / 4);
+            }
+        }
+    });
+}
+
+// Upload RGBA8 pixels into an image from sg_alloc_image(), halving
+// skip_mips times first
+static void init_texture_from_rgba8(sg_image img, const uint8_t* pixels, int width, int height, int skip_mips) {
+    std::vector<uint8_t> scaled[2];
+    const uint8_t* level = pixels;
+    for (int i = 0; i < skip_mips && (width > 1 || height > 1); i++) {
+        std::vector<uint8_t>& dst = scaled[i & 1];
+        downsample_rgba8(level, width, height, dst, width, height);
+        level = dst.data();
     }
-    
+
     sg_image_desc desc = {};
     desc.width = width;
     desc.height = height;
-    desc.data.mip_levels[0] = { pixels, (size_t)(width * height * 4) };
-    sg_image img = sg_make_image(&desc);
-    
-    stbi_image_free(pixels);
-    return img;
+    desc.data.mip_levels[0] = { level, (size_t)width * height * 4 };
+    sg_init_image(img, &desc);
 }
 
-static sg_image load_texture_from_file(const char* base_path, const char* uri) {
-    // Build full path
-    std::string path = base_path;
-    size_t last_slash = path.find_last_of("/\\");
-    if (last_slash != std::string::npos) {
-        path = path.substr(0, last_slash + 1);
-    } else {
-        path = "";
-    }
-    path += uri;
-    
-    // Read file with UTF-8 support
-    std::vector<uint8_t> file_data;
-    if (!read_file_utf8(path.c_str(), file_data)) {
-        log_message(("Failed to read texture file: " + path).c_str());
-        return state.default_texture;
-    }
-    
+// Decode into an image from sg_alloc_image(), halving skip_mips times to
+// honour the import caps. Undecodable data falls back to white, like the
+// default texture.
+static void init_texture_from_buffer(sg_image img, const uint8_t* data, size_t size, int skip_mips) {
+    TRACE_ZONE("decode texture");
     int width, height, channels;
     stbi_set_flip_vertically_on_load(0);
-    uint8_t* pixels = stbi_load_from_memory(file_data.data(), (int)file_data.size(), &width, &height, &channels, 4);
-    if (!pixels) {
-        log_message(("Failed to decode texture: " + path).c_str());
-        return state.default_texture;
-    }
-    
+    uint8_t* pixels = stbi_load_from_memory(data, (int)size, &width, &height, &channels, 4);
     sg_image_desc desc = {};
-    desc.width = width;
-    desc.height = height;
-    desc.data.mip_levels[0] = { pixels, (size_t)(width * height * 4) };
-    sg_image img = sg_make_image(&desc);
-    
-    stbi_image_free(pixels);
-    log_message(("Loaded texture: " + path).c_str());
-    return img;
-}
-
-// ============================================================================
-// HDR Loading and IBL (using HandmadeMath for vector operations)
-// ============================================================================
-
-// Sample equirectangular HDR texture with bilinear filtering
-// dir: normalized direction vector in world space
-static HMM_Vec3 sample_equirectangular(const float* hdr_data, int width, int height, HMM_Vec3 dir) {
-    // Convert direction to spherical coordinates
-    // theta: polar angle from +Y axis (0 = top, PI = bottom)
-    // phi: azimuthal angle around Y axis
-    float theta = acosf(HMM_Clamp(-1.0f, dir.Y, 1.0f));  // [0, PI]
-    float phi = atan2f(dir.X, -dir.Z);  // [-PI, PI], note: -Z is forward
-    
-    // Convert to UV coordinates
-    float u = (phi + HMM_PI32) / (2.0f * HMM_PI32);  // [0, 1]
-    float v = theta / HMM_PI32;  // [0, 1]
-    
-    // Bilinear filtering with proper wrap/clamp
-    float px = u * width - 0.5f;
-    float py = v * height - 0.5f;
-    
-    // Wrap helper for horizontal (longitude wraps around)
-    auto wrap_x = [width](int x) -> int {
-        return ((x % width) + width) % width;
-    };
-    
-    // Clamp helper for vertical (latitude clamps at poles)
-    auto clamp_y = [height](int y) -> int {
-        return HMM_Clamp(0, y, height - 1);
-    };
-    
-    int x0 = (int)floorf(px);
-    int y0 = (int)floorf(py);
-    int x1 = x0 + 1;
-    int y1 = y0 + 1;
-    
-    float fx = px - x0;
-    float fy = py - y0;
-    
-    // Sample 4 pixels with wrap/clamp
-    auto sample_pixel = [&](int x, int y) -> HMM_Vec3 {
-        int sx = wrap_x(x);
-        int sy = clamp_y(y);
-        int idx = (sy * width + sx) * 3;
-        return HMM_V3(hdr_data[idx], hdr_data[idx + 1], hdr_data[idx + 2]);
-    };
-    
-    HMM_Vec3 c00 = sample_pixel(x0, y0);
-    HMM_Vec3 c10 = sample_pixel(x1, y0);
-    HMM_Vec3 c01 = sample_pixel(x0, y1);
-    HMM_Vec3 c11 = sample_pixel(x1, y1);
-    
-    // Bilinear interpolation using HMM_LerpV3
-    HMM_Vec3 c0 = HMM_LerpV3(c00, fx, c10);
-    HMM_Vec3 c1 = HMM_LerpV3(c01, fx, c11);
-    return HMM_LerpV3(c0, fy, c1);
-}
-
-// Get cubemap face direction from face index and UV coordinates
-// UV is in [-1, 1] range, returns normalized direction vector
-static HMM_Vec3 get_cubemap_direction(int face, float u, float v) {
-    HMM_Vec3 dir;
-    switch (face) {
-        case 0: dir = HMM_V3( 1.0f, -v, -u); break;  // +X
-        case 1: dir = HMM_V3(-1.0f, -v,  u); break;  // -X
-        case 2: dir = HMM_V3( u,  1.0f,  v); break;  // +Y
-        case 3: dir = HMM_V3( u, -1.0f, -v); break;  // -Y
-        case 4: dir = HMM_V3( u, -v,  1.0f); break;  // +Z
-        case 5: dir = HMM_V3(-u, -v, -1.0f); break;  // -Z
-        default: dir = HMM_V3(0, 0, 1); break;
+    if (!pixels) {
+        log_write(LOG_WARN, "Failed to load texture from buffer");
+        static const uint32_t white[4] = { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF };
+        desc.width = 2;
+        desc.height = 2;
+        desc.data.mip_levels[0] = { white, sizeof(white) };
+        sg_init_image(img, &desc);
+        return;
     }
-    return HMM_NormV3(dir);
-}
-
-// Build orthonormal tangent space basis from normal vector
-static void build_tangent_space(HMM_Vec3 N, HMM_Vec3* T, HMM_Vec3* B) {
-    // Choose an up vector that's not parallel to N
-    HMM_Vec3 up = (fabsf(N.Y) < 0.999f) ? HMM_V3(0, 1, 0) : HMM_V3(1, 0, 0);
-    *B = HMM_NormV3(HMM_Cross(N, up));
-    *T = HMM_Cross(*B, N);
-}
 
-// Transform tangent space direction to world space
-static HMM_Vec3 tangent_to_world(HMM_Vec3 local, HMM_Vec3 T, HMM_Vec3 B, HMM_Vec3 N) {
-    return HMM_AddV3(HMM_AddV3(
-        HMM_MulV3F(T, local.X),
-        HMM_MulV3F(B, local.Y)),
-        HMM_MulV3F(N, local.Z));
+    init_texture_from_rgba8(img, pixels, width, height, skip_mips);
+    stbi_image_free(pixels);
 }
 
-// Reflect vector V around normal N
-static HMM_Vec3 reflect(HMM_Vec3 V, HMM_Vec3 N) {
-    return HMM_SubV3(HMM_MulV3F(N, 2.0f * HMM_DotV3(V, N)), V);
+static void init_texture_view(sg_view view, sg_image img) {
+    sg_view_desc view_desc = {};
+    view_desc.texture.image = img;
+    sg_init_view(view, &view_desc);
 }
 
-// Convert equirectangular HDR to cubemap
-static sg_image equirectangular_to_cubemap(const float* hdr_data, int hdr_width, int hdr_height, int cubemap_size) {
-    const int face_size = cubemap_size * cubemap_size * 4;  // RGBA32F per face
-    std::vector<float> cubemap_data(face_size * 6);  // 6 faces
-    
-    parallelutil::parallel_for_2d(6 * cubemap_size, cubemap_size, [&](int face_y, int x) {
-        int face = face_y / cubemap_size;
-        int y = face_y % cubemap_size;
-        float* face_data = cubemap_data.data() + face * face_size;
-        
-        // Convert pixel coordinates to UV in [-1, 1] range
-        float u = (x + 0.5f) / cubemap_size * 2.0f - 1.0f;
-        float v = (y + 0.5f) / cubemap_size * 2.0f - 1.0f;
-        
-        // Get direction and sample HDR
-        HMM_Vec3 dir = get_cubemap_direction(face, u, v);
-        HMM_Vec3 color = sample_equirectangular(hdr_data, hdr_width, hdr_height, dir);
-        
-        // Store HDR values
-        int idx = (y * cubemap_size + x) * 4;
-        face_data[idx + 0] = color.X;
-        face_data[idx + 1] = color.Y;
-        face_data[idx + 2] = color.Z;
-        face_data[idx + 3] = 1.0f;
-    });
-    
-    sg_image_desc desc = {};
-    desc.type = SG_IMAGETYPE_CUBE;
-    desc.width = cubemap_size;
-    desc.height = cubemap_size;
-    desc.num_slices = 6;
-    desc.pixel_format = SG_PIXELFORMAT_RGBA32F;
-    desc.data.mip_levels[0] = { cubemap_data.data(), cubemap_data.size() * sizeof(float) };
-    desc.label = "environment-cubemap";
-    return sg_make_image(&desc);
-}
+// ============================================================================
+// HDR Loading and IBL (bakes in ibl.cpp)
+// ============================================================================
 
-// Generate irradiance map by convolving the environment cubemap
-static sg_image generate_irradiance_map(const float* hdr_data, int hdr_width, int hdr_height, int size) {
-    const int face_size = size * size * 4;
-    std::vector<float> irradiance_data(face_size * 6);
-    
-    parallelutil::parallel_for_2d(6 * size, size, [&](int face_y, int x) {
-        int face = face_y / size;
-        int y = face_y % size;
-        float* face_data = irradiance_data.data() + face * face_size;
-        
-        float u = (x + 0.5f) / size * 2.0f - 1.0f;
-        float v = (y + 0.5f) / size * 2.0f - 1.0f;
-        
-        // Get normal direction for this cubemap pixel
-        HMM_Vec3 N = get_cubemap_direction(face, u, v);
-        
-        // Build tangent space
-        HMM_Vec3 T, B;
-        build_tangent_space(N, &T, &B);
-        
-        // Sample hemisphere around normal
-        HMM_Vec3 irradiance = HMM_V3(0, 0, 0);
-        const int num_samples = 64;
-        std::mt19937 rng(static_cast<unsigned int>(face * size * size + y * size + x));
-        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-        
-        for (int i = 0; i < num_samples; i++) {
-            float Xi1 = dist(rng);
-            float Xi2 = dist(rng);
-            
-            // Cosine-weighted hemisphere sampling
-            float phi = 2.0f * HMM_PI32 * Xi1;
-            float cosTheta = sqrtf(Xi2);
-            float sinTheta = sqrtf(1.0f - Xi2);
-            
-            // Local direction in tangent space
-            HMM_Vec3 local_dir = HMM_V3(sinTheta * cosf(phi), sinTheta * sinf(phi), cosTheta);
-            
-            // Transform to world space
-            HMM_Vec3 L = HMM_NormV3(tangent_to_world(local_dir, T, B, N));
-            
-            // Sample environment and accumulate
-            HMM_Vec3 sample_color = sample_equirectangular(hdr_data, hdr_width, hdr_height, L);
-            irradiance = HMM_AddV3(irradiance, sample_color);
-        }
-        
-        // Average samples
-        irradiance = HMM_MulV3F(irradiance, 1.0f / num_samples);
-        
-        // Store HDR values
-        int idx = (y * size + x) * 4;
-        face_data[idx + 0] = irradiance.X;
-        face_data[idx + 1] = irradiance.Y;
-        face_data[idx + 2] = irradiance.Z;
-        face_data[idx + 3] = 1.0f;
-    });
-    
+// RGBA32F cube image from baked levels, each holding all 6 faces
+static sg_image make_float_cubemap(const std::vector<float>* levels, int num_mips, int size, const char* label) {
     sg_image_desc desc = {};
     desc.type = SG_IMAGETYPE_CUBE;
     desc.width = size;
     desc.height = size;
     desc.num_slices = 6;
+    desc.num_mipmaps = num_mips;
     desc.pixel_format = SG_PIXELFORMAT_RGBA32F;
-    desc.data.mip_levels[0] = { irradiance_data.data(), irradiance_data.size() * sizeof(float) };
-    desc.label = "irradiance-map";
+    for (int mip = 0; mip < num_mips; mip++) {
+        desc.data.mip_levels[mip] = { levels[mip].data(), levels[mip].size() * sizeof(float) };
+    }
+    desc.label = label;
     return sg_make_image(&desc);
 }
 
-// Generate a single mip level for prefilter map
-static void generate_prefilter_mip(const float* hdr_data, int hdr_width, int hdr_height,
-                                    float* out_data, int mip_size, float roughness) {
-    const int face_size = mip_size * mip_size * 4;
-    
-    // More samples for rougher surfaces (they need more averaging)
-    const int base_samples = 64;
-    const int num_samples = base_samples + (int)(roughness * 192);  // 64-256 samples
-    
-    parallelutil::parallel_for_2d(6 * mip_size, mip_size, [&](int face_y, int x) {
-        int face = face_y / mip_size;
-        int y = face_y % mip_size;
-        float* face_data = out_data + face * face_size;
-        
-        float u = (x + 0.5f) / mip_size * 2.0f - 1.0f;
-        float v = (y + 0.5f) / mip_size * 2.0f - 1.0f;
-        
-        HMM_Vec3 R = get_cubemap_direction(face, u, v);
-        HMM_Vec3 T, B;
-        build_tangent_space(R, &T, &B);
-        
-        // Use roughness^2 for GGX (remapped roughness)
-        float a = roughness * roughness;
-        float a2 = a * a;
-        
-        HMM_Vec3 prefiltered = HMM_V3(0, 0, 0);
-        float total_weight = 0.0f;
-        std::mt19937 rng(static_cast<unsigned int>(face * mip_size * mip_size + y * mip_size + x));
-        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-        
-        for (int i = 0; i < num_samples; i++) {
-            float Xi1 = dist(rng);
-            float Xi2 = dist(rng);
-            
-            // GGX importance sampling
-            float phi = 2.0f * HMM_PI32 * Xi1;
-            float cosTheta = sqrtf((1.0f - Xi2) / (1.0f + (a2 - 1.0f) * Xi2));
-            float sinTheta = sqrtf(1.0f - cosTheta * cosTheta);
-            
-            HMM_Vec3 H_local = HMM_V3(sinTheta * cosf(phi), sinTheta * sinf(phi), cosTheta);
-            HMM_Vec3 H = tangent_to_world(H_local, T, B, R);
-            HMM_Vec3 L = HMM_NormV3(reflect(R, H));
-            
-            float NdotL = HMM_MAX(0.0f, HMM_DotV3(R, L));
-            if (NdotL > 0.0f) {
-                HMM_Vec3 sample_color = sample_equirectangular(hdr_data, hdr_width, hdr_height, L);
-                prefiltered = HMM_AddV3(prefiltered, HMM_MulV3F(sample_color, NdotL));
-                total_weight += NdotL;
-            }
-        }
-        
-        if (total_weight > 0.0f) {
-            prefiltered = HMM_MulV3F(prefiltered, 1.0f / total_weight);
-        }
-        
-        int idx = (y * mip_size + x) * 4;
-        face_data[idx + 0] = prefiltered.X;
-        face_data[idx + 1] = prefiltered.Y;
-        face_data[idx + 2] = prefiltered.Z;
-        face_data[idx + 3] = 1.0f;
-    });
+// Convert equirectangular HDR to cubemap
+static sg_image equirectangular_to_cubemap(const float* hdr_data, int hdr_width, int hdr_height, int cubemap_size) {
+    std::vector<float> cubemap_data;
+    ibl_environment_cubemap(hdr_data, hdr_width, hdr_height, cubemap_size, cubemap_data);
+    return make_float_cubemap(&cubemap_data, 1, cubemap_size, "environment-cubemap");
+}
+
+// Generate irradiance map by convolving the environment cubemap
+static sg_image generate_irradiance_map(const float* hdr_data, int hdr_width, int hdr_height, int size, int samples) {
+    std::vector<float> irradiance_data;
+    ibl_irradiance_map(hdr_data, hdr_width, hdr_height, size, samples, irradiance_data);
+    return make_float_cubemap(&irradiance_data, 1, size, "irradiance-map");
 }
 
 // Generate prefilter map with multiple mip levels for different roughness values
-static sg_image generate_prefilter_map(const float* hdr_data, int hdr_width, int hdr_height, int base_size) {
-    // Calculate number of mip levels (down to 8x8 minimum)
-    const int max_mip_levels = 5;  // 128 -> 64 -> 32 -> 16 -> 8
-    int num_mips = 0;
-    int temp_size = base_size;
-    while (temp_size >= 8 && num_mips < max_mip_levels) {
-        num_mips++;
-        temp_size /= 2;
-    }
-    
-    log_message(("Generating prefilter map with " + std::to_string(num_mips) + " mip levels").c_str());
-    
-    // Allocate storage for all mip levels
-    std::vector<std::vector<float>> mip_data(num_mips);
+static sg_image generate_prefilter_map(const float* hdr_data, int hdr_width, int hdr_height, int base_size,
+                                       int base_samples) {
+    int num_mips = ibl_prefilter_mip_count(base_size);
+    log_write(LOG_DEBUG, "Generating prefilter map", { log_int("mips", num_mips) });
     
+    std::vector<float> mip_data[IBL_PREFILTER_MAX_MIPS];
     for (int mip = 0; mip < num_mips; mip++) {
         int mip_size = base_size >> mip;  // base_size / 2^mip
-        float roughness = (float)mip / (float)(num_mips - 1);  // 0.0 to 1.0
-        
-        // Ensure minimum roughness to avoid singularities
-        roughness = HMM_MAX(roughness, 0.01f);
+        float roughness = ibl_prefilter_roughness(mip, num_mips);
         
-        log_message(("  Mip " + std::to_string(mip) + ": " + std::to_string(mip_size) + 
-                     "x" + std::to_string(mip_size) + ", roughness=" + 
-                     std::to_string(roughness)).c_str());
+        log_write(LOG_DEBUG, "Prefilter mip",
+                  { log_int("mip", mip), log_int("size", mip_size), log_float("roughness", roughness) });
         
-        int face_size = mip_size * mip_size * 4;
-        mip_data[mip].resize(face_size * 6);
-        
-        generate_prefilter_mip(hdr_data, hdr_width, hdr_height, 
-                               mip_data[mip].data(), mip_size, roughness);
-    }
-    
-    // Create image with all mip levels
-    sg_image_desc desc = {};
-    desc.type = SG_IMAGETYPE_CUBE;
-    desc.width = base_size;
-    desc.height = base_size;
-    desc.num_slices = 6;
-    desc.num_mipmaps = num_mips;
-    desc.pixel_format = SG_PIXELFORMAT_RGBA32F;
-    
-    for (int mip = 0; mip < num_mips; mip++) {
-        desc.data.mip_levels[mip] = { mip_data[mip].data(), mip_data[mip].size() * sizeof(float) };
+        mip_data[mip].resize((size_t)mip_size * mip_size * 4 * 6);
+        ibl_prefilter_mip(hdr_data, hdr_width, hdr_height, mip_size, roughness, base_samples, mip_data[mip].data());
     }
-    
-    desc.label = "prefilter-map";
-    return sg_make_image(&desc);
+    return make_float_cubemap(mip_data, num_mips, base_size, "prefilter-map");
 }
 
-// Generate BRDF LUT (parallelized CPU version)
+// Generate BRDF LUT
 static sg_image generate_brdf_lut() {
     const int size = 512;
-    std::vector<float> lut_data(size * size * 2);
-    
-    parallelutil::parallel_for_2d(size, size, [&](int x, int y) {
-        float NdotV = (x + 0.5f) / size;
-        float roughness = (y + 0.5f) / size;
-        
-        // View vector in tangent space (N = (0,0,1))
-        HMM_Vec3 V = HMM_V3(sqrtf(1.0f - NdotV * NdotV), 0.0f, NdotV);
-        float A = 0.0f, B = 0.0f;
-        
-        std::mt19937 rng(static_cast<unsigned int>(x * size + y));
-        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-        
-        const int num_samples = 1024;
-        for (int i = 0; i < num_samples; i++) {
-            float Xi1 = dist(rng);
-            float Xi2 = dist(rng);
-            
-            // GGX importance sampling
-            float a = roughness * roughness;
-            float phi = 2.0f * HMM_PI32 * Xi1;
-            float cosTheta = sqrtf((1.0f - Xi2) / (1.0f + (a * a - 1.0f) * Xi2));
-            float sinTheta = sqrtf(1.0f - cosTheta * cosTheta);
-            
-            // Half vector in tangent space
-            HMM_Vec3 H = HMM_V3(cosf(phi) * sinTheta, sinf(phi) * sinTheta, cosTheta);
-            
-            float NdotH = H.Z;  // N = (0,0,1) in tangent space
-            float VdotH = HMM_DotV3(V, H);
-            
-            if (NdotH > 0.0f && VdotH > 0.0f) {
-                // Simplified geometry term
-                float G = HMM_MIN(2.0f * NdotH / VdotH, 1.0f);
-                float G_Vis = G * VdotH / (NdotH * NdotV);
-                float Fc = powf(HMM_MAX(1.0f - VdotH, 0.0f), 5.0f);
-                A += (1.0f - Fc) * G_Vis;
-                B += Fc * G_Vis;
-            }
-        }
-        
-        lut_data[(y * size + x) * 2 + 0] = A / num_samples;
-        lut_data[(y * size + x) * 2 + 1] = B / num_samples;
-    });
-    
-    // Convert to RGBA8 format
-    std::vector<uint8_t> rgba_data(size * size * 4);
-    for (int i = 0; i < size * size; i++) {
-        rgba_data[i * 4 + 0] = (uint8_t)HMM_MIN(lut_data[i * 2 + 0] * 255.0f, 255.0f);
-        rgba_data[i * 4 + 1] = (uint8_t)HMM_MIN(lut_data[i * 2 + 1] * 255.0f, 255.0f);
-        rgba_data[i * 4 + 2] = 0;
-        rgba_data[i * 4 + 3] = 255;
-    }
+    std::vector<uint8_t> rgba_data;
+    ibl_brdf_lut(size, rgba_data);
     
     sg_image_desc desc = {};
     desc.width = size;
@@ -728,13 +652,17 @@ static sg_image create_simple_cubemap(uint8_t r, uint8_t g, uint8_t b) {
 }
 
 // Create IBL maps from HDR environment
-static void create_ibl_maps(const char* hdr_filepath) {
+static void create_ibl_maps(const char* hdr_filepath, const IblSettings& ibl) {
+    TRACE_ZONE("create_ibl_maps");
+    AllocScope alloc_scope(ALLOC_IBL);
     // Load HDR data
     int hdr_width, hdr_height, hdr_channels;
     stbi_set_flip_vertically_on_load(0);  // Don't flip HDR - standard is V=0 at top
+    TraceZone hdr_zone("hdr decode");
     float* hdr_data = stbi_loadf(hdr_filepath, &hdr_width, &hdr_height, &hdr_channels, 3);
+    hdr_zone.end();
     if (!hdr_data) {
-        log_message(("Failed to load HDR for IBL: " + std::string(hdr_filepath)).c_str());
+        log_write(LOG_ERROR, "Failed to load HDR for IBL", { log_str("path", hdr_filepath) });
         // Fallback to simple cubemaps
         state.hdr_environment = create_simple_cubemap(128, 128, 128);
         state.hdr_environment_view = create_texture_view(state.hdr_environment);
@@ -750,21 +678,23 @@ static void create_ibl_maps(const char* hdr_filepath) {
     log_message("Generating IBL maps from HDR...");
     
     // Generate environment cubemap for skybox (high resolution, no filtering)
-    int environment_size = 512;  // Higher resolution for sharp skybox
+    int environment_size = ibl.environment_size;
     state.hdr_environment = equirectangular_to_cubemap(hdr_data, hdr_width, hdr_height, environment_size);
     state.hdr_environment_view = create_texture_view(state.hdr_environment);
-    log_message(("  Environment cubemap: " + std::to_string(environment_size) + "x" + std::to_string(environment_size)).c_str());
+    log_write(LOG_INFO, "IBL environment cubemap", { log_int("size", environment_size) });
     
     // Generate irradiance map (diffuse IBL)
-    int irradiance_size = 32;
-    state.irradiance_map = generate_irradiance_map(hdr_data, hdr_width, hdr_height, irradiance_size);
+    int irradiance_size = ibl.irradiance_size;
+    state.irradiance_map = generate_irradiance_map(hdr_data, hdr_width, hdr_height, irradiance_size,
+                                                   ibl.irradiance_samples);
     state.irradiance_map_view = create_texture_view(state.irradiance_map);
-    log_message(("  Irradiance map: " + std::to_string(irradiance_size) + "x" + std::to_string(irradiance_size)).c_str());
+    log_write(LOG_INFO, "IBL irradiance map", { log_int("size", irradiance_size) });
     
     // Generate prefilter map with mip chain for specular IBL
-    int prefilter_size = 256;
-    int prefilter_mips = 5;  // 256 -> 128 -> 64 -> 32 -> 16 (matches MAX_REFLECTION_LOD in shader)
-    state.prefilter_map = generate_prefilter_map(hdr_data, hdr_width, hdr_height, prefilter_size);
+    int prefilter_size = ibl.prefilter_size;
+    int prefilter_mips = ibl_prefilter_mip_count(prefilter_size);  // 5 from 128 up (MAX_REFLECTION_LOD in shader)
+    state.prefilter_map = generate_prefilter_map(hdr_data, hdr_width, hdr_height, prefilter_size,
+                                                 ibl.prefilter_samples);
     state.prefilter_map_view = create_texture_view(state.prefilter_map, prefilter_mips);
     
     // Generate BRDF LUT
@@ -773,147 +703,1448 @@ static void create_ibl_maps(const char* hdr_filepath) {
     
     stbi_image_free(hdr_data);
     log_message("IBL maps generated successfully");
+    if (alloc_tracking_enabled()) {
+        AllocStats allocs = alloc_stats(ALLOC_IBL);
+        log_write(LOG_INFO, "IBL allocations", { log_int("allocs", (int64_t)allocs.count),
+                                                 log_float("mb", allocs.bytes / (1024.0 * 1024.0)),
+                                                 log_float("peak_mb", allocs.peak_live_bytes / (1024.0 * 1024.0)) });
+    }
 }
 
 // ============================================================================
-// GLTF/GLB/VRM Loading
+// VRM First-Person Annotations
 // ============================================================================
 
-// Custom cgltf file read callback for UTF-8 path support
-static cgltf_result cgltf_read_file_utf8(const cgltf_memory_options* memory_options, 
-                                          const cgltf_file_options* file_options,
-                                          const char* path, cgltf_size* size, void** data) {
-    (void)file_options;
-    
-    std::vector<uint8_t> file_data;
-    if (!read_file_utf8(path, file_data)) {
-        return cgltf_result_file_not_found;
-    }
-    
-    void* (*memory_alloc)(void*, cgltf_size) = memory_options->alloc ? memory_options->alloc : &cgltf_default_alloc;
-    void* result = memory_alloc(memory_options->user_data, file_data.size());
-    if (!result) {
-        return cgltf_result_out_of_memory;
-    }
-    
-    memcpy(result, file_data.data(), file_data.size());
-    *size = file_data.size();
-    *data = result;
-    
-    return cgltf_result_success;
-}
+struct VrmFirstPerson {
+    bool valid;
+    int head_node;                            // -1 if the humanoid has no head bone
+    HMM_Vec3 head_offset;                     // Eye position in head bone space
+    float forward_azimuth;                    // 0.x faces -Z, 1.0 faces +Z
+    std::vector<FirstPersonFlag> node_flags;  // Resolved per node, unannotated meshes are Auto
+    std::vector<bool> head_nodes;             // Head bone and its descendants (erased by Auto)
+};
 
-static void cgltf_release_file_utf8(const cgltf_memory_options* memory_options,
-                                     const cgltf_file_options* file_options, void* data) {
-    (void)file_options;
-    void (*memory_free)(void*, void*) = memory_options->free ? memory_options->free : &cgltf_default_free;
-    memory_free(memory_options->user_data, data);
+static FirstPersonFlag first_person_flag_from_string(const std::string& flag) {
+    if (flag == "Both") return FIRST_PERSON_BOTH;
+    if (flag == "ThirdPersonOnly") return FIRST_PERSON_THIRD_PERSON_ONLY;
+    if (flag == "FirstPersonOnly") return FIRST_PERSON_FIRST_PERSON_ONLY;
+    return FIRST_PERSON_AUTO;
 }
 
-static bool load_model(const char* filepath) {
-    log_message(("Loading model: " + std::string(filepath)).c_str());
-    
-    // Read file with UTF-8 support
-    std::vector<uint8_t> file_data;
-    if (!read_file_utf8(filepath, file_data)) {
-        log_message("Failed to read model file");
-        return false;
+static FirstPersonFlag first_person_flag_from_type(VRMC_VRM_1_0::MeshAnnotation::FirstPersonType type) {
+    switch (type) {
+        case VRMC_VRM_1_0::MeshAnnotation::FirstPersonType::Both: return FIRST_PERSON_BOTH;
+        case VRMC_VRM_1_0::MeshAnnotation::FirstPersonType::ThirdPersonOnly: return FIRST_PERSON_THIRD_PERSON_ONLY;
+        case VRMC_VRM_1_0::MeshAnnotation::FirstPersonType::FirstPersonOnly: return FIRST_PERSON_FIRST_PERSON_ONLY;
+        default: return FIRST_PERSON_AUTO;
     }
-    
-    cgltf_options options = {};
-    options.file.read = cgltf_read_file_utf8;
-    options.file.release = cgltf_release_file_utf8;
-    
-    cgltf_data* data = nullptr;
-    
-    // Parse from memory
-    cgltf_result result = cgltf_parse(&options, file_data.data(), file_data.size(), &data);
-    if (result != cgltf_result_success) {
-        log_message("Failed to parse GLTF file");
-        return false;
-    }
-    
-    // Load buffers (uses our custom file read callback for external files)
-    result = cgltf_load_buffers(&options, data, filepath);
-    if (result != cgltf_result_success) {
-        log_message("Failed to load GLTF buffers");
-        cgltf_free(data);
-        return false;
+}
+
+// Read VRMC_vrm (1.0) or VRM (0.x) first-person settings
+static VrmFirstPerson load_vrm_first_person(const cgltf_data* data) {
+    VrmFirstPerson fp;
+    fp.valid = false;
+    fp.head_node = -1;
+    fp.head_offset = HMM_V3(0.0f, 0.06f, 0.0f);
+    fp.forward_azimuth = 180.0f;
+    fp.node_flags.assign(data->nodes_count, FIRST_PERSON_AUTO);
+    fp.head_nodes.assign(data->nodes_count, false);
+
+    const cgltf_extension* ext_1_0 = find_extension(data->data_extensions, data->data_extensions_count, "VRMC_vrm");
+    const cgltf_extension* ext_0_0 = find_extension(data->data_extensions, data->data_extensions_count, "VRM");
+    if (!ext_1_0 && !ext_0_0) {
+        return fp;
     }
-    
-    // Check if VRM model
-    state.is_vrm_model = false;
-    if (data->extensions_used && data->extensions_used_count > 0) {
-        for (size_t i = 0; i < data->extensions_used_count; i++) {
-            if (strstr(data->extensions_used[i], "VRM") || strstr(data->extensions_used[i], "vrm")) {
-                state.is_vrm_model = true;
-                state.use_toon_shader = true;  // Default to toon shader for VRM models
-                break;
+
+    try {
+        if (ext_1_0) {
+            nlohmann::json json = nlohmann::json::parse(ext_1_0->data);
+
+            VRMC_VRM_1_0::Humanoid humanoid;
+            VRMC_VRM_1_0::from_json(json.at("humanoid"), humanoid);
+            fp.head_node = (int)humanoid.humanBones.head.node;
+
+            if (json.contains("firstPerson")) {
+                VRMC_VRM_1_0::FirstPerson first_person;
+                VRMC_VRM_1_0::from_json(json["firstPerson"], first_person);
+                for (const auto& annotation : first_person.meshAnnotations) {
+                    if (annotation.node < data->nodes_count) {
+                        fp.node_flags[annotation.node] = first_person_flag_from_type(annotation.type);
+                    }
+                }
+            }
+
+            if (json.contains("lookAt")) {
+                VRMC_VRM_1_0::LookAt look_at;
+                VRMC_VRM_1_0::from_json(json["lookAt"], look_at);
+                if (look_at.offsetFromHeadBone.size() == 3) {
+                    fp.head_offset = HMM_V3(look_at.offsetFromHeadBone[0], look_at.offsetFromHeadBone[1], look_at.offsetFromHeadBone[2]);
+                }
+            }
+            fp.forward_azimuth = 180.0f;
+        } else {
+            nlohmann::json json = nlohmann::json::parse(ext_0_0->data);
+
+            VRMC_VRM_0_0::Firstperson first_person;
+            first_person.firstPersonBone = UINT32_MAX;
+            first_person.firstPersonBoneOffset = { 0.0f, 0.06f, 0.0f };
+            if (json.contains("firstPerson")) {
+                VRMC_VRM_0_0::from_json(json["firstPerson"], first_person);
+            }
+            fp.head_offset = HMM_V3(first_person.firstPersonBoneOffset.x,
+                                    first_person.firstPersonBoneOffset.y,
+                                    first_person.firstPersonBoneOffset.z);
+
+            // 0.x annotates glTF meshes, apply to every node instancing them
+            for (const auto& annotation : first_person.meshAnnotations) {
+                if (annotation.mesh >= data->meshes_count) continue;
+                for (size_t ni = 0; ni < data->nodes_count; ni++) {
+                    if (data->nodes[ni].mesh == &data->meshes[annotation.mesh]) {
+                        fp.node_flags[ni] = first_person_flag_from_string(annotation.firstPersonFlag);
+                    }
+                }
+            }
+
+            fp.head_node = (int)first_person.firstPersonBone;
+            if (first_person.firstPersonBone >= data->nodes_count && json.contains("humanoid")) {
+                VRMC_VRM_0_0::Humanoid humanoid;
+                VRMC_VRM_0_0::from_json(json["humanoid"], humanoid);
+                for (const auto& bone : humanoid.humanBones) {
+                    if (bone.bone == VRMC_VRM_0_0::HumanoidBone::Bone::Head) {
+                        fp.head_node = (int)bone.node;
+                    }
+                }
             }
+            fp.forward_azimuth = 0.0f;
         }
+    } catch (const std::exception& e) {
+        log_write(LOG_WARN, "Failed to read VRM first-person settings", { log_str("error", e.what()) });
+        return fp;
     }
-    // Non-VRM models default to PBR
-    if (!state.is_vrm_model) {
-        state.use_toon_shader = false;
+
+    if (fp.head_node < 0 || (size_t)fp.head_node >= data->nodes_count) {
+        log_message("VRM has no head bone, first-person view disabled");
+        return fp;
     }
-    
-    // Clear existing model
-    for (auto& mesh : state.model.meshes) {
-        sg_destroy_buffer(mesh.vertex_buffer);
+
+    // Mark the head bone and everything parented under it
+    const cgltf_node* head = &data->nodes[fp.head_node];
+    for (size_t ni = 0; ni < data->nodes_count; ni++) {
+        for (const cgltf_node* n = &data->nodes[ni]; n; n = n->parent) {
+            if (n == head) {
+                fp.head_nodes[ni] = true;
+                break;
+            }
+        }
+    }
+
+    fp.valid = true;
+    return fp;
+}
+
+// Split an Auto-annotated skinned primitive: triangles touching a head joint
+// are moved to the end of the index list. Returns the number of indices kept
+// for the first-person view.
+static size_t split_first_person_triangles(const cgltf_node* node, const cgltf_primitive* prim,
+                                           const cgltf_data* data, const VrmFirstPerson& fp,
+                                           std::vector<uint32_t>& indices) {
+    const cgltf_accessor* joints_accessor = nullptr;
+    const cgltf_accessor* weights_accessor = nullptr;
+    for (size_t ai = 0; ai < prim->attributes_count; ai++) {
+        const cgltf_attribute* attr = &prim->attributes[ai];
+        if (attr->index != 0) continue;
+        if (attr->type == cgltf_attribute_type_joints) joints_accessor = attr->data;
+        if (attr->type == cgltf_attribute_type_weights) weights_accessor = attr->data;
+    }
+    if (!node->skin || !joints_accessor || !weights_accessor) {
+        return indices.size();
+    }
+
+    // Which skin joints belong to the head
+    std::vector<bool> head_joint(node->skin->joints_count, false);
+    for (size_t ji = 0; ji < node->skin->joints_count; ji++) {
+        size_t joint_node = node->skin->joints[ji] - data->nodes;
+        head_joint[ji] = joint_node < fp.head_nodes.size() && fp.head_nodes[joint_node];
+    }
+
+    std::vector<bool> head_vertex(joints_accessor->count, false);
+    for (size_t vi = 0; vi < joints_accessor->count; vi++) {
+        cgltf_uint joints[4] = {0, 0, 0, 0};
+        float weights[4] = {0, 0, 0, 0};
+        cgltf_accessor_read_uint(joints_accessor, vi, joints, 4);
+        cgltf_accessor_read_float(weights_accessor, vi, weights, 4);
+        for (int k = 0; k < 4; k++) {
+            if (weights[k] > 0.0f && joints[k] < head_joint.size() && head_joint[joints[k]]) {
+                head_vertex[vi] = true;
+                break;
+            }
+        }
+    }
+
+    std::vector<uint32_t> kept;
+    std::vector<uint32_t> erased;
+    kept.reserve(indices.size());
+    for (size_t ti = 0; ti + 2 < indices.size(); ti += 3) {
+        uint32_t a = indices[ti], b = indices[ti + 1], c = indices[ti + 2];
+        bool is_head = (a < head_vertex.size() && head_vertex[a]) ||
+                       (b < head_vertex.size() && head_vertex[b]) ||
+                       (c < head_vertex.size() && head_vertex[c]);
+        std::vector<uint32_t>& dst = is_head ? erased : kept;
+        dst.push_back(a);
+        dst.push_back(b);
+        dst.push_back(c);
+    }
+
+    size_t kept_count = kept.size();
+    indices = std::move(kept);
+    indices.insert(indices.end(), erased.begin(), erased.end());
+    return kept_count;
+}
+
+// ============================================================================
+// MToon Materials
+// ============================================================================
+
+struct ToonMaterialImport {
+    toon_toon_material_t params;
+    uint32_t features;          // MTOON_FEATURE_* bits
+    int shade_multiply_image;   // Image indices, -1 if unused
+    int rim_multiply_image;
+    int matcap_image;
+};
+
+static int texture_image_index(const cgltf_data* data, size_t texture_index) {
+    if (texture_index >= data->textures_count || !data->textures[texture_index].image) {
+        return -1;
+    }
+    return (int)(data->textures[texture_index].image - data->images);
+}
+
+static float srgb_to_linear(float c) {
+    return c <= 0.04045f ? c / 12.92f : powf((c + 0.055f) / 1.055f, 2.4f);
+}
+
+// VRM 0.x stores MToon settings in VRM.materialProperties, in glTF material order
+static std::vector<VRMC_VRM_0_0::Material> load_vrm0_material_properties(const cgltf_data* data) {
+    std::vector<VRMC_VRM_0_0::Material> materials;
+    const cgltf_extension* ext = find_extension(data->data_extensions, data->data_extensions_count, "VRM");
+    if (!ext) {
+        return materials;
+    }
+
+    try {
+        nlohmann::json json = nlohmann::json::parse(ext->data);
+        if (json.contains("materialProperties")) {
+            materials = json["materialProperties"].get<std::vector<VRMC_VRM_0_0::Material>>();
+        }
+    } catch (const std::exception& e) {
+        log_write(LOG_WARN, "Failed to read VRM 0.x material properties", { log_str("error", e.what()) });
+        materials.clear();
+    }
+    return materials;
+}
+
+// Build the packed toon parameters for a material. Materials without MToon
+// data get the stylized fallback, which is tuned from the GUI at draw time.
+static ToonMaterialImport load_toon_material(const cgltf_data* data, const cgltf_material* mat,
+                                             const VRMC_VRM_0_0::Material* mtoon_0_0) {
+    ToonMaterialImport out = {};
+    out.shade_multiply_image = -1;
+    out.rim_multiply_image = -1;
+    out.matcap_image = -1;
+
+    toon_toon_material_t& p = out.params;
+    p.base_color_factor = HMM_V4(1.0f, 1.0f, 1.0f, 1.0f);
+    p.shade_color_factor = HMM_V4(0.0f, 0.0f, 0.0f, 0.0f);
+    p.rim_color_factor = HMM_V4(0.5f, 0.5f, 0.5f, 2.0f);  // Fallback rim strength / power
+    p.matcap_factor = HMM_V4(0.0f, 0.0f, 0.0f, 0.0f);
+    p.emissive_factor = HMM_V4(0.0f, 0.0f, 0.0f, 0.0f);
+    p.params = HMM_V4(1.0f, 1.0f, 0.9f, 0.9f);
+    p.flags = HMM_V4(0.0f, 0.0f, 0.0f, 0.0f);
+    if (!mat) {
+        return out;
+    }
+
+    if (mat->has_pbr_metallic_roughness) {
+        const cgltf_pbr_metallic_roughness* pbr = &mat->pbr_metallic_roughness;
+        p.base_color_factor = HMM_V4(pbr->base_color_factor[0], pbr->base_color_factor[1],
+                                     pbr->base_color_factor[2], pbr->base_color_factor[3]);
+        p.params.X = pbr->metallic_factor;
+        p.params.Y = pbr->roughness_factor;
+    }
+    p.emissive_factor = HMM_V4(mat->emissive_factor[0], mat->emissive_factor[1], mat->emissive_factor[2], 0.0f);
+
+    // VRM 1.0: VRMC_materials_mtoon material extension
+    const cgltf_extension* ext = find_extension(mat->extensions, mat->extensions_count, "VRMC_materials_mtoon");
+    if (ext) {
+        try {
+            nlohmann::json json = nlohmann::json::parse(ext->data);
+            VRMC_VRM_1_0::MaterialsMtoon mtoon;
+            VRMC_VRM_1_0::from_json(json, mtoon);
+
+            auto rgb = [](const std::vector<float>& v, float def) {
+                return v.size() >= 3 ? HMM_V3(v[0], v[1], v[2]) : HMM_V3(def, def, def);
+            };
+            HMM_Vec3 shade = rgb(mtoon.shadeColorFactor, 1.0f);
+            HMM_Vec3 rim = rgb(mtoon.parametricRimColorFactor, 0.0f);
+            HMM_Vec3 matcap = rgb(mtoon.matcapFactor, 1.0f);
+            p.shade_color_factor = HMM_V4(shade.X, shade.Y, shade.Z, mtoon.shadingShiftFactor);
+            p.rim_color_factor = HMM_V4(rim.X, rim.Y, rim.Z, mtoon.parametricRimFresnelPowerFactor);
+            p.matcap_factor = HMM_V4(matcap.X, matcap.Y, matcap.Z, mtoon.parametricRimLiftFactor);
+            p.emissive_factor.W = mtoon.rimLightingMixFactor;
+            p.params.Z = mtoon.shadingToonyFactor;
+            p.params.W = mtoon.giEqualizationFactor;
+            p.flags.X = 1.0f;
+
+            if (json.contains("shadeMultiplyTexture")) {
+                out.shade_multiply_image = texture_image_index(data, mtoon.shadeMultiplyTexture.index);
+            }
+            if (json.contains("rimMultiplyTexture")) {
+                out.rim_multiply_image = texture_image_index(data, mtoon.rimMultiplyTexture.index);
+            }
+            if (json.contains("matcapTexture")) {
+                out.matcap_image = texture_image_index(data, mtoon.matcapTexture.index);
+            }
+        } catch (const std::exception& e) {
+            log_write(LOG_WARN, "Failed to read VRMC_materials_mtoon", { log_str("error", e.what()) });
+        }
+    } else if (mtoon_0_0 && mtoon_0_0->shader == "VRM/MToon") {
+        // VRM 0.x: Unity material properties, colors in sRGB
+        auto f = [&](const char* name, float def) {
+            auto it = mtoon_0_0->floatProperties.find(name);
+            return it != mtoon_0_0->floatProperties.end() ? it->second : def;
+        };
+        auto color = [&](const char* name, HMM_Vec4 def) {
+            auto it = mtoon_0_0->vectorProperties.find(name);
+            if (it == mtoon_0_0->vectorProperties.end() || it->second.size() < 3) return def;
+            const std::vector<float>& v = it->second;
+            return HMM_V4(srgb_to_linear(v[0]), srgb_to_linear(v[1]), srgb_to_linear(v[2]), v.size() > 3 ? v[3] : 1.0f);
+        };
+        auto texture = [&](const char* name) {
+            auto it = mtoon_0_0->textureProperties.find(name);
+            return it != mtoon_0_0->textureProperties.end() ? texture_image_index(data, it->second) : -1;
+        };
+
+        // 0.x ramps half-lambert between shift and lerp(1, shift, toony);
+        // convert that range to the 1.0 shift/toony parameters
+        float shade_shift = f("_ShadeShift", 0.0f);
+        float shade_toony = f("_ShadeToony", 0.9f);
+        float lo = 2.0f * shade_shift - 1.0f;
+        float hi = 1.0f + 2.0f * shade_toony * (shade_shift - 1.0f);
+
+        HMM_Vec4 shade = color("_ShadeColor", HMM_V4(0.97f, 0.81f, 0.86f, 1.0f));
+        HMM_Vec4 rim = color("_RimColor", HMM_V4(0.0f, 0.0f, 0.0f, 1.0f));
+        HMM_Vec4 emission = color("_EmissionColor", HMM_V4(0.0f, 0.0f, 0.0f, 1.0f));
+        p.base_color_factor = color("_Color", p.base_color_factor);
+        p.shade_color_factor = HMM_V4(shade.X, shade.Y, shade.Z, -(lo + hi) * 0.5f);
+        p.rim_color_factor = HMM_V4(rim.X, rim.Y, rim.Z, f("_RimFresnelPower", 1.0f));
+        p.matcap_factor = HMM_V4(1.0f, 1.0f, 1.0f, f("_RimLift", 0.0f));
+        p.emissive_factor = HMM_V4(emission.X, emission.Y, emission.Z, f("_RimLightingMix", 0.0f));
+        p.params.Z = HMM_Clamp(0.0f, 1.0f - (hi - lo) * 0.5f, 1.0f);
+        p.params.W = 1.0f - f("_IndirectLightIntensity", 0.1f);
+        p.flags.X = 1.0f;
+
+        out.shade_multiply_image = texture("_ShadeTexture");
+        out.rim_multiply_image = texture("_RimTexture");
+        out.matcap_image = texture("_SphereAdd");
+    }
+
+    if (out.shade_multiply_image >= 0) out.features |= MTOON_FEATURE_SHADE_TEXTURE;
+    if (out.rim_multiply_image >= 0) out.features |= MTOON_FEATURE_RIM_TEXTURE;
+    if (out.matcap_image >= 0) {
+        out.features |= MTOON_FEATURE_MATCAP_TEXTURE;
+    } else {
+        // Matcap contributes only through its texture
+        p.matcap_factor = HMM_V4(0.0f, 0.0f, 0.0f, p.matcap_factor.W);
+    }
+    return out;
+}
+
+// ============================================================================
+// Material and Texture Cache
+// ============================================================================
+
+static void retain_texture(Model& model, sg_image image) {
+    auto it = model.textures.find(image.id);
+    if (it != model.textures.end()) {
+        it->second.ref_count++;
+    }
+}
+
+static void drop_pending_texture(Model& model, sg_image image) {
+    for (auto it = model.pending_textures.begin(); it != model.pending_textures.end(); ++it) {
+        if (it->image.id == image.id) {
+            model.pending_textures.erase(it);
+            return;
+        }
+    }
+}
+
+// Decode deferred images the given shader variant samples, on first switch to it
+static void decode_pending_textures(Model& model, uint32_t uses) {
+    int decoded = 0;
+    for (auto it = model.pending_textures.begin(); it != model.pending_textures.end();) {
+        if (it->uses & uses) {
+            init_texture_from_buffer(it->image, it->bytes.data(), it->bytes.size(), it->skip_mips);
+            init_texture_view(it->view, it->image);
+            it = model.pending_textures.erase(it);
+            decoded++;
+        } else {
+            ++it;
+        }
+    }
+    if (decoded > 0) {
+        log_write(LOG_INFO, "Decoded deferred textures", { log_int("count", (int64_t)decoded) });
+    }
+}
+
+static void release_texture(Model& model, sg_image image) {
+    auto it = model.textures.find(image.id);
+    if (it != model.textures.end() && --it->second.ref_count <= 0) {
+        drop_pending_texture(model, image);
+        sg_destroy_view(it->second.view);
+        sg_destroy_image(it->second.image);
+        model.textures.erase(it);
+    }
+}
+
+static void material_textures(const PBRMaterial& material, sg_image out[8]) {
+    out[0] = material.base_color_tex;
+    out[1] = material.metallic_roughness_tex;
+    out[2] = material.normal_tex;
+    out[3] = material.occlusion_tex;
+    out[4] = material.emissive_tex;
+    out[5] = material.shade_multiply_tex;
+    out[6] = material.rim_multiply_tex;
+    out[7] = material.matcap_tex;
+}
+
+static bool materials_equal(const Model& model, const PBRMaterial& a, const PBRMaterial& b) {
+    sg_image ta[8], tb[8];
+    material_textures(a, ta);
+    material_textures(b, tb);
+    for (int i = 0; i < 8; i++) {
+        if (ta[i].id != tb[i].id) return false;
+    }
+    const toon_toon_material_t& toon_a = model.toon_materials[a.toon_material_index].params;
+    const toon_toon_material_t& toon_b = model.toon_materials[b.toon_material_index].params;
+    return memcmp(&a.base_color_factor, &b.base_color_factor, sizeof(HMM_Vec4)) == 0 &&
+           a.metallic_factor == b.metallic_factor &&
+           a.roughness_factor == b.roughness_factor &&
+           memcmp(&a.emissive_factor, &b.emissive_factor, sizeof(HMM_Vec3)) == 0 &&
+           a.is_vrm == b.is_vrm &&
+           a.mtoon_features == b.mtoon_features &&
+           memcmp(&toon_a, &toon_b, sizeof(toon_toon_material_t)) == 0;
+}
+
+// Returns the index of an existing identical material, or adds the material
+// and takes a reference on each of its textures
+static int add_material(Model& model, const PBRMaterial& material) {
+    for (size_t i = 0; i < model.materials.size(); i++) {
+        if (materials_equal(model, model.materials[i], material)) {
+            return (int)i;
+        }
+    }
+
+    sg_image images[8];
+    material_textures(material, images);
+    for (int i = 0; i < 8; i++) {
+        retain_texture(model, images[i]);
+    }
+    model.materials.push_back(material);
+    return (int)model.materials.size() - 1;
+}
+
+static void destroy_model(Model& model) {
+    for (auto& mesh : model.meshes) {
         if (mesh.has_indices) {
             sg_destroy_buffer(mesh.index_buffer);
         }
-        // Clean up PBR material textures
-        if (mesh.material.base_color_tex.id != state.default_texture.id) {
-            sg_destroy_view(mesh.material.base_color_view);
-            sg_destroy_image(mesh.material.base_color_tex);
+    }
+    model.meshes.clear();
+    model.bvh = Bvh();
+    model.bvh_built = false;
+    model.triangle_positions.clear();
+    model.triangle_indices.clear();
+    model.draw_first_triangle.clear();
+    for (sg_buffer buffer : model.vertex_buffers) {
+        sg_destroy_buffer(buffer);
+    }
+    model.vertex_buffers.clear();
+
+    for (const PBRMaterial& material : model.materials) {
+        sg_image images[8];
+        material_textures(material, images);
+        for (int i = 0; i < 8; i++) {
+            release_texture(model, images[i]);
+        }
+    }
+    model.materials.clear();
+
+    // Anything left was never referenced by a material
+    for (auto& entry : model.textures) {
+        sg_destroy_view(entry.second.view);
+        sg_destroy_image(entry.second.image);
+    }
+    model.textures.clear();
+    model.pending_textures.clear();
+    model.texture_stats.clear();
+    model.texture_bytes = 0;
+
+    sg_destroy_view(model.toon_material_view);
+    sg_destroy_buffer(model.toon_material_buffer);
+    model.toon_material_view = {};
+    model.toon_material_buffer = {};
+    model.toon_materials.clear();
+}
+
+// ============================================================================
+// Texture Atlas
+// ============================================================================
+
+static int texture_wrap_s(const cgltf_texture* texture) {
+    return texture->sampler ? texture->sampler->wrap_s : 10497;  // REPEAT
+}
+
+static int texture_wrap_t(const cgltf_texture* texture) {
+    return texture->sampler ? texture->sampler->wrap_t : 10497;
+}
+
+// Everything but the base color image matches, so atlasing the base color
+// images makes the two materials deduplicate
+static bool atlas_compatible(const cgltf_data* data, const std::vector<ToonMaterialImport>& toon_imports,
+                             const std::vector<size_t>& canonical, const cgltf_material* a, const cgltf_material* b) {
+    const ToonMaterialImport& toon_a = toon_imports[a - data->materials + 1];
+    const ToonMaterialImport& toon_b = toon_imports[b - data->materials + 1];
+    int matcap_a = toon_a.matcap_image >= 0 ? (int)canonical[toon_a.matcap_image] : -1;
+    int matcap_b = toon_b.matcap_image >= 0 ? (int)canonical[toon_b.matcap_image] : -1;
+    return a->has_pbr_metallic_roughness == b->has_pbr_metallic_roughness &&
+           memcmp(a->pbr_metallic_roughness.base_color_factor, b->pbr_metallic_roughness.base_color_factor,
+                  sizeof(cgltf_float) * 4) == 0 &&
+           a->pbr_metallic_roughness.metallic_factor == b->pbr_metallic_roughness.metallic_factor &&
+           a->pbr_metallic_roughness.roughness_factor == b->pbr_metallic_roughness.roughness_factor &&
+           memcmp(a->emissive_factor, b->emissive_factor, sizeof(cgltf_float) * 3) == 0 &&
+           toon_a.features == toon_b.features &&
+           (toon_a.shade_multiply_image >= 0) == (toon_b.shade_multiply_image >= 0) &&
+           (toon_a.rim_multiply_image >= 0) == (toon_b.rim_multiply_image >= 0) &&
+           matcap_a == matcap_b &&
+           memcmp(&toon_a.params, &toon_b.params, sizeof(toon_toon_material_t)) == 0;
+}
+
+// Pick the base color images worth atlasing. A material qualifies when its
+// only UV-sampled image is the base color image (MToon shade/rim may reuse
+// it), read through untransformed TEXCOORD_0 that stays inside [0,1] on every
+// rendered primitive. An image is atlased when all materials using it
+// qualify and it lets at least two compatible materials merge.
+static void plan_texture_atlas(const cgltf_data* data, const std::vector<ToonMaterialImport>& toon_imports,
+                               const std::vector<size_t>& canonical, const std::vector<const uint8_t*>& image_bytes,
+                               const std::vector<size_t>& image_sizes, TextureAtlas& atlas) {
+    const TextureImportSettings& import = state.texture_import;
+    atlas.image_rects.assign(data->images_count, -1);
+    atlas.material_rects.assign(data->materials_count, -1);
+    if (import.atlas_source_max <= 0) {
+        return;
+    }
+
+    auto canonical_image = [&](const cgltf_texture_view& view) -> int {
+        return view.texture && view.texture->image ? (int)canonical[view.texture->image - data->images] : -1;
+    };
+    std::vector<int> base_images(data->materials_count, -1);
+    std::vector<bool> eligible(data->materials_count, false);
+    std::vector<bool> used(data->materials_count, false);
+    for (size_t m = 0; m < data->materials_count; m++) {
+        const cgltf_material* mat = &data->materials[m];
+        const cgltf_texture_view& base = mat->pbr_metallic_roughness.base_color_texture;
+        const ToonMaterialImport& toon = toon_imports[m + 1];
+        int image = canonical_image(base);
+        base_images[m] = image;
+        auto reuses_base = [&](int img) { return img < 0 || (int)canonical[img] == image; };
+        eligible[m] = mat->has_pbr_metallic_roughness && image >= 0 && image_bytes[image] &&
+                      base.texcoord == 0 && !base.has_transform &&
+                      !mat->pbr_metallic_roughness.metallic_roughness_texture.texture &&
+                      !mat->normal_texture.texture && !mat->occlusion_texture.texture &&
+                      !mat->emissive_texture.texture &&
+                      reuses_base(toon.shade_multiply_image) && reuses_base(toon.rim_multiply_image);
+    }
+
+    // UVs outside [0,1] would need the wrap mode inside the sub-rectangle
+    const float uv_epsilon = 1e-3f;
+    std::vector<float> uvs;
+    for (size_t ni = 0; ni < data->nodes_count; ni++) {
+        const cgltf_mesh* mesh = data->nodes[ni].mesh;
+        for (size_t pi = 0; mesh && pi < mesh->primitives_count; pi++) {
+            const cgltf_primitive* prim = &mesh->primitives[pi];
+            if (!prim->material || prim->type != cgltf_primitive_type_triangles) {
+                continue;
+            }
+            size_t m = prim->material - data->materials;
+            used[m] = true;
+            if (!eligible[m]) {
+                continue;
+            }
+            for (size_t ai = 0; ai < prim->attributes_count; ai++) {
+                const cgltf_attribute* attr = &prim->attributes[ai];
+                if (attr->type != cgltf_attribute_type_texcoord || attr->index != 0) {
+                    continue;
+                }
+                uvs.resize(attr->data->count * 2);
+                cgltf_accessor_unpack_floats(attr->data, uvs.data(), uvs.size());
+                for (float uv : uvs) {
+                    if (uv < -uv_epsilon || uv > 1.0f + uv_epsilon) {
+                        eligible[m] = false;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    // Images read by a non-qualifying material or in another role stay
+    // standalone, as do images sampled with conflicting wrap modes
+    std::vector<bool> image_ok(data->images_count, true);
+    std::vector<int> image_wrap_s(data->images_count, -1);
+    std::vector<int> image_wrap_t(data->images_count, -1);
+    for (size_t m = 0; m < data->materials_count; m++) {
+        if (!used[m]) {
+            continue;
+        }
+        const cgltf_material* mat = &data->materials[m];
+        const ToonMaterialImport& toon = toon_imports[m + 1];
+        int others[] = {
+            canonical_image(mat->pbr_metallic_roughness.metallic_roughness_texture),
+            canonical_image(mat->normal_texture),
+            canonical_image(mat->occlusion_texture),
+            canonical_image(mat->emissive_texture),
+            toon.matcap_image >= 0 ? (int)canonical[toon.matcap_image] : -1,
+        };
+        for (int img : others) {
+            if (img >= 0) {
+                image_ok[img] = false;
+            }
+        }
+        int image = base_images[m];
+        if (image < 0) {
+            continue;
+        }
+        if (!eligible[m]) {
+            image_ok[image] = false;
+            continue;
+        }
+        const cgltf_texture* texture = mat->pbr_metallic_roughness.base_color_texture.texture;
+        if (image_wrap_s[image] < 0) {
+            image_wrap_s[image] = texture_wrap_s(texture);
+            image_wrap_t[image] = texture_wrap_t(texture);
+        } else if (image_wrap_s[image] != texture_wrap_s(texture) || image_wrap_t[image] != texture_wrap_t(texture)) {
+            image_ok[image] = false;
+        }
+    }
+
+    // Group compatible materials; only groups spanning several images merge
+    std::vector<int> group_of(data->materials_count, -1);
+    std::vector<size_t> group_leaders;
+    for (size_t m = 0; m < data->materials_count; m++) {
+        if (!used[m] || !eligible[m] || !image_ok[base_images[m]]) {
+            continue;
+        }
+        for (size_t g = 0; g < group_leaders.size(); g++) {
+            if (atlas_compatible(data, toon_imports, canonical, &data->materials[group_leaders[g]], &data->materials[m])) {
+                group_of[m] = (int)g;
+                break;
+            }
         }
-        if (mesh.material.metallic_roughness_tex.id != state.default_metallic_roughness.id) {
-            sg_destroy_view(mesh.material.metallic_roughness_view);
-            sg_destroy_image(mesh.material.metallic_roughness_tex);
+        if (group_of[m] < 0) {
+            group_of[m] = (int)group_leaders.size();
+            group_leaders.push_back(m);
         }
-        if (mesh.material.normal_tex.id != state.default_normal.id) {
-            sg_destroy_view(mesh.material.normal_view);
-            sg_destroy_image(mesh.material.normal_tex);
+    }
+    std::vector<bool> candidate(data->images_count, false);
+    for (size_t g = 0; g < group_leaders.size(); g++) {
+        int first_image = base_images[group_leaders[g]];
+        bool merges = false;
+        for (size_t m = 0; m < data->materials_count; m++) {
+            merges |= group_of[m] == (int)g && base_images[m] != first_image;
         }
-        if (mesh.material.occlusion_tex.id != state.default_texture.id) {
-            sg_destroy_view(mesh.material.occlusion_view);
-            sg_destroy_image(mesh.material.occlusion_tex);
+        for (size_t m = 0; merges && m < data->materials_count; m++) {
+            if (group_of[m] == (int)g) {
+                candidate[base_images[m]] = true;
+            }
         }
-        if (mesh.material.emissive_tex.id != state.default_texture.id) {
-            sg_destroy_view(mesh.material.emissive_view);
-            sg_destroy_image(mesh.material.emissive_tex);
+    }
+
+    for (size_t i = 0; i < data->images_count; i++) {
+        AtlasRect rect = {};
+        int channels;
+        if (!candidate[i] || !image_ok[i] ||
+            !stbi_info_from_memory(image_bytes[i], (int)image_sizes[i], &rect.width, &rect.height, &channels) ||
+            HMM_MAX(rect.width, rect.height) > import.atlas_source_max) {
+            continue;
         }
+        atlas.rects.push_back(rect);
+        atlas.rect_images.push_back(i);
+        atlas.wrap_s.push_back(image_wrap_s[i]);
+        atlas.wrap_t.push_back(image_wrap_t[i]);
+    }
+    if (atlas.rects.size() < 2) {
+        atlas.rects.clear();
+        return;
+    }
+
+    int placed = pack_atlas(atlas.rects, import.atlas_padding, import.max_size[TEXTURE_ROLE_BASE_COLOR],
+                            &atlas.width, &atlas.height);
+    if (placed < 2) {
+        atlas.rects.clear();
+        return;
+    }
+    size_t kept = 0;
+    for (size_t r = 0; r < atlas.rects.size(); r++) {
+        if (atlas.rects[r].placed) {
+            atlas.rects[kept] = atlas.rects[r];
+            atlas.rect_images[kept] = atlas.rect_images[r];
+            atlas.wrap_s[kept] = atlas.wrap_s[r];
+            atlas.wrap_t[kept] = atlas.wrap_t[r];
+            atlas.image_rects[atlas.rect_images[r]] = (int)kept;
+            kept++;
+        }
+    }
+    atlas.rects.resize(kept);
+    atlas.rect_images.resize(kept);
+    atlas.wrap_s.resize(kept);
+    atlas.wrap_t.resize(kept);
+    for (size_t m = 0; m < data->materials_count; m++) {
+        if (group_of[m] >= 0) {
+            atlas.material_rects[m] = atlas.image_rects[base_images[m]];
+        }
+    }
+}
+
+// Decode the atlased images in parallel into their padded rectangles.
+// Failed decodes and unused space stay white.
+static void build_texture_atlas(const TextureAtlas& atlas, const std::vector<const uint8_t*>& image_bytes,
+                                const std::vector<size_t>& image_sizes, std::vector<uint8_t>& pixels) {
+    TRACE_ZONE("build_texture_atlas");
+    pixels.assign((size_t)atlas.width * atlas.height * 4, 0xFF);
+    int padding = state.texture_import.atlas_padding;
+    parallelutil::queue_based_parallel_for((int)atlas.rects.size(), [&](int r) {
+        TRACE_ZONE("atlas rect");
+        const AtlasRect& rect = atlas.rects[r];
+        size_t image = atlas.rect_images[r];
+        int width, height, channels;
+        uint8_t* src = stbi_load_from_memory(image_bytes[image], (int)image_sizes[image], &width, &height, &channels, 4);
+        if (src && width == rect.width && height == rect.height) {
+            blit_atlas_rect(pixels.data(), atlas.width, src, rect, padding, atlas.wrap_s[r], atlas.wrap_t[r]);
+        }
+        stbi_image_free(src);
+    });
+}
+
+// The image's atlas rectangle in normalized coordinates (u, v, width, height)
+static void atlas_uv_rect(const TextureAtlas& atlas, int rect_index, float uv_rect[4]) {
+    const AtlasRect& rect = atlas.rects[rect_index];
+    uv_rect[0] = rect.x / (float)atlas.width;
+    uv_rect[1] = rect.y / (float)atlas.height;
+    uv_rect[2] = rect.width / (float)atlas.width;
+    uv_rect[3] = rect.height / (float)atlas.height;
+}
+
+// ============================================================================
+// Model Loading
+// ============================================================================
+
+// Combine batches drawn together (same scope, material and first-person
+// flag) into one draw each. Their pools are concatenated into the pool with
+// the lowest index, so a pool also used by other draws is still uploaded
+// once; emptied pools are left behind.
+static std::vector<MeshBatch> assemble_mesh_batches(const std::vector<MeshBatch>& batches,
+                                                    std::vector<std::vector<Vertex>>& pools) {
+    TRACE_ZONE("assemble_mesh_batches");
+    std::vector<std::vector<size_t>> groups;
+    std::map<std::tuple<int, int, int>, size_t> group_by_key;
+    for (size_t b = 0; b < batches.size(); b++) {
+        auto key = std::make_tuple(batches[b].scope, batches[b].material_index, (int)batches[b].first_person);
+        auto it = group_by_key.find(key);
+        if (it == group_by_key.end()) {
+            it = group_by_key.emplace(key, groups.size()).first;
+            groups.emplace_back();
+        }
+        groups[it->second].push_back(b);
+    }
+
+    // Union the pools of each group; the smaller index becomes the root
+    std::vector<int> parent(pools.size());
+    for (size_t p = 0; p < pools.size(); p++) {
+        parent[p] = (int)p;
+    }
+    auto find = [&](int p) {
+        while (parent[p] != p) {
+            parent[p] = parent[parent[p]];
+            p = parent[p];
+        }
+        return p;
+    };
+    for (const std::vector<size_t>& group : groups) {
+        for (size_t b : group) {
+            int a = find(batches[group[0]].pool);
+            int c = find(batches[b].pool);
+            parent[std::max(a, c)] = std::min(a, c);
+        }
+    }
+    std::vector<size_t> offsets(pools.size(), 0);
+    for (size_t p = 0; p < pools.size(); p++) {
+        int root = find((int)p);
+        if (root != (int)p) {
+            offsets[p] = pools[root].size();
+            pools[root].insert(pools[root].end(), pools[p].begin(), pools[p].end());
+            std::vector<Vertex>().swap(pools[p]);
+        }
+    }
+
+    std::vector<MeshBatch> merged;
+    merged.reserve(groups.size());
+    for (const std::vector<size_t>& group : groups) {
+        const MeshBatch& first = batches[group[0]];
+        MeshBatch out = {};
+        out.pool = find(first.pool);
+        out.scope = first.scope;
+        out.first_person = first.first_person;
+        out.material_index = first.material_index;
+        out.material_name = first.material_name;
+        for (size_t b : group) {
+            out.sources.insert(out.sources.end(), batches[b].sources.begin(), batches[b].sources.end());
+        }
+        for (int part = 0; part < 2; part++) {
+            for (size_t b : group) {
+                const MeshBatch& batch = batches[b];
+                uint32_t base = (uint32_t)offsets[batch.pool];
+                size_t begin = part == 0 ? 0 : batch.first_person_index_count;
+                size_t end = part == 0 ? batch.first_person_index_count : batch.indices.size();
+                for (size_t i = begin; i < end; i++) {
+                    out.indices.push_back(batch.indices[i] + base);
+                }
+            }
+            if (part == 0) {
+                out.first_person_index_count = (int)out.indices.size();
+            }
+        }
+        merged.push_back(std::move(out));
+    }
+    return merged;
+}
+
+// Nodes moved by an animation channel, directly or through an ancestor
+static std::vector<bool> find_animated_nodes(const cgltf_data* data) {
+    std::vector<bool> targeted(data->nodes_count, false);
+    for (size_t ai = 0; ai < data->animations_count; ai++) {
+        const cgltf_animation* anim = &data->animations[ai];
+        for (size_t ci = 0; ci < anim->channels_count; ci++) {
+            if (anim->channels[ci].target_node) {
+                targeted[anim->channels[ci].target_node - data->nodes] = true;
+            }
+        }
+    }
+    std::vector<bool> animated(data->nodes_count, false);
+    for (size_t ni = 0; ni < data->nodes_count; ni++) {
+        for (const cgltf_node* n = &data->nodes[ni]; n && !animated[ni]; n = n->parent) {
+            animated[ni] = targeted[n - data->nodes];
+        }
+    }
+    return animated;
+}
+
+// Generate missing normals for every rendered triangle primitive and missing
+// tangents for normal-mapped ones, once per glTF primitive (indexed by
+// mesh_first_primitive[mesh] + primitive). Primitives large enough to split
+// across threads run one at a time; the rest run in parallel with each
+// other. Results are read from and added to the model cache.
+static std::vector<GeneratedAttributes> generate_missing_attributes(const cgltf_data* data, ModelCache& cache,
+                                                                    std::vector<size_t>& mesh_first_primitive,
+                                                                    int* generated_count, int* cached_count) {
+    TRACE_ZONE("generate_missing_attributes");
+    mesh_first_primitive.resize(data->meshes_count);
+    size_t primitive_count = 0;
+    for (size_t mi = 0; mi < data->meshes_count; mi++) {
+        mesh_first_primitive[mi] = primitive_count;
+        primitive_count += data->meshes[mi].primitives_count;
+    }
+    std::vector<GeneratedAttributes> generated(primitive_count);
+
+    struct Job {
+        const cgltf_primitive* prim;
+        const cgltf_accessor* pos;
+        const cgltf_accessor* norm;  // Null when normals are generated
+        const cgltf_accessor* uv;
+        size_t id;
+        std::string name;  // Cache entry suffix: mesh/primitive
+        bool normals, tangents;
+        size_t triangles;
+    };
+    std::vector<Job> jobs;
+    std::vector<bool> seen(primitive_count, false);
+    *generated_count = 0;
+    *cached_count = 0;
+    for (size_t ni = 0; ni < data->nodes_count; ni++) {
+        const cgltf_mesh* mesh = data->nodes[ni].mesh;
+        for (size_t pi = 0; mesh && pi < mesh->primitives_count; pi++) {
+            const cgltf_primitive* prim = &mesh->primitives[pi];
+            size_t id = mesh_first_primitive[mesh - data->meshes] + pi;
+            if (seen[id] || prim->type != cgltf_primitive_type_triangles) {
+                continue;
+            }
+            seen[id] = true;
+            Job job = {};
+            job.prim = prim;
+            job.id = id;
+            bool has_tangents = false;
+            for (size_t ai = 0; ai < prim->attributes_count; ai++) {
+                const cgltf_attribute* attr = &prim->attributes[ai];
+                if (attr->type == cgltf_attribute_type_position) job.pos = attr->data;
+                if (attr->type == cgltf_attribute_type_normal) job.norm = attr->data;
+                if (attr->type == cgltf_attribute_type_texcoord && attr->index == 0) job.uv = attr->data;
+                has_tangents |= attr->type == cgltf_attribute_type_tangent;
+            }
+            bool normal_mapped = prim->material && prim->material->normal_texture.texture;
+            job.normals = job.pos && !job.norm;
+            job.tangents = job.pos && job.uv && !has_tangents && normal_mapped;
+            if (!job.normals && !job.tangents) {
+                continue;
+            }
+
+            GeneratedAttributes& gen = generated[id];
+            job.name = std::to_string(mesh - data->meshes) + "/" + std::to_string(pi);
+            if (job.normals) {
+                gen.normals.resize(job.pos->count * 3);
+                job.normals = !model_cache_get(cache, "normals/" + job.name, gen.normals.data(),
+                                               gen.normals.size() * sizeof(float));
+            }
+            if (job.tangents) {
+                gen.tangents.resize(job.pos->count * 4);
+                job.tangents = !model_cache_get(cache, "tangents/" + job.name, gen.tangents.data(),
+                                                gen.tangents.size() * sizeof(float));
+            }
+            if (job.normals || job.tangents) {
+                job.triangles = (prim->indices ? prim->indices->count : job.pos->count) / 3;
+                jobs.push_back(std::move(job));
+            } else {
+                (*cached_count)++;
+            }
+        }
+    }
+
+    auto run = [&](const Job& job) {
+        const cgltf_primitive* prim = job.prim;
+        size_t vertex_count = job.pos->count;
+        std::vector<float> positions(vertex_count * 3);
+        cgltf_accessor_unpack_floats(job.pos, positions.data(), positions.size());
+        std::vector<uint32_t> indices;
+        if (prim->indices) {
+            indices.resize(prim->indices->count);
+            for (size_t ii = 0; ii < indices.size(); ii++) {
+                indices[ii] = (uint32_t)cgltf_accessor_read_index(prim->indices, ii);
+            }
+        }
+        const uint32_t* index_data = prim->indices ? indices.data() : nullptr;
+        size_t index_count = prim->indices ? indices.size() : vertex_count;
+
+        GeneratedAttributes& gen = generated[job.id];
+        if (job.normals) {
+            generate_normals(positions.data(), vertex_count, index_data, index_count, gen.normals.data());
+        }
+        if (job.tangents) {
+            std::vector<float> normals;
+            if (job.norm) {
+                normals.resize(vertex_count * 3);
+                cgltf_accessor_unpack_floats(job.norm, normals.data(), normals.size());
+            }
+            std::vector<float> uvs(vertex_count * 2);
+            cgltf_accessor_unpack_floats(job.uv, uvs.data(), uvs.size());
+            generate_tangents(positions.data(), job.norm ? normals.data() : gen.normals.data(), uvs.data(),
+                              vertex_count, index_data, index_count, gen.tangents.data());
+        }
+    };
+    std::vector<size_t> small_jobs;
+    for (size_t j = 0; j < jobs.size(); j++) {
+        if (jobs[j].triangles >= GEOMETRY_PARALLEL_MIN_TRIANGLES) {
+            run(jobs[j]);
+        } else {
+            small_jobs.push_back(j);
+        }
+    }
+    if (!small_jobs.empty()) {
+        parallelutil::queue_based_parallel_for((int)small_jobs.size(), [&](int i) { run(jobs[small_jobs[i]]); });
+    }
+
+    for (const Job& job : jobs) {
+        const GeneratedAttributes& gen = generated[job.id];
+        if (job.normals) {
+            model_cache_put(cache, "normals/" + job.name, gen.normals.data(), gen.normals.size() * sizeof(float));
+        }
+        if (job.tangents) {
+            model_cache_put(cache, "tangents/" + job.name, gen.tangents.data(), gen.tangents.size() * sizeof(float));
+        }
+    }
+    *generated_count = (int)jobs.size();
+    return generated;
+}
+
+// Reorder the first-person and head index ranges for the vertex cache,
+// keeping a range's order when it already does better
+static void optimize_mesh_batch(MeshBatch& batch, size_t vertex_count) {
+    for (uint32_t index : batch.indices) {
+        if (index >= vertex_count) {
+            return;  // Malformed input, drawn as is
+        }
+    }
+    size_t bounds[3] = { 0, (size_t)batch.first_person_index_count, batch.indices.size() };
+    for (int r = 0; r < 2; r++) {
+        std::vector<uint32_t> range(batch.indices.begin() + bounds[r], batch.indices.begin() + bounds[r + 1]);
+        std::vector<uint32_t> reordered = range;
+        optimize_vertex_cache(reordered, vertex_count);
+        if (average_cache_miss_ratio(reordered, vertex_count) < average_cache_miss_ratio(range, vertex_count)) {
+            std::copy(reordered.begin(), reordered.end(), batch.indices.begin() + bounds[r]);
+        }
+    }
+}
+
+
+// World-space positions and triangles of all draws in draw order, the
+// geometry behind the model BVH. pool_base receives where each pool starts
+// and first_triangle the first triangle of each draw.
+static void gather_model_triangles(const std::vector<MeshBatch>& batches, const std::vector<std::vector<Vertex>>& pools,
+                                   std::vector<size_t>& pool_base, std::vector<float>& positions,
+                                   std::vector<uint32_t>& indices, std::vector<uint32_t>& first_triangle) {
+    pool_base.resize(pools.size());
+    size_t vertex_count = 0;
+    for (size_t p = 0; p < pools.size(); p++) {
+        pool_base[p] = vertex_count;
+        vertex_count += pools[p].size();
+    }
+    positions.resize(vertex_count * 3);
+    for (size_t p = 0; p < pools.size(); p++) {
+        for (size_t v = 0; v < pools[p].size(); v++) {
+            memcpy(&positions[(pool_base[p] + v) * 3], pools[p][v].pos, sizeof(float) * 3);
+        }
+    }
+    indices.clear();
+    first_triangle.clear();
+    for (const MeshBatch& batch : batches) {
+        first_triangle.push_back((uint32_t)(indices.size() / 3));
+        uint32_t base = (uint32_t)pool_base[batch.pool];
+        for (uint32_t index : batch.indices) {
+            indices.push_back(index + base);
+        }
+    }
+}
+
+// Build the model BVH over the gathered triangles unless already built
+static void build_model_bvh(Model& model) {
+    if (model.bvh_built) {
+        return;
+    }
+    auto start = std::chrono::steady_clock::now();
+    bvh_build(model.bvh, model.triangle_positions.data(), model.triangle_positions.size() / 3,
+              model.triangle_indices.data(), model.triangle_indices.size());
+    model.bvh_built = true;
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    log_write(LOG_INFO, "Model BVH built", { log_int("triangles", (int64_t)model.bvh.triangles.size()),
+                                             log_int("nodes", (int64_t)model.bvh.nodes.size()), log_float("ms", ms) });
+}
+
+// The BVH keeps its own copy of the triangles
+static void release_model_triangles(Model& model) {
+    model.triangle_positions = std::vector<float>();
+    model.triangle_indices = std::vector<uint32_t>();
+}
+
+// Bake per-vertex ambient occlusion with the model BVH, or read it from the
+// model cache. The cache entry covers every pool in order and is named by a
+// hash of the baked geometry, so a different import of the model never
+// reads another's occlusion.
+static OcclusionBakeStats bake_model_occlusion(Model& model, const std::vector<size_t>& pool_base,
+                                               std::vector<std::vector<Vertex>>& pools, ModelCache& cache,
+                                               const OcclusionBakeSettings& settings, float diagonal, bool* cached) {
+    OcclusionBakeStats stats = {};
+    *cached = false;
+    const std::vector<float>& positions = model.triangle_positions;
+    const std::vector<uint32_t>& indices = model.triangle_indices;
+    size_t vertex_count = positions.size() / 3;
+    if (settings.rays <= 0 || vertex_count == 0) {
+        return stats;
+    }
+
+    std::vector<float> normals(vertex_count * 3);
+    for (size_t p = 0; p < pools.size(); p++) {
+        for (size_t v = 0; v < pools[p].size(); v++) {
+            memcpy(&normals[(pool_base[p] + v) * 3], pools[p][v].normal, sizeof(float) * 3);
+        }
+    }
+    uint64_t geometry = model_cache_hash(0, positions.data(), positions.size() * sizeof(float));
+    geometry = model_cache_hash(geometry, normals.data(), normals.size() * sizeof(float));
+    geometry = model_cache_hash(geometry, indices.data(), indices.size() * sizeof(uint32_t));
+
+    std::vector<float> occlusion(vertex_count);
+    char name[96];
+    snprintf(name, sizeof(name), "occlusion/%d/%g/%016llx", settings.rays, settings.distance_fraction,
+             (unsigned long long)geometry);
+    *cached = model_cache_get(cache, name, occlusion.data(), occlusion.size() * sizeof(float));
+    if (!*cached) {
+        build_model_bvh(model);
+        stats = bake_vertex_occlusion(model.bvh, positions.data(), normals.data(), vertex_count, settings.rays,
+                                      diagonal * settings.distance_fraction, occlusion.data());
+        model_cache_put(cache, name, occlusion.data(), occlusion.size() * sizeof(float));
+    }
+
+    for (size_t p = 0; p < pools.size(); p++) {
+        for (size_t v = 0; v < pools[p].size(); v++) {
+            pools[p][v].occlusion = occlusion[pool_base[p] + v];
+        }
+    }
+    return stats;
+}
+
+static RenderMesh upload_mesh_batch(const MeshBatch& batch, sg_buffer vertex_buffer, size_t vertex_count) {
+    RenderMesh render_mesh = {};
+    render_mesh.vertex_buffer = vertex_buffer;
+    render_mesh.num_vertices = (int)vertex_count;
+
+    if (!batch.indices.empty()) {
+        sg_buffer_desc ibuf_desc = {};
+        ibuf_desc.usage.index_buffer = true;
+        ibuf_desc.data = { batch.indices.data(), batch.indices.size() * sizeof(uint32_t) };
+        ibuf_desc.label = "mesh-indices";
+        render_mesh.index_buffer = sg_make_buffer(&ibuf_desc);
+        render_mesh.num_indices = (int)batch.indices.size();
+        render_mesh.first_person_index_count = batch.first_person_index_count;
+        render_mesh.has_indices = true;
+    }
+    render_mesh.first_person = batch.first_person;
+    render_mesh.material_index = batch.material_index;
+    render_mesh.material_name = batch.material_name.empty() ? "(default)" : batch.material_name;
+    for (size_t i = 0; i < batch.sources.size() && i < 3; i++) {
+        render_mesh.source += (i > 0 ? ", " : "") + batch.sources[i];
+    }
+    if (batch.sources.size() > 3) {
+        render_mesh.source += " +" + std::to_string(batch.sources.size() - 3);
+    }
+    return render_mesh;
+}
+
+static bool load_model(const char* filepath) {
+    TRACE_ZONE("load_model");
+    AllocScope alloc_scope(ALLOC_IMPORT);
+    AllocStats allocs_before = alloc_stats(ALLOC_IMPORT);
+    alloc_reset_peak(ALLOC_IMPORT);
+    log_write(LOG_INFO, "Loading model", { log_str("path", filepath) });
+    auto load_start = std::chrono::steady_clock::now();
+    state.load_failed = false;
+    
+    std::string error;
+    cgltf_data* data = import_gltf(filepath, error);
+    if (!data) {
+        log_write(LOG_ERROR, error.c_str());
+        state.load_failed = true;
+        return false;
     }
-    state.model.meshes.clear();
     
+    // Check if VRM model
+    state.is_vrm_model = is_vrm_data(data);
+    if (state.is_vrm_model) {
+        state.use_toon_shader = true;  // Default to toon shader for VRM models
+    }
+    // Non-VRM models default to PBR
+    if (!state.is_vrm_model) {
+        state.use_toon_shader = false;
+    }
+    if (state.options.shader != SHADER_AUTO) {
+        state.use_toon_shader = state.options.shader == SHADER_TOON;
+    }
+    
+    // Clear existing model
+    destroy_model(state.model);
+    state.picked_mesh = -1;
+    state.pick_row_count = 0;
+    state.model.num_triangles = 0;
+    state.model.num_head_triangles = 0;
+
+    // First-person annotations (VRM only)
+    VrmFirstPerson first_person = load_vrm_first_person(data);
+    state.model.has_first_person = first_person.valid;
+    state.model.forward_azimuth = first_person.forward_azimuth;
+    if (first_person.valid) {
+        float head_matrix[16];
+        cgltf_node_transform_world(&data->nodes[first_person.head_node], head_matrix);
+        HMM_Vec3 o = first_person.head_offset;
+        state.model.head_position = HMM_V3(
+            head_matrix[0]*o.X + head_matrix[4]*o.Y + head_matrix[8]*o.Z + head_matrix[12],
+            head_matrix[1]*o.X + head_matrix[5]*o.Y + head_matrix[9]*o.Z + head_matrix[13],
+            head_matrix[2]*o.X + head_matrix[6]*o.Y + head_matrix[10]*o.Z + head_matrix[14]);
+    }
+    state.first_person = false;
+
     // Calculate bounding box for camera positioning
     HMM_Vec3 min_bounds = HMM_V3(1e10f, 1e10f, 1e10f);
     HMM_Vec3 max_bounds = HMM_V3(-1e10f, -1e10f, -1e10f);
     
-    // Load textures
-    std::vector<sg_image> textures(data->images_count, state.default_texture);
-    std::vector<sg_view> texture_views(data->images_count, state.default_texture_view);
+    // Toon parameter table: row 0 is the default material, then one row per glTF material
+    std::vector<VRMC_VRM_0_0::Material> vrm0_materials = load_vrm0_material_properties(data);
+    std::vector<ToonMaterialImport> toon_imports(data->materials_count + 1);
+    toon_imports[0] = load_toon_material(data, nullptr, nullptr);
+    for (size_t i = 0; i < data->materials_count; i++) {
+        const VRMC_VRM_0_0::Material* mtoon_0_0 = i < vrm0_materials.size() ? &vrm0_materials[i] : nullptr;
+        toon_imports[i + 1] = load_toon_material(data, &data->materials[i], mtoon_0_0);
+    }
+    int mtoon_count = 0;
+    for (const ToonMaterialImport& toon : toon_imports) {
+        state.model.toon_materials.push_back({ toon.params });
+        mtoon_count += toon.params.flags.X > 0.0f ? 1 : 0;
+    }
+
+    // Which shader variants sample each image, from the materials of rendered
+    // primitives. Unreferenced images (VRM thumbnails, unused atlases) are
+    // never decoded; images only the inactive shader samples are deferred.
+    std::vector<uint32_t> image_uses(data->images_count, 0);
+    std::vector<uint32_t> image_roles(data->images_count, 0);
+    auto mark_image = [&](const cgltf_texture_view& view, uint32_t uses, TextureRole role) {
+        if (view.texture && view.texture->image) {
+            image_uses[view.texture->image - data->images] |= uses;
+            image_roles[view.texture->image - data->images] |= 1u << role;
+        }
+    };
+    for (size_t ni = 0; ni < data->nodes_count; ni++) {
+        cgltf_mesh* mesh = data->nodes[ni].mesh;
+        for (size_t pi = 0; mesh && pi < mesh->primitives_count; pi++) {
+            const cgltf_material* mat = mesh->primitives[pi].material;
+            if (!mat) {
+                continue;
+            }
+            mark_image(mat->pbr_metallic_roughness.base_color_texture, TEXTURE_USE_PBR | TEXTURE_USE_TOON,
+                       TEXTURE_ROLE_BASE_COLOR);
+            mark_image(mat->pbr_metallic_roughness.metallic_roughness_texture, TEXTURE_USE_PBR | TEXTURE_USE_TOON,
+                       TEXTURE_ROLE_METALLIC_ROUGHNESS);
+            mark_image(mat->normal_texture, TEXTURE_USE_PBR | TEXTURE_USE_TOON, TEXTURE_ROLE_NORMAL);
+            mark_image(mat->occlusion_texture, TEXTURE_USE_PBR, TEXTURE_ROLE_OCCLUSION);
+            mark_image(mat->emissive_texture, TEXTURE_USE_PBR, TEXTURE_ROLE_EMISSIVE);
+
+            const ToonMaterialImport& toon = toon_imports[mat - data->materials + 1];
+            for (int img : { toon.shade_multiply_image, toon.rim_multiply_image, toon.matcap_image }) {
+                if (img >= 0) {
+                    image_uses[img] |= TEXTURE_USE_TOON;
+                    image_roles[img] |= 1u << TEXTURE_ROLE_MTOON;
+                }
+            }
+        }
+    }
+
+    // Read encoded images. Byte-identical images (e.g. the same PNG embedded
+    // twice) map to one canonical image, decoded and uploaded once.
+    std::vector<std::vector<uint8_t>> file_bytes(data->images_count);
+    std::vector<const uint8_t*> image_bytes(data->images_count, nullptr);
+    std::vector<size_t> image_sizes(data->images_count, 0);
+    std::vector<size_t> canonical(data->images_count);
+    std::unordered_map<uint64_t, size_t> image_by_hash;
+    int shared_images = 0;
+    int unreferenced_images = 0;
     for (size_t i = 0; i < data->images_count; i++) {
         cgltf_image* image = &data->images[i];
+        canonical[i] = i;
+        if (!image_uses[i]) {
+            unreferenced_images++;
+            continue;
+        }
         
         if (image->buffer_view) {
             // Embedded texture
-            const uint8_t* buffer_data = (const uint8_t*)image->buffer_view->buffer->data;
-            buffer_data += image->buffer_view->offset;
-            textures[i] = load_texture_from_buffer(buffer_data, image->buffer_view->size);
+            image_bytes[i] = image_buffer_view_bytes(image, &image_sizes[i]);
         } else if (image->uri) {
             // External texture file
-            textures[i] = load_texture_from_file(filepath, image->uri);
+            std::string path = resolve_uri_path(filepath, image->uri);
+            if (read_file_utf8(path.c_str(), file_bytes[i])) {
+                image_bytes[i] = file_bytes[i].data();
+                image_sizes[i] = file_bytes[i].size();
+                log_write(LOG_DEBUG, "Loaded texture", { log_str("path", path.c_str()) });
+            } else {
+                log_write(LOG_WARN, "Failed to read texture file", { log_str("path", path.c_str()) });
+            }
         }
-        
-        // Create view for texture if it's not the default
-        if (textures[i].id != state.default_texture.id) {
-            texture_views[i] = create_texture_view(textures[i]);
+        if (!image_bytes[i]) {
+            continue;
+        }
+
+        uint64_t hash = hash_bytes(image_bytes[i], image_sizes[i]);
+        auto cached = image_by_hash.find(hash);
+        if (cached == image_by_hash.end()) {
+            image_by_hash[hash] = i;
+            continue;
+        }
+        size_t j = cached->second;
+        if (image_sizes[j] == image_sizes[i] && memcmp(image_bytes[j], image_bytes[i], image_sizes[i]) == 0) {
+            canonical[i] = j;
+            image_uses[j] |= image_uses[i];
+            image_roles[j] |= image_roles[i];
+            shared_images++;
+        }
+    }
+
+    // Pack base color images of materials that differ only in that image
+    // into one atlas; the packed sources are not uploaded on their own
+    TextureAtlas atlas;
+    plan_texture_atlas(data, toon_imports, canonical, image_bytes, image_sizes, atlas);
+    sg_image atlas_image = {};
+    sg_view atlas_view = {};
+    size_t atlas_bytes = 0;
+    if (!atlas.rects.empty()) {
+        std::vector<uint8_t> atlas_pixels;
+        build_texture_atlas(atlas, image_bytes, image_sizes, atlas_pixels);
+        atlas_image = sg_alloc_image();
+        atlas_view = sg_alloc_view();
+        init_texture_from_rgba8(atlas_image, atlas_pixels.data(), atlas.width, atlas.height, 0);
+        init_texture_view(atlas_view, atlas_image);
+        state.model.textures[atlas_image.id] = { atlas_image, atlas_view, 0 };
+        for (size_t image : atlas.rect_images) {
+            image_bytes[image] = nullptr;
+        }
+        atlas_bytes = atlas_pixels.size();
+    }
+
+    // Pick import resolutions from the encoded headers: halve to the role
+    // cap, then halve the largest textures until the model fits the budget.
+    // The atlas is kept at full size and counts against the budget.
+    const TextureImportSettings& import = state.texture_import;
+    std::vector<int> image_widths(data->images_count, 0);
+    std::vector<int> image_heights(data->images_count, 0);
+    std::vector<int> skip_mips(data->images_count, 0);
+    auto scaled_bytes = [&](size_t i) {
+        size_t w = HMM_MAX(image_widths[i] >> skip_mips[i], 1);
+        size_t h = HMM_MAX(image_heights[i] >> skip_mips[i], 1);
+        return w * h * 4;
+    };
+    size_t total_bytes = atlas_bytes;
+    for (size_t i = 0; i < data->images_count; i++) {
+        int channels;
+        if (canonical[i] != i || !image_bytes[i] ||
+            !stbi_info_from_memory(image_bytes[i], (int)image_sizes[i], &image_widths[i], &image_heights[i], &channels)) {
+            continue;
+        }
+        int cap = 0;
+        for (int role = 0; role < TEXTURE_ROLE_COUNT; role++) {
+            if (image_roles[i] & (1u << role)) {
+                cap = HMM_MAX(cap, import.max_size[role]);
+            }
+        }
+        while (HMM_MAX(image_widths[i] >> skip_mips[i], image_heights[i] >> skip_mips[i]) > cap) {
+            skip_mips[i]++;
+        }
+        total_bytes += scaled_bytes(i);
+    }
+    while (total_bytes > import.budget_bytes) {
+        size_t largest = data->images_count;
+        for (size_t i = 0; i < data->images_count; i++) {
+            int size = HMM_MAX(image_widths[i] >> skip_mips[i], image_heights[i] >> skip_mips[i]);
+            if (size / 2 >= import.min_size && (largest == data->images_count || scaled_bytes(i) > scaled_bytes(largest))) {
+                largest = i;
+            }
+        }
+        if (largest == data->images_count) {
+            log_write(LOG_WARN, "Texture budget exceeded at minimum texture size");
+            break;
+        }
+        total_bytes -= scaled_bytes(largest);
+        skip_mips[largest]++;
+        total_bytes += scaled_bytes(largest);
+    }
+
+    int downscaled_images = 0;
+    for (size_t i = 0; i < data->images_count; i++) {
+        if (image_widths[i] == 0) {
+            continue;
         }
+        TextureStat stat = {};
+        stat.source_width = image_widths[i];
+        stat.source_height = image_heights[i];
+        stat.width = HMM_MAX(image_widths[i] >> skip_mips[i], 1);
+        stat.height = HMM_MAX(image_heights[i] >> skip_mips[i], 1);
+        int role = 0;
+        while (role < TEXTURE_ROLE_COUNT - 1 && !(image_roles[i] & (1u << role))) {
+            role++;
+        }
+        const char* name = data->images[i].name ? data->images[i].name : "";
+        snprintf(stat.label, sizeof(stat.label), "%s %.16s", texture_role_names[role], name);
+        if (skip_mips[i] > 0) {
+            snprintf(stat.value, sizeof(stat.value), "%dx%d (%dx%d)", stat.width, stat.height,
+                     stat.source_width, stat.source_height);
+            downscaled_images++;
+        } else {
+            snprintf(stat.value, sizeof(stat.value), "%dx%d", stat.width, stat.height);
+        }
+        state.model.texture_stats.push_back(stat);
+    }
+    if (atlas_bytes > 0) {
+        TextureStat stat = {};
+        stat.source_width = stat.width = atlas.width;
+        stat.source_height = stat.height = atlas.height;
+        snprintf(stat.label, sizeof(stat.label), "Base atlas (%d images)", (int)atlas.rects.size());
+        snprintf(stat.value, sizeof(stat.value), "%dx%d", atlas.width, atlas.height);
+        state.model.texture_stats.push_back(stat);
+    }
+    std::sort(state.model.texture_stats.begin(), state.model.texture_stats.end(),
+              [](const TextureStat& a, const TextureStat& b) { return a.width * a.height > b.width * b.height; });
+    state.model.texture_bytes = total_bytes;
+
+    // Decode what the active shader samples; keep the encoded bytes of the rest
+    uint32_t active_uses = state.use_toon_shader ? TEXTURE_USE_TOON : TEXTURE_USE_PBR;
+    std::vector<sg_image> textures(data->images_count, state.default_texture);
+    std::vector<sg_view> texture_views(data->images_count, state.default_texture_view);
+    int decoded_images = 0;
+    TraceZone decode_zone("decode textures");
+    for (size_t i = 0; i < data->images_count; i++) {
+        if (canonical[i] != i || !image_bytes[i]) {
+            continue;
+        }
+        textures[i] = sg_alloc_image();
+        texture_views[i] = sg_alloc_view();
+        if (image_uses[i] & active_uses) {
+            init_texture_from_buffer(textures[i], image_bytes[i], image_sizes[i], skip_mips[i]);
+            init_texture_view(texture_views[i], textures[i]);
+            decoded_images++;
+        } else {
+            PendingTexture pending;
+            pending.image = textures[i];
+            pending.view = texture_views[i];
+            pending.uses = image_uses[i];
+            pending.skip_mips = skip_mips[i];
+            pending.bytes.assign(image_bytes[i], image_bytes[i] + image_sizes[i]);
+            state.model.pending_textures.push_back(std::move(pending));
+        }
+        state.model.textures[textures[i].id] = { textures[i], texture_views[i], 0 };
+    }
+    decode_zone.end();
+    for (size_t i = 0; i < data->images_count; i++) {
+        textures[i] = textures[canonical[i]];
+        texture_views[i] = texture_views[canonical[i]];
     }
     
+    // Primitives with no motion of their own (no skin, morph targets or
+    // animated node) are merged by material across the whole model; the rest
+    // only within their mesh. Node transforms are baked into the vertices,
+    // and first-person visibility, the only per-draw culling, is part of the
+    // merge key.
+    std::vector<bool> animated_nodes = find_animated_nodes(data);
+
+    // Missing normals and tangents, generated or read from the model cache
+    ModelCache cache;
+    model_cache_open(cache, data);
+    std::vector<size_t> mesh_first_primitive;
+    int generated_primitives = 0;
+    int cached_primitives = 0;
+    std::vector<GeneratedAttributes> generated =
+        generate_missing_attributes(data, cache, mesh_first_primitive, &generated_primitives, &cached_primitives);
+    std::vector<std::vector<Vertex>> pools;
+    std::vector<MeshBatch> primitive_batches;
+    int num_primitives = 0;
+    int shared_primitives = 0;
+    size_t welded_vertices_before = 0;
+    size_t welded_vertices_after = 0;
+
     // Process all meshes in all nodes
+    TraceZone convert_zone("convert meshes");
     for (size_t ni = 0; ni < data->nodes_count; ni++) {
         cgltf_node* node = &data->nodes[ni];
         if (!node->mesh) continue;
@@ -923,6 +2154,12 @@ static bool load_model(const char* filepath) {
         cgltf_node_transform_world(node, node_matrix);
         
         cgltf_mesh* mesh = node->mesh;
+        struct NodePool {
+            const cgltf_accessor* accessors[4];
+            int atlas_rect;
+            int pool;
+        };
+        std::vector<NodePool> node_pools;
         
         for (size_t pi = 0; pi < mesh->primitives_count; pi++) {
             cgltf_primitive* prim = &mesh->primitives[pi];
@@ -962,137 +2199,85 @@ static bool load_model(const char* filepath) {
             if (!pos_accessor) {
                 continue;
             }
+            const GeneratedAttributes& gen = generated[mesh_first_primitive[mesh - data->meshes] + pi];
             
+            int atlas_rect = prim->material ? atlas.material_rects[prim->material - data->materials] : -1;
             size_t vertex_count = pos_accessor->count;
-            std::vector<Vertex> vertices(vertex_count);
-            
-            // Read positions
-            for (size_t vi = 0; vi < vertex_count; vi++) {
-                float pos[3] = {0, 0, 0};
-                cgltf_accessor_read_float(pos_accessor, vi, pos, 3);
-                
-                // Apply node transform
-                float tx = node_matrix[0]*pos[0] + node_matrix[4]*pos[1] + node_matrix[8]*pos[2] + node_matrix[12];
-                float ty = node_matrix[1]*pos[0] + node_matrix[5]*pos[1] + node_matrix[9]*pos[2] + node_matrix[13];
-                float tz = node_matrix[2]*pos[0] + node_matrix[6]*pos[1] + node_matrix[10]*pos[2] + node_matrix[14];
-                
-                vertices[vi].pos[0] = tx;
-                vertices[vi].pos[1] = ty;
-                vertices[vi].pos[2] = tz;
-                
-                // Update bounds
-                min_bounds.X = HMM_MIN(min_bounds.X, tx);
-                min_bounds.Y = HMM_MIN(min_bounds.Y, ty);
-                min_bounds.Z = HMM_MIN(min_bounds.Z, tz);
-                max_bounds.X = HMM_MAX(max_bounds.X, tx);
-                max_bounds.Y = HMM_MAX(max_bounds.Y, ty);
-                max_bounds.Z = HMM_MAX(max_bounds.Z, tz);
+
+            // Primitives of this node reading the same accessors share one
+            // converted vertex array. Generated attributes and welding are per
+            // primitive, so those primitives keep theirs private.
+            bool shareable = prim->indices && gen.normals.empty() && gen.tangents.empty();
+            const cgltf_accessor* pool_key[4] = { pos_accessor, norm_accessor, uv_accessor, tangent_accessor };
+            int pool = -1;
+            for (size_t e = 0; shareable && e < node_pools.size(); e++) {
+                if (memcmp(node_pools[e].accessors, pool_key, sizeof(pool_key)) == 0 &&
+                    node_pools[e].atlas_rect == atlas_rect) {
+                    pool = node_pools[e].pool;
+                    shared_primitives++;
+                    break;
+                }
             }
-            
-            // Read normals
-            if (norm_accessor) {
-                for (size_t vi = 0; vi < vertex_count; vi++) {
-                    float norm[3] = {0, 1, 0};
-                    cgltf_accessor_read_float(norm_accessor, vi, norm, 3);
-                    
-                    // Apply node rotation (ignore scale for normals)
-                    float nx = node_matrix[0]*norm[0] + node_matrix[4]*norm[1] + node_matrix[8]*norm[2];
-                    float ny = node_matrix[1]*norm[0] + node_matrix[5]*norm[1] + node_matrix[9]*norm[2];
-                    float nz = node_matrix[2]*norm[0] + node_matrix[6]*norm[1] + node_matrix[10]*norm[2];
-                    float len = sqrtf(nx*nx + ny*ny + nz*nz);
-                    if (len > 0.0001f) {
-                        vertices[vi].normal[0] = nx / len;
-                        vertices[vi].normal[1] = ny / len;
-                        vertices[vi].normal[2] = nz / len;
-                    } else {
-                        vertices[vi].normal[0] = 0;
-                        vertices[vi].normal[1] = 1;
-                        vertices[vi].normal[2] = 0;
-                    }
+            if (pool < 0) {
+                pool = (int)pools.size();
+                pools.emplace_back();
+                float uv_rect[4];
+                if (atlas_rect >= 0) {
+                    atlas_uv_rect(atlas, atlas_rect, uv_rect);
                 }
-            } else {
-                for (size_t vi = 0; vi < vertex_count; vi++) {
-                    vertices[vi].normal[0] = 0;
-                    vertices[vi].normal[1] = 1;
-                    vertices[vi].normal[2] = 0;
+                convert_vertices(pos_accessor, norm_accessor, uv_accessor, tangent_accessor,
+                                 gen.normals.empty() ? nullptr : gen.normals.data(),
+                                 gen.tangents.empty() ? nullptr : gen.tangents.data(), node_matrix,
+                                 atlas_rect >= 0 ? uv_rect : nullptr, pools.back(), min_bounds.Elements,
+                                 max_bounds.Elements);
+                if (shareable) {
+                    NodePool entry = { { pos_accessor, norm_accessor, uv_accessor, tangent_accessor }, atlas_rect, pool };
+                    node_pools.push_back(entry);
                 }
             }
+            std::vector<Vertex>& vertices = pools[pool];
             
-            // Read UVs
-            if (uv_accessor) {
-                for (size_t vi = 0; vi < vertex_count; vi++) {
-                    float uv[2] = {0, 0};
-                    cgltf_accessor_read_float(uv_accessor, vi, uv, 2);
-                    vertices[vi].uv[0] = uv[0];
-                    vertices[vi].uv[1] = uv[1];
-                }
-            } else {
-                for (size_t vi = 0; vi < vertex_count; vi++) {
-                    vertices[vi].uv[0] = 0;
-                    vertices[vi].uv[1] = 0;
+            MeshBatch batch = {};
+            batch.pool = pool;
+
+            // Resolve first-person visibility. Auto erases head-skinned triangles;
+            // unskinned Auto meshes are hidden when attached under the head bone.
+            FirstPersonFlag fp_flag = FIRST_PERSON_BOTH;
+            if (first_person.valid) {
+                fp_flag = first_person.node_flags[ni];
+                if (fp_flag == FIRST_PERSON_AUTO && !node->skin) {
+                    fp_flag = first_person.head_nodes[ni] ? FIRST_PERSON_THIRD_PERSON_ONLY : FIRST_PERSON_BOTH;
                 }
             }
-            
-            // Read tangents
-            if (tangent_accessor) {
-                for (size_t vi = 0; vi < vertex_count; vi++) {
-                    float tangent[4] = {1, 0, 0, 1};
-                    cgltf_accessor_read_float(tangent_accessor, vi, tangent, 4);
-                    
-                    // Apply node rotation to tangent
-                    float tx = node_matrix[0]*tangent[0] + node_matrix[4]*tangent[1] + node_matrix[8]*tangent[2];
-                    float ty = node_matrix[1]*tangent[0] + node_matrix[5]*tangent[1] + node_matrix[9]*tangent[2];
-                    float tz = node_matrix[2]*tangent[0] + node_matrix[6]*tangent[1] + node_matrix[10]*tangent[2];
-                    float len = sqrtf(tx*tx + ty*ty + tz*tz);
-                    if (len > 0.0001f) {
-                        vertices[vi].tangent[0] = tx / len;
-                        vertices[vi].tangent[1] = ty / len;
-                        vertices[vi].tangent[2] = tz / len;
-                    } else {
-                        vertices[vi].tangent[0] = 1;
-                        vertices[vi].tangent[1] = 0;
-                        vertices[vi].tangent[2] = 0;
+
+            // Read indices if available (Auto meshes need them to split out head triangles)
+            if (prim->indices || fp_flag == FIRST_PERSON_AUTO) {
+                std::vector<uint32_t> indices;
+                convert_indices(prim->indices, vertex_count, indices);
+                size_t index_count = indices.size();
+
+                size_t first_person_count = index_count;
+                if (fp_flag == FIRST_PERSON_AUTO) {
+                    first_person_count = split_first_person_triangles(node, prim, data, first_person, indices);
+                    index_count = indices.size();
+                    if (first_person_count == index_count) {
+                        fp_flag = FIRST_PERSON_BOTH;
+                    } else if (first_person_count == 0) {
+                        fp_flag = FIRST_PERSON_THIRD_PERSON_ONLY;
                     }
-                    vertices[vi].tangent[3] = tangent[3];  // Sign for bitangent
-                }
-            } else {
-                // Generate default tangent if not present
-                for (size_t vi = 0; vi < vertex_count; vi++) {
-                    vertices[vi].tangent[0] = 1;
-                    vertices[vi].tangent[1] = 0;
-                    vertices[vi].tangent[2] = 0;
-                    vertices[vi].tangent[3] = 1;
                 }
+
+                batch.indices = std::move(indices);
+                batch.first_person_index_count = (int)first_person_count;
             }
-            
-            // Create render mesh
-            RenderMesh render_mesh = {};
-            
-            // Create vertex buffer
-            sg_buffer_desc vbuf_desc = {};
-            vbuf_desc.data = { vertices.data(), vertices.size() * sizeof(Vertex) };
-            vbuf_desc.label = "mesh-vertices";
-            render_mesh.vertex_buffer = sg_make_buffer(&vbuf_desc);
-            render_mesh.num_vertices = (int)vertex_count;
-            
-            // Read indices if available
-            if (prim->indices) {
-                size_t index_count = prim->indices->count;
-                std::vector<uint32_t> indices(index_count);
-                
-                for (size_t ii = 0; ii < index_count; ii++) {
-                    indices[ii] = (uint32_t)cgltf_accessor_read_index(prim->indices, ii);
-                }
-                
-                sg_buffer_desc ibuf_desc = {};
-                ibuf_desc.usage.index_buffer = true;
-                ibuf_desc.data = { indices.data(), indices.size() * sizeof(uint32_t) };
-                ibuf_desc.label = "mesh-indices";
-                render_mesh.index_buffer = sg_make_buffer(&ibuf_desc);
-                render_mesh.num_indices = (int)index_count;
-                render_mesh.has_indices = true;
-            } else {
-                render_mesh.has_indices = false;
+            batch.first_person = fp_flag;
+
+            int num_triangles = (int)(batch.indices.empty() ? vertex_count : batch.indices.size()) / 3;
+            state.model.num_triangles += num_triangles;
+            if (fp_flag == FIRST_PERSON_THIRD_PERSON_ONLY) {
+                state.model.num_head_triangles += num_triangles;
+            } else if (fp_flag == FIRST_PERSON_AUTO) {
+                state.model.num_head_triangles += (int)(batch.indices.size() - batch.first_person_index_count) / 3;
             }
             
             // Initialize PBR material with defaults
@@ -1114,9 +2299,29 @@ static bool load_model(const char* filepath) {
             material.emissive_factor = HMM_V3(0.0f, 0.0f, 0.0f);
             
             material.is_vrm = state.is_vrm_model;
-            material.toon_ramp_steps = 4.0f;
-            material.toon_rim_power = 2.0f;
-            material.toon_rim_strength = 0.5f;
+            material.shade_multiply_tex = state.default_texture;
+            material.shade_multiply_view = state.default_texture_view;
+            material.rim_multiply_tex = state.default_texture;
+            material.rim_multiply_view = state.default_texture_view;
+            material.matcap_tex = state.default_texture;
+            material.matcap_view = state.default_texture_view;
+            material.toon_material_index = prim->material ? (int)(prim->material - data->materials) + 1 : 0;
+
+            // MToon textures select the textured toon variant
+            const ToonMaterialImport& toon = toon_imports[material.toon_material_index];
+            material.mtoon_features = toon.features;
+            if (toon.shade_multiply_image >= 0) {
+                material.shade_multiply_tex = textures[toon.shade_multiply_image];
+                material.shade_multiply_view = texture_views[toon.shade_multiply_image];
+            }
+            if (toon.rim_multiply_image >= 0) {
+                material.rim_multiply_tex = textures[toon.rim_multiply_image];
+                material.rim_multiply_view = texture_views[toon.rim_multiply_image];
+            }
+            if (toon.matcap_image >= 0) {
+                material.matcap_tex = textures[toon.matcap_image];
+                material.matcap_view = texture_views[toon.matcap_image];
+            }
             
             // Load PBR material from GLTF
             if (prim->material) {
@@ -1201,14 +2406,125 @@ static bool load_model(const char* filepath) {
                     mat->emissive_factor[2]
                 );
             }
+
+            // Atlased materials sample the atlas wherever they sampled the base color image
+            if (atlas_rect >= 0) {
+                material.base_color_tex = atlas_image;
+                material.base_color_view = atlas_view;
+                if (toon.shade_multiply_image >= 0) {
+                    material.shade_multiply_tex = atlas_image;
+                    material.shade_multiply_view = atlas_view;
+                }
+                if (toon.rim_multiply_image >= 0) {
+                    material.rim_multiply_tex = atlas_image;
+                    material.rim_multiply_view = atlas_view;
+                }
+            }
             
-            render_mesh.material = material;
-            
-            state.model.meshes.push_back(render_mesh);
+            // Non-indexed primitives repeat every shared vertex: weld identical
+            // vertices and draw them indexed
+            if (!prim->indices) {
+                std::vector<uint32_t> remap(vertex_count);
+                size_t unique = weld_vertices(vertices.data(), vertex_count, sizeof(Vertex), remap.data());
+                vertices.resize(unique);
+                if (batch.indices.empty()) {
+                    batch.indices = std::move(remap);
+                    batch.first_person_index_count = (int)batch.indices.size();
+                } else {
+                    for (uint32_t& index : batch.indices) {
+                        index = remap[index];
+                    }
+                }
+                welded_vertices_before += vertex_count;
+                welded_vertices_after += unique;
+            }
+
+            batch.material_index = add_material(state.model, material);
+            if (prim->material && prim->material->name) {
+                batch.material_name = prim->material->name;
+            }
+            const char* node_name = node->name ? node->name : (mesh->name ? mesh->name : "node");
+            batch.sources.push_back(std::string(node_name) + "#" + std::to_string(pi));
+            bool is_static = !node->skin && !animated_nodes[ni] && prim->targets_count == 0;
+            batch.scope = is_static ? -1 : (int)ni;
+            primitive_batches.push_back(std::move(batch));
+            num_primitives++;
+        }
+    }
+    convert_zone.end();
+
+    std::vector<MeshBatch> mesh_batches = assemble_mesh_batches(primitive_batches, pools);
+    primitive_batches.clear();
+
+    if (!mesh_batches.empty()) {
+        parallelutil::queue_based_parallel_for((int)mesh_batches.size(), [&](int i) {
+            TRACE_ZONE("optimize batch");
+            optimize_mesh_batch(mesh_batches[i], pools[mesh_batches[i].pool].size());
+        });
+    }
+
+    // Model triangles over the final draws, for the BVH that the occlusion
+    // bake and picking trace. A bake read from the model cache leaves the
+    // build to the first pick.
+    std::vector<size_t> pool_base;
+    gather_model_triangles(mesh_batches, pools, pool_base, state.model.triangle_positions,
+                           state.model.triangle_indices, state.model.draw_first_triangle);
+    bool occlusion_cached = false;
+    OcclusionBakeStats occlusion_stats =
+        bake_model_occlusion(state.model, pool_base, pools, cache, state.occlusion_bake,
+                             HMM_LenV3(HMM_SubV3(max_bounds, min_bounds)), &occlusion_cached);
+    if (state.model.bvh_built) {
+        release_model_triangles(state.model);
+    }
+    if (!model_cache_save(cache)) {
+        log_write(LOG_WARN, "Failed to write model cache", { log_str("path", cache.path.c_str()) });
+    }
+    TRACE_ZONE("upload meshes");
+    std::vector<sg_buffer> pool_buffers(pools.size());
+    size_t uploaded_vertices = 0;
+    for (size_t p = 0; p < pools.size(); p++) {
+        if (pools[p].empty()) {
+            continue;
         }
+        sg_buffer_desc vbuf_desc = {};
+        vbuf_desc.data = { pools[p].data(), pools[p].size() * sizeof(Vertex) };
+        vbuf_desc.label = "mesh-vertices";
+        pool_buffers[p] = sg_make_buffer(&vbuf_desc);
+        state.model.vertex_buffers.push_back(pool_buffers[p]);
+        uploaded_vertices += pools[p].size();
+    }
+    int static_draws = 0;
+    for (const MeshBatch& batch : mesh_batches) {
+        state.model.meshes.push_back(upload_mesh_batch(batch, pool_buffers[batch.pool], pools[batch.pool].size()));
+        static_draws += batch.scope < 0 ? 1 : 0;
     }
     
     cgltf_free(data);
+
+    // Images whose materials were all skipped (no positions) are dropped now
+    for (auto it = state.model.textures.begin(); it != state.model.textures.end();) {
+        if (it->second.ref_count == 0) {
+            drop_pending_texture(state.model, it->second.image);
+            sg_destroy_view(it->second.view);
+            sg_destroy_image(it->second.image);
+            it = state.model.textures.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // Upload the toon parameter table; draws index it by toon_material_index
+    sg_buffer_desc material_buf_desc = {};
+    material_buf_desc.usage.storage_buffer = true;
+    material_buf_desc.data.ptr = state.model.toon_materials.data();
+    material_buf_desc.data.size = state.model.toon_materials.size() * sizeof(ToonMaterialRow);
+    material_buf_desc.label = "toon-materials";
+    state.model.toon_material_buffer = sg_make_buffer(&material_buf_desc);
+
+    sg_view_desc material_view_desc = {};
+    material_view_desc.storage_buffer.buffer = state.model.toon_material_buffer;
+    material_view_desc.label = "toon-materials-view";
+    state.model.toon_material_view = sg_make_view(&material_view_desc);
     
     // Calculate model center and radius
     state.model.center = HMM_MulV3F(HMM_AddV3(min_bounds, max_bounds), 0.5f);
@@ -1225,23 +2541,465 @@ static bool load_model(const char* filepath) {
     state.cam_elevation = 15.0f;
     state.cam_azimuth = 45.0f;
     
-    log_message(("Loaded " + std::to_string(state.model.meshes.size()) + " mesh(es)").c_str());
+    log_write(LOG_INFO, "Model primitives", { log_int("primitives", (int64_t)num_primitives),
+                                              log_int("draws", (int64_t)state.model.meshes.size()),
+                                              log_int("merged_static", (int64_t)static_draws) });
+    log_write(LOG_INFO, "Vertex buffers", { log_int("buffers", (int64_t)state.model.vertex_buffers.size()),
+                                            log_int("vertices", (int64_t)uploaded_vertices),
+                                            log_int("shared_primitives", (int64_t)shared_primitives) });
+    if (!atlas.rects.empty()) {
+        log_write(LOG_INFO, "Atlased base color images", { log_int("images", (int64_t)atlas.rects.size()),
+                                                           log_int("width", atlas.width),
+                                                           log_int("height", atlas.height) });
+    }
+    log_write(LOG_INFO, "Materials", { log_int("unique", (int64_t)state.model.materials.size()),
+                                       log_int("textures", (int64_t)state.model.textures.size()),
+                                       log_int("shared_images", (int64_t)shared_images) });
+    log_write(LOG_INFO, "Images", { log_int("decoded", (int64_t)decoded_images),
+                                    log_int("deferred", (int64_t)state.model.pending_textures.size()),
+                                    log_int("unreferenced", (int64_t)unreferenced_images) });
+    log_write(LOG_INFO, "Texture memory", { log_int("mib", (int64_t)(state.model.texture_bytes >> 20)),
+                                            log_int("downscaled", (int64_t)downscaled_images) });
+    if (welded_vertices_before > 0) {
+        log_write(LOG_INFO, "Welded non-indexed primitives",
+                  { log_int("vertices_before", (int64_t)welded_vertices_before),
+                    log_int("vertices_after", (int64_t)welded_vertices_after),
+                    log_float("ratio", (double)welded_vertices_before / (double)welded_vertices_after) });
+    }
+    if (generated_primitives + cached_primitives > 0) {
+        log_write(LOG_INFO, "Normals/tangents", { log_int("generated", (int64_t)generated_primitives),
+                                                  log_int("cached", (int64_t)cached_primitives) });
+    }
+    if (occlusion_cached) {
+        log_message("Vertex occlusion: read from model cache");
+    } else if (occlusion_stats.rays > 0) {
+        log_write(LOG_INFO, "Vertex occlusion",
+                  { log_int("rays", (int64_t)occlusion_stats.rays), log_float("ms", occlusion_stats.seconds * 1000.0),
+                    log_float("mrays_per_s", occlusion_stats.rays / std::max(occlusion_stats.seconds, 1e-9) * 1e-6) });
+    }
+    if (mtoon_count > 0) {
+        log_write(LOG_INFO, "Imported MToon materials", { log_int("count", (int64_t)mtoon_count) });
+    }
+    if (state.model.has_first_person) {
+        log_write(LOG_INFO, "First-person view", { log_int("hidden_triangles", (int64_t)state.model.num_head_triangles),
+                                                   log_int("triangles", (int64_t)state.model.num_triangles) });
+    }
+    if (alloc_tracking_enabled()) {
+        AllocStats allocs = alloc_stats(ALLOC_IMPORT);
+        log_write(LOG_INFO, "Import allocations",
+                  { log_int("allocs", (int64_t)(allocs.count - allocs_before.count)),
+                    log_float("mb", (allocs.bytes - allocs_before.bytes) / (1024.0 * 1024.0)),
+                    log_float("peak_mb", allocs.peak_live_bytes / (1024.0 * 1024.0)),
+                    log_float("kept_mb", allocs.live_bytes / (1024.0 * 1024.0)) });
+    }
+    state.load_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - load_start).count();
+    log_write(LOG_INFO, "Model loaded", { log_float("ms", state.load_ms) });
     state.model_loaded = true;
+    state.steady_frames = 0;
     
     return true;
 }
 
+// ============================================================================
+// Scene lights
+// ============================================================================
+
+static_assert(sizeof(PunctualLight) == sizeof(pbr_punctual_light_t), "PunctualLight must match punctual_light");
+static_assert(sizeof(PunctualLight) == sizeof(toon_punctual_light_t), "PunctualLight must match punctual_light");
+
+static HMM_Vec3 hue_color(float hue) {
+    HMM_Vec3 c = HMM_V3(fabsf(hue * 6.0f - 3.0f) - 1.0f, 2.0f - fabsf(hue * 6.0f - 2.0f), 2.0f - fabsf(hue * 6.0f - 4.0f));
+    return HMM_V3(HMM_Clamp(0.0f, c.X, 1.0f), HMM_Clamp(0.0f, c.Y, 1.0f), HMM_Clamp(0.0f, c.Z, 1.0f));
+}
+
+// Lay the staging rig out around the model: lights spread over a cylinder
+// by the golden angle, every third one a spot aimed at the model's center
+static void place_staging_lights(float time) {
+    const StagingLights& rig = state.staging_lights;
+    HMM_Vec3 center = state.model_loaded ? state.model.center : HMM_V3(0.0f, 0.0f, 0.0f);
+    float radius = state.model_loaded ? state.model.radius : 1.0f;
+    float brightness = rig.intensity * (radius * 0.5f) * (radius * 0.5f);
+    state.lights.resize(std::clamp(rig.count, 0, CLUSTER_MAX_SCENE_LIGHTS));
+    for (int i = 0; i < (int)state.lights.size(); i++) {
+        float golden = fmodf(i * 0.618034f, 1.0f);
+        float orbit = rig.animate ? time * (i % 2 ? 0.4f : -0.3f) : 0.0f;
+        float angle = i * 2.399963f + orbit;
+        float distance = radius * (0.5f + 0.5f * (float)(i % 5) / 4.0f);
+        HMM_Vec3 position = HMM_V3(center.X + sinf(angle) * distance, center.Y + radius * (golden * 1.8f - 0.9f),
+                                   center.Z + cosf(angle) * distance);
+        HMM_Vec3 color = HMM_MulV3F(hue_color(fmodf(i * 0.381966f, 1.0f)), brightness);
+        float range = radius * rig.range_fraction;
+        if (i % 3 == 2) {
+            HMM_Vec3 direction = HMM_SubV3(center, position);
+            punctual_light_spot(state.lights[i], position.Elements, direction.Elements, range * 2.0f, color.Elements,
+                                15.0f * HMM_DegToRad, 30.0f * HMM_DegToRad);
+        } else {
+            punctual_light_point(state.lights[i], position.Elements, range, color.Elements);
+        }
+    }
+}
+
+// Bin this frame's lights into froxels and stream the lists to the GPU
+static void assign_lights(const HMM_Mat4& view, const HMM_Mat4& proj) {
+    state.light_stats = {};
+    if (state.lights.empty()) {
+        return;
+    }
+    ClusterFrustum frustum = {};
+    memcpy(frustum.view, view.Elements, sizeof(frustum.view));
+    frustum.proj_x = proj.Elements[0][0];
+    frustum.proj_y = proj.Elements[1][1];
+    frustum.z_near = 0.1f;  // Closer pixels all fall in slice 0
+    frustum.z_far = 1000.0f;
+    cluster_fit_depth(frustum, state.lights.data(), state.lights.size());
+    state.light_stats = cluster_assign_lights(state.light_grid, frustum, state.lights.data(), state.lights.size());
+
+    sg_update_buffer(state.light_buffer, { state.lights.data(), state.lights.size() * sizeof(PunctualLight) });
+    sg_update_buffer(state.light_cluster_buffer,
+                     { state.light_grid.ranges.data(), state.light_grid.ranges.size() * sizeof(uint32_t) });
+    if (!state.light_grid.indices.empty()) {
+        sg_update_buffer(state.light_index_buffer,
+                         { state.light_grid.indices.data(), state.light_grid.indices.size() * sizeof(uint32_t) });
+    }
+}
+
+// Storage buffer refreshed every frame, with its view
+static sg_buffer make_stream_storage_buffer(size_t size, const char* label, sg_view* view) {
+    sg_buffer_desc buf_desc = {};
+    buf_desc.usage.storage_buffer = true;
+    buf_desc.usage.stream_update = true;
+    buf_desc.size = size;
+    buf_desc.label = label;
+    sg_buffer buffer = sg_make_buffer(&buf_desc);
+
+    sg_view_desc view_desc = {};
+    view_desc.storage_buffer.buffer = buffer;
+    *view = sg_make_view(&view_desc);
+    return buffer;
+}
+
+// ============================================================================
+// Camera
+// ============================================================================
+
+// First-person annotations: meshes hidden from the current view
+static bool mesh_hidden(const RenderMesh& mesh) {
+    FirstPersonFlag hidden_flag = state.first_person ? FIRST_PERSON_THIRD_PERSON_ONLY : FIRST_PERSON_FIRST_PERSON_ONLY;
+    return mesh.first_person == hidden_flag;
+}
+
+static void draw_render_mesh(const RenderMesh& mesh) {
+    int elements = mesh.num_vertices;
+    if (mesh.has_indices) {
+        bool skip_head = state.first_person && mesh.first_person == FIRST_PERSON_AUTO;
+        elements = skip_head ? mesh.first_person_index_count : mesh.num_indices;
+    }
+    sg_draw(0, elements, 1);
+    state.frame_draws++;
+    state.frame_triangles += elements / 3;
+}
+
+// ============================================================================
+// Picking
+// ============================================================================
+
+static int mesh_of_triangle(const Model& model, uint32_t triangle) {
+    return (int)(std::upper_bound(model.draw_first_triangle.begin(), model.draw_first_triangle.end(), triangle) -
+                 model.draw_first_triangle.begin()) - 1;
+}
+
+// Only triangles drawn in the current view can be picked
+static bool pick_filter(uint32_t triangle, void* user) {
+    const Model& model = *(const Model*)user;
+    int mesh_index = mesh_of_triangle(model, triangle);
+    const RenderMesh& mesh = model.meshes[mesh_index];
+    if (mesh_hidden(mesh)) {
+        return false;
+    }
+    bool skip_head = state.first_person && mesh.first_person == FIRST_PERSON_AUTO;
+    return !skip_head || (triangle - model.draw_first_triangle[mesh_index]) * 3 < (uint32_t)mesh.first_person_index_count;
+}
+
+static const char* pixel_format_name(sg_pixel_format format) {
+    switch (format) {
+        case SG_PIXELFORMAT_RGBA8: return "RGBA8";
+        case SG_PIXELFORMAT_SRGB8A8: return "SRGB8A8";
+        case SG_PIXELFORMAT_RGBA16F: return "RGBA16F";
+        case SG_PIXELFORMAT_RGBA32F: return "RGBA32F";
+        case SG_PIXELFORMAT_BC7_RGBA: return "BC7";
+        default: return "other";
+    }
+}
+
+static void add_pick_row(const char* label, const char* format, ...) {
+    if (state.pick_row_count >= GUI_MAX_PICK_ROWS) return;
+    InspectRow& row = state.pick_rows[state.pick_row_count++];
+    snprintf(row.label, sizeof(row.label), "%s", label);
+    va_list args;
+    va_start(args, format);
+    vsnprintf(row.value, sizeof(row.value), format, args);
+    va_end(args);
+}
+
+// Describe the picked draw: what it merges, its material, the textures the
+// active shader samples and a rough cost (triangles and texture footprint)
+static void describe_picked_mesh(uint32_t triangle, double pick_ms) {
+    state.pick_row_count = 0;
+    const RenderMesh& mesh = state.model.meshes[state.picked_mesh];
+    const PBRMaterial& material = state.model.materials[mesh.material_index];
+    const char* shader = !state.use_toon_shader ? "PBR" : (material.mtoon_features ? "MToon" : "Toon");
+    add_pick_row("Draw:", "%d of %d, %s", state.picked_mesh + 1, (int)state.model.meshes.size(), shader);
+    add_pick_row("Material:", "%s", mesh.material_name.c_str());
+    add_pick_row("Primitives:", "%s", mesh.source.c_str());
+    add_pick_row("Triangles:", "%d (hit #%u)", mesh.num_indices / 3,
+                 triangle - state.model.draw_first_triangle[state.picked_mesh]);
+
+    struct Slot {
+        const char* label;
+        sg_image image;
+        bool sampled;
+    };
+    bool toon = state.use_toon_shader;
+    Slot slots[] = {
+        { "Base:", material.base_color_tex, true },
+        { "MetalRough:", material.metallic_roughness_tex, true },
+        { "Normal:", material.normal_tex, true },
+        { "Occlusion:", material.occlusion_tex, !toon },
+        { "Emissive:", material.emissive_tex, !toon },
+        { "Shade:", material.shade_multiply_tex, toon && (material.mtoon_features & MTOON_FEATURE_SHADE_TEXTURE) },
+        { "Rim:", material.rim_multiply_tex, toon && (material.mtoon_features & MTOON_FEATURE_RIM_TEXTURE) },
+        { "Matcap:", material.matcap_tex, toon && (material.mtoon_features & MTOON_FEATURE_MATCAP_TEXTURE) },
+    };
+    double texture_mb = 0.0;
+    sg_image counted[8];
+    int counted_count = 0;
+    for (const Slot& slot : slots) {
+        if (!slot.sampled || state.model.textures.find(slot.image.id) == state.model.textures.end()) {
+            continue;  // Default texture
+        }
+        int width = sg_query_image_width(slot.image);
+        int height = sg_query_image_height(slot.image);
+        if (width == 0) {
+            add_pick_row(slot.label, "not decoded yet");
+            continue;
+        }
+        int mips = sg_query_image_num_mipmaps(slot.image);
+        add_pick_row(slot.label, "%dx%d %s, %d mip(s)", width, height,
+                     pixel_format_name(sg_query_image_pixelformat(slot.image)), mips);
+        bool seen = false;
+        for (int i = 0; i < counted_count; i++) {
+            seen = seen || counted[i].id == slot.image.id;
+        }
+        if (!seen) {
+            counted[counted_count++] = slot.image;
+            texture_mb += width * height * 4.0 * (mips > 1 ? 4.0 / 3.0 : 1.0) / (1024.0 * 1024.0);
+        }
+    }
+    add_pick_row("Est. cost:", "%d tris, %d tex, %.1f MiB", mesh.num_indices / 3, counted_count, texture_mb);
+    add_pick_row("Pick:", "%.3f ms", pick_ms);
+}
+
+static void pick_at(float x, float y) {
+    state.picked_mesh = -1;
+    state.pick_row_count = 0;
+    if (!state.model_loaded) return;
+
+    // Unproject the click to a world-space ray (zero-to-one depth range)
+    float ndc_x = 2.0f * x / sapp_widthf() - 1.0f;
+    float ndc_y = 1.0f - 2.0f * y / sapp_heightf();
+    HMM_Mat4 inv_view_proj = HMM_InvGeneralM4(state.view_proj);
+    HMM_Vec4 near_point = HMM_MulM4V4(inv_view_proj, HMM_V4(ndc_x, ndc_y, 0.0f, 1.0f));
+    HMM_Vec4 far_point = HMM_MulM4V4(inv_view_proj, HMM_V4(ndc_x, ndc_y, 1.0f, 1.0f));
+    HMM_Vec3 origin = HMM_DivV3F(near_point.XYZ, near_point.W);
+    HMM_Vec3 dir = HMM_SubV3(HMM_DivV3F(far_point.XYZ, far_point.W), origin);
+
+    if (!state.model.bvh_built) {
+        build_model_bvh(state.model);
+        release_model_triangles(state.model);
+    }
+    auto start = std::chrono::steady_clock::now();
+    BvhHit hit;
+    bool found = bvh_intersect(state.model.bvh, origin.Elements, dir.Elements, 1.0f, pick_filter, &state.model, &hit);
+    double pick_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    if (found) {
+        state.picked_mesh = mesh_of_triangle(state.model, hit.triangle);
+        describe_picked_mesh(hit.triangle, pick_ms);
+    }
+}
+
+static void reset_camera() {
+    state.cam_target = state.model.center;
+    state.cam_distance = state.model.radius * 2.5f;
+    state.cam_elevation = 15.0f;
+    state.cam_azimuth = 45.0f;
+}
+
+// Switch between the orbit camera and the VRM first-person head camera
+static void set_first_person(bool enabled) {
+    enabled = enabled && state.model_loaded && state.model.has_first_person;
+    if (enabled == state.first_person) return;
+    
+    state.first_person = enabled;
+    if (enabled) {
+        state.cam_azimuth = state.model.forward_azimuth;
+        state.cam_elevation = 0.0f;
+    } else {
+        reset_camera();
+    }
+}
+
 // ============================================================================
 // Sokol callbacks
 // ============================================================================
 
+// ============================================================================
+// Input recording and replay
+// ============================================================================
+
+// Replays advance state.time by this much per frame, whatever the display
+#define REPLAY_FRAME_DURATION (1.0 / 60.0)
+
+static void handle_event(const sapp_event* ev, const char* dropped_file);
+
+// Record or replay as the options ask; a replay wins over recording. A
+// benchmark without a replay runs an empty one of --bench-frames frames.
+static void start_input_capture() {
+    const ViewerOptions& options = state.options;
+    if (!options.replay_path.empty()) {
+        std::string error;
+        if (!input_recording_load(options.replay_path.c_str(), state.recording, error)) {
+            log_write(LOG_ERROR, error.c_str());
+            return;
+        }
+        size_t slash = options.replay_path.find_last_of("/\\");
+        state.replay_name = slash == std::string::npos ? options.replay_path : options.replay_path.substr(slash + 1);
+        log_write(LOG_INFO, "Replaying input", { log_int("events", (int64_t)state.recording.events.size()),
+                                                 log_int("frames", state.recording.frames),
+                                                 log_str("path", options.replay_path.c_str()) });
+    } else if (!options.bench_path.empty()) {
+        state.recording = InputRecording();
+        state.recording.frames = (uint32_t)options.bench_frames;
+        state.replay_name = "idle";
+        log_write(LOG_INFO, "Timing frames without input", { log_int("frames", state.recording.frames) });
+    } else {
+        if (!options.record_path.empty()) {
+            state.record_path = options.record_path;
+            log_write(LOG_INFO, "Recording input", { log_str("path", state.record_path.c_str()) });
+        }
+        return;
+    }
+    state.bench_path = options.bench_path;
+    state.replaying = true;
+    state.replay_next = 0;
+    state.replay_frame_ms.reserve(state.recording.frames);
+    state.replay_input_ms.reserve(state.recording.frames);
+}
+
+// Deliver the recorded events due before this frame, as event() would have
+static void replay_input() {
+    TRACE_ZONE("replay input");
+    AllocScope alloc_scope(ALLOC_OTHER);
+    const std::vector<RecordedEvent>& events = state.recording.events;
+    while (state.replay_next < events.size() && events[state.replay_next].frame <= state.frame_index) {
+        const RecordedEvent& recorded = events[state.replay_next++];
+        handle_event(&recorded.event, recorded.dropped_file.c_str());
+    }
+}
+
+// Summarize the replay's frame times, write the benchmark report if one was
+// asked for and quit; without one the viewer goes back to live input
+static void finish_replay() {
+    state.replaying = false;
+    BenchStats stats = bench_stats(state.replay_frame_ms);
+    log_write(LOG_INFO, "Replay CPU ms per frame",
+              { log_int("frames", (int64_t)state.replay_frame_ms.size()), log_float("p50", stats.median),
+                log_float("p90", stats.p90), log_float("p99", stats.p99), log_float("max", stats.max) });
+    if (state.bench_path.empty()) {
+        return;
+    }
+
+    std::vector<BenchResult> results = {
+        { "replay/" + state.replay_name + "/frame", 1.0, state.replay_frame_ms },
+        { "replay/" + state.replay_name + "/input", 0.0, state.replay_input_ms },
+    };
+    nlohmann::ordered_json settings;
+    settings["replay"] = state.replay_name;
+    settings["frames"] = state.recording.frames;
+    if (bench_write_json(state.bench_path.c_str(), settings, results)) {
+        log_write(LOG_INFO, "Wrote replay benchmark", { log_str("path", state.bench_path.c_str()) });
+    } else {
+        log_write(LOG_ERROR, "Failed to write replay benchmark", { log_str("path", state.bench_path.c_str()) });
+        state.bench_failed = true;
+    }
+    sapp_request_quit();
+}
+
+// Start a timeline capture, or write out the one running
+static void toggle_trace() {
+    if (!trace_enabled()) {
+        trace_start();
+        log_write(LOG_INFO, "Tracing; press P again to write it", { log_str("path", state.trace_path.c_str()) });
+        return;
+    }
+    int zones = trace_write_chrome_json(state.trace_path.c_str());
+    if (zones < 0) {
+        log_write(LOG_ERROR, "Failed to write trace", { log_str("path", state.trace_path.c_str()) });
+    } else {
+        log_write(LOG_INFO, "Wrote trace", { log_int("zones", zones), log_str("path", state.trace_path.c_str()) });
+    }
+}
+
+// The shader headers have no dummy-backend variant; the headless build
+// creates its shaders from the GL one, which has the same bindings
+static sg_backend shader_backend() {
+#ifdef VRM_VIEWER_HEADLESS
+    return SG_BACKEND_GLCORE;
+#else
+    return sg_query_backend();
+#endif
+}
+
+// sokol-gfx's logger: counts errors and panics, then logs as slog_func does
+static void gfx_log(const char* tag, uint32_t log_level, uint32_t log_item, const char* message, uint32_t line_nr,
+                    const char* filename, void* user_data) {
+    if (log_level <= 1) {
+        state.gfx_errors++;
+    }
+    slog_func(tag, log_level, log_item, message, line_nr, filename, user_data);
+}
+
 static void init() {
+    // Log lines are written by a background thread from here on
+    log_set_thread_name("main");
+    log_set_level(state.options.log_level);
+    log_start("[VRM Viewer] ");
+    if (!state.options.log_json_path.empty() && !log_open_json(state.options.log_json_path.c_str())) {
+        log_write(LOG_ERROR, "Failed to open JSON log", { log_str("path", state.options.log_json_path.c_str()) });
+    }
     log_message("Initializing...");
+
+    // --trace <file.json> traces from startup; P toggles it later
+    trace_set_thread_name("main");
+    const std::string& trace_path = state.options.trace_path;
+    state.trace_path = !trace_path.empty() ? trace_path : "vrm_viewer_trace.json";
+    if (!trace_path.empty()) {
+        trace_start();
+    }
     
     // Setup sokol-gfx
     sg_desc desc = {};
     desc.environment = sglue_environment();
-    desc.logger.func = slog_func;
+    desc.logger.func = gfx_log;
+    desc.buffer_pool_size = GFX_BUFFER_POOL_SIZE;
+    desc.image_pool_size = GFX_IMAGE_POOL_SIZE;
+    desc.view_pool_size = GFX_VIEW_POOL_SIZE;
+    desc.allocator.alloc_fn = [](size_t size, void*) { return alloc_track_malloc(size); };
+    desc.allocator.free_fn = [](void* ptr, void*) { alloc_track_free(ptr); };
+#ifdef VRM_VIEWER_HEADLESS
+    // The dummy backend reports no storage buffers and 1024 pixel textures,
+    // which the validation layer would reject; nothing is drawn anyway
+    desc.disable_validation = true;
+#endif
     sg_setup(&desc);
     
     // Initialize GUI (Clay-based)
@@ -1279,18 +3037,8 @@ static void init() {
     smp_desc.wrap_v = SG_WRAP_REPEAT;
     state.smp = sg_make_sampler(&smp_desc);
     
-    // Cubemap sampler for IBL
-    sg_sampler_desc cubemap_smp_desc = {};
-    cubemap_smp_desc.min_filter = SG_FILTER_LINEAR;
-    cubemap_smp_desc.mag_filter = SG_FILTER_LINEAR;
-    cubemap_smp_desc.wrap_u = SG_WRAP_CLAMP_TO_EDGE;
-    cubemap_smp_desc.wrap_v = SG_WRAP_CLAMP_TO_EDGE;
-    cubemap_smp_desc.wrap_w = SG_WRAP_CLAMP_TO_EDGE;
-    sg_sampler cubemap_smp = sg_make_sampler(&cubemap_smp_desc);
-    
     // Load HDR environment and create IBL maps (generates environment cubemap + IBL maps)
-    const char* hdr_path = "assets/hdr/modern_evening_street_2k.hdr";
-    create_ibl_maps(hdr_path);
+    create_ibl_maps(state.options.hdr_path.c_str(), state.options.ibl);
     
     // Create skybox geometry
     float skybox_vertices[] = {
@@ -1313,38 +3061,66 @@ static void init() {
     skybox_ibuf_desc.label = "skybox-indices";
     state.skybox_index_buffer = sg_make_buffer(&skybox_ibuf_desc);
     
+    // Clustered light lists, sized for the worst case so they never grow
+    state.light_buffer = make_stream_storage_buffer(CLUSTER_MAX_SCENE_LIGHTS * sizeof(PunctualLight), "punctual-lights",
+                                                    &state.light_view);
+    state.light_cluster_buffer = make_stream_storage_buffer(CLUSTER_COUNT * 2 * sizeof(uint32_t), "light-clusters",
+                                                            &state.light_cluster_view);
+    state.light_index_buffer = make_stream_storage_buffer(CLUSTER_COUNT * CLUSTER_MAX_LIGHTS * sizeof(uint32_t),
+                                                          "light-indices", &state.light_index_view);
+    
     // Create PBR shader
-    sg_shader pbr_shd = sg_make_shader(pbr_pbr_shader_desc(sg_query_backend()));
+    sg_shader pbr_shd = sg_make_shader(pbr_pbr_shader_desc(shader_backend()));
     sg_pipeline_desc pbr_pip_desc = {};
     pbr_pip_desc.shader = pbr_shd;
     pbr_pip_desc.layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3;  // position
     pbr_pip_desc.layout.attrs[1].format = SG_VERTEXFORMAT_FLOAT3;  // normal
     pbr_pip_desc.layout.attrs[2].format = SG_VERTEXFORMAT_FLOAT2;  // uv
     pbr_pip_desc.layout.attrs[3].format = SG_VERTEXFORMAT_FLOAT4;  // tangent
+    pbr_pip_desc.layout.attrs[4].format = SG_VERTEXFORMAT_FLOAT;   // occlusion
     pbr_pip_desc.index_type = SG_INDEXTYPE_UINT32;
     pbr_pip_desc.cull_mode = SG_CULLMODE_NONE;
     pbr_pip_desc.depth.write_enabled = true;
     pbr_pip_desc.depth.compare = SG_COMPAREFUNC_LESS_EQUAL;
     pbr_pip_desc.label = "pbr-pipeline";
     state.pbr_pip = sg_make_pipeline(&pbr_pip_desc);
+
+    // Same layout, clustered point/spot lights added
+    pbr_pip_desc.shader = sg_make_shader(pbr_pbr_clustered_shader_desc(shader_backend()));
+    pbr_pip_desc.label = "pbr-clustered-pipeline";
+    state.pbr_clustered_pip = sg_make_pipeline(&pbr_pip_desc);
     
     // Create toon shader
-    sg_shader toon_shd = sg_make_shader(toon_toon_shader_desc(sg_query_backend()));
+    sg_shader toon_shd = sg_make_shader(toon_toon_shader_desc(shader_backend()));
     sg_pipeline_desc toon_pip_desc = {};
     toon_pip_desc.shader = toon_shd;
     toon_pip_desc.layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3;  // position
     toon_pip_desc.layout.attrs[1].format = SG_VERTEXFORMAT_FLOAT3;  // normal
     toon_pip_desc.layout.attrs[2].format = SG_VERTEXFORMAT_FLOAT2;  // uv
     toon_pip_desc.layout.attrs[3].format = SG_VERTEXFORMAT_FLOAT4;  // tangent
+    toon_pip_desc.layout.attrs[4].format = SG_VERTEXFORMAT_FLOAT;   // occlusion
     toon_pip_desc.index_type = SG_INDEXTYPE_UINT32;
     toon_pip_desc.cull_mode = SG_CULLMODE_NONE;
     toon_pip_desc.depth.write_enabled = true;
     toon_pip_desc.depth.compare = SG_COMPAREFUNC_LESS_EQUAL;
     toon_pip_desc.label = "toon-pipeline";
     state.toon_pip = sg_make_pipeline(&toon_pip_desc);
+
+    // Same layout, MToon shade/rim/matcap textures enabled
+    toon_pip_desc.shader = sg_make_shader(toon_mtoon_shader_desc(shader_backend()));
+    toon_pip_desc.label = "mtoon-pipeline";
+    state.mtoon_pip = sg_make_pipeline(&toon_pip_desc);
+
+    // Both toon variants with the clustered point/spot lights
+    toon_pip_desc.shader = sg_make_shader(toon_toon_clustered_shader_desc(shader_backend()));
+    toon_pip_desc.label = "toon-clustered-pipeline";
+    state.toon_clustered_pip = sg_make_pipeline(&toon_pip_desc);
+    toon_pip_desc.shader = sg_make_shader(toon_mtoon_clustered_shader_desc(shader_backend()));
+    toon_pip_desc.label = "mtoon-clustered-pipeline";
+    state.mtoon_clustered_pip = sg_make_pipeline(&toon_pip_desc);
     
     // Create skybox shader
-    sg_shader skybox_shd = sg_make_shader(skybox_skybox_shader_desc(sg_query_backend()));
+    sg_shader skybox_shd = sg_make_shader(skybox_skybox_shader_desc(shader_backend()));
     sg_pipeline_desc skybox_pip_desc = {};
     skybox_pip_desc.shader = skybox_shd;
     skybox_pip_desc.layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3;  // position
@@ -1356,12 +3132,13 @@ static void init() {
     state.skybox_pip = sg_make_pipeline(&skybox_pip_desc);
     
     // Old simple pipeline (kept for compatibility)
-    sg_shader shd = sg_make_shader(mesh_mesh_shader_desc(sg_query_backend()));
+    sg_shader shd = sg_make_shader(mesh_mesh_shader_desc(shader_backend()));
     sg_pipeline_desc pip_desc = {};
     pip_desc.shader = shd;
     pip_desc.layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3;  // position
     pip_desc.layout.attrs[1].format = SG_VERTEXFORMAT_FLOAT3;  // normal
     pip_desc.layout.attrs[2].format = SG_VERTEXFORMAT_FLOAT2;  // uv
+    pip_desc.layout.buffers[0].stride = sizeof(Vertex);
     pip_desc.index_type = SG_INDEXTYPE_UINT32;
     pip_desc.cull_mode = SG_CULLMODE_NONE;
     pip_desc.depth.write_enabled = true;
@@ -1374,12 +3151,37 @@ static void init() {
     state.cam_azimuth = 45.0f;
     state.cam_elevation = 20.0f;
     state.cam_target = HMM_V3(0, 0, 0);
+    state.first_person = false;
     
     state.mouse_down = false;
+    state.picked_mesh = -1;
     state.time = 0.0f;
     state.model_loaded = false;
     state.is_vrm_model = false;
     state.use_toon_shader = false;
+
+    // Texture import limits
+    const ViewerOptions& options = state.options;
+    state.texture_import.max_size[TEXTURE_ROLE_BASE_COLOR] = options.texture_max_size;
+    state.texture_import.max_size[TEXTURE_ROLE_METALLIC_ROUGHNESS] = options.texture_detail_max_size;
+    state.texture_import.max_size[TEXTURE_ROLE_NORMAL] = options.texture_max_size;
+    state.texture_import.max_size[TEXTURE_ROLE_OCCLUSION] = options.texture_detail_max_size;
+    state.texture_import.max_size[TEXTURE_ROLE_EMISSIVE] = options.texture_detail_max_size;
+    state.texture_import.max_size[TEXTURE_ROLE_MTOON] = options.texture_detail_max_size;
+    state.texture_import.budget_bytes = (size_t)options.texture_budget_mb << 20;
+    state.texture_import.min_size = options.texture_min_size;
+    state.texture_import.atlas_source_max = options.atlas_max_size;
+    state.texture_import.atlas_padding = options.atlas_padding;
+
+    // Import-time vertex occlusion; the first load of a model pays for it
+    state.occlusion_bake.rays = options.occlusion_rays;
+    state.occlusion_bake.distance_fraction = 0.1f;
+
+    // Staging lights, off unless --lights or the GUI adds some
+    state.staging_lights.count = options.staging_lights;
+    state.staging_lights.intensity = 1.0f;
+    state.staging_lights.range_fraction = 0.75f;
+    state.staging_lights.animate = true;
     
     // Skybox settings
     state.skybox_lod = 0.0f;
@@ -1399,14 +3201,32 @@ static void init() {
     state.toon_spec_intensity = 0.3f;
     
     log_message("Ready. Drag and drop a VRM/GLTF/GLB file to load.");
-    log_message("Press 'G' to toggle GUI, 'S' to toggle skybox");
+    log_message("Press 'G' to toggle GUI, 'S' to toggle skybox, 'F' for first-person view, 'P' to trace, "
+                "'L' to cycle the log level");
+    if (!state.options.model.empty()) {
+        load_model(state.options.model.c_str());
+    }
+    start_input_capture();
 }
 
 static void frame() {
-    state.time += (float)sapp_frame_duration();
+    TRACE_ZONE("frame");
+    auto input_start = std::chrono::steady_clock::now();
+    if (state.replaying) {
+        replay_input();
+    }
+    auto frame_start = std::chrono::steady_clock::now();
+    AllocScope alloc_scope(ALLOC_FRAME);
+    AllocStats frame_allocs = alloc_stats(ALLOC_FRAME);
+    AllocStats gui_allocs = alloc_stats(ALLOC_GUI);
+    state.time += (float)(state.replaying ? REPLAY_FRAME_DURATION : sapp_frame_duration());
+    state.frame_draws = 0;
+    state.frame_triangles = 0;
     
     // Start new GUI frame
+    alloc_set_subsystem(ALLOC_GUI);
     gui_new_frame();
+    alloc_set_subsystem(ALLOC_FRAME);
     
     // Check if mouse is over GUI (for blocking 3D interactions)
     state.gui_hovered = state.show_gui && gui_is_hovered();
@@ -1426,17 +3246,31 @@ static void frame() {
         cos_elev * cos_azim * state.cam_distance
     );
     HMM_Vec3 cam_pos = HMM_AddV3(state.cam_target, cam_offset);
+    HMM_Vec3 look_target = state.cam_target;
+    if (state.first_person) {
+        // Look out from the head, opposite to where the orbit camera would sit
+        cam_pos = state.model.head_position;
+        look_target = HMM_SubV3(cam_pos, HMM_NormV3(cam_offset));
+    }
     
     // Build view and projection matrices
     float aspect = sapp_widthf() / sapp_heightf();
     HMM_Mat4 proj = HMM_Perspective_RH_ZO(45.0f, aspect, 0.01f, 1000.0f);
-    HMM_Mat4 view = HMM_LookAt_RH(cam_pos, state.cam_target, HMM_V3(0, 1, 0));
+    HMM_Mat4 view = HMM_LookAt_RH(cam_pos, look_target, HMM_V3(0, 1, 0));
     HMM_Mat4 model = HMM_M4D(1.0f);
     HMM_Mat4 mvp = HMM_MulM4(proj, HMM_MulM4(view, model));
+    state.view_proj = HMM_MulM4(proj, view);
     
     // Light direction (from camera towards scene)
     HMM_Vec3 light_dir = HMM_NormV3(HMM_V3(0.5f, 1.0f, 0.3f));
     
+    // Point/spot lights: place, bin into froxels, upload
+    TraceZone lights_zone("lights");
+    place_staging_lights(state.time);
+    assign_lights(view, proj);
+    lights_zone.end();
+    bool clustered = !state.lights.empty();
+    
     // Build normal matrix for PBR
     HMM_Mat4 normal_matrix = HMM_TransposeM4(HMM_InvGeneralM4(model));
     
@@ -1451,6 +3285,7 @@ static void frame() {
     
     // Render skybox first (if enabled)
     if (state.show_skybox && state.hdr_environment.id != SG_INVALID_ID) {
+        TRACE_ZONE("skybox");
         sg_apply_pipeline(state.skybox_pip);
         
         sg_bindings skybox_bind = {};
@@ -1491,48 +3326,123 @@ static void frame() {
     
     // Render model with PBR or toon shader
     if (state.model_loaded) {
-        // Use manual shader toggle instead of per-material is_vrm flag
-        bool useToon = state.use_toon_shader;
-        
-        for (auto& mesh : state.model.meshes) {
-            // Choose shader based on user selection
-            if (useToon) {
-                sg_apply_pipeline(state.toon_pip);
-            } else {
-                sg_apply_pipeline(state.pbr_pip);
+        TRACE_ZONE("model draws");
+        decode_pending_textures(state.model, state.use_toon_shader ? TEXTURE_USE_TOON : TEXTURE_USE_PBR);
+
+        if (state.use_toon_shader) {
+            toon_vs_params_t vs_uniforms = {};
+            vs_uniforms.mvp = mvp;
+            vs_uniforms.model = model;
+            vs_uniforms.normal_matrix = normal_matrix;
+            vs_uniforms.cam_pos = cam_pos;
+
+            toon_fs_params_t fs_uniforms = {};
+            fs_uniforms.cam_pos = cam_pos;
+            fs_uniforms.light_intensity = state.toon_light_intensity;
+            fs_uniforms.shade_toony = state.toon_shade_toony;
+            fs_uniforms.shade_strength = state.toon_shade_strength;
+            fs_uniforms.rim_threshold = state.toon_rim_threshold;
+            fs_uniforms.rim_softness = state.toon_rim_softness;
+            fs_uniforms.spec_intensity = state.toon_spec_intensity;
+
+            toon_light_params_t light_uniforms = {};
+            light_uniforms.cluster_grid = HMM_V4(CLUSTER_GRID_X, CLUSTER_GRID_Y, CLUSTER_GRID_Z, 0.0f);
+            light_uniforms.cluster_depth = HMM_V4(state.light_grid.depth_scale, state.light_grid.depth_bias, 0.0f, 0.0f);
+
+            // Plain toon meshes first, then the MToon texture variant. Frame
+            // uniforms are applied once per pipeline; each draw only selects
+            // its row in the material storage buffer.
+            for (int variant = 0; variant < 2; variant++) {
+                bool textured = variant == 1;
+                bool pipeline_applied = false;
+                for (auto& mesh : state.model.meshes) {
+                    const PBRMaterial& material = state.model.materials[mesh.material_index];
+                    if (mesh_hidden(mesh) || (material.mtoon_features != 0) != textured) {
+                        continue;
+                    }
+                    if (!pipeline_applied) {
+                        if (clustered) {
+                            sg_apply_pipeline(textured ? state.mtoon_clustered_pip : state.toon_clustered_pip);
+                            sg_apply_uniforms(UB_toon_light_params, SG_RANGE(light_uniforms));
+                        } else {
+                            sg_apply_pipeline(textured ? state.mtoon_pip : state.toon_pip);
+                        }
+                        sg_apply_uniforms(UB_toon_vs_params, SG_RANGE(vs_uniforms));
+                        sg_apply_uniforms(UB_toon_fs_params, SG_RANGE(fs_uniforms));
+                        pipeline_applied = true;
+                    }
+
+                    sg_bindings bind = {};
+                    bind.vertex_buffers[0] = mesh.vertex_buffer;
+                    if (mesh.has_indices) {
+                        bind.index_buffer = mesh.index_buffer;
+                    }
+                    bind.views[VIEW_toon_base_color_tex] = material.base_color_view;
+                    bind.samplers[SMP_toon_base_color_smp] = state.smp;
+                    bind.views[VIEW_toon_metallic_roughness_tex] = material.metallic_roughness_view;
+                    bind.samplers[SMP_toon_metallic_roughness_smp] = state.smp;
+                    bind.views[VIEW_toon_normal_tex] = material.normal_view;
+                    bind.samplers[SMP_toon_normal_smp] = state.smp;
+                    bind.views[VIEW_toon_irradiance_map] = state.irradiance_map_view;
+                    bind.samplers[SMP_toon_irradiance_smp] = state.smp;
+                    bind.views[VIEW_toon_prefilter_map] = state.prefilter_map_view;
+                    bind.samplers[SMP_toon_prefilter_smp] = state.smp;
+                    bind.views[VIEW_toon_toon_materials] = state.model.toon_material_view;
+                    if (textured) {
+                        bind.views[VIEW_toon_shade_multiply_tex] = material.shade_multiply_view;
+                        bind.views[VIEW_toon_rim_multiply_tex] = material.rim_multiply_view;
+                        bind.views[VIEW_toon_matcap_tex] = material.matcap_view;
+                    }
+                    if (clustered) {
+                        bind.views[VIEW_toon_punctual_lights] = state.light_view;
+                        bind.views[VIEW_toon_light_clusters] = state.light_cluster_view;
+                        bind.views[VIEW_toon_light_index_list] = state.light_index_view;
+                    }
+                    sg_apply_bindings(&bind);
+
+                    toon_draw_params_t draw_uniforms = {};
+                    draw_uniforms.material_index = material.toon_material_index;
+                    sg_apply_uniforms(UB_toon_draw_params, SG_RANGE(draw_uniforms));
+
+                    draw_render_mesh(mesh);
+                }
             }
-            
-            // Set up bindings
-            sg_bindings bind = {};
-            bind.vertex_buffers[0] = mesh.vertex_buffer;
-            if (mesh.has_indices) {
-                bind.index_buffer = mesh.index_buffer;
+        } else {
+            sg_apply_pipeline(clustered ? state.pbr_clustered_pip : state.pbr_pip);
+
+            pbr_vs_params_t vs_uniforms = {};
+            vs_uniforms.mvp = mvp;
+            vs_uniforms.model = model;
+            vs_uniforms.normal_matrix = normal_matrix;
+            vs_uniforms.cam_pos = cam_pos;
+            sg_apply_uniforms(UB_pbr_vs_params, SG_RANGE(vs_uniforms));
+            if (clustered) {
+                pbr_light_params_t light_uniforms = {};
+                light_uniforms.cluster_grid = HMM_V4(CLUSTER_GRID_X, CLUSTER_GRID_Y, CLUSTER_GRID_Z, 0.0f);
+                light_uniforms.cluster_depth = HMM_V4(state.light_grid.depth_scale, state.light_grid.depth_bias, 0.0f, 0.0f);
+                sg_apply_uniforms(UB_pbr_light_params, SG_RANGE(light_uniforms));
             }
-            
-            // PBR/Toon texture bindings (using generated constants)
-            if (useToon) {
-                // Toon shader bindings
-                bind.views[VIEW_toon_base_color_tex] = mesh.material.base_color_view;
-                bind.samplers[SMP_toon_base_color_smp] = state.smp;
-                bind.views[VIEW_toon_metallic_roughness_tex] = mesh.material.metallic_roughness_view;
-                bind.samplers[SMP_toon_metallic_roughness_smp] = state.smp;
-                bind.views[VIEW_toon_normal_tex] = mesh.material.normal_view;
-                bind.samplers[SMP_toon_normal_smp] = state.smp;
-                bind.views[VIEW_toon_irradiance_map] = state.irradiance_map_view;
-                bind.samplers[SMP_toon_irradiance_smp] = state.smp;
-                bind.views[VIEW_toon_prefilter_map] = state.prefilter_map_view;
-                bind.samplers[SMP_toon_prefilter_smp] = state.smp;
-            } else {
-                // PBR shader bindings
-                bind.views[VIEW_pbr_base_color_tex] = mesh.material.base_color_view;
+
+            for (auto& mesh : state.model.meshes) {
+                if (mesh_hidden(mesh)) {
+                    continue;
+                }
+                const PBRMaterial& material = state.model.materials[mesh.material_index];
+
+                sg_bindings bind = {};
+                bind.vertex_buffers[0] = mesh.vertex_buffer;
+                if (mesh.has_indices) {
+                    bind.index_buffer = mesh.index_buffer;
+                }
+                bind.views[VIEW_pbr_base_color_tex] = material.base_color_view;
                 bind.samplers[SMP_pbr_base_color_smp] = state.smp;
-                bind.views[VIEW_pbr_metallic_roughness_tex] = mesh.material.metallic_roughness_view;
+                bind.views[VIEW_pbr_metallic_roughness_tex] = material.metallic_roughness_view;
                 bind.samplers[SMP_pbr_metallic_roughness_smp] = state.smp;
-                bind.views[VIEW_pbr_normal_tex] = mesh.material.normal_view;
+                bind.views[VIEW_pbr_normal_tex] = material.normal_view;
                 bind.samplers[SMP_pbr_normal_smp] = state.smp;
-                bind.views[VIEW_pbr_occlusion_tex] = mesh.material.occlusion_view;
+                bind.views[VIEW_pbr_occlusion_tex] = material.occlusion_view;
                 bind.samplers[SMP_pbr_occlusion_smp] = state.smp;
-                bind.views[VIEW_pbr_emissive_tex] = mesh.material.emissive_view;
+                bind.views[VIEW_pbr_emissive_tex] = material.emissive_view;
                 bind.samplers[SMP_pbr_emissive_smp] = state.smp;
                 bind.views[VIEW_pbr_irradiance_map] = state.irradiance_map_view;
                 bind.samplers[SMP_pbr_irradiance_smp] = state.smp;
@@ -1540,53 +3450,22 @@ static void frame() {
                 bind.samplers[SMP_pbr_prefilter_smp] = state.smp;
                 bind.views[VIEW_pbr_brdf_lut] = state.brdf_lut_view;
                 bind.samplers[SMP_pbr_brdf_lut_smp] = state.smp;
-            }
-            
-            sg_apply_bindings(&bind);
-            
-            // Vertex shader uniforms
-            if (useToon) {
-                toon_vs_params_t vs_uniforms = {};
-                vs_uniforms.mvp = mvp;
-                vs_uniforms.model = model;
-                vs_uniforms.normal_matrix = normal_matrix;
-                vs_uniforms.cam_pos = cam_pos;
-                sg_apply_uniforms(UB_toon_vs_params, SG_RANGE(vs_uniforms));
-            } else {
-                pbr_vs_params_t vs_uniforms = {};
-                vs_uniforms.mvp = mvp;
-                vs_uniforms.model = model;
-                vs_uniforms.normal_matrix = normal_matrix;
-                vs_uniforms.cam_pos = cam_pos;
-                sg_apply_uniforms(UB_pbr_vs_params, SG_RANGE(vs_uniforms));
-            }
-            
-            // Fragment shader uniforms
-            if (useToon) {
-                toon_fs_params_t fs_uniforms = {};
-                fs_uniforms.base_color_factor = mesh.material.base_color_factor;
-                fs_uniforms.metallic_factor = mesh.material.metallic_factor;
-                fs_uniforms.roughness_factor = mesh.material.roughness_factor;
-                fs_uniforms.toon_ramp_steps = mesh.material.toon_ramp_steps;
-                fs_uniforms.toon_rim_power = mesh.material.toon_rim_power;
-                fs_uniforms.toon_rim_strength = mesh.material.toon_rim_strength;
-                fs_uniforms.cam_pos = cam_pos;
-                sg_apply_uniforms(UB_toon_fs_params, SG_RANGE(fs_uniforms));
-            } else {
+                if (clustered) {
+                    bind.views[VIEW_pbr_punctual_lights] = state.light_view;
+                    bind.views[VIEW_pbr_light_clusters] = state.light_cluster_view;
+                    bind.views[VIEW_pbr_light_index_list] = state.light_index_view;
+                }
+                sg_apply_bindings(&bind);
+
                 pbr_fs_params_t fs_uniforms = {};
-                fs_uniforms.base_color_factor = mesh.material.base_color_factor;
-                fs_uniforms.metallic_factor = mesh.material.metallic_factor;
-                fs_uniforms.roughness_factor = mesh.material.roughness_factor;
-                fs_uniforms.emissive_factor = mesh.material.emissive_factor;
+                fs_uniforms.base_color_factor = material.base_color_factor;
+                fs_uniforms.metallic_factor = material.metallic_factor;
+                fs_uniforms.roughness_factor = material.roughness_factor;
+                fs_uniforms.emissive_factor = material.emissive_factor;
                 fs_uniforms.cam_pos = cam_pos;
                 sg_apply_uniforms(UB_pbr_fs_params, SG_RANGE(fs_uniforms));
-            }
-            
-            // Draw
-            if (mesh.has_indices) {
-                sg_draw(0, mesh.num_indices, 1);
-            } else {
-                sg_draw(0, mesh.num_vertices, 1);
+
+                draw_render_mesh(mesh);
             }
         }
     }
@@ -1597,6 +3476,22 @@ static void frame() {
     gui_state.is_vrm_model = state.is_vrm_model;
     gui_state.mesh_count = (int)state.model.meshes.size();
     gui_state.use_toon_shader = state.use_toon_shader;
+    gui_state.has_first_person = state.model.has_first_person;
+    gui_state.first_person = state.first_person;
+    gui_state.head_triangle_count = state.model.num_head_triangles;
+    gui_state.texture_count = (int)state.model.texture_stats.size();
+    gui_state.texture_memory_mb = (float)state.model.texture_bytes / (1024.0f * 1024.0f);
+    gui_state.texture_budget_mb = (float)state.texture_import.budget_bytes / (1024.0f * 1024.0f);
+    gui_state.texture_row_count = HMM_MIN((int)state.model.texture_stats.size(), GUI_MAX_TEXTURE_ROWS);
+    for (int i = 0; i < gui_state.texture_row_count; i++) {
+        gui_state.texture_row_labels[i] = state.model.texture_stats[i].label;
+        gui_state.texture_row_values[i] = state.model.texture_stats[i].value;
+    }
+    gui_state.pick_row_count = state.pick_row_count;
+    for (int i = 0; i < state.pick_row_count; i++) {
+        gui_state.pick_row_labels[i] = state.pick_rows[i].label;
+        gui_state.pick_row_values[i] = state.pick_rows[i].value;
+    }
     gui_state.show_skybox = state.show_skybox;
     gui_state.skybox_exposure = state.skybox_exposure;
     gui_state.skybox_lod = state.skybox_lod;
@@ -1606,15 +3501,49 @@ static void frame() {
     gui_state.toon_rim_threshold = state.toon_rim_threshold;
     gui_state.toon_rim_softness = state.toon_rim_softness;
     gui_state.toon_spec_intensity = state.toon_spec_intensity;
+    gui_state.light_count = (float)state.staging_lights.count;
+    gui_state.light_intensity = state.staging_lights.intensity;
+    gui_state.light_range = state.staging_lights.range_fraction;
+    gui_state.animate_lights = state.staging_lights.animate;
+    if (fabsf(state.time - state.light_stats_shown_time) >= GUI_STATS_REFRESH_SECONDS) {
+        state.shown_light_stats = state.light_stats;
+        state.light_stats_shown_time = state.time;
+    }
+    gui_state.light_list_entries = (int)state.shown_light_stats.list_entries;
+    gui_state.light_cluster_max = (int)state.shown_light_stats.max_cluster_lights;
+    gui_state.light_overflowed_clusters = (int)state.shown_light_stats.overflowed_clusters;
+    gui_state.light_dropped = (int)state.shown_light_stats.dropped_lights;
+    gui_state.light_assign_ms = (float)(state.shown_light_stats.seconds * 1000.0);
     gui_state.show_gui = state.show_gui;
     gui_state.gui_hovered = state.gui_hovered;
     gui_state.mouse_pressed = state.mouse_down;
     gui_state.mouse_x = state.last_mouse_x;
     gui_state.mouse_y = state.last_mouse_y;
+    gui_state.alloc_row_count = alloc_tracking_enabled() ? GUI_MAX_ALLOC_ROWS : 0;
+    for (int i = 0; i < gui_state.alloc_row_count; i++) {
+        InspectRow& row = state.alloc_rows[i];
+        if (i == 0) {
+            snprintf(row.label, sizeof(row.label), "Last frame:");
+            snprintf(row.value, sizeof(row.value), "%llu allocs, %llu bytes", (unsigned long long)state.frame_alloc_count,
+                     (unsigned long long)state.frame_alloc_bytes);
+        } else {
+            AllocSubsystem subsystem = (AllocSubsystem)(i - 1);
+            AllocStats allocs = alloc_stats(subsystem);
+            snprintf(row.label, sizeof(row.label), "%s:", alloc_subsystem_name(subsystem));
+            format_alloc_stats(row.value, sizeof(row.value), allocs.count, allocs.bytes, allocs.peak_live_bytes);
+        }
+        gui_state.alloc_row_labels[i] = row.label;
+        gui_state.alloc_row_values[i] = row.value;
+    }
+    TraceZone gui_zone("gui_render");
+    alloc_set_subsystem(ALLOC_GUI);
     gui_render(&gui_state);
+    alloc_set_subsystem(ALLOC_FRAME);
+    gui_zone.end();
     
     // Sync GUI changes back to application state
     state.use_toon_shader = gui_state.use_toon_shader;
+    set_first_person(gui_state.first_person);
     state.show_skybox = gui_state.show_skybox;
     state.skybox_exposure = gui_state.skybox_exposure;
     state.skybox_lod = gui_state.skybox_lod;
@@ -1624,47 +3553,73 @@ static void frame() {
     state.toon_rim_threshold = gui_state.toon_rim_threshold;
     state.toon_rim_softness = gui_state.toon_rim_softness;
     state.toon_spec_intensity = gui_state.toon_spec_intensity;
+    state.staging_lights.count = (int)(gui_state.light_count + 0.5f);
+    state.staging_lights.intensity = gui_state.light_intensity;
+    state.staging_lights.range_fraction = gui_state.light_range;
+    state.staging_lights.animate = gui_state.animate_lights != 0;
     
     sg_end_pass();
+    TraceZone commit_zone("sg_commit");
     sg_commit();
+    commit_zone.end();
+
+    // Input and loads change what a frame builds; a few frames after the
+    // last of them, frame() should run on reused buffers alone
+    AllocStats frame_allocs_after = alloc_stats(ALLOC_FRAME);
+    AllocStats gui_allocs_after = alloc_stats(ALLOC_GUI);
+    state.frame_alloc_count =
+        frame_allocs_after.count - frame_allocs.count + gui_allocs_after.count - gui_allocs.count;
+    state.frame_alloc_bytes =
+        frame_allocs_after.bytes - frame_allocs.bytes + gui_allocs_after.bytes - gui_allocs.bytes;
+    state.steady_frames++;
+    if (state.steady_frames > STEADY_FRAME_WARMUP && state.frame_alloc_count > 0 && !state.steady_alloc_reported) {
+        log_write(LOG_INFO, "Steady-state frame allocated", { log_int("allocs", (int64_t)state.frame_alloc_count),
+                                                              log_int("bytes", (int64_t)state.frame_alloc_bytes) });
+        state.steady_alloc_reported = true;
+    }
+
+    state.frame_index++;
+    if (state.replaying) {
+        auto frame_end = std::chrono::steady_clock::now();
+        state.replay_input_ms.push_back(std::chrono::duration<double, std::milli>(frame_start - input_start).count());
+        state.replay_frame_ms.push_back(std::chrono::duration<double, std::milli>(frame_end - frame_start).count());
+        if (state.frame_index >= state.recording.frames) {
+            finish_replay();
+        }
+    }
 }
 
 static void cleanup() {
     log_message("Cleaning up...");
-    
-    // Clean up model resources
-    for (auto& mesh : state.model.meshes) {
-        sg_destroy_buffer(mesh.vertex_buffer);
-        if (mesh.has_indices) {
-            sg_destroy_buffer(mesh.index_buffer);
-        }
-        // Clean up PBR material textures
-        if (mesh.material.base_color_tex.id != state.default_texture.id) {
-            sg_destroy_view(mesh.material.base_color_view);
-            sg_destroy_image(mesh.material.base_color_tex);
-        }
-        if (mesh.material.metallic_roughness_tex.id != state.default_metallic_roughness.id) {
-            sg_destroy_view(mesh.material.metallic_roughness_view);
-            sg_destroy_image(mesh.material.metallic_roughness_tex);
-        }
-        if (mesh.material.normal_tex.id != state.default_normal.id) {
-            sg_destroy_view(mesh.material.normal_view);
-            sg_destroy_image(mesh.material.normal_tex);
-        }
-        if (mesh.material.occlusion_tex.id != state.default_texture.id) {
-            sg_destroy_view(mesh.material.occlusion_view);
-            sg_destroy_image(mesh.material.occlusion_tex);
-        }
-        if (mesh.material.emissive_tex.id != state.default_texture.id) {
-            sg_destroy_view(mesh.material.emissive_view);
-            sg_destroy_image(mesh.material.emissive_tex);
+    if (!state.record_path.empty()) {
+        state.recording.frames = state.frame_index;
+        if (input_recording_save(state.record_path.c_str(), state.recording)) {
+            log_write(LOG_INFO, "Recorded input", { log_int("events", (int64_t)state.recording.events.size()),
+                                                    log_int("frames", state.frame_index),
+                                                    log_str("path", state.record_path.c_str()) });
+        } else {
+            log_write(LOG_ERROR, "Failed to write input recording", { log_str("path", state.record_path.c_str()) });
         }
     }
+    if (trace_enabled()) {
+        toggle_trace();
+    }
+    
+    // Clean up model resources
+    destroy_model(state.model);
     
     // Clean up skybox
     sg_destroy_buffer(state.skybox_vertex_buffer);
     sg_destroy_buffer(state.skybox_index_buffer);
     
+    // Clean up light lists
+    sg_destroy_view(state.light_index_view);
+    sg_destroy_buffer(state.light_index_buffer);
+    sg_destroy_view(state.light_cluster_view);
+    sg_destroy_buffer(state.light_cluster_buffer);
+    sg_destroy_view(state.light_view);
+    sg_destroy_buffer(state.light_buffer);
+    
     // Clean up IBL resources
     sg_destroy_view(state.brdf_lut_view);
     sg_destroy_image(state.brdf_lut);
@@ -1687,16 +3642,40 @@ static void cleanup() {
     sg_destroy_sampler(state.smp);
     sg_destroy_pipeline(state.skybox_pip);
     sg_destroy_pipeline(state.toon_pip);
+    sg_destroy_pipeline(state.mtoon_pip);
     sg_destroy_pipeline(state.pbr_pip);
+    sg_destroy_pipeline(state.mtoon_clustered_pip);
+    sg_destroy_pipeline(state.toon_clustered_pip);
+    sg_destroy_pipeline(state.pbr_clustered_pip);
     sg_destroy_pipeline(state.pip);
     
     // Cleanup GUI
     gui_shutdown();
     
     sg_shutdown();
+    log_stop();
 }
 
 static void event(const sapp_event* ev) {
+    const char* dropped_file = nullptr;
+    if (ev->type == SAPP_EVENTTYPE_FILES_DROPPED && sapp_get_num_dropped_files() > 0) {
+        dropped_file = sapp_get_dropped_file_path(0);
+    }
+    // Live input would change a replay's scenario; only drops (the model to
+    // replay on) and Escape get through
+    if (state.replaying && ev->type != SAPP_EVENTTYPE_FILES_DROPPED &&
+        !(ev->type == SAPP_EVENTTYPE_KEY_DOWN && ev->key_code == SAPP_KEYCODE_ESCAPE)) {
+        return;
+    }
+    if (!state.record_path.empty()) {
+        input_recording_add(state.recording, state.frame_index, *ev, dropped_file);
+    }
+    handle_event(ev, dropped_file);
+}
+
+static void handle_event(const sapp_event* ev, const char* dropped_file) {
+    state.steady_frames = 0;  // Input may change what the next frames build
+    
     // Pass events to GUI
     gui_handle_event(ev);
     
@@ -1706,12 +3685,19 @@ static void event(const sapp_event* ev) {
                 state.mouse_down = true;
                 state.last_mouse_x = ev->mouse_x;
                 state.last_mouse_y = ev->mouse_y;
+                state.press_x = ev->mouse_x;
+                state.press_y = ev->mouse_y;
             }
             break;
             
         case SAPP_EVENTTYPE_MOUSE_UP:
             if (ev->mouse_button == SAPP_MOUSEBUTTON_LEFT) {
                 state.mouse_down = false;
+                // A click rather than a drag picks what is under the cursor
+                if (!state.gui_hovered && fabsf(ev->mouse_x - state.press_x) < 4.0f &&
+                    fabsf(ev->mouse_y - state.press_y) < 4.0f) {
+                    pick_at(ev->mouse_x, ev->mouse_y);
+                }
             }
             break;
             
@@ -1733,21 +3719,18 @@ static void event(const sapp_event* ev) {
             break;
             
         case SAPP_EVENTTYPE_MOUSE_SCROLL:
-            // Don't zoom if over GUI
-            if (!state.gui_hovered) {
+            // Don't zoom if over GUI or looking from the head
+            if (!state.gui_hovered && !state.first_person) {
                 state.cam_distance -= ev->scroll_y * state.cam_distance * 0.1f;
                 state.cam_distance = HMM_MAX(0.1f, state.cam_distance);
             }
             break;
             
-        case SAPP_EVENTTYPE_FILES_DROPPED: {
-            int num_files = sapp_get_num_dropped_files();
-            if (num_files > 0) {
-                const char* filepath = sapp_get_dropped_file_path(0);
-                load_model(filepath);
+        case SAPP_EVENTTYPE_FILES_DROPPED:
+            if (dropped_file) {
+                load_model(dropped_file);
             }
             break;
-        }
         
         case SAPP_EVENTTYPE_KEY_DOWN:
             if (ev->key_code == SAPP_KEYCODE_ESCAPE) {
@@ -1755,14 +3738,15 @@ static void event(const sapp_event* ev) {
             } else if (ev->key_code == SAPP_KEYCODE_R) {
                 // Reset camera
                 if (state.model_loaded) {
-                    state.cam_target = state.model.center;
-                    state.cam_distance = state.model.radius * 2.5f;
-                    state.cam_elevation = 15.0f;
-                    state.cam_azimuth = 45.0f;
+                    set_first_person(false);
+                    reset_camera();
                 }
             } else if (ev->key_code == SAPP_KEYCODE_G) {
                 // Toggle GUI
                 state.show_gui = !state.show_gui;
+            } else if (ev->key_code == SAPP_KEYCODE_F) {
+                // Toggle first-person view (VRM)
+                set_first_person(!state.first_person);
             } else if (ev->key_code == SAPP_KEYCODE_T) {
                 // Toggle Toon/PBR shader
                 state.use_toon_shader = !state.use_toon_shader;
@@ -1781,6 +3765,15 @@ static void event(const sapp_event* ev) {
             } else if (ev->key_code == SAPP_KEYCODE_RIGHT_BRACKET) {
                 // Increase LOD
                 state.skybox_lod = HMM_MIN(state.skybox_lod + 1.0f, 5.0f);
+            } else if (ev->key_code == SAPP_KEYCODE_P) {
+                // Start or write a timeline trace
+                toggle_trace();
+            } else if (ev->key_code == SAPP_KEYCODE_L) {
+                // Cycle the log level: debug, info, warn, error
+                LogLevel level = (LogLevel)((log_get_level() + 1) % (LOG_ERROR + 1));
+                log_set_level(level);
+                // Written whatever the new level filters
+                log_record(LOG_INFO, "Log level", { log_str("level", log_level_name(level)) });
             }
             break;
             
@@ -1789,14 +3782,42 @@ static void event(const sapp_event* ev) {
     }
 }
 
+#ifdef VRM_VIEWER_HEADLESS
+void viewer_stats(ViewerStats& out) {
+    out.model_loaded = state.model_loaded;
+    out.draws = state.frame_draws;
+    out.triangles = state.frame_triangles;
+    out.frame_allocs = state.frame_alloc_count;
+    out.steady_frame_allocated = state.steady_alloc_reported;
+    out.load_ms = state.load_ms;
+    out.load_failed = state.load_failed;
+    out.replaying = state.replaying;
+    out.bench_failed = state.bench_failed;
+    out.gfx_errors = state.gfx_errors;
+}
+#endif
+
 sapp_desc sokol_main(int argc, char* argv[]) {
+    viewer_options_default(state.options);
+    bool help = false;
+    std::string error;
+    bool parsed = viewer_options_parse(argc, argv, state.options, help, error);
+    if (!parsed) {
+        fprintf(stderr, "%s\n", error.c_str());
+    }
+    if (!parsed || help) {
+        printf("Usage: vrm_viewer [options] [model.vrm|glb|gltf]\n");
+        viewer_options_print_usage();
+        exit(parsed ? 0 : 2);
+    }
+
     sapp_desc desc = {};
     desc.init_cb = init;
     desc.frame_cb = frame;
     desc.cleanup_cb = cleanup;
     desc.event_cb = event;
-    desc.width = 1280;
-    desc.height = 720;
+    desc.width = state.options.width;
+    desc.height = state.options.height;
     desc.window_title = "VRM/GLTF/GLB Viewer";
     desc.icon.sokol_default = true;
     desc.enable_dragndrop = true;
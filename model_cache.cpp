@@ -0,0 +1,218 @@
+// On-disk cache of data derived from a model at import
+
+#include "model_cache.h"
+#include "importer.h"
+#include "trace.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+// File layout (little endian):
+//   "VRMCACHE" u32 version, u32 entry count, u64 key
+//   per entry: u32 name length, name bytes, u64 size, data
+static const char model_cache_magic[8] = { 'V', 'R', 'M', 'C', 'A', 'C', 'H', 'E' };
+
+// 64-bit multiply-xorshift over 8-byte words; hashing a model's buffers has
+// to stay well below the cost of the work the cache saves
+static uint64_t hash_words(uint64_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    auto mix = [&](uint64_t word) {
+        hash ^= word;
+        hash *= 0x9E3779B97F4A7C15ull;
+        hash ^= hash >> 29;
+    };
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        memcpy(&word, bytes + i, 8);
+        mix(word);
+    }
+    uint64_t tail = 0;
+    memcpy(&tail, bytes + i, size - i);
+    mix(tail ^ ((uint64_t)size << 56));
+    return hash;
+}
+
+uint64_t model_cache_hash(uint64_t hash, const void* data, size_t size) {
+    return hash_words(hash, data, size);
+}
+
+std::string model_cache_directory() {
+    if (const char* dir = getenv("VRM_VIEWER_CACHE_DIR")) {
+        return dir;
+    }
+#ifdef _WIN32
+    if (const char* local = getenv("LOCALAPPDATA")) {
+        return std::string(local) + "\\vrm_viewer\\cache";
+    }
+#else
+    if (const char* xdg = getenv("XDG_CACHE_HOME")) {
+        return std::string(xdg) + "/vrm_viewer";
+    }
+    if (const char* home = getenv("HOME")) {
+        return std::string(home) + "/.cache/vrm_viewer";
+    }
+#endif
+    return "";
+}
+
+// Delete the least recently used cache files until the directory fits
+// the size limit; keep is never deleted
+static void trim_cache_directory(const std::filesystem::path& dir, const std::filesystem::path& keep) {
+    uint64_t max_bytes = (uint64_t)MODEL_CACHE_MAX_MB << 20;
+    if (const char* max_mb = getenv("VRM_VIEWER_CACHE_MAX_MB")) {
+        max_bytes = (uint64_t)strtoull(max_mb, nullptr, 10) << 20;
+    }
+    struct CacheFile {
+        std::filesystem::path path;
+        std::filesystem::file_time_type time;
+        uint64_t size;
+    };
+    std::vector<CacheFile> files;
+    uint64_t total = 0;
+    std::error_code ec;
+    for (std::filesystem::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+        if (it->path().extension() != ".cache" || !it->is_regular_file(ec)) {
+            continue;
+        }
+        CacheFile file = { it->path(), it->last_write_time(ec), it->file_size(ec) };
+        if (!ec) {
+            total += file.size;
+            files.push_back(file);
+        }
+    }
+    std::sort(files.begin(), files.end(), [](const CacheFile& a, const CacheFile& b) { return a.time < b.time; });
+    for (const CacheFile& file : files) {
+        if (total <= max_bytes) {
+            break;
+        }
+        if (file.path != keep && std::filesystem::remove(file.path, ec)) {
+            total -= file.size;
+        }
+    }
+}
+
+void model_cache_open(ModelCache& cache, const cgltf_data* data) {
+    TRACE_ZONE("model_cache_open");
+    cache.entries.clear();
+    cache.dirty = false;
+    cache.key = hash_words(MODEL_CACHE_VERSION, data->json, data->json_size);
+    for (size_t i = 0; i < data->buffers_count; i++) {
+        if (data->buffers[i].data) {
+            cache.key = hash_words(cache.key, data->buffers[i].data, data->buffers[i].size);
+        }
+    }
+
+    std::string dir = model_cache_directory();
+    if (dir.empty()) {
+        cache.path.clear();
+        return;
+    }
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.cache", (unsigned long long)cache.key);
+    cache.path = dir + "/" + name;
+
+    std::vector<uint8_t> file;
+    if (!read_file_utf8(cache.path.c_str(), file)) {
+        return;
+    }
+    size_t pos = 0;
+    auto read = [&](void* out, size_t size) {
+        if (file.size() - pos < size) {
+            return false;
+        }
+        memcpy(out, file.data() + pos, size);
+        pos += size;
+        return true;
+    };
+    char magic[8];
+    uint32_t version = 0, count = 0;
+    uint64_t key = 0;
+    if (!read(magic, 8) || memcmp(magic, model_cache_magic, 8) != 0 || !read(&version, 4) ||
+        version != MODEL_CACHE_VERSION || !read(&count, 4) || !read(&key, 8) || key != cache.key) {
+        return;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t name_size = 0;
+        uint64_t size = 0;
+        std::string entry_name;
+        if (!read(&name_size, 4) || file.size() - pos < name_size) {
+            cache.entries.clear();
+            return;
+        }
+        entry_name.assign((const char*)file.data() + pos, name_size);
+        pos += name_size;
+        if (!read(&size, 8) || file.size() - pos < size) {
+            cache.entries.clear();
+            return;
+        }
+        cache.entries[entry_name].assign(file.data() + pos, file.data() + pos + size);
+        pos += (size_t)size;
+    }
+
+    // The modification time orders files for trimming
+    std::error_code ec;
+    std::filesystem::last_write_time(std::filesystem::path((const char8_t*)cache.path.c_str()),
+                                     std::filesystem::file_time_type::clock::now(), ec);
+}
+
+bool model_cache_get(const ModelCache& cache, const std::string& name, void* out, size_t size) {
+    auto it = cache.entries.find(name);
+    if (it == cache.entries.end() || it->second.size() != size) {
+        return false;
+    }
+    memcpy(out, it->second.data(), size);
+    return true;
+}
+
+void model_cache_put(ModelCache& cache, const std::string& name, const void* data, size_t size) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    cache.entries[name].assign(bytes, bytes + size);
+    cache.dirty = true;
+}
+
+bool model_cache_save(ModelCache& cache) {
+    TRACE_ZONE("model_cache_save");
+    if (!cache.dirty || cache.path.empty()) {
+        return true;
+    }
+    std::vector<uint8_t> file;
+    auto write = [&](const void* data, size_t size) {
+        const uint8_t* bytes = (const uint8_t*)data;
+        file.insert(file.end(), bytes, bytes + size);
+    };
+    uint32_t version = MODEL_CACHE_VERSION;
+    uint32_t count = (uint32_t)cache.entries.size();
+    write(model_cache_magic, 8);
+    write(&version, 4);
+    write(&count, 4);
+    write(&cache.key, 8);
+    for (const auto& entry : cache.entries) {
+        uint32_t name_size = (uint32_t)entry.first.size();
+        uint64_t size = entry.second.size();
+        write(&name_size, 4);
+        write(entry.first.data(), name_size);
+        write(&size, 8);
+        write(entry.second.data(), entry.second.size());
+    }
+
+    // Write beside the final name and rename, so a concurrent or interrupted
+    // load never sees a partial file
+    std::error_code ec;
+    std::filesystem::path path((const char8_t*)cache.path.c_str());
+    std::filesystem::create_directories(path.parent_path(), ec);
+    std::string temp_path = cache.path + ".tmp";
+    if (!write_file_utf8(temp_path.c_str(), file.data(), file.size())) {
+        return false;
+    }
+    std::filesystem::rename(std::filesystem::path((const char8_t*)temp_path.c_str()), path, ec);
+    if (ec) {
+        return false;
+    }
+    cache.dirty = false;
+    trim_cache_directory(path.parent_path(), path);
+    return true;
+}
@@ -0,0 +1,51 @@
+// On-disk cache of data derived from a model at import (generated normals
+// and tangents, baked lighting, ...), keyed by the model's content so the
+// work is paid once per model rather than once per load
+#ifndef MODEL_CACHE_H
+#define MODEL_CACHE_H
+
+#include "cgltf/cgltf.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Bump when the file layout or any cached algorithm changes
+#define MODEL_CACHE_VERSION 2
+
+// Size the cache directory is trimmed to after each save, least recently
+// used files first; $VRM_VIEWER_CACHE_MAX_MB overrides it. Deleting the
+// directory is always safe.
+#define MODEL_CACHE_MAX_MB 1024
+
+struct ModelCache {
+    uint64_t key;
+    std::string path;  // Empty when no cache directory is available
+    std::unordered_map<std::string, std::vector<uint8_t>> entries;
+    bool dirty;  // Entries were added since open
+};
+
+// Continues a 64-bit hash over size bytes, for naming entries by the data
+// they were derived from
+uint64_t model_cache_hash(uint64_t hash, const void* data, size_t size);
+
+// Directory holding cache files: $VRM_VIEWER_CACHE_DIR, else the platform
+// per-user cache directory. Empty if neither can be determined.
+std::string model_cache_directory();
+
+// Key the cache by the model JSON and buffers and load the matching cache
+// file if there is one, marking it recently used. A missing, stale or
+// corrupt file yields an empty cache.
+void model_cache_open(ModelCache& cache, const cgltf_data* data);
+
+// Copy an entry of exactly size bytes into out; false if absent or sized differently
+bool model_cache_get(const ModelCache& cache, const std::string& name, void* out, size_t size);
+
+void model_cache_put(ModelCache& cache, const std::string& name, const void* data, size_t size);
+
+// Write the cache file if entries were added, then trim the directory to
+// MODEL_CACHE_MAX_MB. Returns false on I/O failure.
+bool model_cache_save(ModelCache& cache);
+
+#endif // MODEL_CACHE_H
@@ -0,0 +1,64 @@
+// Clustered point/spot lights shared by pbr.glsl and toon.glsl
+//
+// The CPU (clustered.cpp) bins the scene's lights into a froxel grid every
+// frame. A pixel finds its cluster from its clip-space position and loops
+// over that cluster's compact light list only, so the per-pixel cost is
+// bounded by the lights that can reach it (at most CLUSTER_MAX_LIGHTS).
+
+@block clustered_lights
+// Same layout as PunctualLight in clustered.h
+struct punctual_light {
+    vec4 position_range;        // xyz = position, w = range
+    vec4 color_spot_scale;      // rgb = color * intensity, a = spot cone scale
+    vec4 direction_spot_offset; // xyz = spot axis, w = spot cone offset
+};
+
+struct light_cluster {
+    uint offset;
+    uint count;
+};
+
+struct light_index {
+    uint light;
+};
+
+layout(binding=9) readonly buffer punctual_lights {
+    punctual_light lights[];
+};
+
+layout(binding=10) readonly buffer light_clusters {
+    light_cluster clusters[];
+};
+
+layout(binding=11) readonly buffer light_index_list {
+    light_index light_indices[];
+};
+
+layout(binding=3) uniform light_params {
+    vec4 cluster_grid;          // xyz = clusters along x, y and depth
+    vec4 cluster_depth;         // x = slice scale, y = slice bias: slice = log(depth) * x + y
+};
+
+// Offset and count of the light list of the cluster containing clip
+uvec2 clusterLightRange(vec4 clip) {
+    // Projections here are perspective: clip.w is the view depth
+    vec2 tile = (clip.xy / clip.w * 0.5 + 0.5) * cluster_grid.xy;
+    float slice = log(max(clip.w, 1e-6)) * cluster_depth.x + cluster_depth.y;
+    ivec3 cell = clamp(ivec3(vec3(tile, slice)), ivec3(0), ivec3(cluster_grid.xyz) - 1);
+    int index = (cell.z * int(cluster_grid.y) + cell.y) * int(cluster_grid.x) + cell.x;
+    light_cluster cluster = clusters[index];
+    return uvec2(cluster.offset, cluster.count);
+}
+
+// KHR_lights_punctual falloff: inverse square windowed to 0 at range, times
+// the spot cone. L receives the direction towards the light.
+float punctualAttenuation(punctual_light light, vec3 world_pos, out vec3 L) {
+    vec3 toLight = light.position_range.xyz - world_pos;
+    float dist2 = max(dot(toLight, toLight), 1e-8);
+    L = toLight * inversesqrt(dist2);
+    float ratio2 = dist2 / (light.position_range.w * light.position_range.w);
+    float window = clamp(1.0 - ratio2 * ratio2, 0.0, 1.0);
+    float cone = clamp(dot(light.direction_spot_offset.xyz, -L) * light.color_spot_scale.a + light.direction_spot_offset.w, 0.0, 1.0);
+    return window * window * cone * cone / dist2;
+}
+@end
@@ -1,5 +1,10 @@
 // PBR shader with IBL support for GLTF models
 // Compile with: sokol-shdc --input pbr.glsl --output pbr.glsl.h --slang hlsl5:glsl430:metal_macos
+//
+// Programs:
+//   pbr           - directional key light + IBL
+//   pbr_clustered - adds the scene's point/spot lights, looping over the
+//                   light list of the pixel's froxel (see clustered.h)
 
 @module pbr
 
@@ -7,7 +12,9 @@
 @ctype vec4 HMM_Vec4
 @ctype vec3 HMM_Vec3
 
-@vs vs
+@include clustered.glsl
+
+@block vs_common
 layout(binding=0) uniform vs_params {
     mat4 mvp;
     mat4 model;
@@ -20,12 +27,17 @@ in vec3 pos;
 in vec3 normal;
 in vec2 uv;
 in vec4 tangent;
+in float occlusion;
 
 out vec3 v_world_pos;
 out vec3 v_normal;
 out vec3 v_tangent;
 out vec3 v_bitangent;
 out vec2 v_uv;
+out float v_occlusion;
+#ifdef CLUSTERED_LIGHTS
+out vec4 v_clip;
+#endif
 
 void main() {
     v_world_pos = (model * vec4(pos, 1.0)).xyz;
@@ -33,11 +45,15 @@ void main() {
     v_tangent = normalize((normal_matrix * vec4(tangent.xyz, 0.0)).xyz);
     v_bitangent = cross(v_normal, v_tangent) * tangent.w;
     v_uv = uv;
+    v_occlusion = occlusion;
     gl_Position = mvp * vec4(pos, 1.0);
+#ifdef CLUSTERED_LIGHTS
+    v_clip = gl_Position;
+#endif
 }
 @end
 
-@fs fs
+@block fs_common
 layout(binding=0) uniform texture2D base_color_tex;
 layout(binding=0) uniform sampler base_color_smp;
 layout(binding=1) uniform texture2D metallic_roughness_tex;
@@ -72,9 +88,16 @@ in vec3 v_normal;
 in vec3 v_tangent;
 in vec3 v_bitangent;
 in vec2 v_uv;
+in float v_occlusion;
 
 out vec4 frag_color;
 
+#ifdef CLUSTERED_LIGHTS
+in vec4 v_clip;
+
+@include_block clustered_lights
+#endif
+
 const float PI = 3.14159265359;
 
 // ============================================================================
@@ -163,6 +186,31 @@ float Fd_Lambert() {
     return 1.0 / PI;
 }
 
+// Cook-Torrance specular + Disney diffuse for one light, times N.L
+vec3 directLight(vec3 N, vec3 V, vec3 L, vec3 F0, vec3 diffuseColor, float metallic, float roughness, float NdotV) {
+    vec3 H = normalize(V + L);
+    
+    float NdotL = max(dot(N, L), 0.0001);
+    float NdotH = max(dot(N, H), 0.0);
+    float LdotH = max(dot(L, H), 0.0);
+    float VdotH = max(dot(V, H), 0.0);
+    
+    // GGX Specular BRDF
+    float D = D_GGX(NdotH, roughness);
+    float G = G_SmithGGX(NdotV, NdotL, roughness);
+    vec3 F = F_Schlick(VdotH, F0);
+    vec3 specular = D * G * F;
+    
+    // Disney Diffuse BRDF
+    float Fd = Fd_DisneyDiffuse(NdotV, NdotL, LdotH, roughness);
+    vec3 diffuse = diffuseColor * Fd;
+    
+    // Energy conservation: what's not reflected is diffused
+    vec3 kD = (1.0 - F) * (1.0 - metallic);
+    
+    return (kD * diffuse + specular) * NdotL;
+}
+
 void main() {
     // ========================================================================
     // Sample Material Textures
@@ -171,7 +219,7 @@ void main() {
     vec3 metallic_roughness = texture(sampler2D(metallic_roughness_tex, metallic_roughness_smp), v_uv).rgb;
     float metallic = metallic_roughness.b * metallic_factor;
     float roughness = clamp(metallic_roughness.g * roughness_factor, 0.04, 1.0);  // Clamp to avoid singularities
-    float ao = texture(sampler2D(occlusion_tex, occlusion_smp), v_uv).r;
+    float ao = texture(sampler2D(occlusion_tex, occlusion_smp), v_uv).r * v_occlusion;  // Times baked vertex AO
     vec3 emissive = texture(sampler2D(emissive_tex, emissive_smp), v_uv).rgb * emissive_factor;
     
     // Sample and transform normal map
@@ -196,29 +244,21 @@ void main() {
     // Direct Lighting (Directional Light)
     // ========================================================================
     vec3 L = normalize(vec3(1.0, 1.0, 1.0));
-    vec3 H = normalize(V + L);
-    
-    float NdotL = max(dot(N, L), 0.0001);
-    float NdotH = max(dot(N, H), 0.0);
-    float LdotH = max(dot(L, H), 0.0);
-    float VdotH = max(dot(V, H), 0.0);
-    
-    // GGX Specular BRDF
-    float D = D_GGX(NdotH, roughness);
-    float G = G_SmithGGX(NdotV, NdotL, roughness);
-    vec3 F = F_Schlick(VdotH, F0);
-    vec3 specular = D * G * F;
-    
-    // Disney Diffuse BRDF
-    float Fd = Fd_DisneyDiffuse(NdotV, NdotL, LdotH, roughness);
-    vec3 diffuse = diffuseColor * Fd;
-    
-    // Energy conservation: what's not reflected is diffused
-    vec3 kD = (1.0 - F) * (1.0 - metallic);
-    
-    // Direct lighting contribution
     vec3 lightColor = vec3(1.0);  // White directional light
-    vec3 Lo = (kD * diffuse + specular) * lightColor * NdotL;
+    vec3 Lo = directLight(N, V, L, F0, diffuseColor, metallic, roughness, NdotV) * lightColor;
+    
+#ifdef CLUSTERED_LIGHTS
+    // Point and spot lights reaching this pixel's cluster
+    uvec2 lightRange = clusterLightRange(v_clip);
+    for (uint i = 0u; i < lightRange.y; i++) {
+        punctual_light light = lights[light_indices[lightRange.x + i].light];
+        vec3 Lp;
+        float attenuation = punctualAttenuation(light, v_world_pos, Lp);
+        if (attenuation > 0.0) {
+            Lo += directLight(N, V, Lp, F0, diffuseColor, metallic, roughness, NdotV) * light.color_spot_scale.rgb * attenuation;
+        }
+    }
+#endif
     
     // ========================================================================
     // Image-Based Lighting (IBL)
@@ -258,4 +298,23 @@ void main() {
 }
 @end
 
+@vs vs
+@include_block vs_common
+@end
+
+@fs fs
+@include_block fs_common
+@end
+
+@vs vs_clustered
+#define CLUSTERED_LIGHTS
+@include_block vs_common
+@end
+
+@fs fs_clustered
+#define CLUSTERED_LIGHTS
+@include_block fs_common
+@end
+
 @program pbr vs fs
+@program pbr_clustered vs_clustered fs_clustered
@@ -5,7 +5,7 @@
     Generated by sokol-shdc (https://github.com/floooh/sokol-tools)
 
     Cmdline:
-        sokol-shdc --input E:/SW/CG/vrm/vrm_viewer/shader/pbr.glsl --output E:/SW/CG/vrm/vrm_viewer/shader/pbr.glsl.h --slang glsl430:hlsl5:metal_macos:spirv_vk --format sokol
+        sokol-shdc --input shader/pbr.glsl --output shader/pbr.glsl.h --slang glsl430:hlsl5:metal_macos:spirv_vk --format sokol
 
     Overview:
     =========
@@ -18,6 +18,17 @@
             ATTR_pbr_pbr_normal => 1
             ATTR_pbr_pbr_uv => 2
             ATTR_pbr_pbr_tangent => 3
+            ATTR_pbr_pbr_occlusion => 4
+    Shader program: 'pbr_clustered':
+        Get shader desc: pbr_pbr_clustered_shader_desc(sg_query_backend());
+        Vertex Shader: vs_clustered
+        Fragment Shader: fs_clustered
+        Attributes:
+            ATTR_pbr_pbr_clustered_pos => 0
+            ATTR_pbr_pbr_clustered_normal => 1
+            ATTR_pbr_pbr_clustered_uv => 2
+            ATTR_pbr_pbr_clustered_tangent => 3
+            ATTR_pbr_pbr_clustered_occlusion => 4
     Bindings:
         Uniform block 'vs_params':
             C struct: pbr_vs_params_t
@@ -25,6 +36,21 @@
         Uniform block 'fs_params':
             C struct: pbr_fs_params_t
             Bind slot: UB_pbr_fs_params => 1
+        Uniform block 'light_params':
+            C struct: pbr_light_params_t
+            Bind slot: UB_pbr_light_params => 3
+        Storage buffer 'light_clusters':
+            C struct: pbr_light_cluster_t
+            Bind slot: VIEW_pbr_light_clusters => 10
+            Readonly: true
+        Storage buffer 'punctual_lights':
+            C struct: pbr_punctual_light_t
+            Bind slot: VIEW_pbr_punctual_lights => 9
+            Readonly: true
+        Storage buffer 'light_index_list':
+            C struct: pbr_light_index_t
+            Bind slot: VIEW_pbr_light_index_list => 11
+            Readonly: true
         Texture 'base_color_tex':
             Image type: SG_IMAGETYPE_2D
             Sample type: SG_IMAGESAMPLETYPE_FLOAT
@@ -104,8 +130,18 @@
 #define ATTR_pbr_pbr_normal (1)
 #define ATTR_pbr_pbr_uv (2)
 #define ATTR_pbr_pbr_tangent (3)
+#define ATTR_pbr_pbr_occlusion (4)
+#define ATTR_pbr_pbr_clustered_pos (0)
+#define ATTR_pbr_pbr_clustered_normal (1)
+#define ATTR_pbr_pbr_clustered_uv (2)
+#define ATTR_pbr_pbr_clustered_tangent (3)
+#define ATTR_pbr_pbr_clustered_occlusion (4)
 #define UB_pbr_vs_params (0)
 #define UB_pbr_fs_params (1)
+#define UB_pbr_light_params (3)
+#define VIEW_pbr_light_clusters (10)
+#define VIEW_pbr_punctual_lights (9)
+#define VIEW_pbr_light_index_list (11)
 #define VIEW_pbr_base_color_tex (0)
 #define VIEW_pbr_metallic_roughness_tex (1)
 #define VIEW_pbr_occlusion_tex (3)
@@ -143,6 +179,30 @@ SOKOL_SHDC_ALIGN(16) typedef struct pbr_fs_params_t {
     float _pad1;
 } pbr_fs_params_t;
 #pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct pbr_light_params_t {
+    HMM_Vec4 cluster_grid;
+    HMM_Vec4 cluster_depth;
+} pbr_light_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(4) typedef struct pbr_light_cluster_t {
+    uint32_t offset;
+    uint32_t count;
+} pbr_light_cluster_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct pbr_punctual_light_t {
+    HMM_Vec4 position_range;
+    HMM_Vec4 color_spot_scale;
+    HMM_Vec4 direction_spot_offset;
+} pbr_punctual_light_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(4) typedef struct pbr_light_index_t {
+    uint32_t light;
+} pbr_light_index_t;
+#pragma pack(pop)
 /*
     #version 430
 
@@ -156,6 +216,8 @@ SOKOL_SHDC_ALIGN(16) typedef struct pbr_fs_params_t {
     layout(location = 3) out vec3 v_bitangent;
     layout(location = 4) out vec2 v_uv;
     layout(location = 2) in vec2 uv;
+    layout(location = 5) out float v_occlusion;
+    layout(location = 4) in float occlusion;
 
     void main()
     {
@@ -166,11 +228,12 @@ SOKOL_SHDC_ALIGN(16) typedef struct pbr_fs_params_t {
         v_tangent = normalize((_33 * vec4(tangent.xyz, 0.0)).xyz);
         v_bitangent = cross(v_normal, v_tangent) * tangent.w;
         v_uv = uv;
+        v_occlusion = occlusion;
         gl_Position = mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]) * _27;
     }
 
 */
-static const uint8_t pbr_vs_source_glsl430[887] = {
+static const uint8_t pbr_vs_source_glsl430[1001] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
     0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
     0x72,0x61,0x6d,0x73,0x5b,0x31,0x33,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
@@ -195,38 +258,45 @@ static const uint8_t pbr_vs_source_glsl430[887] = {
     0x34,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x75,0x76,
     0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
     0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x75,
-    0x76,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x32,0x37,0x20,0x3d,
-    0x20,0x76,0x65,0x63,0x34,0x28,0x70,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,
-    0x20,0x3d,0x20,0x28,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,
-    0x6d,0x73,0x5b,0x34,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
-    0x5b,0x35,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,
-    0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,
-    0x20,0x2a,0x20,0x5f,0x32,0x37,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x6d,0x61,0x74,0x34,0x20,0x5f,0x33,0x33,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,
-    0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2c,0x20,0x76,
-    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,0x2c,0x20,0x76,0x73,0x5f,
-    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,
-    0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,
-    0x6c,0x69,0x7a,0x65,0x28,0x28,0x5f,0x33,0x33,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,
-    0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x30,0x2e,0x30,0x29,0x29,0x2e,0x78,
-    0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,
-    0x6e,0x74,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x28,
-    0x5f,0x33,0x33,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x74,0x61,0x6e,0x67,0x65,
-    0x6e,0x74,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x30,0x2e,0x30,0x29,0x29,0x2e,0x78,0x79,
-    0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,
-    0x65,0x6e,0x74,0x20,0x3d,0x20,0x63,0x72,0x6f,0x73,0x73,0x28,0x76,0x5f,0x6e,0x6f,
-    0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x29,
-    0x20,0x2a,0x20,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x77,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,
-    0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,
-    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,
-    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,
-    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x5f,0x32,
-    0x37,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x35,0x29,0x20,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x34,0x29,0x20,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6f,0x63,0x63,
+    0x6c,0x75,0x73,0x69,0x6f,0x6e,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,
+    0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x5f,0x32,0x37,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x70,0x6f,0x73,0x2c,0x20,
+    0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,
+    0x64,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x28,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x5f,0x32,0x37,0x29,0x2e,0x78,0x79,0x7a,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x34,0x20,0x5f,0x33,0x33,0x20,0x3d,
+    0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x38,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x28,0x5f,0x33,0x33,0x20,0x2a,
+    0x20,0x76,0x65,0x63,0x34,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x30,0x2e,
+    0x30,0x29,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
+    0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x69,0x7a,0x65,0x28,0x28,0x5f,0x33,0x33,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,
+    0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x30,0x2e,0x30,
+    0x29,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x62,
+    0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,0x63,0x72,0x6f,0x73,0x73,
+    0x28,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,0x5f,0x74,0x61,0x6e,
+    0x67,0x65,0x6e,0x74,0x29,0x20,0x2a,0x20,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,
+    0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x75,0x76,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x30,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,
+    0x5f,0x32,0x37,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #version 430
@@ -242,6 +312,7 @@ static const uint8_t pbr_vs_source_glsl430[887] = {
     layout(binding = 7) uniform sampler2D brdf_lut_brdf_lut_smp;
 
     layout(location = 4) in vec2 v_uv;
+    layout(location = 5) in float v_occlusion;
     layout(location = 2) in vec3 v_tangent;
     layout(location = 3) in vec3 v_bitangent;
     layout(location = 1) in vec3 v_normal;
@@ -250,25 +321,25 @@ static const uint8_t pbr_vs_source_glsl430[887] = {
 
     float D_GGX(float NdotH, float roughness)
     {
-        float _130 = roughness * roughness;
-        float _134 = _130 * _130;
-        float _144 = ((NdotH * NdotH) * (_134 - 1.0)) + 1.0;
-        return _134 / ((3.1415927410125732421875 * _144) * _144);
+        float _141 = roughness * roughness;
+        float _145 = _141 * _141;
+        float _155 = ((NdotH * NdotH) * (_145 - 1.0)) + 1.0;
+        return _145 / ((3.1415927410125732421875 * _155) * _155);
     }
 
     float G_SmithGGX(float NdotV, float NdotL, float roughness)
     {
-        float _157 = roughness * roughness;
-        float _161 = _157 * _157;
-        float _168 = 1.0 - _161;
-        return 0.5 / max((NdotL * sqrt(((NdotV * NdotV) * _168) + _161)) + (NdotV * sqrt(((NdotL * NdotL) * _168) + _161)), 9.9999997473787516355514526367188e-05);
+        float _168 = roughness * roughness;
+        float _172 = _168 * _168;
+        float _179 = 1.0 - _172;
+        return 0.5 / max((NdotL * sqrt(((NdotV * NdotV) * _179) + _172)) + (NdotV * sqrt(((NdotL * NdotL) * _179) + _172)), 9.9999997473787516355514526367188e-05);
     }
 
     float SchlickFresnel(float u)
     {
-        float _115 = clamp(1.0 - u, 0.0, 1.0);
-        float _119 = _115 * _115;
-        return (_119 * _119) * _115;
+        float _126 = clamp(1.0 - u, 0.0, 1.0);
+        float _130 = _126 * _126;
+        return (_130 * _130) * _126;
     }
 
     vec3 F_Schlick(float VdotH, vec3 F0)
@@ -279,10 +350,29 @@ static const uint8_t pbr_vs_source_glsl430[887] = {
 
     float Fd_DisneyDiffuse(float NdotV, float NdotL, float LdotH, float roughness)
     {
-        float _240 = (mix(0.0, 0.5, roughness) + (((2.0 * LdotH) * LdotH) * roughness)) - 1.0;
+        float _251 = (mix(0.0, 0.5, roughness) + (((2.0 * LdotH) * LdotH) * roughness)) - 1.0;
         float param = NdotV;
         float param_1 = NdotL;
-        return ((1.0 + (_240 * SchlickFresnel(param))) * (1.0 + (_240 * SchlickFresnel(param_1)))) * mix(1.0, 0.662251651287078857421875, roughness);
+        return ((1.0 + (_251 * SchlickFresnel(param))) * (1.0 + (_251 * SchlickFresnel(param_1)))) * mix(1.0, 0.662251651287078857421875, roughness);
+    }
+
+    vec3 directLight(vec3 N, vec3 V, vec3 L, vec3 F0, vec3 diffuseColor, float metallic, float roughness, float NdotV)
+    {
+        vec3 _276 = normalize(V + L);
+        float _281 = max(dot(N, L), 9.9999997473787516355514526367188e-05);
+        float param = max(dot(N, _276), 0.0);
+        float param_1 = roughness;
+        float param_2 = NdotV;
+        float param_3 = _281;
+        float param_4 = roughness;
+        float param_5 = max(dot(V, _276), 0.0);
+        vec3 param_6 = F0;
+        vec3 _316 = F_Schlick(param_5, param_6);
+        float param_7 = NdotV;
+        float param_8 = _281;
+        float param_9 = max(dot(L, _276), 0.0);
+        float param_10 = roughness;
+        return ((((vec3(1.0) - _316) * (1.0 - metallic)) * (diffuseColor * Fd_DisneyDiffuse(param_7, param_8, param_9, param_10))) + (_316 * (D_GGX(param, param_1) * G_SmithGGX(param_2, param_3, param_4)))) * _281;
     }
 
     vec3 F_SchlickRoughness(float NdotV, vec3 F0, float roughness)
@@ -303,43 +393,37 @@ static const uint8_t pbr_vs_source_glsl430[887] = {
 
     void main()
     {
-        vec4 _287 = texture(base_color_tex_base_color_smp, v_uv) * fs_params[0];
-        vec4 _295 = texture(metallic_roughness_tex_metallic_roughness_smp, v_uv);
-        float _306 = _295.z * fs_params[1].x;
-        float _316 = clamp(_295.y * fs_params[1].y, 0.039999999105930328369140625, 1.0);
-        vec3 _381 = normalize(mat3(v_tangent, v_bitangent, v_normal) * ((texture(normal_tex_normal_smp, v_uv).xyz * 2.0) - vec3(1.0)));
-        vec3 _389 = normalize(fs_params[3].xyz - v_world_pos);
-        float _399 = max(dot(_381, _389), 9.9999997473787516355514526367188e-05);
-        vec3 _403 = _287.xyz;
-        vec3 _406 = mix(vec3(0.039999999105930328369140625), _403, vec3(_306));
-        float _411 = 1.0 - _306;
-        vec3 _412 = _403 * _411;
-        vec3 _420 = normalize(_389 + vec3(0.57735025882720947265625));
-        float _425 = max(dot(_381, vec3(0.57735025882720947265625)), 9.9999997473787516355514526367188e-05);
-        float param = max(dot(_381, _420), 0.0);
-        float param_1 = _316;
-        float param_2 = _399;
-        float param_3 = _425;
-        float param_4 = _316;
-        float param_5 = max(dot(_389, _420), 0.0);
-        vec3 param_6 = _406;
-        vec3 _460 = F_Schlick(param_5, param_6);
-        float param_7 = _399;
-        float param_8 = _425;
-        float param_9 = max(dot(vec3(0.57735025882720947265625), _420), 0.0);
-        float param_10 = _316;
-        float param_11 = _399;
-        vec3 param_12 = _406;
-        float param_13 = _316;
-        vec3 _507 = F_SchlickRoughness(param_11, param_12, param_13);
-        vec4 _555 = texture(brdf_lut_brdf_lut_smp, vec2(_399, _316));
-        vec3 param_14 = ((((((vec3(1.0) - _507) * _411) * ((texture(irradiance_map_irradiance_smp, _381).xyz * _412) * 0.300000011920928955078125)) + ((textureLod(prefilter_map_prefilter_smp, reflect(-_389, _381), _316 * 4.0).xyz * ((_507 * _555.x) + vec3(_555.y))) * 0.5)) * texture(occlusion_tex_occlusion_smp, v_uv).x) + (((((vec3(1.0) - _460) * _411) * (_412 * Fd_DisneyDiffuse(param_7, param_8, param_9, param_10))) + (_460 * (D_GGX(param, param_1) * G_SmithGGX(param_2, param_3, param_4)))) * _425)) + (texture(emissive_tex_emissive_smp, v_uv).xyz * fs_params[2].xyz);
-        vec3 param_15 = ACESFilm(param_14);
-        frag_color = vec4(linearToSRGB(param_15), _287.w);
+        vec4 _379 = texture(base_color_tex_base_color_smp, v_uv) * fs_params[0];
+        vec4 _387 = texture(metallic_roughness_tex_metallic_roughness_smp, v_uv);
+        float _398 = _387.z * fs_params[1].x;
+        float _408 = clamp(_387.y * fs_params[1].y, 0.039999999105930328369140625, 1.0);
+        vec3 _477 = normalize(mat3(v_tangent, v_bitangent, v_normal) * ((texture(normal_tex_normal_smp, v_uv).xyz * 2.0) - vec3(1.0)));
+        vec3 _485 = normalize(fs_params[3].xyz - v_world_pos);
+        float _495 = max(dot(_477, _485), 9.9999997473787516355514526367188e-05);
+        vec3 _499 = _379.xyz;
+        vec3 _502 = mix(vec3(0.039999999105930328369140625), _499, vec3(_398));
+        float _507 = 1.0 - _398;
+        vec3 _508 = _499 * _507;
+        vec3 param = _477;
+        vec3 param_1 = _485;
+        vec3 param_2 = vec3(0.57735025882720947265625);
+        vec3 param_3 = _502;
+        vec3 param_4 = _508;
+        float param_5 = _398;
+        float param_6 = _408;
+        float param_7 = _495;
+        float param_8 = _495;
+        vec3 param_9 = _502;
+        float param_10 = _408;
+        vec3 _541 = F_SchlickRoughness(param_8, param_9, param_10);
+        vec4 _589 = texture(brdf_lut_brdf_lut_smp, vec2(_495, _408));
+        vec3 param_11 = ((((((vec3(1.0) - _541) * _507) * ((texture(irradiance_map_irradiance_smp, _477).xyz * _508) * 0.300000011920928955078125)) + ((textureLod(prefilter_map_prefilter_smp, reflect(-_485, _477), _408 * 4.0).xyz * ((_541 * _589.x) + vec3(_589.y))) * 0.5)) * (texture(occlusion_tex_occlusion_smp, v_uv).x * v_occlusion)) + directLight(param, param_1, param_2, param_3, param_4, param_5, param_6, param_7)) + (texture(emissive_tex_emissive_smp, v_uv).xyz * fs_params[2].xyz);
+        vec3 param_12 = ACESFilm(param_11);
+        frag_color = vec4(linearToSRGB(param_12), _379.w);
     }
 
 */
-static const uint8_t pbr_fs_source_glsl430[4917] = {
+static const uint8_t pbr_fs_source_glsl430[5345] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
     0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x70,0x61,
     0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
@@ -380,93 +464,888 @@ static const uint8_t pbr_fs_source_glsl430[4917] = {
     0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
     0x34,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,
     0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
-    0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x5f,
-    0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
-    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,
-    0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,
+    0x20,0x3d,0x20,0x35,0x29,0x20,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,
+    0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,
+    0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,
+    0x6e,0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,
+    0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x44,0x5f,0x47,0x47,0x58,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,
+    0x48,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,
+    0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x31,0x34,0x31,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
+    0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x34,0x35,0x20,0x3d,0x20,0x5f,
+    0x31,0x34,0x31,0x20,0x2a,0x20,0x5f,0x31,0x34,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x35,0x35,0x20,0x3d,0x20,0x28,0x28,0x4e,
+    0x64,0x6f,0x74,0x48,0x20,0x2a,0x20,0x4e,0x64,0x6f,0x74,0x48,0x29,0x20,0x2a,0x20,
+    0x28,0x5f,0x31,0x34,0x35,0x20,0x2d,0x20,0x31,0x2e,0x30,0x29,0x29,0x20,0x2b,0x20,
+    0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x5f,0x31,0x34,0x35,0x20,0x2f,0x20,0x28,0x28,0x33,0x2e,0x31,0x34,0x31,0x35,0x39,
+    0x32,0x37,0x34,0x31,0x30,0x31,0x32,0x35,0x37,0x33,0x32,0x34,0x32,0x31,0x38,0x37,
+    0x35,0x20,0x2a,0x20,0x5f,0x31,0x35,0x35,0x29,0x20,0x2a,0x20,0x5f,0x31,0x35,0x35,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x47,0x5f,0x53,0x6d,
+    0x69,0x74,0x68,0x47,0x47,0x58,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,
+    0x74,0x56,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,
+    0x36,0x38,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x20,0x2a,
+    0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x37,0x32,0x20,0x3d,0x20,0x5f,0x31,0x36,
+    0x38,0x20,0x2a,0x20,0x5f,0x31,0x36,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x31,0x37,0x39,0x20,0x3d,0x20,0x31,0x2e,0x30,0x20,0x2d,
+    0x20,0x5f,0x31,0x37,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x30,0x2e,0x35,0x20,0x2f,0x20,0x6d,0x61,0x78,0x28,0x28,0x4e,0x64,0x6f,
+    0x74,0x4c,0x20,0x2a,0x20,0x73,0x71,0x72,0x74,0x28,0x28,0x28,0x4e,0x64,0x6f,0x74,
+    0x56,0x20,0x2a,0x20,0x4e,0x64,0x6f,0x74,0x56,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,
+    0x39,0x29,0x20,0x2b,0x20,0x5f,0x31,0x37,0x32,0x29,0x29,0x20,0x2b,0x20,0x28,0x4e,
+    0x64,0x6f,0x74,0x56,0x20,0x2a,0x20,0x73,0x71,0x72,0x74,0x28,0x28,0x28,0x4e,0x64,
+    0x6f,0x74,0x4c,0x20,0x2a,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x29,0x20,0x2a,0x20,0x5f,
+    0x31,0x37,0x39,0x29,0x20,0x2b,0x20,0x5f,0x31,0x37,0x32,0x29,0x29,0x2c,0x20,0x39,
+    0x2e,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,
+    0x36,0x33,0x35,0x35,0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,
+    0x65,0x2d,0x30,0x35,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x75,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x31,0x32,0x36,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,
+    0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x75,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x31,0x33,0x30,0x20,0x3d,0x20,0x5f,0x31,0x32,0x36,0x20,0x2a,0x20,0x5f,0x31,0x32,
+    0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x5f,
+    0x31,0x33,0x30,0x20,0x2a,0x20,0x5f,0x31,0x33,0x30,0x29,0x20,0x2a,0x20,0x5f,0x31,
+    0x32,0x36,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x46,0x5f,0x53,0x63,
+    0x68,0x6c,0x69,0x63,0x6b,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x56,0x64,0x6f,0x74,
+    0x48,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x46,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,
+    0x56,0x64,0x6f,0x74,0x48,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x46,0x30,0x20,0x2b,0x20,0x28,0x28,0x76,0x65,0x63,0x33,0x28,0x31,0x2e,
+    0x30,0x29,0x20,0x2d,0x20,0x46,0x30,0x29,0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,0x69,
+    0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x46,0x64,0x5f,0x44,
+    0x69,0x73,0x6e,0x65,0x79,0x44,0x69,0x66,0x66,0x75,0x73,0x65,0x28,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x56,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x4e,0x64,0x6f,0x74,0x4c,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4c,0x64,0x6f,
+    0x74,0x48,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,
+    0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x5f,0x32,0x35,0x31,0x20,0x3d,0x20,0x28,0x6d,0x69,0x78,0x28,0x30,0x2e,0x30,
+    0x2c,0x20,0x30,0x2e,0x35,0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
+    0x29,0x20,0x2b,0x20,0x28,0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x4c,0x64,0x6f,
+    0x74,0x48,0x29,0x20,0x2a,0x20,0x4c,0x64,0x6f,0x74,0x48,0x29,0x20,0x2a,0x20,0x72,
+    0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x29,0x20,0x2d,0x20,0x31,0x2e,0x30,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x4e,
+    0x64,0x6f,0x74,0x4c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x28,0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,0x5f,0x32,0x35,0x31,0x20,0x2a,
+    0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x29,0x20,0x2a,0x20,0x28,0x31,0x2e,0x30,0x20,
+    0x2b,0x20,0x28,0x5f,0x32,0x35,0x31,0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,
+    0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x29,0x29,0x29,0x29,0x20,0x2a,0x20,0x6d,0x69,0x78,0x28,0x31,0x2e,0x30,0x2c,0x20,
+    0x30,0x2e,0x36,0x36,0x32,0x32,0x35,0x31,0x36,0x35,0x31,0x32,0x38,0x37,0x30,0x37,
+    0x38,0x38,0x35,0x37,0x34,0x32,0x31,0x38,0x37,0x35,0x2c,0x20,0x72,0x6f,0x75,0x67,
+    0x68,0x6e,0x65,0x73,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,
+    0x64,0x69,0x72,0x65,0x63,0x74,0x4c,0x69,0x67,0x68,0x74,0x28,0x76,0x65,0x63,0x33,
+    0x20,0x4e,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x56,0x2c,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x4c,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x46,0x30,0x2c,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x56,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x32,0x37,0x36,0x20,0x3d,0x20,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x56,0x20,0x2b,0x20,0x4c,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x38,0x31,
+    0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x4e,0x2c,0x20,0x4c,0x29,
+    0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,
+    0x37,0x35,0x31,0x36,0x33,0x35,0x35,0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,
+    0x31,0x38,0x38,0x65,0x2d,0x30,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,
+    0x64,0x6f,0x74,0x28,0x4e,0x2c,0x20,0x5f,0x32,0x37,0x36,0x29,0x2c,0x20,0x30,0x2e,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,
+    0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,
+    0x3d,0x20,0x5f,0x32,0x38,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,
+    0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,
+    0x6f,0x74,0x28,0x56,0x2c,0x20,0x5f,0x32,0x37,0x36,0x29,0x2c,0x20,0x30,0x2e,0x30,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x36,0x20,0x3d,0x20,0x46,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x33,0x20,0x5f,0x33,0x31,0x36,0x20,0x3d,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,
+    0x69,0x63,0x6b,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x2c,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x36,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x38,0x20,0x3d,0x20,0x5f,0x32,0x38,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,
+    0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x4c,0x2c,0x20,0x5f,0x32,0x37,0x36,0x29,
+    0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x20,0x3d,0x20,0x72,0x6f,0x75,
+    0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x28,0x28,0x28,0x28,0x76,0x65,0x63,0x33,0x28,0x31,0x2e,0x30,0x29,
+    0x20,0x2d,0x20,0x5f,0x33,0x31,0x36,0x29,0x20,0x2a,0x20,0x28,0x31,0x2e,0x30,0x20,
+    0x2d,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x29,0x29,0x20,0x2a,0x20,0x28,
+    0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x46,
+    0x64,0x5f,0x44,0x69,0x73,0x6e,0x65,0x79,0x44,0x69,0x66,0x66,0x75,0x73,0x65,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x30,0x29,0x29,0x29,0x20,0x2b,0x20,0x28,0x5f,0x33,0x31,0x36,0x20,0x2a,
+    0x20,0x28,0x44,0x5f,0x47,0x47,0x58,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x20,0x2a,0x20,0x47,0x5f,0x53,0x6d,0x69,0x74,
+    0x68,0x47,0x47,0x58,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x29,0x29,
+    0x29,0x29,0x20,0x2a,0x20,0x5f,0x32,0x38,0x31,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,
+    0x63,0x33,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x52,0x6f,0x75,0x67,
+    0x68,0x6e,0x65,0x73,0x73,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,
+    0x56,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x46,0x30,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,
+    0x20,0x4e,0x64,0x6f,0x74,0x56,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x46,0x30,0x20,0x2b,0x20,0x28,0x28,0x6d,0x61,0x78,0x28,0x76,0x65,
+    0x63,0x33,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,
+    0x73,0x73,0x29,0x2c,0x20,0x46,0x30,0x29,0x20,0x2d,0x20,0x46,0x30,0x29,0x20,0x2a,
+    0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x33,
+    0x20,0x41,0x43,0x45,0x53,0x46,0x69,0x6c,0x6d,0x28,0x76,0x65,0x63,0x33,0x20,0x78,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,
+    0x6c,0x61,0x6d,0x70,0x28,0x28,0x78,0x20,0x2a,0x20,0x28,0x28,0x78,0x20,0x2a,0x20,
+    0x32,0x2e,0x35,0x30,0x39,0x39,0x39,0x39,0x39,0x39,0x30,0x34,0x36,0x33,0x32,0x35,
+    0x36,0x38,0x33,0x35,0x39,0x33,0x37,0x35,0x29,0x20,0x2b,0x20,0x76,0x65,0x63,0x33,
+    0x28,0x30,0x2e,0x30,0x32,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x33,0x32,0x39,0x34,
+    0x34,0x37,0x37,0x34,0x36,0x32,0x37,0x36,0x38,0x35,0x35,0x34,0x36,0x38,0x37,0x35,
+    0x29,0x29,0x29,0x20,0x2f,0x20,0x28,0x28,0x78,0x20,0x2a,0x20,0x28,0x28,0x78,0x20,
+    0x2a,0x20,0x32,0x2e,0x34,0x33,0x30,0x30,0x30,0x30,0x30,0x36,0x36,0x37,0x35,0x37,
+    0x32,0x30,0x32,0x31,0x34,0x38,0x34,0x33,0x37,0x35,0x29,0x20,0x2b,0x20,0x76,0x65,
+    0x63,0x33,0x28,0x30,0x2e,0x35,0x38,0x39,0x39,0x39,0x39,0x39,0x37,0x33,0x37,0x37,
+    0x33,0x39,0x35,0x36,0x32,0x39,0x38,0x38,0x32,0x38,0x31,0x32,0x35,0x29,0x29,0x29,
+    0x20,0x2b,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x31,0x34,0x30,0x30,0x30,0x30,
+    0x30,0x30,0x30,0x35,0x39,0x36,0x30,0x34,0x36,0x34,0x34,0x37,0x37,0x35,0x33,0x39,
+    0x30,0x36,0x32,0x35,0x29,0x29,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,
+    0x29,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x54,0x6f,0x53,
+    0x52,0x47,0x42,0x28,0x76,0x65,0x63,0x33,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x69,0x78,0x28,0x63,0x20,0x2a,
+    0x20,0x31,0x32,0x2e,0x39,0x32,0x30,0x30,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,
+    0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x2c,0x20,0x28,0x70,0x6f,0x77,0x28,0x6d,0x61,
+    0x78,0x28,0x63,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x29,0x29,0x2c,
+    0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x34,0x31,0x36,0x36,0x36,0x36,0x36,0x35,
+    0x36,0x37,0x33,0x32,0x35,0x35,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,
+    0x35,0x29,0x29,0x20,0x2a,0x20,0x31,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x34,
+    0x37,0x35,0x34,0x37,0x39,0x31,0x32,0x35,0x39,0x37,0x36,0x35,0x36,0x32,0x35,0x29,
+    0x20,0x2d,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,
+    0x39,0x39,0x39,0x37,0x30,0x31,0x39,0x37,0x36,0x37,0x37,0x36,0x31,0x32,0x33,0x30,
+    0x34,0x36,0x38,0x37,0x35,0x29,0x2c,0x20,0x73,0x74,0x65,0x70,0x28,0x76,0x65,0x63,
+    0x33,0x28,0x30,0x2e,0x30,0x30,0x33,0x31,0x33,0x30,0x38,0x30,0x30,0x30,0x39,0x30,
+    0x37,0x33,0x30,0x31,0x39,0x30,0x32,0x37,0x37,0x30,0x39,0x39,0x36,0x30,0x39,0x33,
+    0x37,0x35,0x29,0x2c,0x20,0x63,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,
+    0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x5f,0x33,0x37,0x39,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x28,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x74,0x65,
+    0x78,0x5f,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,0x20,0x2a,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x30,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x5f,0x33,0x38,0x37,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,
+    0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,
+    0x73,0x73,0x5f,0x74,0x65,0x78,0x5f,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,
+    0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x76,
+    0x5f,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x33,0x39,0x38,0x20,0x3d,0x20,0x5f,0x33,0x38,0x37,0x2e,0x7a,0x20,0x2a,0x20,
+    0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x30,0x38,0x20,0x3d,
+    0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x5f,0x33,0x38,0x37,0x2e,0x79,0x20,0x2a,0x20,
+    0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x79,0x2c,0x20,
+    0x30,0x2e,0x30,0x33,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x31,0x30,0x35,0x39,0x33,
+    0x30,0x33,0x32,0x38,0x33,0x36,0x39,0x31,0x34,0x30,0x36,0x32,0x35,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x34,
+    0x37,0x37,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6d,
+    0x61,0x74,0x33,0x28,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2c,0x20,0x76,
+    0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2c,0x20,0x76,0x5f,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x29,0x20,0x2a,0x20,0x28,0x28,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x74,0x65,0x78,0x5f,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,0x2e,0x78,
+    0x79,0x7a,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,0x20,0x2d,0x20,0x76,0x65,0x63,0x33,
+    0x28,0x31,0x2e,0x30,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x5f,0x34,0x38,0x35,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,
+    0x7a,0x65,0x28,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x2e,
+    0x78,0x79,0x7a,0x20,0x2d,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,
+    0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,
+    0x39,0x35,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x37,
+    0x37,0x2c,0x20,0x5f,0x34,0x38,0x35,0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,
+    0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,0x35,0x35,
+    0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,0x35,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x34,0x39,0x39,0x20,
+    0x3d,0x20,0x5f,0x33,0x37,0x39,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x33,0x20,0x5f,0x35,0x30,0x32,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,
+    0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x33,0x39,0x39,0x39,0x39,0x39,0x39,0x39,
+    0x31,0x30,0x35,0x39,0x33,0x30,0x33,0x32,0x38,0x33,0x36,0x39,0x31,0x34,0x30,0x36,
+    0x32,0x35,0x29,0x2c,0x20,0x5f,0x34,0x39,0x39,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,
+    0x5f,0x33,0x39,0x38,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x35,0x30,0x37,0x20,0x3d,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x5f,
+    0x33,0x39,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x35,
+    0x30,0x38,0x20,0x3d,0x20,0x5f,0x34,0x39,0x39,0x20,0x2a,0x20,0x5f,0x35,0x30,0x37,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x20,0x3d,0x20,0x5f,0x34,0x37,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x5f,0x34,0x38,0x35,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x32,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x35,0x37,0x37,0x33,
+    0x35,0x30,0x32,0x35,0x38,0x38,0x32,0x37,0x32,0x30,0x39,0x34,0x37,0x32,0x36,0x35,
+    0x36,0x32,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x5f,0x35,0x30,0x32,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,
+    0x3d,0x20,0x5f,0x35,0x30,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x5f,0x33,0x39,0x38,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x36,0x20,0x3d,0x20,0x5f,0x34,0x30,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,
+    0x5f,0x34,0x39,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x20,0x3d,0x20,0x5f,0x34,0x39,0x35,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,
+    0x20,0x3d,0x20,0x5f,0x35,0x30,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x20,0x3d,0x20,0x5f,0x34,
+    0x30,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x35,0x34,
+    0x31,0x20,0x3d,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x52,0x6f,0x75,
+    0x67,0x68,0x6e,0x65,0x73,0x73,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x2c,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x35,0x38,
+    0x39,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x62,0x72,0x64,0x66,
+    0x5f,0x6c,0x75,0x74,0x5f,0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,0x5f,0x73,0x6d,
+    0x70,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x5f,0x34,0x39,0x35,0x2c,0x20,0x5f,0x34,
+    0x30,0x38,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x20,0x3d,0x20,0x28,0x28,0x28,0x28,0x28,0x28,
+    0x76,0x65,0x63,0x33,0x28,0x31,0x2e,0x30,0x29,0x20,0x2d,0x20,0x5f,0x35,0x34,0x31,
+    0x29,0x20,0x2a,0x20,0x5f,0x35,0x30,0x37,0x29,0x20,0x2a,0x20,0x28,0x28,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x28,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,
+    0x5f,0x6d,0x61,0x70,0x5f,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5f,
+    0x73,0x6d,0x70,0x2c,0x20,0x5f,0x34,0x37,0x37,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,
+    0x20,0x5f,0x35,0x30,0x38,0x29,0x20,0x2a,0x20,0x30,0x2e,0x33,0x30,0x30,0x30,0x30,
+    0x30,0x30,0x31,0x31,0x39,0x32,0x30,0x39,0x32,0x38,0x39,0x35,0x35,0x30,0x37,0x38,
+    0x31,0x32,0x35,0x29,0x29,0x20,0x2b,0x20,0x28,0x28,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x4c,0x6f,0x64,0x28,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,0x6d,
+    0x61,0x70,0x5f,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x5f,0x34,0x38,0x35,0x2c,
+    0x20,0x5f,0x34,0x37,0x37,0x29,0x2c,0x20,0x5f,0x34,0x30,0x38,0x20,0x2a,0x20,0x34,
+    0x2e,0x30,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x28,0x28,0x5f,0x35,0x34,0x31,
+    0x20,0x2a,0x20,0x5f,0x35,0x38,0x39,0x2e,0x78,0x29,0x20,0x2b,0x20,0x76,0x65,0x63,
+    0x33,0x28,0x5f,0x35,0x38,0x39,0x2e,0x79,0x29,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,
+    0x35,0x29,0x29,0x20,0x2a,0x20,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x6f,
+    0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x74,0x65,0x78,0x5f,0x6f,0x63,0x63,
+    0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x76,0x5f,0x75,0x76,
+    0x29,0x2e,0x78,0x20,0x2a,0x20,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,
+    0x6e,0x29,0x29,0x20,0x2b,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x4c,0x69,0x67,0x68,
+    0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x2c,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x37,0x29,0x29,0x20,0x2b,0x20,0x28,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x28,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x74,0x65,0x78,
+    0x5f,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x76,
+    0x5f,0x75,0x76,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x66,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x20,
+    0x3d,0x20,0x41,0x43,0x45,0x53,0x46,0x69,0x6c,0x6d,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x6c,0x69,0x6e,0x65,
+    0x61,0x72,0x54,0x6f,0x53,0x52,0x47,0x42,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x32,0x29,0x2c,0x20,0x5f,0x33,0x37,0x39,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x00,
+};
+/*
+    #version 430
+
+    uniform vec4 vs_params[13];
+    layout(location = 0) out vec3 v_world_pos;
+    layout(location = 0) in vec3 pos;
+    layout(location = 1) out vec3 v_normal;
+    layout(location = 1) in vec3 normal;
+    layout(location = 2) out vec3 v_tangent;
+    layout(location = 3) in vec4 tangent;
+    layout(location = 3) out vec3 v_bitangent;
+    layout(location = 4) out vec2 v_uv;
+    layout(location = 2) in vec2 uv;
+    layout(location = 5) out float v_occlusion;
+    layout(location = 4) in float occlusion;
+    layout(location = 6) out vec4 v_clip;
+
+    void main()
+    {
+        vec4 _27 = vec4(pos, 1.0);
+        v_world_pos = (mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7]) * _27).xyz;
+        mat4 _33 = mat4(vs_params[8], vs_params[9], vs_params[10], vs_params[11]);
+        v_normal = normalize((_33 * vec4(normal, 0.0)).xyz);
+        v_tangent = normalize((_33 * vec4(tangent.xyz, 0.0)).xyz);
+        v_bitangent = cross(v_normal, v_tangent) * tangent.w;
+        v_uv = uv;
+        v_occlusion = occlusion;
+        gl_Position = mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]) * _27;
+        v_clip = gl_Position;
+    }
+
+*/
+static const uint8_t pbr_vs_clustered_source_glsl430[1065] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x33,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,
+    0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,
+    0x70,0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x70,0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,0x74,0x20,
+    0x76,0x65,0x63,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x74,0x61,0x6e,0x67,0x65,0x6e,
     0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
-    0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,
-    0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
-    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,
-    0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,
-    0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
-    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
-    0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x66,
-    0x6c,0x6f,0x61,0x74,0x20,0x44,0x5f,0x47,0x47,0x58,0x28,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x4e,0x64,0x6f,0x74,0x48,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,
-    0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x33,0x30,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,
-    0x68,0x6e,0x65,0x73,0x73,0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,
-    0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x33,
-    0x34,0x20,0x3d,0x20,0x5f,0x31,0x33,0x30,0x20,0x2a,0x20,0x5f,0x31,0x33,0x30,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x34,0x34,0x20,
-    0x3d,0x20,0x28,0x28,0x4e,0x64,0x6f,0x74,0x48,0x20,0x2a,0x20,0x4e,0x64,0x6f,0x74,
-    0x48,0x29,0x20,0x2a,0x20,0x28,0x5f,0x31,0x33,0x34,0x20,0x2d,0x20,0x31,0x2e,0x30,
-    0x29,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
-    0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x33,0x34,0x20,0x2f,0x20,0x28,0x28,0x33,0x2e,
-    0x31,0x34,0x31,0x35,0x39,0x32,0x37,0x34,0x31,0x30,0x31,0x32,0x35,0x37,0x33,0x32,
-    0x34,0x32,0x31,0x38,0x37,0x35,0x20,0x2a,0x20,0x5f,0x31,0x34,0x34,0x29,0x20,0x2a,
-    0x20,0x5f,0x31,0x34,0x34,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x47,0x5f,0x53,0x6d,0x69,0x74,0x68,0x47,0x47,0x58,0x28,0x66,0x6c,0x6f,0x61,
-    0x74,0x20,0x4e,0x64,0x6f,0x74,0x56,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,
-    0x64,0x6f,0x74,0x4c,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,
-    0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x20,0x5f,0x31,0x35,0x37,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,
-    0x65,0x73,0x73,0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x36,0x31,0x20,
-    0x3d,0x20,0x5f,0x31,0x35,0x37,0x20,0x2a,0x20,0x5f,0x31,0x35,0x37,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x36,0x38,0x20,0x3d,0x20,
-    0x31,0x2e,0x30,0x20,0x2d,0x20,0x5f,0x31,0x36,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x2e,0x35,0x20,0x2f,0x20,0x6d,0x61,0x78,
-    0x28,0x28,0x4e,0x64,0x6f,0x74,0x4c,0x20,0x2a,0x20,0x73,0x71,0x72,0x74,0x28,0x28,
-    0x28,0x4e,0x64,0x6f,0x74,0x56,0x20,0x2a,0x20,0x4e,0x64,0x6f,0x74,0x56,0x29,0x20,
-    0x2a,0x20,0x5f,0x31,0x36,0x38,0x29,0x20,0x2b,0x20,0x5f,0x31,0x36,0x31,0x29,0x29,
-    0x20,0x2b,0x20,0x28,0x4e,0x64,0x6f,0x74,0x56,0x20,0x2a,0x20,0x73,0x71,0x72,0x74,
-    0x28,0x28,0x28,0x4e,0x64,0x6f,0x74,0x4c,0x20,0x2a,0x20,0x4e,0x64,0x6f,0x74,0x4c,
-    0x29,0x20,0x2a,0x20,0x5f,0x31,0x36,0x38,0x29,0x20,0x2b,0x20,0x5f,0x31,0x36,0x31,
-    0x29,0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x33,
-    0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,0x35,0x35,0x31,0x34,0x35,0x32,0x36,0x33,
-    0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,0x35,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,
-    0x6c,0x6f,0x61,0x74,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,
-    0x6e,0x65,0x6c,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x75,0x29,0x0a,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x31,0x35,0x20,0x3d,0x20,
-    0x63,0x6c,0x61,0x6d,0x70,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x75,0x2c,0x20,0x30,
-    0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x20,0x5f,0x31,0x31,0x39,0x20,0x3d,0x20,0x5f,0x31,0x31,0x35,0x20,
-    0x2a,0x20,0x5f,0x31,0x31,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
-    0x72,0x6e,0x20,0x28,0x5f,0x31,0x31,0x39,0x20,0x2a,0x20,0x5f,0x31,0x31,0x39,0x29,
-    0x20,0x2a,0x20,0x5f,0x31,0x31,0x35,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x33,
-    0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x28,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x56,0x64,0x6f,0x74,0x48,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x46,0x30,0x29,
-    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x20,0x3d,0x20,0x56,0x64,0x6f,0x74,0x48,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x46,0x30,0x20,0x2b,0x20,0x28,0x28,0x76,0x65,
-    0x63,0x33,0x28,0x31,0x2e,0x30,0x29,0x20,0x2d,0x20,0x46,0x30,0x29,0x20,0x2a,0x20,
-    0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x70,
-    0x61,0x72,0x61,0x6d,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x46,0x64,0x5f,0x44,0x69,0x73,0x6e,0x65,0x79,0x44,0x69,0x66,0x66,0x75,0x73,
-    0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x56,0x2c,0x20,0x66,
+    0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x34,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x75,0x76,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x75,
+    0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x35,0x29,0x20,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x34,0x29,0x20,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6f,0x63,0x63,
+    0x6c,0x75,0x73,0x69,0x6f,0x6e,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x36,0x29,0x20,0x6f,0x75,0x74,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x5f,0x63,0x6c,0x69,0x70,0x3b,0x0a,0x0a,0x76,
+    0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x32,0x37,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,
+    0x28,0x70,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x28,0x6d,
+    0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x5f,0x32,
+    0x37,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x34,
+    0x20,0x5f,0x33,0x33,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x39,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x31,0x30,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x31,0x31,0x5d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,
+    0x28,0x5f,0x33,0x33,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x2c,0x20,0x30,0x2e,0x30,0x29,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x28,0x5f,0x33,0x33,0x20,0x2a,
+    0x20,0x76,0x65,0x63,0x34,0x28,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x78,0x79,
+    0x7a,0x2c,0x20,0x30,0x2e,0x30,0x29,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,
+    0x20,0x63,0x72,0x6f,0x73,0x73,0x28,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,
+    0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x29,0x20,0x2a,0x20,0x74,0x61,
+    0x6e,0x67,0x65,0x6e,0x74,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,
+    0x76,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x6f,0x63,
+    0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,
+    0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x33,0x5d,0x29,0x20,0x2a,0x20,0x5f,0x32,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x5f,0x63,0x6c,0x69,0x70,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    struct punctual_light
+    {
+        vec4 position_range;
+        vec4 color_spot_scale;
+        vec4 direction_spot_offset;
+    };
+
+    struct light_cluster
+    {
+        uint offset;
+        uint count;
+    };
+
+    struct light_index
+    {
+        uint light;
+    };
+
+    uniform vec4 light_params[2];
+    layout(binding = 10, std430) readonly buffer light_clusters
+    {
+        light_cluster clusters[];
+    } _160;
+
+    uniform vec4 fs_params[4];
+    layout(binding = 9, std430) readonly buffer punctual_lights
+    {
+        punctual_light lights[];
+    } _715;
+
+    layout(binding = 11, std430) readonly buffer light_index_list
+    {
+        light_index light_indices[];
+    } _720;
+
+    layout(binding = 0) uniform sampler2D base_color_tex_base_color_smp;
+    layout(binding = 1) uniform sampler2D metallic_roughness_tex_metallic_roughness_smp;
+    layout(binding = 2) uniform sampler2D occlusion_tex_occlusion_smp;
+    layout(binding = 3) uniform sampler2D emissive_tex_emissive_smp;
+    layout(binding = 4) uniform sampler2D normal_tex_normal_smp;
+    layout(binding = 5) uniform samplerCube irradiance_map_irradiance_smp;
+    layout(binding = 6) uniform samplerCube prefilter_map_prefilter_smp;
+    layout(binding = 7) uniform sampler2D brdf_lut_brdf_lut_smp;
+
+    layout(location = 4) in vec2 v_uv;
+    layout(location = 5) in float v_occlusion;
+    layout(location = 2) in vec3 v_tangent;
+    layout(location = 3) in vec3 v_bitangent;
+    layout(location = 1) in vec3 v_normal;
+    layout(location = 0) in vec3 v_world_pos;
+    layout(location = 6) in vec4 v_clip;
+    layout(location = 0) out vec4 frag_color;
+
+    float D_GGX(float NdotH, float roughness)
+    {
+        float _313 = roughness * roughness;
+        float _317 = _313 * _313;
+        float _327 = ((NdotH * NdotH) * (_317 - 1.0)) + 1.0;
+        return _317 / ((3.1415927410125732421875 * _327) * _327);
+    }
+
+    float G_SmithGGX(float NdotV, float NdotL, float roughness)
+    {
+        float _340 = roughness * roughness;
+        float _344 = _340 * _340;
+        float _351 = 1.0 - _344;
+        return 0.5 / max((NdotL * sqrt(((NdotV * NdotV) * _351) + _344)) + (NdotV * sqrt(((NdotL * NdotL) * _351) + _344)), 9.9999997473787516355514526367188e-05);
+    }
+
+    float SchlickFresnel(float u)
+    {
+        float _298 = clamp(1.0 - u, 0.0, 1.0);
+        float _302 = _298 * _298;
+        return (_302 * _302) * _298;
+    }
+
+    vec3 F_Schlick(float VdotH, vec3 F0)
+    {
+        float param = VdotH;
+        return F0 + ((vec3(1.0) - F0) * SchlickFresnel(param));
+    }
+
+    float Fd_DisneyDiffuse(float NdotV, float NdotL, float LdotH, float roughness)
+    {
+        float _422 = (mix(0.0, 0.5, roughness) + (((2.0 * LdotH) * LdotH) * roughness)) - 1.0;
+        float param = NdotV;
+        float param_1 = NdotL;
+        return ((1.0 + (_422 * SchlickFresnel(param))) * (1.0 + (_422 * SchlickFresnel(param_1)))) * mix(1.0, 0.662251651287078857421875, roughness);
+    }
+
+    vec3 directLight(vec3 N, vec3 V, vec3 L, vec3 F0, vec3 diffuseColor, float metallic, float roughness, float NdotV)
+    {
+        vec3 _447 = normalize(V + L);
+        float _452 = max(dot(N, L), 9.9999997473787516355514526367188e-05);
+        float param = max(dot(N, _447), 0.0);
+        float param_1 = roughness;
+        float param_2 = NdotV;
+        float param_3 = _452;
+        float param_4 = roughness;
+        float param_5 = max(dot(V, _447), 0.0);
+        vec3 param_6 = F0;
+        vec3 _487 = F_Schlick(param_5, param_6);
+        float param_7 = NdotV;
+        float param_8 = _452;
+        float param_9 = max(dot(L, _447), 0.0);
+        float param_10 = roughness;
+        return ((((vec3(1.0) - _487) * (1.0 - metallic)) * (diffuseColor * Fd_DisneyDiffuse(param_7, param_8, param_9, param_10))) + (_487 * (D_GGX(param, param_1) * G_SmithGGX(param_2, param_3, param_4)))) * _452;
+    }
+
+    uvec2 clusterLightRange(vec4 clip)
+    {
+        ivec3 _133 = clamp(ivec3(vec3((((clip.xy / vec2(clip.w)) * 0.5) + vec2(0.5)) * light_params[0].xy, (log(max(clip.w, 9.9999999747524270787835121154785e-07)) * light_params[1].x) + light_params[1].y)), ivec3(0), ivec3(light_params[0].xyz) - ivec3(1));
+        int _152 = (((_133.z * int(light_params[0].y)) + _133.y) * int(light_params[0].x)) + _133.x;
+        return uvec2(_160.clusters[_152].offset, _160.clusters[_152].count);
+    }
+
+    float punctualAttenuation(punctual_light light, vec3 world_pos, inout vec3 L)
+    {
+        vec3 _182 = light.position_range.xyz - world_pos;
+        float _188 = max(dot(_182, _182), 9.9999999392252902907785028219223e-09);
+        L = _182 * inversesqrt(_188);
+        float _200 = _188 / (light.position_range.w * light.position_range.w);
+        float _208 = clamp(1.0 - (_200 * _200), 0.0, 1.0);
+        float _223 = clamp((dot(light.direction_spot_offset.xyz, -L) * light.color_spot_scale.w) + light.direction_spot_offset.w, 0.0, 1.0);
+        return (((_208 * _208) * _223) * _223) / _188;
+    }
+
+    vec3 F_SchlickRoughness(float NdotV, vec3 F0, float roughness)
+    {
+        float param = NdotV;
+        return F0 + ((max(vec3(1.0 - roughness), F0) - F0) * SchlickFresnel(param));
+    }
+
+    vec3 ACESFilm(vec3 x)
+    {
+        return clamp((x * ((x * 2.5099999904632568359375) + vec3(0.02999999932944774627685546875))) / ((x * ((x * 2.4300000667572021484375) + vec3(0.589999973773956298828125))) + vec3(0.14000000059604644775390625)), vec3(0.0), vec3(1.0));
+    }
+
+    vec3 linearToSRGB(vec3 c)
+    {
+        return mix(c * 12.9200000762939453125, (pow(max(c, vec3(0.0)), vec3(0.4166666567325592041015625)) * 1.05499994754791259765625) - vec3(0.054999999701976776123046875), step(vec3(0.003130800090730190277099609375), c));
+    }
+
+    void main()
+    {
+        vec4 _544 = texture(base_color_tex_base_color_smp, v_uv) * fs_params[0];
+        vec4 _552 = texture(metallic_roughness_tex_metallic_roughness_smp, v_uv);
+        float _559 = _552.z * fs_params[1].x;
+        float _567 = clamp(_552.y * fs_params[1].y, 0.039999999105930328369140625, 1.0);
+        vec3 _635 = normalize(mat3(v_tangent, v_bitangent, v_normal) * ((texture(normal_tex_normal_smp, v_uv).xyz * 2.0) - vec3(1.0)));
+        vec3 _643 = normalize(fs_params[3].xyz - v_world_pos);
+        float _653 = max(dot(_635, _643), 9.9999997473787516355514526367188e-05);
+        vec3 _657 = _544.xyz;
+        vec3 _660 = mix(vec3(0.039999999105930328369140625), _657, vec3(_559));
+        float _665 = 1.0 - _559;
+        vec3 _666 = _657 * _665;
+        vec3 param = _635;
+        vec3 param_1 = _643;
+        vec3 param_2 = vec3(0.57735025882720947265625);
+        vec3 param_3 = _660;
+        vec3 param_4 = _666;
+        float param_5 = _559;
+        float param_6 = _567;
+        float param_7 = _653;
+        vec3 Lo = directLight(param, param_1, param_2, param_3, param_4, param_5, param_6, param_7);
+        vec4 param_8 = v_clip;
+        uvec2 _698 = clusterLightRange(param_8);
+        vec3 param_11;
+        for (uint i = 0u; i < _698.y; i++)
+        {
+            uint _724 = _698.x + i;
+            punctual_light param_9 = punctual_light(_715.lights[_720.light_indices[_724].light].position_range, _715.lights[_720.light_indices[_724].light].color_spot_scale, _715.lights[_720.light_indices[_724].light].direction_spot_offset);
+            vec3 param_10 = v_world_pos;
+            float _744 = punctualAttenuation(param_9, param_10, param_11);
+            if (_744 > 0.0)
+            {
+                vec3 param_12 = _635;
+                vec3 param_13 = _643;
+                vec3 param_14 = param_11;
+                vec3 param_15 = _660;
+                vec3 param_16 = _666;
+                float param_17 = _559;
+                float param_18 = _567;
+                float param_19 = _653;
+                Lo += ((directLight(param_12, param_13, param_14, param_15, param_16, param_17, param_18, param_19) * _715.lights[_720.light_indices[_724].light].color_spot_scale.xyz) * _744);
+            }
+        }
+        float param_20 = _653;
+        vec3 param_21 = _660;
+        float param_22 = _567;
+        vec3 _784 = F_SchlickRoughness(param_20, param_21, param_22);
+        vec4 _831 = texture(brdf_lut_brdf_lut_smp, vec2(_653, _567));
+        vec3 param_23 = ((((((vec3(1.0) - _784) * _665) * ((texture(irradiance_map_irradiance_smp, _635).xyz * _666) * 0.300000011920928955078125)) + ((textureLod(prefilter_map_prefilter_smp, reflect(-_643, _635), _567 * 4.0).xyz * ((_784 * _831.x) + vec3(_831.y))) * 0.5)) * (texture(occlusion_tex_occlusion_smp, v_uv).x * v_occlusion)) + Lo) + (texture(emissive_tex_emissive_smp, v_uv).xyz * fs_params[2].xyz);
+        vec3 param_24 = ACESFilm(param_23);
+        frag_color = vec4(linearToSRGB(param_24), _544.w);
+    }
+
+*/
+static const uint8_t pbr_fs_clustered_source_glsl430[8017] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x70,0x75,0x6e,0x63,0x74,0x75,0x61,0x6c,0x5f,0x6c,0x69,
+    0x67,0x68,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x72,0x61,0x6e,0x67,0x65,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x70,
+    0x6f,0x74,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x5f,0x73,0x70,0x6f,
+    0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x63,0x6c,0x75,0x73,0x74,
+    0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x63,
+    0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x69,0x6e,0x64,0x65,0x78,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x6c,0x69,0x67,0x68,0x74,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x6c,0x69,0x67,0x68,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,
+    0x3d,0x20,0x31,0x30,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x72,0x65,
+    0x61,0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x6c,0x69,
+    0x67,0x68,0x74,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x73,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,
+    0x20,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,
+    0x31,0x36,0x30,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,
+    0x3d,0x20,0x39,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x72,0x65,0x61,
+    0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x70,0x75,0x6e,
+    0x63,0x74,0x75,0x61,0x6c,0x5f,0x6c,0x69,0x67,0x68,0x74,0x73,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x70,0x75,0x6e,0x63,0x74,0x75,0x61,0x6c,0x5f,0x6c,0x69,0x67,0x68,
+    0x74,0x20,0x6c,0x69,0x67,0x68,0x74,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x37,
+    0x31,0x35,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,
+    0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x31,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,
+    0x29,0x20,0x72,0x65,0x61,0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,
+    0x72,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6c,0x69,
+    0x73,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x69,
+    0x6e,0x64,0x65,0x78,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x69,0x6e,0x64,0x69,0x63,
+    0x65,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x37,0x32,0x30,0x3b,0x0a,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x32,0x44,0x20,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,
+    0x74,0x65,0x78,0x5f,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,
+    0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,
+    0x6e,0x67,0x20,0x3d,0x20,0x31,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,
+    0x69,0x63,0x5f,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x74,0x65,0x78,
+    0x5f,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x72,0x6f,0x75,0x67,0x68,0x6e,
+    0x65,0x73,0x73,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x32,0x29,0x20,0x75,0x6e,0x69,
+    0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x6f,
+    0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x74,0x65,0x78,0x5f,0x6f,0x63,0x63,
+    0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x33,0x29,0x20,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,
+    0x44,0x20,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x74,0x65,0x78,0x5f,0x65,
+    0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x34,0x29,
+    0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x32,0x44,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x74,0x65,0x78,0x5f,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x35,0x29,0x20,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x43,0x75,0x62,
+    0x65,0x20,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5f,0x6d,0x61,0x70,
+    0x5f,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5f,0x73,0x6d,0x70,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,
+    0x3d,0x20,0x36,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x43,0x75,0x62,0x65,0x20,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,
+    0x65,0x72,0x5f,0x6d,0x61,0x70,0x5f,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,
+    0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,
+    0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x37,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,
+    0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x62,0x72,0x64,0x66,
+    0x5f,0x6c,0x75,0x74,0x5f,0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,0x5f,0x73,0x6d,
+    0x70,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x34,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x35,0x29,0x20,0x69,0x6e,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,
+    0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x69,
+    0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,
+    0x6e,0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,
+    0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,
+    0x70,0x6f,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x36,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x76,0x5f,0x63,0x6c,0x69,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,
+    0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3b,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x44,0x5f,0x47,0x47,0x58,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x48,0x2c,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x31,0x33,0x20,
+    0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x20,0x2a,0x20,0x72,0x6f,
+    0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x33,0x31,0x37,0x20,0x3d,0x20,0x5f,0x33,0x31,0x33,0x20,0x2a,
+    0x20,0x5f,0x33,0x31,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x5f,0x33,0x32,0x37,0x20,0x3d,0x20,0x28,0x28,0x4e,0x64,0x6f,0x74,0x48,0x20,
+    0x2a,0x20,0x4e,0x64,0x6f,0x74,0x48,0x29,0x20,0x2a,0x20,0x28,0x5f,0x33,0x31,0x37,
+    0x20,0x2d,0x20,0x31,0x2e,0x30,0x29,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x33,0x31,0x37,0x20,
+    0x2f,0x20,0x28,0x28,0x33,0x2e,0x31,0x34,0x31,0x35,0x39,0x32,0x37,0x34,0x31,0x30,
+    0x31,0x32,0x35,0x37,0x33,0x32,0x34,0x32,0x31,0x38,0x37,0x35,0x20,0x2a,0x20,0x5f,
+    0x33,0x32,0x37,0x29,0x20,0x2a,0x20,0x5f,0x33,0x32,0x37,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x47,0x5f,0x53,0x6d,0x69,0x74,0x68,0x47,0x47,
+    0x58,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x56,0x2c,0x20,0x66,
     0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x2c,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x20,0x4c,0x64,0x6f,0x74,0x48,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,
-    0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x34,0x30,0x20,0x3d,0x20,0x28,0x6d,0x69,
-    0x78,0x28,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x35,0x2c,0x20,0x72,0x6f,0x75,0x67,
-    0x68,0x6e,0x65,0x73,0x73,0x29,0x20,0x2b,0x20,0x28,0x28,0x28,0x32,0x2e,0x30,0x20,
-    0x2a,0x20,0x4c,0x64,0x6f,0x74,0x48,0x29,0x20,0x2a,0x20,0x4c,0x64,0x6f,0x74,0x48,
-    0x29,0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x29,0x20,
-    0x2d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x31,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,
-    0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,0x5f,
-    0x32,0x34,0x30,0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,
-    0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x29,0x20,0x2a,0x20,
-    0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,0x5f,0x32,0x34,0x30,0x20,0x2a,0x20,0x53,
-    0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x31,0x29,0x29,0x29,0x29,0x20,0x2a,0x20,0x6d,0x69,0x78,0x28,
-    0x31,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x36,0x36,0x32,0x32,0x35,0x31,0x36,0x35,0x31,
-    0x32,0x38,0x37,0x30,0x37,0x38,0x38,0x35,0x37,0x34,0x32,0x31,0x38,0x37,0x35,0x2c,
-    0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x34,0x30,0x20,0x3d,0x20,
+    0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,
+    0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x5f,0x33,0x34,0x34,0x20,0x3d,0x20,0x5f,0x33,0x34,0x30,0x20,0x2a,0x20,0x5f,
+    0x33,0x34,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x33,0x35,0x31,0x20,0x3d,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x5f,0x33,0x34,0x34,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x2e,0x35,
+    0x20,0x2f,0x20,0x6d,0x61,0x78,0x28,0x28,0x4e,0x64,0x6f,0x74,0x4c,0x20,0x2a,0x20,
+    0x73,0x71,0x72,0x74,0x28,0x28,0x28,0x4e,0x64,0x6f,0x74,0x56,0x20,0x2a,0x20,0x4e,
+    0x64,0x6f,0x74,0x56,0x29,0x20,0x2a,0x20,0x5f,0x33,0x35,0x31,0x29,0x20,0x2b,0x20,
+    0x5f,0x33,0x34,0x34,0x29,0x29,0x20,0x2b,0x20,0x28,0x4e,0x64,0x6f,0x74,0x56,0x20,
+    0x2a,0x20,0x73,0x71,0x72,0x74,0x28,0x28,0x28,0x4e,0x64,0x6f,0x74,0x4c,0x20,0x2a,
+    0x20,0x4e,0x64,0x6f,0x74,0x4c,0x29,0x20,0x2a,0x20,0x5f,0x33,0x35,0x31,0x29,0x20,
+    0x2b,0x20,0x5f,0x33,0x34,0x34,0x29,0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,
+    0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,0x35,0x35,
+    0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,0x35,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x53,0x63,0x68,0x6c,0x69,
+    0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x75,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x32,0x39,0x38,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x31,0x2e,0x30,0x20,
+    0x2d,0x20,0x75,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x30,0x32,0x20,0x3d,
+    0x20,0x5f,0x32,0x39,0x38,0x20,0x2a,0x20,0x5f,0x32,0x39,0x38,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x5f,0x33,0x30,0x32,0x20,0x2a,
+    0x20,0x5f,0x33,0x30,0x32,0x29,0x20,0x2a,0x20,0x5f,0x32,0x39,0x38,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x56,0x64,0x6f,0x74,0x48,0x2c,0x20,0x76,0x65,
+    0x63,0x33,0x20,0x46,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x56,0x64,0x6f,0x74,0x48,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x46,0x30,0x20,
+    0x2b,0x20,0x28,0x28,0x76,0x65,0x63,0x33,0x28,0x31,0x2e,0x30,0x29,0x20,0x2d,0x20,
+    0x46,0x30,0x29,0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,
+    0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x46,0x64,0x5f,0x44,0x69,0x73,0x6e,0x65,0x79,
+    0x44,0x69,0x66,0x66,0x75,0x73,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,
+    0x6f,0x74,0x56,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x4c,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4c,0x64,0x6f,0x74,0x48,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x32,0x32,
+    0x20,0x3d,0x20,0x28,0x6d,0x69,0x78,0x28,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x35,
+    0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x20,0x2b,0x20,0x28,
+    0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x4c,0x64,0x6f,0x74,0x48,0x29,0x20,0x2a,
+    0x20,0x4c,0x64,0x6f,0x74,0x48,0x29,0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,
+    0x65,0x73,0x73,0x29,0x29,0x20,0x2d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x4e,
+    0x64,0x6f,0x74,0x56,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x28,0x31,0x2e,
+    0x30,0x20,0x2b,0x20,0x28,0x5f,0x34,0x32,0x32,0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,
+    0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x29,0x29,0x29,0x20,0x2a,0x20,0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,0x5f,0x34,
+    0x32,0x32,0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,
+    0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x29,0x29,0x29,0x20,
+    0x2a,0x20,0x6d,0x69,0x78,0x28,0x31,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x36,0x36,0x32,
+    0x32,0x35,0x31,0x36,0x35,0x31,0x32,0x38,0x37,0x30,0x37,0x38,0x38,0x35,0x37,0x34,
+    0x32,0x31,0x38,0x37,0x35,0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x64,0x69,0x72,0x65,0x63,
+    0x74,0x4c,0x69,0x67,0x68,0x74,0x28,0x76,0x65,0x63,0x33,0x20,0x4e,0x2c,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x56,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x4c,0x2c,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x46,0x30,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x64,0x69,0x66,
+    0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x4e,0x64,0x6f,0x74,0x56,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x5f,0x34,0x34,0x37,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x69,0x7a,0x65,0x28,0x56,0x20,0x2b,0x20,0x4c,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x35,0x32,0x20,0x3d,0x20,0x6d,0x61,
+    0x78,0x28,0x64,0x6f,0x74,0x28,0x4e,0x2c,0x20,0x4c,0x29,0x2c,0x20,0x39,0x2e,0x39,
+    0x39,0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,
+    0x35,0x35,0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,
+    0x30,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x4e,
+    0x2c,0x20,0x5f,0x34,0x34,0x37,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,
+    0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x5f,0x34,0x35,
+    0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x35,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x56,0x2c,
+    0x20,0x5f,0x34,0x34,0x37,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,
+    0x20,0x46,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x34,
+    0x38,0x37,0x20,0x3d,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x28,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x37,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x20,0x3d,
+    0x20,0x5f,0x34,0x35,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,
+    0x6f,0x74,0x28,0x4c,0x2c,0x20,0x5f,0x34,0x34,0x37,0x29,0x2c,0x20,0x30,0x2e,0x30,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x30,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,
+    0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x28,
+    0x28,0x28,0x76,0x65,0x63,0x33,0x28,0x31,0x2e,0x30,0x29,0x20,0x2d,0x20,0x5f,0x34,
+    0x38,0x37,0x29,0x20,0x2a,0x20,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x6d,0x65,0x74,
+    0x61,0x6c,0x6c,0x69,0x63,0x29,0x29,0x20,0x2a,0x20,0x28,0x64,0x69,0x66,0x66,0x75,
+    0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x46,0x64,0x5f,0x44,0x69,0x73,
+    0x6e,0x65,0x79,0x44,0x69,0x66,0x66,0x75,0x73,0x65,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x37,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x2c,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x39,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x29,0x29,
+    0x29,0x20,0x2b,0x20,0x28,0x5f,0x34,0x38,0x37,0x20,0x2a,0x20,0x28,0x44,0x5f,0x47,
+    0x47,0x58,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x29,0x20,0x2a,0x20,0x47,0x5f,0x53,0x6d,0x69,0x74,0x68,0x47,0x47,0x58,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x29,0x29,0x29,0x29,0x20,0x2a,0x20,
+    0x5f,0x34,0x35,0x32,0x3b,0x0a,0x7d,0x0a,0x0a,0x75,0x76,0x65,0x63,0x32,0x20,0x63,
+    0x6c,0x75,0x73,0x74,0x65,0x72,0x4c,0x69,0x67,0x68,0x74,0x52,0x61,0x6e,0x67,0x65,
+    0x28,0x76,0x65,0x63,0x34,0x20,0x63,0x6c,0x69,0x70,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x76,0x65,0x63,0x33,0x20,0x5f,0x31,0x33,0x33,0x20,0x3d,0x20,0x63,
+    0x6c,0x61,0x6d,0x70,0x28,0x69,0x76,0x65,0x63,0x33,0x28,0x76,0x65,0x63,0x33,0x28,
+    0x28,0x28,0x28,0x63,0x6c,0x69,0x70,0x2e,0x78,0x79,0x20,0x2f,0x20,0x76,0x65,0x63,
+    0x32,0x28,0x63,0x6c,0x69,0x70,0x2e,0x77,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,
+    0x29,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x20,0x2a,
+    0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,
+    0x2e,0x78,0x79,0x2c,0x20,0x28,0x6c,0x6f,0x67,0x28,0x6d,0x61,0x78,0x28,0x63,0x6c,
+    0x69,0x70,0x2e,0x77,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x37,
+    0x34,0x37,0x35,0x32,0x34,0x32,0x37,0x30,0x37,0x38,0x37,0x38,0x33,0x35,0x31,0x32,
+    0x31,0x31,0x35,0x34,0x37,0x38,0x35,0x65,0x2d,0x30,0x37,0x29,0x29,0x20,0x2a,0x20,
+    0x6c,0x69,0x67,0x68,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,
+    0x78,0x29,0x20,0x2b,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x31,0x5d,0x2e,0x79,0x29,0x29,0x2c,0x20,0x69,0x76,0x65,0x63,0x33,0x28,
+    0x30,0x29,0x2c,0x20,0x69,0x76,0x65,0x63,0x33,0x28,0x6c,0x69,0x67,0x68,0x74,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2d,
+    0x20,0x69,0x76,0x65,0x63,0x33,0x28,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x20,0x5f,0x31,0x35,0x32,0x20,0x3d,0x20,0x28,0x28,0x28,0x5f,0x31,
+    0x33,0x33,0x2e,0x7a,0x20,0x2a,0x20,0x69,0x6e,0x74,0x28,0x6c,0x69,0x67,0x68,0x74,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x79,0x29,0x29,0x20,0x2b,
+    0x20,0x5f,0x31,0x33,0x33,0x2e,0x79,0x29,0x20,0x2a,0x20,0x69,0x6e,0x74,0x28,0x6c,
+    0x69,0x67,0x68,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,
+    0x29,0x29,0x20,0x2b,0x20,0x5f,0x31,0x33,0x33,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x75,0x76,0x65,0x63,0x32,0x28,0x5f,0x31,
+    0x36,0x30,0x2e,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x73,0x5b,0x5f,0x31,0x35,0x32,
+    0x5d,0x2e,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x5f,0x31,0x36,0x30,0x2e,0x63,
+    0x6c,0x75,0x73,0x74,0x65,0x72,0x73,0x5b,0x5f,0x31,0x35,0x32,0x5d,0x2e,0x63,0x6f,
+    0x75,0x6e,0x74,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
+    0x75,0x6e,0x63,0x74,0x75,0x61,0x6c,0x41,0x74,0x74,0x65,0x6e,0x75,0x61,0x74,0x69,
+    0x6f,0x6e,0x28,0x70,0x75,0x6e,0x63,0x74,0x75,0x61,0x6c,0x5f,0x6c,0x69,0x67,0x68,
+    0x74,0x20,0x6c,0x69,0x67,0x68,0x74,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x77,0x6f,
+    0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x6f,0x75,0x74,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x4c,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x5f,0x31,0x38,0x32,0x20,0x3d,0x20,0x6c,0x69,0x67,0x68,0x74,0x2e,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x72,0x61,0x6e,0x67,0x65,0x2e,0x78,0x79,
+    0x7a,0x20,0x2d,0x20,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x38,0x38,0x20,0x3d,0x20,
+    0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x5f,0x31,0x38,0x32,0x2c,0x20,0x5f,0x31,
+    0x38,0x32,0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x33,0x39,
+    0x32,0x32,0x35,0x32,0x39,0x30,0x32,0x39,0x30,0x37,0x37,0x38,0x35,0x30,0x32,0x38,
+    0x32,0x31,0x39,0x32,0x32,0x33,0x65,0x2d,0x30,0x39,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x4c,0x20,0x3d,0x20,0x5f,0x31,0x38,0x32,0x20,0x2a,0x20,0x69,0x6e,0x76,0x65,
+    0x72,0x73,0x65,0x73,0x71,0x72,0x74,0x28,0x5f,0x31,0x38,0x38,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x30,0x30,0x20,0x3d,0x20,
+    0x5f,0x31,0x38,0x38,0x20,0x2f,0x20,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x72,0x61,0x6e,0x67,0x65,0x2e,0x77,0x20,0x2a,
+    0x20,0x6c,0x69,0x67,0x68,0x74,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,
+    0x72,0x61,0x6e,0x67,0x65,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x32,0x30,0x38,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,
+    0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x28,0x5f,0x32,0x30,0x30,0x20,0x2a,0x20,0x5f,
+    0x32,0x30,0x30,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x32,0x33,0x20,
+    0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x64,0x6f,0x74,0x28,0x6c,0x69,0x67,
+    0x68,0x74,0x2e,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x5f,0x73,0x70,0x6f,
+    0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x2d,0x4c,
+    0x29,0x20,0x2a,0x20,0x6c,0x69,0x67,0x68,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x5f,
+    0x73,0x70,0x6f,0x74,0x5f,0x73,0x63,0x61,0x6c,0x65,0x2e,0x77,0x29,0x20,0x2b,0x20,
+    0x6c,0x69,0x67,0x68,0x74,0x2e,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x5f,
+    0x73,0x70,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x2e,0x77,0x2c,0x20,0x30,
+    0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x28,0x28,0x28,0x5f,0x32,0x30,0x38,0x20,0x2a,0x20,0x5f,
+    0x32,0x30,0x38,0x29,0x20,0x2a,0x20,0x5f,0x32,0x32,0x33,0x29,0x20,0x2a,0x20,0x5f,
+    0x32,0x32,0x33,0x29,0x20,0x2f,0x20,0x5f,0x31,0x38,0x38,0x3b,0x0a,0x7d,0x0a,0x0a,
     0x76,0x65,0x63,0x33,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x52,0x6f,
     0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,
     0x6f,0x74,0x56,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x46,0x30,0x2c,0x20,0x66,0x6c,
@@ -511,25 +1390,25 @@ static const uint8_t pbr_fs_source_glsl430[4917] = {
     0x39,0x30,0x37,0x33,0x30,0x31,0x39,0x30,0x32,0x37,0x37,0x30,0x39,0x39,0x36,0x30,
     0x39,0x33,0x37,0x35,0x29,0x2c,0x20,0x63,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,
     0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
-    0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x32,0x38,0x37,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x35,0x34,0x34,0x20,0x3d,0x20,0x74,0x65,0x78,
     0x74,0x75,0x72,0x65,0x28,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,
     0x74,0x65,0x78,0x5f,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,
     0x6d,0x70,0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,0x20,0x2a,0x20,0x66,0x73,0x5f,0x70,
     0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
-    0x63,0x34,0x20,0x5f,0x32,0x39,0x35,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x63,0x34,0x20,0x5f,0x35,0x35,0x32,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
     0x65,0x28,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x72,0x6f,0x75,0x67,0x68,
     0x6e,0x65,0x73,0x73,0x5f,0x74,0x65,0x78,0x5f,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,
     0x63,0x5f,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x73,0x6d,0x70,0x2c,
     0x20,0x76,0x5f,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x20,0x5f,0x33,0x30,0x36,0x20,0x3d,0x20,0x5f,0x32,0x39,0x35,0x2e,0x7a,0x20,
+    0x74,0x20,0x5f,0x35,0x35,0x39,0x20,0x3d,0x20,0x5f,0x35,0x35,0x32,0x2e,0x7a,0x20,
     0x2a,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x31,0x36,
-    0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x5f,0x32,0x39,0x35,0x2e,0x79,0x20,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x35,0x36,0x37,
+    0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x5f,0x35,0x35,0x32,0x2e,0x79,0x20,
     0x2a,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x79,
     0x2c,0x20,0x30,0x2e,0x30,0x33,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x31,0x30,0x35,
     0x39,0x33,0x30,0x33,0x32,0x38,0x33,0x36,0x39,0x31,0x34,0x30,0x36,0x32,0x35,0x2c,
     0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
-    0x5f,0x33,0x38,0x31,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,
+    0x5f,0x36,0x33,0x35,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,
     0x28,0x6d,0x61,0x74,0x33,0x28,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2c,
     0x20,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2c,0x20,0x76,0x5f,
     0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x20,0x2a,0x20,0x28,0x28,0x74,0x65,0x78,0x74,
@@ -537,117 +1416,155 @@ static const uint8_t pbr_fs_source_glsl430[4917] = {
     0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,
     0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,0x20,0x2d,0x20,0x76,0x65,
     0x63,0x33,0x28,0x31,0x2e,0x30,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
-    0x65,0x63,0x33,0x20,0x5f,0x33,0x38,0x39,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+    0x65,0x63,0x33,0x20,0x5f,0x36,0x34,0x33,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,
     0x6c,0x69,0x7a,0x65,0x28,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,
     0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,
     0x70,0x6f,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
-    0x5f,0x33,0x39,0x39,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x5f,
-    0x33,0x38,0x31,0x2c,0x20,0x5f,0x33,0x38,0x39,0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,
+    0x5f,0x36,0x35,0x33,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x5f,
+    0x36,0x33,0x35,0x2c,0x20,0x5f,0x36,0x34,0x33,0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,
     0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,
     0x35,0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,
-    0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x34,0x30,
-    0x33,0x20,0x3d,0x20,0x5f,0x32,0x38,0x37,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x34,0x30,0x36,0x20,0x3d,0x20,0x6d,0x69,
+    0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x36,0x35,
+    0x37,0x20,0x3d,0x20,0x5f,0x35,0x34,0x34,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x36,0x36,0x30,0x20,0x3d,0x20,0x6d,0x69,
     0x78,0x28,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x33,0x39,0x39,0x39,0x39,0x39,
     0x39,0x39,0x31,0x30,0x35,0x39,0x33,0x30,0x33,0x32,0x38,0x33,0x36,0x39,0x31,0x34,
-    0x30,0x36,0x32,0x35,0x29,0x2c,0x20,0x5f,0x34,0x30,0x33,0x2c,0x20,0x76,0x65,0x63,
-    0x33,0x28,0x5f,0x33,0x30,0x36,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x20,0x5f,0x34,0x31,0x31,0x20,0x3d,0x20,0x31,0x2e,0x30,0x20,0x2d,
-    0x20,0x5f,0x33,0x30,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
-    0x5f,0x34,0x31,0x32,0x20,0x3d,0x20,0x5f,0x34,0x30,0x33,0x20,0x2a,0x20,0x5f,0x34,
-    0x31,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x34,0x32,
-    0x30,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x5f,0x33,
-    0x38,0x39,0x20,0x2b,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x35,0x37,0x37,0x33,
-    0x35,0x30,0x32,0x35,0x38,0x38,0x32,0x37,0x32,0x30,0x39,0x34,0x37,0x32,0x36,0x35,
-    0x36,0x32,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x5f,0x34,0x32,0x35,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,
-    0x5f,0x33,0x38,0x31,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x35,0x37,0x37,
-    0x33,0x35,0x30,0x32,0x35,0x38,0x38,0x32,0x37,0x32,0x30,0x39,0x34,0x37,0x32,0x36,
-    0x35,0x36,0x32,0x35,0x29,0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,
-    0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,0x35,0x35,0x31,0x34,
-    0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,0x35,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,
-    0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x5f,0x33,0x38,0x31,0x2c,0x20,
-    0x5f,0x34,0x32,0x30,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,
-    0x20,0x5f,0x33,0x31,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x5f,0x33,0x39,0x39,0x3b,
+    0x30,0x36,0x32,0x35,0x29,0x2c,0x20,0x5f,0x36,0x35,0x37,0x2c,0x20,0x76,0x65,0x63,
+    0x33,0x28,0x5f,0x35,0x35,0x39,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x36,0x36,0x35,0x20,0x3d,0x20,0x31,0x2e,0x30,0x20,0x2d,
+    0x20,0x5f,0x35,0x35,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x5f,0x36,0x36,0x36,0x20,0x3d,0x20,0x5f,0x36,0x35,0x37,0x20,0x2a,0x20,0x5f,0x36,
+    0x36,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3d,0x20,0x5f,0x36,0x33,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x5f,0x36,
+    0x34,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x35,0x37,
+    0x37,0x33,0x35,0x30,0x32,0x35,0x38,0x38,0x32,0x37,0x32,0x30,0x39,0x34,0x37,0x32,
+    0x36,0x35,0x36,0x32,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x5f,0x36,0x36,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x34,0x20,0x3d,0x20,0x5f,0x36,0x36,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x5f,0x35,
+    0x35,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x5f,0x35,0x36,0x37,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,
+    0x3d,0x20,0x5f,0x36,0x35,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x4c,0x6f,0x20,0x3d,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x4c,0x69,0x67,0x68,
+    0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x2c,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6c,
+    0x69,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x65,0x63,0x32,0x20,0x5f,0x36,
+    0x39,0x38,0x20,0x3d,0x20,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x4c,0x69,0x67,0x68,
+    0x74,0x52,0x61,0x6e,0x67,0x65,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x75,0x69,0x6e,
+    0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x75,0x3b,0x20,0x69,0x20,0x3c,0x20,0x5f,0x36,
+    0x39,0x38,0x2e,0x79,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x37,
+    0x32,0x34,0x20,0x3d,0x20,0x5f,0x36,0x39,0x38,0x2e,0x78,0x20,0x2b,0x20,0x69,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x75,0x6e,0x63,0x74,0x75,0x61,
+    0x6c,0x5f,0x6c,0x69,0x67,0x68,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,
+    0x3d,0x20,0x70,0x75,0x6e,0x63,0x74,0x75,0x61,0x6c,0x5f,0x6c,0x69,0x67,0x68,0x74,
+    0x28,0x5f,0x37,0x31,0x35,0x2e,0x6c,0x69,0x67,0x68,0x74,0x73,0x5b,0x5f,0x37,0x32,
+    0x30,0x2e,0x6c,0x69,0x67,0x68,0x74,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,
+    0x5f,0x37,0x32,0x34,0x5d,0x2e,0x6c,0x69,0x67,0x68,0x74,0x5d,0x2e,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x5f,0x72,0x61,0x6e,0x67,0x65,0x2c,0x20,0x5f,0x37,0x31,
+    0x35,0x2e,0x6c,0x69,0x67,0x68,0x74,0x73,0x5b,0x5f,0x37,0x32,0x30,0x2e,0x6c,0x69,
+    0x67,0x68,0x74,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x5f,0x37,0x32,0x34,
+    0x5d,0x2e,0x6c,0x69,0x67,0x68,0x74,0x5d,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,
+    0x70,0x6f,0x74,0x5f,0x73,0x63,0x61,0x6c,0x65,0x2c,0x20,0x5f,0x37,0x31,0x35,0x2e,
+    0x6c,0x69,0x67,0x68,0x74,0x73,0x5b,0x5f,0x37,0x32,0x30,0x2e,0x6c,0x69,0x67,0x68,
+    0x74,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x5f,0x37,0x32,0x34,0x5d,0x2e,
+    0x6c,0x69,0x67,0x68,0x74,0x5d,0x2e,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,
+    0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x30,0x20,0x3d,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,
+    0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x37,0x34,0x34,0x20,0x3d,0x20,0x70,0x75,0x6e,0x63,0x74,0x75,0x61,
+    0x6c,0x41,0x74,0x74,0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x39,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x2c,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x37,0x34,0x34,0x20,0x3e,0x20,0x30,0x2e,
+    0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x32,0x20,0x3d,0x20,0x5f,0x36,0x33,0x35,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x20,0x3d,0x20,0x5f,0x36,0x34,0x33,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x34,0x20,0x3d,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x35,
+    0x20,0x3d,0x20,0x5f,0x36,0x36,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x36,0x20,0x3d,0x20,0x5f,0x36,0x36,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x37,0x20,0x3d,0x20,0x5f,0x35,0x35,0x39,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x38,0x20,0x3d,0x20,0x5f,0x35,0x36,0x37,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x39,0x20,0x3d,0x20,0x5f,0x36,
+    0x35,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x4c,0x6f,0x20,0x2b,0x3d,0x20,0x28,0x28,0x64,0x69,0x72,0x65,0x63,0x74,0x4c,0x69,
+    0x67,0x68,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x34,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x37,0x2c,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x39,0x29,0x20,0x2a,0x20,0x5f,0x37,0x31,0x35,0x2e,0x6c,0x69,0x67,0x68,0x74,
+    0x73,0x5b,0x5f,0x37,0x32,0x30,0x2e,0x6c,0x69,0x67,0x68,0x74,0x5f,0x69,0x6e,0x64,
+    0x69,0x63,0x65,0x73,0x5b,0x5f,0x37,0x32,0x34,0x5d,0x2e,0x6c,0x69,0x67,0x68,0x74,
+    0x5d,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x73,0x63,0x61,
+    0x6c,0x65,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2a,0x20,0x5f,0x37,0x34,0x34,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,
     0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x33,0x20,0x3d,0x20,0x5f,0x34,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x5f,
-    0x33,0x31,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,
-    0x28,0x5f,0x33,0x38,0x39,0x2c,0x20,0x5f,0x34,0x32,0x30,0x29,0x2c,0x20,0x30,0x2e,
-    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x5f,0x34,0x30,0x36,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x34,0x36,0x30,0x20,0x3d,0x20,0x46,0x5f,0x53,
-    0x63,0x68,0x6c,0x69,0x63,0x6b,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x2c,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x5f,0x33,
-    0x39,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x38,0x20,0x3d,0x20,0x5f,0x34,0x32,0x35,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,
-    0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x76,0x65,0x63,0x33,0x28,0x30,
-    0x2e,0x35,0x37,0x37,0x33,0x35,0x30,0x32,0x35,0x38,0x38,0x32,0x37,0x32,0x30,0x39,
-    0x34,0x37,0x32,0x36,0x35,0x36,0x32,0x35,0x29,0x2c,0x20,0x5f,0x34,0x32,0x30,0x29,
-    0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x20,0x3d,0x20,0x5f,0x33,0x31,
-    0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x31,0x31,0x20,0x3d,0x20,0x5f,0x33,0x39,0x39,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x20,
-    0x3d,0x20,0x5f,0x34,0x30,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x20,0x3d,0x20,0x5f,0x33,0x31,
-    0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x35,0x30,0x37,
-    0x20,0x3d,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x52,0x6f,0x75,0x67,
-    0x68,0x6e,0x65,0x73,0x73,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x2c,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x31,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x35,
-    0x35,0x35,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x62,0x72,0x64,
-    0x66,0x5f,0x6c,0x75,0x74,0x5f,0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,0x5f,0x73,
-    0x6d,0x70,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x5f,0x33,0x39,0x39,0x2c,0x20,0x5f,
-    0x33,0x31,0x36,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x34,0x20,0x3d,0x20,0x28,0x28,0x28,0x28,0x28,
-    0x28,0x76,0x65,0x63,0x33,0x28,0x31,0x2e,0x30,0x29,0x20,0x2d,0x20,0x5f,0x35,0x30,
-    0x37,0x29,0x20,0x2a,0x20,0x5f,0x34,0x31,0x31,0x29,0x20,0x2a,0x20,0x28,0x28,0x74,
-    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,
-    0x65,0x5f,0x6d,0x61,0x70,0x5f,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,
-    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x5f,0x33,0x38,0x31,0x29,0x2e,0x78,0x79,0x7a,0x20,
-    0x2a,0x20,0x5f,0x34,0x31,0x32,0x29,0x20,0x2a,0x20,0x30,0x2e,0x33,0x30,0x30,0x30,
-    0x30,0x30,0x30,0x31,0x31,0x39,0x32,0x30,0x39,0x32,0x38,0x39,0x35,0x35,0x30,0x37,
-    0x38,0x31,0x32,0x35,0x29,0x29,0x20,0x2b,0x20,0x28,0x28,0x74,0x65,0x78,0x74,0x75,
-    0x72,0x65,0x4c,0x6f,0x64,0x28,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,
-    0x6d,0x61,0x70,0x5f,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,0x73,0x6d,
-    0x70,0x2c,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x5f,0x33,0x38,0x39,
-    0x2c,0x20,0x5f,0x33,0x38,0x31,0x29,0x2c,0x20,0x5f,0x33,0x31,0x36,0x20,0x2a,0x20,
-    0x34,0x2e,0x30,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x28,0x28,0x5f,0x35,0x30,
-    0x37,0x20,0x2a,0x20,0x5f,0x35,0x35,0x35,0x2e,0x78,0x29,0x20,0x2b,0x20,0x76,0x65,
-    0x63,0x33,0x28,0x5f,0x35,0x35,0x35,0x2e,0x79,0x29,0x29,0x29,0x20,0x2a,0x20,0x30,
-    0x2e,0x35,0x29,0x29,0x20,0x2a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x6f,
-    0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x74,0x65,0x78,0x5f,0x6f,0x63,0x63,
-    0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x76,0x5f,0x75,0x76,
-    0x29,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x28,0x28,0x28,0x28,0x76,0x65,0x63,0x33,
-    0x28,0x31,0x2e,0x30,0x29,0x20,0x2d,0x20,0x5f,0x34,0x36,0x30,0x29,0x20,0x2a,0x20,
-    0x5f,0x34,0x31,0x31,0x29,0x20,0x2a,0x20,0x28,0x5f,0x34,0x31,0x32,0x20,0x2a,0x20,
-    0x46,0x64,0x5f,0x44,0x69,0x73,0x6e,0x65,0x79,0x44,0x69,0x66,0x66,0x75,0x73,0x65,
-    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x2c,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x31,0x30,0x29,0x29,0x29,0x20,0x2b,0x20,0x28,0x5f,0x34,0x36,0x30,0x20,
-    0x2a,0x20,0x28,0x44,0x5f,0x47,0x47,0x58,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x20,0x2a,0x20,0x47,0x5f,0x53,0x6d,0x69,
-    0x74,0x68,0x47,0x47,0x58,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x29,
-    0x29,0x29,0x29,0x20,0x2a,0x20,0x5f,0x34,0x32,0x35,0x29,0x29,0x20,0x2b,0x20,0x28,
-    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,
-    0x5f,0x74,0x65,0x78,0x5f,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x73,0x6d,
-    0x70,0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x66,
-    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2e,0x78,0x79,0x7a,0x29,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x31,0x35,0x20,0x3d,0x20,0x41,0x43,0x45,0x53,0x46,0x69,0x6c,0x6d,0x28,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x31,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,
-    0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,
-    0x6c,0x69,0x6e,0x65,0x61,0x72,0x54,0x6f,0x53,0x52,0x47,0x42,0x28,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x31,0x35,0x29,0x2c,0x20,0x5f,0x32,0x38,0x37,0x2e,0x77,0x29,0x3b,
-    0x0a,0x7d,0x0a,0x0a,0x00,
+    0x5f,0x32,0x30,0x20,0x3d,0x20,0x5f,0x36,0x35,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x31,0x20,0x3d,0x20,
+    0x5f,0x36,0x36,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x32,0x20,0x3d,0x20,0x5f,0x35,0x36,0x37,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x37,0x38,0x34,0x20,0x3d,
+    0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x52,0x6f,0x75,0x67,0x68,0x6e,
+    0x65,0x73,0x73,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x30,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x32,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x32,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x38,0x33,0x31,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x62,0x72,0x64,0x66,0x5f,
+    0x6c,0x75,0x74,0x5f,0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x5f,0x36,0x35,0x33,0x2c,0x20,0x5f,0x35,0x36,
+    0x37,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x32,0x33,0x20,0x3d,0x20,0x28,0x28,0x28,0x28,0x28,0x28,0x76,
+    0x65,0x63,0x33,0x28,0x31,0x2e,0x30,0x29,0x20,0x2d,0x20,0x5f,0x37,0x38,0x34,0x29,
+    0x20,0x2a,0x20,0x5f,0x36,0x36,0x35,0x29,0x20,0x2a,0x20,0x28,0x28,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x28,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5f,
+    0x6d,0x61,0x70,0x5f,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5f,0x73,
+    0x6d,0x70,0x2c,0x20,0x5f,0x36,0x33,0x35,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,
+    0x5f,0x36,0x36,0x36,0x29,0x20,0x2a,0x20,0x30,0x2e,0x33,0x30,0x30,0x30,0x30,0x30,
+    0x30,0x31,0x31,0x39,0x32,0x30,0x39,0x32,0x38,0x39,0x35,0x35,0x30,0x37,0x38,0x31,
+    0x32,0x35,0x29,0x29,0x20,0x2b,0x20,0x28,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x4c,0x6f,0x64,0x28,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,0x6d,0x61,
+    0x70,0x5f,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,
+    0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x5f,0x36,0x34,0x33,0x2c,0x20,
+    0x5f,0x36,0x33,0x35,0x29,0x2c,0x20,0x5f,0x35,0x36,0x37,0x20,0x2a,0x20,0x34,0x2e,
+    0x30,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x28,0x28,0x5f,0x37,0x38,0x34,0x20,
+    0x2a,0x20,0x5f,0x38,0x33,0x31,0x2e,0x78,0x29,0x20,0x2b,0x20,0x76,0x65,0x63,0x33,
+    0x28,0x5f,0x38,0x33,0x31,0x2e,0x79,0x29,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,
+    0x29,0x29,0x20,0x2a,0x20,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x6f,0x63,
+    0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x74,0x65,0x78,0x5f,0x6f,0x63,0x63,0x6c,
+    0x75,0x73,0x69,0x6f,0x6e,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,
+    0x2e,0x78,0x20,0x2a,0x20,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,
+    0x29,0x29,0x20,0x2b,0x20,0x4c,0x6f,0x29,0x20,0x2b,0x20,0x28,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x28,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x74,0x65,0x78,
+    0x5f,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x76,
+    0x5f,0x75,0x76,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x66,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x34,0x20,
+    0x3d,0x20,0x41,0x43,0x45,0x53,0x46,0x69,0x6c,0x6d,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x32,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x6c,0x69,0x6e,0x65,
+    0x61,0x72,0x54,0x6f,0x53,0x52,0x47,0x42,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,
+    0x34,0x29,0x2c,0x20,0x5f,0x35,0x34,0x34,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x00,
 };
 /*
     cbuffer vs_params : register(b0)
@@ -670,6 +1587,8 @@ static const uint8_t pbr_fs_source_glsl430[4917] = {
     static float3 v_bitangent;
     static float2 v_uv;
     static float2 uv;
+    static float v_occlusion;
+    static float occlusion;
 
     struct SPIRV_Cross_Input
     {
@@ -677,6 +1596,7 @@ static const uint8_t pbr_fs_source_glsl430[4917] = {
         float3 normal : TEXCOORD1;
         float2 uv : TEXCOORD2;
         float4 tangent : TEXCOORD3;
+        float occlusion : TEXCOORD4;
     };
 
     struct SPIRV_Cross_Output
@@ -686,6 +1606,7 @@ static const uint8_t pbr_fs_source_glsl430[4917] = {
         float3 v_tangent : TEXCOORD2;
         float3 v_bitangent : TEXCOORD3;
         float2 v_uv : TEXCOORD4;
+        float v_occlusion : TEXCOORD5;
         float4 gl_Position : SV_Position;
     };
 
@@ -697,6 +1618,7 @@ static const uint8_t pbr_fs_source_glsl430[4917] = {
         v_tangent = normalize(mul(float4(tangent.xyz, 0.0f), _14_normal_matrix).xyz);
         v_bitangent = cross(v_normal, v_tangent) * tangent.w;
         v_uv = uv;
+        v_occlusion = occlusion;
         gl_Position = mul(_27, _14_mvp);
     }
 
@@ -706,6 +1628,7 @@ static const uint8_t pbr_fs_source_glsl430[4917] = {
         normal = stage_input.normal;
         tangent = stage_input.tangent;
         uv = stage_input.uv;
+        occlusion = stage_input.occlusion;
         vert_main();
         SPIRV_Cross_Output stage_output;
         stage_output.gl_Position = gl_Position;
@@ -714,10 +1637,11 @@ static const uint8_t pbr_fs_source_glsl430[4917] = {
         stage_output.v_tangent = v_tangent;
         stage_output.v_bitangent = v_bitangent;
         stage_output.v_uv = v_uv;
+        stage_output.v_occlusion = v_occlusion;
         return stage_output;
     }
 */
-static const uint8_t pbr_vs_source_hlsl5[1769] = {
+static const uint8_t pbr_vs_source_hlsl5[1999] = {
     0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
     0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,
     0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,0x6f,0x72,
@@ -750,96 +1674,110 @@ static const uint8_t pbr_vs_source_hlsl5[1769] = {
     0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
     0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x73,
     0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x3b,
-    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,
-    0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x20,0x3a,0x20,0x54,0x45,
-    0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,
-    0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x32,0x20,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
-    0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x61,
-    0x6e,0x67,0x65,0x6e,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
-    0x33,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,
-    0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,
-    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,
-    0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
-    0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,
-    0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3a,0x20,0x54,
-    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,
-    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,
-    0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x20,0x3a,0x20,0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,
-    0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,
-    0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x34,0x20,0x5f,0x32,0x37,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,
-    0x70,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x6d,0x75,
-    0x6c,0x28,0x5f,0x32,0x37,0x2c,0x20,0x5f,0x31,0x34,0x5f,0x6d,0x6f,0x64,0x65,0x6c,
-    0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,
-    0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,
-    0x6d,0x75,0x6c,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x6e,0x6f,0x72,0x6d,0x61,
-    0x6c,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x2c,0x20,0x5f,0x31,0x34,0x5f,0x6e,0x6f,
-    0x72,0x6d,0x61,0x6c,0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,0x29,0x2e,0x78,0x79,0x7a,
-    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,
-    0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6d,0x75,0x6c,
-    0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,
-    0x78,0x79,0x7a,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x2c,0x20,0x5f,0x31,0x34,0x5f,
-    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,0x29,0x2e,0x78,
-    0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,
-    0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,0x63,0x72,0x6f,0x73,0x73,0x28,0x76,0x5f,0x6e,
-    0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,
-    0x29,0x20,0x2a,0x20,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x77,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
-    0x6d,0x75,0x6c,0x28,0x5f,0x32,0x37,0x2c,0x20,0x5f,0x31,0x34,0x5f,0x6d,0x76,0x70,
-    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,
-    0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,
-    0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,
-    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
-    0x6e,0x70,0x75,0x74,0x2e,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6e,0x6f,
-    0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
-    0x75,0x74,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,
-    0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
-    0x6e,0x70,0x75,0x74,0x2e,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
-    0x75,0x74,0x2e,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,0x5f,
-    0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,
-    0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,
-    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,0x6c,
-    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,
-    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,
-    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x77,0x6f,0x72,0x6c,
-    0x64,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,
-    0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
-    0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,
-    0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,
-    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x74,0x61,
-    0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,
-    0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
-    0x70,0x75,0x74,0x2e,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,
-    0x3d,0x20,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x20,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,
+    0x6e,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,
+    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x20,0x3a,0x20,
+    0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x54,
+    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6f,
+    0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
+    0x4f,0x52,0x44,0x34,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,
+    0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x54,
+    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,
+    0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,
+    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,
+    0x65,0x6e,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,
+    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,
+    0x69,0x6f,0x6e,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x35,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x53,0x56,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,
+    0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,0x37,0x20,0x3d,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,
+    0x73,0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,0x5f,0x32,0x37,0x2c,0x20,0x5f,0x31,0x34,
+    0x5f,0x6d,0x6f,0x64,0x65,0x6c,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x69,0x7a,0x65,0x28,0x6d,0x75,0x6c,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x2c,0x20,
+    0x5f,0x31,0x34,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x6d,0x61,0x74,0x72,0x69,
+    0x78,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x74,
+    0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,
+    0x7a,0x65,0x28,0x6d,0x75,0x6c,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x74,0x61,
+    0x6e,0x67,0x65,0x6e,0x74,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,
+    0x2c,0x20,0x5f,0x31,0x34,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x6d,0x61,0x74,
+    0x72,0x69,0x78,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,0x63,0x72,0x6f,
+    0x73,0x73,0x28,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,0x5f,0x74,
+    0x61,0x6e,0x67,0x65,0x6e,0x74,0x29,0x20,0x2a,0x20,0x74,0x61,0x6e,0x67,0x65,0x6e,
+    0x74,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,
+    0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,0x5f,0x32,0x37,0x2c,0x20,0x5f,0x31,0x34,0x5f,
+    0x6d,0x76,0x70,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,
+    0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,
+    0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,
+    0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x2e,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x63,
+    0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x2e,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,
+    0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
+    0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x2e,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x20,
+    0x3d,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,
     0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,
-    0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,
-    0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+    0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x76,0x5f,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
+    0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,
+    0x3d,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,
+    0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,0x76,0x5f,0x62,0x69,
+    0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,0x20,0x3d,
+    0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,
+    0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
 };
 /*
     cbuffer fs_params : register(b1)
     {
-        float4 _281_base_color_factor : packoffset(c0);
-        float _281_metallic_factor : packoffset(c1);
-        float _281_roughness_factor : packoffset(c1.y);
-        float3 _281_emissive_factor : packoffset(c2);
-        float _281_pad0 : packoffset(c2.w);
-        float3 _281_cam_pos : packoffset(c3);
-        float _281_pad1 : packoffset(c3.w);
+        float4 _373_base_color_factor : packoffset(c0);
+        float _373_metallic_factor : packoffset(c1);
+        float _373_roughness_factor : packoffset(c1.y);
+        float3 _373_emissive_factor : packoffset(c2);
+        float _373_pad0 : packoffset(c2.w);
+        float3 _373_cam_pos : packoffset(c3);
+        float _373_pad1 : packoffset(c3.w);
     };
 
     Texture2D<float4> base_color_tex : register(t0);
@@ -860,6 +1798,7 @@ static const uint8_t pbr_vs_source_hlsl5[1769] = {
     SamplerState brdf_lut_smp : register(s7);
 
     static float2 v_uv;
+    static float v_occlusion;
     static float3 v_tangent;
     static float3 v_bitangent;
     static float3 v_normal;
@@ -873,6 +1812,7 @@ static const uint8_t pbr_vs_source_hlsl5[1769] = {
         float3 v_tangent : TEXCOORD2;
         float3 v_bitangent : TEXCOORD3;
         float2 v_uv : TEXCOORD4;
+        float v_occlusion : TEXCOORD5;
     };
 
     struct SPIRV_Cross_Output
@@ -882,25 +1822,25 @@ static const uint8_t pbr_vs_source_hlsl5[1769] = {
 
     float D_GGX(float NdotH, float roughness)
     {
-        float _130 = roughness * roughness;
-        float _134 = _130 * _130;
-        float _144 = ((NdotH * NdotH) * (_134 - 1.0f)) + 1.0f;
-        return _134 / ((3.1415927410125732421875f * _144) * _144);
+        float _141 = roughness * roughness;
+        float _145 = _141 * _141;
+        float _155 = ((NdotH * NdotH) * (_145 - 1.0f)) + 1.0f;
+        return _145 / ((3.1415927410125732421875f * _155) * _155);
     }
 
     float G_SmithGGX(float NdotV, float NdotL, float roughness)
     {
-        float _157 = roughness * roughness;
-        float _161 = _157 * _157;
-        float _168 = 1.0f - _161;
-        return 0.5f / max((NdotL * sqrt(((NdotV * NdotV) * _168) + _161)) + (NdotV * sqrt(((NdotL * NdotL) * _168) + _161)), 9.9999997473787516355514526367188e-05f);
+        float _168 = roughness * roughness;
+        float _172 = _168 * _168;
+        float _179 = 1.0f - _172;
+        return 0.5f / max((NdotL * sqrt(((NdotV * NdotV) * _179) + _172)) + (NdotV * sqrt(((NdotL * NdotL) * _179) + _172)), 9.9999997473787516355514526367188e-05f);
     }
 
     float SchlickFresnel(float u)
     {
-        float _115 = clamp(1.0f - u, 0.0f, 1.0f);
-        float _119 = _115 * _115;
-        return (_119 * _119) * _115;
+        float _126 = clamp(1.0f - u, 0.0f, 1.0f);
+        float _130 = _126 * _126;
+        return (_130 * _130) * _126;
     }
 
     float3 F_Schlick(float VdotH, float3 F0)
@@ -911,10 +1851,29 @@ static const uint8_t pbr_vs_source_hlsl5[1769] = {
 
     float Fd_DisneyDiffuse(float NdotV, float NdotL, float LdotH, float roughness)
     {
-        float _240 = (lerp(0.0f, 0.5f, roughness) + (((2.0f * LdotH) * LdotH) * roughness)) - 1.0f;
+        float _251 = (lerp(0.0f, 0.5f, roughness) + (((2.0f * LdotH) * LdotH) * roughness)) - 1.0f;
         float param = NdotV;
         float param_1 = NdotL;
-        return ((1.0f + (_240 * SchlickFresnel(param))) * (1.0f + (_240 * SchlickFresnel(param_1)))) * lerp(1.0f, 0.662251651287078857421875f, roughness);
+        return ((1.0f + (_251 * SchlickFresnel(param))) * (1.0f + (_251 * SchlickFresnel(param_1)))) * lerp(1.0f, 0.662251651287078857421875f, roughness);
+    }
+
+    float3 directLight(float3 N, float3 V, float3 L, float3 F0, float3 diffuseColor, float metallic, float roughness, float NdotV)
+    {
+        float3 _276 = normalize(V + L);
+        float _281 = max(dot(N, L), 9.9999997473787516355514526367188e-05f);
+        float param = max(dot(N, _276), 0.0f);
+        float param_1 = roughness;
+        float param_2 = NdotV;
+        float param_3 = _281;
+        float param_4 = roughness;
+        float param_5 = max(dot(V, _276), 0.0f);
+        float3 param_6 = F0;
+        float3 _316 = F_Schlick(param_5, param_6);
+        float param_7 = NdotV;
+        float param_8 = _281;
+        float param_9 = max(dot(L, _276), 0.0f);
+        float param_10 = roughness;
+        return ((((1.0f.xxx - _316) * (1.0f - metallic)) * (diffuseColor * Fd_DisneyDiffuse(param_7, param_8, param_9, param_10))) + (_316 * (D_GGX(param, param_1) * G_SmithGGX(param_2, param_3, param_4)))) * _281;
     }
 
     float3 F_SchlickRoughness(float NdotV, float3 F0, float roughness)
@@ -935,44 +1894,39 @@ static const uint8_t pbr_vs_source_hlsl5[1769] = {
 
     void frag_main()
     {
-        float4 _287 = base_color_tex.Sample(base_color_smp, v_uv) * _281_base_color_factor;
-        float4 _295 = metallic_roughness_tex.Sample(metallic_roughness_smp, v_uv);
-        float _306 = _295.z * _281_metallic_factor;
-        float _316 = clamp(_295.y * _281_roughness_factor, 0.039999999105930328369140625f, 1.0f);
-        float3 _381 = normalize(mul((normal_tex.Sample(normal_smp, v_uv).xyz * 2.0f) - 1.0f.xxx, float3x3(v_tangent, v_bitangent, v_normal)));
-        float3 _389 = normalize(_281_cam_pos - v_world_pos);
-        float _399 = max(dot(_381, _389), 9.9999997473787516355514526367188e-05f);
-        float3 _403 = _287.xyz;
-        float3 _406 = lerp(0.039999999105930328369140625f.xxx, _403, _306.xxx);
-        float _411 = 1.0f - _306;
-        float3 _412 = _403 * _411;
-        float3 _420 = normalize(_389 + 0.57735025882720947265625f.xxx);
-        float _425 = max(dot(_381, 0.57735025882720947265625f.xxx), 9.9999997473787516355514526367188e-05f);
-        float param = max(dot(_381, _420), 0.0f);
-        float param_1 = _316;
-        float param_2 = _399;
-        float param_3 = _425;
-        float param_4 = _316;
-        float param_5 = max(dot(_389, _420), 0.0f);
-        float3 param_6 = _406;
-        float3 _460 = F_Schlick(param_5, param_6);
-        float param_7 = _399;
-        float param_8 = _425;
-        float param_9 = max(dot(0.57735025882720947265625f.xxx, _420), 0.0f);
-        float param_10 = _316;
-        float param_11 = _399;
-        float3 param_12 = _406;
-        float param_13 = _316;
-        float3 _507 = F_SchlickRoughness(param_11, param_12, param_13);
-        float4 _555 = brdf_lut.Sample(brdf_lut_smp, float2(_399, _316));
-        float3 param_14 = ((((((1.0f.xxx - _507) * _411) * ((irradiance_map.Sample(irradiance_smp, _381).xyz * _412) * 0.300000011920928955078125f)) + ((prefilter_map.SampleLevel(prefilter_smp, reflect(-_389, _381), _316 * 4.0f).xyz * ((_507 * _555.x) + _555.y.xxx)) * 0.5f)) * occlusion_tex.Sample(occlusion_smp, v_uv).x) + (((((1.0f.xxx - _460) * _411) * (_412 * Fd_DisneyDiffuse(param_7, param_8, param_9, param_10))) + (_460 * (D_GGX(param, param_1) * G_SmithGGX(param_2, param_3, param_4)))) * _425)) + (emissive_tex.Sample(emissive_smp, v_uv).xyz * _281_emissive_factor);
-        float3 param_15 = ACESFilm(param_14);
-        frag_color = float4(linearToSRGB(param_15), _287.w);
+        float4 _379 = base_color_tex.Sample(base_color_smp, v_uv) * _373_base_color_factor;
+        float4 _387 = metallic_roughness_tex.Sample(metallic_roughness_smp, v_uv);
+        float _398 = _387.z * _373_metallic_factor;
+        float _408 = clamp(_387.y * _373_roughness_factor, 0.039999999105930328369140625f, 1.0f);
+        float3 _477 = normalize(mul((normal_tex.Sample(normal_smp, v_uv).xyz * 2.0f) - 1.0f.xxx, float3x3(v_tangent, v_bitangent, v_normal)));
+        float3 _485 = normalize(_373_cam_pos - v_world_pos);
+        float _495 = max(dot(_477, _485), 9.9999997473787516355514526367188e-05f);
+        float3 _499 = _379.xyz;
+        float3 _502 = lerp(0.039999999105930328369140625f.xxx, _499, _398.xxx);
+        float _507 = 1.0f - _398;
+        float3 _508 = _499 * _507;
+        float3 param = _477;
+        float3 param_1 = _485;
+        float3 param_2 = 0.57735025882720947265625f.xxx;
+        float3 param_3 = _502;
+        float3 param_4 = _508;
+        float param_5 = _398;
+        float param_6 = _408;
+        float param_7 = _495;
+        float param_8 = _495;
+        float3 param_9 = _502;
+        float param_10 = _408;
+        float3 _541 = F_SchlickRoughness(param_8, param_9, param_10);
+        float4 _589 = brdf_lut.Sample(brdf_lut_smp, float2(_495, _408));
+        float3 param_11 = ((((((1.0f.xxx - _541) * _507) * ((irradiance_map.Sample(irradiance_smp, _477).xyz * _508) * 0.300000011920928955078125f)) + ((prefilter_map.SampleLevel(prefilter_smp, reflect(-_485, _477), _408 * 4.0f).xyz * ((_541 * _589.x) + _589.y.xxx)) * 0.5f)) * (occlusion_tex.Sample(occlusion_smp, v_uv).x * v_occlusion)) + directLight(param, param_1, param_2, param_3, param_4, param_5, param_6, param_7)) + (emissive_tex.Sample(emissive_smp, v_uv).xyz * _373_emissive_factor);
+        float3 param_12 = ACESFilm(param_11);
+        frag_color = float4(linearToSRGB(param_12), _379.w);
     }
 
     SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
     {
         v_uv = stage_input.v_uv;
+        v_occlusion = stage_input.v_occlusion;
         v_tangent = stage_input.v_tangent;
         v_bitangent = stage_input.v_bitangent;
         v_normal = stage_input.v_normal;
@@ -983,28 +1937,28 @@ static const uint8_t pbr_vs_source_hlsl5[1769] = {
         return stage_output;
     }
 */
-static const uint8_t pbr_fs_source_hlsl5[6074] = {
+static const uint8_t pbr_fs_source_hlsl5[6588] = {
     0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
     0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x31,0x29,
-    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,
-    0x38,0x31,0x5f,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x66,0x61,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x33,
+    0x37,0x33,0x5f,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x66,0x61,
     0x63,0x74,0x6f,0x72,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
     0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x5f,0x32,0x38,0x31,0x5f,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x66,
+    0x20,0x5f,0x33,0x37,0x33,0x5f,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x66,
     0x61,0x63,0x74,0x6f,0x72,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,
     0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x20,0x5f,0x32,0x38,0x31,0x5f,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
+    0x74,0x20,0x5f,0x33,0x37,0x33,0x5f,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
     0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,
     0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x38,0x31,0x5f,0x65,0x6d,0x69,0x73,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x33,0x37,0x33,0x5f,0x65,0x6d,0x69,0x73,
     0x73,0x69,0x76,0x65,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x20,0x3a,0x20,0x70,0x61,
     0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x32,0x29,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x38,0x31,0x5f,0x70,0x61,0x64,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x37,0x33,0x5f,0x70,0x61,0x64,
     0x30,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
     0x32,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
-    0x20,0x5f,0x32,0x38,0x31,0x5f,0x63,0x61,0x6d,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,
+    0x20,0x5f,0x33,0x37,0x33,0x5f,0x63,0x61,0x6d,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,
     0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x33,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x38,0x31,0x5f,0x70,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x37,0x33,0x5f,0x70,
     0x61,0x64,0x31,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,
     0x28,0x63,0x33,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x54,0x65,0x78,0x74,
     0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x62,0x61,
@@ -1055,2183 +2009,6813 @@ static const uint8_t pbr_fs_source_hlsl5[6074] = {
     0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x37,0x29,0x3b,0x0a,
     0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,
     0x5f,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x73,0x74,
-    0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x62,0x69,
-    0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,
-    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,
-    0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,
-    0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,
-    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,
-    0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x77,
-    0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
-    0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
-    0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
-    0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x33,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3a,0x20,0x54,0x45,
-    0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x33,0x20,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,
-    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,0x54,
-    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
-    0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
-    0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,
-    0x3a,0x20,0x53,0x56,0x5f,0x54,0x61,0x72,0x67,0x65,0x74,0x30,0x3b,0x0a,0x7d,0x3b,
-    0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x44,0x5f,0x47,0x47,0x58,0x28,0x66,0x6c,
-    0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x48,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x33,0x30,0x20,0x3d,0x20,0x72,
-    0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,0x68,
-    0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
-    0x5f,0x31,0x33,0x34,0x20,0x3d,0x20,0x5f,0x31,0x33,0x30,0x20,0x2a,0x20,0x5f,0x31,
-    0x33,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,
-    0x34,0x34,0x20,0x3d,0x20,0x28,0x28,0x4e,0x64,0x6f,0x74,0x48,0x20,0x2a,0x20,0x4e,
-    0x64,0x6f,0x74,0x48,0x29,0x20,0x2a,0x20,0x28,0x5f,0x31,0x33,0x34,0x20,0x2d,0x20,
-    0x31,0x2e,0x30,0x66,0x29,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x66,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x33,0x34,0x20,0x2f,
-    0x20,0x28,0x28,0x33,0x2e,0x31,0x34,0x31,0x35,0x39,0x32,0x37,0x34,0x31,0x30,0x31,
-    0x32,0x35,0x37,0x33,0x32,0x34,0x32,0x31,0x38,0x37,0x35,0x66,0x20,0x2a,0x20,0x5f,
-    0x31,0x34,0x34,0x29,0x20,0x2a,0x20,0x5f,0x31,0x34,0x34,0x29,0x3b,0x0a,0x7d,0x0a,
-    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x47,0x5f,0x53,0x6d,0x69,0x74,0x68,0x47,0x47,
-    0x58,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x56,0x2c,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x2c,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x35,0x37,0x20,0x3d,0x20,
-    0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,
-    0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x5f,0x31,0x36,0x31,0x20,0x3d,0x20,0x5f,0x31,0x35,0x37,0x20,0x2a,0x20,0x5f,
-    0x31,0x35,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
-    0x31,0x36,0x38,0x20,0x3d,0x20,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,0x5f,0x31,0x36,
-    0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x2e,
-    0x35,0x66,0x20,0x2f,0x20,0x6d,0x61,0x78,0x28,0x28,0x4e,0x64,0x6f,0x74,0x4c,0x20,
-    0x2a,0x20,0x73,0x71,0x72,0x74,0x28,0x28,0x28,0x4e,0x64,0x6f,0x74,0x56,0x20,0x2a,
-    0x20,0x4e,0x64,0x6f,0x74,0x56,0x29,0x20,0x2a,0x20,0x5f,0x31,0x36,0x38,0x29,0x20,
-    0x2b,0x20,0x5f,0x31,0x36,0x31,0x29,0x29,0x20,0x2b,0x20,0x28,0x4e,0x64,0x6f,0x74,
-    0x56,0x20,0x2a,0x20,0x73,0x71,0x72,0x74,0x28,0x28,0x28,0x4e,0x64,0x6f,0x74,0x4c,
-    0x20,0x2a,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x29,0x20,0x2a,0x20,0x5f,0x31,0x36,0x38,
-    0x29,0x20,0x2b,0x20,0x5f,0x31,0x36,0x31,0x29,0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,
-    0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,
-    0x35,0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,
-    0x35,0x66,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x53,0x63,
-    0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x66,0x6c,0x6f,
-    0x61,0x74,0x20,0x75,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x20,0x5f,0x31,0x31,0x35,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x31,
-    0x2e,0x30,0x66,0x20,0x2d,0x20,0x75,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,
-    0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
-    0x5f,0x31,0x31,0x39,0x20,0x3d,0x20,0x5f,0x31,0x31,0x35,0x20,0x2a,0x20,0x5f,0x31,
-    0x31,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,
-    0x5f,0x31,0x31,0x39,0x20,0x2a,0x20,0x5f,0x31,0x31,0x39,0x29,0x20,0x2a,0x20,0x5f,
-    0x31,0x31,0x35,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x46,
-    0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x56,
-    0x64,0x6f,0x74,0x48,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x46,0x30,0x29,
-    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x20,0x3d,0x20,0x56,0x64,0x6f,0x74,0x48,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x46,0x30,0x20,0x2b,0x20,0x28,0x28,0x31,0x2e,
-    0x30,0x66,0x2e,0x78,0x78,0x78,0x20,0x2d,0x20,0x46,0x30,0x29,0x20,0x2a,0x20,0x53,
-    0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,
-    0x72,0x61,0x6d,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,
-    0x46,0x64,0x5f,0x44,0x69,0x73,0x6e,0x65,0x79,0x44,0x69,0x66,0x66,0x75,0x73,0x65,
-    0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x56,0x2c,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x4c,0x64,0x6f,0x74,0x48,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,
+    0x74,0x20,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x74,
+    0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,
+    0x74,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,
+    0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,
+    0x6f,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x74,0x61,
+    0x6e,0x67,0x65,0x6e,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,
+    0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
+    0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
+    0x4f,0x4f,0x52,0x44,0x35,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,
+    0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x53,
+    0x56,0x5f,0x54,0x61,0x72,0x67,0x65,0x74,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x44,0x5f,0x47,0x47,0x58,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x4e,0x64,0x6f,0x74,0x48,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,
     0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x34,0x30,0x20,0x3d,0x20,0x28,0x6c,0x65,0x72,
-    0x70,0x28,0x30,0x2e,0x30,0x66,0x2c,0x20,0x30,0x2e,0x35,0x66,0x2c,0x20,0x72,0x6f,
-    0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x20,0x2b,0x20,0x28,0x28,0x28,0x32,0x2e,
-    0x30,0x66,0x20,0x2a,0x20,0x4c,0x64,0x6f,0x74,0x48,0x29,0x20,0x2a,0x20,0x4c,0x64,
-    0x6f,0x74,0x48,0x29,0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
-    0x29,0x29,0x20,0x2d,0x20,0x31,0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x4e,0x64,0x6f,
-    0x74,0x56,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x28,0x31,0x2e,0x30,0x66,
-    0x20,0x2b,0x20,0x28,0x5f,0x32,0x34,0x30,0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,0x69,
-    0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,
-    0x29,0x29,0x20,0x2a,0x20,0x28,0x31,0x2e,0x30,0x66,0x20,0x2b,0x20,0x28,0x5f,0x32,
-    0x34,0x30,0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,
-    0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x29,0x29,0x29,0x20,
-    0x2a,0x20,0x6c,0x65,0x72,0x70,0x28,0x31,0x2e,0x30,0x66,0x2c,0x20,0x30,0x2e,0x36,
-    0x36,0x32,0x32,0x35,0x31,0x36,0x35,0x31,0x32,0x38,0x37,0x30,0x37,0x38,0x38,0x35,
-    0x37,0x34,0x32,0x31,0x38,0x37,0x35,0x66,0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,
-    0x65,0x73,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
-    0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,
-    0x73,0x73,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x56,0x2c,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x46,0x30,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,
-    0x4e,0x64,0x6f,0x74,0x56,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
-    0x6e,0x20,0x46,0x30,0x20,0x2b,0x20,0x28,0x28,0x6d,0x61,0x78,0x28,0x28,0x31,0x2e,
-    0x30,0x66,0x20,0x2d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x2e,
-    0x78,0x78,0x78,0x2c,0x20,0x46,0x30,0x29,0x20,0x2d,0x20,0x46,0x30,0x29,0x20,0x2a,
-    0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,
-    0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x20,0x41,0x43,0x45,0x53,0x46,0x69,0x6c,0x6d,0x28,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x20,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
-    0x72,0x6e,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x78,0x20,0x2a,0x20,0x28,0x28,
-    0x78,0x20,0x2a,0x20,0x32,0x2e,0x35,0x30,0x39,0x39,0x39,0x39,0x39,0x39,0x30,0x34,
-    0x36,0x33,0x32,0x35,0x36,0x38,0x33,0x35,0x39,0x33,0x37,0x35,0x66,0x29,0x20,0x2b,
-    0x20,0x30,0x2e,0x30,0x32,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x33,0x32,0x39,0x34,
-    0x34,0x37,0x37,0x34,0x36,0x32,0x37,0x36,0x38,0x35,0x35,0x34,0x36,0x38,0x37,0x35,
-    0x66,0x2e,0x78,0x78,0x78,0x29,0x29,0x20,0x2f,0x20,0x28,0x28,0x78,0x20,0x2a,0x20,
-    0x28,0x28,0x78,0x20,0x2a,0x20,0x32,0x2e,0x34,0x33,0x30,0x30,0x30,0x30,0x30,0x36,
-    0x36,0x37,0x35,0x37,0x32,0x30,0x32,0x31,0x34,0x38,0x34,0x33,0x37,0x35,0x66,0x29,
-    0x20,0x2b,0x20,0x30,0x2e,0x35,0x38,0x39,0x39,0x39,0x39,0x39,0x37,0x33,0x37,0x37,
-    0x33,0x39,0x35,0x36,0x32,0x39,0x38,0x38,0x32,0x38,0x31,0x32,0x35,0x66,0x2e,0x78,
-    0x78,0x78,0x29,0x29,0x20,0x2b,0x20,0x30,0x2e,0x31,0x34,0x30,0x30,0x30,0x30,0x30,
-    0x30,0x30,0x35,0x39,0x36,0x30,0x34,0x36,0x34,0x34,0x37,0x37,0x35,0x33,0x39,0x30,
-    0x36,0x32,0x35,0x66,0x2e,0x78,0x78,0x78,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2e,
-    0x78,0x78,0x78,0x2c,0x20,0x31,0x2e,0x30,0x66,0x2e,0x78,0x78,0x78,0x29,0x3b,0x0a,
-    0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,
-    0x54,0x6f,0x53,0x52,0x47,0x42,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x29,
-    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6c,0x65,
-    0x72,0x70,0x28,0x63,0x20,0x2a,0x20,0x31,0x32,0x2e,0x39,0x32,0x30,0x30,0x30,0x30,
-    0x30,0x37,0x36,0x32,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x66,0x2c,0x20,
-    0x28,0x70,0x6f,0x77,0x28,0x6d,0x61,0x78,0x28,0x63,0x2c,0x20,0x30,0x2e,0x30,0x66,
-    0x2e,0x78,0x78,0x78,0x29,0x2c,0x20,0x30,0x2e,0x34,0x31,0x36,0x36,0x36,0x36,0x36,
-    0x35,0x36,0x37,0x33,0x32,0x35,0x35,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,
-    0x32,0x35,0x66,0x2e,0x78,0x78,0x78,0x29,0x20,0x2a,0x20,0x31,0x2e,0x30,0x35,0x34,
-    0x39,0x39,0x39,0x39,0x34,0x37,0x35,0x34,0x37,0x39,0x31,0x32,0x35,0x39,0x37,0x36,
-    0x35,0x36,0x32,0x35,0x66,0x29,0x20,0x2d,0x20,0x30,0x2e,0x30,0x35,0x34,0x39,0x39,
-    0x39,0x39,0x39,0x39,0x37,0x30,0x31,0x39,0x37,0x36,0x37,0x37,0x36,0x31,0x32,0x33,
-    0x30,0x34,0x36,0x38,0x37,0x35,0x66,0x2e,0x78,0x78,0x78,0x2c,0x20,0x73,0x74,0x65,
-    0x70,0x28,0x30,0x2e,0x30,0x30,0x33,0x31,0x33,0x30,0x38,0x30,0x30,0x30,0x39,0x30,
-    0x37,0x33,0x30,0x31,0x39,0x30,0x32,0x37,0x37,0x30,0x39,0x39,0x36,0x30,0x39,0x33,
-    0x37,0x35,0x66,0x2e,0x78,0x78,0x78,0x2c,0x20,0x63,0x29,0x29,0x3b,0x0a,0x7d,0x0a,
-    0x0a,0x76,0x6f,0x69,0x64,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,
-    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,
-    0x32,0x38,0x37,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
-    0x5f,0x74,0x65,0x78,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x62,0x61,0x73,0x65,
-    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x76,0x5f,0x75,0x76,
-    0x29,0x20,0x2a,0x20,0x5f,0x32,0x38,0x31,0x5f,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,
-    0x6c,0x6f,0x72,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,0x39,0x35,0x20,0x3d,0x20,0x6d,0x65,
-    0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
-    0x5f,0x74,0x65,0x78,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x6d,0x65,0x74,0x61,
-    0x6c,0x6c,0x69,0x63,0x5f,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x73,
-    0x6d,0x70,0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x30,0x36,0x20,0x3d,0x20,0x5f,0x32,0x39,0x35,
-    0x2e,0x7a,0x20,0x2a,0x20,0x5f,0x32,0x38,0x31,0x5f,0x6d,0x65,0x74,0x61,0x6c,0x6c,
-    0x69,0x63,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x31,0x36,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,
-    0x70,0x28,0x5f,0x32,0x39,0x35,0x2e,0x79,0x20,0x2a,0x20,0x5f,0x32,0x38,0x31,0x5f,
-    0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,
-    0x2c,0x20,0x30,0x2e,0x30,0x33,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x31,0x30,0x35,
-    0x39,0x33,0x30,0x33,0x32,0x38,0x33,0x36,0x39,0x31,0x34,0x30,0x36,0x32,0x35,0x66,
-    0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x33,0x20,0x5f,0x33,0x38,0x31,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,
-    0x6c,0x69,0x7a,0x65,0x28,0x6d,0x75,0x6c,0x28,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
-    0x5f,0x74,0x65,0x78,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x6e,0x6f,0x72,0x6d,
-    0x61,0x6c,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,0x2e,0x78,0x79,
-    0x7a,0x20,0x2a,0x20,0x32,0x2e,0x30,0x66,0x29,0x20,0x2d,0x20,0x31,0x2e,0x30,0x66,
-    0x2e,0x78,0x78,0x78,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x78,0x33,0x28,0x76,
-    0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2c,0x20,0x76,0x5f,0x62,0x69,0x74,0x61,
-    0x6e,0x67,0x65,0x6e,0x74,0x2c,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,
-    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,
-    0x33,0x38,0x39,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,
-    0x5f,0x32,0x38,0x31,0x5f,0x63,0x61,0x6d,0x5f,0x70,0x6f,0x73,0x20,0x2d,0x20,0x76,
-    0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x39,0x39,0x20,0x3d,0x20,0x6d,0x61,
-    0x78,0x28,0x64,0x6f,0x74,0x28,0x5f,0x33,0x38,0x31,0x2c,0x20,0x5f,0x33,0x38,0x39,
-    0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,
-    0x38,0x37,0x35,0x31,0x36,0x33,0x35,0x35,0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,
-    0x37,0x31,0x38,0x38,0x65,0x2d,0x30,0x35,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x30,0x33,0x20,0x3d,0x20,0x5f,0x32,
-    0x38,0x37,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x20,0x5f,0x34,0x30,0x36,0x20,0x3d,0x20,0x6c,0x65,0x72,0x70,0x28,0x30,
-    0x2e,0x30,0x33,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x31,0x30,0x35,0x39,0x33,0x30,
-    0x33,0x32,0x38,0x33,0x36,0x39,0x31,0x34,0x30,0x36,0x32,0x35,0x66,0x2e,0x78,0x78,
-    0x78,0x2c,0x20,0x5f,0x34,0x30,0x33,0x2c,0x20,0x5f,0x33,0x30,0x36,0x2e,0x78,0x78,
-    0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,
-    0x31,0x31,0x20,0x3d,0x20,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,0x5f,0x33,0x30,0x36,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x31,
-    0x32,0x20,0x3d,0x20,0x5f,0x34,0x30,0x33,0x20,0x2a,0x20,0x5f,0x34,0x31,0x31,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x32,0x30,
-    0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x5f,0x33,0x38,
-    0x39,0x20,0x2b,0x20,0x30,0x2e,0x35,0x37,0x37,0x33,0x35,0x30,0x32,0x35,0x38,0x38,
-    0x32,0x37,0x32,0x30,0x39,0x34,0x37,0x32,0x36,0x35,0x36,0x32,0x35,0x66,0x2e,0x78,
-    0x78,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
-    0x34,0x32,0x35,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x5f,0x33,
-    0x38,0x31,0x2c,0x20,0x30,0x2e,0x35,0x37,0x37,0x33,0x35,0x30,0x32,0x35,0x38,0x38,
-    0x32,0x37,0x32,0x30,0x39,0x34,0x37,0x32,0x36,0x35,0x36,0x32,0x35,0x66,0x2e,0x78,
-    0x78,0x78,0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x34,0x37,
-    0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,0x35,0x35,0x31,0x34,0x35,0x32,0x36,
-    0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,0x35,0x66,0x29,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,
-    0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x5f,0x33,0x38,0x31,0x2c,0x20,0x5f,0x34,
-    0x32,0x30,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,
-    0x5f,0x33,0x31,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x5f,0x33,0x39,0x39,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x33,0x20,0x3d,0x20,0x5f,0x34,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x5f,0x33,
-    0x31,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,
-    0x5f,0x33,0x38,0x39,0x2c,0x20,0x5f,0x34,0x32,0x30,0x29,0x2c,0x20,0x30,0x2e,0x30,
-    0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x5f,0x34,0x30,0x36,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x36,0x30,0x20,0x3d,
-    0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x28,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x29,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,
-    0x3d,0x20,0x5f,0x33,0x39,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x20,0x3d,0x20,0x5f,0x34,0x32,0x35,
+    0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x34,0x31,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,
+    0x68,0x6e,0x65,0x73,0x73,0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,
+    0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x34,
+    0x35,0x20,0x3d,0x20,0x5f,0x31,0x34,0x31,0x20,0x2a,0x20,0x5f,0x31,0x34,0x31,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x35,0x35,0x20,
+    0x3d,0x20,0x28,0x28,0x4e,0x64,0x6f,0x74,0x48,0x20,0x2a,0x20,0x4e,0x64,0x6f,0x74,
+    0x48,0x29,0x20,0x2a,0x20,0x28,0x5f,0x31,0x34,0x35,0x20,0x2d,0x20,0x31,0x2e,0x30,
+    0x66,0x29,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x34,0x35,0x20,0x2f,0x20,0x28,0x28,
+    0x33,0x2e,0x31,0x34,0x31,0x35,0x39,0x32,0x37,0x34,0x31,0x30,0x31,0x32,0x35,0x37,
+    0x33,0x32,0x34,0x32,0x31,0x38,0x37,0x35,0x66,0x20,0x2a,0x20,0x5f,0x31,0x35,0x35,
+    0x29,0x20,0x2a,0x20,0x5f,0x31,0x35,0x35,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x47,0x5f,0x53,0x6d,0x69,0x74,0x68,0x47,0x47,0x58,0x28,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x56,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,
+    0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x36,0x38,0x20,0x3d,0x20,0x72,0x6f,0x75,
+    0x67,0x68,0x6e,0x65,0x73,0x73,0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,
+    0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,
+    0x37,0x32,0x20,0x3d,0x20,0x5f,0x31,0x36,0x38,0x20,0x2a,0x20,0x5f,0x31,0x36,0x38,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x37,0x39,
+    0x20,0x3d,0x20,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,0x5f,0x31,0x37,0x32,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x2e,0x35,0x66,0x20,
+    0x2f,0x20,0x6d,0x61,0x78,0x28,0x28,0x4e,0x64,0x6f,0x74,0x4c,0x20,0x2a,0x20,0x73,
+    0x71,0x72,0x74,0x28,0x28,0x28,0x4e,0x64,0x6f,0x74,0x56,0x20,0x2a,0x20,0x4e,0x64,
+    0x6f,0x74,0x56,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x39,0x29,0x20,0x2b,0x20,0x5f,
+    0x31,0x37,0x32,0x29,0x29,0x20,0x2b,0x20,0x28,0x4e,0x64,0x6f,0x74,0x56,0x20,0x2a,
+    0x20,0x73,0x71,0x72,0x74,0x28,0x28,0x28,0x4e,0x64,0x6f,0x74,0x4c,0x20,0x2a,0x20,
+    0x4e,0x64,0x6f,0x74,0x4c,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x39,0x29,0x20,0x2b,
+    0x20,0x5f,0x31,0x37,0x32,0x29,0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,
+    0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,0x35,0x35,0x31,
+    0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,0x35,0x66,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x53,0x63,0x68,0x6c,0x69,
+    0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x75,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x31,0x32,0x36,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x31,0x2e,0x30,0x66,
+    0x20,0x2d,0x20,0x75,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x33,
+    0x30,0x20,0x3d,0x20,0x5f,0x31,0x32,0x36,0x20,0x2a,0x20,0x5f,0x31,0x32,0x36,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x5f,0x31,0x33,
+    0x30,0x20,0x2a,0x20,0x5f,0x31,0x33,0x30,0x29,0x20,0x2a,0x20,0x5f,0x31,0x32,0x36,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x46,0x5f,0x53,0x63,
+    0x68,0x6c,0x69,0x63,0x6b,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x56,0x64,0x6f,0x74,
+    0x48,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x46,0x30,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,
+    0x3d,0x20,0x56,0x64,0x6f,0x74,0x48,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x46,0x30,0x20,0x2b,0x20,0x28,0x28,0x31,0x2e,0x30,0x66,0x2e,
+    0x78,0x78,0x78,0x20,0x2d,0x20,0x46,0x30,0x29,0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,
+    0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x46,0x64,0x5f,
+    0x44,0x69,0x73,0x6e,0x65,0x79,0x44,0x69,0x66,0x66,0x75,0x73,0x65,0x28,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x56,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x4e,0x64,0x6f,0x74,0x4c,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4c,0x64,
+    0x6f,0x74,0x48,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,
+    0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x32,0x35,0x31,0x20,0x3d,0x20,0x28,0x6c,0x65,0x72,0x70,0x28,0x30,
+    0x2e,0x30,0x66,0x2c,0x20,0x30,0x2e,0x35,0x66,0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,
+    0x6e,0x65,0x73,0x73,0x29,0x20,0x2b,0x20,0x28,0x28,0x28,0x32,0x2e,0x30,0x66,0x20,
+    0x2a,0x20,0x4c,0x64,0x6f,0x74,0x48,0x29,0x20,0x2a,0x20,0x4c,0x64,0x6f,0x74,0x48,
+    0x29,0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x29,0x20,
+    0x2d,0x20,0x31,0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x28,0x31,0x2e,0x30,0x66,0x20,0x2b,0x20,
+    0x28,0x5f,0x32,0x35,0x31,0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,
+    0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x29,0x20,
+    0x2a,0x20,0x28,0x31,0x2e,0x30,0x66,0x20,0x2b,0x20,0x28,0x5f,0x32,0x35,0x31,0x20,
+    0x2a,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x29,0x29,0x29,0x20,0x2a,0x20,0x6c,
+    0x65,0x72,0x70,0x28,0x31,0x2e,0x30,0x66,0x2c,0x20,0x30,0x2e,0x36,0x36,0x32,0x32,
+    0x35,0x31,0x36,0x35,0x31,0x32,0x38,0x37,0x30,0x37,0x38,0x38,0x35,0x37,0x34,0x32,
+    0x31,0x38,0x37,0x35,0x66,0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x64,0x69,0x72,
+    0x65,0x63,0x74,0x4c,0x69,0x67,0x68,0x74,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x4e,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x56,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x4c,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x46,0x30,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,
+    0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6d,0x65,0x74,
+    0x61,0x6c,0x6c,0x69,0x63,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,
+    0x67,0x68,0x6e,0x65,0x73,0x73,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,
+    0x6f,0x74,0x56,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x5f,0x32,0x37,0x36,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,
+    0x7a,0x65,0x28,0x56,0x20,0x2b,0x20,0x4c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x38,0x31,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,
+    0x64,0x6f,0x74,0x28,0x4e,0x2c,0x20,0x4c,0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,
+    0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,0x35,
+    0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,0x35,
+    0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x4e,0x2c,
+    0x20,0x5f,0x32,0x37,0x36,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,
+    0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x5f,0x32,0x38,
+    0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
     0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x39,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x30,0x2e,
-    0x35,0x37,0x37,0x33,0x35,0x30,0x32,0x35,0x38,0x38,0x32,0x37,0x32,0x30,0x39,0x34,
-    0x37,0x32,0x36,0x35,0x36,0x32,0x35,0x66,0x2e,0x78,0x78,0x78,0x2c,0x20,0x5f,0x34,
-    0x32,0x30,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x20,0x3d,
-    0x20,0x5f,0x33,0x31,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x20,0x3d,0x20,0x5f,0x33,0x39,0x39,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x31,0x32,0x20,0x3d,0x20,0x5f,0x34,0x30,0x36,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,
-    0x20,0x3d,0x20,0x5f,0x33,0x31,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x33,0x20,0x5f,0x35,0x30,0x37,0x20,0x3d,0x20,0x46,0x5f,0x53,0x63,0x68,
-    0x6c,0x69,0x63,0x6b,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x28,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x31,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,
-    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x35,0x35,0x35,0x20,0x3d,0x20,0x62,
-    0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x62,
-    0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x32,0x28,0x5f,0x33,0x39,0x39,0x2c,0x20,0x5f,0x33,0x31,0x36,0x29,0x29,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x31,0x34,0x20,0x3d,0x20,0x28,0x28,0x28,0x28,0x28,0x28,0x31,0x2e,
-    0x30,0x66,0x2e,0x78,0x78,0x78,0x20,0x2d,0x20,0x5f,0x35,0x30,0x37,0x29,0x20,0x2a,
-    0x20,0x5f,0x34,0x31,0x31,0x29,0x20,0x2a,0x20,0x28,0x28,0x69,0x72,0x72,0x61,0x64,
-    0x69,0x61,0x6e,0x63,0x65,0x5f,0x6d,0x61,0x70,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,
-    0x28,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,
-    0x20,0x5f,0x33,0x38,0x31,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x5f,0x34,0x31,
-    0x32,0x29,0x20,0x2a,0x20,0x30,0x2e,0x33,0x30,0x30,0x30,0x30,0x30,0x30,0x31,0x31,
-    0x39,0x32,0x30,0x39,0x32,0x38,0x39,0x35,0x35,0x30,0x37,0x38,0x31,0x32,0x35,0x66,
-    0x29,0x29,0x20,0x2b,0x20,0x28,0x28,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,
-    0x5f,0x6d,0x61,0x70,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x4c,0x65,0x76,0x65,0x6c,
-    0x28,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,
-    0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x5f,0x33,0x38,0x39,0x2c,0x20,0x5f,
-    0x33,0x38,0x31,0x29,0x2c,0x20,0x5f,0x33,0x31,0x36,0x20,0x2a,0x20,0x34,0x2e,0x30,
-    0x66,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x28,0x28,0x5f,0x35,0x30,0x37,0x20,
-    0x2a,0x20,0x5f,0x35,0x35,0x35,0x2e,0x78,0x29,0x20,0x2b,0x20,0x5f,0x35,0x35,0x35,
-    0x2e,0x79,0x2e,0x78,0x78,0x78,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x66,0x29,
-    0x29,0x20,0x2a,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x74,0x65,
-    0x78,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,
-    0x6f,0x6e,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,0x2e,0x78,0x29,
-    0x20,0x2b,0x20,0x28,0x28,0x28,0x28,0x28,0x31,0x2e,0x30,0x66,0x2e,0x78,0x78,0x78,
-    0x20,0x2d,0x20,0x5f,0x34,0x36,0x30,0x29,0x20,0x2a,0x20,0x5f,0x34,0x31,0x31,0x29,
-    0x20,0x2a,0x20,0x28,0x5f,0x34,0x31,0x32,0x20,0x2a,0x20,0x46,0x64,0x5f,0x44,0x69,
-    0x73,0x6e,0x65,0x79,0x44,0x69,0x66,0x66,0x75,0x73,0x65,0x28,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x37,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x2c,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x39,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x29,
-    0x29,0x29,0x20,0x2b,0x20,0x28,0x5f,0x34,0x36,0x30,0x20,0x2a,0x20,0x28,0x44,0x5f,
-    0x47,0x47,0x58,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x31,0x29,0x20,0x2a,0x20,0x47,0x5f,0x53,0x6d,0x69,0x74,0x68,0x47,0x47,0x58,
-    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x29,0x29,0x29,0x29,0x20,0x2a,
-    0x20,0x5f,0x34,0x32,0x35,0x29,0x29,0x20,0x2b,0x20,0x28,0x65,0x6d,0x69,0x73,0x73,
-    0x69,0x76,0x65,0x5f,0x74,0x65,0x78,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x65,
-    0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x76,0x5f,0x75,
-    0x76,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x5f,0x32,0x38,0x31,0x5f,0x65,0x6d,
-    0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x29,0x3b,0x0a,
+    0x6d,0x5f,0x35,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x56,0x2c,
+    0x20,0x5f,0x32,0x37,0x36,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x36,0x20,0x3d,0x20,0x46,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x5f,0x33,0x31,0x36,0x20,0x3d,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,
+    0x69,0x63,0x6b,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x2c,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x36,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x38,0x20,0x3d,0x20,0x5f,0x32,0x38,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,
+    0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x4c,0x2c,0x20,0x5f,0x32,0x37,0x36,0x29,
+    0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x20,0x3d,0x20,0x72,0x6f,
+    0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x28,0x28,0x28,0x28,0x31,0x2e,0x30,0x66,0x2e,0x78,0x78,0x78,
+    0x20,0x2d,0x20,0x5f,0x33,0x31,0x36,0x29,0x20,0x2a,0x20,0x28,0x31,0x2e,0x30,0x66,
+    0x20,0x2d,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x29,0x29,0x20,0x2a,0x20,
+    0x28,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,
+    0x46,0x64,0x5f,0x44,0x69,0x73,0x6e,0x65,0x79,0x44,0x69,0x66,0x66,0x75,0x73,0x65,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x2c,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x30,0x29,0x29,0x29,0x20,0x2b,0x20,0x28,0x5f,0x33,0x31,0x36,0x20,
+    0x2a,0x20,0x28,0x44,0x5f,0x47,0x47,0x58,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x20,0x2a,0x20,0x47,0x5f,0x53,0x6d,0x69,
+    0x74,0x68,0x47,0x47,0x58,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x29,
+    0x29,0x29,0x29,0x20,0x2a,0x20,0x5f,0x32,0x38,0x31,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x52,
+    0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,
+    0x64,0x6f,0x74,0x56,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x46,0x30,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x46,0x30,0x20,0x2b,0x20,0x28,0x28,0x6d,
+    0x61,0x78,0x28,0x28,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,0x72,0x6f,0x75,0x67,0x68,
+    0x6e,0x65,0x73,0x73,0x29,0x2e,0x78,0x78,0x78,0x2c,0x20,0x46,0x30,0x29,0x20,0x2d,
+    0x20,0x46,0x30,0x29,0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,
+    0x65,0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x41,0x43,0x45,0x53,0x46,0x69,0x6c,
+    0x6d,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,
+    0x78,0x20,0x2a,0x20,0x28,0x28,0x78,0x20,0x2a,0x20,0x32,0x2e,0x35,0x30,0x39,0x39,
+    0x39,0x39,0x39,0x39,0x30,0x34,0x36,0x33,0x32,0x35,0x36,0x38,0x33,0x35,0x39,0x33,
+    0x37,0x35,0x66,0x29,0x20,0x2b,0x20,0x30,0x2e,0x30,0x32,0x39,0x39,0x39,0x39,0x39,
+    0x39,0x39,0x33,0x32,0x39,0x34,0x34,0x37,0x37,0x34,0x36,0x32,0x37,0x36,0x38,0x35,
+    0x35,0x34,0x36,0x38,0x37,0x35,0x66,0x2e,0x78,0x78,0x78,0x29,0x29,0x20,0x2f,0x20,
+    0x28,0x28,0x78,0x20,0x2a,0x20,0x28,0x28,0x78,0x20,0x2a,0x20,0x32,0x2e,0x34,0x33,
+    0x30,0x30,0x30,0x30,0x30,0x36,0x36,0x37,0x35,0x37,0x32,0x30,0x32,0x31,0x34,0x38,
+    0x34,0x33,0x37,0x35,0x66,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,0x38,0x39,0x39,0x39,
+    0x39,0x39,0x37,0x33,0x37,0x37,0x33,0x39,0x35,0x36,0x32,0x39,0x38,0x38,0x32,0x38,
+    0x31,0x32,0x35,0x66,0x2e,0x78,0x78,0x78,0x29,0x29,0x20,0x2b,0x20,0x30,0x2e,0x31,
+    0x34,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x35,0x39,0x36,0x30,0x34,0x36,0x34,0x34,
+    0x37,0x37,0x35,0x33,0x39,0x30,0x36,0x32,0x35,0x66,0x2e,0x78,0x78,0x78,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x66,0x2e,0x78,0x78,0x78,0x2c,0x20,0x31,0x2e,0x30,0x66,0x2e,
+    0x78,0x78,0x78,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x6c,0x69,0x6e,0x65,0x61,0x72,0x54,0x6f,0x53,0x52,0x47,0x42,0x28,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x6c,0x65,0x72,0x70,0x28,0x63,0x20,0x2a,0x20,0x31,0x32,0x2e,
+    0x39,0x32,0x30,0x30,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,0x39,0x34,0x35,0x33,
+    0x31,0x32,0x35,0x66,0x2c,0x20,0x28,0x70,0x6f,0x77,0x28,0x6d,0x61,0x78,0x28,0x63,
+    0x2c,0x20,0x30,0x2e,0x30,0x66,0x2e,0x78,0x78,0x78,0x29,0x2c,0x20,0x30,0x2e,0x34,
+    0x31,0x36,0x36,0x36,0x36,0x36,0x35,0x36,0x37,0x33,0x32,0x35,0x35,0x39,0x32,0x30,
+    0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x66,0x2e,0x78,0x78,0x78,0x29,0x20,0x2a,
+    0x20,0x31,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x34,0x37,0x35,0x34,0x37,0x39,
+    0x31,0x32,0x35,0x39,0x37,0x36,0x35,0x36,0x32,0x35,0x66,0x29,0x20,0x2d,0x20,0x30,
+    0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x30,0x31,0x39,0x37,0x36,
+    0x37,0x37,0x36,0x31,0x32,0x33,0x30,0x34,0x36,0x38,0x37,0x35,0x66,0x2e,0x78,0x78,
+    0x78,0x2c,0x20,0x73,0x74,0x65,0x70,0x28,0x30,0x2e,0x30,0x30,0x33,0x31,0x33,0x30,
+    0x38,0x30,0x30,0x30,0x39,0x30,0x37,0x33,0x30,0x31,0x39,0x30,0x32,0x37,0x37,0x30,
+    0x39,0x39,0x36,0x30,0x39,0x33,0x37,0x35,0x66,0x2e,0x78,0x78,0x78,0x2c,0x20,0x63,
+    0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x66,0x72,0x61,0x67,
+    0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x5f,0x33,0x37,0x39,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x74,0x65,0x78,0x2e,0x53,0x61,0x6d,0x70,0x6c,
+    0x65,0x28,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,0x20,0x2a,0x20,0x5f,0x33,0x37,0x33,0x5f,0x62,
+    0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x33,0x38,
+    0x37,0x20,0x3d,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x72,0x6f,0x75,
+    0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x74,0x65,0x78,0x2e,0x53,0x61,0x6d,0x70,0x6c,
+    0x65,0x28,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x72,0x6f,0x75,0x67,0x68,
+    0x6e,0x65,0x73,0x73,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x39,0x38,0x20,
+    0x3d,0x20,0x5f,0x33,0x38,0x37,0x2e,0x7a,0x20,0x2a,0x20,0x5f,0x33,0x37,0x33,0x5f,
+    0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x30,0x38,0x20,
+    0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x5f,0x33,0x38,0x37,0x2e,0x79,0x20,0x2a,
+    0x20,0x5f,0x33,0x37,0x33,0x5f,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,
+    0x66,0x61,0x63,0x74,0x6f,0x72,0x2c,0x20,0x30,0x2e,0x30,0x33,0x39,0x39,0x39,0x39,
+    0x39,0x39,0x39,0x31,0x30,0x35,0x39,0x33,0x30,0x33,0x32,0x38,0x33,0x36,0x39,0x31,
+    0x34,0x30,0x36,0x32,0x35,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x37,0x37,0x20,0x3d,
+    0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6d,0x75,0x6c,0x28,0x28,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x74,0x65,0x78,0x2e,0x53,0x61,0x6d,0x70,0x6c,
+    0x65,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x76,0x5f,
+    0x75,0x76,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x32,0x2e,0x30,0x66,0x29,0x20,
+    0x2d,0x20,0x31,0x2e,0x30,0x66,0x2e,0x78,0x78,0x78,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x78,0x33,0x28,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2c,0x20,
+    0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2c,0x20,0x76,0x5f,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x38,0x35,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x69,0x7a,0x65,0x28,0x5f,0x33,0x37,0x33,0x5f,0x63,0x61,0x6d,0x5f,0x70,
+    0x6f,0x73,0x20,0x2d,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x39,
+    0x35,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x37,0x37,
+    0x2c,0x20,0x5f,0x34,0x38,0x35,0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,
+    0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,0x35,0x35,0x31,
+    0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,0x35,0x66,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x39,
+    0x39,0x20,0x3d,0x20,0x5f,0x33,0x37,0x39,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x35,0x30,0x32,0x20,0x3d,0x20,
+    0x6c,0x65,0x72,0x70,0x28,0x30,0x2e,0x30,0x33,0x39,0x39,0x39,0x39,0x39,0x39,0x39,
+    0x31,0x30,0x35,0x39,0x33,0x30,0x33,0x32,0x38,0x33,0x36,0x39,0x31,0x34,0x30,0x36,
+    0x32,0x35,0x66,0x2e,0x78,0x78,0x78,0x2c,0x20,0x5f,0x34,0x39,0x39,0x2c,0x20,0x5f,
+    0x33,0x39,0x38,0x2e,0x78,0x78,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x35,0x30,0x37,0x20,0x3d,0x20,0x31,0x2e,0x30,0x66,0x20,
+    0x2d,0x20,0x5f,0x33,0x39,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x5f,0x35,0x30,0x38,0x20,0x3d,0x20,0x5f,0x34,0x39,0x39,0x20,0x2a,
+    0x20,0x5f,0x35,0x30,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x5f,0x34,0x37,0x37,0x3b,0x0a,
     0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x31,0x35,0x20,0x3d,0x20,0x41,0x43,0x45,0x53,0x46,0x69,0x6c,0x6d,0x28,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x31,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,
-    0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x34,0x28,0x6c,0x69,0x6e,0x65,0x61,0x72,0x54,0x6f,0x53,0x52,0x47,0x42,0x28,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x31,0x35,0x29,0x2c,0x20,0x5f,0x32,0x38,0x37,0x2e,0x77,
-    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,
-    0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,
-    0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,
-    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
-    0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,
-    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,
-    0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,
-    0x6e,0x74,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
-    0x2e,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x73,0x74,0x61,
-    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,
-    0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,
-    0x6f,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
-    0x2e,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,
-    0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,
-    0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,
-    0x74,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,
-    0x3d,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
-    0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+    0x5f,0x31,0x20,0x3d,0x20,0x5f,0x34,0x38,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,
+    0x30,0x2e,0x35,0x37,0x37,0x33,0x35,0x30,0x32,0x35,0x38,0x38,0x32,0x37,0x32,0x30,
+    0x39,0x34,0x37,0x32,0x36,0x35,0x36,0x32,0x35,0x66,0x2e,0x78,0x78,0x78,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x33,0x20,0x3d,0x20,0x5f,0x35,0x30,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,
+    0x5f,0x35,0x30,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x5f,0x33,0x39,0x38,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x36,0x20,0x3d,0x20,0x5f,0x34,0x30,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x5f,0x34,
+    0x39,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x38,0x20,0x3d,0x20,0x5f,0x34,0x39,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,
+    0x20,0x3d,0x20,0x5f,0x35,0x30,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x20,0x3d,0x20,0x5f,0x34,
+    0x30,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,
+    0x35,0x34,0x31,0x20,0x3d,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x52,
+    0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x5f,0x35,0x38,0x39,0x20,0x3d,0x20,0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,
+    0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,
+    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x5f,0x34,0x39,
+    0x35,0x2c,0x20,0x5f,0x34,0x30,0x38,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x20,0x3d,
+    0x20,0x28,0x28,0x28,0x28,0x28,0x28,0x31,0x2e,0x30,0x66,0x2e,0x78,0x78,0x78,0x20,
+    0x2d,0x20,0x5f,0x35,0x34,0x31,0x29,0x20,0x2a,0x20,0x5f,0x35,0x30,0x37,0x29,0x20,
+    0x2a,0x20,0x28,0x28,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5f,0x6d,
+    0x61,0x70,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x72,0x72,0x61,0x64,0x69,
+    0x61,0x6e,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x5f,0x34,0x37,0x37,0x29,0x2e,
+    0x78,0x79,0x7a,0x20,0x2a,0x20,0x5f,0x35,0x30,0x38,0x29,0x20,0x2a,0x20,0x30,0x2e,
+    0x33,0x30,0x30,0x30,0x30,0x30,0x30,0x31,0x31,0x39,0x32,0x30,0x39,0x32,0x38,0x39,
+    0x35,0x35,0x30,0x37,0x38,0x31,0x32,0x35,0x66,0x29,0x29,0x20,0x2b,0x20,0x28,0x28,
+    0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,0x6d,0x61,0x70,0x2e,0x53,0x61,
+    0x6d,0x70,0x6c,0x65,0x4c,0x65,0x76,0x65,0x6c,0x28,0x70,0x72,0x65,0x66,0x69,0x6c,
+    0x74,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,
+    0x28,0x2d,0x5f,0x34,0x38,0x35,0x2c,0x20,0x5f,0x34,0x37,0x37,0x29,0x2c,0x20,0x5f,
+    0x34,0x30,0x38,0x20,0x2a,0x20,0x34,0x2e,0x30,0x66,0x29,0x2e,0x78,0x79,0x7a,0x20,
+    0x2a,0x20,0x28,0x28,0x5f,0x35,0x34,0x31,0x20,0x2a,0x20,0x5f,0x35,0x38,0x39,0x2e,
+    0x78,0x29,0x20,0x2b,0x20,0x5f,0x35,0x38,0x39,0x2e,0x79,0x2e,0x78,0x78,0x78,0x29,
+    0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x66,0x29,0x29,0x20,0x2a,0x20,0x28,0x6f,0x63,
+    0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x74,0x65,0x78,0x2e,0x53,0x61,0x6d,0x70,
+    0x6c,0x65,0x28,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,0x2e,0x78,0x20,0x2a,0x20,0x76,0x5f,0x6f,0x63,
+    0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x29,0x29,0x20,0x2b,0x20,0x64,0x69,0x72,0x65,
+    0x63,0x74,0x4c,0x69,0x67,0x68,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x29,0x29,0x20,0x2b,
+    0x20,0x28,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x74,0x65,0x78,0x2e,0x53,
+    0x61,0x6d,0x70,0x6c,0x65,0x28,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x73,
+    0x6d,0x70,0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,
+    0x5f,0x33,0x37,0x33,0x5f,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x66,0x61,
+    0x63,0x74,0x6f,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x20,0x3d,0x20,0x41,0x43,0x45,
+    0x53,0x46,0x69,0x6c,0x6d,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x6c,0x69,0x6e,0x65,0x61,0x72,0x54,
+    0x6f,0x53,0x52,0x47,0x42,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x29,0x2c,
+    0x20,0x5f,0x33,0x37,0x39,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,
+    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,
+    0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
+    0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x75,
+    0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
+    0x2e,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x74,0x61,0x6e,0x67,
+    0x65,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,
+    0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x2e,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,
+    0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x2e,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
+    0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,
+    0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,
+    0x72,0x20,0x3d,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
 };
 /*
-    #include <metal_stdlib>
-    #include <simd/simd.h>
-
-    using namespace metal;
-
-    struct vs_params
-    {
-        float4x4 mvp;
-        float4x4 model;
-        float4x4 normal_matrix;
-        packed_float3 cam_pos;
-        float _pad0;
-    };
-
-    struct main0_out
-    {
-        float3 v_world_pos [[user(locn0)]];
-        float3 v_normal [[user(locn1)]];
-        float3 v_tangent [[user(locn2)]];
-        float3 v_bitangent [[user(locn3)]];
-        float2 v_uv [[user(locn4)]];
-        float4 gl_Position [[position]];
-    };
-
-    struct main0_in
+    cbuffer vs_params : register(b0)
     {
-        float3 pos [[attribute(0)]];
-        float3 normal [[attribute(1)]];
-        float2 uv [[attribute(2)]];
-        float4 tangent [[attribute(3)]];
+        row_major float4x4 _14_mvp : packoffset(c0);
+        row_major float4x4 _14_model : packoffset(c4);
+        row_major float4x4 _14_normal_matrix : packoffset(c8);
+        float3 _14_cam_pos : packoffset(c12);
+        float _14_pad0 : packoffset(c12.w);
     };
 
-    vertex main0_out main0(main0_in in [[stage_in]], constant vs_params& _14 [[buffer(0)]])
-    {
-        main0_out out = {};
-        float4 _27 = float4(in.pos, 1.0);
-        out.v_world_pos = (_14.model * _27).xyz;
-        out.v_normal = fast::normalize((_14.normal_matrix * float4(in.normal, 0.0)).xyz);
-        out.v_tangent = fast::normalize((_14.normal_matrix * float4(in.tangent.xyz, 0.0)).xyz);
-        out.v_bitangent = cross(out.v_normal, out.v_tangent) * in.tangent.w;
-        out.v_uv = in.uv;
-        out.gl_Position = _14.mvp * _27;
-        return out;
-    }
-
-*/
-static const uint8_t pbr_vs_source_metal_macos[1140] = {
-    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
-    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
-    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
-    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
-    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x76,
-    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x6d,0x76,0x70,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x6d,0x6f,0x64,0x65,0x6c,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x6e,0x6f,
-    0x72,0x6d,0x61,0x6c,0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,
-    0x61,0x6d,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x20,0x5f,0x70,0x61,0x64,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
-    0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x77,0x6f,0x72,
-    0x6c,0x64,0x5f,0x70,0x6f,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,
-    0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x5b,0x5b,0x75,0x73,
-    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,
-    0x74,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,
-    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,
-    0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,
-    0x28,0x6c,0x6f,0x63,0x6e,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,
-    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x34,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
-    0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,
-    0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,
-    0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x33,0x20,0x70,0x6f,0x73,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,
-    0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,
-    0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,
-    0x69,0x62,0x75,0x74,0x65,0x28,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x5b,
-    0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x33,0x29,0x5d,0x5d,0x3b,
-    0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,
-    0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,
-    0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,
-    0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x76,
-    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x31,0x34,0x20,0x5b,0x5b,
-    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,
-    0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x34,0x20,0x5f,0x32,0x37,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,
-    0x6e,0x2e,0x70,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,
-    0x20,0x3d,0x20,0x28,0x5f,0x31,0x34,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x20,0x2a,0x20,
-    0x5f,0x32,0x37,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
-    0x74,0x2e,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x66,0x61,0x73,
-    0x74,0x3a,0x3a,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x28,0x5f,0x31,
-    0x34,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,0x20,
-    0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x6e,0x6f,0x72,0x6d,
-    0x61,0x6c,0x2c,0x20,0x30,0x2e,0x30,0x29,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,
-    0x74,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
-    0x69,0x7a,0x65,0x28,0x28,0x5f,0x31,0x34,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,
-    0x6d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,
-    0x69,0x6e,0x2e,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x78,0x79,0x7a,0x2c,0x20,
-    0x30,0x2e,0x30,0x29,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x6f,0x75,0x74,0x2e,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,
-    0x3d,0x20,0x63,0x72,0x6f,0x73,0x73,0x28,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x6e,0x6f,
-    0x72,0x6d,0x61,0x6c,0x2c,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x74,0x61,0x6e,0x67,
-    0x65,0x6e,0x74,0x29,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x74,0x61,0x6e,0x67,0x65,0x6e,
-    0x74,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,
-    0x76,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
-    0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,
-    0x20,0x5f,0x31,0x34,0x2e,0x6d,0x76,0x70,0x20,0x2a,0x20,0x5f,0x32,0x37,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,
-    0x7d,0x0a,0x0a,0x00,
-};
-/*
-    #pragma clang diagnostic ignored "-Wmissing-prototypes"
-
-    #include <metal_stdlib>
-    #include <simd/simd.h>
-
-    using namespace metal;
 
-    struct fs_params
-    {
-        float4 base_color_factor;
-        float metallic_factor;
-        float roughness_factor;
-        char _m3_pad[8];
-        packed_float3 emissive_factor;
-        float _pad0;
-        packed_float3 cam_pos;
-        float _pad1;
-    };
+    static float4 gl_Position;
+    static float3 v_world_pos;
+    static float3 pos;
+    static float3 v_normal;
+    static float3 normal;
+    static float3 v_tangent;
+    static float4 tangent;
+    static float3 v_bitangent;
+    static float2 v_uv;
+    static float2 uv;
+    static float v_occlusion;
+    static float occlusion;
+    static float4 v_clip;
 
-    struct main0_out
+    struct SPIRV_Cross_Input
     {
-        float4 frag_color [[color(0)]];
+        float3 pos : TEXCOORD0;
+        float3 normal : TEXCOORD1;
+        float2 uv : TEXCOORD2;
+        float4 tangent : TEXCOORD3;
+        float occlusion : TEXCOORD4;
     };
 
-    struct main0_in
+    struct SPIRV_Cross_Output
     {
-        float3 v_world_pos [[user(locn0)]];
-        float3 v_normal [[user(locn1)]];
-        float3 v_tangent [[user(locn2)]];
-        float3 v_bitangent [[user(locn3)]];
-        float2 v_uv [[user(locn4)]];
+        float3 v_world_pos : TEXCOORD0;
+        float3 v_normal : TEXCOORD1;
+        float3 v_tangent : TEXCOORD2;
+        float3 v_bitangent : TEXCOORD3;
+        float2 v_uv : TEXCOORD4;
+        float v_occlusion : TEXCOORD5;
+        float4 v_clip : TEXCOORD6;
+        float4 gl_Position : SV_Position;
     };
 
-    static inline __attribute__((always_inline))
-    float D_GGX(thread const float& NdotH, thread const float& roughness)
-    {
-        float _130 = roughness * roughness;
-        float _134 = _130 * _130;
-        float _144 = ((NdotH * NdotH) * (_134 - 1.0)) + 1.0;
-        return _134 / ((3.1415927410125732421875 * _144) * _144);
-    }
-
-    static inline __attribute__((always_inline))
-    float G_SmithGGX(thread const float& NdotV, thread const float& NdotL, thread const float& roughness)
+    void vert_main()
     {
-        float _157 = roughness * roughness;
-        float _161 = _157 * _157;
-        float _168 = 1.0 - _161;
-        return 0.5 / fast::max((NdotL * sqrt(((NdotV * NdotV) * _168) + _161)) + (NdotV * sqrt(((NdotL * NdotL) * _168) + _161)), 9.9999997473787516355514526367188e-05);
+        float4 _27 = float4(pos, 1.0f);
+        v_world_pos = mul(_27, _14_model).xyz;
+        v_normal = normalize(mul(float4(normal, 0.0f), _14_normal_matrix).xyz);
+        v_tangent = normalize(mul(float4(tangent.xyz, 0.0f), _14_normal_matrix).xyz);
+        v_bitangent = cross(v_normal, v_tangent) * tangent.w;
+        v_uv = uv;
+        v_occlusion = occlusion;
+        gl_Position = mul(_27, _14_mvp);
+        v_clip = gl_Position;
     }
 
-    static inline __attribute__((always_inline))
-    float SchlickFresnel(thread const float& u)
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
     {
-        float _115 = fast::clamp(1.0 - u, 0.0, 1.0);
-        float _119 = _115 * _115;
-        return (_119 * _119) * _115;
-    }
-
-    static inline __attribute__((always_inline))
-    float3 F_Schlick(thread const float& VdotH, thread const float3& F0)
+        pos = stage_input.pos;
+        normal = stage_input.normal;
+        tangent = stage_input.tangent;
+        uv = stage_input.uv;
+        occlusion = stage_input.occlusion;
+        vert_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.gl_Position = gl_Position;
+        stage_output.v_world_pos = v_world_pos;
+        stage_output.v_normal = v_normal;
+        stage_output.v_tangent = v_tangent;
+        stage_output.v_bitangent = v_bitangent;
+        stage_output.v_uv = v_uv;
+        stage_output.v_occlusion = v_occlusion;
+        stage_output.v_clip = v_clip;
+        return stage_output;
+    }
+*/
+static const uint8_t pbr_vs_clustered_source_hlsl5[2112] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,0x6f,0x72,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x31,0x34,0x5f,0x6d,0x76,
+    0x70,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,0x6f,
+    0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x31,0x34,0x5f,0x6d,
+    0x6f,0x64,0x65,0x6c,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,
+    0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x31,
+    0x34,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,0x20,
+    0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x38,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x34,
+    0x5f,0x63,0x61,0x6d,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x34,0x5f,0x70,0x61,0x64,0x30,0x20,0x3a,
+    0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x32,0x2e,
+    0x77,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,
+    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,
+    0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,
+    0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x3b,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,
+    0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x76,0x5f,0x63,0x6c,0x69,0x70,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,
+    0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x70,0x6f,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x3a,0x20,
+    0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3a,0x20,
+    0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,
+    0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,
+    0x6f,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x74,0x61,
+    0x6e,0x67,0x65,0x6e,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,
+    0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
+    0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
+    0x4f,0x4f,0x52,0x44,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x76,0x5f,0x63,0x6c,0x69,0x70,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
+    0x4f,0x52,0x44,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x53,
+    0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x76,0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,
+    0x37,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x73,0x2c,0x20,
+    0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x77,0x6f,0x72,
+    0x6c,0x64,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,0x5f,0x32,0x37,
+    0x2c,0x20,0x5f,0x31,0x34,0x5f,0x6d,0x6f,0x64,0x65,0x6c,0x29,0x2e,0x78,0x79,0x7a,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,
+    0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6d,0x75,0x6c,0x28,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x30,0x2e,
+    0x30,0x66,0x29,0x2c,0x20,0x5f,0x31,0x34,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,
+    0x6d,0x61,0x74,0x72,0x69,0x78,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6d,0x75,0x6c,0x28,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x28,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x78,0x79,0x7a,0x2c,0x20,
+    0x30,0x2e,0x30,0x66,0x29,0x2c,0x20,0x5f,0x31,0x34,0x5f,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,
+    0x3d,0x20,0x63,0x72,0x6f,0x73,0x73,0x28,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x2c,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x29,0x20,0x2a,0x20,0x74,
+    0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
+    0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x6f,
+    0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6f,0x63,0x63,0x6c,0x75,
+    0x73,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,0x5f,0x32,0x37,0x2c,
+    0x20,0x5f,0x31,0x34,0x5f,0x6d,0x76,0x70,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x5f,0x63,0x6c,0x69,0x70,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,
+    0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,
+    0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
+    0x6e,0x70,0x75,0x74,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
+    0x6e,0x70,0x75,0x74,0x2e,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x63,0x63,
+    0x6c,0x75,0x73,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
+    0x6e,0x70,0x75,0x74,0x2e,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
+    0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,
+    0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,
+    0x75,0x74,0x2e,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x20,0x3d,
+    0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,
+    0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,
+    0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,
+    0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x62,
+    0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,0x76,0x5f,0x62,0x69,0x74,
+    0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,
+    0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,
+    0x75,0x74,0x2e,0x76,0x5f,0x63,0x6c,0x69,0x70,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6c,
+    0x69,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+
+};
+/*
+    struct punctual_light
+    {
+        float4 position_range;
+        float4 color_spot_scale;
+        float4 direction_spot_offset;
+    };
+
+    struct light_cluster
+    {
+        uint offset;
+        uint count;
+    };
+
+    struct light_index
+    {
+        uint light;
+    };
+
+    cbuffer light_params : register(b3)
+    {
+        float4 _93_cluster_grid : packoffset(c0);
+        float4 _93_cluster_depth : packoffset(c1);
+    };
+
+    ByteAddressBuffer _160 : register(t9);
+    cbuffer fs_params : register(b1)
+    {
+        float4 _541_base_color_factor : packoffset(c0);
+        float _541_metallic_factor : packoffset(c1);
+        float _541_roughness_factor : packoffset(c1.y);
+        float3 _541_emissive_factor : packoffset(c2);
+        float _541_pad0 : packoffset(c2.w);
+        float3 _541_cam_pos : packoffset(c3);
+        float _541_pad1 : packoffset(c3.w);
+    };
+
+    ByteAddressBuffer _715 : register(t8);
+    ByteAddressBuffer _720 : register(t10);
+    Texture2D<float4> base_color_tex : register(t0);
+    SamplerState base_color_smp : register(s0);
+    Texture2D<float4> metallic_roughness_tex : register(t1);
+    SamplerState metallic_roughness_smp : register(s1);
+    Texture2D<float4> occlusion_tex : register(t3);
+    SamplerState occlusion_smp : register(s3);
+    Texture2D<float4> emissive_tex : register(t4);
+    SamplerState emissive_smp : register(s4);
+    Texture2D<float4> normal_tex : register(t2);
+    SamplerState normal_smp : register(s2);
+    TextureCube<float4> irradiance_map : register(t5);
+    SamplerState irradiance_smp : register(s5);
+    TextureCube<float4> prefilter_map : register(t6);
+    SamplerState prefilter_smp : register(s6);
+    Texture2D<float4> brdf_lut : register(t7);
+    SamplerState brdf_lut_smp : register(s7);
+
+    static float2 v_uv;
+    static float v_occlusion;
+    static float3 v_tangent;
+    static float3 v_bitangent;
+    static float3 v_normal;
+    static float3 v_world_pos;
+    static float4 v_clip;
+    static float4 frag_color;
+
+    struct SPIRV_Cross_Input
+    {
+        float3 v_world_pos : TEXCOORD0;
+        float3 v_normal : TEXCOORD1;
+        float3 v_tangent : TEXCOORD2;
+        float3 v_bitangent : TEXCOORD3;
+        float2 v_uv : TEXCOORD4;
+        float v_occlusion : TEXCOORD5;
+        float4 v_clip : TEXCOORD6;
+    };
+
+    struct SPIRV_Cross_Output
+    {
+        float4 frag_color : SV_Target0;
+    };
+
+    float D_GGX(float NdotH, float roughness)
+    {
+        float _313 = roughness * roughness;
+        float _317 = _313 * _313;
+        float _327 = ((NdotH * NdotH) * (_317 - 1.0f)) + 1.0f;
+        return _317 / ((3.1415927410125732421875f * _327) * _327);
+    }
+
+    float G_SmithGGX(float NdotV, float NdotL, float roughness)
+    {
+        float _340 = roughness * roughness;
+        float _344 = _340 * _340;
+        float _351 = 1.0f - _344;
+        return 0.5f / max((NdotL * sqrt(((NdotV * NdotV) * _351) + _344)) + (NdotV * sqrt(((NdotL * NdotL) * _351) + _344)), 9.9999997473787516355514526367188e-05f);
+    }
+
+    float SchlickFresnel(float u)
+    {
+        float _298 = clamp(1.0f - u, 0.0f, 1.0f);
+        float _302 = _298 * _298;
+        return (_302 * _302) * _298;
+    }
+
+    float3 F_Schlick(float VdotH, float3 F0)
     {
         float param = VdotH;
-        return F0 + ((float3(1.0) - F0) * SchlickFresnel(param));
+        return F0 + ((1.0f.xxx - F0) * SchlickFresnel(param));
     }
 
-    static inline __attribute__((always_inline))
-    float Fd_DisneyDiffuse(thread const float& NdotV, thread const float& NdotL, thread const float& LdotH, thread const float& roughness)
+    float Fd_DisneyDiffuse(float NdotV, float NdotL, float LdotH, float roughness)
     {
-        float _240 = (mix(0.0, 0.5, roughness) + (((2.0 * LdotH) * LdotH) * roughness)) - 1.0;
+        float _422 = (lerp(0.0f, 0.5f, roughness) + (((2.0f * LdotH) * LdotH) * roughness)) - 1.0f;
         float param = NdotV;
         float param_1 = NdotL;
-        return ((1.0 + (_240 * SchlickFresnel(param))) * (1.0 + (_240 * SchlickFresnel(param_1)))) * mix(1.0, 0.662251651287078857421875, roughness);
+        return ((1.0f + (_422 * SchlickFresnel(param))) * (1.0f + (_422 * SchlickFresnel(param_1)))) * lerp(1.0f, 0.662251651287078857421875f, roughness);
     }
 
-    static inline __attribute__((always_inline))
-    float3 F_SchlickRoughness(thread const float& NdotV, thread const float3& F0, thread const float& roughness)
+    float3 directLight(float3 N, float3 V, float3 L, float3 F0, float3 diffuseColor, float metallic, float roughness, float NdotV)
+    {
+        float3 _447 = normalize(V + L);
+        float _452 = max(dot(N, L), 9.9999997473787516355514526367188e-05f);
+        float param = max(dot(N, _447), 0.0f);
+        float param_1 = roughness;
+        float param_2 = NdotV;
+        float param_3 = _452;
+        float param_4 = roughness;
+        float param_5 = max(dot(V, _447), 0.0f);
+        float3 param_6 = F0;
+        float3 _487 = F_Schlick(param_5, param_6);
+        float param_7 = NdotV;
+        float param_8 = _452;
+        float param_9 = max(dot(L, _447), 0.0f);
+        float param_10 = roughness;
+        return ((((1.0f.xxx - _487) * (1.0f - metallic)) * (diffuseColor * Fd_DisneyDiffuse(param_7, param_8, param_9, param_10))) + (_487 * (D_GGX(param, param_1) * G_SmithGGX(param_2, param_3, param_4)))) * _452;
+    }
+
+    uint2 clusterLightRange(float4 clip)
+    {
+        int3 _133 = clamp(int3(float3((((clip.xy / clip.w.xx) * 0.5f) + 0.5f.xx) * _93_cluster_grid.xy, (log(max(clip.w, 9.9999999747524270787835121154785e-07f)) * _93_cluster_depth.x) + _93_cluster_depth.y)), int3(0, 0, 0), int3(_93_cluster_grid.xyz) - int3(1, 1, 1));
+        light_cluster _164;
+        _164.offset = _160.Load(((((_133.z * int(_93_cluster_grid.y)) + _133.y) * int(_93_cluster_grid.x)) + _133.x) * 8 + 0);
+        _164.count = _160.Load(((((_133.z * int(_93_cluster_grid.y)) + _133.y) * int(_93_cluster_grid.x)) + _133.x) * 8 + 4);
+        return uint2(_164.offset, _164.count);
+    }
+
+    float punctualAttenuation(punctual_light light, float3 world_pos, inout float3 L)
+    {
+        float3 _182 = light.position_range.xyz - world_pos;
+        float _188 = max(dot(_182, _182), 9.9999999392252902907785028219223e-09f);
+        L = _182 * rsqrt(_188);
+        float _200 = _188 / (light.position_range.w * light.position_range.w);
+        float _208 = clamp(1.0f - (_200 * _200), 0.0f, 1.0f);
+        float _223 = clamp((dot(light.direction_spot_offset.xyz, -L) * light.color_spot_scale.w) + light.direction_spot_offset.w, 0.0f, 1.0f);
+        return (((_208 * _208) * _223) * _223) / _188;
+    }
+
+    float3 F_SchlickRoughness(float NdotV, float3 F0, float roughness)
     {
         float param = NdotV;
-        return F0 + ((fast::max(float3(1.0 - roughness), F0) - F0) * SchlickFresnel(param));
+        return F0 + ((max((1.0f - roughness).xxx, F0) - F0) * SchlickFresnel(param));
     }
 
-    static inline __attribute__((always_inline))
-    float3 ACESFilm(thread const float3& x)
+    float3 ACESFilm(float3 x)
     {
-        return fast::clamp((x * ((x * 2.5099999904632568359375) + float3(0.02999999932944774627685546875))) / ((x * ((x * 2.4300000667572021484375) + float3(0.589999973773956298828125))) + float3(0.14000000059604644775390625)), float3(0.0), float3(1.0));
+        return clamp((x * ((x * 2.5099999904632568359375f) + 0.02999999932944774627685546875f.xxx)) / ((x * ((x * 2.4300000667572021484375f) + 0.589999973773956298828125f.xxx)) + 0.14000000059604644775390625f.xxx), 0.0f.xxx, 1.0f.xxx);
     }
 
-    static inline __attribute__((always_inline))
-    float3 linearToSRGB(thread const float3& c)
+    float3 linearToSRGB(float3 c)
     {
-        return mix(c * 12.9200000762939453125, (powr(fast::max(c, float3(0.0)), float3(0.4166666567325592041015625)) * 1.05499994754791259765625) - float3(0.054999999701976776123046875), step(float3(0.003130800090730190277099609375), c));
+        return lerp(c * 12.9200000762939453125f, (pow(max(c, 0.0f.xxx), 0.4166666567325592041015625f.xxx) * 1.05499994754791259765625f) - 0.054999999701976776123046875f.xxx, step(0.003130800090730190277099609375f.xxx, c));
     }
 
-    fragment main0_out main0(main0_in in [[stage_in]], constant fs_params& _281 [[buffer(1)]], texture2d<float> base_color_tex [[texture(0)]], texture2d<float> metallic_roughness_tex [[texture(1)]], texture2d<float> normal_tex [[texture(2)]], texture2d<float> occlusion_tex [[texture(3)]], texture2d<float> emissive_tex [[texture(4)]], texturecube<float> irradiance_map [[texture(5)]], texturecube<float> prefilter_map [[texture(6)]], texture2d<float> brdf_lut [[texture(7)]], sampler base_color_smp [[sampler(0)]], sampler metallic_roughness_smp [[sampler(1)]], sampler normal_smp [[sampler(2)]], sampler occlusion_smp [[sampler(3)]], sampler emissive_smp [[sampler(4)]], sampler irradiance_smp [[sampler(5)]], sampler prefilter_smp [[sampler(6)]], sampler brdf_lut_smp [[sampler(7)]])
+    void frag_main()
     {
-        main0_out out = {};
-        float4 _287 = base_color_tex.sample(base_color_smp, in.v_uv) * _281.base_color_factor;
-        float4 _295 = metallic_roughness_tex.sample(metallic_roughness_smp, in.v_uv);
-        float _306 = _295.z * _281.metallic_factor;
-        float _316 = fast::clamp(_295.y * _281.roughness_factor, 0.039999999105930328369140625, 1.0);
-        float3 _381 = fast::normalize(float3x3(in.v_tangent, in.v_bitangent, in.v_normal) * ((normal_tex.sample(normal_smp, in.v_uv).xyz * 2.0) - float3(1.0)));
-        float3 _389 = fast::normalize(float3(_281.cam_pos) - in.v_world_pos);
-        float _399 = fast::max(dot(_381, _389), 9.9999997473787516355514526367188e-05);
-        float3 _403 = _287.xyz;
-        float3 _406 = mix(float3(0.039999999105930328369140625), _403, float3(_306));
-        float _411 = 1.0 - _306;
-        float3 _412 = _403 * _411;
-        float3 _420 = fast::normalize(_389 + float3(0.57735025882720947265625));
-        float _425 = fast::max(dot(_381, float3(0.57735025882720947265625)), 9.9999997473787516355514526367188e-05);
-        float param = fast::max(dot(_381, _420), 0.0);
-        float param_1 = _316;
-        float param_2 = _399;
-        float param_3 = _425;
-        float param_4 = _316;
-        float param_5 = fast::max(dot(_389, _420), 0.0);
-        float3 param_6 = _406;
-        float3 _460 = F_Schlick(param_5, param_6);
-        float param_7 = _399;
-        float param_8 = _425;
-        float param_9 = fast::max(dot(float3(0.57735025882720947265625), _420), 0.0);
-        float param_10 = _316;
-        float param_11 = _399;
-        float3 param_12 = _406;
-        float param_13 = _316;
-        float3 _507 = F_SchlickRoughness(param_11, param_12, param_13);
-        float4 _555 = brdf_lut.sample(brdf_lut_smp, float2(_399, _316));
-        float3 param_14 = ((((((float3(1.0) - _507) * _411) * ((irradiance_map.sample(irradiance_smp, _381).xyz * _412) * 0.300000011920928955078125)) + ((prefilter_map.sample(prefilter_smp, reflect(-_389, _381), level(_316 * 4.0)).xyz * ((_507 * _555.x) + float3(_555.y))) * 0.5)) * occlusion_tex.sample(occlusion_smp, in.v_uv).x) + (((((float3(1.0) - _460) * _411) * (_412 * Fd_DisneyDiffuse(param_7, param_8, param_9, param_10))) + (_460 * (D_GGX(param, param_1) * G_SmithGGX(param_2, param_3, param_4)))) * _425)) + (emissive_tex.sample(emissive_smp, in.v_uv).xyz * float3(_281.emissive_factor));
-        float3 param_15 = ACESFilm(param_14);
-        out.frag_color = float4(linearToSRGB(param_15), _287.w);
-        return out;
+        float4 _544 = base_color_tex.Sample(base_color_smp, v_uv) * _541_base_color_factor;
+        float4 _552 = metallic_roughness_tex.Sample(metallic_roughness_smp, v_uv);
+        float _559 = _552.z * _541_metallic_factor;
+        float _567 = clamp(_552.y * _541_roughness_factor, 0.039999999105930328369140625f, 1.0f);
+        float3 _635 = normalize(mul((normal_tex.Sample(normal_smp, v_uv).xyz * 2.0f) - 1.0f.xxx, float3x3(v_tangent, v_bitangent, v_normal)));
+        float3 _643 = normalize(_541_cam_pos - v_world_pos);
+        float _653 = max(dot(_635, _643), 9.9999997473787516355514526367188e-05f);
+        float3 _657 = _544.xyz;
+        float3 _660 = lerp(0.039999999105930328369140625f.xxx, _657, _559.xxx);
+        float _665 = 1.0f - _559;
+        float3 _666 = _657 * _665;
+        float3 param = _635;
+        float3 param_1 = _643;
+        float3 param_2 = 0.57735025882720947265625f.xxx;
+        float3 param_3 = _660;
+        float3 param_4 = _666;
+        float param_5 = _559;
+        float param_6 = _567;
+        float param_7 = _653;
+        float3 Lo = directLight(param, param_1, param_2, param_3, param_4, param_5, param_6, param_7);
+        float4 param_8 = v_clip;
+        uint2 _698 = clusterLightRange(param_8);
+        float3 param_11;
+        for (uint i = 0u; i < _698.y; i++)
+        {
+            punctual_light _730;
+            _730.position_range = asfloat(_715.Load4(_720.Load((_698.x + i) * 4 + 0) * 48 + 0));
+            _730.color_spot_scale = asfloat(_715.Load4(_720.Load((_698.x + i) * 4 + 0) * 48 + 16));
+            _730.direction_spot_offset = asfloat(_715.Load4(_720.Load((_698.x + i) * 4 + 0) * 48 + 32));
+            punctual_light _880 = { _730.position_range, _730.color_spot_scale, _730.direction_spot_offset };
+            punctual_light param_9 = _880;
+            float3 param_10 = v_world_pos;
+            float _744 = punctualAttenuation(param_9, param_10, param_11);
+            if (_744 > 0.0f)
+            {
+                float3 param_12 = _635;
+                float3 param_13 = _643;
+                float3 param_14 = param_11;
+                float3 param_15 = _660;
+                float3 param_16 = _666;
+                float param_17 = _559;
+                float param_18 = _567;
+                float param_19 = _653;
+                Lo += ((directLight(param_12, param_13, param_14, param_15, param_16, param_17, param_18, param_19) * _730.color_spot_scale.xyz) * _744);
+            }
+        }
+        float param_20 = _653;
+        float3 param_21 = _660;
+        float param_22 = _567;
+        float3 _784 = F_SchlickRoughness(param_20, param_21, param_22);
+        float4 _831 = brdf_lut.Sample(brdf_lut_smp, float2(_653, _567));
+        float3 param_23 = ((((((1.0f.xxx - _784) * _665) * ((irradiance_map.Sample(irradiance_smp, _635).xyz * _666) * 0.300000011920928955078125f)) + ((prefilter_map.SampleLevel(prefilter_smp, reflect(-_643, _635), _567 * 4.0f).xyz * ((_784 * _831.x) + _831.y.xxx)) * 0.5f)) * (occlusion_tex.Sample(occlusion_smp, v_uv).x * v_occlusion)) + Lo) + (emissive_tex.Sample(emissive_smp, v_uv).xyz * _541_emissive_factor);
+        float3 param_24 = ACESFilm(param_23);
+        frag_color = float4(linearToSRGB(param_24), _544.w);
     }
 
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        v_uv = stage_input.v_uv;
+        v_occlusion = stage_input.v_occlusion;
+        v_tangent = stage_input.v_tangent;
+        v_bitangent = stage_input.v_bitangent;
+        v_normal = stage_input.v_normal;
+        v_world_pos = stage_input.v_world_pos;
+        v_clip = stage_input.v_clip;
+        frag_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.frag_color = frag_color;
+        return stage_output;
+    }
 */
-static const uint8_t pbr_fs_source_metal_macos[6363] = {
-    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
-    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
-    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
-    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
-    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
-    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
-    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,
-    0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,
-    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
-    0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,
-    0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6d,0x65,0x74,0x61,
-    0x6c,0x6c,0x69,0x63,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
-    0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x68,0x61,
-    0x72,0x20,0x5f,0x6d,0x33,0x5f,0x70,0x61,0x64,0x5b,0x38,0x5d,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
-    0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,0x64,0x30,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,
-    0x61,0x74,0x33,0x20,0x63,0x61,0x6d,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,0x64,0x31,0x3b,0x0a,0x7d,0x3b,
-    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
-    0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
-    0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x63,0x6f,0x6c,
-    0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
-    0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,
-    0x64,0x5f,0x70,0x6f,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,
-    0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x5b,0x5b,0x75,0x73,0x65,
-    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,
-    0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x62,
-    0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,
-    0x6c,0x6f,0x63,0x6e,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,
-    0x28,0x6c,0x6f,0x63,0x6e,0x34,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
-    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
-    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
-    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,
-    0x74,0x20,0x44,0x5f,0x47,0x47,0x58,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
-    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x4e,0x64,0x6f,0x74,
-    0x48,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
-    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,
-    0x33,0x30,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x20,0x2a,
-    0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x33,0x34,0x20,0x3d,0x20,0x5f,0x31,0x33,
-    0x30,0x20,0x2a,0x20,0x5f,0x31,0x33,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x20,0x5f,0x31,0x34,0x34,0x20,0x3d,0x20,0x28,0x28,0x4e,0x64,0x6f,
-    0x74,0x48,0x20,0x2a,0x20,0x4e,0x64,0x6f,0x74,0x48,0x29,0x20,0x2a,0x20,0x28,0x5f,
-    0x31,0x33,0x34,0x20,0x2d,0x20,0x31,0x2e,0x30,0x29,0x29,0x20,0x2b,0x20,0x31,0x2e,
-    0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,
-    0x33,0x34,0x20,0x2f,0x20,0x28,0x28,0x33,0x2e,0x31,0x34,0x31,0x35,0x39,0x32,0x37,
-    0x34,0x31,0x30,0x31,0x32,0x35,0x37,0x33,0x32,0x34,0x32,0x31,0x38,0x37,0x35,0x20,
-    0x2a,0x20,0x5f,0x31,0x34,0x34,0x29,0x20,0x2a,0x20,0x5f,0x31,0x34,0x34,0x29,0x3b,
-    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,
-    0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,
-    0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,
-    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x47,0x5f,0x53,0x6d,0x69,0x74,0x68,0x47,0x47,
-    0x58,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x26,0x20,0x4e,0x64,0x6f,0x74,0x56,0x2c,0x20,0x74,0x68,0x72,
-    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,
-    0x20,0x4e,0x64,0x6f,0x74,0x4c,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
-    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x72,0x6f,0x75,0x67,
+static const uint8_t pbr_fs_clustered_source_hlsl5[9567] = {
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x70,0x75,0x6e,0x63,0x74,0x75,0x61,0x6c,0x5f,
+    0x6c,0x69,0x67,0x68,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x72,0x61,0x6e,0x67,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,
+    0x6c,0x6f,0x72,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x64,0x69,0x72,0x65,0x63,
+    0x74,0x69,0x6f,0x6e,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x69,0x67,
+    0x68,0x74,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x69,
+    0x6e,0x64,0x65,0x78,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x6c,0x69,0x67,0x68,0x74,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,
+    0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x33,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x39,0x33,0x5f,
+    0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x67,0x72,0x69,0x64,0x20,0x3a,0x20,0x70,
+    0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x39,0x33,0x5f,0x63,0x6c,
+    0x75,0x73,0x74,0x65,0x72,0x5f,0x64,0x65,0x70,0x74,0x68,0x20,0x3a,0x20,0x70,0x61,
+    0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x42,0x79,0x74,0x65,0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,0x75,0x66,
+    0x66,0x65,0x72,0x20,0x5f,0x31,0x36,0x30,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,
+    0x74,0x65,0x72,0x28,0x74,0x39,0x29,0x3b,0x0a,0x63,0x62,0x75,0x66,0x66,0x65,0x72,
+    0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,
+    0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x31,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x35,0x34,0x31,0x5f,0x62,0x61,0x73,0x65,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x20,0x3a,0x20,
+    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x35,0x34,0x31,0x5f,0x6d,
+    0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x20,0x3a,
+    0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x35,0x34,0x31,0x5f,
+    0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,
+    0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,
+    0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x5f,0x35,0x34,0x31,0x5f,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x66,0x61,
+    0x63,0x74,0x6f,0x72,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x5f,0x35,0x34,0x31,0x5f,0x70,0x61,0x64,0x30,0x20,0x3a,0x20,0x70,0x61,0x63,
+    0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x32,0x2e,0x77,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x35,0x34,0x31,0x5f,0x63,
+    0x61,0x6d,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x63,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x35,0x34,0x31,0x5f,0x70,0x61,0x64,0x31,0x20,0x3a,0x20,0x70,
+    0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x33,0x2e,0x77,0x29,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x42,0x79,0x74,0x65,0x41,0x64,0x64,0x72,0x65,0x73,0x73,
+    0x42,0x75,0x66,0x66,0x65,0x72,0x20,0x5f,0x37,0x31,0x35,0x20,0x3a,0x20,0x72,0x65,
+    0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x38,0x29,0x3b,0x0a,0x42,0x79,0x74,0x65,
+    0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,0x75,0x66,0x66,0x65,0x72,0x20,0x5f,0x37,
+    0x32,0x30,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x31,
+    0x30,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x3e,0x20,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x5f,0x74,0x65,0x78,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,
+    0x74,0x30,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,
+    0x65,0x20,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x6d,0x70,
+    0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x30,0x29,0x3b,
+    0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x3e,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x72,0x6f,0x75,0x67,
+    0x68,0x6e,0x65,0x73,0x73,0x5f,0x74,0x65,0x78,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,
+    0x73,0x74,0x65,0x72,0x28,0x74,0x31,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,
+    0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x73,0x6d,0x70,0x20,0x3a,0x20,
+    0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x31,0x29,0x3b,0x0a,0x54,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,
+    0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x74,0x65,0x78,0x20,0x3a,0x20,
+    0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x33,0x29,0x3b,0x0a,0x53,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x6f,0x63,0x63,0x6c,0x75,
+    0x73,0x69,0x6f,0x6e,0x5f,0x73,0x6d,0x70,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,
+    0x74,0x65,0x72,0x28,0x73,0x33,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x65,0x6d,0x69,0x73,0x73,
+    0x69,0x76,0x65,0x5f,0x74,0x65,0x78,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,
+    0x65,0x72,0x28,0x74,0x34,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,
+    0x74,0x61,0x74,0x65,0x20,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x73,0x6d,
+    0x70,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x34,0x29,
+    0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x3e,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x74,0x65,0x78,0x20,0x3a,
+    0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x32,0x29,0x3b,0x0a,0x53,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x5f,0x73,0x6d,0x70,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,
+    0x72,0x28,0x73,0x32,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x43,0x75,
+    0x62,0x65,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x69,0x72,0x72,0x61,0x64,
+    0x69,0x61,0x6e,0x63,0x65,0x5f,0x6d,0x61,0x70,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,
+    0x73,0x74,0x65,0x72,0x28,0x74,0x35,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,
+    0x65,0x5f,0x73,0x6d,0x70,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,
+    0x28,0x73,0x35,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x43,0x75,0x62,
+    0x65,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x70,0x72,0x65,0x66,0x69,0x6c,
+    0x74,0x65,0x72,0x5f,0x6d,0x61,0x70,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,
+    0x65,0x72,0x28,0x74,0x36,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,
+    0x74,0x61,0x74,0x65,0x20,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,0x73,
+    0x6d,0x70,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x36,
+    0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x3e,0x20,0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,0x20,0x3a,0x20,
+    0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x37,0x29,0x3b,0x0a,0x53,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x62,0x72,0x64,0x66,0x5f,
+    0x6c,0x75,0x74,0x5f,0x73,0x6d,0x70,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,
+    0x65,0x72,0x28,0x73,0x37,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x6f,0x63,0x63,0x6c,
+    0x75,0x73,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,
+    0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6c,
+    0x69,0x70,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,
+    0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,
+    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,
+    0x65,0x6e,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x62,0x69,
+    0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x6f,0x63,
+    0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x76,0x5f,0x63,0x6c,0x69,0x70,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x36,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,
+    0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,
+    0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,
+    0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x53,0x56,0x5f,0x54,
+    0x61,0x72,0x67,0x65,0x74,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x44,0x5f,0x47,0x47,0x58,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,
+    0x6f,0x74,0x48,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,
+    0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x33,0x31,0x33,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,
+    0x73,0x73,0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x31,0x37,0x20,0x3d,
+    0x20,0x5f,0x33,0x31,0x33,0x20,0x2a,0x20,0x5f,0x33,0x31,0x33,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x32,0x37,0x20,0x3d,0x20,0x28,
+    0x28,0x4e,0x64,0x6f,0x74,0x48,0x20,0x2a,0x20,0x4e,0x64,0x6f,0x74,0x48,0x29,0x20,
+    0x2a,0x20,0x28,0x5f,0x33,0x31,0x37,0x20,0x2d,0x20,0x31,0x2e,0x30,0x66,0x29,0x29,
+    0x20,0x2b,0x20,0x31,0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x5f,0x33,0x31,0x37,0x20,0x2f,0x20,0x28,0x28,0x33,0x2e,0x31,
+    0x34,0x31,0x35,0x39,0x32,0x37,0x34,0x31,0x30,0x31,0x32,0x35,0x37,0x33,0x32,0x34,
+    0x32,0x31,0x38,0x37,0x35,0x66,0x20,0x2a,0x20,0x5f,0x33,0x32,0x37,0x29,0x20,0x2a,
+    0x20,0x5f,0x33,0x32,0x37,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x47,0x5f,0x53,0x6d,0x69,0x74,0x68,0x47,0x47,0x58,0x28,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x4e,0x64,0x6f,0x74,0x56,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,
+    0x64,0x6f,0x74,0x4c,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,
     0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x20,0x5f,0x31,0x35,0x37,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,
+    0x61,0x74,0x20,0x5f,0x33,0x34,0x30,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,
     0x65,0x73,0x73,0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x36,0x31,0x20,
-    0x3d,0x20,0x5f,0x31,0x35,0x37,0x20,0x2a,0x20,0x5f,0x31,0x35,0x37,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x36,0x38,0x20,0x3d,0x20,
-    0x31,0x2e,0x30,0x20,0x2d,0x20,0x5f,0x31,0x36,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x2e,0x35,0x20,0x2f,0x20,0x66,0x61,0x73,
-    0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x28,0x4e,0x64,0x6f,0x74,0x4c,0x20,0x2a,0x20,
-    0x73,0x71,0x72,0x74,0x28,0x28,0x28,0x4e,0x64,0x6f,0x74,0x56,0x20,0x2a,0x20,0x4e,
-    0x64,0x6f,0x74,0x56,0x29,0x20,0x2a,0x20,0x5f,0x31,0x36,0x38,0x29,0x20,0x2b,0x20,
-    0x5f,0x31,0x36,0x31,0x29,0x29,0x20,0x2b,0x20,0x28,0x4e,0x64,0x6f,0x74,0x56,0x20,
-    0x2a,0x20,0x73,0x71,0x72,0x74,0x28,0x28,0x28,0x4e,0x64,0x6f,0x74,0x4c,0x20,0x2a,
-    0x20,0x4e,0x64,0x6f,0x74,0x4c,0x29,0x20,0x2a,0x20,0x5f,0x31,0x36,0x38,0x29,0x20,
-    0x2b,0x20,0x5f,0x31,0x36,0x31,0x29,0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,
-    0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,0x35,0x35,
-    0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,0x35,0x29,
-    0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,
-    0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,
-    0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,
-    0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,
-    0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,
-    0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x75,0x29,0x0a,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x31,0x35,0x20,0x3d,
-    0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x31,0x2e,0x30,
-    0x20,0x2d,0x20,0x75,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x31,0x39,0x20,
-    0x3d,0x20,0x5f,0x31,0x31,0x35,0x20,0x2a,0x20,0x5f,0x31,0x31,0x35,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x5f,0x31,0x31,0x39,0x20,
-    0x2a,0x20,0x5f,0x31,0x31,0x39,0x29,0x20,0x2a,0x20,0x5f,0x31,0x31,0x35,0x3b,0x0a,
-    0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
-    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
-    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
-    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,
-    0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x26,0x20,0x56,0x64,0x6f,0x74,0x48,0x2c,0x20,0x74,0x68,0x72,0x65,
-    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,
-    0x20,0x46,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x56,0x64,0x6f,0x74,0x48,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x46,0x30,0x20,0x2b,0x20,
-    0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x2e,0x30,0x29,0x20,0x2d,0x20,
-    0x46,0x30,0x29,0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,
-    0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x3b,0x0a,0x7d,0x0a,
-    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,
-    0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,
-    0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,
-    0x6f,0x61,0x74,0x20,0x46,0x64,0x5f,0x44,0x69,0x73,0x6e,0x65,0x79,0x44,0x69,0x66,
-    0x66,0x75,0x73,0x65,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,
-    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x4e,0x64,0x6f,0x74,0x56,0x2c,0x20,
-    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x26,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,
-    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x4c,
-    0x64,0x6f,0x74,0x48,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
-    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,
-    0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x5f,0x32,0x34,0x30,0x20,0x3d,0x20,0x28,0x6d,0x69,0x78,0x28,0x30,0x2e,0x30,
-    0x2c,0x20,0x30,0x2e,0x35,0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
-    0x29,0x20,0x2b,0x20,0x28,0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x4c,0x64,0x6f,
-    0x74,0x48,0x29,0x20,0x2a,0x20,0x4c,0x64,0x6f,0x74,0x48,0x29,0x20,0x2a,0x20,0x72,
-    0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x29,0x20,0x2d,0x20,0x31,0x2e,0x30,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x4e,
-    0x64,0x6f,0x74,0x4c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
-    0x20,0x28,0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,0x5f,0x32,0x34,0x30,0x20,0x2a,
-    0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,
-    0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x29,0x20,0x2a,0x20,0x28,0x31,0x2e,0x30,0x20,
-    0x2b,0x20,0x28,0x5f,0x32,0x34,0x30,0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,
-    0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
-    0x29,0x29,0x29,0x29,0x20,0x2a,0x20,0x6d,0x69,0x78,0x28,0x31,0x2e,0x30,0x2c,0x20,
-    0x30,0x2e,0x36,0x36,0x32,0x32,0x35,0x31,0x36,0x35,0x31,0x32,0x38,0x37,0x30,0x37,
-    0x38,0x38,0x35,0x37,0x34,0x32,0x31,0x38,0x37,0x35,0x2c,0x20,0x72,0x6f,0x75,0x67,
-    0x68,0x6e,0x65,0x73,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,
-    0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,
-    0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,
-    0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x46,
-    0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,
-    0x73,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x26,0x20,0x4e,0x64,0x6f,0x74,0x56,0x2c,0x20,0x74,0x68,0x72,
-    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
-    0x26,0x20,0x46,0x30,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
-    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,
-    0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x46,0x30,0x20,0x2b,0x20,
-    0x28,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,
-    0x73,0x73,0x29,0x2c,0x20,0x46,0x30,0x29,0x20,0x2d,0x20,0x46,0x30,0x29,0x20,0x2a,
-    0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,
-    0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,
-    0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,
-    0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,
-    0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
-    0x41,0x43,0x45,0x53,0x46,0x69,0x6c,0x6d,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
-    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x78,0x29,
-    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x61,
-    0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x78,0x20,0x2a,0x20,0x28,
-    0x28,0x78,0x20,0x2a,0x20,0x32,0x2e,0x35,0x30,0x39,0x39,0x39,0x39,0x39,0x39,0x30,
-    0x34,0x36,0x33,0x32,0x35,0x36,0x38,0x33,0x35,0x39,0x33,0x37,0x35,0x29,0x20,0x2b,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x30,0x32,0x39,0x39,0x39,0x39,
-    0x39,0x39,0x39,0x33,0x32,0x39,0x34,0x34,0x37,0x37,0x34,0x36,0x32,0x37,0x36,0x38,
-    0x35,0x35,0x34,0x36,0x38,0x37,0x35,0x29,0x29,0x29,0x20,0x2f,0x20,0x28,0x28,0x78,
-    0x20,0x2a,0x20,0x28,0x28,0x78,0x20,0x2a,0x20,0x32,0x2e,0x34,0x33,0x30,0x30,0x30,
-    0x30,0x30,0x36,0x36,0x37,0x35,0x37,0x32,0x30,0x32,0x31,0x34,0x38,0x34,0x33,0x37,
-    0x35,0x29,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x35,0x38,
-    0x39,0x39,0x39,0x39,0x39,0x37,0x33,0x37,0x37,0x33,0x39,0x35,0x36,0x32,0x39,0x38,
-    0x38,0x32,0x38,0x31,0x32,0x35,0x29,0x29,0x29,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x28,0x30,0x2e,0x31,0x34,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x35,0x39,
-    0x36,0x30,0x34,0x36,0x34,0x34,0x37,0x37,0x35,0x33,0x39,0x30,0x36,0x32,0x35,0x29,
-    0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x30,0x29,0x2c,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x7d,0x0a,
-    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,
-    0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,
-    0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,
-    0x6f,0x61,0x74,0x33,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x54,0x6f,0x53,0x52,0x47,
-    0x42,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x69,0x78,0x28,0x63,0x20,0x2a,0x20,0x31,
-    0x32,0x2e,0x39,0x32,0x30,0x30,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,0x39,0x34,
-    0x35,0x33,0x31,0x32,0x35,0x2c,0x20,0x28,0x70,0x6f,0x77,0x72,0x28,0x66,0x61,0x73,
-    0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x63,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
-    0x28,0x30,0x2e,0x30,0x29,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,
-    0x2e,0x34,0x31,0x36,0x36,0x36,0x36,0x36,0x35,0x36,0x37,0x33,0x32,0x35,0x35,0x39,
-    0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x29,0x29,0x20,0x2a,0x20,0x31,
-    0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x34,0x37,0x35,0x34,0x37,0x39,0x31,0x32,
-    0x35,0x39,0x37,0x36,0x35,0x36,0x32,0x35,0x29,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x28,0x30,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x30,
-    0x31,0x39,0x37,0x36,0x37,0x37,0x36,0x31,0x32,0x33,0x30,0x34,0x36,0x38,0x37,0x35,
-    0x29,0x2c,0x20,0x73,0x74,0x65,0x70,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,
-    0x2e,0x30,0x30,0x33,0x31,0x33,0x30,0x38,0x30,0x30,0x30,0x39,0x30,0x37,0x33,0x30,
-    0x31,0x39,0x30,0x32,0x37,0x37,0x30,0x39,0x39,0x36,0x30,0x39,0x33,0x37,0x35,0x29,
-    0x2c,0x20,0x63,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,
-    0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,
-    0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,
-    0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,
-    0x73,0x74,0x61,0x6e,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,
-    0x20,0x5f,0x32,0x38,0x31,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,
-    0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,
-    0x6c,0x6f,0x61,0x74,0x3e,0x20,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
-    0x5f,0x74,0x65,0x78,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,
-    0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,
-    0x6c,0x6f,0x61,0x74,0x3e,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x72,
-    0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x74,0x65,0x78,0x20,0x5b,0x5b,0x74,
-    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,
-    0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x6e,0x6f,
-    0x72,0x6d,0x61,0x6c,0x5f,0x74,0x65,0x78,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,
-    0x72,0x65,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
-    0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,
-    0x69,0x6f,0x6e,0x5f,0x74,0x65,0x78,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,
-    0x65,0x28,0x33,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,
-    0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,
-    0x65,0x5f,0x74,0x65,0x78,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,
-    0x34,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x63,0x75,0x62,
-    0x65,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x69,0x72,0x72,0x61,0x64,0x69,0x61,
-    0x6e,0x63,0x65,0x5f,0x6d,0x61,0x70,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,
-    0x65,0x28,0x35,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x63,
-    0x75,0x62,0x65,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x70,0x72,0x65,0x66,0x69,
-    0x6c,0x74,0x65,0x72,0x5f,0x6d,0x61,0x70,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,
-    0x72,0x65,0x28,0x36,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
-    0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x62,0x72,0x64,0x66,0x5f,0x6c,
-    0x75,0x74,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x37,0x29,0x5d,
-    0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x62,0x61,0x73,0x65,0x5f,
-    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,
-    0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
-    0x72,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x72,0x6f,0x75,0x67,0x68,
-    0x6e,0x65,0x73,0x73,0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,
-    0x65,0x72,0x28,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
-    0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,0x73,0x61,
-    0x6d,0x70,0x6c,0x65,0x72,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,
-    0x6c,0x65,0x72,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x73,0x6d,
-    0x70,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x33,0x29,0x5d,0x5d,
-    0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x65,0x6d,0x69,0x73,0x73,0x69,
-    0x76,0x65,0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
-    0x28,0x34,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x69,
-    0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,
-    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x35,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,
-    0x6d,0x70,0x6c,0x65,0x72,0x20,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,
-    0x73,0x6d,0x70,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x36,0x29,
-    0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x62,0x72,0x64,0x66,
-    0x5f,0x6c,0x75,0x74,0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,
-    0x65,0x72,0x28,0x37,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,
-    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,
-    0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,
-    0x38,0x37,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,
-    0x74,0x65,0x78,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x62,0x61,0x73,0x65,0x5f,
-    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,
-    0x75,0x76,0x29,0x20,0x2a,0x20,0x5f,0x32,0x38,0x31,0x2e,0x62,0x61,0x73,0x65,0x5f,
-    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,0x39,0x35,0x20,0x3d,0x20,
-    0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,
-    0x73,0x73,0x5f,0x74,0x65,0x78,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x6d,0x65,
-    0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
-    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x30,0x36,0x20,0x3d,
-    0x20,0x5f,0x32,0x39,0x35,0x2e,0x7a,0x20,0x2a,0x20,0x5f,0x32,0x38,0x31,0x2e,0x6d,
-    0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x31,0x36,0x20,0x3d,
-    0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x5f,0x32,0x39,
-    0x35,0x2e,0x79,0x20,0x2a,0x20,0x5f,0x32,0x38,0x31,0x2e,0x72,0x6f,0x75,0x67,0x68,
-    0x6e,0x65,0x73,0x73,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x2c,0x20,0x30,0x2e,0x30,
-    0x33,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x31,0x30,0x35,0x39,0x33,0x30,0x33,0x32,
-    0x38,0x33,0x36,0x39,0x31,0x34,0x30,0x36,0x32,0x35,0x2c,0x20,0x31,0x2e,0x30,0x29,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x33,0x38,
-    0x31,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
-    0x69,0x7a,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x78,0x33,0x28,0x69,0x6e,0x2e,
-    0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,
-    0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,
-    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x20,0x2a,0x20,0x28,0x28,0x6e,0x6f,0x72,0x6d,
-    0x61,0x6c,0x5f,0x74,0x65,0x78,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x6e,0x6f,
-    0x72,0x6d,0x61,0x6c,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,
-    0x76,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,0x20,0x2d,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x2e,0x30,0x29,0x29,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x33,0x38,0x39,0x20,0x3d,
-    0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,
-    0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x32,0x38,0x31,0x2e,0x63,0x61,0x6d,
-    0x5f,0x70,0x6f,0x73,0x29,0x20,0x2d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x77,0x6f,0x72,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x34,0x34,0x20,
+    0x3d,0x20,0x5f,0x33,0x34,0x30,0x20,0x2a,0x20,0x5f,0x33,0x34,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x35,0x31,0x20,0x3d,0x20,
+    0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,0x5f,0x33,0x34,0x34,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x2e,0x35,0x66,0x20,0x2f,0x20,0x6d,
+    0x61,0x78,0x28,0x28,0x4e,0x64,0x6f,0x74,0x4c,0x20,0x2a,0x20,0x73,0x71,0x72,0x74,
+    0x28,0x28,0x28,0x4e,0x64,0x6f,0x74,0x56,0x20,0x2a,0x20,0x4e,0x64,0x6f,0x74,0x56,
+    0x29,0x20,0x2a,0x20,0x5f,0x33,0x35,0x31,0x29,0x20,0x2b,0x20,0x5f,0x33,0x34,0x34,
+    0x29,0x29,0x20,0x2b,0x20,0x28,0x4e,0x64,0x6f,0x74,0x56,0x20,0x2a,0x20,0x73,0x71,
+    0x72,0x74,0x28,0x28,0x28,0x4e,0x64,0x6f,0x74,0x4c,0x20,0x2a,0x20,0x4e,0x64,0x6f,
+    0x74,0x4c,0x29,0x20,0x2a,0x20,0x5f,0x33,0x35,0x31,0x29,0x20,0x2b,0x20,0x5f,0x33,
+    0x34,0x34,0x29,0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x34,
+    0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,0x35,0x35,0x31,0x34,0x35,0x32,
+    0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,0x35,0x66,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,
+    0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x75,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x39,0x38,
+    0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,
+    0x75,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x30,0x32,0x20,0x3d,
+    0x20,0x5f,0x32,0x39,0x38,0x20,0x2a,0x20,0x5f,0x32,0x39,0x38,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x5f,0x33,0x30,0x32,0x20,0x2a,
+    0x20,0x5f,0x33,0x30,0x32,0x29,0x20,0x2a,0x20,0x5f,0x32,0x39,0x38,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,
+    0x63,0x6b,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x56,0x64,0x6f,0x74,0x48,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x46,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x56,
+    0x64,0x6f,0x74,0x48,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x46,0x30,0x20,0x2b,0x20,0x28,0x28,0x31,0x2e,0x30,0x66,0x2e,0x78,0x78,0x78,
+    0x20,0x2d,0x20,0x46,0x30,0x29,0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,
+    0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x46,0x64,0x5f,0x44,0x69,0x73,
+    0x6e,0x65,0x79,0x44,0x69,0x66,0x66,0x75,0x73,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x4e,0x64,0x6f,0x74,0x56,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,
+    0x6f,0x74,0x4c,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4c,0x64,0x6f,0x74,0x48,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,
+    0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x34,0x32,0x32,0x20,0x3d,0x20,0x28,0x6c,0x65,0x72,0x70,0x28,0x30,0x2e,0x30,0x66,
+    0x2c,0x20,0x30,0x2e,0x35,0x66,0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,
+    0x73,0x29,0x20,0x2b,0x20,0x28,0x28,0x28,0x32,0x2e,0x30,0x66,0x20,0x2a,0x20,0x4c,
+    0x64,0x6f,0x74,0x48,0x29,0x20,0x2a,0x20,0x4c,0x64,0x6f,0x74,0x48,0x29,0x20,0x2a,
+    0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x29,0x20,0x2d,0x20,0x31,
+    0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,
+    0x3d,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x28,0x28,0x31,0x2e,0x30,0x66,0x20,0x2b,0x20,0x28,0x5f,0x34,
+    0x32,0x32,0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,
+    0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x29,0x20,0x2a,0x20,0x28,
+    0x31,0x2e,0x30,0x66,0x20,0x2b,0x20,0x28,0x5f,0x34,0x32,0x32,0x20,0x2a,0x20,0x53,
+    0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x29,0x29,0x29,0x29,0x20,0x2a,0x20,0x6c,0x65,0x72,0x70,
+    0x28,0x31,0x2e,0x30,0x66,0x2c,0x20,0x30,0x2e,0x36,0x36,0x32,0x32,0x35,0x31,0x36,
+    0x35,0x31,0x32,0x38,0x37,0x30,0x37,0x38,0x38,0x35,0x37,0x34,0x32,0x31,0x38,0x37,
+    0x35,0x66,0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x64,0x69,0x72,0x65,0x63,0x74,
+    0x4c,0x69,0x67,0x68,0x74,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x4e,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x56,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x4c,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x46,0x30,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,
+    0x6f,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,
+    0x69,0x63,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,
+    0x65,0x73,0x73,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x56,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,
+    0x34,0x34,0x37,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,
+    0x56,0x20,0x2b,0x20,0x4c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x34,0x35,0x32,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,
+    0x28,0x4e,0x2c,0x20,0x4c,0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,
+    0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,0x35,0x35,0x31,0x34,
+    0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,0x35,0x66,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x4e,0x2c,0x20,0x5f,0x34,
+    0x34,0x37,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,
+    0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x4e,
+    0x64,0x6f,0x74,0x56,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x5f,0x34,0x35,0x32,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x34,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,
+    0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x56,0x2c,0x20,0x5f,0x34,
+    0x34,0x37,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,
+    0x20,0x46,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x5f,0x34,0x38,0x37,0x20,0x3d,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x36,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,
+    0x20,0x3d,0x20,0x5f,0x34,0x35,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,0x6d,0x61,0x78,
+    0x28,0x64,0x6f,0x74,0x28,0x4c,0x2c,0x20,0x5f,0x34,0x34,0x37,0x29,0x2c,0x20,0x30,
+    0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,
+    0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x28,0x28,0x28,0x28,0x31,0x2e,0x30,0x66,0x2e,0x78,0x78,0x78,0x20,0x2d,0x20,
+    0x5f,0x34,0x38,0x37,0x29,0x20,0x2a,0x20,0x28,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x29,0x29,0x20,0x2a,0x20,0x28,0x64,0x69,
+    0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x46,0x64,0x5f,
+    0x44,0x69,0x73,0x6e,0x65,0x79,0x44,0x69,0x66,0x66,0x75,0x73,0x65,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x37,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x2c,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x30,0x29,0x29,0x29,0x20,0x2b,0x20,0x28,0x5f,0x34,0x38,0x37,0x20,0x2a,0x20,0x28,
+    0x44,0x5f,0x47,0x47,0x58,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x29,0x20,0x2a,0x20,0x47,0x5f,0x53,0x6d,0x69,0x74,0x68,0x47,
+    0x47,0x58,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x29,0x29,0x29,0x29,
+    0x20,0x2a,0x20,0x5f,0x34,0x35,0x32,0x3b,0x0a,0x7d,0x0a,0x0a,0x75,0x69,0x6e,0x74,
+    0x32,0x20,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x4c,0x69,0x67,0x68,0x74,0x52,0x61,
+    0x6e,0x67,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6c,0x69,0x70,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x33,0x20,0x5f,0x31,0x33,0x33,
+    0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x69,0x6e,0x74,0x33,0x28,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x28,0x28,0x28,0x28,0x63,0x6c,0x69,0x70,0x2e,0x78,0x79,0x20,
+    0x2f,0x20,0x63,0x6c,0x69,0x70,0x2e,0x77,0x2e,0x78,0x78,0x29,0x20,0x2a,0x20,0x30,
+    0x2e,0x35,0x66,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,0x66,0x2e,0x78,0x78,0x29,0x20,
+    0x2a,0x20,0x5f,0x39,0x33,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x67,0x72,
+    0x69,0x64,0x2e,0x78,0x79,0x2c,0x20,0x28,0x6c,0x6f,0x67,0x28,0x6d,0x61,0x78,0x28,
+    0x63,0x6c,0x69,0x70,0x2e,0x77,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,
+    0x39,0x37,0x34,0x37,0x35,0x32,0x34,0x32,0x37,0x30,0x37,0x38,0x37,0x38,0x33,0x35,
+    0x31,0x32,0x31,0x31,0x35,0x34,0x37,0x38,0x35,0x65,0x2d,0x30,0x37,0x66,0x29,0x29,
+    0x20,0x2a,0x20,0x5f,0x39,0x33,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x64,
+    0x65,0x70,0x74,0x68,0x2e,0x78,0x29,0x20,0x2b,0x20,0x5f,0x39,0x33,0x5f,0x63,0x6c,
+    0x75,0x73,0x74,0x65,0x72,0x5f,0x64,0x65,0x70,0x74,0x68,0x2e,0x79,0x29,0x29,0x2c,
+    0x20,0x69,0x6e,0x74,0x33,0x28,0x30,0x2c,0x20,0x30,0x2c,0x20,0x30,0x29,0x2c,0x20,
+    0x69,0x6e,0x74,0x33,0x28,0x5f,0x39,0x33,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,
+    0x5f,0x67,0x72,0x69,0x64,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2d,0x20,0x69,0x6e,0x74,
+    0x33,0x28,0x31,0x2c,0x20,0x31,0x2c,0x20,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x20,0x5f,
+    0x31,0x36,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x36,0x34,0x2e,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x5f,0x31,0x36,0x30,0x2e,0x4c,0x6f,0x61,0x64,
+    0x28,0x28,0x28,0x28,0x28,0x5f,0x31,0x33,0x33,0x2e,0x7a,0x20,0x2a,0x20,0x69,0x6e,
+    0x74,0x28,0x5f,0x39,0x33,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x67,0x72,
+    0x69,0x64,0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x5f,0x31,0x33,0x33,0x2e,0x79,0x29,
+    0x20,0x2a,0x20,0x69,0x6e,0x74,0x28,0x5f,0x39,0x33,0x5f,0x63,0x6c,0x75,0x73,0x74,
+    0x65,0x72,0x5f,0x67,0x72,0x69,0x64,0x2e,0x78,0x29,0x29,0x20,0x2b,0x20,0x5f,0x31,
+    0x33,0x33,0x2e,0x78,0x29,0x20,0x2a,0x20,0x38,0x20,0x2b,0x20,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x5f,0x31,0x36,0x34,0x2e,0x63,0x6f,0x75,0x6e,0x74,0x20,0x3d,
+    0x20,0x5f,0x31,0x36,0x30,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x28,0x28,0x28,0x28,0x5f,
+    0x31,0x33,0x33,0x2e,0x7a,0x20,0x2a,0x20,0x69,0x6e,0x74,0x28,0x5f,0x39,0x33,0x5f,
+    0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x67,0x72,0x69,0x64,0x2e,0x79,0x29,0x29,
+    0x20,0x2b,0x20,0x5f,0x31,0x33,0x33,0x2e,0x79,0x29,0x20,0x2a,0x20,0x69,0x6e,0x74,
+    0x28,0x5f,0x39,0x33,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x67,0x72,0x69,
+    0x64,0x2e,0x78,0x29,0x29,0x20,0x2b,0x20,0x5f,0x31,0x33,0x33,0x2e,0x78,0x29,0x20,
+    0x2a,0x20,0x38,0x20,0x2b,0x20,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x75,0x69,0x6e,0x74,0x32,0x28,0x5f,0x31,0x36,0x34,0x2e,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x5f,0x31,0x36,0x34,0x2e,0x63,0x6f,0x75,
+    0x6e,0x74,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x75,
+    0x6e,0x63,0x74,0x75,0x61,0x6c,0x41,0x74,0x74,0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,
+    0x6e,0x28,0x70,0x75,0x6e,0x63,0x74,0x75,0x61,0x6c,0x5f,0x6c,0x69,0x67,0x68,0x74,
+    0x20,0x6c,0x69,0x67,0x68,0x74,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x77,
+    0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x6f,0x75,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x4c,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x38,0x32,0x20,0x3d,0x20,0x6c,0x69,
+    0x67,0x68,0x74,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x72,0x61,0x6e,
+    0x67,0x65,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,
+    0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,
+    0x38,0x38,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x5f,0x31,0x38,
+    0x32,0x2c,0x20,0x5f,0x31,0x38,0x32,0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,
+    0x39,0x39,0x39,0x33,0x39,0x32,0x32,0x35,0x32,0x39,0x30,0x32,0x39,0x30,0x37,0x37,
+    0x38,0x35,0x30,0x32,0x38,0x32,0x31,0x39,0x32,0x32,0x33,0x65,0x2d,0x30,0x39,0x66,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x4c,0x20,0x3d,0x20,0x5f,0x31,0x38,0x32,0x20,
+    0x2a,0x20,0x72,0x73,0x71,0x72,0x74,0x28,0x5f,0x31,0x38,0x38,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x30,0x30,0x20,0x3d,0x20,
+    0x5f,0x31,0x38,0x38,0x20,0x2f,0x20,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x72,0x61,0x6e,0x67,0x65,0x2e,0x77,0x20,0x2a,
+    0x20,0x6c,0x69,0x67,0x68,0x74,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,
+    0x72,0x61,0x6e,0x67,0x65,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x32,0x30,0x38,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,
+    0x28,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,0x28,0x5f,0x32,0x30,0x30,0x20,0x2a,0x20,
+    0x5f,0x32,0x30,0x30,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,
+    0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,
+    0x32,0x33,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x64,0x6f,0x74,0x28,
+    0x6c,0x69,0x67,0x68,0x74,0x2e,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x5f,
+    0x73,0x70,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x2e,0x78,0x79,0x7a,0x2c,
+    0x20,0x2d,0x4c,0x29,0x20,0x2a,0x20,0x6c,0x69,0x67,0x68,0x74,0x2e,0x63,0x6f,0x6c,
+    0x6f,0x72,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x73,0x63,0x61,0x6c,0x65,0x2e,0x77,0x29,
+    0x20,0x2b,0x20,0x6c,0x69,0x67,0x68,0x74,0x2e,0x64,0x69,0x72,0x65,0x63,0x74,0x69,
+    0x6f,0x6e,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x2e,0x77,
+    0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x28,0x28,0x5f,0x32,0x30,
+    0x38,0x20,0x2a,0x20,0x5f,0x32,0x30,0x38,0x29,0x20,0x2a,0x20,0x5f,0x32,0x32,0x33,
+    0x29,0x20,0x2a,0x20,0x5f,0x32,0x32,0x33,0x29,0x20,0x2f,0x20,0x5f,0x31,0x38,0x38,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x46,0x5f,0x53,0x63,
+    0x68,0x6c,0x69,0x63,0x6b,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x28,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x56,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x46,0x30,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,
+    0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,
+    0x56,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x46,0x30,
+    0x20,0x2b,0x20,0x28,0x28,0x6d,0x61,0x78,0x28,0x28,0x31,0x2e,0x30,0x66,0x20,0x2d,
+    0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x2e,0x78,0x78,0x78,0x2c,
+    0x20,0x46,0x30,0x29,0x20,0x2d,0x20,0x46,0x30,0x29,0x20,0x2a,0x20,0x53,0x63,0x68,
+    0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x41,
+    0x43,0x45,0x53,0x46,0x69,0x6c,0x6d,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x78,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,
+    0x6c,0x61,0x6d,0x70,0x28,0x28,0x78,0x20,0x2a,0x20,0x28,0x28,0x78,0x20,0x2a,0x20,
+    0x32,0x2e,0x35,0x30,0x39,0x39,0x39,0x39,0x39,0x39,0x30,0x34,0x36,0x33,0x32,0x35,
+    0x36,0x38,0x33,0x35,0x39,0x33,0x37,0x35,0x66,0x29,0x20,0x2b,0x20,0x30,0x2e,0x30,
+    0x32,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x33,0x32,0x39,0x34,0x34,0x37,0x37,0x34,
+    0x36,0x32,0x37,0x36,0x38,0x35,0x35,0x34,0x36,0x38,0x37,0x35,0x66,0x2e,0x78,0x78,
+    0x78,0x29,0x29,0x20,0x2f,0x20,0x28,0x28,0x78,0x20,0x2a,0x20,0x28,0x28,0x78,0x20,
+    0x2a,0x20,0x32,0x2e,0x34,0x33,0x30,0x30,0x30,0x30,0x30,0x36,0x36,0x37,0x35,0x37,
+    0x32,0x30,0x32,0x31,0x34,0x38,0x34,0x33,0x37,0x35,0x66,0x29,0x20,0x2b,0x20,0x30,
+    0x2e,0x35,0x38,0x39,0x39,0x39,0x39,0x39,0x37,0x33,0x37,0x37,0x33,0x39,0x35,0x36,
+    0x32,0x39,0x38,0x38,0x32,0x38,0x31,0x32,0x35,0x66,0x2e,0x78,0x78,0x78,0x29,0x29,
+    0x20,0x2b,0x20,0x30,0x2e,0x31,0x34,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x35,0x39,
+    0x36,0x30,0x34,0x36,0x34,0x34,0x37,0x37,0x35,0x33,0x39,0x30,0x36,0x32,0x35,0x66,
+    0x2e,0x78,0x78,0x78,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2e,0x78,0x78,0x78,0x2c,
+    0x20,0x31,0x2e,0x30,0x66,0x2e,0x78,0x78,0x78,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x54,0x6f,0x53,0x52,
+    0x47,0x42,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6c,0x65,0x72,0x70,0x28,0x63,
+    0x20,0x2a,0x20,0x31,0x32,0x2e,0x39,0x32,0x30,0x30,0x30,0x30,0x30,0x37,0x36,0x32,
+    0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x66,0x2c,0x20,0x28,0x70,0x6f,0x77,
+    0x28,0x6d,0x61,0x78,0x28,0x63,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2e,0x78,0x78,0x78,
+    0x29,0x2c,0x20,0x30,0x2e,0x34,0x31,0x36,0x36,0x36,0x36,0x36,0x35,0x36,0x37,0x33,
+    0x32,0x35,0x35,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x66,0x2e,
+    0x78,0x78,0x78,0x29,0x20,0x2a,0x20,0x31,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,
+    0x34,0x37,0x35,0x34,0x37,0x39,0x31,0x32,0x35,0x39,0x37,0x36,0x35,0x36,0x32,0x35,
+    0x66,0x29,0x20,0x2d,0x20,0x30,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x39,0x39,
+    0x37,0x30,0x31,0x39,0x37,0x36,0x37,0x37,0x36,0x31,0x32,0x33,0x30,0x34,0x36,0x38,
+    0x37,0x35,0x66,0x2e,0x78,0x78,0x78,0x2c,0x20,0x73,0x74,0x65,0x70,0x28,0x30,0x2e,
+    0x30,0x30,0x33,0x31,0x33,0x30,0x38,0x30,0x30,0x30,0x39,0x30,0x37,0x33,0x30,0x31,
+    0x39,0x30,0x32,0x37,0x37,0x30,0x39,0x39,0x36,0x30,0x39,0x33,0x37,0x35,0x66,0x2e,
+    0x78,0x78,0x78,0x2c,0x20,0x63,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,
+    0x64,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x35,0x34,0x34,0x20,
+    0x3d,0x20,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x74,0x65,0x78,
+    0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,
+    0x6f,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,0x20,0x2a,0x20,
+    0x5f,0x35,0x34,0x31,0x5f,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,
+    0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x5f,0x35,0x35,0x32,0x20,0x3d,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,
+    0x69,0x63,0x5f,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x74,0x65,0x78,
+    0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,
+    0x5f,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x73,0x6d,0x70,0x2c,0x20,
+    0x76,0x5f,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x5f,0x35,0x35,0x39,0x20,0x3d,0x20,0x5f,0x35,0x35,0x32,0x2e,0x7a,0x20,0x2a,
+    0x20,0x5f,0x35,0x34,0x31,0x5f,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x66,
+    0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x5f,0x35,0x36,0x37,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x5f,0x35,
+    0x35,0x32,0x2e,0x79,0x20,0x2a,0x20,0x5f,0x35,0x34,0x31,0x5f,0x72,0x6f,0x75,0x67,
+    0x68,0x6e,0x65,0x73,0x73,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x2c,0x20,0x30,0x2e,
+    0x30,0x33,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x31,0x30,0x35,0x39,0x33,0x30,0x33,
+    0x32,0x38,0x33,0x36,0x39,0x31,0x34,0x30,0x36,0x32,0x35,0x66,0x2c,0x20,0x31,0x2e,
+    0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x5f,0x36,0x33,0x35,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,
+    0x28,0x6d,0x75,0x6c,0x28,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x74,0x65,0x78,
+    0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x73,
+    0x6d,0x70,0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,
+    0x32,0x2e,0x30,0x66,0x29,0x20,0x2d,0x20,0x31,0x2e,0x30,0x66,0x2e,0x78,0x78,0x78,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x78,0x33,0x28,0x76,0x5f,0x74,0x61,0x6e,
+    0x67,0x65,0x6e,0x74,0x2c,0x20,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,
+    0x74,0x2c,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x36,0x34,0x33,0x20,
+    0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x5f,0x35,0x34,0x31,
+    0x5f,0x63,0x61,0x6d,0x5f,0x70,0x6f,0x73,0x20,0x2d,0x20,0x76,0x5f,0x77,0x6f,0x72,
     0x6c,0x64,0x5f,0x70,0x6f,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x20,0x5f,0x33,0x39,0x39,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,
-    0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x5f,0x33,0x38,0x31,0x2c,0x20,0x5f,0x33,
-    0x38,0x39,0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x34,0x37,
-    0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,0x35,0x35,0x31,0x34,0x35,0x32,0x36,
-    0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x30,0x33,0x20,0x3d,0x20,0x5f,
-    0x32,0x38,0x37,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x33,0x20,0x5f,0x34,0x30,0x36,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x66,
-    0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x30,0x33,0x39,0x39,0x39,0x39,0x39,0x39,
-    0x39,0x31,0x30,0x35,0x39,0x33,0x30,0x33,0x32,0x38,0x33,0x36,0x39,0x31,0x34,0x30,
-    0x36,0x32,0x35,0x29,0x2c,0x20,0x5f,0x34,0x30,0x33,0x2c,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x28,0x5f,0x33,0x30,0x36,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x31,0x31,0x20,0x3d,0x20,0x31,0x2e,0x30,0x20,
-    0x2d,0x20,0x5f,0x33,0x30,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x20,0x5f,0x34,0x31,0x32,0x20,0x3d,0x20,0x5f,0x34,0x30,0x33,0x20,0x2a,
-    0x20,0x5f,0x34,0x31,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x33,0x20,0x5f,0x34,0x32,0x30,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6e,
-    0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x5f,0x33,0x38,0x39,0x20,0x2b,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x35,0x37,0x37,0x33,0x35,0x30,0x32,
-    0x35,0x38,0x38,0x32,0x37,0x32,0x30,0x39,0x34,0x37,0x32,0x36,0x35,0x36,0x32,0x35,
-    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,
-    0x32,0x35,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x64,
-    0x6f,0x74,0x28,0x5f,0x33,0x38,0x31,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,
-    0x30,0x2e,0x35,0x37,0x37,0x33,0x35,0x30,0x32,0x35,0x38,0x38,0x32,0x37,0x32,0x30,
-    0x39,0x34,0x37,0x32,0x36,0x35,0x36,0x32,0x35,0x29,0x29,0x2c,0x20,0x39,0x2e,0x39,
-    0x39,0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,
-    0x35,0x35,0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,
-    0x30,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,
-    0x28,0x64,0x6f,0x74,0x28,0x5f,0x33,0x38,0x31,0x2c,0x20,0x5f,0x34,0x32,0x30,0x29,
-    0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x5f,0x33,0x31,0x36,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x32,0x20,0x3d,0x20,0x5f,0x33,0x39,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,
-    0x5f,0x34,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x5f,0x33,0x31,0x36,0x3b,0x0a,
+    0x61,0x74,0x20,0x5f,0x36,0x35,0x33,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,
+    0x74,0x28,0x5f,0x36,0x33,0x35,0x2c,0x20,0x5f,0x36,0x34,0x33,0x29,0x2c,0x20,0x39,
+    0x2e,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,
+    0x36,0x33,0x35,0x35,0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,
+    0x65,0x2d,0x30,0x35,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x5f,0x36,0x35,0x37,0x20,0x3d,0x20,0x5f,0x35,0x34,0x34,0x2e,0x78,
+    0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,
+    0x36,0x36,0x30,0x20,0x3d,0x20,0x6c,0x65,0x72,0x70,0x28,0x30,0x2e,0x30,0x33,0x39,
+    0x39,0x39,0x39,0x39,0x39,0x39,0x31,0x30,0x35,0x39,0x33,0x30,0x33,0x32,0x38,0x33,
+    0x36,0x39,0x31,0x34,0x30,0x36,0x32,0x35,0x66,0x2e,0x78,0x78,0x78,0x2c,0x20,0x5f,
+    0x36,0x35,0x37,0x2c,0x20,0x5f,0x35,0x35,0x39,0x2e,0x78,0x78,0x78,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x36,0x36,0x35,0x20,0x3d,
+    0x20,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,0x5f,0x35,0x35,0x39,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x36,0x36,0x36,0x20,0x3d,0x20,
+    0x5f,0x36,0x35,0x37,0x20,0x2a,0x20,0x5f,0x36,0x36,0x35,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,
+    0x5f,0x36,0x33,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x5f,0x36,0x34,0x33,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x32,0x20,0x3d,0x20,0x30,0x2e,0x35,0x37,0x37,0x33,0x35,0x30,0x32,0x35,
+    0x38,0x38,0x32,0x37,0x32,0x30,0x39,0x34,0x37,0x32,0x36,0x35,0x36,0x32,0x35,0x66,
+    0x2e,0x78,0x78,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x5f,0x36,0x36,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x34,0x20,0x3d,0x20,0x5f,0x36,0x36,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,
+    0x5f,0x35,0x35,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x5f,0x35,0x36,0x37,0x3b,0x0a,
     0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x35,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x64,0x6f,
-    0x74,0x28,0x5f,0x33,0x38,0x39,0x2c,0x20,0x5f,0x34,0x32,0x30,0x29,0x2c,0x20,0x30,
-    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x5f,0x34,0x30,0x36,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x36,0x30,0x20,
-    0x3d,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x28,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,
-    0x20,0x3d,0x20,0x5f,0x33,0x39,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x20,0x3d,0x20,0x5f,0x34,0x32,
-    0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,
-    0x28,0x64,0x6f,0x74,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x35,0x37,
-    0x37,0x33,0x35,0x30,0x32,0x35,0x38,0x38,0x32,0x37,0x32,0x30,0x39,0x34,0x37,0x32,
-    0x36,0x35,0x36,0x32,0x35,0x29,0x2c,0x20,0x5f,0x34,0x32,0x30,0x29,0x2c,0x20,0x30,
-    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x20,0x3d,0x20,0x5f,0x33,0x31,0x36,0x3b,0x0a,
+    0x37,0x20,0x3d,0x20,0x5f,0x36,0x35,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x4c,0x6f,0x20,0x3d,0x20,0x64,0x69,0x72,0x65,0x63,0x74,
+    0x4c,0x69,0x67,0x68,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x20,
+    0x3d,0x20,0x76,0x5f,0x63,0x6c,0x69,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x32,0x20,0x5f,0x36,0x39,0x38,0x20,0x3d,0x20,0x63,0x6c,0x75,0x73,0x74,
+    0x65,0x72,0x4c,0x69,0x67,0x68,0x74,0x52,0x61,0x6e,0x67,0x65,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6f,0x72,0x20,0x28,0x75,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x75,
+    0x3b,0x20,0x69,0x20,0x3c,0x20,0x5f,0x36,0x39,0x38,0x2e,0x79,0x3b,0x20,0x69,0x2b,
+    0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x70,0x75,0x6e,0x63,0x74,0x75,0x61,0x6c,0x5f,0x6c,0x69,0x67,0x68,0x74,0x20,
+    0x5f,0x37,0x33,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x37,
+    0x33,0x30,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x72,0x61,0x6e,0x67,
+    0x65,0x20,0x3d,0x20,0x61,0x73,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x37,0x31,0x35,
+    0x2e,0x4c,0x6f,0x61,0x64,0x34,0x28,0x5f,0x37,0x32,0x30,0x2e,0x4c,0x6f,0x61,0x64,
+    0x28,0x28,0x5f,0x36,0x39,0x38,0x2e,0x78,0x20,0x2b,0x20,0x69,0x29,0x20,0x2a,0x20,
+    0x34,0x20,0x2b,0x20,0x30,0x29,0x20,0x2a,0x20,0x34,0x38,0x20,0x2b,0x20,0x30,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x37,0x33,0x30,0x2e,
+    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x73,0x63,0x61,0x6c,0x65,
+    0x20,0x3d,0x20,0x61,0x73,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x37,0x31,0x35,0x2e,
+    0x4c,0x6f,0x61,0x64,0x34,0x28,0x5f,0x37,0x32,0x30,0x2e,0x4c,0x6f,0x61,0x64,0x28,
+    0x28,0x5f,0x36,0x39,0x38,0x2e,0x78,0x20,0x2b,0x20,0x69,0x29,0x20,0x2a,0x20,0x34,
+    0x20,0x2b,0x20,0x30,0x29,0x20,0x2a,0x20,0x34,0x38,0x20,0x2b,0x20,0x31,0x36,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x37,0x33,0x30,0x2e,
+    0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x61,0x73,0x66,0x6c,0x6f,0x61,0x74,0x28,
+    0x5f,0x37,0x31,0x35,0x2e,0x4c,0x6f,0x61,0x64,0x34,0x28,0x5f,0x37,0x32,0x30,0x2e,
+    0x4c,0x6f,0x61,0x64,0x28,0x28,0x5f,0x36,0x39,0x38,0x2e,0x78,0x20,0x2b,0x20,0x69,
+    0x29,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x30,0x29,0x20,0x2a,0x20,0x34,0x38,0x20,
+    0x2b,0x20,0x33,0x32,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x70,0x75,0x6e,0x63,0x74,0x75,0x61,0x6c,0x5f,0x6c,0x69,0x67,0x68,0x74,0x20,0x5f,
+    0x38,0x38,0x30,0x20,0x3d,0x20,0x7b,0x20,0x5f,0x37,0x33,0x30,0x2e,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x5f,0x72,0x61,0x6e,0x67,0x65,0x2c,0x20,0x5f,0x37,0x33,
+    0x30,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x73,0x63,0x61,
+    0x6c,0x65,0x2c,0x20,0x5f,0x37,0x33,0x30,0x2e,0x64,0x69,0x72,0x65,0x63,0x74,0x69,
+    0x6f,0x6e,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x7d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x75,0x6e,0x63,0x74,0x75,
+    0x61,0x6c,0x5f,0x6c,0x69,0x67,0x68,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,
+    0x20,0x3d,0x20,0x5f,0x38,0x38,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,
+    0x20,0x3d,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x37,
+    0x34,0x34,0x20,0x3d,0x20,0x70,0x75,0x6e,0x63,0x74,0x75,0x61,0x6c,0x41,0x74,0x74,
+    0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x2c,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x5f,0x37,0x34,0x34,0x20,0x3e,0x20,0x30,0x2e,0x30,0x66,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x32,0x20,0x3d,0x20,0x5f,0x36,0x33,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x20,0x3d,0x20,0x5f,0x36,0x34,0x33,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x34,0x20,0x3d,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x35,0x20,0x3d,0x20,0x5f,0x36,0x36,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x36,0x20,0x3d,0x20,0x5f,0x36,0x36,0x36,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x37,0x20,0x3d,0x20,0x5f,
+    0x35,0x35,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x38,0x20,
+    0x3d,0x20,0x5f,0x35,0x36,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
     0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x31,0x31,0x20,0x3d,0x20,0x5f,0x33,0x39,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x20,0x3d,
-    0x20,0x5f,0x34,0x30,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x20,0x3d,0x20,0x5f,0x33,0x31,0x36,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x35,0x30,
-    0x37,0x20,0x3d,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x52,0x6f,0x75,
-    0x67,0x68,0x6e,0x65,0x73,0x73,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x2c,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x31,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
-    0x20,0x5f,0x35,0x35,0x35,0x20,0x3d,0x20,0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,
-    0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,
-    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x5f,0x33,0x39,
-    0x39,0x2c,0x20,0x5f,0x33,0x31,0x36,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x34,0x20,0x3d,
-    0x20,0x28,0x28,0x28,0x28,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x2e,
-    0x30,0x29,0x20,0x2d,0x20,0x5f,0x35,0x30,0x37,0x29,0x20,0x2a,0x20,0x5f,0x34,0x31,
-    0x31,0x29,0x20,0x2a,0x20,0x28,0x28,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,
-    0x65,0x5f,0x6d,0x61,0x70,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x72,0x72,
-    0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x5f,0x33,0x38,
-    0x31,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x5f,0x34,0x31,0x32,0x29,0x20,0x2a,
-    0x20,0x30,0x2e,0x33,0x30,0x30,0x30,0x30,0x30,0x30,0x31,0x31,0x39,0x32,0x30,0x39,
-    0x32,0x38,0x39,0x35,0x35,0x30,0x37,0x38,0x31,0x32,0x35,0x29,0x29,0x20,0x2b,0x20,
-    0x28,0x28,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,0x6d,0x61,0x70,0x2e,
-    0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,
-    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x5f,
-    0x33,0x38,0x39,0x2c,0x20,0x5f,0x33,0x38,0x31,0x29,0x2c,0x20,0x6c,0x65,0x76,0x65,
-    0x6c,0x28,0x5f,0x33,0x31,0x36,0x20,0x2a,0x20,0x34,0x2e,0x30,0x29,0x29,0x2e,0x78,
-    0x79,0x7a,0x20,0x2a,0x20,0x28,0x28,0x5f,0x35,0x30,0x37,0x20,0x2a,0x20,0x5f,0x35,
-    0x35,0x35,0x2e,0x78,0x29,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,
-    0x35,0x35,0x35,0x2e,0x79,0x29,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x29,0x29,
-    0x20,0x2a,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x74,0x65,0x78,
-    0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,
-    0x6e,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x29,0x2e,
-    0x78,0x29,0x20,0x2b,0x20,0x28,0x28,0x28,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,
-    0x28,0x31,0x2e,0x30,0x29,0x20,0x2d,0x20,0x5f,0x34,0x36,0x30,0x29,0x20,0x2a,0x20,
-    0x5f,0x34,0x31,0x31,0x29,0x20,0x2a,0x20,0x28,0x5f,0x34,0x31,0x32,0x20,0x2a,0x20,
-    0x46,0x64,0x5f,0x44,0x69,0x73,0x6e,0x65,0x79,0x44,0x69,0x66,0x66,0x75,0x73,0x65,
-    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x2c,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x31,0x30,0x29,0x29,0x29,0x20,0x2b,0x20,0x28,0x5f,0x34,0x36,0x30,0x20,
-    0x2a,0x20,0x28,0x44,0x5f,0x47,0x47,0x58,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x20,0x2a,0x20,0x47,0x5f,0x53,0x6d,0x69,
-    0x74,0x68,0x47,0x47,0x58,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x29,
-    0x29,0x29,0x29,0x20,0x2a,0x20,0x5f,0x34,0x32,0x35,0x29,0x29,0x20,0x2b,0x20,0x28,
-    0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x74,0x65,0x78,0x2e,0x73,0x61,0x6d,
-    0x70,0x6c,0x65,0x28,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x73,0x6d,0x70,
-    0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x32,0x38,0x31,0x2e,0x65,0x6d,0x69,
-    0x73,0x73,0x69,0x76,0x65,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x29,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x31,0x35,0x20,0x3d,0x20,0x41,0x43,0x45,0x53,0x46,0x69,0x6c,0x6d,0x28,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x31,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
-    0x74,0x2e,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x34,0x28,0x6c,0x69,0x6e,0x65,0x61,0x72,0x54,0x6f,0x53,0x52,
-    0x47,0x42,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x35,0x29,0x2c,0x20,0x5f,0x32,
-    0x38,0x37,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
-    0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x31,0x39,0x20,0x3d,0x20,0x5f,0x36,0x35,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x4c,0x6f,0x20,0x2b,0x3d,0x20,0x28,0x28,0x64,
+    0x69,0x72,0x65,0x63,0x74,0x4c,0x69,0x67,0x68,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x2c,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x35,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x36,0x2c,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x37,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x38,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x39,0x29,0x20,0x2a,0x20,0x5f,0x37,0x33,
+    0x30,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x73,0x63,0x61,
+    0x6c,0x65,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2a,0x20,0x5f,0x37,0x34,0x34,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x32,0x30,0x20,0x3d,0x20,0x5f,0x36,0x35,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x31,0x20,
+    0x3d,0x20,0x5f,0x36,0x36,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x32,0x20,0x3d,0x20,0x5f,0x35,0x36,
+    0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x37,
+    0x38,0x34,0x20,0x3d,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x52,0x6f,
+    0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x30,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x32,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x5f,0x38,0x33,0x31,0x20,0x3d,0x20,0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,
+    0x74,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,
+    0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x5f,0x36,
+    0x35,0x33,0x2c,0x20,0x5f,0x35,0x36,0x37,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x33,0x20,
+    0x3d,0x20,0x28,0x28,0x28,0x28,0x28,0x28,0x31,0x2e,0x30,0x66,0x2e,0x78,0x78,0x78,
+    0x20,0x2d,0x20,0x5f,0x37,0x38,0x34,0x29,0x20,0x2a,0x20,0x5f,0x36,0x36,0x35,0x29,
+    0x20,0x2a,0x20,0x28,0x28,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5f,
+    0x6d,0x61,0x70,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x72,0x72,0x61,0x64,
+    0x69,0x61,0x6e,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x5f,0x36,0x33,0x35,0x29,
+    0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x5f,0x36,0x36,0x36,0x29,0x20,0x2a,0x20,0x30,
+    0x2e,0x33,0x30,0x30,0x30,0x30,0x30,0x30,0x31,0x31,0x39,0x32,0x30,0x39,0x32,0x38,
+    0x39,0x35,0x35,0x30,0x37,0x38,0x31,0x32,0x35,0x66,0x29,0x29,0x20,0x2b,0x20,0x28,
+    0x28,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,0x6d,0x61,0x70,0x2e,0x53,
+    0x61,0x6d,0x70,0x6c,0x65,0x4c,0x65,0x76,0x65,0x6c,0x28,0x70,0x72,0x65,0x66,0x69,
+    0x6c,0x74,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,
+    0x74,0x28,0x2d,0x5f,0x36,0x34,0x33,0x2c,0x20,0x5f,0x36,0x33,0x35,0x29,0x2c,0x20,
+    0x5f,0x35,0x36,0x37,0x20,0x2a,0x20,0x34,0x2e,0x30,0x66,0x29,0x2e,0x78,0x79,0x7a,
+    0x20,0x2a,0x20,0x28,0x28,0x5f,0x37,0x38,0x34,0x20,0x2a,0x20,0x5f,0x38,0x33,0x31,
+    0x2e,0x78,0x29,0x20,0x2b,0x20,0x5f,0x38,0x33,0x31,0x2e,0x79,0x2e,0x78,0x78,0x78,
+    0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x66,0x29,0x29,0x20,0x2a,0x20,0x28,0x6f,
+    0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x74,0x65,0x78,0x2e,0x53,0x61,0x6d,
+    0x70,0x6c,0x65,0x28,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x73,0x6d,
+    0x70,0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,0x2e,0x78,0x20,0x2a,0x20,0x76,0x5f,0x6f,
+    0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x29,0x29,0x20,0x2b,0x20,0x4c,0x6f,0x29,
+    0x20,0x2b,0x20,0x28,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x74,0x65,0x78,
+    0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,
+    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x76,0x5f,0x75,0x76,0x29,0x2e,0x78,0x79,0x7a,0x20,
+    0x2a,0x20,0x5f,0x35,0x34,0x31,0x5f,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,
+    0x66,0x61,0x63,0x74,0x6f,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x34,0x20,0x3d,0x20,0x41,
+    0x43,0x45,0x53,0x46,0x69,0x6c,0x6d,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x33,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,
+    0x72,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x6c,0x69,0x6e,0x65,0x61,
+    0x72,0x54,0x6f,0x53,0x52,0x47,0x42,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x34,
+    0x29,0x2c,0x20,0x5f,0x35,0x34,0x34,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,
+    0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,
+    0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,
+    0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
+    0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x76,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,
+    0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,
+    0x73,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x2e,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x74,0x61,
+    0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x62,0x69,0x74,
+    0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
+    0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x77,0x6f,0x72,
+    0x6c,0x64,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
+    0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6c,0x69,0x70,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x63,0x6c,0x69,
+    0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
 };
 /*
-    #version 460
+    #include <metal_stdlib>
+    #include <simd/simd.h>
 
-    layout(set = 0, binding = 0, std140) uniform vs_params
+    using namespace metal;
+
+    struct vs_params
     {
-        mat4 mvp;
-        mat4 model;
-        mat4 normal_matrix;
-        vec3 cam_pos;
+        float4x4 mvp;
+        float4x4 model;
+        float4x4 normal_matrix;
+        packed_float3 cam_pos;
         float _pad0;
-    } _14;
+    };
 
-    layout(location = 0) out vec3 v_world_pos;
-    layout(location = 0) in vec3 pos;
-    layout(location = 1) out vec3 v_normal;
-    layout(location = 1) in vec3 normal;
-    layout(location = 2) out vec3 v_tangent;
-    layout(location = 3) in vec4 tangent;
-    layout(location = 3) out vec3 v_bitangent;
-    layout(location = 4) out vec2 v_uv;
-    layout(location = 2) in vec2 uv;
+    struct main0_out
+    {
+        float3 v_world_pos [[user(locn0)]];
+        float3 v_normal [[user(locn1)]];
+        float3 v_tangent [[user(locn2)]];
+        float3 v_bitangent [[user(locn3)]];
+        float2 v_uv [[user(locn4)]];
+        float v_occlusion [[user(locn5)]];
+        float4 gl_Position [[position]];
+    };
 
-    void main()
+    struct main0_in
     {
-        vec4 _27 = vec4(pos, 1.0);
-        v_world_pos = (_14.model * _27).xyz;
-        v_normal = normalize((_14.normal_matrix * vec4(normal, 0.0)).xyz);
-        v_tangent = normalize((_14.normal_matrix * vec4(tangent.xyz, 0.0)).xyz);
-        v_bitangent = cross(v_normal, v_tangent) * tangent.w;
-        v_uv = uv;
-        gl_Position = _14.mvp * _27;
+        float3 pos [[attribute(0)]];
+        float3 normal [[attribute(1)]];
+        float2 uv [[attribute(2)]];
+        float4 tangent [[attribute(3)]];
+        float occlusion [[attribute(4)]];
+    };
+
+    vertex main0_out main0(main0_in in [[stage_in]], constant vs_params& _14 [[buffer(0)]])
+    {
+        main0_out out = {};
+        float4 _27 = float4(in.pos, 1.0);
+        out.v_world_pos = (_14.model * _27).xyz;
+        out.v_normal = fast::normalize((_14.normal_matrix * float4(in.normal, 0.0)).xyz);
+        out.v_tangent = fast::normalize((_14.normal_matrix * float4(in.tangent.xyz, 0.0)).xyz);
+        out.v_bitangent = cross(out.v_normal, out.v_tangent) * in.tangent.w;
+        out.v_uv = in.uv;
+        out.v_occlusion = in.occlusion;
+        out.gl_Position = _14.mvp * _27;
+        return out;
     }
 
 */
-static const uint8_t pbr_vs_bytecode_spirv_vk[2780] = {
-    0x03,0x02,0x23,0x07,0x00,0x04,0x01,0x00,0x0b,0x00,0x08,0x00,0x59,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x11,0x00,0x02,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x06,0x00,
-    0x01,0x00,0x00,0x00,0x47,0x4c,0x53,0x4c,0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,
-    0x00,0x00,0x00,0x00,0x0e,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-    0x0f,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6d,0x61,0x69,0x6e,
-    0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
-    0x21,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0x33,0x00,0x00,0x00,
-    0x3d,0x00,0x00,0x00,0x49,0x00,0x00,0x00,0x4b,0x00,0x00,0x00,0x51,0x00,0x00,0x00,
-    0x03,0x00,0x03,0x00,0x02,0x00,0x00,0x00,0xcc,0x01,0x00,0x00,0x05,0x00,0x04,0x00,
-    0x04,0x00,0x00,0x00,0x6d,0x61,0x69,0x6e,0x00,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
-    0x09,0x00,0x00,0x00,0x5f,0x32,0x37,0x00,0x05,0x00,0x03,0x00,0x0c,0x00,0x00,0x00,
-    0x70,0x6f,0x73,0x00,0x05,0x00,0x05,0x00,0x14,0x00,0x00,0x00,0x76,0x5f,0x77,0x6f,
-    0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x00,0x05,0x00,0x05,0x00,0x16,0x00,0x00,0x00,
-    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x00,0x00,0x00,0x06,0x00,0x04,0x00,
-    0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6d,0x76,0x70,0x00,0x06,0x00,0x05,0x00,
-    0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6d,0x6f,0x64,0x65,0x6c,0x00,0x00,0x00,
-    0x06,0x00,0x07,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x6e,0x6f,0x72,0x6d,
-    0x61,0x6c,0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,0x00,0x00,0x00,0x06,0x00,0x05,0x00,
-    0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x63,0x61,0x6d,0x5f,0x70,0x6f,0x73,0x00,
-    0x06,0x00,0x05,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x5f,0x70,0x61,0x64,
-    0x30,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x18,0x00,0x00,0x00,0x5f,0x31,0x34,0x00,
-    0x05,0x00,0x05,0x00,0x21,0x00,0x00,0x00,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
-    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x25,0x00,0x00,0x00,0x6e,0x6f,0x72,0x6d,
-    0x61,0x6c,0x00,0x00,0x05,0x00,0x05,0x00,0x2f,0x00,0x00,0x00,0x76,0x5f,0x74,0x61,
-    0x6e,0x67,0x65,0x6e,0x74,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x33,0x00,0x00,0x00,
-    0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x00,0x05,0x00,0x05,0x00,0x3d,0x00,0x00,0x00,
-    0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x00,0x05,0x00,0x04,0x00,
-    0x49,0x00,0x00,0x00,0x76,0x5f,0x75,0x76,0x00,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
-    0x4b,0x00,0x00,0x00,0x75,0x76,0x00,0x00,0x05,0x00,0x06,0x00,0x4f,0x00,0x00,0x00,
-    0x67,0x6c,0x5f,0x50,0x65,0x72,0x56,0x65,0x72,0x74,0x65,0x78,0x00,0x00,0x00,0x00,
-    0x06,0x00,0x06,0x00,0x4f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x6c,0x5f,0x50,
-    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x00,0x06,0x00,0x07,0x00,0x4f,0x00,0x00,0x00,
-    0x01,0x00,0x00,0x00,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,
-    0x00,0x00,0x00,0x00,0x06,0x00,0x07,0x00,0x4f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
-    0x67,0x6c,0x5f,0x43,0x6c,0x69,0x70,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x00,
-    0x06,0x00,0x07,0x00,0x4f,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x67,0x6c,0x5f,0x43,
-    0x75,0x6c,0x6c,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x00,0x05,0x00,0x03,0x00,
-    0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,
-    0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x14,0x00,0x00,0x00,
-    0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x03,0x00,0x16,0x00,0x00,0x00,
-    0x02,0x00,0x00,0x00,0x48,0x00,0x04,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x05,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x16,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x04,0x00,
-    0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
-    0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
-    0x48,0x00,0x05,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
-    0x40,0x00,0x00,0x00,0x48,0x00,0x04,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
-    0x05,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x16,0x00,0x00,0x00,
-    0x02,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
-    0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,
-    0x48,0x00,0x05,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
-    0xcc,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x22,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x21,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,
-    0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x25,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,
-    0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x2f,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,
-    0x02,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x33,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,
-    0x03,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x3d,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,
-    0x03,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x49,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,
-    0x04,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x4b,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,
-    0x02,0x00,0x00,0x00,0x47,0x00,0x03,0x00,0x4f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
-    0x48,0x00,0x05,0x00,0x4f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x4f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-    0x0b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x4f,0x00,0x00,0x00,
-    0x02,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
-    0x4f,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
-    0x13,0x00,0x02,0x00,0x02,0x00,0x00,0x00,0x21,0x00,0x03,0x00,0x03,0x00,0x00,0x00,
-    0x02,0x00,0x00,0x00,0x16,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-    0x17,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
-    0x20,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
-    0x17,0x00,0x04,0x00,0x0a,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
-    0x20,0x00,0x04,0x00,0x0b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
-    0x3b,0x00,0x04,0x00,0x0b,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-    0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x80,0x3f,
-    0x20,0x00,0x04,0x00,0x13,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
-    0x3b,0x00,0x04,0x00,0x13,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
-    0x18,0x00,0x04,0x00,0x15,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
-    0x1e,0x00,0x07,0x00,0x16,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
-    0x15,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
-    0x17,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
-    0x17,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x15,0x00,0x04,0x00,
-    0x19,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,
-    0x19,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
-    0x1b,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
-    0x13,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,
-    0x19,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
-    0x0b,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
-    0x13,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
-    0x32,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
-    0x32,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
-    0x13,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x15,0x00,0x04,0x00,
-    0x41,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,
-    0x41,0x00,0x00,0x00,0x42,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
-    0x43,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x17,0x00,0x04,0x00,
-    0x47,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
-    0x48,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
-    0x48,0x00,0x00,0x00,0x49,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
-    0x4a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
-    0x4a,0x00,0x00,0x00,0x4b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,
-    0x41,0x00,0x00,0x00,0x4d,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1c,0x00,0x04,0x00,
-    0x4e,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x4d,0x00,0x00,0x00,0x1e,0x00,0x06,0x00,
-    0x4f,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x4e,0x00,0x00,0x00,
-    0x4e,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x50,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
-    0x4f,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x50,0x00,0x00,0x00,0x51,0x00,0x00,0x00,
-    0x03,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x52,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x57,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x36,0x00,0x05,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x05,0x00,0x00,0x00,
-    0x3b,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x0a,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,
-    0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
-    0x0d,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-    0x11,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x50,0x00,0x07,0x00,
-    0x07,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
-    0x11,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x09,0x00,0x00,0x00,
-    0x12,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x1b,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,
-    0x18,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x15,0x00,0x00,0x00,
-    0x1d,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
-    0x1e,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x91,0x00,0x05,0x00,0x07,0x00,0x00,0x00,
-    0x1f,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x4f,0x00,0x08,0x00,
-    0x0a,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
-    0x14,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x1b,0x00,0x00,0x00,
-    0x23,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x15,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x0a,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x26,0x00,0x00,0x00,
-    0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,
-    0x26,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x50,0x00,0x07,0x00,0x07,0x00,0x00,0x00,
-    0x2b,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,
-    0x27,0x00,0x00,0x00,0x91,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,
-    0x24,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x4f,0x00,0x08,0x00,0x0a,0x00,0x00,0x00,
-    0x2d,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0c,0x00,0x06,0x00,0x0a,0x00,0x00,0x00,
-    0x2e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,
-    0x3e,0x00,0x03,0x00,0x21,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
-    0x1b,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x22,0x00,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x15,0x00,0x00,0x00,0x31,0x00,0x00,0x00,0x30,0x00,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x33,0x00,0x00,0x00,
-    0x4f,0x00,0x08,0x00,0x0a,0x00,0x00,0x00,0x35,0x00,0x00,0x00,0x34,0x00,0x00,0x00,
-    0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
-    0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x35,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x37,0x00,0x00,0x00,
-    0x35,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-    0x38,0x00,0x00,0x00,0x35,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x50,0x00,0x07,0x00,
-    0x07,0x00,0x00,0x00,0x39,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x37,0x00,0x00,0x00,
-    0x38,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x91,0x00,0x05,0x00,0x07,0x00,0x00,0x00,
-    0x3a,0x00,0x00,0x00,0x31,0x00,0x00,0x00,0x39,0x00,0x00,0x00,0x4f,0x00,0x08,0x00,
-    0x0a,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0c,0x00,0x06,0x00,
-    0x0a,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x45,0x00,0x00,0x00,
-    0x3b,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x2f,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x0a,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x0a,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,
-    0x0c,0x00,0x07,0x00,0x0a,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-    0x44,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
-    0x43,0x00,0x00,0x00,0x44,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x42,0x00,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x44,0x00,0x00,0x00,
-    0x8e,0x00,0x05,0x00,0x0a,0x00,0x00,0x00,0x46,0x00,0x00,0x00,0x40,0x00,0x00,0x00,
-    0x45,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x3d,0x00,0x00,0x00,0x46,0x00,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x47,0x00,0x00,0x00,0x4c,0x00,0x00,0x00,0x4b,0x00,0x00,0x00,
-    0x3e,0x00,0x03,0x00,0x49,0x00,0x00,0x00,0x4c,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
-    0x1b,0x00,0x00,0x00,0x53,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x52,0x00,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x15,0x00,0x00,0x00,0x54,0x00,0x00,0x00,0x53,0x00,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x55,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
-    0x91,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x56,0x00,0x00,0x00,0x54,0x00,0x00,0x00,
-    0x55,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x57,0x00,0x00,0x00,0x58,0x00,0x00,0x00,
-    0x51,0x00,0x00,0x00,0x52,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x58,0x00,0x00,0x00,
-    0x56,0x00,0x00,0x00,0xfd,0x00,0x01,0x00,0x38,0x00,0x01,0x00,
+static const uint8_t pbr_vs_source_metal_macos[1253] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x6d,0x76,0x70,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x6d,0x6f,0x64,0x65,0x6c,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,
+    0x61,0x6d,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x70,0x61,0x64,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x77,0x6f,0x72,
+    0x6c,0x64,0x5f,0x70,0x6f,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,
+    0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,
+    0x74,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,
+    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,
+    0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,
+    0x28,0x6c,0x6f,0x63,0x6e,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x34,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,
+    0x6e,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x35,0x29,0x5d,
+    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x20,0x5b,0x5b,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x29,0x5d,
+    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,
+    0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x32,0x29,0x5d,
+    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x61,
+    0x6e,0x67,0x65,0x6e,0x74,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,
+    0x65,0x28,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x34,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
+    0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,
+    0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x31,0x34,0x20,0x5b,0x5b,0x62,0x75,0x66,
+    0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,
+    0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,
+    0x32,0x37,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x70,
+    0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
+    0x74,0x2e,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,
+    0x28,0x5f,0x31,0x34,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x20,0x2a,0x20,0x5f,0x32,0x37,
+    0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,
+    0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x28,0x5f,0x31,0x34,0x2e,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,
+    0x20,0x30,0x2e,0x30,0x29,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,
+    0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,
+    0x28,0x28,0x5f,0x31,0x34,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x6d,0x61,0x74,
+    0x72,0x69,0x78,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,
+    0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x30,0x2e,0x30,
+    0x29,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,
+    0x2e,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,0x63,
+    0x72,0x6f,0x73,0x73,0x28,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x2c,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,
+    0x29,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x77,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,0x20,0x3d,
+    0x20,0x69,0x6e,0x2e,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
+    0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x69,0x6e,
+    0x2e,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x5f,0x31,0x34,0x2e,0x6d,0x76,0x70,0x20,0x2a,0x20,0x5f,0x32,0x37,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
-    #version 460
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
 
-    layout(set = 0, binding = 1, std140) uniform fs_params
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct fs_params
     {
-        vec4 base_color_factor;
+        float4 base_color_factor;
         float metallic_factor;
         float roughness_factor;
-        vec3 emissive_factor;
+        char _m3_pad[8];
+        packed_float3 emissive_factor;
         float _pad0;
-        vec3 cam_pos;
+        packed_float3 cam_pos;
         float _pad1;
-    } _281;
+    };
 
-    layout(set = 1, binding = 0) uniform texture2D base_color_tex;
-    layout(set = 1, binding = 32) uniform sampler base_color_smp;
-    layout(set = 1, binding = 1) uniform texture2D metallic_roughness_tex;
-    layout(set = 1, binding = 33) uniform sampler metallic_roughness_smp;
-    layout(set = 1, binding = 3) uniform texture2D occlusion_tex;
-    layout(set = 1, binding = 35) uniform sampler occlusion_smp;
-    layout(set = 1, binding = 4) uniform texture2D emissive_tex;
-    layout(set = 1, binding = 36) uniform sampler emissive_smp;
-    layout(set = 1, binding = 2) uniform texture2D normal_tex;
-    layout(set = 1, binding = 34) uniform sampler normal_smp;
-    layout(set = 1, binding = 5) uniform textureCube irradiance_map;
-    layout(set = 1, binding = 37) uniform sampler irradiance_smp;
-    layout(set = 1, binding = 6) uniform textureCube prefilter_map;
-    layout(set = 1, binding = 38) uniform sampler prefilter_smp;
-    layout(set = 1, binding = 7) uniform texture2D brdf_lut;
-    layout(set = 1, binding = 39) uniform sampler brdf_lut_smp;
+    struct main0_out
+    {
+        float4 frag_color [[color(0)]];
+    };
 
-    layout(location = 4) in vec2 v_uv;
-    layout(location = 2) in vec3 v_tangent;
-    layout(location = 3) in vec3 v_bitangent;
-    layout(location = 1) in vec3 v_normal;
-    layout(location = 0) in vec3 v_world_pos;
-    layout(location = 0) out vec4 frag_color;
+    struct main0_in
+    {
+        float3 v_world_pos [[user(locn0)]];
+        float3 v_normal [[user(locn1)]];
+        float3 v_tangent [[user(locn2)]];
+        float3 v_bitangent [[user(locn3)]];
+        float2 v_uv [[user(locn4)]];
+        float v_occlusion [[user(locn5)]];
+    };
 
-    float D_GGX(float NdotH, float roughness)
+    static inline __attribute__((always_inline))
+    float D_GGX(thread const float& NdotH, thread const float& roughness)
     {
-        float _130 = roughness * roughness;
-        float _134 = _130 * _130;
-        float _144 = ((NdotH * NdotH) * (_134 - 1.0)) + 1.0;
-        return _134 / ((3.1415927410125732421875 * _144) * _144);
+        float _141 = roughness * roughness;
+        float _145 = _141 * _141;
+        float _155 = ((NdotH * NdotH) * (_145 - 1.0)) + 1.0;
+        return _145 / ((3.1415927410125732421875 * _155) * _155);
     }
 
-    float G_SmithGGX(float NdotV, float NdotL, float roughness)
+    static inline __attribute__((always_inline))
+    float G_SmithGGX(thread const float& NdotV, thread const float& NdotL, thread const float& roughness)
     {
-        float _157 = roughness * roughness;
-        float _161 = _157 * _157;
-        float _168 = 1.0 - _161;
-        return 0.5 / max((NdotL * sqrt(((NdotV * NdotV) * _168) + _161)) + (NdotV * sqrt(((NdotL * NdotL) * _168) + _161)), 9.9999997473787516355514526367188e-05);
+        float _168 = roughness * roughness;
+        float _172 = _168 * _168;
+        float _179 = 1.0 - _172;
+        return 0.5 / fast::max((NdotL * sqrt(((NdotV * NdotV) * _179) + _172)) + (NdotV * sqrt(((NdotL * NdotL) * _179) + _172)), 9.9999997473787516355514526367188e-05);
     }
 
-    float SchlickFresnel(float u)
+    static inline __attribute__((always_inline))
+    float SchlickFresnel(thread const float& u)
     {
-        float _115 = clamp(1.0 - u, 0.0, 1.0);
-        float _119 = _115 * _115;
-        return (_119 * _119) * _115;
+        float _126 = fast::clamp(1.0 - u, 0.0, 1.0);
+        float _130 = _126 * _126;
+        return (_130 * _130) * _126;
     }
 
-    vec3 F_Schlick(float VdotH, vec3 F0)
+    static inline __attribute__((always_inline))
+    float3 F_Schlick(thread const float& VdotH, thread const float3& F0)
     {
         float param = VdotH;
-        return F0 + ((vec3(1.0) - F0) * SchlickFresnel(param));
+        return F0 + ((float3(1.0) - F0) * SchlickFresnel(param));
     }
 
-    float Fd_DisneyDiffuse(float NdotV, float NdotL, float LdotH, float roughness)
+    static inline __attribute__((always_inline))
+    float Fd_DisneyDiffuse(thread const float& NdotV, thread const float& NdotL, thread const float& LdotH, thread const float& roughness)
     {
-        float _240 = (mix(0.0, 0.5, roughness) + (((2.0 * LdotH) * LdotH) * roughness)) - 1.0;
+        float _251 = (mix(0.0, 0.5, roughness) + (((2.0 * LdotH) * LdotH) * roughness)) - 1.0;
         float param = NdotV;
         float param_1 = NdotL;
-        return ((1.0 + (_240 * SchlickFresnel(param))) * (1.0 + (_240 * SchlickFresnel(param_1)))) * mix(1.0, 0.662251651287078857421875, roughness);
+        return ((1.0 + (_251 * SchlickFresnel(param))) * (1.0 + (_251 * SchlickFresnel(param_1)))) * mix(1.0, 0.662251651287078857421875, roughness);
     }
 
-    vec3 F_SchlickRoughness(float NdotV, vec3 F0, float roughness)
+    static inline __attribute__((always_inline))
+    float3 directLight(thread const float3& N, thread const float3& V, thread const float3& L, thread const float3& F0, thread const float3& diffuseColor, thread const float& metallic, thread const float& roughness, thread const float& NdotV)
+    {
+        float3 _276 = fast::normalize(V + L);
+        float _281 = fast::max(dot(N, L), 9.9999997473787516355514526367188e-05);
+        float param = fast::max(dot(N, _276), 0.0);
+        float param_1 = roughness;
+        float param_2 = NdotV;
+        float param_3 = _281;
+        float param_4 = roughness;
+        float param_5 = fast::max(dot(V, _276), 0.0);
+        float3 param_6 = F0;
+        float3 _316 = F_Schlick(param_5, param_6);
+        float param_7 = NdotV;
+        float param_8 = _281;
+        float param_9 = fast::max(dot(L, _276), 0.0);
+        float param_10 = roughness;
+        return ((((float3(1.0) - _316) * (1.0 - metallic)) * (diffuseColor * Fd_DisneyDiffuse(param_7, param_8, param_9, param_10))) + (_316 * (D_GGX(param, param_1) * G_SmithGGX(param_2, param_3, param_4)))) * _281;
+    }
+
+    static inline __attribute__((always_inline))
+    float3 F_SchlickRoughness(thread const float& NdotV, thread const float3& F0, thread const float& roughness)
     {
         float param = NdotV;
-        return F0 + ((max(vec3(1.0 - roughness), F0) - F0) * SchlickFresnel(param));
+        return F0 + ((fast::max(float3(1.0 - roughness), F0) - F0) * SchlickFresnel(param));
     }
 
-    vec3 ACESFilm(vec3 x)
+    static inline __attribute__((always_inline))
+    float3 ACESFilm(thread const float3& x)
     {
-        return clamp((x * ((x * 2.5099999904632568359375) + vec3(0.02999999932944774627685546875))) / ((x * ((x * 2.4300000667572021484375) + vec3(0.589999973773956298828125))) + vec3(0.14000000059604644775390625)), vec3(0.0), vec3(1.0));
+        return fast::clamp((x * ((x * 2.5099999904632568359375) + float3(0.02999999932944774627685546875))) / ((x * ((x * 2.4300000667572021484375) + float3(0.589999973773956298828125))) + float3(0.14000000059604644775390625)), float3(0.0), float3(1.0));
     }
 
-    vec3 linearToSRGB(vec3 c)
+    static inline __attribute__((always_inline))
+    float3 linearToSRGB(thread const float3& c)
     {
-        return mix(c * 12.9200000762939453125, (pow(max(c, vec3(0.0)), vec3(0.4166666567325592041015625)) * 1.05499994754791259765625) - vec3(0.054999999701976776123046875), step(vec3(0.003130800090730190277099609375), c));
+        return mix(c * 12.9200000762939453125, (powr(fast::max(c, float3(0.0)), float3(0.4166666567325592041015625)) * 1.05499994754791259765625) - float3(0.054999999701976776123046875), step(float3(0.003130800090730190277099609375), c));
+    }
+
+    fragment main0_out main0(main0_in in [[stage_in]], constant fs_params& _373 [[buffer(1)]], texture2d<float> base_color_tex [[texture(0)]], texture2d<float> metallic_roughness_tex [[texture(1)]], texture2d<float> normal_tex [[texture(2)]], texture2d<float> occlusion_tex [[texture(3)]], texture2d<float> emissive_tex [[texture(4)]], texturecube<float> irradiance_map [[texture(5)]], texturecube<float> prefilter_map [[texture(6)]], texture2d<float> brdf_lut [[texture(7)]], sampler base_color_smp [[sampler(0)]], sampler metallic_roughness_smp [[sampler(1)]], sampler normal_smp [[sampler(2)]], sampler occlusion_smp [[sampler(3)]], sampler emissive_smp [[sampler(4)]], sampler irradiance_smp [[sampler(5)]], sampler prefilter_smp [[sampler(6)]], sampler brdf_lut_smp [[sampler(7)]])
+    {
+        main0_out out = {};
+        float4 _379 = base_color_tex.sample(base_color_smp, in.v_uv) * _373.base_color_factor;
+        float4 _387 = metallic_roughness_tex.sample(metallic_roughness_smp, in.v_uv);
+        float _398 = _387.z * _373.metallic_factor;
+        float _408 = fast::clamp(_387.y * _373.roughness_factor, 0.039999999105930328369140625, 1.0);
+        float3 _477 = fast::normalize(float3x3(in.v_tangent, in.v_bitangent, in.v_normal) * ((normal_tex.sample(normal_smp, in.v_uv).xyz * 2.0) - float3(1.0)));
+        float3 _485 = fast::normalize(float3(_373.cam_pos) - in.v_world_pos);
+        float _495 = fast::max(dot(_477, _485), 9.9999997473787516355514526367188e-05);
+        float3 _499 = _379.xyz;
+        float3 _502 = mix(float3(0.039999999105930328369140625), _499, float3(_398));
+        float _507 = 1.0 - _398;
+        float3 _508 = _499 * _507;
+        float3 param = _477;
+        float3 param_1 = _485;
+        float3 param_2 = float3(0.57735025882720947265625);
+        float3 param_3 = _502;
+        float3 param_4 = _508;
+        float param_5 = _398;
+        float param_6 = _408;
+        float param_7 = _495;
+        float param_8 = _495;
+        float3 param_9 = _502;
+        float param_10 = _408;
+        float3 _541 = F_SchlickRoughness(param_8, param_9, param_10);
+        float4 _589 = brdf_lut.sample(brdf_lut_smp, float2(_495, _408));
+        float3 param_11 = ((((((float3(1.0) - _541) * _507) * ((irradiance_map.sample(irradiance_smp, _477).xyz * _508) * 0.300000011920928955078125)) + ((prefilter_map.sample(prefilter_smp, reflect(-_485, _477), level(_408 * 4.0)).xyz * ((_541 * _589.x) + float3(_589.y))) * 0.5)) * (occlusion_tex.sample(occlusion_smp, in.v_uv).x * in.v_occlusion)) + directLight(param, param_1, param_2, param_3, param_4, param_5, param_6, param_7)) + (emissive_tex.sample(emissive_smp, in.v_uv).xyz * float3(_373.emissive_factor));
+        float3 param_12 = ACESFilm(param_11);
+        out.frag_color = float4(linearToSRGB(param_12), _379.w);
+        return out;
+    }
+
+*/
+static const uint8_t pbr_fs_source_metal_macos[6965] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,
+    0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,
+    0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6d,0x65,0x74,0x61,
+    0x6c,0x6c,0x69,0x63,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
+    0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x68,0x61,
+    0x72,0x20,0x5f,0x6d,0x33,0x5f,0x70,0x61,0x64,0x5b,0x38,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,0x64,0x30,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x63,0x61,0x6d,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,0x64,0x31,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
+    0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x63,0x6f,0x6c,
+    0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,
+    0x64,0x5f,0x70,0x6f,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,
+    0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,
+    0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x62,
+    0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,
+    0x6c,0x6f,0x63,0x6e,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,
+    0x28,0x6c,0x6f,0x63,0x6e,0x34,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,
+    0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x35,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,
+    0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x44,0x5f,0x47,0x47,0x58,0x28,0x74,
+    0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x26,0x20,0x4e,0x64,0x6f,0x74,0x48,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x72,0x6f,
+    0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x34,0x31,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,
+    0x68,0x6e,0x65,0x73,0x73,0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,
+    0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x34,
+    0x35,0x20,0x3d,0x20,0x5f,0x31,0x34,0x31,0x20,0x2a,0x20,0x5f,0x31,0x34,0x31,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x35,0x35,0x20,
+    0x3d,0x20,0x28,0x28,0x4e,0x64,0x6f,0x74,0x48,0x20,0x2a,0x20,0x4e,0x64,0x6f,0x74,
+    0x48,0x29,0x20,0x2a,0x20,0x28,0x5f,0x31,0x34,0x35,0x20,0x2d,0x20,0x31,0x2e,0x30,
+    0x29,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x34,0x35,0x20,0x2f,0x20,0x28,0x28,0x33,0x2e,
+    0x31,0x34,0x31,0x35,0x39,0x32,0x37,0x34,0x31,0x30,0x31,0x32,0x35,0x37,0x33,0x32,
+    0x34,0x32,0x31,0x38,0x37,0x35,0x20,0x2a,0x20,0x5f,0x31,0x35,0x35,0x29,0x20,0x2a,
+    0x20,0x5f,0x31,0x35,0x35,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,
+    0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x47,0x5f,
+    0x53,0x6d,0x69,0x74,0x68,0x47,0x47,0x58,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x4e,0x64,0x6f,
+    0x74,0x56,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x2c,0x20,0x74,
+    0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x26,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x36,0x38,0x20,0x3d,
+    0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x20,0x2a,0x20,0x72,0x6f,0x75,
+    0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x31,0x37,0x32,0x20,0x3d,0x20,0x5f,0x31,0x36,0x38,0x20,0x2a,0x20,
+    0x5f,0x31,0x36,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x31,0x37,0x39,0x20,0x3d,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x5f,0x31,0x37,
+    0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x2e,
+    0x35,0x20,0x2f,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x28,0x4e,
+    0x64,0x6f,0x74,0x4c,0x20,0x2a,0x20,0x73,0x71,0x72,0x74,0x28,0x28,0x28,0x4e,0x64,
+    0x6f,0x74,0x56,0x20,0x2a,0x20,0x4e,0x64,0x6f,0x74,0x56,0x29,0x20,0x2a,0x20,0x5f,
+    0x31,0x37,0x39,0x29,0x20,0x2b,0x20,0x5f,0x31,0x37,0x32,0x29,0x29,0x20,0x2b,0x20,
+    0x28,0x4e,0x64,0x6f,0x74,0x56,0x20,0x2a,0x20,0x73,0x71,0x72,0x74,0x28,0x28,0x28,
+    0x4e,0x64,0x6f,0x74,0x4c,0x20,0x2a,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x29,0x20,0x2a,
+    0x20,0x5f,0x31,0x37,0x39,0x29,0x20,0x2b,0x20,0x5f,0x31,0x37,0x32,0x29,0x29,0x2c,
+    0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,
+    0x35,0x31,0x36,0x33,0x35,0x35,0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,
+    0x38,0x38,0x65,0x2d,0x30,0x35,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,
+    0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x53,
+    0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x26,0x20,0x75,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x5f,0x31,0x32,0x36,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,
+    0x61,0x6d,0x70,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x75,0x2c,0x20,0x30,0x2e,0x30,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x31,0x33,0x30,0x20,0x3d,0x20,0x5f,0x31,0x32,0x36,0x20,0x2a,0x20,
+    0x5f,0x31,0x32,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x28,0x5f,0x31,0x33,0x30,0x20,0x2a,0x20,0x5f,0x31,0x33,0x30,0x29,0x20,0x2a,
+    0x20,0x5f,0x31,0x32,0x36,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x46,0x5f,
+    0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x56,0x64,0x6f,0x74,
+    0x48,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x46,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,
+    0x56,0x64,0x6f,0x74,0x48,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x46,0x30,0x20,0x2b,0x20,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,
+    0x31,0x2e,0x30,0x29,0x20,0x2d,0x20,0x46,0x30,0x29,0x20,0x2a,0x20,0x53,0x63,0x68,
+    0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,
+    0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,
+    0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,
+    0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x46,0x64,0x5f,0x44,0x69,
+    0x73,0x6e,0x65,0x79,0x44,0x69,0x66,0x66,0x75,0x73,0x65,0x28,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,
+    0x4e,0x64,0x6f,0x74,0x56,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x4e,0x64,0x6f,0x74,0x4c,
+    0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x26,0x20,0x4c,0x64,0x6f,0x74,0x48,0x2c,0x20,0x74,0x68,0x72,
+    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,
+    0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x35,0x31,0x20,0x3d,0x20,0x28,
+    0x6d,0x69,0x78,0x28,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x35,0x2c,0x20,0x72,0x6f,
+    0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x20,0x2b,0x20,0x28,0x28,0x28,0x32,0x2e,
+    0x30,0x20,0x2a,0x20,0x4c,0x64,0x6f,0x74,0x48,0x29,0x20,0x2a,0x20,0x4c,0x64,0x6f,
+    0x74,0x48,0x29,0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,
+    0x29,0x20,0x2d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,
+    0x28,0x5f,0x32,0x35,0x31,0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,
+    0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x29,0x20,
+    0x2a,0x20,0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,0x5f,0x32,0x35,0x31,0x20,0x2a,
+    0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x29,0x29,0x29,0x20,0x2a,0x20,0x6d,0x69,
+    0x78,0x28,0x31,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x36,0x36,0x32,0x32,0x35,0x31,0x36,
+    0x35,0x31,0x32,0x38,0x37,0x30,0x37,0x38,0x38,0x35,0x37,0x34,0x32,0x31,0x38,0x37,
+    0x35,0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,
+    0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,
+    0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x4c,0x69,0x67,0x68,
+    0x74,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x4e,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x56,
+    0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x4c,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x46,
+    0x30,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,
+    0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,
+    0x69,0x63,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,
+    0x73,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x4e,0x64,0x6f,0x74,0x56,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x37,0x36,0x20,
+    0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,
+    0x65,0x28,0x56,0x20,0x2b,0x20,0x4c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x32,0x38,0x31,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,
+    0x3a,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x4e,0x2c,0x20,0x4c,0x29,0x2c,0x20,
+    0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,
+    0x31,0x36,0x33,0x35,0x35,0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,
+    0x38,0x65,0x2d,0x30,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,
+    0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x4e,0x2c,0x20,0x5f,0x32,0x37,0x36,0x29,
+    0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,
+    0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x33,0x20,0x3d,0x20,0x5f,0x32,0x38,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,
+    0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x66,
+    0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x56,0x2c,0x20,
+    0x5f,0x32,0x37,0x36,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,
+    0x3d,0x20,0x46,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x5f,0x33,0x31,0x36,0x20,0x3d,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,
+    0x6b,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x36,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x38,0x20,0x3d,0x20,0x5f,0x32,0x38,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,0x66,0x61,
+    0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x4c,0x2c,0x20,0x5f,
+    0x32,0x37,0x36,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x20,0x3d,
+    0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x28,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x28,0x31,0x2e,0x30,0x29,0x20,0x2d,0x20,0x5f,0x33,0x31,0x36,0x29,0x20,0x2a,
+    0x20,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,
+    0x29,0x29,0x20,0x2a,0x20,0x28,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,
+    0x6f,0x72,0x20,0x2a,0x20,0x46,0x64,0x5f,0x44,0x69,0x73,0x6e,0x65,0x79,0x44,0x69,
+    0x66,0x66,0x75,0x73,0x65,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x2c,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x29,0x29,0x29,0x20,0x2b,0x20,0x28,
+    0x5f,0x33,0x31,0x36,0x20,0x2a,0x20,0x28,0x44,0x5f,0x47,0x47,0x58,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x20,0x2a,0x20,
+    0x47,0x5f,0x53,0x6d,0x69,0x74,0x68,0x47,0x47,0x58,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x2c,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x34,0x29,0x29,0x29,0x29,0x20,0x2a,0x20,0x5f,0x32,0x38,0x31,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,
+    0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,
+    0x6b,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x28,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x4e,
+    0x64,0x6f,0x74,0x56,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x46,0x30,0x2c,0x20,0x74,
+    0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x26,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,
+    0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x46,0x30,0x20,0x2b,0x20,0x28,0x28,0x66,0x61,0x73,0x74,0x3a,
+    0x3a,0x6d,0x61,0x78,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x2e,0x30,0x20,
+    0x2d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x2c,0x20,0x46,0x30,
+    0x29,0x20,0x2d,0x20,0x46,0x30,0x29,0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,
+    0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,
+    0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,
+    0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,
+    0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x41,0x43,0x45,0x53,0x46,0x69,0x6c,
+    0x6d,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,
+    0x6d,0x70,0x28,0x28,0x78,0x20,0x2a,0x20,0x28,0x28,0x78,0x20,0x2a,0x20,0x32,0x2e,
+    0x35,0x30,0x39,0x39,0x39,0x39,0x39,0x39,0x30,0x34,0x36,0x33,0x32,0x35,0x36,0x38,
+    0x33,0x35,0x39,0x33,0x37,0x35,0x29,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x28,0x30,0x2e,0x30,0x32,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x33,0x32,0x39,0x34,
+    0x34,0x37,0x37,0x34,0x36,0x32,0x37,0x36,0x38,0x35,0x35,0x34,0x36,0x38,0x37,0x35,
+    0x29,0x29,0x29,0x20,0x2f,0x20,0x28,0x28,0x78,0x20,0x2a,0x20,0x28,0x28,0x78,0x20,
+    0x2a,0x20,0x32,0x2e,0x34,0x33,0x30,0x30,0x30,0x30,0x30,0x36,0x36,0x37,0x35,0x37,
+    0x32,0x30,0x32,0x31,0x34,0x38,0x34,0x33,0x37,0x35,0x29,0x20,0x2b,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x35,0x38,0x39,0x39,0x39,0x39,0x39,0x37,0x33,
+    0x37,0x37,0x33,0x39,0x35,0x36,0x32,0x39,0x38,0x38,0x32,0x38,0x31,0x32,0x35,0x29,
+    0x29,0x29,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x31,0x34,
+    0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x35,0x39,0x36,0x30,0x34,0x36,0x34,0x34,0x37,
+    0x37,0x35,0x33,0x39,0x30,0x36,0x32,0x35,0x29,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x28,0x30,0x2e,0x30,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,
+    0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6c,0x69,
+    0x6e,0x65,0x61,0x72,0x54,0x6f,0x53,0x52,0x47,0x42,0x28,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,
+    0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x6d,0x69,0x78,0x28,0x63,0x20,0x2a,0x20,0x31,0x32,0x2e,0x39,0x32,0x30,0x30,0x30,
+    0x30,0x30,0x37,0x36,0x32,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x2c,0x20,
+    0x28,0x70,0x6f,0x77,0x72,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,
+    0x63,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x30,0x29,0x29,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x34,0x31,0x36,0x36,0x36,0x36,
+    0x36,0x35,0x36,0x37,0x33,0x32,0x35,0x35,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,
+    0x36,0x32,0x35,0x29,0x29,0x20,0x2a,0x20,0x31,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,
+    0x39,0x34,0x37,0x35,0x34,0x37,0x39,0x31,0x32,0x35,0x39,0x37,0x36,0x35,0x36,0x32,
+    0x35,0x29,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x30,0x35,
+    0x34,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x30,0x31,0x39,0x37,0x36,0x37,0x37,0x36,
+    0x31,0x32,0x33,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x2c,0x20,0x73,0x74,0x65,0x70,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x30,0x30,0x33,0x31,0x33,0x30,
+    0x38,0x30,0x30,0x30,0x39,0x30,0x37,0x33,0x30,0x31,0x39,0x30,0x32,0x37,0x37,0x30,
+    0x39,0x39,0x36,0x30,0x39,0x33,0x37,0x35,0x29,0x2c,0x20,0x63,0x29,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,
+    0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,
+    0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x66,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x33,0x37,0x33,0x20,0x5b,
+    0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x62,
+    0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x74,0x65,0x78,0x20,0x5b,0x5b,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x6d,
+    0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,
+    0x73,0x5f,0x74,0x65,0x78,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,
+    0x31,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,
+    0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x74,0x65,
+    0x78,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x32,0x29,0x5d,0x5d,
+    0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,
+    0x74,0x3e,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x74,0x65,0x78,
+    0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x33,0x29,0x5d,0x5d,0x2c,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,
+    0x3e,0x20,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x74,0x65,0x78,0x20,0x5b,
+    0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x34,0x29,0x5d,0x5d,0x2c,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x63,0x75,0x62,0x65,0x3c,0x66,0x6c,0x6f,0x61,0x74,
+    0x3e,0x20,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5f,0x6d,0x61,0x70,
+    0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x35,0x29,0x5d,0x5d,0x2c,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x63,0x75,0x62,0x65,0x3c,0x66,0x6c,0x6f,
+    0x61,0x74,0x3e,0x20,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,0x6d,0x61,
+    0x70,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x36,0x29,0x5d,0x5d,
+    0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,
+    0x74,0x3e,0x20,0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,0x20,0x5b,0x5b,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x28,0x37,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x20,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,
+    0x6d,0x70,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,
+    0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x6d,0x65,0x74,0x61,0x6c,
+    0x6c,0x69,0x63,0x5f,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x73,0x6d,
+    0x70,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x31,0x29,0x5d,0x5d,
+    0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x32,
+    0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x6f,0x63,0x63,
+    0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x28,0x33,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x20,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x73,0x6d,0x70,0x20,
+    0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x34,0x29,0x5d,0x5d,0x2c,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,
+    0x63,0x65,0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x28,0x35,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x70,
+    0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x36,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x20,0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,0x5f,0x73,0x6d,
+    0x70,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x37,0x29,0x5d,0x5d,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,
+    0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x33,0x37,0x39,0x20,0x3d,0x20,0x62,0x61,
+    0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x74,0x65,0x78,0x2e,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x28,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,
+    0x6d,0x70,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x29,0x20,0x2a,0x20,0x5f,
+    0x33,0x37,0x33,0x2e,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x66,
+    0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x5f,0x33,0x38,0x37,0x20,0x3d,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,
+    0x63,0x5f,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x74,0x65,0x78,0x2e,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,
+    0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x69,
+    0x6e,0x2e,0x76,0x5f,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x33,0x39,0x38,0x20,0x3d,0x20,0x5f,0x33,0x38,0x37,0x2e,0x7a,
+    0x20,0x2a,0x20,0x5f,0x33,0x37,0x33,0x2e,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,
+    0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x34,0x30,0x38,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,
+    0x63,0x6c,0x61,0x6d,0x70,0x28,0x5f,0x33,0x38,0x37,0x2e,0x79,0x20,0x2a,0x20,0x5f,
+    0x33,0x37,0x33,0x2e,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x66,0x61,
+    0x63,0x74,0x6f,0x72,0x2c,0x20,0x30,0x2e,0x30,0x33,0x39,0x39,0x39,0x39,0x39,0x39,
+    0x39,0x31,0x30,0x35,0x39,0x33,0x30,0x33,0x32,0x38,0x33,0x36,0x39,0x31,0x34,0x30,
+    0x36,0x32,0x35,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x37,0x37,0x20,0x3d,0x20,0x66,0x61,0x73,
+    0x74,0x3a,0x3a,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x78,0x33,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,
+    0x6e,0x74,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,
+    0x6e,0x74,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,
+    0x20,0x2a,0x20,0x28,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x74,0x65,0x78,0x2e,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x73,0x6d,
+    0x70,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x29,0x2e,0x78,0x79,0x7a,0x20,
+    0x2a,0x20,0x32,0x2e,0x30,0x29,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,
+    0x31,0x2e,0x30,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x5f,0x34,0x38,0x35,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x28,0x5f,0x33,0x37,0x33,0x2e,0x63,0x61,0x6d,0x5f,0x70,0x6f,0x73,0x29,0x20,0x2d,
+    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x39,0x35,
+    0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,
+    0x28,0x5f,0x34,0x37,0x37,0x2c,0x20,0x5f,0x34,0x38,0x35,0x29,0x2c,0x20,0x39,0x2e,
+    0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,
+    0x33,0x35,0x35,0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,
+    0x2d,0x30,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x5f,0x34,0x39,0x39,0x20,0x3d,0x20,0x5f,0x33,0x37,0x39,0x2e,0x78,0x79,0x7a,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x35,0x30,
+    0x32,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,
+    0x2e,0x30,0x33,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x31,0x30,0x35,0x39,0x33,0x30,
+    0x33,0x32,0x38,0x33,0x36,0x39,0x31,0x34,0x30,0x36,0x32,0x35,0x29,0x2c,0x20,0x5f,
+    0x34,0x39,0x39,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x33,0x39,0x38,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x35,
+    0x30,0x37,0x20,0x3d,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x5f,0x33,0x39,0x38,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x35,0x30,0x38,
+    0x20,0x3d,0x20,0x5f,0x34,0x39,0x39,0x20,0x2a,0x20,0x5f,0x35,0x30,0x37,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x20,0x3d,0x20,0x5f,0x34,0x37,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x5f,0x34,
+    0x38,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,
+    0x30,0x2e,0x35,0x37,0x37,0x33,0x35,0x30,0x32,0x35,0x38,0x38,0x32,0x37,0x32,0x30,
+    0x39,0x34,0x37,0x32,0x36,0x35,0x36,0x32,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,
+    0x20,0x5f,0x35,0x30,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x5f,0x35,0x30,0x38,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x35,0x20,0x3d,0x20,0x5f,0x33,0x39,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,
+    0x5f,0x34,0x30,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x5f,0x34,0x39,0x35,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x38,0x20,0x3d,0x20,0x5f,0x34,0x39,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,0x5f,
+    0x35,0x30,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x20,0x3d,0x20,0x5f,0x34,0x30,0x38,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x35,0x34,0x31,0x20,
+    0x3d,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x52,0x6f,0x75,0x67,0x68,
+    0x6e,0x65,0x73,0x73,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x39,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x35,0x38,
+    0x39,0x20,0x3d,0x20,0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,0x2e,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x28,0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x5f,0x34,0x39,0x35,0x2c,0x20,0x5f,
+    0x34,0x30,0x38,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x20,0x3d,0x20,0x28,0x28,0x28,
+    0x28,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x2e,0x30,0x29,0x20,0x2d,
+    0x20,0x5f,0x35,0x34,0x31,0x29,0x20,0x2a,0x20,0x5f,0x35,0x30,0x37,0x29,0x20,0x2a,
+    0x20,0x28,0x28,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5f,0x6d,0x61,
+    0x70,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x72,0x72,0x61,0x64,0x69,0x61,
+    0x6e,0x63,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x5f,0x34,0x37,0x37,0x29,0x2e,0x78,
+    0x79,0x7a,0x20,0x2a,0x20,0x5f,0x35,0x30,0x38,0x29,0x20,0x2a,0x20,0x30,0x2e,0x33,
+    0x30,0x30,0x30,0x30,0x30,0x30,0x31,0x31,0x39,0x32,0x30,0x39,0x32,0x38,0x39,0x35,
+    0x35,0x30,0x37,0x38,0x31,0x32,0x35,0x29,0x29,0x20,0x2b,0x20,0x28,0x28,0x70,0x72,
+    0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,0x6d,0x61,0x70,0x2e,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x28,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x5f,0x34,0x38,0x35,0x2c,
+    0x20,0x5f,0x34,0x37,0x37,0x29,0x2c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x28,0x5f,0x34,
+    0x30,0x38,0x20,0x2a,0x20,0x34,0x2e,0x30,0x29,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,
+    0x20,0x28,0x28,0x5f,0x35,0x34,0x31,0x20,0x2a,0x20,0x5f,0x35,0x38,0x39,0x2e,0x78,
+    0x29,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x35,0x38,0x39,0x2e,
+    0x79,0x29,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x29,0x29,0x20,0x2a,0x20,0x28,
+    0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x74,0x65,0x78,0x2e,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x28,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x73,
+    0x6d,0x70,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x29,0x2e,0x78,0x20,0x2a,
+    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x29,
+    0x29,0x20,0x2b,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x4c,0x69,0x67,0x68,0x74,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x2c,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x37,0x29,0x29,0x20,0x2b,0x20,0x28,0x65,0x6d,0x69,0x73,0x73,0x69,
+    0x76,0x65,0x5f,0x74,0x65,0x78,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x65,0x6d,
+    0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x69,0x6e,0x2e,0x76,
+    0x5f,0x75,0x76,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x28,0x5f,0x33,0x37,0x33,0x2e,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,
+    0x66,0x61,0x63,0x74,0x6f,0x72,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x20,0x3d,0x20,
+    0x41,0x43,0x45,0x53,0x46,0x69,0x6c,0x6d,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,
+    0x6c,0x69,0x6e,0x65,0x61,0x72,0x54,0x6f,0x53,0x52,0x47,0x42,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x32,0x29,0x2c,0x20,0x5f,0x33,0x37,0x39,0x2e,0x77,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct vs_params
+    {
+        float4x4 mvp;
+        float4x4 model;
+        float4x4 normal_matrix;
+        packed_float3 cam_pos;
+        float _pad0;
+    };
+
+    struct main0_out
+    {
+        float3 v_world_pos [[user(locn0)]];
+        float3 v_normal [[user(locn1)]];
+        float3 v_tangent [[user(locn2)]];
+        float3 v_bitangent [[user(locn3)]];
+        float2 v_uv [[user(locn4)]];
+        float v_occlusion [[user(locn5)]];
+        float4 v_clip [[user(locn6)]];
+        float4 gl_Position [[position]];
+    };
+
+    struct main0_in
+    {
+        float3 pos [[attribute(0)]];
+        float3 normal [[attribute(1)]];
+        float2 uv [[attribute(2)]];
+        float4 tangent [[attribute(3)]];
+        float occlusion [[attribute(4)]];
+    };
+
+    vertex main0_out main0(main0_in in [[stage_in]], constant vs_params& _14 [[buffer(0)]])
+    {
+        main0_out out = {};
+        float4 _27 = float4(in.pos, 1.0);
+        out.v_world_pos = (_14.model * _27).xyz;
+        out.v_normal = fast::normalize((_14.normal_matrix * float4(in.normal, 0.0)).xyz);
+        out.v_tangent = fast::normalize((_14.normal_matrix * float4(in.tangent.xyz, 0.0)).xyz);
+        out.v_bitangent = cross(out.v_normal, out.v_tangent) * in.tangent.w;
+        out.v_uv = in.uv;
+        out.v_occlusion = in.occlusion;
+        out.gl_Position = _14.mvp * _27;
+        out.v_clip = out.gl_Position;
+        return out;
+    }
+
+*/
+static const uint8_t pbr_vs_clustered_source_metal_macos[1322] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x6d,0x76,0x70,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x6d,0x6f,0x64,0x65,0x6c,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,
+    0x61,0x6d,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x70,0x61,0x64,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x77,0x6f,0x72,
+    0x6c,0x64,0x5f,0x70,0x6f,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,
+    0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,
+    0x74,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,
+    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,
+    0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,
+    0x28,0x6c,0x6f,0x63,0x6e,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x34,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,
+    0x6e,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x35,0x29,0x5d,
+    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,
+    0x63,0x6c,0x69,0x70,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,
+    0x36,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x20,
+    0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,
+    0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x75,0x76,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,
+    0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x28,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x20,0x5b,
+    0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x34,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,
+    0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,
+    0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x31,0x34,0x20,0x5b,0x5b,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,
+    0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x5f,0x32,0x37,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,
+    0x6e,0x2e,0x70,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,
+    0x20,0x3d,0x20,0x28,0x5f,0x31,0x34,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x20,0x2a,0x20,
+    0x5f,0x32,0x37,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
+    0x74,0x2e,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x66,0x61,0x73,
+    0x74,0x3a,0x3a,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x28,0x5f,0x31,
+    0x34,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,0x20,
+    0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x2c,0x20,0x30,0x2e,0x30,0x29,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,
+    0x74,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x69,0x7a,0x65,0x28,0x28,0x5f,0x31,0x34,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,
+    0x6d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,
+    0x69,0x6e,0x2e,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x78,0x79,0x7a,0x2c,0x20,
+    0x30,0x2e,0x30,0x29,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x6f,0x75,0x74,0x2e,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,
+    0x3d,0x20,0x63,0x72,0x6f,0x73,0x73,0x28,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x2c,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x74,0x61,0x6e,0x67,
+    0x65,0x6e,0x74,0x29,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x74,0x61,0x6e,0x67,0x65,0x6e,
+    0x74,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,
+    0x76,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x69,0x6e,0x2e,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x5f,0x31,0x34,0x2e,0x6d,0x76,0x70,0x20,0x2a,0x20,0x5f,
+    0x32,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x63,0x6c,
+    0x69,0x70,0x20,0x3d,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct punctual_light
+    {
+        float4 position_range;
+        float4 color_spot_scale;
+        float4 direction_spot_offset;
+    };
+
+    struct light_params
+    {
+        float4 cluster_grid;
+        float4 cluster_depth;
+    };
+
+    struct light_cluster
+    {
+        uint offset;
+        uint count;
+    };
+
+    struct light_clusters
+    {
+        light_cluster clusters[1];
+    };
+
+    struct fs_params
+    {
+        float4 base_color_factor;
+        float metallic_factor;
+        float roughness_factor;
+        char _m3_pad[8];
+        packed_float3 emissive_factor;
+        float _pad0;
+        packed_float3 cam_pos;
+        float _pad1;
+    };
+
+    struct punctual_light_1
+    {
+        float4 position_range;
+        float4 color_spot_scale;
+        float4 direction_spot_offset;
+    };
+
+    struct punctual_lights
+    {
+        punctual_light_1 lights[1];
+    };
+
+    struct light_index
+    {
+        uint light;
+    };
+
+    struct light_index_list
+    {
+        light_index light_indices[1];
+    };
+
+    struct main0_out
+    {
+        float4 frag_color [[color(0)]];
+    };
+
+    struct main0_in
+    {
+        float3 v_world_pos [[user(locn0)]];
+        float3 v_normal [[user(locn1)]];
+        float3 v_tangent [[user(locn2)]];
+        float3 v_bitangent [[user(locn3)]];
+        float2 v_uv [[user(locn4)]];
+        float v_occlusion [[user(locn5)]];
+        float4 v_clip [[user(locn6)]];
+    };
+
+    static inline __attribute__((always_inline))
+    float D_GGX(thread const float& NdotH, thread const float& roughness)
+    {
+        float _313 = roughness * roughness;
+        float _317 = _313 * _313;
+        float _327 = ((NdotH * NdotH) * (_317 - 1.0)) + 1.0;
+        return _317 / ((3.1415927410125732421875 * _327) * _327);
+    }
+
+    static inline __attribute__((always_inline))
+    float G_SmithGGX(thread const float& NdotV, thread const float& NdotL, thread const float& roughness)
+    {
+        float _340 = roughness * roughness;
+        float _344 = _340 * _340;
+        float _351 = 1.0 - _344;
+        return 0.5 / fast::max((NdotL * sqrt(((NdotV * NdotV) * _351) + _344)) + (NdotV * sqrt(((NdotL * NdotL) * _351) + _344)), 9.9999997473787516355514526367188e-05);
+    }
+
+    static inline __attribute__((always_inline))
+    float SchlickFresnel(thread const float& u)
+    {
+        float _298 = fast::clamp(1.0 - u, 0.0, 1.0);
+        float _302 = _298 * _298;
+        return (_302 * _302) * _298;
+    }
+
+    static inline __attribute__((always_inline))
+    float3 F_Schlick(thread const float& VdotH, thread const float3& F0)
+    {
+        float param = VdotH;
+        return F0 + ((float3(1.0) - F0) * SchlickFresnel(param));
+    }
+
+    static inline __attribute__((always_inline))
+    float Fd_DisneyDiffuse(thread const float& NdotV, thread const float& NdotL, thread const float& LdotH, thread const float& roughness)
+    {
+        float _422 = (mix(0.0, 0.5, roughness) + (((2.0 * LdotH) * LdotH) * roughness)) - 1.0;
+        float param = NdotV;
+        float param_1 = NdotL;
+        return ((1.0 + (_422 * SchlickFresnel(param))) * (1.0 + (_422 * SchlickFresnel(param_1)))) * mix(1.0, 0.662251651287078857421875, roughness);
+    }
+
+    static inline __attribute__((always_inline))
+    float3 directLight(thread const float3& N, thread const float3& V, thread const float3& L, thread const float3& F0, thread const float3& diffuseColor, thread const float& metallic, thread const float& roughness, thread const float& NdotV)
+    {
+        float3 _447 = fast::normalize(V + L);
+        float _452 = fast::max(dot(N, L), 9.9999997473787516355514526367188e-05);
+        float param = fast::max(dot(N, _447), 0.0);
+        float param_1 = roughness;
+        float param_2 = NdotV;
+        float param_3 = _452;
+        float param_4 = roughness;
+        float param_5 = fast::max(dot(V, _447), 0.0);
+        float3 param_6 = F0;
+        float3 _487 = F_Schlick(param_5, param_6);
+        float param_7 = NdotV;
+        float param_8 = _452;
+        float param_9 = fast::max(dot(L, _447), 0.0);
+        float param_10 = roughness;
+        return ((((float3(1.0) - _487) * (1.0 - metallic)) * (diffuseColor * Fd_DisneyDiffuse(param_7, param_8, param_9, param_10))) + (_487 * (D_GGX(param, param_1) * G_SmithGGX(param_2, param_3, param_4)))) * _452;
+    }
+
+    static inline __attribute__((always_inline))
+    uint2 clusterLightRange(thread const float4& clip, constant light_params& _93, const device light_clusters& _160)
+    {
+        int3 _133 = clamp(int3(float3((((clip.xy / float2(clip.w)) * 0.5) + float2(0.5)) * _93.cluster_grid.xy, (log(fast::max(clip.w, 9.9999999747524270787835121154785e-07)) * _93.cluster_depth.x) + _93.cluster_depth.y)), int3(0), int3(_93.cluster_grid.xyz) - int3(1));
+        int _152 = (((_133.z * int(_93.cluster_grid.y)) + _133.y) * int(_93.cluster_grid.x)) + _133.x;
+        return uint2(_160.clusters[_152].offset, _160.clusters[_152].count);
+    }
+
+    static inline __attribute__((always_inline))
+    float punctualAttenuation(thread const punctual_light& light, thread const float3& world_pos, thread float3& L)
+    {
+        float3 _182 = light.position_range.xyz - world_pos;
+        float _188 = fast::max(dot(_182, _182), 9.9999999392252902907785028219223e-09);
+        L = _182 * rsqrt(_188);
+        float _200 = _188 / (light.position_range.w * light.position_range.w);
+        float _208 = fast::clamp(1.0 - (_200 * _200), 0.0, 1.0);
+        float _223 = fast::clamp((dot(light.direction_spot_offset.xyz, -L) * light.color_spot_scale.w) + light.direction_spot_offset.w, 0.0, 1.0);
+        return (((_208 * _208) * _223) * _223) / _188;
+    }
+
+    static inline __attribute__((always_inline))
+    float3 F_SchlickRoughness(thread const float& NdotV, thread const float3& F0, thread const float& roughness)
+    {
+        float param = NdotV;
+        return F0 + ((fast::max(float3(1.0 - roughness), F0) - F0) * SchlickFresnel(param));
+    }
+
+    static inline __attribute__((always_inline))
+    float3 ACESFilm(thread const float3& x)
+    {
+        return fast::clamp((x * ((x * 2.5099999904632568359375) + float3(0.02999999932944774627685546875))) / ((x * ((x * 2.4300000667572021484375) + float3(0.589999973773956298828125))) + float3(0.14000000059604644775390625)), float3(0.0), float3(1.0));
+    }
+
+    static inline __attribute__((always_inline))
+    float3 linearToSRGB(thread const float3& c)
+    {
+        return mix(c * 12.9200000762939453125, (powr(fast::max(c, float3(0.0)), float3(0.4166666567325592041015625)) * 1.05499994754791259765625) - float3(0.054999999701976776123046875), step(float3(0.003130800090730190277099609375), c));
+    }
+
+    fragment main0_out main0(main0_in in [[stage_in]], constant fs_params& _541 [[buffer(1)]], constant light_params& _93 [[buffer(3)]], const device punctual_lights& _715 [[buffer(8)]], const device light_clusters& _160 [[buffer(9)]], const device light_index_list& _720 [[buffer(10)]], texture2d<float> base_color_tex [[texture(0)]], texture2d<float> metallic_roughness_tex [[texture(1)]], texture2d<float> normal_tex [[texture(2)]], texture2d<float> occlusion_tex [[texture(3)]], texture2d<float> emissive_tex [[texture(4)]], texturecube<float> irradiance_map [[texture(5)]], texturecube<float> prefilter_map [[texture(6)]], texture2d<float> brdf_lut [[texture(7)]], sampler base_color_smp [[sampler(0)]], sampler metallic_roughness_smp [[sampler(1)]], sampler normal_smp [[sampler(2)]], sampler occlusion_smp [[sampler(3)]], sampler emissive_smp [[sampler(4)]], sampler irradiance_smp [[sampler(5)]], sampler prefilter_smp [[sampler(6)]], sampler brdf_lut_smp [[sampler(7)]])
+    {
+        main0_out out = {};
+        float4 _544 = base_color_tex.sample(base_color_smp, in.v_uv) * _541.base_color_factor;
+        float4 _552 = metallic_roughness_tex.sample(metallic_roughness_smp, in.v_uv);
+        float _559 = _552.z * _541.metallic_factor;
+        float _567 = fast::clamp(_552.y * _541.roughness_factor, 0.039999999105930328369140625, 1.0);
+        float3 _635 = fast::normalize(float3x3(in.v_tangent, in.v_bitangent, in.v_normal) * ((normal_tex.sample(normal_smp, in.v_uv).xyz * 2.0) - float3(1.0)));
+        float3 _643 = fast::normalize(float3(_541.cam_pos) - in.v_world_pos);
+        float _653 = fast::max(dot(_635, _643), 9.9999997473787516355514526367188e-05);
+        float3 _657 = _544.xyz;
+        float3 _660 = mix(float3(0.039999999105930328369140625), _657, float3(_559));
+        float _665 = 1.0 - _559;
+        float3 _666 = _657 * _665;
+        float3 param = _635;
+        float3 param_1 = _643;
+        float3 param_2 = float3(0.57735025882720947265625);
+        float3 param_3 = _660;
+        float3 param_4 = _666;
+        float param_5 = _559;
+        float param_6 = _567;
+        float param_7 = _653;
+        float3 Lo = directLight(param, param_1, param_2, param_3, param_4, param_5, param_6, param_7);
+        float4 param_8 = in.v_clip;
+        uint2 _698 = clusterLightRange(param_8, _93, _160);
+        float3 param_11;
+        for (uint i = 0u; i < _698.y; i++)
+        {
+            uint _724 = _698.x + i;
+            punctual_light param_9 = punctual_light{ _715.lights[_720.light_indices[_724].light].position_range, _715.lights[_720.light_indices[_724].light].color_spot_scale, _715.lights[_720.light_indices[_724].light].direction_spot_offset };
+            float3 param_10 = in.v_world_pos;
+            float _744 = punctualAttenuation(param_9, param_10, param_11);
+            if (_744 > 0.0)
+            {
+                float3 param_12 = _635;
+                float3 param_13 = _643;
+                float3 param_14 = param_11;
+                float3 param_15 = _660;
+                float3 param_16 = _666;
+                float param_17 = _559;
+                float param_18 = _567;
+                float param_19 = _653;
+                Lo += ((directLight(param_12, param_13, param_14, param_15, param_16, param_17, param_18, param_19) * _715.lights[_720.light_indices[_724].light].color_spot_scale.xyz) * _744);
+            }
+        }
+        float param_20 = _653;
+        float3 param_21 = _660;
+        float param_22 = _567;
+        float3 _784 = F_SchlickRoughness(param_20, param_21, param_22);
+        float4 _831 = brdf_lut.sample(brdf_lut_smp, float2(_653, _567));
+        float3 param_23 = ((((((float3(1.0) - _784) * _665) * ((irradiance_map.sample(irradiance_smp, _635).xyz * _666) * 0.300000011920928955078125)) + ((prefilter_map.sample(prefilter_smp, reflect(-_643, _635), level(_567 * 4.0)).xyz * ((_784 * _831.x) + float3(_831.y))) * 0.5)) * (occlusion_tex.sample(occlusion_smp, in.v_uv).x * in.v_occlusion)) + Lo) + (emissive_tex.sample(emissive_smp, in.v_uv).xyz * float3(_541.emissive_factor));
+        float3 param_24 = ACESFilm(param_23);
+        out.frag_color = float4(linearToSRGB(param_24), _544.w);
+        return out;
+    }
+
+*/
+static const uint8_t pbr_fs_clustered_source_metal_macos[10147] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,
+    0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x70,0x75,0x6e,0x63,0x74,0x75,0x61,0x6c,
+    0x5f,0x6c,0x69,0x67,0x68,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x72,0x61,0x6e,
+    0x67,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x64,0x69,0x72,0x65,
+    0x63,0x74,0x69,0x6f,0x6e,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x69,
+    0x67,0x68,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,
+    0x67,0x72,0x69,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x64,0x65,0x70,0x74,0x68,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x69,0x67,0x68,0x74,
+    0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x63,0x6c,0x75,
+    0x73,0x74,0x65,0x72,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6c,0x69,0x67,0x68,
+    0x74,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x20,0x63,0x6c,0x75,0x73,0x74,0x65,
+    0x72,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,
+    0x6c,0x6f,0x72,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x66,
+    0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x66,0x61,0x63,0x74,0x6f,
+    0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x72,0x20,0x5f,0x6d,0x33,0x5f,
+    0x70,0x61,0x64,0x5b,0x38,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,
+    0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x65,0x6d,0x69,0x73,0x73,0x69,
+    0x76,0x65,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,0x64,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x61,
+    0x6d,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x5f,0x70,0x61,0x64,0x31,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x70,0x75,0x6e,0x63,0x74,0x75,0x61,0x6c,0x5f,0x6c,0x69,0x67,0x68,
+    0x74,0x5f,0x31,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x72,0x61,0x6e,0x67,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,
+    0x72,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,
+    0x6f,0x6e,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x70,0x75,0x6e,0x63,0x74,
+    0x75,0x61,0x6c,0x5f,0x6c,0x69,0x67,0x68,0x74,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x70,0x75,0x6e,0x63,0x74,0x75,0x61,0x6c,0x5f,0x6c,0x69,0x67,0x68,0x74,0x5f,
+    0x31,0x20,0x6c,0x69,0x67,0x68,0x74,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x69,0x6e,
+    0x64,0x65,0x78,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x6c,
+    0x69,0x67,0x68,0x74,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6c,0x69,0x73,
+    0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x69,0x6e,
+    0x64,0x65,0x78,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,
+    0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,
+    0x6f,0x72,0x20,0x5b,0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,
+    0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,
+    0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,
+    0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,
+    0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x33,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,
+    0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x34,0x29,0x5d,
+    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x6f,
+    0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,
+    0x6c,0x6f,0x63,0x6e,0x35,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6c,0x69,0x70,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x36,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,
+    0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,
+    0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x44,0x5f,0x47,0x47,0x58,0x28,0x74,0x68,0x72,0x65,0x61,0x64,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x4e,0x64,
+    0x6f,0x74,0x48,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,
+    0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x33,0x31,0x33,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
+    0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x31,0x37,0x20,0x3d,0x20,0x5f,
+    0x33,0x31,0x33,0x20,0x2a,0x20,0x5f,0x33,0x31,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x32,0x37,0x20,0x3d,0x20,0x28,0x28,0x4e,
+    0x64,0x6f,0x74,0x48,0x20,0x2a,0x20,0x4e,0x64,0x6f,0x74,0x48,0x29,0x20,0x2a,0x20,
+    0x28,0x5f,0x33,0x31,0x37,0x20,0x2d,0x20,0x31,0x2e,0x30,0x29,0x29,0x20,0x2b,0x20,
+    0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x5f,0x33,0x31,0x37,0x20,0x2f,0x20,0x28,0x28,0x33,0x2e,0x31,0x34,0x31,0x35,0x39,
+    0x32,0x37,0x34,0x31,0x30,0x31,0x32,0x35,0x37,0x33,0x32,0x34,0x32,0x31,0x38,0x37,
+    0x35,0x20,0x2a,0x20,0x5f,0x33,0x32,0x37,0x29,0x20,0x2a,0x20,0x5f,0x33,0x32,0x37,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,
+    0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x47,0x5f,0x53,0x6d,0x69,0x74,0x68,
+    0x47,0x47,0x58,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x4e,0x64,0x6f,0x74,0x56,0x2c,0x20,0x74,
+    0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x26,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x72,0x6f,
+    0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x34,0x30,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,
+    0x68,0x6e,0x65,0x73,0x73,0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,
+    0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x34,
+    0x34,0x20,0x3d,0x20,0x5f,0x33,0x34,0x30,0x20,0x2a,0x20,0x5f,0x33,0x34,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x35,0x31,0x20,
+    0x3d,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x5f,0x33,0x34,0x34,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x2e,0x35,0x20,0x2f,0x20,0x66,
+    0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x28,0x4e,0x64,0x6f,0x74,0x4c,0x20,
+    0x2a,0x20,0x73,0x71,0x72,0x74,0x28,0x28,0x28,0x4e,0x64,0x6f,0x74,0x56,0x20,0x2a,
+    0x20,0x4e,0x64,0x6f,0x74,0x56,0x29,0x20,0x2a,0x20,0x5f,0x33,0x35,0x31,0x29,0x20,
+    0x2b,0x20,0x5f,0x33,0x34,0x34,0x29,0x29,0x20,0x2b,0x20,0x28,0x4e,0x64,0x6f,0x74,
+    0x56,0x20,0x2a,0x20,0x73,0x71,0x72,0x74,0x28,0x28,0x28,0x4e,0x64,0x6f,0x74,0x4c,
+    0x20,0x2a,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x29,0x20,0x2a,0x20,0x5f,0x33,0x35,0x31,
+    0x29,0x20,0x2b,0x20,0x5f,0x33,0x34,0x34,0x29,0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,
+    0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,
+    0x35,0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,
+    0x35,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,
+    0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x75,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x39,0x38,
+    0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x31,
+    0x2e,0x30,0x20,0x2d,0x20,0x75,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x30,
+    0x32,0x20,0x3d,0x20,0x5f,0x32,0x39,0x38,0x20,0x2a,0x20,0x5f,0x32,0x39,0x38,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x5f,0x33,0x30,
+    0x32,0x20,0x2a,0x20,0x5f,0x33,0x30,0x32,0x29,0x20,0x2a,0x20,0x5f,0x32,0x39,0x38,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,
+    0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,
+    0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,
+    0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,
+    0x63,0x6b,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x56,0x64,0x6f,0x74,0x48,0x2c,0x20,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x26,0x20,0x46,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x56,0x64,0x6f,0x74,0x48,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x46,0x30,0x20,
+    0x2b,0x20,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x2e,0x30,0x29,0x20,
+    0x2d,0x20,0x46,0x30,0x29,0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,
+    0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
+    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x46,0x64,0x5f,0x44,0x69,0x73,0x6e,0x65,0x79,0x44,
+    0x69,0x66,0x66,0x75,0x73,0x65,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x4e,0x64,0x6f,0x74,0x56,
+    0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x26,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x2c,0x20,0x74,0x68,0x72,
+    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,
+    0x20,0x4c,0x64,0x6f,0x74,0x48,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x72,0x6f,0x75,0x67,
+    0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x34,0x32,0x32,0x20,0x3d,0x20,0x28,0x6d,0x69,0x78,0x28,0x30,
+    0x2e,0x30,0x2c,0x20,0x30,0x2e,0x35,0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,
+    0x73,0x73,0x29,0x20,0x2b,0x20,0x28,0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x4c,
+    0x64,0x6f,0x74,0x48,0x29,0x20,0x2a,0x20,0x4c,0x64,0x6f,0x74,0x48,0x29,0x20,0x2a,
+    0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x29,0x20,0x2d,0x20,0x31,
+    0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,
+    0x20,0x4e,0x64,0x6f,0x74,0x4c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x28,0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,0x5f,0x34,0x32,0x32,
+    0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,
+    0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x29,0x20,0x2a,0x20,0x28,0x31,0x2e,
+    0x30,0x20,0x2b,0x20,0x28,0x5f,0x34,0x32,0x32,0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,
+    0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x29,0x29,0x29,0x29,0x20,0x2a,0x20,0x6d,0x69,0x78,0x28,0x31,0x2e,0x30,
+    0x2c,0x20,0x30,0x2e,0x36,0x36,0x32,0x32,0x35,0x31,0x36,0x35,0x31,0x32,0x38,0x37,
+    0x30,0x37,0x38,0x38,0x35,0x37,0x34,0x32,0x31,0x38,0x37,0x35,0x2c,0x20,0x72,0x6f,
+    0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,
+    0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,
+    0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x4c,0x69,0x67,0x68,0x74,0x28,0x74,0x68,0x72,
+    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x26,0x20,0x4e,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x56,0x2c,0x20,0x74,0x68,0x72,
+    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x26,0x20,0x4c,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x46,0x30,0x2c,0x20,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x26,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x2c,
+    0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x26,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x2c,0x20,0x74,
+    0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x26,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x2c,0x20,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x26,0x20,0x4e,0x64,0x6f,0x74,0x56,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x34,0x37,0x20,0x3d,0x20,0x66,0x61,0x73,
+    0x74,0x3a,0x3a,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x56,0x20,0x2b,
+    0x20,0x4c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x34,0x35,0x32,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,
+    0x64,0x6f,0x74,0x28,0x4e,0x2c,0x20,0x4c,0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,
+    0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,0x35,
+    0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,0x35,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x64,
+    0x6f,0x74,0x28,0x4e,0x2c,0x20,0x5f,0x34,0x34,0x37,0x29,0x2c,0x20,0x30,0x2e,0x30,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x32,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,
+    0x20,0x5f,0x34,0x35,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,
+    0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,
+    0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x56,0x2c,0x20,0x5f,0x34,0x34,0x37,0x29,
+    0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x46,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x38,0x37,
+    0x20,0x3d,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x37,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,0x56,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x20,0x3d,0x20,0x5f,
+    0x34,0x35,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,
+    0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x4c,0x2c,0x20,0x5f,0x34,0x34,0x37,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,
+    0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x28,0x28,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x2e,0x30,
+    0x29,0x20,0x2d,0x20,0x5f,0x34,0x38,0x37,0x29,0x20,0x2a,0x20,0x28,0x31,0x2e,0x30,
+    0x20,0x2d,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x29,0x29,0x20,0x2a,0x20,
+    0x28,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,
+    0x46,0x64,0x5f,0x44,0x69,0x73,0x6e,0x65,0x79,0x44,0x69,0x66,0x66,0x75,0x73,0x65,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x2c,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x30,0x29,0x29,0x29,0x20,0x2b,0x20,0x28,0x5f,0x34,0x38,0x37,0x20,
+    0x2a,0x20,0x28,0x44,0x5f,0x47,0x47,0x58,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x20,0x2a,0x20,0x47,0x5f,0x53,0x6d,0x69,
+    0x74,0x68,0x47,0x47,0x58,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x29,
+    0x29,0x29,0x29,0x20,0x2a,0x20,0x5f,0x34,0x35,0x32,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,
+    0x32,0x20,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x4c,0x69,0x67,0x68,0x74,0x52,0x61,
+    0x6e,0x67,0x65,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x63,0x6c,0x69,0x70,0x2c,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x39,0x33,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x63,0x6c,
+    0x75,0x73,0x74,0x65,0x72,0x73,0x26,0x20,0x5f,0x31,0x36,0x30,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x33,0x20,0x5f,0x31,0x33,0x33,0x20,0x3d,0x20,
+    0x63,0x6c,0x61,0x6d,0x70,0x28,0x69,0x6e,0x74,0x33,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x28,0x28,0x28,0x28,0x63,0x6c,0x69,0x70,0x2e,0x78,0x79,0x20,0x2f,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x63,0x6c,0x69,0x70,0x2e,0x77,0x29,0x29,0x20,0x2a,
+    0x20,0x30,0x2e,0x35,0x29,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,
+    0x2e,0x35,0x29,0x29,0x20,0x2a,0x20,0x5f,0x39,0x33,0x2e,0x63,0x6c,0x75,0x73,0x74,
+    0x65,0x72,0x5f,0x67,0x72,0x69,0x64,0x2e,0x78,0x79,0x2c,0x20,0x28,0x6c,0x6f,0x67,
+    0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x63,0x6c,0x69,0x70,0x2e,
+    0x77,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x35,
+    0x32,0x34,0x32,0x37,0x30,0x37,0x38,0x37,0x38,0x33,0x35,0x31,0x32,0x31,0x31,0x35,
+    0x34,0x37,0x38,0x35,0x65,0x2d,0x30,0x37,0x29,0x29,0x20,0x2a,0x20,0x5f,0x39,0x33,
+    0x2e,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x64,0x65,0x70,0x74,0x68,0x2e,0x78,
+    0x29,0x20,0x2b,0x20,0x5f,0x39,0x33,0x2e,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,
+    0x64,0x65,0x70,0x74,0x68,0x2e,0x79,0x29,0x29,0x2c,0x20,0x69,0x6e,0x74,0x33,0x28,
+    0x30,0x29,0x2c,0x20,0x69,0x6e,0x74,0x33,0x28,0x5f,0x39,0x33,0x2e,0x63,0x6c,0x75,
+    0x73,0x74,0x65,0x72,0x5f,0x67,0x72,0x69,0x64,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2d,
+    0x20,0x69,0x6e,0x74,0x33,0x28,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x74,0x20,0x5f,0x31,0x35,0x32,0x20,0x3d,0x20,0x28,0x28,0x28,0x5f,0x31,0x33,
+    0x33,0x2e,0x7a,0x20,0x2a,0x20,0x69,0x6e,0x74,0x28,0x5f,0x39,0x33,0x2e,0x63,0x6c,
+    0x75,0x73,0x74,0x65,0x72,0x5f,0x67,0x72,0x69,0x64,0x2e,0x79,0x29,0x29,0x20,0x2b,
+    0x20,0x5f,0x31,0x33,0x33,0x2e,0x79,0x29,0x20,0x2a,0x20,0x69,0x6e,0x74,0x28,0x5f,
+    0x39,0x33,0x2e,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x67,0x72,0x69,0x64,0x2e,
+    0x78,0x29,0x29,0x20,0x2b,0x20,0x5f,0x31,0x33,0x33,0x2e,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x75,0x69,0x6e,0x74,0x32,0x28,0x5f,
+    0x31,0x36,0x30,0x2e,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x73,0x5b,0x5f,0x31,0x35,
+    0x32,0x5d,0x2e,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x5f,0x31,0x36,0x30,0x2e,
+    0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x73,0x5b,0x5f,0x31,0x35,0x32,0x5d,0x2e,0x63,
+    0x6f,0x75,0x6e,0x74,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x75,0x6e,
+    0x63,0x74,0x75,0x61,0x6c,0x41,0x74,0x74,0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,
+    0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x70,0x75,
+    0x6e,0x63,0x74,0x75,0x61,0x6c,0x5f,0x6c,0x69,0x67,0x68,0x74,0x26,0x20,0x6c,0x69,
+    0x67,0x68,0x74,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x77,0x6f,0x72,0x6c,0x64,0x5f,
+    0x70,0x6f,0x73,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x26,0x20,0x4c,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x5f,0x31,0x38,0x32,0x20,0x3d,0x20,0x6c,0x69,0x67,0x68,0x74,
+    0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x72,0x61,0x6e,0x67,0x65,0x2e,
+    0x78,0x79,0x7a,0x20,0x2d,0x20,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x38,0x38,0x20,
+    0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,
+    0x5f,0x31,0x38,0x32,0x2c,0x20,0x5f,0x31,0x38,0x32,0x29,0x2c,0x20,0x39,0x2e,0x39,
+    0x39,0x39,0x39,0x39,0x39,0x39,0x33,0x39,0x32,0x32,0x35,0x32,0x39,0x30,0x32,0x39,
+    0x30,0x37,0x37,0x38,0x35,0x30,0x32,0x38,0x32,0x31,0x39,0x32,0x32,0x33,0x65,0x2d,
+    0x30,0x39,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x4c,0x20,0x3d,0x20,0x5f,0x31,0x38,
+    0x32,0x20,0x2a,0x20,0x72,0x73,0x71,0x72,0x74,0x28,0x5f,0x31,0x38,0x38,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x30,0x30,0x20,
+    0x3d,0x20,0x5f,0x31,0x38,0x38,0x20,0x2f,0x20,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x72,0x61,0x6e,0x67,0x65,0x2e,0x77,
+    0x20,0x2a,0x20,0x6c,0x69,0x67,0x68,0x74,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x5f,0x72,0x61,0x6e,0x67,0x65,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x30,0x38,0x20,0x3d,0x20,0x66,0x61,0x73,
+    0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x28,
+    0x5f,0x32,0x30,0x30,0x20,0x2a,0x20,0x5f,0x32,0x30,0x30,0x29,0x2c,0x20,0x30,0x2e,
+    0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x32,0x32,0x33,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,
+    0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x64,0x6f,0x74,0x28,0x6c,0x69,0x67,0x68,0x74,
+    0x2e,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x5f,0x73,0x70,0x6f,0x74,0x5f,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x2d,0x4c,0x29,0x20,
+    0x2a,0x20,0x6c,0x69,0x67,0x68,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x70,
+    0x6f,0x74,0x5f,0x73,0x63,0x61,0x6c,0x65,0x2e,0x77,0x29,0x20,0x2b,0x20,0x6c,0x69,
+    0x67,0x68,0x74,0x2e,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x5f,0x73,0x70,
+    0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x2e,0x77,0x2c,0x20,0x30,0x2e,0x30,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x28,0x28,0x28,0x5f,0x32,0x30,0x38,0x20,0x2a,0x20,0x5f,0x32,0x30,
+    0x38,0x29,0x20,0x2a,0x20,0x5f,0x32,0x32,0x33,0x29,0x20,0x2a,0x20,0x5f,0x32,0x32,
+    0x33,0x29,0x20,0x2f,0x20,0x5f,0x31,0x38,0x38,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,
+    0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x52,0x6f,0x75,0x67,0x68,
+    0x6e,0x65,0x73,0x73,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x4e,0x64,0x6f,0x74,0x56,0x2c,0x20,
+    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x26,0x20,0x46,0x30,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x72,0x6f,0x75,
+    0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x4e,0x64,0x6f,0x74,
+    0x56,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x46,0x30,
+    0x20,0x2b,0x20,0x28,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x72,0x6f,0x75,0x67,
+    0x68,0x6e,0x65,0x73,0x73,0x29,0x2c,0x20,0x46,0x30,0x29,0x20,0x2d,0x20,0x46,0x30,
+    0x29,0x20,0x2a,0x20,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,
+    0x65,0x6c,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x41,0x43,0x45,0x53,0x46,0x69,0x6c,0x6d,0x28,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,
+    0x20,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x78,0x20,
+    0x2a,0x20,0x28,0x28,0x78,0x20,0x2a,0x20,0x32,0x2e,0x35,0x30,0x39,0x39,0x39,0x39,
+    0x39,0x39,0x30,0x34,0x36,0x33,0x32,0x35,0x36,0x38,0x33,0x35,0x39,0x33,0x37,0x35,
+    0x29,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x30,0x32,0x39,
+    0x39,0x39,0x39,0x39,0x39,0x39,0x33,0x32,0x39,0x34,0x34,0x37,0x37,0x34,0x36,0x32,
+    0x37,0x36,0x38,0x35,0x35,0x34,0x36,0x38,0x37,0x35,0x29,0x29,0x29,0x20,0x2f,0x20,
+    0x28,0x28,0x78,0x20,0x2a,0x20,0x28,0x28,0x78,0x20,0x2a,0x20,0x32,0x2e,0x34,0x33,
+    0x30,0x30,0x30,0x30,0x30,0x36,0x36,0x37,0x35,0x37,0x32,0x30,0x32,0x31,0x34,0x38,
+    0x34,0x33,0x37,0x35,0x29,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,
+    0x2e,0x35,0x38,0x39,0x39,0x39,0x39,0x39,0x37,0x33,0x37,0x37,0x33,0x39,0x35,0x36,
+    0x32,0x39,0x38,0x38,0x32,0x38,0x31,0x32,0x35,0x29,0x29,0x29,0x20,0x2b,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x31,0x34,0x30,0x30,0x30,0x30,0x30,0x30,
+    0x30,0x35,0x39,0x36,0x30,0x34,0x36,0x34,0x34,0x37,0x37,0x35,0x33,0x39,0x30,0x36,
+    0x32,0x35,0x29,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x30,
+    0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x2e,0x30,0x29,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,
+    0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x54,0x6f,
+    0x53,0x52,0x47,0x42,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x69,0x78,0x28,0x63,0x20,
+    0x2a,0x20,0x31,0x32,0x2e,0x39,0x32,0x30,0x30,0x30,0x30,0x30,0x37,0x36,0x32,0x39,
+    0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x2c,0x20,0x28,0x70,0x6f,0x77,0x72,0x28,
+    0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x63,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x28,0x30,0x2e,0x30,0x29,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x28,0x30,0x2e,0x34,0x31,0x36,0x36,0x36,0x36,0x36,0x35,0x36,0x37,0x33,0x32,
+    0x35,0x35,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x29,0x29,0x20,
+    0x2a,0x20,0x31,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x34,0x37,0x35,0x34,0x37,
+    0x39,0x31,0x32,0x35,0x39,0x37,0x36,0x35,0x36,0x32,0x35,0x29,0x20,0x2d,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x39,
+    0x39,0x37,0x30,0x31,0x39,0x37,0x36,0x37,0x37,0x36,0x31,0x32,0x33,0x30,0x34,0x36,
+    0x38,0x37,0x35,0x29,0x2c,0x20,0x73,0x74,0x65,0x70,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x28,0x30,0x2e,0x30,0x30,0x33,0x31,0x33,0x30,0x38,0x30,0x30,0x30,0x39,0x30,
+    0x37,0x33,0x30,0x31,0x39,0x30,0x32,0x37,0x37,0x30,0x39,0x39,0x36,0x30,0x39,0x33,
+    0x37,0x35,0x29,0x2c,0x20,0x63,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x72,0x61,
+    0x67,0x6d,0x65,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,
+    0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,
+    0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x26,0x20,0x5f,0x35,0x34,0x31,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,
+    0x72,0x28,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,
+    0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,
+    0x39,0x33,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x33,0x29,0x5d,0x5d,
+    0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x70,
+    0x75,0x6e,0x63,0x74,0x75,0x61,0x6c,0x5f,0x6c,0x69,0x67,0x68,0x74,0x73,0x26,0x20,
+    0x5f,0x37,0x31,0x35,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,
+    0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,
+    0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x73,0x26,
+    0x20,0x5f,0x31,0x36,0x30,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x39,
+    0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,
+    0x65,0x20,0x6c,0x69,0x67,0x68,0x74,0x5f,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6c,0x69,
+    0x73,0x74,0x26,0x20,0x5f,0x37,0x32,0x30,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,
+    0x72,0x28,0x31,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x62,0x61,0x73,0x65,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x5f,0x74,0x65,0x78,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,
+    0x69,0x63,0x5f,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x74,0x65,0x78,
+    0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x31,0x29,0x5d,0x5d,0x2c,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,
+    0x3e,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x74,0x65,0x78,0x20,0x5b,0x5b,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x6f,0x63,
+    0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x74,0x65,0x78,0x20,0x5b,0x5b,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x28,0x33,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x65,0x6d,0x69,
+    0x73,0x73,0x69,0x76,0x65,0x5f,0x74,0x65,0x78,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x28,0x34,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x63,0x75,0x62,0x65,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x69,0x72,0x72,
+    0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5f,0x6d,0x61,0x70,0x20,0x5b,0x5b,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x28,0x35,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x63,0x75,0x62,0x65,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x70,
+    0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,0x6d,0x61,0x70,0x20,0x5b,0x5b,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x36,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x62,0x72,
+    0x64,0x66,0x5f,0x6c,0x75,0x74,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x28,0x37,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x62,
+    0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x72,
+    0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x73,0x6d,0x70,0x20,
+    0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,
+    0x6e,0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,
+    0x33,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x65,0x6d,
+    0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x28,0x34,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x20,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5f,0x73,0x6d,
+    0x70,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x35,0x29,0x5d,0x5d,
+    0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x70,0x72,0x65,0x66,0x69,0x6c,
+    0x74,0x65,0x72,0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x28,0x36,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,
+    0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x37,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,
+    0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x5f,0x35,0x34,0x34,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,
+    0x6c,0x6f,0x72,0x5f,0x74,0x65,0x78,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x62,
+    0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x69,
+    0x6e,0x2e,0x76,0x5f,0x75,0x76,0x29,0x20,0x2a,0x20,0x5f,0x35,0x34,0x31,0x2e,0x62,
+    0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x35,0x35,
+    0x32,0x20,0x3d,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x72,0x6f,0x75,
+    0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x74,0x65,0x78,0x2e,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x28,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x72,0x6f,0x75,0x67,0x68,
+    0x6e,0x65,0x73,0x73,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,
+    0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x35,
+    0x35,0x39,0x20,0x3d,0x20,0x5f,0x35,0x35,0x32,0x2e,0x7a,0x20,0x2a,0x20,0x5f,0x35,
+    0x34,0x31,0x2e,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x66,0x61,0x63,0x74,
+    0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x35,
+    0x36,0x37,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,
+    0x28,0x5f,0x35,0x35,0x32,0x2e,0x79,0x20,0x2a,0x20,0x5f,0x35,0x34,0x31,0x2e,0x72,
+    0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x2c,
+    0x20,0x30,0x2e,0x30,0x33,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x31,0x30,0x35,0x39,
+    0x33,0x30,0x33,0x32,0x38,0x33,0x36,0x39,0x31,0x34,0x30,0x36,0x32,0x35,0x2c,0x20,
+    0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x5f,0x36,0x33,0x35,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x78,0x33,
+    0x28,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2c,0x20,0x69,
+    0x6e,0x2e,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2c,0x20,0x69,
+    0x6e,0x2e,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x20,0x2a,0x20,0x28,0x28,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x74,0x65,0x78,0x2e,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x75,0x76,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x32,0x2e,0x30,
+    0x29,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x2e,0x30,0x29,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x36,
+    0x34,0x33,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x69,0x7a,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x35,0x34,0x31,
+    0x2e,0x63,0x61,0x6d,0x5f,0x70,0x6f,0x73,0x29,0x20,0x2d,0x20,0x69,0x6e,0x2e,0x76,
+    0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x36,0x35,0x33,0x20,0x3d,0x20,0x66,0x61,
+    0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x5f,0x36,0x33,0x35,
+    0x2c,0x20,0x5f,0x36,0x34,0x33,0x29,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,
+    0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,0x35,0x35,0x31,
+    0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,0x35,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x36,0x35,0x37,
+    0x20,0x3d,0x20,0x5f,0x35,0x34,0x34,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x36,0x36,0x30,0x20,0x3d,0x20,0x6d,
+    0x69,0x78,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x30,0x33,0x39,0x39,
+    0x39,0x39,0x39,0x39,0x39,0x31,0x30,0x35,0x39,0x33,0x30,0x33,0x32,0x38,0x33,0x36,
+    0x39,0x31,0x34,0x30,0x36,0x32,0x35,0x29,0x2c,0x20,0x5f,0x36,0x35,0x37,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x35,0x35,0x39,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x36,0x36,0x35,0x20,0x3d,0x20,
+    0x31,0x2e,0x30,0x20,0x2d,0x20,0x5f,0x35,0x35,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x36,0x36,0x36,0x20,0x3d,0x20,0x5f,0x36,
+    0x35,0x37,0x20,0x2a,0x20,0x5f,0x36,0x36,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x5f,0x36,
+    0x33,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x5f,0x36,0x34,0x33,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x32,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x35,0x37,0x37,
+    0x33,0x35,0x30,0x32,0x35,0x38,0x38,0x32,0x37,0x32,0x30,0x39,0x34,0x37,0x32,0x36,
+    0x35,0x36,0x32,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x5f,0x36,0x36,0x30,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x5f,0x36,0x36,0x36,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,
+    0x20,0x5f,0x35,0x35,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x5f,0x35,0x36,0x37,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x37,0x20,0x3d,0x20,0x5f,0x36,0x35,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x4c,0x6f,0x20,0x3d,0x20,0x64,0x69,0x72,0x65,0x63,
+    0x74,0x4c,0x69,0x67,0x68,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,
+    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6c,0x69,0x70,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x32,0x20,0x5f,0x36,0x39,0x38,0x20,0x3d,0x20,0x63,
+    0x6c,0x75,0x73,0x74,0x65,0x72,0x4c,0x69,0x67,0x68,0x74,0x52,0x61,0x6e,0x67,0x65,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x2c,0x20,0x5f,0x39,0x33,0x2c,0x20,0x5f,
+    0x31,0x36,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6f,0x72,0x20,0x28,0x75,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x75,0x3b,
+    0x20,0x69,0x20,0x3c,0x20,0x5f,0x36,0x39,0x38,0x2e,0x79,0x3b,0x20,0x69,0x2b,0x2b,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x5f,0x37,0x32,0x34,0x20,0x3d,0x20,0x5f,0x36,0x39,0x38,
+    0x2e,0x78,0x20,0x2b,0x20,0x69,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x70,0x75,0x6e,0x63,0x74,0x75,0x61,0x6c,0x5f,0x6c,0x69,0x67,0x68,0x74,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,0x70,0x75,0x6e,0x63,0x74,0x75,0x61,
+    0x6c,0x5f,0x6c,0x69,0x67,0x68,0x74,0x7b,0x20,0x5f,0x37,0x31,0x35,0x2e,0x6c,0x69,
+    0x67,0x68,0x74,0x73,0x5b,0x5f,0x37,0x32,0x30,0x2e,0x6c,0x69,0x67,0x68,0x74,0x5f,
+    0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x5f,0x37,0x32,0x34,0x5d,0x2e,0x6c,0x69,
+    0x67,0x68,0x74,0x5d,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x72,0x61,
+    0x6e,0x67,0x65,0x2c,0x20,0x5f,0x37,0x31,0x35,0x2e,0x6c,0x69,0x67,0x68,0x74,0x73,
+    0x5b,0x5f,0x37,0x32,0x30,0x2e,0x6c,0x69,0x67,0x68,0x74,0x5f,0x69,0x6e,0x64,0x69,
+    0x63,0x65,0x73,0x5b,0x5f,0x37,0x32,0x34,0x5d,0x2e,0x6c,0x69,0x67,0x68,0x74,0x5d,
+    0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x73,0x63,0x61,0x6c,
+    0x65,0x2c,0x20,0x5f,0x37,0x31,0x35,0x2e,0x6c,0x69,0x67,0x68,0x74,0x73,0x5b,0x5f,
+    0x37,0x32,0x30,0x2e,0x6c,0x69,0x67,0x68,0x74,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,
+    0x73,0x5b,0x5f,0x37,0x32,0x34,0x5d,0x2e,0x6c,0x69,0x67,0x68,0x74,0x5d,0x2e,0x64,
+    0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x20,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x37,0x34,0x34,0x20,0x3d,0x20,0x70,0x75,0x6e,0x63,0x74,0x75,0x61,0x6c,0x41,
+    0x74,0x74,0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x39,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x5f,0x37,0x34,0x34,0x20,0x3e,0x20,0x30,0x2e,0x30,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x32,0x20,0x3d,0x20,0x5f,0x36,0x33,0x35,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x20,0x3d,0x20,0x5f,0x36,0x34,
+    0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x34,0x20,0x3d,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x35,0x20,0x3d,0x20,0x5f,0x36,0x36,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x36,0x20,0x3d,0x20,0x5f,0x36,0x36,
+    0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x37,0x20,0x3d,0x20,
+    0x5f,0x35,0x35,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x38,
+    0x20,0x3d,0x20,0x5f,0x35,0x36,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x39,0x20,0x3d,0x20,0x5f,0x36,0x35,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x4c,0x6f,0x20,0x2b,0x3d,0x20,0x28,0x28,
+    0x64,0x69,0x72,0x65,0x63,0x74,0x4c,0x69,0x67,0x68,0x74,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x2c,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x36,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x37,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x38,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x39,0x29,0x20,0x2a,0x20,0x5f,0x37,
+    0x31,0x35,0x2e,0x6c,0x69,0x67,0x68,0x74,0x73,0x5b,0x5f,0x37,0x32,0x30,0x2e,0x6c,
+    0x69,0x67,0x68,0x74,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x5f,0x37,0x32,
+    0x34,0x5d,0x2e,0x6c,0x69,0x67,0x68,0x74,0x5d,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x5f,
+    0x73,0x70,0x6f,0x74,0x5f,0x73,0x63,0x61,0x6c,0x65,0x2e,0x78,0x79,0x7a,0x29,0x20,
+    0x2a,0x20,0x5f,0x37,0x34,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x30,0x20,0x3d,0x20,0x5f,0x36,
+    0x35,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x32,0x31,0x20,0x3d,0x20,0x5f,0x36,0x36,0x30,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x32,0x32,0x20,0x3d,0x20,0x5f,0x35,0x36,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x37,0x38,0x34,0x20,0x3d,0x20,0x46,0x5f,0x53,
+    0x63,0x68,0x6c,0x69,0x63,0x6b,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x30,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x32,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x32,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x38,0x33,0x31,0x20,0x3d,
+    0x20,0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x28,0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x5f,0x36,0x35,0x33,0x2c,0x20,0x5f,0x35,0x36,0x37,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x32,0x33,0x20,0x3d,0x20,0x28,0x28,0x28,0x28,0x28,0x28,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x2e,0x30,0x29,0x20,0x2d,0x20,0x5f,0x37,
+    0x38,0x34,0x29,0x20,0x2a,0x20,0x5f,0x36,0x36,0x35,0x29,0x20,0x2a,0x20,0x28,0x28,
+    0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5f,0x6d,0x61,0x70,0x2e,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,
+    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x5f,0x36,0x33,0x35,0x29,0x2e,0x78,0x79,0x7a,0x20,
+    0x2a,0x20,0x5f,0x36,0x36,0x36,0x29,0x20,0x2a,0x20,0x30,0x2e,0x33,0x30,0x30,0x30,
+    0x30,0x30,0x30,0x31,0x31,0x39,0x32,0x30,0x39,0x32,0x38,0x39,0x35,0x35,0x30,0x37,
+    0x38,0x31,0x32,0x35,0x29,0x29,0x20,0x2b,0x20,0x28,0x28,0x70,0x72,0x65,0x66,0x69,
+    0x6c,0x74,0x65,0x72,0x5f,0x6d,0x61,0x70,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,
+    0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x72,
+    0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x5f,0x36,0x34,0x33,0x2c,0x20,0x5f,0x36,
+    0x33,0x35,0x29,0x2c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x28,0x5f,0x35,0x36,0x37,0x20,
+    0x2a,0x20,0x34,0x2e,0x30,0x29,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x28,0x28,
+    0x5f,0x37,0x38,0x34,0x20,0x2a,0x20,0x5f,0x38,0x33,0x31,0x2e,0x78,0x29,0x20,0x2b,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x38,0x33,0x31,0x2e,0x79,0x29,0x29,
+    0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x29,0x29,0x20,0x2a,0x20,0x28,0x6f,0x63,0x63,
+    0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x74,0x65,0x78,0x2e,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x28,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x73,0x6d,0x70,0x2c,
+    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x29,0x2e,0x78,0x20,0x2a,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x29,0x29,0x20,0x2b,
+    0x20,0x4c,0x6f,0x29,0x20,0x2b,0x20,0x28,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,
+    0x5f,0x74,0x65,0x78,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x65,0x6d,0x69,0x73,
+    0x73,0x69,0x76,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,
+    0x76,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,
+    0x5f,0x35,0x34,0x31,0x2e,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x66,0x61,
+    0x63,0x74,0x6f,0x72,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x34,0x20,0x3d,0x20,0x41,0x43,
+    0x45,0x53,0x46,0x69,0x6c,0x6d,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x33,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x6c,0x69,
+    0x6e,0x65,0x61,0x72,0x54,0x6f,0x53,0x52,0x47,0x42,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x32,0x34,0x29,0x2c,0x20,0x5f,0x35,0x34,0x34,0x2e,0x77,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x00,
+};
+/*
+    #version 460
+
+    layout(set = 0, binding = 0, std140) uniform vs_params
+    {
+        mat4 mvp;
+        mat4 model;
+        mat4 normal_matrix;
+        vec3 cam_pos;
+        float _pad0;
+    } _14;
+
+    layout(location = 0) out vec3 v_world_pos;
+    layout(location = 0) in vec3 pos;
+    layout(location = 1) out vec3 v_normal;
+    layout(location = 1) in vec3 normal;
+    layout(location = 2) out vec3 v_tangent;
+    layout(location = 3) in vec4 tangent;
+    layout(location = 3) out vec3 v_bitangent;
+    layout(location = 4) out vec2 v_uv;
+    layout(location = 2) in vec2 uv;
+    layout(location = 5) out float v_occlusion;
+    layout(location = 4) in float occlusion;
+
+    void main()
+    {
+        vec4 _27 = vec4(pos, 1.0);
+        v_world_pos = (_14.model * _27).xyz;
+        v_normal = normalize((_14.normal_matrix * vec4(normal, 0.0)).xyz);
+        v_tangent = normalize((_14.normal_matrix * vec4(tangent.xyz, 0.0)).xyz);
+        v_bitangent = cross(v_normal, v_tangent) * tangent.w;
+        v_uv = uv;
+        v_occlusion = occlusion;
+        gl_Position = _14.mvp * _27;
+    }
+
+*/
+static const uint8_t pbr_vs_bytecode_spirv_vk[2936] = {
+    0x03,0x02,0x23,0x07,0x00,0x04,0x01,0x00,0x0b,0x00,0x08,0x00,0x5d,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x11,0x00,0x02,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x06,0x00,
+    0x01,0x00,0x00,0x00,0x47,0x4c,0x53,0x4c,0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,
+    0x00,0x00,0x00,0x00,0x0e,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x0f,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6d,0x61,0x69,0x6e,
+    0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0x33,0x00,0x00,0x00,
+    0x3d,0x00,0x00,0x00,0x49,0x00,0x00,0x00,0x4b,0x00,0x00,0x00,0x4e,0x00,0x00,0x00,
+    0x4f,0x00,0x00,0x00,0x55,0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x00,0x00,
+    0xcc,0x01,0x00,0x00,0x05,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x6d,0x61,0x69,0x6e,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x09,0x00,0x00,0x00,0x5f,0x32,0x37,0x00,
+    0x05,0x00,0x03,0x00,0x0c,0x00,0x00,0x00,0x70,0x6f,0x73,0x00,0x05,0x00,0x05,0x00,
+    0x14,0x00,0x00,0x00,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x00,
+    0x05,0x00,0x05,0x00,0x16,0x00,0x00,0x00,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x00,0x00,0x00,0x06,0x00,0x04,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x6d,0x76,0x70,0x00,0x06,0x00,0x05,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x6d,0x6f,0x64,0x65,0x6c,0x00,0x00,0x00,0x06,0x00,0x07,0x00,0x16,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x6d,0x61,0x74,0x72,0x69,
+    0x78,0x00,0x00,0x00,0x06,0x00,0x05,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x63,0x61,0x6d,0x5f,0x70,0x6f,0x73,0x00,0x06,0x00,0x05,0x00,0x16,0x00,0x00,0x00,
+    0x04,0x00,0x00,0x00,0x5f,0x70,0x61,0x64,0x30,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
+    0x18,0x00,0x00,0x00,0x5f,0x31,0x34,0x00,0x05,0x00,0x05,0x00,0x21,0x00,0x00,0x00,
+    0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x25,0x00,0x00,0x00,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x00,0x00,0x05,0x00,0x05,0x00,
+    0x2f,0x00,0x00,0x00,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x33,0x00,0x00,0x00,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x00,
+    0x05,0x00,0x05,0x00,0x3d,0x00,0x00,0x00,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,
+    0x65,0x6e,0x74,0x00,0x05,0x00,0x04,0x00,0x49,0x00,0x00,0x00,0x76,0x5f,0x75,0x76,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x4b,0x00,0x00,0x00,0x75,0x76,0x00,0x00,
+    0x05,0x00,0x05,0x00,0x4e,0x00,0x00,0x00,0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,
+    0x69,0x6f,0x6e,0x00,0x05,0x00,0x05,0x00,0x4f,0x00,0x00,0x00,0x6f,0x63,0x63,0x6c,
+    0x75,0x73,0x69,0x6f,0x6e,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0x53,0x00,0x00,0x00,
+    0x67,0x6c,0x5f,0x50,0x65,0x72,0x56,0x65,0x72,0x74,0x65,0x78,0x00,0x00,0x00,0x00,
+    0x06,0x00,0x06,0x00,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x6c,0x5f,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x00,0x06,0x00,0x07,0x00,0x53,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,
+    0x00,0x00,0x00,0x00,0x06,0x00,0x07,0x00,0x53,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x67,0x6c,0x5f,0x43,0x6c,0x69,0x70,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x00,
+    0x06,0x00,0x07,0x00,0x53,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x67,0x6c,0x5f,0x43,
+    0x75,0x6c,0x6c,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x00,0x05,0x00,0x03,0x00,
+    0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x14,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x03,0x00,0x16,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x48,0x00,0x04,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x16,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x04,0x00,
+    0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
+    0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+    0x48,0x00,0x05,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+    0x40,0x00,0x00,0x00,0x48,0x00,0x04,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x05,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x16,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
+    0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,
+    0x48,0x00,0x05,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+    0xcc,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x22,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x21,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x25,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x2f,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x33,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x3d,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x49,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,
+    0x04,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x4b,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x4e,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,
+    0x05,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x4f,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,
+    0x04,0x00,0x00,0x00,0x47,0x00,0x03,0x00,0x53,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x48,0x00,0x05,0x00,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x53,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x0b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x53,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
+    0x53,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x13,0x00,0x02,0x00,0x02,0x00,0x00,0x00,0x21,0x00,0x03,0x00,0x03,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x16,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
+    0x17,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x17,0x00,0x04,0x00,0x0a,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x0b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x0b,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x80,0x3f,
+    0x20,0x00,0x04,0x00,0x13,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x13,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x18,0x00,0x04,0x00,0x15,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x1e,0x00,0x07,0x00,0x16,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+    0x15,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x15,0x00,0x04,0x00,
+    0x19,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,
+    0x19,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
+    0x1b,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x13,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,
+    0x19,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x0b,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x13,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
+    0x32,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x32,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x13,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x15,0x00,0x04,0x00,
+    0x41,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,
+    0x41,0x00,0x00,0x00,0x42,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
+    0x43,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x17,0x00,0x04,0x00,
+    0x47,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
+    0x48,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x48,0x00,0x00,0x00,0x49,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
+    0x4a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x4a,0x00,0x00,0x00,0x4b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
+    0x4d,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x4d,0x00,0x00,0x00,0x4e,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x43,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,
+    0x41,0x00,0x00,0x00,0x51,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1c,0x00,0x04,0x00,
+    0x52,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x51,0x00,0x00,0x00,0x1e,0x00,0x06,0x00,
+    0x53,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x52,0x00,0x00,0x00,
+    0x52,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x54,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x53,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x54,0x00,0x00,0x00,0x55,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x56,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x5b,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x36,0x00,0x05,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x05,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x0a,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,
+    0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+    0x0d,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x11,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x50,0x00,0x07,0x00,
+    0x07,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+    0x11,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x09,0x00,0x00,0x00,
+    0x12,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x1b,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x15,0x00,0x00,0x00,
+    0x1d,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x91,0x00,0x05,0x00,0x07,0x00,0x00,0x00,
+    0x1f,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x4f,0x00,0x08,0x00,
+    0x0a,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x14,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x1b,0x00,0x00,0x00,
+    0x23,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x15,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x0a,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x26,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,
+    0x26,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x50,0x00,0x07,0x00,0x07,0x00,0x00,0x00,
+    0x2b,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,
+    0x27,0x00,0x00,0x00,0x91,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,
+    0x24,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x4f,0x00,0x08,0x00,0x0a,0x00,0x00,0x00,
+    0x2d,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0c,0x00,0x06,0x00,0x0a,0x00,0x00,0x00,
+    0x2e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x21,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
+    0x1b,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x22,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x15,0x00,0x00,0x00,0x31,0x00,0x00,0x00,0x30,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x33,0x00,0x00,0x00,
+    0x4f,0x00,0x08,0x00,0x0a,0x00,0x00,0x00,0x35,0x00,0x00,0x00,0x34,0x00,0x00,0x00,
+    0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x35,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x37,0x00,0x00,0x00,
+    0x35,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x38,0x00,0x00,0x00,0x35,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x50,0x00,0x07,0x00,
+    0x07,0x00,0x00,0x00,0x39,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x37,0x00,0x00,0x00,
+    0x38,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x91,0x00,0x05,0x00,0x07,0x00,0x00,0x00,
+    0x3a,0x00,0x00,0x00,0x31,0x00,0x00,0x00,0x39,0x00,0x00,0x00,0x4f,0x00,0x08,0x00,
+    0x0a,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0c,0x00,0x06,0x00,
+    0x0a,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x45,0x00,0x00,0x00,
+    0x3b,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x2f,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x0a,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x0a,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,
+    0x0c,0x00,0x07,0x00,0x0a,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x44,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
+    0x43,0x00,0x00,0x00,0x44,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x42,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x44,0x00,0x00,0x00,
+    0x8e,0x00,0x05,0x00,0x0a,0x00,0x00,0x00,0x46,0x00,0x00,0x00,0x40,0x00,0x00,0x00,
+    0x45,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x3d,0x00,0x00,0x00,0x46,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x47,0x00,0x00,0x00,0x4c,0x00,0x00,0x00,0x4b,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x49,0x00,0x00,0x00,0x4c,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x4e,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x1b,0x00,0x00,0x00,
+    0x57,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x56,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x15,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x57,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x91,0x00,0x05,0x00,
+    0x07,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x59,0x00,0x00,0x00,
+    0x41,0x00,0x05,0x00,0x5b,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x55,0x00,0x00,0x00,
+    0x56,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x5c,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,
+    0xfd,0x00,0x01,0x00,0x38,0x00,0x01,0x00,
+};
+/*
+    #version 460
+
+    layout(set = 0, binding = 1, std140) uniform fs_params
+    {
+        vec4 base_color_factor;
+        float metallic_factor;
+        float roughness_factor;
+        vec3 emissive_factor;
+        float _pad0;
+        vec3 cam_pos;
+        float _pad1;
+    } _373;
+
+    layout(set = 1, binding = 0) uniform texture2D base_color_tex;
+    layout(set = 1, binding = 32) uniform sampler base_color_smp;
+    layout(set = 1, binding = 1) uniform texture2D metallic_roughness_tex;
+    layout(set = 1, binding = 33) uniform sampler metallic_roughness_smp;
+    layout(set = 1, binding = 3) uniform texture2D occlusion_tex;
+    layout(set = 1, binding = 35) uniform sampler occlusion_smp;
+    layout(set = 1, binding = 4) uniform texture2D emissive_tex;
+    layout(set = 1, binding = 36) uniform sampler emissive_smp;
+    layout(set = 1, binding = 2) uniform texture2D normal_tex;
+    layout(set = 1, binding = 34) uniform sampler normal_smp;
+    layout(set = 1, binding = 5) uniform textureCube irradiance_map;
+    layout(set = 1, binding = 37) uniform sampler irradiance_smp;
+    layout(set = 1, binding = 6) uniform textureCube prefilter_map;
+    layout(set = 1, binding = 38) uniform sampler prefilter_smp;
+    layout(set = 1, binding = 7) uniform texture2D brdf_lut;
+    layout(set = 1, binding = 39) uniform sampler brdf_lut_smp;
+
+    layout(location = 4) in vec2 v_uv;
+    layout(location = 5) in float v_occlusion;
+    layout(location = 2) in vec3 v_tangent;
+    layout(location = 3) in vec3 v_bitangent;
+    layout(location = 1) in vec3 v_normal;
+    layout(location = 0) in vec3 v_world_pos;
+    layout(location = 0) out vec4 frag_color;
+
+    float D_GGX(float NdotH, float roughness)
+    {
+        float _141 = roughness * roughness;
+        float _145 = _141 * _141;
+        float _155 = ((NdotH * NdotH) * (_145 - 1.0)) + 1.0;
+        return _145 / ((3.1415927410125732421875 * _155) * _155);
+    }
+
+    float G_SmithGGX(float NdotV, float NdotL, float roughness)
+    {
+        float _168 = roughness * roughness;
+        float _172 = _168 * _168;
+        float _179 = 1.0 - _172;
+        return 0.5 / max((NdotL * sqrt(((NdotV * NdotV) * _179) + _172)) + (NdotV * sqrt(((NdotL * NdotL) * _179) + _172)), 9.9999997473787516355514526367188e-05);
+    }
+
+    float SchlickFresnel(float u)
+    {
+        float _126 = clamp(1.0 - u, 0.0, 1.0);
+        float _130 = _126 * _126;
+        return (_130 * _130) * _126;
+    }
+
+    vec3 F_Schlick(float VdotH, vec3 F0)
+    {
+        float param = VdotH;
+        return F0 + ((vec3(1.0) - F0) * SchlickFresnel(param));
+    }
+
+    float Fd_DisneyDiffuse(float NdotV, float NdotL, float LdotH, float roughness)
+    {
+        float _251 = (mix(0.0, 0.5, roughness) + (((2.0 * LdotH) * LdotH) * roughness)) - 1.0;
+        float param = NdotV;
+        float param_1 = NdotL;
+        return ((1.0 + (_251 * SchlickFresnel(param))) * (1.0 + (_251 * SchlickFresnel(param_1)))) * mix(1.0, 0.662251651287078857421875, roughness);
+    }
+
+    vec3 directLight(vec3 N, vec3 V, vec3 L, vec3 F0, vec3 diffuseColor, float metallic, float roughness, float NdotV)
+    {
+        vec3 _276 = normalize(V + L);
+        float _281 = max(dot(N, L), 9.9999997473787516355514526367188e-05);
+        float param = max(dot(N, _276), 0.0);
+        float param_1 = roughness;
+        float param_2 = NdotV;
+        float param_3 = _281;
+        float param_4 = roughness;
+        float param_5 = max(dot(V, _276), 0.0);
+        vec3 param_6 = F0;
+        vec3 _316 = F_Schlick(param_5, param_6);
+        float param_7 = NdotV;
+        float param_8 = _281;
+        float param_9 = max(dot(L, _276), 0.0);
+        float param_10 = roughness;
+        return ((((vec3(1.0) - _316) * (1.0 - metallic)) * (diffuseColor * Fd_DisneyDiffuse(param_7, param_8, param_9, param_10))) + (_316 * (D_GGX(param, param_1) * G_SmithGGX(param_2, param_3, param_4)))) * _281;
+    }
+
+    vec3 F_SchlickRoughness(float NdotV, vec3 F0, float roughness)
+    {
+        float param = NdotV;
+        return F0 + ((max(vec3(1.0 - roughness), F0) - F0) * SchlickFresnel(param));
+    }
+
+    vec3 ACESFilm(vec3 x)
+    {
+        return clamp((x * ((x * 2.5099999904632568359375) + vec3(0.02999999932944774627685546875))) / ((x * ((x * 2.4300000667572021484375) + vec3(0.589999973773956298828125))) + vec3(0.14000000059604644775390625)), vec3(0.0), vec3(1.0));
+    }
+
+    vec3 linearToSRGB(vec3 c)
+    {
+        return mix(c * 12.9200000762939453125, (pow(max(c, vec3(0.0)), vec3(0.4166666567325592041015625)) * 1.05499994754791259765625) - vec3(0.054999999701976776123046875), step(vec3(0.003130800090730190277099609375), c));
+    }
+
+    void main()
+    {
+        vec4 _379 = texture(sampler2D(base_color_tex, base_color_smp), v_uv) * _373.base_color_factor;
+        vec4 _387 = texture(sampler2D(metallic_roughness_tex, metallic_roughness_smp), v_uv);
+        float _398 = _387.z * _373.metallic_factor;
+        float _408 = clamp(_387.y * _373.roughness_factor, 0.039999999105930328369140625, 1.0);
+        vec3 _477 = normalize(mat3(v_tangent, v_bitangent, v_normal) * ((texture(sampler2D(normal_tex, normal_smp), v_uv).xyz * 2.0) - vec3(1.0)));
+        vec3 _485 = normalize(_373.cam_pos - v_world_pos);
+        float _495 = max(dot(_477, _485), 9.9999997473787516355514526367188e-05);
+        vec3 _499 = _379.xyz;
+        vec3 _502 = mix(vec3(0.039999999105930328369140625), _499, vec3(_398));
+        float _507 = 1.0 - _398;
+        vec3 _508 = _499 * _507;
+        vec3 param = _477;
+        vec3 param_1 = _485;
+        vec3 param_2 = vec3(0.57735025882720947265625);
+        vec3 param_3 = _502;
+        vec3 param_4 = _508;
+        float param_5 = _398;
+        float param_6 = _408;
+        float param_7 = _495;
+        float param_8 = _495;
+        vec3 param_9 = _502;
+        float param_10 = _408;
+        vec3 _541 = F_SchlickRoughness(param_8, param_9, param_10);
+        vec4 _589 = texture(sampler2D(brdf_lut, brdf_lut_smp), vec2(_495, _408));
+        vec3 param_11 = ((((((vec3(1.0) - _541) * _507) * ((texture(samplerCube(irradiance_map, irradiance_smp), _477).xyz * _508) * 0.300000011920928955078125)) + ((textureLod(samplerCube(prefilter_map, prefilter_smp), reflect(-_485, _477), _408 * 4.0).xyz * ((_541 * _589.x) + vec3(_589.y))) * 0.5)) * (texture(sampler2D(occlusion_tex, occlusion_smp), v_uv).x * v_occlusion)) + directLight(param, param_1, param_2, param_3, param_4, param_5, param_6, param_7)) + (texture(sampler2D(emissive_tex, emissive_smp), v_uv).xyz * _373.emissive_factor);
+        vec3 param_12 = ACESFilm(param_11);
+        frag_color = vec4(linearToSRGB(param_12), _379.w);
+    }
+
+*/
+static const uint8_t pbr_fs_bytecode_spirv_vk[15292] = {
+    0x03,0x02,0x23,0x07,0x00,0x04,0x01,0x00,0x0b,0x00,0x08,0x00,0x59,0x02,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x11,0x00,0x02,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x06,0x00,
+    0x01,0x00,0x00,0x00,0x47,0x4c,0x53,0x4c,0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,
+    0x00,0x00,0x00,0x00,0x0e,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x0f,0x00,0x1d,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6d,0x61,0x69,0x6e,
+    0x00,0x00,0x00,0x00,0x53,0x01,0x00,0x00,0x57,0x01,0x00,0x00,0x5d,0x01,0x00,0x00,
+    0x62,0x01,0x00,0x00,0x6a,0x01,0x00,0x00,0x6c,0x01,0x00,0x00,0x87,0x01,0x00,0x00,
+    0x89,0x01,0x00,0x00,0x8b,0x01,0x00,0x00,0x9b,0x01,0x00,0x00,0x9d,0x01,0x00,0x00,
+    0xac,0x01,0x00,0x00,0xe5,0x01,0x00,0x00,0xe7,0x01,0x00,0x00,0xf5,0x01,0x00,0x00,
+    0xf7,0x01,0x00,0x00,0x03,0x02,0x00,0x00,0x05,0x02,0x00,0x00,0x1d,0x02,0x00,0x00,
+    0x1f,0x02,0x00,0x00,0x26,0x02,0x00,0x00,0x3c,0x02,0x00,0x00,0x3e,0x02,0x00,0x00,
+    0x4e,0x02,0x00,0x00,0x10,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x03,0x00,0x03,0x00,0x02,0x00,0x00,0x00,0xcc,0x01,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x04,0x00,0x00,0x00,0x6d,0x61,0x69,0x6e,0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,
+    0x0b,0x00,0x00,0x00,0x44,0x5f,0x47,0x47,0x58,0x28,0x66,0x31,0x3b,0x66,0x31,0x3b,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x09,0x00,0x00,0x00,0x4e,0x64,0x6f,0x74,
+    0x48,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x0a,0x00,0x00,0x00,0x72,0x6f,0x75,0x67,
+    0x68,0x6e,0x65,0x73,0x73,0x00,0x00,0x00,0x05,0x00,0x08,0x00,0x11,0x00,0x00,0x00,
+    0x47,0x5f,0x53,0x6d,0x69,0x74,0x68,0x47,0x47,0x58,0x28,0x66,0x31,0x3b,0x66,0x31,
+    0x3b,0x66,0x31,0x3b,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x0e,0x00,0x00,0x00,
+    0x4e,0x64,0x6f,0x74,0x56,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x0f,0x00,0x00,0x00,
+    0x4e,0x64,0x6f,0x74,0x4c,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x10,0x00,0x00,0x00,
+    0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x00,0x00,0x00,0x05,0x00,0x07,0x00,
+    0x15,0x00,0x00,0x00,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,
+    0x65,0x6c,0x28,0x66,0x31,0x3b,0x00,0x00,0x05,0x00,0x03,0x00,0x14,0x00,0x00,0x00,
+    0x75,0x00,0x00,0x00,0x05,0x00,0x07,0x00,0x1c,0x00,0x00,0x00,0x46,0x5f,0x53,0x63,
+    0x68,0x6c,0x69,0x63,0x6b,0x28,0x66,0x31,0x3b,0x76,0x66,0x33,0x3b,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x1a,0x00,0x00,0x00,0x56,0x64,0x6f,0x74,0x48,0x00,0x00,0x00,
+    0x05,0x00,0x03,0x00,0x1b,0x00,0x00,0x00,0x46,0x30,0x00,0x00,0x05,0x00,0x0a,0x00,
+    0x23,0x00,0x00,0x00,0x46,0x64,0x5f,0x44,0x69,0x73,0x6e,0x65,0x79,0x44,0x69,0x66,
+    0x66,0x75,0x73,0x65,0x28,0x66,0x31,0x3b,0x66,0x31,0x3b,0x66,0x31,0x3b,0x66,0x31,
+    0x3b,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x1f,0x00,0x00,0x00,0x4e,0x64,0x6f,0x74,
+    0x56,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x20,0x00,0x00,0x00,0x4e,0x64,0x6f,0x74,
+    0x4c,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x21,0x00,0x00,0x00,0x4c,0x64,0x6f,0x74,
+    0x48,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x22,0x00,0x00,0x00,0x72,0x6f,0x75,0x67,
+    0x68,0x6e,0x65,0x73,0x73,0x00,0x00,0x00,0x05,0x00,0x0d,0x00,0x2e,0x00,0x00,0x00,
+    0x64,0x69,0x72,0x65,0x63,0x74,0x4c,0x69,0x67,0x68,0x74,0x28,0x76,0x66,0x33,0x3b,
+    0x76,0x66,0x33,0x3b,0x76,0x66,0x33,0x3b,0x76,0x66,0x33,0x3b,0x76,0x66,0x33,0x3b,
+    0x66,0x31,0x3b,0x66,0x31,0x3b,0x66,0x31,0x3b,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
+    0x26,0x00,0x00,0x00,0x4e,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x27,0x00,0x00,0x00,
+    0x56,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x28,0x00,0x00,0x00,0x4c,0x00,0x00,0x00,
+    0x05,0x00,0x03,0x00,0x29,0x00,0x00,0x00,0x46,0x30,0x00,0x00,0x05,0x00,0x06,0x00,
+    0x2a,0x00,0x00,0x00,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x2b,0x00,0x00,0x00,0x6d,0x65,0x74,0x61,
+    0x6c,0x6c,0x69,0x63,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x2c,0x00,0x00,0x00,
+    0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x2d,0x00,0x00,0x00,0x4e,0x64,0x6f,0x74,0x56,0x00,0x00,0x00,0x05,0x00,0x0a,0x00,
+    0x34,0x00,0x00,0x00,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x52,0x6f,0x75,
+    0x67,0x68,0x6e,0x65,0x73,0x73,0x28,0x66,0x31,0x3b,0x76,0x66,0x33,0x3b,0x66,0x31,
+    0x3b,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x31,0x00,0x00,0x00,0x4e,0x64,0x6f,0x74,
+    0x56,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x32,0x00,0x00,0x00,0x46,0x30,0x00,0x00,
+    0x05,0x00,0x05,0x00,0x33,0x00,0x00,0x00,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,
+    0x73,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0x38,0x00,0x00,0x00,0x41,0x43,0x45,0x53,
+    0x46,0x69,0x6c,0x6d,0x28,0x76,0x66,0x33,0x3b,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
+    0x37,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x05,0x00,0x07,0x00,0x3b,0x00,0x00,0x00,
+    0x6c,0x69,0x6e,0x65,0x61,0x72,0x54,0x6f,0x53,0x52,0x47,0x42,0x28,0x76,0x66,0x33,
+    0x3b,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x3a,0x00,0x00,0x00,0x63,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x3d,0x00,0x00,0x00,0x5f,0x31,0x34,0x31,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x41,0x00,0x00,0x00,0x5f,0x31,0x34,0x35,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x45,0x00,0x00,0x00,0x5f,0x31,0x35,0x35,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x57,0x00,0x00,0x00,0x5f,0x31,0x36,0x38,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x5b,0x00,0x00,0x00,0x5f,0x31,0x37,0x32,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x5f,0x00,0x00,0x00,0x5f,0x31,0x37,0x39,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x7d,0x00,0x00,0x00,0x5f,0x31,0x32,0x36,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x82,0x00,0x00,0x00,0x5f,0x31,0x33,0x30,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x8d,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x93,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x9a,0x00,0x00,0x00,0x5f,0x32,0x35,0x31,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0xa6,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0xa8,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x00,
+    0x05,0x00,0x04,0x00,0xab,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0xb1,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0xbd,0x00,0x00,0x00,0x5f,0x32,0x37,0x36,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0xc2,0x00,0x00,0x00,0x5f,0x32,0x38,0x31,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0xc7,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0xcc,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x00,
+    0x05,0x00,0x04,0x00,0xce,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x00,
+    0x05,0x00,0x04,0x00,0xd0,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x00,
+    0x05,0x00,0x04,0x00,0xd2,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x00,
+    0x05,0x00,0x04,0x00,0xd4,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x00,
+    0x05,0x00,0x04,0x00,0xd9,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x00,
+    0x05,0x00,0x04,0x00,0xdb,0x00,0x00,0x00,0x5f,0x33,0x31,0x36,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0xdc,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0xde,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0xe1,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x00,
+    0x05,0x00,0x04,0x00,0xe3,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x00,
+    0x05,0x00,0x04,0x00,0xe5,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x00,
+    0x05,0x00,0x05,0x00,0xea,0x00,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xf2,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xf4,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xf6,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xf8,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xfe,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x00,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x03,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x05,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x07,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x11,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x1b,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x50,0x01,0x00,0x00,0x5f,0x33,0x37,0x39,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0x53,0x01,0x00,0x00,0x62,0x61,0x73,0x65,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x74,0x65,0x78,0x00,0x00,0x05,0x00,0x06,0x00,
+    0x57,0x01,0x00,0x00,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,
+    0x6d,0x70,0x00,0x00,0x05,0x00,0x04,0x00,0x5d,0x01,0x00,0x00,0x76,0x5f,0x75,0x76,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x60,0x01,0x00,0x00,0x66,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x00,0x00,0x00,0x06,0x00,0x08,0x00,0x60,0x01,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x66,
+    0x61,0x63,0x74,0x6f,0x72,0x00,0x00,0x00,0x06,0x00,0x07,0x00,0x60,0x01,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x66,0x61,0x63,
+    0x74,0x6f,0x72,0x00,0x06,0x00,0x08,0x00,0x60,0x01,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,
+    0x00,0x00,0x00,0x00,0x06,0x00,0x07,0x00,0x60,0x01,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x00,
+    0x06,0x00,0x05,0x00,0x60,0x01,0x00,0x00,0x04,0x00,0x00,0x00,0x5f,0x70,0x61,0x64,
+    0x30,0x00,0x00,0x00,0x06,0x00,0x05,0x00,0x60,0x01,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x63,0x61,0x6d,0x5f,0x70,0x6f,0x73,0x00,0x06,0x00,0x05,0x00,0x60,0x01,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x5f,0x70,0x61,0x64,0x31,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x62,0x01,0x00,0x00,0x5f,0x33,0x37,0x33,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x69,0x01,0x00,0x00,0x5f,0x33,0x38,0x37,0x00,0x00,0x00,0x00,0x05,0x00,0x08,0x00,
+    0x6a,0x01,0x00,0x00,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x72,0x6f,0x75,
+    0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x74,0x65,0x78,0x00,0x00,0x05,0x00,0x08,0x00,
+    0x6c,0x01,0x00,0x00,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x72,0x6f,0x75,
+    0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x73,0x6d,0x70,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x71,0x01,0x00,0x00,0x5f,0x33,0x39,0x38,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x7b,0x01,0x00,0x00,0x5f,0x34,0x30,0x38,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x85,0x01,0x00,0x00,0x5f,0x34,0x37,0x37,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,
+    0x87,0x01,0x00,0x00,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x00,0x00,0x00,
+    0x05,0x00,0x05,0x00,0x89,0x01,0x00,0x00,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,
+    0x65,0x6e,0x74,0x00,0x05,0x00,0x05,0x00,0x8b,0x01,0x00,0x00,0x76,0x5f,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x9b,0x01,0x00,0x00,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x74,0x65,0x78,0x00,0x00,0x05,0x00,0x05,0x00,
+    0x9d,0x01,0x00,0x00,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x73,0x6d,0x70,0x00,0x00,
+    0x05,0x00,0x04,0x00,0xa7,0x01,0x00,0x00,0x5f,0x34,0x38,0x35,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x05,0x00,0xac,0x01,0x00,0x00,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,
+    0x70,0x6f,0x73,0x00,0x05,0x00,0x04,0x00,0xb0,0x01,0x00,0x00,0x5f,0x34,0x39,0x35,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xb5,0x01,0x00,0x00,0x5f,0x34,0x39,0x39,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xb8,0x01,0x00,0x00,0x5f,0x35,0x30,0x32,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xbe,0x01,0x00,0x00,0x5f,0x35,0x30,0x37,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xc1,0x01,0x00,0x00,0x5f,0x35,0x30,0x38,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xc5,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xc7,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x00,0x05,0x00,0x04,0x00,0xc9,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x32,0x00,0x05,0x00,0x04,0x00,0xcc,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x33,0x00,0x05,0x00,0x04,0x00,0xce,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x34,0x00,0x05,0x00,0x04,0x00,0xd0,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x35,0x00,0x05,0x00,0x04,0x00,0xd2,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x36,0x00,0x05,0x00,0x04,0x00,0xd4,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x37,0x00,0x05,0x00,0x04,0x00,0xd6,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x38,0x00,0x05,0x00,0x04,0x00,0xd8,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x39,0x00,0x05,0x00,0x05,0x00,0xda,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x30,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xdc,0x01,0x00,0x00,
+    0x5f,0x35,0x34,0x31,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xdd,0x01,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xdf,0x01,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xe1,0x01,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xe4,0x01,0x00,0x00,
+    0x5f,0x35,0x38,0x39,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0xe5,0x01,0x00,0x00,
+    0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,
+    0xe7,0x01,0x00,0x00,0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,0x5f,0x73,0x6d,0x70,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0xee,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x31,0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0xf5,0x01,0x00,0x00,
+    0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5f,0x6d,0x61,0x70,0x00,0x00,
+    0x05,0x00,0x06,0x00,0xf7,0x01,0x00,0x00,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,
+    0x63,0x65,0x5f,0x73,0x6d,0x70,0x00,0x00,0x05,0x00,0x06,0x00,0x03,0x02,0x00,0x00,
+    0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,0x6d,0x61,0x70,0x00,0x00,0x00,
+    0x05,0x00,0x06,0x00,0x05,0x02,0x00,0x00,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,
+    0x72,0x5f,0x73,0x6d,0x70,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0x1d,0x02,0x00,0x00,
+    0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x74,0x65,0x78,0x00,0x00,0x00,
+    0x05,0x00,0x06,0x00,0x1f,0x02,0x00,0x00,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,
+    0x6e,0x5f,0x73,0x6d,0x70,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x26,0x02,0x00,0x00,
+    0x76,0x5f,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x00,0x05,0x00,0x04,0x00,
+    0x2a,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x2c,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x2e,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x30,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x32,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x34,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x36,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x38,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x06,0x00,
+    0x3c,0x02,0x00,0x00,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x74,0x65,0x78,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0x3e,0x02,0x00,0x00,0x65,0x6d,0x69,0x73,
+    0x73,0x69,0x76,0x65,0x5f,0x73,0x6d,0x70,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,
+    0x49,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x4a,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,
+    0x05,0x00,0x05,0x00,0x4e,0x02,0x00,0x00,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,
+    0x6f,0x72,0x00,0x00,0x05,0x00,0x04,0x00,0x4f,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x53,0x01,0x00,0x00,0x21,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x53,0x01,0x00,0x00,0x22,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x57,0x01,0x00,0x00,0x21,0x00,0x00,0x00,
+    0x20,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x57,0x01,0x00,0x00,0x22,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x5d,0x01,0x00,0x00,0x1e,0x00,0x00,0x00,
+    0x04,0x00,0x00,0x00,0x47,0x00,0x03,0x00,0x60,0x01,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x48,0x00,0x05,0x00,0x60,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x60,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x23,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x60,0x01,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
+    0x60,0x01,0x00,0x00,0x03,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
+    0x48,0x00,0x05,0x00,0x60,0x01,0x00,0x00,0x04,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+    0x2c,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x60,0x01,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x23,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x60,0x01,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x62,0x01,0x00,0x00,0x21,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x62,0x01,0x00,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x6a,0x01,0x00,0x00,0x21,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x6a,0x01,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x6c,0x01,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x6c,0x01,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x87,0x01,0x00,0x00,0x1e,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x89,0x01,0x00,0x00,0x1e,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x8b,0x01,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x9b,0x01,0x00,0x00,0x21,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x9b,0x01,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x9d,0x01,0x00,0x00,0x21,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x9d,0x01,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0xac,0x01,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0xe5,0x01,0x00,0x00,0x21,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0xe5,0x01,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0xe7,0x01,0x00,0x00,0x21,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0xe7,0x01,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0xf5,0x01,0x00,0x00,0x21,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0xf5,0x01,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0xf7,0x01,0x00,0x00,0x21,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0xf7,0x01,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x03,0x02,0x00,0x00,0x21,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x03,0x02,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x05,0x02,0x00,0x00,0x21,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x05,0x02,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x1d,0x02,0x00,0x00,0x21,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x1d,0x02,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x1f,0x02,0x00,0x00,0x21,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x1f,0x02,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x26,0x02,0x00,0x00,0x1e,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x3c,0x02,0x00,0x00,0x21,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x3c,0x02,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x3e,0x02,0x00,0x00,0x21,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x3e,0x02,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x4e,0x02,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x02,0x00,
+    0x02,0x00,0x00,0x00,0x21,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x16,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x21,0x00,0x05,0x00,
+    0x08,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x21,0x00,0x06,0x00,0x0d,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x21,0x00,0x04,0x00,0x13,0x00,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x17,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x18,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x21,0x00,0x05,0x00,0x19,0x00,0x00,0x00,
+    0x17,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x21,0x00,0x07,0x00,
+    0x1e,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x21,0x00,0x0b,0x00,0x25,0x00,0x00,0x00,
+    0x17,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x21,0x00,0x06,0x00,0x30,0x00,0x00,0x00,0x17,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x21,0x00,0x04,0x00,
+    0x36,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x00,0x00,0x80,0x3f,0x2b,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0xdb,0x0f,0x49,0x40,0x2b,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x2b,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x17,0xb7,0xd1,0x38,0x2b,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x06,0x00,
+    0x17,0x00,0x00,0x00,0x90,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,
+    0x4a,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x9d,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x40,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xb7,0x00,0x00,0x00,
+    0x53,0x89,0x29,0x3f,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x24,0x01,0x00,0x00,
+    0xd7,0xa3,0x20,0x40,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x26,0x01,0x00,0x00,
+    0x8f,0xc2,0xf5,0x3c,0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0x27,0x01,0x00,0x00,
+    0x26,0x01,0x00,0x00,0x26,0x01,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x2c,0x01,0x00,0x00,0x1f,0x85,0x1b,0x40,0x2b,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x2e,0x01,0x00,0x00,0x3d,0x0a,0x17,0x3f,0x2c,0x00,0x06,0x00,
+    0x17,0x00,0x00,0x00,0x2f,0x01,0x00,0x00,0x2e,0x01,0x00,0x00,0x2e,0x01,0x00,0x00,
+    0x2e,0x01,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x32,0x01,0x00,0x00,
+    0x29,0x5c,0x0f,0x3e,0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0x33,0x01,0x00,0x00,
+    0x32,0x01,0x00,0x00,0x32,0x01,0x00,0x00,0x32,0x01,0x00,0x00,0x2c,0x00,0x06,0x00,
+    0x17,0x00,0x00,0x00,0x36,0x01,0x00,0x00,0x80,0x00,0x00,0x00,0x80,0x00,0x00,0x00,
+    0x80,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x3b,0x01,0x00,0x00,
+    0x52,0xb8,0x4e,0x41,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x3f,0x01,0x00,0x00,
+    0x55,0x55,0xd5,0x3e,0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0x40,0x01,0x00,0x00,
+    0x3f,0x01,0x00,0x00,0x3f,0x01,0x00,0x00,0x3f,0x01,0x00,0x00,0x2b,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x42,0x01,0x00,0x00,0x3d,0x0a,0x87,0x3f,0x2b,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x44,0x01,0x00,0x00,0xae,0x47,0x61,0x3d,0x2c,0x00,0x06,0x00,
+    0x17,0x00,0x00,0x00,0x45,0x01,0x00,0x00,0x44,0x01,0x00,0x00,0x44,0x01,0x00,0x00,
+    0x44,0x01,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x47,0x01,0x00,0x00,
+    0x1c,0x2e,0x4d,0x3b,0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0x48,0x01,0x00,0x00,
+    0x47,0x01,0x00,0x00,0x47,0x01,0x00,0x00,0x47,0x01,0x00,0x00,0x17,0x00,0x04,0x00,
+    0x4e,0x01,0x00,0x00,0x06,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
+    0x4f,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x4e,0x01,0x00,0x00,0x19,0x00,0x09,0x00,
+    0x51,0x01,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x52,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x01,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x52,0x01,0x00,0x00,0x53,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x1a,0x00,0x02,0x00,0x55,0x01,0x00,0x00,0x20,0x00,0x04,0x00,0x56,0x01,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x55,0x01,0x00,0x00,0x3b,0x00,0x04,0x00,0x56,0x01,0x00,0x00,
+    0x57,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x00,0x03,0x00,0x59,0x01,0x00,0x00,
+    0x51,0x01,0x00,0x00,0x17,0x00,0x04,0x00,0x5b,0x01,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x5c,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x5b,0x01,0x00,0x00,0x3b,0x00,0x04,0x00,0x5c,0x01,0x00,0x00,0x5d,0x01,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x1e,0x00,0x09,0x00,0x60,0x01,0x00,0x00,0x4e,0x01,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x17,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x61,0x01,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x60,0x01,0x00,0x00,0x3b,0x00,0x04,0x00,0x61,0x01,0x00,0x00,
+    0x62,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x15,0x00,0x04,0x00,0x63,0x01,0x00,0x00,
+    0x20,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x63,0x01,0x00,0x00,
+    0x64,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x65,0x01,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x4e,0x01,0x00,0x00,0x3b,0x00,0x04,0x00,0x52,0x01,0x00,0x00,
+    0x6a,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x56,0x01,0x00,0x00,
+    0x6c,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x04,0x00,0x72,0x01,0x00,0x00,
+    0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x72,0x01,0x00,0x00,
+    0x73,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x63,0x01,0x00,0x00,
+    0x76,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x77,0x01,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x72,0x01,0x00,0x00,
+    0x7c,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x63,0x01,0x00,0x00,
+    0x7f,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x83,0x01,0x00,0x00,0x0a,0xd7,0x23,0x3d,0x20,0x00,0x04,0x00,0x86,0x01,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x86,0x01,0x00,0x00,
+    0x87,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x86,0x01,0x00,0x00,
+    0x89,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x86,0x01,0x00,0x00,
+    0x8b,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x18,0x00,0x04,0x00,0x8d,0x01,0x00,0x00,
+    0x17,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x52,0x01,0x00,0x00,
+    0x9b,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x56,0x01,0x00,0x00,
+    0x9d,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x63,0x01,0x00,0x00,
+    0xa8,0x01,0x00,0x00,0x05,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0xa9,0x01,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x86,0x01,0x00,0x00,
+    0xac,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,
+    0xb9,0x01,0x00,0x00,0x83,0x01,0x00,0x00,0x83,0x01,0x00,0x00,0x83,0x01,0x00,0x00,
+    0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xca,0x01,0x00,0x00,0x3a,0xcd,0x13,0x3f,
+    0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0xcb,0x01,0x00,0x00,0xca,0x01,0x00,0x00,
+    0xca,0x01,0x00,0x00,0xca,0x01,0x00,0x00,0x3b,0x00,0x04,0x00,0x52,0x01,0x00,0x00,
+    0xe5,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x56,0x01,0x00,0x00,
+    0xe7,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x00,0x09,0x00,0xf3,0x01,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
+    0xf4,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xf3,0x01,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0xf4,0x01,0x00,0x00,0xf5,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x56,0x01,0x00,0x00,0xf7,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x00,0x03,0x00,
+    0xf9,0x01,0x00,0x00,0xf3,0x01,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x00,0x02,0x00,0x00,0x9a,0x99,0x99,0x3e,0x3b,0x00,0x04,0x00,0xf4,0x01,0x00,0x00,
+    0x03,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x56,0x01,0x00,0x00,
+    0x05,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x0d,0x02,0x00,0x00,0x00,0x00,0x80,0x40,0x2b,0x00,0x04,0x00,0x72,0x01,0x00,0x00,
+    0x12,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x52,0x01,0x00,0x00,
+    0x1d,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x56,0x01,0x00,0x00,
+    0x1f,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x25,0x02,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x25,0x02,0x00,0x00,
+    0x26,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x52,0x01,0x00,0x00,
+    0x3c,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x56,0x01,0x00,0x00,
+    0x3e,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x63,0x01,0x00,0x00,
+    0x44,0x02,0x00,0x00,0x03,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x4d,0x02,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x4e,0x01,0x00,0x00,0x3b,0x00,0x04,0x00,0x4d,0x02,0x00,0x00,
+    0x4e,0x02,0x00,0x00,0x03,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x72,0x01,0x00,0x00,
+    0x52,0x02,0x00,0x00,0x03,0x00,0x00,0x00,0x36,0x00,0x05,0x00,0x02,0x00,0x00,0x00,
+    0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,
+    0x05,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x4f,0x01,0x00,0x00,0x50,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x4f,0x01,0x00,0x00,0x69,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x71,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x7b,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x85,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xa7,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xb0,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xb5,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xb8,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xbe,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xc1,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xc5,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xc7,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xc9,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xcc,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xce,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xd0,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xd2,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xd4,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xd6,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xd8,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xda,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xdc,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xdd,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xdf,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xe1,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x4f,0x01,0x00,0x00,0xe4,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xee,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x2a,0x02,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x2c,0x02,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x2e,0x02,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x30,0x02,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x32,0x02,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x34,0x02,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x36,0x02,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x38,0x02,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x49,0x02,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x4a,0x02,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x4f,0x02,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x51,0x01,0x00,0x00,0x54,0x01,0x00,0x00,
+    0x53,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x55,0x01,0x00,0x00,0x58,0x01,0x00,0x00,
+    0x57,0x01,0x00,0x00,0x56,0x00,0x05,0x00,0x59,0x01,0x00,0x00,0x5a,0x01,0x00,0x00,
+    0x54,0x01,0x00,0x00,0x58,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x5b,0x01,0x00,0x00,
+    0x5e,0x01,0x00,0x00,0x5d,0x01,0x00,0x00,0x57,0x00,0x05,0x00,0x4e,0x01,0x00,0x00,
+    0x5f,0x01,0x00,0x00,0x5a,0x01,0x00,0x00,0x5e,0x01,0x00,0x00,0x41,0x00,0x05,0x00,
+    0x65,0x01,0x00,0x00,0x66,0x01,0x00,0x00,0x62,0x01,0x00,0x00,0x64,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x4e,0x01,0x00,0x00,0x67,0x01,0x00,0x00,0x66,0x01,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x4e,0x01,0x00,0x00,0x68,0x01,0x00,0x00,0x5f,0x01,0x00,0x00,
+    0x67,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x50,0x01,0x00,0x00,0x68,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x51,0x01,0x00,0x00,0x6b,0x01,0x00,0x00,0x6a,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x55,0x01,0x00,0x00,0x6d,0x01,0x00,0x00,0x6c,0x01,0x00,0x00,
+    0x56,0x00,0x05,0x00,0x59,0x01,0x00,0x00,0x6e,0x01,0x00,0x00,0x6b,0x01,0x00,0x00,
+    0x6d,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x5b,0x01,0x00,0x00,0x6f,0x01,0x00,0x00,
+    0x5d,0x01,0x00,0x00,0x57,0x00,0x05,0x00,0x4e,0x01,0x00,0x00,0x70,0x01,0x00,0x00,
+    0x6e,0x01,0x00,0x00,0x6f,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x69,0x01,0x00,0x00,
+    0x70,0x01,0x00,0x00,0x41,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x74,0x01,0x00,0x00,
+    0x69,0x01,0x00,0x00,0x73,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x75,0x01,0x00,0x00,0x74,0x01,0x00,0x00,0x41,0x00,0x05,0x00,0x77,0x01,0x00,0x00,
+    0x78,0x01,0x00,0x00,0x62,0x01,0x00,0x00,0x76,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x79,0x01,0x00,0x00,0x78,0x01,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x7a,0x01,0x00,0x00,0x75,0x01,0x00,0x00,0x79,0x01,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x71,0x01,0x00,0x00,0x7a,0x01,0x00,0x00,0x41,0x00,0x05,0x00,
+    0x07,0x00,0x00,0x00,0x7d,0x01,0x00,0x00,0x69,0x01,0x00,0x00,0x7c,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x7e,0x01,0x00,0x00,0x7d,0x01,0x00,0x00,
+    0x41,0x00,0x05,0x00,0x77,0x01,0x00,0x00,0x80,0x01,0x00,0x00,0x62,0x01,0x00,0x00,
+    0x7f,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x81,0x01,0x00,0x00,
+    0x80,0x01,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x82,0x01,0x00,0x00,
+    0x7e,0x01,0x00,0x00,0x81,0x01,0x00,0x00,0x0c,0x00,0x08,0x00,0x06,0x00,0x00,0x00,
+    0x84,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x82,0x01,0x00,0x00,
+    0x83,0x01,0x00,0x00,0x4a,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x7b,0x01,0x00,0x00,
+    0x84,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x88,0x01,0x00,0x00,
+    0x87,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x8a,0x01,0x00,0x00,
+    0x89,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x8c,0x01,0x00,0x00,
+    0x8b,0x01,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x8e,0x01,0x00,0x00,
+    0x88,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x8f,0x01,0x00,0x00,0x88,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x90,0x01,0x00,0x00,0x88,0x01,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x91,0x01,0x00,0x00,0x8a,0x01,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x92,0x01,0x00,0x00,
+    0x8a,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x93,0x01,0x00,0x00,0x8a,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x94,0x01,0x00,0x00,0x8c,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x95,0x01,0x00,0x00,0x8c,0x01,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x96,0x01,0x00,0x00,
+    0x8c,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x50,0x00,0x06,0x00,0x17,0x00,0x00,0x00,
+    0x97,0x01,0x00,0x00,0x8e,0x01,0x00,0x00,0x8f,0x01,0x00,0x00,0x90,0x01,0x00,0x00,
+    0x50,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0x98,0x01,0x00,0x00,0x91,0x01,0x00,0x00,
+    0x92,0x01,0x00,0x00,0x93,0x01,0x00,0x00,0x50,0x00,0x06,0x00,0x17,0x00,0x00,0x00,
+    0x99,0x01,0x00,0x00,0x94,0x01,0x00,0x00,0x95,0x01,0x00,0x00,0x96,0x01,0x00,0x00,
+    0x50,0x00,0x06,0x00,0x8d,0x01,0x00,0x00,0x9a,0x01,0x00,0x00,0x97,0x01,0x00,0x00,
+    0x98,0x01,0x00,0x00,0x99,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x51,0x01,0x00,0x00,
+    0x9c,0x01,0x00,0x00,0x9b,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x55,0x01,0x00,0x00,
+    0x9e,0x01,0x00,0x00,0x9d,0x01,0x00,0x00,0x56,0x00,0x05,0x00,0x59,0x01,0x00,0x00,
+    0x9f,0x01,0x00,0x00,0x9c,0x01,0x00,0x00,0x9e,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x5b,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x5d,0x01,0x00,0x00,0x57,0x00,0x05,0x00,
+    0x4e,0x01,0x00,0x00,0xa1,0x01,0x00,0x00,0x9f,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,
+    0x4f,0x00,0x08,0x00,0x17,0x00,0x00,0x00,0xa2,0x01,0x00,0x00,0xa1,0x01,0x00,0x00,
+    0xa1,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xa3,0x01,0x00,0x00,0xa2,0x01,0x00,0x00,
+    0x9d,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xa4,0x01,0x00,0x00,
+    0xa3,0x01,0x00,0x00,0x90,0x00,0x00,0x00,0x91,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0xa5,0x01,0x00,0x00,0x9a,0x01,0x00,0x00,0xa4,0x01,0x00,0x00,0x0c,0x00,0x06,0x00,
+    0x17,0x00,0x00,0x00,0xa6,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x45,0x00,0x00,0x00,
+    0xa5,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x85,0x01,0x00,0x00,0xa6,0x01,0x00,0x00,
+    0x41,0x00,0x05,0x00,0xa9,0x01,0x00,0x00,0xaa,0x01,0x00,0x00,0x62,0x01,0x00,0x00,
+    0xa8,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xab,0x01,0x00,0x00,
+    0xaa,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xad,0x01,0x00,0x00,
+    0xac,0x01,0x00,0x00,0x83,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xae,0x01,0x00,0x00,
+    0xab,0x01,0x00,0x00,0xad,0x01,0x00,0x00,0x0c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,
+    0xaf,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0xae,0x01,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xa7,0x01,0x00,0x00,0xaf,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0xb1,0x01,0x00,0x00,0x85,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0xb2,0x01,0x00,0x00,0xa7,0x01,0x00,0x00,0x94,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0xb3,0x01,0x00,0x00,0xb1,0x01,0x00,0x00,0xb2,0x01,0x00,0x00,
+    0x0c,0x00,0x07,0x00,0x06,0x00,0x00,0x00,0xb4,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x28,0x00,0x00,0x00,0xb3,0x01,0x00,0x00,0x78,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xb0,0x01,0x00,0x00,0xb4,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x4e,0x01,0x00,0x00,
+    0xb6,0x01,0x00,0x00,0x50,0x01,0x00,0x00,0x4f,0x00,0x08,0x00,0x17,0x00,0x00,0x00,
+    0xb7,0x01,0x00,0x00,0xb6,0x01,0x00,0x00,0xb6,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xb5,0x01,0x00,0x00,
+    0xb7,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xba,0x01,0x00,0x00,
+    0xb5,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xbb,0x01,0x00,0x00,
+    0x71,0x01,0x00,0x00,0x50,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0xbc,0x01,0x00,0x00,
+    0xbb,0x01,0x00,0x00,0xbb,0x01,0x00,0x00,0xbb,0x01,0x00,0x00,0x0c,0x00,0x08,0x00,
+    0x17,0x00,0x00,0x00,0xbd,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,
+    0xb9,0x01,0x00,0x00,0xba,0x01,0x00,0x00,0xbc,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xb8,0x01,0x00,0x00,0xbd,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xbf,0x01,0x00,0x00,0x71,0x01,0x00,0x00,0x83,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0xc0,0x01,0x00,0x00,0x4a,0x00,0x00,0x00,0xbf,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xbe,0x01,0x00,0x00,0xc0,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0xc2,0x01,0x00,0x00,0xb5,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xc3,0x01,0x00,0x00,0xbe,0x01,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0xc4,0x01,0x00,0x00,0xc2,0x01,0x00,0x00,0xc3,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xc1,0x01,0x00,0x00,0xc4,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0xc6,0x01,0x00,0x00,0x85,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0xc5,0x01,0x00,0x00,
+    0xc6,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xc8,0x01,0x00,0x00,
+    0xa7,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0xc7,0x01,0x00,0x00,0xc8,0x01,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xc9,0x01,0x00,0x00,0xcb,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0xcd,0x01,0x00,0x00,0xb8,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xcc,0x01,0x00,0x00,0xcd,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0xcf,0x01,0x00,0x00,0xc1,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0xce,0x01,0x00,0x00,
+    0xcf,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xd1,0x01,0x00,0x00,
+    0x71,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0xd0,0x01,0x00,0x00,0xd1,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xd3,0x01,0x00,0x00,0x7b,0x01,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xd2,0x01,0x00,0x00,0xd3,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xd5,0x01,0x00,0x00,0xb0,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xd4,0x01,0x00,0x00,0xd5,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xd7,0x01,0x00,0x00,0xb0,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0xd6,0x01,0x00,0x00,
+    0xd7,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xd9,0x01,0x00,0x00,
+    0xb8,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0xd8,0x01,0x00,0x00,0xd9,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xdb,0x01,0x00,0x00,0x7b,0x01,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xda,0x01,0x00,0x00,0xdb,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xde,0x01,0x00,0x00,0xd6,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xdd,0x01,0x00,0x00,0xde,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0xe0,0x01,0x00,0x00,0xd8,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0xdf,0x01,0x00,0x00,
+    0xe0,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xe2,0x01,0x00,0x00,
+    0xda,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0xe1,0x01,0x00,0x00,0xe2,0x01,0x00,0x00,
+    0x39,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0xe3,0x01,0x00,0x00,0x34,0x00,0x00,0x00,
+    0xdd,0x01,0x00,0x00,0xdf,0x01,0x00,0x00,0xe1,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xdc,0x01,0x00,0x00,0xe3,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x51,0x01,0x00,0x00,
+    0xe6,0x01,0x00,0x00,0xe5,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x55,0x01,0x00,0x00,
+    0xe8,0x01,0x00,0x00,0xe7,0x01,0x00,0x00,0x56,0x00,0x05,0x00,0x59,0x01,0x00,0x00,
+    0xe9,0x01,0x00,0x00,0xe6,0x01,0x00,0x00,0xe8,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xea,0x01,0x00,0x00,0xb0,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xeb,0x01,0x00,0x00,0x7b,0x01,0x00,0x00,0x50,0x00,0x05,0x00,
+    0x5b,0x01,0x00,0x00,0xec,0x01,0x00,0x00,0xea,0x01,0x00,0x00,0xeb,0x01,0x00,0x00,
+    0x57,0x00,0x05,0x00,0x4e,0x01,0x00,0x00,0xed,0x01,0x00,0x00,0xe9,0x01,0x00,0x00,
+    0xec,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0xe4,0x01,0x00,0x00,0xed,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xef,0x01,0x00,0x00,0xdc,0x01,0x00,0x00,
+    0x83,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xf0,0x01,0x00,0x00,0x90,0x00,0x00,0x00,
+    0xef,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xf1,0x01,0x00,0x00,
+    0xbe,0x01,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xf2,0x01,0x00,0x00,
+    0xf0,0x01,0x00,0x00,0xf1,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0xf3,0x01,0x00,0x00,
+    0xf6,0x01,0x00,0x00,0xf5,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x55,0x01,0x00,0x00,
+    0xf8,0x01,0x00,0x00,0xf7,0x01,0x00,0x00,0x56,0x00,0x05,0x00,0xf9,0x01,0x00,0x00,
+    0xfa,0x01,0x00,0x00,0xf6,0x01,0x00,0x00,0xf8,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0xfb,0x01,0x00,0x00,0x85,0x01,0x00,0x00,0x57,0x00,0x05,0x00,
+    0x4e,0x01,0x00,0x00,0xfc,0x01,0x00,0x00,0xfa,0x01,0x00,0x00,0xfb,0x01,0x00,0x00,
+    0x4f,0x00,0x08,0x00,0x17,0x00,0x00,0x00,0xfd,0x01,0x00,0x00,0xfc,0x01,0x00,0x00,
+    0xfc,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xfe,0x01,0x00,0x00,0xc1,0x01,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xff,0x01,0x00,0x00,0xfd,0x01,0x00,0x00,
+    0xfe,0x01,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x01,0x02,0x00,0x00,
+    0xff,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x85,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x02,0x02,0x00,0x00,0xf2,0x01,0x00,0x00,0x01,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0xf3,0x01,0x00,0x00,0x04,0x02,0x00,0x00,0x03,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x55,0x01,0x00,0x00,0x06,0x02,0x00,0x00,0x05,0x02,0x00,0x00,0x56,0x00,0x05,0x00,
+    0xf9,0x01,0x00,0x00,0x07,0x02,0x00,0x00,0x04,0x02,0x00,0x00,0x06,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x08,0x02,0x00,0x00,0xa7,0x01,0x00,0x00,
+    0x7f,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x09,0x02,0x00,0x00,0x08,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x0a,0x02,0x00,0x00,0x85,0x01,0x00,0x00,
+    0x0c,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0x0b,0x02,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x47,0x00,0x00,0x00,0x09,0x02,0x00,0x00,0x0a,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x0c,0x02,0x00,0x00,0x7b,0x01,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x0e,0x02,0x00,0x00,0x0c,0x02,0x00,0x00,0x0d,0x02,0x00,0x00,
+    0x58,0x00,0x07,0x00,0x4e,0x01,0x00,0x00,0x0f,0x02,0x00,0x00,0x07,0x02,0x00,0x00,
+    0x0b,0x02,0x00,0x00,0x02,0x00,0x00,0x00,0x0e,0x02,0x00,0x00,0x4f,0x00,0x08,0x00,
+    0x17,0x00,0x00,0x00,0x10,0x02,0x00,0x00,0x0f,0x02,0x00,0x00,0x0f,0x02,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0x11,0x02,0x00,0x00,0xdc,0x01,0x00,0x00,0x41,0x00,0x05,0x00,
+    0x07,0x00,0x00,0x00,0x13,0x02,0x00,0x00,0xe4,0x01,0x00,0x00,0x12,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x14,0x02,0x00,0x00,0x13,0x02,0x00,0x00,
+    0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x15,0x02,0x00,0x00,0x11,0x02,0x00,0x00,
+    0x14,0x02,0x00,0x00,0x41,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x16,0x02,0x00,0x00,
+    0xe4,0x01,0x00,0x00,0x7c,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x17,0x02,0x00,0x00,0x16,0x02,0x00,0x00,0x50,0x00,0x06,0x00,0x17,0x00,0x00,0x00,
+    0x18,0x02,0x00,0x00,0x17,0x02,0x00,0x00,0x17,0x02,0x00,0x00,0x17,0x02,0x00,0x00,
+    0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x19,0x02,0x00,0x00,0x15,0x02,0x00,0x00,
+    0x18,0x02,0x00,0x00,0x85,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x1a,0x02,0x00,0x00,
+    0x10,0x02,0x00,0x00,0x19,0x02,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x1b,0x02,0x00,0x00,0x1a,0x02,0x00,0x00,0x62,0x00,0x00,0x00,0x81,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0x1c,0x02,0x00,0x00,0x02,0x02,0x00,0x00,0x1b,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x51,0x01,0x00,0x00,0x1e,0x02,0x00,0x00,0x1d,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x55,0x01,0x00,0x00,0x20,0x02,0x00,0x00,0x1f,0x02,0x00,0x00,
+    0x56,0x00,0x05,0x00,0x59,0x01,0x00,0x00,0x21,0x02,0x00,0x00,0x1e,0x02,0x00,0x00,
+    0x20,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x5b,0x01,0x00,0x00,0x22,0x02,0x00,0x00,
+    0x5d,0x01,0x00,0x00,0x57,0x00,0x05,0x00,0x4e,0x01,0x00,0x00,0x23,0x02,0x00,0x00,
+    0x21,0x02,0x00,0x00,0x22,0x02,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x24,0x02,0x00,0x00,0x23,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x27,0x02,0x00,0x00,0x26,0x02,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x28,0x02,0x00,0x00,0x24,0x02,0x00,0x00,0x27,0x02,0x00,0x00,
+    0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x29,0x02,0x00,0x00,0x1c,0x02,0x00,0x00,
+    0x28,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x2b,0x02,0x00,0x00,
+    0xc5,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x2a,0x02,0x00,0x00,0x2b,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x2d,0x02,0x00,0x00,0xc7,0x01,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x2c,0x02,0x00,0x00,0x2d,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0x2f,0x02,0x00,0x00,0xc9,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x2e,0x02,0x00,0x00,0x2f,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0x31,0x02,0x00,0x00,0xcc,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x30,0x02,0x00,0x00,
+    0x31,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x33,0x02,0x00,0x00,
+    0xce,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x32,0x02,0x00,0x00,0x33,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x35,0x02,0x00,0x00,0xd0,0x01,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x34,0x02,0x00,0x00,0x35,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x37,0x02,0x00,0x00,0xd2,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x36,0x02,0x00,0x00,0x37,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x39,0x02,0x00,0x00,0xd4,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x38,0x02,0x00,0x00,
+    0x39,0x02,0x00,0x00,0x39,0x00,0x0c,0x00,0x17,0x00,0x00,0x00,0x3a,0x02,0x00,0x00,
+    0x2e,0x00,0x00,0x00,0x2a,0x02,0x00,0x00,0x2c,0x02,0x00,0x00,0x2e,0x02,0x00,0x00,
+    0x30,0x02,0x00,0x00,0x32,0x02,0x00,0x00,0x34,0x02,0x00,0x00,0x36,0x02,0x00,0x00,
+    0x38,0x02,0x00,0x00,0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x3b,0x02,0x00,0x00,
+    0x29,0x02,0x00,0x00,0x3a,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x51,0x01,0x00,0x00,
+    0x3d,0x02,0x00,0x00,0x3c,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x55,0x01,0x00,0x00,
+    0x3f,0x02,0x00,0x00,0x3e,0x02,0x00,0x00,0x56,0x00,0x05,0x00,0x59,0x01,0x00,0x00,
+    0x40,0x02,0x00,0x00,0x3d,0x02,0x00,0x00,0x3f,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x5b,0x01,0x00,0x00,0x41,0x02,0x00,0x00,0x5d,0x01,0x00,0x00,0x57,0x00,0x05,0x00,
+    0x4e,0x01,0x00,0x00,0x42,0x02,0x00,0x00,0x40,0x02,0x00,0x00,0x41,0x02,0x00,0x00,
+    0x4f,0x00,0x08,0x00,0x17,0x00,0x00,0x00,0x43,0x02,0x00,0x00,0x42,0x02,0x00,0x00,
+    0x42,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x41,0x00,0x05,0x00,0xa9,0x01,0x00,0x00,0x45,0x02,0x00,0x00,0x62,0x01,0x00,0x00,
+    0x44,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x46,0x02,0x00,0x00,
+    0x45,0x02,0x00,0x00,0x85,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x47,0x02,0x00,0x00,
+    0x43,0x02,0x00,0x00,0x46,0x02,0x00,0x00,0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x48,0x02,0x00,0x00,0x3b,0x02,0x00,0x00,0x47,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xee,0x01,0x00,0x00,0x48,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0x4b,0x02,0x00,0x00,0xee,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x4a,0x02,0x00,0x00,
+    0x4b,0x02,0x00,0x00,0x39,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x4c,0x02,0x00,0x00,
+    0x38,0x00,0x00,0x00,0x4a,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0x49,0x02,0x00,0x00,
+    0x4c,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x50,0x02,0x00,0x00,
+    0x49,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0x4f,0x02,0x00,0x00,0x50,0x02,0x00,0x00,
+    0x39,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x51,0x02,0x00,0x00,0x3b,0x00,0x00,0x00,
+    0x4f,0x02,0x00,0x00,0x41,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x53,0x02,0x00,0x00,
+    0x50,0x01,0x00,0x00,0x52,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x54,0x02,0x00,0x00,0x53,0x02,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x55,0x02,0x00,0x00,0x51,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x56,0x02,0x00,0x00,0x51,0x02,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x57,0x02,0x00,0x00,0x51,0x02,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x50,0x00,0x07,0x00,0x4e,0x01,0x00,0x00,0x58,0x02,0x00,0x00,
+    0x55,0x02,0x00,0x00,0x56,0x02,0x00,0x00,0x57,0x02,0x00,0x00,0x54,0x02,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x4e,0x02,0x00,0x00,0x58,0x02,0x00,0x00,0xfd,0x00,0x01,0x00,
+    0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,
+    0x09,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0xf8,0x00,0x02,0x00,0x0c,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
+    0x3d,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
+    0x41,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
+    0x45,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x3e,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x3f,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x40,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x3d,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x42,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x43,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x44,0x00,0x00,0x00,0x42,0x00,0x00,0x00,0x43,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x41,0x00,0x00,0x00,0x44,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x46,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x47,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x48,0x00,0x00,0x00,0x46,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x49,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x4b,0x00,0x00,0x00,0x49,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x4c,0x00,0x00,0x00,0x48,0x00,0x00,0x00,
+    0x4b,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x4d,0x00,0x00,0x00,
+    0x4c,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x45,0x00,0x00,0x00,
+    0x4d,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x4e,0x00,0x00,0x00,
+    0x41,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x50,0x00,0x00,0x00,
+    0x45,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x51,0x00,0x00,0x00,
+    0x4f,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x52,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x53,0x00,0x00,0x00,0x51,0x00,0x00,0x00,0x52,0x00,0x00,0x00,0x88,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x54,0x00,0x00,0x00,0x4e,0x00,0x00,0x00,0x53,0x00,0x00,0x00,
+    0xfe,0x00,0x02,0x00,0x54,0x00,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,
+    0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
+    0x07,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x12,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x57,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x59,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x57,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x57,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,0x57,0x00,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x5e,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x5b,0x00,0x00,0x00,0x5e,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x60,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x5f,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x66,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x65,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x67,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x68,0x00,0x00,0x00,0x66,0x00,0x00,0x00,
+    0x67,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x69,0x00,0x00,0x00,
+    0x5b,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x6a,0x00,0x00,0x00,
+    0x68,0x00,0x00,0x00,0x69,0x00,0x00,0x00,0x0c,0x00,0x06,0x00,0x06,0x00,0x00,0x00,
+    0x6b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x6a,0x00,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x6c,0x00,0x00,0x00,0x63,0x00,0x00,0x00,
+    0x6b,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x6d,0x00,0x00,0x00,
+    0x0e,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x6e,0x00,0x00,0x00,
+    0x0f,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x6f,0x00,0x00,0x00,
+    0x0f,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x70,0x00,0x00,0x00,
+    0x6e,0x00,0x00,0x00,0x6f,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x71,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x72,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x71,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x73,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x81,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x73,0x00,0x00,0x00,
+    0x0c,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x75,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x1f,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x76,0x00,0x00,0x00,0x6d,0x00,0x00,0x00,0x75,0x00,0x00,0x00,0x81,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x6c,0x00,0x00,0x00,0x76,0x00,0x00,0x00,
+    0x0c,0x00,0x07,0x00,0x06,0x00,0x00,0x00,0x79,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x28,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x88,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x7a,0x00,0x00,0x00,0x62,0x00,0x00,0x00,0x79,0x00,0x00,0x00,
+    0xfe,0x00,0x02,0x00,0x7a,0x00,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x00,0x00,
+    0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,
+    0x16,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x7d,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x82,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,
+    0x14,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,
+    0x4a,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,0x0c,0x00,0x08,0x00,0x06,0x00,0x00,0x00,
+    0x81,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,
+    0x80,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x7d,0x00,0x00,0x00,
+    0x81,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x83,0x00,0x00,0x00,
+    0x7d,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x84,0x00,0x00,0x00,
+    0x7d,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x85,0x00,0x00,0x00,
+    0x83,0x00,0x00,0x00,0x84,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x82,0x00,0x00,0x00,
+    0x85,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x86,0x00,0x00,0x00,
+    0x82,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x87,0x00,0x00,0x00,
+    0x82,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x88,0x00,0x00,0x00,
+    0x86,0x00,0x00,0x00,0x87,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x89,0x00,0x00,0x00,0x7d,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x8a,0x00,0x00,0x00,0x88,0x00,0x00,0x00,0x89,0x00,0x00,0x00,0xfe,0x00,0x02,0x00,
+    0x8a,0x00,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
+    0x07,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x18,0x00,0x00,0x00,
+    0x1b,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x1d,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x8d,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x93,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x8e,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x8d,0x00,0x00,0x00,0x8e,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0x8f,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0x91,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x92,0x00,0x00,0x00,0x90,0x00,0x00,0x00,0x91,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x94,0x00,0x00,0x00,0x8d,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x93,0x00,0x00,0x00,0x94,0x00,0x00,0x00,0x39,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x95,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x93,0x00,0x00,0x00,0x8e,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0x96,0x00,0x00,0x00,0x92,0x00,0x00,0x00,0x95,0x00,0x00,0x00,
+    0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x97,0x00,0x00,0x00,0x8f,0x00,0x00,0x00,
+    0x96,0x00,0x00,0x00,0xfe,0x00,0x02,0x00,0x97,0x00,0x00,0x00,0x38,0x00,0x01,0x00,
+    0x36,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,
+    0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
+    0x07,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,
+    0x22,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x24,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x9a,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0xa6,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0xa8,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0xab,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0xb1,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x9b,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x0c,0x00,0x08,0x00,
+    0x06,0x00,0x00,0x00,0x9c,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,
+    0x80,0x00,0x00,0x00,0x62,0x00,0x00,0x00,0x9b,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x9e,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x9f,0x00,0x00,0x00,0x9d,0x00,0x00,0x00,0x9e,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xa0,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xa1,0x00,0x00,0x00,0x9f,0x00,0x00,0x00,
+    0xa0,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xa2,0x00,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xa3,0x00,0x00,0x00,
+    0xa1,0x00,0x00,0x00,0xa2,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0xa4,0x00,0x00,0x00,0x9c,0x00,0x00,0x00,0xa3,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0xa5,0x00,0x00,0x00,0xa4,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x9a,0x00,0x00,0x00,0xa5,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xa7,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xa6,0x00,0x00,0x00,0xa7,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xa9,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xa8,0x00,0x00,0x00,
+    0xa9,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xaa,0x00,0x00,0x00,
+    0x9a,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xac,0x00,0x00,0x00,
+    0xa6,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xab,0x00,0x00,0x00,0xac,0x00,0x00,0x00,
+    0x39,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xad,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+    0xab,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xae,0x00,0x00,0x00,
+    0xaa,0x00,0x00,0x00,0xad,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0xaf,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0xae,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xb0,0x00,0x00,0x00,0x9a,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xb2,0x00,0x00,0x00,0xa8,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xb1,0x00,0x00,0x00,0xb2,0x00,0x00,0x00,0x39,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0xb3,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0xb1,0x00,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0xb4,0x00,0x00,0x00,0xb0,0x00,0x00,0x00,0xb3,0x00,0x00,0x00,
+    0x81,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xb5,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,
+    0xb4,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xb6,0x00,0x00,0x00,
+    0xaf,0x00,0x00,0x00,0xb5,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xb8,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x0c,0x00,0x08,0x00,0x06,0x00,0x00,0x00,
+    0xb9,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,
+    0xb7,0x00,0x00,0x00,0xb8,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0xba,0x00,0x00,0x00,0xb6,0x00,0x00,0x00,0xb9,0x00,0x00,0x00,0xfe,0x00,0x02,0x00,
+    0xba,0x00,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x2e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
+    0x18,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x18,0x00,0x00,0x00,
+    0x27,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x18,0x00,0x00,0x00,0x28,0x00,0x00,0x00,
+    0x37,0x00,0x03,0x00,0x18,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
+    0x18,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,
+    0x2b,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,
+    0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,
+    0x2f,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xbd,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xc2,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xc7,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xcc,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xce,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xd0,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xd2,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xd4,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xd9,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xdb,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xdc,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xde,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xe1,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xe3,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xe5,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xea,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xf2,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xf4,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xf6,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xf8,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xfe,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x00,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x03,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x05,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x07,0x01,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xbe,0x00,0x00,0x00,
+    0x27,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xbf,0x00,0x00,0x00,
+    0x28,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,
+    0xbe,0x00,0x00,0x00,0xbf,0x00,0x00,0x00,0x0c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,
+    0xc1,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xbd,0x00,0x00,0x00,0xc1,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0xc3,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0xc4,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x94,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0xc5,0x00,0x00,0x00,0xc3,0x00,0x00,0x00,0xc4,0x00,0x00,0x00,
+    0x0c,0x00,0x07,0x00,0x06,0x00,0x00,0x00,0xc6,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x28,0x00,0x00,0x00,0xc5,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xc2,0x00,0x00,0x00,0xc6,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0xc8,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0xc9,0x00,0x00,0x00,0xbd,0x00,0x00,0x00,0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0xca,0x00,0x00,0x00,0xc8,0x00,0x00,0x00,0xc9,0x00,0x00,0x00,0x0c,0x00,0x07,0x00,
+    0x06,0x00,0x00,0x00,0xcb,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,
+    0xca,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xc7,0x00,0x00,0x00,
+    0xcb,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xcd,0x00,0x00,0x00,
+    0x2c,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xcc,0x00,0x00,0x00,0xcd,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xcf,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xce,0x00,0x00,0x00,0xcf,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xd1,0x00,0x00,0x00,0xc2,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xd0,0x00,0x00,0x00,0xd1,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xd3,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xd2,0x00,0x00,0x00,
+    0xd3,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xd5,0x00,0x00,0x00,
+    0x27,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xd6,0x00,0x00,0x00,
+    0xbd,0x00,0x00,0x00,0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xd7,0x00,0x00,0x00,
+    0xd5,0x00,0x00,0x00,0xd6,0x00,0x00,0x00,0x0c,0x00,0x07,0x00,0x06,0x00,0x00,0x00,
+    0xd8,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0xd7,0x00,0x00,0x00,
+    0x80,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xd4,0x00,0x00,0x00,0xd8,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xda,0x00,0x00,0x00,0x29,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xd9,0x00,0x00,0x00,0xda,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xdd,0x00,0x00,0x00,0xd4,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xdc,0x00,0x00,0x00,0xdd,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0xdf,0x00,0x00,0x00,0xd9,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xde,0x00,0x00,0x00,
+    0xdf,0x00,0x00,0x00,0x39,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,
+    0x1c,0x00,0x00,0x00,0xdc,0x00,0x00,0x00,0xde,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xdb,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xe2,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xe1,0x00,0x00,0x00,
+    0xe2,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xe4,0x00,0x00,0x00,
+    0xc2,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xe3,0x00,0x00,0x00,0xe4,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xe6,0x00,0x00,0x00,0x28,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0xbd,0x00,0x00,0x00,
+    0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xe8,0x00,0x00,0x00,0xe6,0x00,0x00,0x00,
+    0xe7,0x00,0x00,0x00,0x0c,0x00,0x07,0x00,0x06,0x00,0x00,0x00,0xe9,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0xe8,0x00,0x00,0x00,0x80,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xe5,0x00,0x00,0x00,0xe9,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xeb,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xea,0x00,0x00,0x00,0xeb,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0xec,0x00,0x00,0x00,0xdb,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0xed,0x00,0x00,0x00,0x90,0x00,0x00,0x00,0xec,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xee,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0xef,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0xee,0x00,0x00,0x00,
+    0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0xed,0x00,0x00,0x00,
+    0xef,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xf1,0x00,0x00,0x00,
+    0x2a,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xf3,0x00,0x00,0x00,
+    0xe1,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xf2,0x00,0x00,0x00,0xf3,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xf5,0x00,0x00,0x00,0xe3,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xf4,0x00,0x00,0x00,0xf5,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xf7,0x00,0x00,0x00,0xe5,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xf6,0x00,0x00,0x00,0xf7,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xf9,0x00,0x00,0x00,0xea,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xf8,0x00,0x00,0x00,
+    0xf9,0x00,0x00,0x00,0x39,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0xfa,0x00,0x00,0x00,
+    0x23,0x00,0x00,0x00,0xf2,0x00,0x00,0x00,0xf4,0x00,0x00,0x00,0xf6,0x00,0x00,0x00,
+    0xf8,0x00,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xfb,0x00,0x00,0x00,
+    0xf1,0x00,0x00,0x00,0xfa,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0xfc,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0xfb,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0xfd,0x00,0x00,0x00,0xdb,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xc7,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xfe,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x01,0x01,0x00,0x00,0xcc,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x00,0x01,0x00,0x00,
+    0x01,0x01,0x00,0x00,0x39,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x02,0x01,0x00,0x00,
+    0x0b,0x00,0x00,0x00,0xfe,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x04,0x01,0x00,0x00,0xce,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x03,0x01,0x00,0x00,0x04,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x06,0x01,0x00,0x00,0xd0,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x05,0x01,0x00,0x00,
+    0x06,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x08,0x01,0x00,0x00,
+    0xd2,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x07,0x01,0x00,0x00,0x08,0x01,0x00,0x00,
+    0x39,0x00,0x07,0x00,0x06,0x00,0x00,0x00,0x09,0x01,0x00,0x00,0x11,0x00,0x00,0x00,
+    0x03,0x01,0x00,0x00,0x05,0x01,0x00,0x00,0x07,0x01,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x0a,0x01,0x00,0x00,0x02,0x01,0x00,0x00,0x09,0x01,0x00,0x00,
+    0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x0b,0x01,0x00,0x00,0xfd,0x00,0x00,0x00,
+    0x0a,0x01,0x00,0x00,0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x0c,0x01,0x00,0x00,
+    0xfc,0x00,0x00,0x00,0x0b,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x0d,0x01,0x00,0x00,0xc2,0x00,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x0e,0x01,0x00,0x00,0x0c,0x01,0x00,0x00,0x0d,0x01,0x00,0x00,0xfe,0x00,0x02,0x00,
+    0x0e,0x01,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
+    0x07,0x00,0x00,0x00,0x31,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x18,0x00,0x00,0x00,
+    0x32,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x33,0x00,0x00,0x00,
+    0xf8,0x00,0x02,0x00,0x35,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
+    0x11,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
+    0x1b,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x12,0x01,0x00,0x00,0x31,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x11,0x01,0x00,0x00,
+    0x12,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x13,0x01,0x00,0x00,
+    0x32,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x14,0x01,0x00,0x00,
+    0x33,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x15,0x01,0x00,0x00,
+    0x4a,0x00,0x00,0x00,0x14,0x01,0x00,0x00,0x50,0x00,0x06,0x00,0x17,0x00,0x00,0x00,
+    0x16,0x01,0x00,0x00,0x15,0x01,0x00,0x00,0x15,0x01,0x00,0x00,0x15,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x17,0x01,0x00,0x00,0x32,0x00,0x00,0x00,
+    0x0c,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0x18,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x28,0x00,0x00,0x00,0x16,0x01,0x00,0x00,0x17,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0x19,0x01,0x00,0x00,0x32,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0x1a,0x01,0x00,0x00,0x18,0x01,0x00,0x00,0x19,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x1c,0x01,0x00,0x00,0x11,0x01,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x1b,0x01,0x00,0x00,0x1c,0x01,0x00,0x00,0x39,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x1d,0x01,0x00,0x00,0x15,0x00,0x00,0x00,0x1b,0x01,0x00,0x00,
+    0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x1e,0x01,0x00,0x00,0x1a,0x01,0x00,0x00,
+    0x1d,0x01,0x00,0x00,0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x1f,0x01,0x00,0x00,
+    0x13,0x01,0x00,0x00,0x1e,0x01,0x00,0x00,0xfe,0x00,0x02,0x00,0x1f,0x01,0x00,0x00,
+    0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x38,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x18,0x00,0x00,0x00,
+    0x37,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x39,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x37,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x37,0x00,0x00,0x00,0x8e,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0x25,0x01,0x00,0x00,0x23,0x01,0x00,0x00,0x24,0x01,0x00,0x00,
+    0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x28,0x01,0x00,0x00,0x25,0x01,0x00,0x00,
+    0x27,0x01,0x00,0x00,0x85,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x29,0x01,0x00,0x00,
+    0x22,0x01,0x00,0x00,0x28,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0x2a,0x01,0x00,0x00,0x37,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0x2b,0x01,0x00,0x00,0x37,0x00,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x2d,0x01,0x00,0x00,0x2b,0x01,0x00,0x00,0x2c,0x01,0x00,0x00,0x81,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0x30,0x01,0x00,0x00,0x2d,0x01,0x00,0x00,0x2f,0x01,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x31,0x01,0x00,0x00,0x2a,0x01,0x00,0x00,
+    0x30,0x01,0x00,0x00,0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x34,0x01,0x00,0x00,
+    0x31,0x01,0x00,0x00,0x33,0x01,0x00,0x00,0x88,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x35,0x01,0x00,0x00,0x29,0x01,0x00,0x00,0x34,0x01,0x00,0x00,0x0c,0x00,0x08,0x00,
+    0x17,0x00,0x00,0x00,0x37,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,
+    0x35,0x01,0x00,0x00,0x36,0x01,0x00,0x00,0x90,0x00,0x00,0x00,0xfe,0x00,0x02,0x00,
+    0x37,0x01,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
+    0x18,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x3c,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x3a,0x01,0x00,0x00,0x3a,0x00,0x00,0x00,
+    0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x3c,0x01,0x00,0x00,0x3a,0x01,0x00,0x00,
+    0x3b,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x3d,0x01,0x00,0x00,
+    0x3a,0x00,0x00,0x00,0x0c,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0x3e,0x01,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x3d,0x01,0x00,0x00,0x36,0x01,0x00,0x00,
+    0x0c,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0x41,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x1a,0x00,0x00,0x00,0x3e,0x01,0x00,0x00,0x40,0x01,0x00,0x00,0x8e,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0x43,0x01,0x00,0x00,0x41,0x01,0x00,0x00,0x42,0x01,0x00,0x00,
+    0x83,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x46,0x01,0x00,0x00,0x43,0x01,0x00,0x00,
+    0x45,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x49,0x01,0x00,0x00,
+    0x3a,0x00,0x00,0x00,0x0c,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0x4a,0x01,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x48,0x01,0x00,0x00,0x49,0x01,0x00,0x00,
+    0x0c,0x00,0x08,0x00,0x17,0x00,0x00,0x00,0x4b,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x2e,0x00,0x00,0x00,0x3c,0x01,0x00,0x00,0x46,0x01,0x00,0x00,0x4a,0x01,0x00,0x00,
+    0xfe,0x00,0x02,0x00,0x4b,0x01,0x00,0x00,0x38,0x00,0x01,0x00,
+};
+/*
+    #version 460
+
+    layout(set = 0, binding = 0, std140) uniform vs_params
+    {
+        mat4 mvp;
+        mat4 model;
+        mat4 normal_matrix;
+        vec3 cam_pos;
+        float _pad0;
+    } _14;
+
+    layout(location = 0) out vec3 v_world_pos;
+    layout(location = 0) in vec3 pos;
+    layout(location = 1) out vec3 v_normal;
+    layout(location = 1) in vec3 normal;
+    layout(location = 2) out vec3 v_tangent;
+    layout(location = 3) in vec4 tangent;
+    layout(location = 3) out vec3 v_bitangent;
+    layout(location = 4) out vec2 v_uv;
+    layout(location = 2) in vec2 uv;
+    layout(location = 5) out float v_occlusion;
+    layout(location = 4) in float occlusion;
+    layout(location = 6) out vec4 v_clip;
+
+    void main()
+    {
+        vec4 _27 = vec4(pos, 1.0);
+        v_world_pos = (_14.model * _27).xyz;
+        v_normal = normalize((_14.normal_matrix * vec4(normal, 0.0)).xyz);
+        v_tangent = normalize((_14.normal_matrix * vec4(tangent.xyz, 0.0)).xyz);
+        v_bitangent = cross(v_normal, v_tangent) * tangent.w;
+        v_uv = uv;
+        v_occlusion = occlusion;
+        gl_Position = _14.mvp * _27;
+        v_clip = gl_Position;
+    }
+
+*/
+static const uint8_t pbr_vs_clustered_bytecode_spirv_vk[3036] = {
+    0x03,0x02,0x23,0x07,0x00,0x04,0x01,0x00,0x0b,0x00,0x08,0x00,0x60,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x11,0x00,0x02,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x06,0x00,
+    0x01,0x00,0x00,0x00,0x47,0x4c,0x53,0x4c,0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,
+    0x00,0x00,0x00,0x00,0x0e,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x0f,0x00,0x13,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6d,0x61,0x69,0x6e,
+    0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0x33,0x00,0x00,0x00,
+    0x3d,0x00,0x00,0x00,0x49,0x00,0x00,0x00,0x4b,0x00,0x00,0x00,0x4e,0x00,0x00,0x00,
+    0x4f,0x00,0x00,0x00,0x55,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,0x03,0x00,0x03,0x00,
+    0x02,0x00,0x00,0x00,0xcc,0x01,0x00,0x00,0x05,0x00,0x04,0x00,0x04,0x00,0x00,0x00,
+    0x6d,0x61,0x69,0x6e,0x00,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x09,0x00,0x00,0x00,
+    0x5f,0x32,0x37,0x00,0x05,0x00,0x03,0x00,0x0c,0x00,0x00,0x00,0x70,0x6f,0x73,0x00,
+    0x05,0x00,0x05,0x00,0x14,0x00,0x00,0x00,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,
+    0x70,0x6f,0x73,0x00,0x05,0x00,0x05,0x00,0x16,0x00,0x00,0x00,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x00,0x00,0x00,0x06,0x00,0x04,0x00,0x16,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x6d,0x76,0x70,0x00,0x06,0x00,0x05,0x00,0x16,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x6d,0x6f,0x64,0x65,0x6c,0x00,0x00,0x00,0x06,0x00,0x07,0x00,
+    0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x6d,
+    0x61,0x74,0x72,0x69,0x78,0x00,0x00,0x00,0x06,0x00,0x05,0x00,0x16,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x63,0x61,0x6d,0x5f,0x70,0x6f,0x73,0x00,0x06,0x00,0x05,0x00,
+    0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x5f,0x70,0x61,0x64,0x30,0x00,0x00,0x00,
+    0x05,0x00,0x03,0x00,0x18,0x00,0x00,0x00,0x5f,0x31,0x34,0x00,0x05,0x00,0x05,0x00,
+    0x21,0x00,0x00,0x00,0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x25,0x00,0x00,0x00,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x00,0x00,
+    0x05,0x00,0x05,0x00,0x2f,0x00,0x00,0x00,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,
+    0x74,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x33,0x00,0x00,0x00,0x74,0x61,0x6e,0x67,
+    0x65,0x6e,0x74,0x00,0x05,0x00,0x05,0x00,0x3d,0x00,0x00,0x00,0x76,0x5f,0x62,0x69,
+    0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x00,0x05,0x00,0x04,0x00,0x49,0x00,0x00,0x00,
+    0x76,0x5f,0x75,0x76,0x00,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x4b,0x00,0x00,0x00,
+    0x75,0x76,0x00,0x00,0x05,0x00,0x05,0x00,0x4e,0x00,0x00,0x00,0x76,0x5f,0x6f,0x63,
+    0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x00,0x05,0x00,0x05,0x00,0x4f,0x00,0x00,0x00,
+    0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x00,0x00,0x00,0x05,0x00,0x06,0x00,
+    0x53,0x00,0x00,0x00,0x67,0x6c,0x5f,0x50,0x65,0x72,0x56,0x65,0x72,0x74,0x65,0x78,
+    0x00,0x00,0x00,0x00,0x06,0x00,0x06,0x00,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x00,0x06,0x00,0x07,0x00,
+    0x53,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,
+    0x53,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x06,0x00,0x07,0x00,0x53,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x67,0x6c,0x5f,0x43,0x6c,0x69,0x70,0x44,0x69,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x00,0x06,0x00,0x07,0x00,0x53,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x67,0x6c,0x5f,0x43,0x75,0x6c,0x6c,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x00,
+    0x05,0x00,0x03,0x00,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x5d,0x00,0x00,0x00,0x76,0x5f,0x63,0x6c,0x69,0x70,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x0c,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x14,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x03,0x00,
+    0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x48,0x00,0x04,0x00,0x16,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x16,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
+    0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x48,0x00,0x04,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x48,0x00,0x05,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x23,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x48,0x00,0x04,0x00,0x16,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x16,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
+    0x16,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x80,0x00,0x00,0x00,
+    0x48,0x00,0x05,0x00,0x16,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+    0xc0,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x23,0x00,0x00,0x00,0xcc,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x18,0x00,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x18,0x00,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x21,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x25,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x2f,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x33,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x3d,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x49,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x4b,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x4e,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x4f,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x47,0x00,0x03,0x00,0x53,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x53,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
+    0x53,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x48,0x00,0x05,0x00,0x53,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,
+    0x04,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x5d,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x13,0x00,0x02,0x00,0x02,0x00,0x00,0x00,0x21,0x00,0x03,0x00,
+    0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x16,0x00,0x03,0x00,0x06,0x00,0x00,0x00,
+    0x20,0x00,0x00,0x00,0x17,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x04,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x17,0x00,0x04,0x00,0x0a,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x0b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x0a,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x0b,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+    0x00,0x00,0x80,0x3f,0x20,0x00,0x04,0x00,0x13,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x0a,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x13,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x18,0x00,0x04,0x00,0x15,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x04,0x00,0x00,0x00,0x1e,0x00,0x07,0x00,0x16,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+    0x15,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x16,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x15,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x2b,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x1b,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x13,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x2b,0x00,0x04,0x00,0x19,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x0b,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x13,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x32,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x32,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x13,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x15,0x00,0x04,0x00,0x41,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x2b,0x00,0x04,0x00,0x41,0x00,0x00,0x00,0x42,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x43,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x17,0x00,0x04,0x00,0x47,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x48,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x47,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x48,0x00,0x00,0x00,0x49,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x4a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x4a,0x00,0x00,0x00,0x4b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x4d,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x4d,0x00,0x00,0x00,0x4e,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x43,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x2b,0x00,0x04,0x00,0x41,0x00,0x00,0x00,0x51,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x1c,0x00,0x04,0x00,0x52,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x51,0x00,0x00,0x00,
+    0x1e,0x00,0x06,0x00,0x53,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x52,0x00,0x00,0x00,0x52,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x54,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x53,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x54,0x00,0x00,0x00,
+    0x55,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x19,0x00,0x00,0x00,
+    0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x5b,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x5b,0x00,0x00,0x00,
+    0x5d,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x36,0x00,0x05,0x00,0x02,0x00,0x00,0x00,
+    0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,
+    0x05,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x0a,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,
+    0x0c,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,
+    0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x50,0x00,0x07,0x00,0x07,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x09,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x1b,0x00,0x00,0x00,
+    0x1c,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x15,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x91,0x00,0x05,0x00,
+    0x07,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,
+    0x4f,0x00,0x08,0x00,0x0a,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,
+    0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x14,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
+    0x1b,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x22,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x15,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x0a,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x25,0x00,0x00,0x00,
+    0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x26,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x29,0x00,0x00,0x00,
+    0x26,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x2a,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x50,0x00,0x07,0x00,
+    0x07,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x29,0x00,0x00,0x00,
+    0x2a,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x91,0x00,0x05,0x00,0x07,0x00,0x00,0x00,
+    0x2c,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x4f,0x00,0x08,0x00,
+    0x0a,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0c,0x00,0x06,0x00,
+    0x0a,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x45,0x00,0x00,0x00,
+    0x2d,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x21,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,
+    0x41,0x00,0x05,0x00,0x1b,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x15,0x00,0x00,0x00,0x31,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x34,0x00,0x00,0x00,
+    0x33,0x00,0x00,0x00,0x4f,0x00,0x08,0x00,0x0a,0x00,0x00,0x00,0x35,0x00,0x00,0x00,
+    0x34,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x36,0x00,0x00,0x00,
+    0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x37,0x00,0x00,0x00,0x35,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x35,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x50,0x00,0x07,0x00,0x07,0x00,0x00,0x00,0x39,0x00,0x00,0x00,0x36,0x00,0x00,0x00,
+    0x37,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x91,0x00,0x05,0x00,
+    0x07,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,0x31,0x00,0x00,0x00,0x39,0x00,0x00,0x00,
+    0x4f,0x00,0x08,0x00,0x0a,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,
+    0x3a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x0c,0x00,0x06,0x00,0x0a,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x45,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x2f,0x00,0x00,0x00,
+    0x3c,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x0a,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x0a,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,
+    0x2f,0x00,0x00,0x00,0x0c,0x00,0x07,0x00,0x0a,0x00,0x00,0x00,0x40,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x44,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,
+    0x41,0x00,0x05,0x00,0x43,0x00,0x00,0x00,0x44,0x00,0x00,0x00,0x33,0x00,0x00,0x00,
+    0x42,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x45,0x00,0x00,0x00,
+    0x44,0x00,0x00,0x00,0x8e,0x00,0x05,0x00,0x0a,0x00,0x00,0x00,0x46,0x00,0x00,0x00,
+    0x40,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x3d,0x00,0x00,0x00,
+    0x46,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x47,0x00,0x00,0x00,0x4c,0x00,0x00,0x00,
+    0x4b,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x49,0x00,0x00,0x00,0x4c,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x4e,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
+    0x1b,0x00,0x00,0x00,0x57,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x56,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x15,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x57,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+    0x91,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0x58,0x00,0x00,0x00,
+    0x59,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x5b,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,
+    0x55,0x00,0x00,0x00,0x56,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x5c,0x00,0x00,0x00,
+    0x5a,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x5b,0x00,0x00,0x00,0x5e,0x00,0x00,0x00,
+    0x55,0x00,0x00,0x00,0x56,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
+    0x5f,0x00,0x00,0x00,0x5e,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x5d,0x00,0x00,0x00,
+    0x5f,0x00,0x00,0x00,0xfd,0x00,0x01,0x00,0x38,0x00,0x01,0x00,
+};
+/*
+    #version 460
+
+    struct punctual_light
+    {
+        vec4 position_range;
+        vec4 color_spot_scale;
+        vec4 direction_spot_offset;
+    };
+
+    struct light_cluster
+    {
+        uint offset;
+        uint count;
+    };
+
+    struct light_index
+    {
+        uint light;
+    };
+
+    layout(set = 0, binding = 3, std140) uniform light_params
+    {
+        vec4 cluster_grid;
+        vec4 cluster_depth;
+    } _93;
+
+    layout(set = 1, binding = 10, std430) readonly buffer light_clusters
+    {
+        light_cluster clusters[];
+    } _160;
+
+    layout(set = 0, binding = 1, std140) uniform fs_params
+    {
+        vec4 base_color_factor;
+        float metallic_factor;
+        float roughness_factor;
+        vec3 emissive_factor;
+        float _pad0;
+        vec3 cam_pos;
+        float _pad1;
+    } _541;
+
+    layout(set = 1, binding = 9, std430) readonly buffer punctual_lights
+    {
+        punctual_light lights[];
+    } _715;
+
+    layout(set = 1, binding = 11, std430) readonly buffer light_index_list
+    {
+        light_index light_indices[];
+    } _720;
+
+    layout(set = 1, binding = 0) uniform texture2D base_color_tex;
+    layout(set = 1, binding = 32) uniform sampler base_color_smp;
+    layout(set = 1, binding = 1) uniform texture2D metallic_roughness_tex;
+    layout(set = 1, binding = 33) uniform sampler metallic_roughness_smp;
+    layout(set = 1, binding = 3) uniform texture2D occlusion_tex;
+    layout(set = 1, binding = 35) uniform sampler occlusion_smp;
+    layout(set = 1, binding = 4) uniform texture2D emissive_tex;
+    layout(set = 1, binding = 36) uniform sampler emissive_smp;
+    layout(set = 1, binding = 2) uniform texture2D normal_tex;
+    layout(set = 1, binding = 34) uniform sampler normal_smp;
+    layout(set = 1, binding = 5) uniform textureCube irradiance_map;
+    layout(set = 1, binding = 37) uniform sampler irradiance_smp;
+    layout(set = 1, binding = 6) uniform textureCube prefilter_map;
+    layout(set = 1, binding = 38) uniform sampler prefilter_smp;
+    layout(set = 1, binding = 7) uniform texture2D brdf_lut;
+    layout(set = 1, binding = 39) uniform sampler brdf_lut_smp;
+
+    layout(location = 4) in vec2 v_uv;
+    layout(location = 5) in float v_occlusion;
+    layout(location = 2) in vec3 v_tangent;
+    layout(location = 3) in vec3 v_bitangent;
+    layout(location = 1) in vec3 v_normal;
+    layout(location = 0) in vec3 v_world_pos;
+    layout(location = 6) in vec4 v_clip;
+    layout(location = 0) out vec4 frag_color;
+
+    float D_GGX(float NdotH, float roughness)
+    {
+        float _313 = roughness * roughness;
+        float _317 = _313 * _313;
+        float _327 = ((NdotH * NdotH) * (_317 - 1.0)) + 1.0;
+        return _317 / ((3.1415927410125732421875 * _327) * _327);
+    }
+
+    float G_SmithGGX(float NdotV, float NdotL, float roughness)
+    {
+        float _340 = roughness * roughness;
+        float _344 = _340 * _340;
+        float _351 = 1.0 - _344;
+        return 0.5 / max((NdotL * sqrt(((NdotV * NdotV) * _351) + _344)) + (NdotV * sqrt(((NdotL * NdotL) * _351) + _344)), 9.9999997473787516355514526367188e-05);
+    }
+
+    float SchlickFresnel(float u)
+    {
+        float _298 = clamp(1.0 - u, 0.0, 1.0);
+        float _302 = _298 * _298;
+        return (_302 * _302) * _298;
+    }
+
+    vec3 F_Schlick(float VdotH, vec3 F0)
+    {
+        float param = VdotH;
+        return F0 + ((vec3(1.0) - F0) * SchlickFresnel(param));
+    }
+
+    float Fd_DisneyDiffuse(float NdotV, float NdotL, float LdotH, float roughness)
+    {
+        float _422 = (mix(0.0, 0.5, roughness) + (((2.0 * LdotH) * LdotH) * roughness)) - 1.0;
+        float param = NdotV;
+        float param_1 = NdotL;
+        return ((1.0 + (_422 * SchlickFresnel(param))) * (1.0 + (_422 * SchlickFresnel(param_1)))) * mix(1.0, 0.662251651287078857421875, roughness);
+    }
+
+    vec3 directLight(vec3 N, vec3 V, vec3 L, vec3 F0, vec3 diffuseColor, float metallic, float roughness, float NdotV)
+    {
+        vec3 _447 = normalize(V + L);
+        float _452 = max(dot(N, L), 9.9999997473787516355514526367188e-05);
+        float param = max(dot(N, _447), 0.0);
+        float param_1 = roughness;
+        float param_2 = NdotV;
+        float param_3 = _452;
+        float param_4 = roughness;
+        float param_5 = max(dot(V, _447), 0.0);
+        vec3 param_6 = F0;
+        vec3 _487 = F_Schlick(param_5, param_6);
+        float param_7 = NdotV;
+        float param_8 = _452;
+        float param_9 = max(dot(L, _447), 0.0);
+        float param_10 = roughness;
+        return ((((vec3(1.0) - _487) * (1.0 - metallic)) * (diffuseColor * Fd_DisneyDiffuse(param_7, param_8, param_9, param_10))) + (_487 * (D_GGX(param, param_1) * G_SmithGGX(param_2, param_3, param_4)))) * _452;
+    }
+
+    uvec2 clusterLightRange(vec4 clip)
+    {
+        ivec3 _133 = clamp(ivec3(vec3((((clip.xy / vec2(clip.w)) * 0.5) + vec2(0.5)) * _93.cluster_grid.xy, (log(max(clip.w, 9.9999999747524270787835121154785e-07)) * _93.cluster_depth.x) + _93.cluster_depth.y)), ivec3(0), ivec3(_93.cluster_grid.xyz) - ivec3(1));
+        int _152 = (((_133.z * int(_93.cluster_grid.y)) + _133.y) * int(_93.cluster_grid.x)) + _133.x;
+        return uvec2(_160.clusters[_152].offset, _160.clusters[_152].count);
+    }
+
+    float punctualAttenuation(punctual_light light, vec3 world_pos, inout vec3 L)
+    {
+        vec3 _182 = light.position_range.xyz - world_pos;
+        float _188 = max(dot(_182, _182), 9.9999999392252902907785028219223e-09);
+        L = _182 * inversesqrt(_188);
+        float _200 = _188 / (light.position_range.w * light.position_range.w);
+        float _208 = clamp(1.0 - (_200 * _200), 0.0, 1.0);
+        float _223 = clamp((dot(light.direction_spot_offset.xyz, -L) * light.color_spot_scale.w) + light.direction_spot_offset.w, 0.0, 1.0);
+        return (((_208 * _208) * _223) * _223) / _188;
+    }
+
+    vec3 F_SchlickRoughness(float NdotV, vec3 F0, float roughness)
+    {
+        float param = NdotV;
+        return F0 + ((max(vec3(1.0 - roughness), F0) - F0) * SchlickFresnel(param));
+    }
+
+    vec3 ACESFilm(vec3 x)
+    {
+        return clamp((x * ((x * 2.5099999904632568359375) + vec3(0.02999999932944774627685546875))) / ((x * ((x * 2.4300000667572021484375) + vec3(0.589999973773956298828125))) + vec3(0.14000000059604644775390625)), vec3(0.0), vec3(1.0));
+    }
+
+    vec3 linearToSRGB(vec3 c)
+    {
+        return mix(c * 12.9200000762939453125, (pow(max(c, vec3(0.0)), vec3(0.4166666567325592041015625)) * 1.05499994754791259765625) - vec3(0.054999999701976776123046875), step(vec3(0.003130800090730190277099609375), c));
+    }
+
+    void main()
+    {
+        vec4 _544 = texture(sampler2D(base_color_tex, base_color_smp), v_uv) * _541.base_color_factor;
+        vec4 _552 = texture(sampler2D(metallic_roughness_tex, metallic_roughness_smp), v_uv);
+        float _559 = _552.z * _541.metallic_factor;
+        float _567 = clamp(_552.y * _541.roughness_factor, 0.039999999105930328369140625, 1.0);
+        vec3 _635 = normalize(mat3(v_tangent, v_bitangent, v_normal) * ((texture(sampler2D(normal_tex, normal_smp), v_uv).xyz * 2.0) - vec3(1.0)));
+        vec3 _643 = normalize(_541.cam_pos - v_world_pos);
+        float _653 = max(dot(_635, _643), 9.9999997473787516355514526367188e-05);
+        vec3 _657 = _544.xyz;
+        vec3 _660 = mix(vec3(0.039999999105930328369140625), _657, vec3(_559));
+        float _665 = 1.0 - _559;
+        vec3 _666 = _657 * _665;
+        vec3 param = _635;
+        vec3 param_1 = _643;
+        vec3 param_2 = vec3(0.57735025882720947265625);
+        vec3 param_3 = _660;
+        vec3 param_4 = _666;
+        float param_5 = _559;
+        float param_6 = _567;
+        float param_7 = _653;
+        vec3 Lo = directLight(param, param_1, param_2, param_3, param_4, param_5, param_6, param_7);
+        vec4 param_8 = v_clip;
+        uvec2 _698 = clusterLightRange(param_8);
+        vec3 param_11;
+        for (uint i = 0u; i < _698.y; i++)
+        {
+            uint _724 = _698.x + i;
+            punctual_light param_9 = punctual_light(_715.lights[_720.light_indices[_724].light].position_range, _715.lights[_720.light_indices[_724].light].color_spot_scale, _715.lights[_720.light_indices[_724].light].direction_spot_offset);
+            vec3 param_10 = v_world_pos;
+            float _744 = punctualAttenuation(param_9, param_10, param_11);
+            if (_744 > 0.0)
+            {
+                vec3 param_12 = _635;
+                vec3 param_13 = _643;
+                vec3 param_14 = param_11;
+                vec3 param_15 = _660;
+                vec3 param_16 = _666;
+                float param_17 = _559;
+                float param_18 = _567;
+                float param_19 = _653;
+                Lo += ((directLight(param_12, param_13, param_14, param_15, param_16, param_17, param_18, param_19) * _715.lights[_720.light_indices[_724].light].color_spot_scale.xyz) * _744);
+            }
+        }
+        float param_20 = _653;
+        vec3 param_21 = _660;
+        float param_22 = _567;
+        vec3 _784 = F_SchlickRoughness(param_20, param_21, param_22);
+        vec4 _831 = texture(sampler2D(brdf_lut, brdf_lut_smp), vec2(_653, _567));
+        vec3 param_23 = ((((((vec3(1.0) - _784) * _665) * ((texture(samplerCube(irradiance_map, irradiance_smp), _635).xyz * _666) * 0.300000011920928955078125)) + ((textureLod(samplerCube(prefilter_map, prefilter_smp), reflect(-_643, _635), _567 * 4.0).xyz * ((_784 * _831.x) + vec3(_831.y))) * 0.5)) * (texture(sampler2D(occlusion_tex, occlusion_smp), v_uv).x * v_occlusion)) + Lo) + (texture(sampler2D(emissive_tex, emissive_smp), v_uv).xyz * _541.emissive_factor);
+        vec3 param_24 = ACESFilm(param_23);
+        frag_color = vec4(linearToSRGB(param_24), _544.w);
+    }
+
+*/
+static const uint8_t pbr_fs_clustered_bytecode_spirv_vk[22524] = {
+    0x03,0x02,0x23,0x07,0x00,0x04,0x01,0x00,0x0b,0x00,0x08,0x00,0x5e,0x03,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x11,0x00,0x02,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x06,0x00,
+    0x01,0x00,0x00,0x00,0x47,0x4c,0x53,0x4c,0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,
+    0x00,0x00,0x00,0x00,0x0e,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x0f,0x00,0x22,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6d,0x61,0x69,0x6e,
+    0x00,0x00,0x00,0x00,0x32,0x01,0x00,0x00,0x6b,0x01,0x00,0x00,0xee,0x01,0x00,0x00,
+    0xf2,0x01,0x00,0x00,0xf7,0x01,0x00,0x00,0xfc,0x01,0x00,0x00,0x01,0x02,0x00,0x00,
+    0x03,0x02,0x00,0x00,0x18,0x02,0x00,0x00,0x1a,0x02,0x00,0x00,0x1c,0x02,0x00,0x00,
+    0x2c,0x02,0x00,0x00,0x2e,0x02,0x00,0x00,0x3d,0x02,0x00,0x00,0x7b,0x02,0x00,0x00,
+    0x98,0x02,0x00,0x00,0x9d,0x02,0x00,0x00,0xfc,0x02,0x00,0x00,0xfe,0x02,0x00,0x00,
+    0x0c,0x03,0x00,0x00,0x0e,0x03,0x00,0x00,0x1a,0x03,0x00,0x00,0x1c,0x03,0x00,0x00,
+    0x33,0x03,0x00,0x00,0x35,0x03,0x00,0x00,0x3c,0x03,0x00,0x00,0x42,0x03,0x00,0x00,
+    0x44,0x03,0x00,0x00,0x54,0x03,0x00,0x00,0x10,0x00,0x03,0x00,0x04,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x00,0x00,0xcc,0x01,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x6d,0x61,0x69,0x6e,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x06,0x00,0x0b,0x00,0x00,0x00,0x44,0x5f,0x47,0x47,0x58,0x28,0x66,0x31,
+    0x3b,0x66,0x31,0x3b,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x09,0x00,0x00,0x00,
+    0x4e,0x64,0x6f,0x74,0x48,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x0a,0x00,0x00,0x00,
+    0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x00,0x00,0x00,0x05,0x00,0x08,0x00,
+    0x11,0x00,0x00,0x00,0x47,0x5f,0x53,0x6d,0x69,0x74,0x68,0x47,0x47,0x58,0x28,0x66,
+    0x31,0x3b,0x66,0x31,0x3b,0x66,0x31,0x3b,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x0e,0x00,0x00,0x00,0x4e,0x64,0x6f,0x74,0x56,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x0f,0x00,0x00,0x00,0x4e,0x64,0x6f,0x74,0x4c,0x00,0x00,0x00,0x05,0x00,0x05,0x00,
+    0x10,0x00,0x00,0x00,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x00,0x00,0x00,
+    0x05,0x00,0x07,0x00,0x15,0x00,0x00,0x00,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,
+    0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x66,0x31,0x3b,0x00,0x00,0x05,0x00,0x03,0x00,
+    0x14,0x00,0x00,0x00,0x75,0x00,0x00,0x00,0x05,0x00,0x07,0x00,0x1c,0x00,0x00,0x00,
+    0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x28,0x66,0x31,0x3b,0x76,0x66,0x33,
+    0x3b,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x1a,0x00,0x00,0x00,0x56,0x64,0x6f,0x74,
+    0x48,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x1b,0x00,0x00,0x00,0x46,0x30,0x00,0x00,
+    0x05,0x00,0x0a,0x00,0x23,0x00,0x00,0x00,0x46,0x64,0x5f,0x44,0x69,0x73,0x6e,0x65,
+    0x79,0x44,0x69,0x66,0x66,0x75,0x73,0x65,0x28,0x66,0x31,0x3b,0x66,0x31,0x3b,0x66,
+    0x31,0x3b,0x66,0x31,0x3b,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x1f,0x00,0x00,0x00,
+    0x4e,0x64,0x6f,0x74,0x56,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x20,0x00,0x00,0x00,
+    0x4e,0x64,0x6f,0x74,0x4c,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x21,0x00,0x00,0x00,
+    0x4c,0x64,0x6f,0x74,0x48,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x22,0x00,0x00,0x00,
+    0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x00,0x00,0x00,0x05,0x00,0x0d,0x00,
+    0x2e,0x00,0x00,0x00,0x64,0x69,0x72,0x65,0x63,0x74,0x4c,0x69,0x67,0x68,0x74,0x28,
+    0x76,0x66,0x33,0x3b,0x76,0x66,0x33,0x3b,0x76,0x66,0x33,0x3b,0x76,0x66,0x33,0x3b,
+    0x76,0x66,0x33,0x3b,0x66,0x31,0x3b,0x66,0x31,0x3b,0x66,0x31,0x3b,0x00,0x00,0x00,
+    0x05,0x00,0x03,0x00,0x26,0x00,0x00,0x00,0x4e,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
+    0x27,0x00,0x00,0x00,0x56,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x28,0x00,0x00,0x00,
+    0x4c,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x29,0x00,0x00,0x00,0x46,0x30,0x00,0x00,
+    0x05,0x00,0x06,0x00,0x2a,0x00,0x00,0x00,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,
+    0x6f,0x6c,0x6f,0x72,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x2b,0x00,0x00,0x00,
+    0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,
+    0x2c,0x00,0x00,0x00,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x2d,0x00,0x00,0x00,0x4e,0x64,0x6f,0x74,0x56,0x00,0x00,0x00,
+    0x05,0x00,0x08,0x00,0x36,0x00,0x00,0x00,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x4c,
+    0x69,0x67,0x68,0x74,0x52,0x61,0x6e,0x67,0x65,0x28,0x76,0x66,0x34,0x3b,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x35,0x00,0x00,0x00,0x63,0x6c,0x69,0x70,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x06,0x00,0x38,0x00,0x00,0x00,0x70,0x75,0x6e,0x63,0x74,0x75,0x61,0x6c,
+    0x5f,0x6c,0x69,0x67,0x68,0x74,0x00,0x00,0x06,0x00,0x07,0x00,0x38,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x72,0x61,0x6e,
+    0x67,0x65,0x00,0x00,0x06,0x00,0x08,0x00,0x38,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x73,0x63,0x61,0x6c,0x65,
+    0x00,0x00,0x00,0x00,0x06,0x00,0x09,0x00,0x38,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x00,0x00,0x00,0x05,0x00,0x12,0x00,0x3e,0x00,0x00,0x00,
+    0x70,0x75,0x6e,0x63,0x74,0x75,0x61,0x6c,0x41,0x74,0x74,0x65,0x6e,0x75,0x61,0x74,
+    0x69,0x6f,0x6e,0x28,0x73,0x74,0x72,0x75,0x63,0x74,0x2d,0x70,0x75,0x6e,0x63,0x74,
+    0x75,0x61,0x6c,0x5f,0x6c,0x69,0x67,0x68,0x74,0x2d,0x76,0x66,0x34,0x2d,0x76,0x66,
+    0x34,0x2d,0x76,0x66,0x34,0x31,0x3b,0x76,0x66,0x33,0x3b,0x76,0x66,0x33,0x3b,0x00,
+    0x05,0x00,0x04,0x00,0x3b,0x00,0x00,0x00,0x6c,0x69,0x67,0x68,0x74,0x00,0x00,0x00,
+    0x05,0x00,0x05,0x00,0x3c,0x00,0x00,0x00,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,
+    0x73,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x3d,0x00,0x00,0x00,0x4c,0x00,0x00,0x00,
+    0x05,0x00,0x0a,0x00,0x44,0x00,0x00,0x00,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,
+    0x6b,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x28,0x66,0x31,0x3b,0x76,0x66,
+    0x33,0x3b,0x66,0x31,0x3b,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x41,0x00,0x00,0x00,
+    0x4e,0x64,0x6f,0x74,0x56,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x42,0x00,0x00,0x00,
+    0x46,0x30,0x00,0x00,0x05,0x00,0x05,0x00,0x43,0x00,0x00,0x00,0x72,0x6f,0x75,0x67,
+    0x68,0x6e,0x65,0x73,0x73,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0x48,0x00,0x00,0x00,
+    0x41,0x43,0x45,0x53,0x46,0x69,0x6c,0x6d,0x28,0x76,0x66,0x33,0x3b,0x00,0x00,0x00,
+    0x05,0x00,0x03,0x00,0x47,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x05,0x00,0x07,0x00,
+    0x4b,0x00,0x00,0x00,0x6c,0x69,0x6e,0x65,0x61,0x72,0x54,0x6f,0x53,0x52,0x47,0x42,
+    0x28,0x76,0x66,0x33,0x3b,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x4a,0x00,0x00,0x00,
+    0x63,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x4d,0x00,0x00,0x00,0x5f,0x33,0x31,0x33,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x51,0x00,0x00,0x00,0x5f,0x33,0x31,0x37,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x55,0x00,0x00,0x00,0x5f,0x33,0x32,0x37,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x67,0x00,0x00,0x00,0x5f,0x33,0x34,0x30,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x6b,0x00,0x00,0x00,0x5f,0x33,0x34,0x34,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x6f,0x00,0x00,0x00,0x5f,0x33,0x35,0x31,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x8d,0x00,0x00,0x00,0x5f,0x32,0x39,0x38,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x92,0x00,0x00,0x00,0x5f,0x33,0x30,0x32,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x9d,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xa3,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xaa,0x00,0x00,0x00,0x5f,0x34,0x32,0x32,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xb6,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xb8,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x00,0x05,0x00,0x04,0x00,0xbb,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xc1,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xcd,0x00,0x00,0x00,0x5f,0x34,0x34,0x37,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xd2,0x00,0x00,0x00,0x5f,0x34,0x35,0x32,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xd7,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xdc,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x00,0x05,0x00,0x04,0x00,0xde,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x32,0x00,0x05,0x00,0x04,0x00,0xe0,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x33,0x00,0x05,0x00,0x04,0x00,0xe2,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x34,0x00,0x05,0x00,0x04,0x00,0xe4,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x35,0x00,0x05,0x00,0x04,0x00,0xe9,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x36,0x00,0x05,0x00,0x04,0x00,0xeb,0x00,0x00,0x00,0x5f,0x34,0x38,0x37,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xec,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xee,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xf1,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x37,0x00,0x05,0x00,0x04,0x00,0xf3,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x38,0x00,0x05,0x00,0x04,0x00,0xf5,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x39,0x00,0x05,0x00,0x05,0x00,0xfa,0x00,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x30,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x02,0x01,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x04,0x01,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x06,0x01,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x08,0x01,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x0e,0x01,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x10,0x01,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x13,0x01,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x15,0x01,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x17,0x01,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x24,0x01,0x00,0x00,
+    0x5f,0x31,0x33,0x33,0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0x30,0x01,0x00,0x00,
+    0x6c,0x69,0x67,0x68,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x00,0x00,0x00,0x00,
+    0x06,0x00,0x07,0x00,0x30,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x6c,0x75,0x73,
+    0x74,0x65,0x72,0x5f,0x67,0x72,0x69,0x64,0x00,0x00,0x00,0x00,0x06,0x00,0x07,0x00,
+    0x30,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,
+    0x64,0x65,0x70,0x74,0x68,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x32,0x01,0x00,0x00,
+    0x5f,0x39,0x33,0x00,0x05,0x00,0x04,0x00,0x55,0x01,0x00,0x00,0x5f,0x31,0x35,0x32,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0x67,0x01,0x00,0x00,0x6c,0x69,0x67,0x68,
+    0x74,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x00,0x00,0x00,0x06,0x00,0x05,0x00,
+    0x67,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0x66,0x66,0x73,0x65,0x74,0x00,0x00,
+    0x06,0x00,0x05,0x00,0x67,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x63,0x6f,0x75,0x6e,
+    0x74,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0x69,0x01,0x00,0x00,0x6c,0x69,0x67,0x68,
+    0x74,0x5f,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x73,0x00,0x00,0x06,0x00,0x06,0x00,
+    0x69,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x73,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x6b,0x01,0x00,0x00,0x5f,0x31,0x36,0x30,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x76,0x01,0x00,0x00,0x5f,0x31,0x38,0x32,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x7c,0x01,0x00,0x00,0x5f,0x31,0x38,0x38,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x86,0x01,0x00,0x00,0x5f,0x32,0x30,0x30,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x8e,0x01,0x00,0x00,0x5f,0x32,0x30,0x38,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x94,0x01,0x00,0x00,0x5f,0x32,0x32,0x33,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xae,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xb8,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xeb,0x01,0x00,0x00,0x5f,0x35,0x34,0x34,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0xee,0x01,0x00,0x00,0x62,0x61,0x73,0x65,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x74,0x65,0x78,0x00,0x00,0x05,0x00,0x06,0x00,
+    0xf2,0x01,0x00,0x00,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,
+    0x6d,0x70,0x00,0x00,0x05,0x00,0x04,0x00,0xf7,0x01,0x00,0x00,0x76,0x5f,0x75,0x76,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0xfa,0x01,0x00,0x00,0x66,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x00,0x00,0x00,0x06,0x00,0x08,0x00,0xfa,0x01,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x66,
+    0x61,0x63,0x74,0x6f,0x72,0x00,0x00,0x00,0x06,0x00,0x07,0x00,0xfa,0x01,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x66,0x61,0x63,
+    0x74,0x6f,0x72,0x00,0x06,0x00,0x08,0x00,0xfa,0x01,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,
+    0x00,0x00,0x00,0x00,0x06,0x00,0x07,0x00,0xfa,0x01,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x00,
+    0x06,0x00,0x05,0x00,0xfa,0x01,0x00,0x00,0x04,0x00,0x00,0x00,0x5f,0x70,0x61,0x64,
+    0x30,0x00,0x00,0x00,0x06,0x00,0x05,0x00,0xfa,0x01,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x63,0x61,0x6d,0x5f,0x70,0x6f,0x73,0x00,0x06,0x00,0x05,0x00,0xfa,0x01,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x5f,0x70,0x61,0x64,0x31,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0xfc,0x01,0x00,0x00,0x5f,0x35,0x34,0x31,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x00,0x02,0x00,0x00,0x5f,0x35,0x35,0x32,0x00,0x00,0x00,0x00,0x05,0x00,0x08,0x00,
+    0x01,0x02,0x00,0x00,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x72,0x6f,0x75,
+    0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x74,0x65,0x78,0x00,0x00,0x05,0x00,0x08,0x00,
+    0x03,0x02,0x00,0x00,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x72,0x6f,0x75,
+    0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x73,0x6d,0x70,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x08,0x02,0x00,0x00,0x5f,0x35,0x35,0x39,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x0e,0x02,0x00,0x00,0x5f,0x35,0x36,0x37,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x16,0x02,0x00,0x00,0x5f,0x36,0x33,0x35,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,
+    0x18,0x02,0x00,0x00,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x00,0x00,0x00,
+    0x05,0x00,0x05,0x00,0x1a,0x02,0x00,0x00,0x76,0x5f,0x62,0x69,0x74,0x61,0x6e,0x67,
+    0x65,0x6e,0x74,0x00,0x05,0x00,0x05,0x00,0x1c,0x02,0x00,0x00,0x76,0x5f,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x2c,0x02,0x00,0x00,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x74,0x65,0x78,0x00,0x00,0x05,0x00,0x05,0x00,
+    0x2e,0x02,0x00,0x00,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x73,0x6d,0x70,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x38,0x02,0x00,0x00,0x5f,0x36,0x34,0x33,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x05,0x00,0x3d,0x02,0x00,0x00,0x76,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,
+    0x70,0x6f,0x73,0x00,0x05,0x00,0x04,0x00,0x41,0x02,0x00,0x00,0x5f,0x36,0x35,0x33,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x46,0x02,0x00,0x00,0x5f,0x36,0x35,0x37,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x49,0x02,0x00,0x00,0x5f,0x36,0x36,0x30,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x4f,0x02,0x00,0x00,0x5f,0x36,0x36,0x35,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x52,0x02,0x00,0x00,0x5f,0x36,0x36,0x36,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x56,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x58,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x00,0x05,0x00,0x04,0x00,0x5a,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x32,0x00,0x05,0x00,0x04,0x00,0x5d,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x33,0x00,0x05,0x00,0x04,0x00,0x5f,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x34,0x00,0x05,0x00,0x04,0x00,0x61,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x35,0x00,0x05,0x00,0x04,0x00,0x63,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x36,0x00,0x05,0x00,0x04,0x00,0x65,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x37,0x00,0x05,0x00,0x03,0x00,0x67,0x02,0x00,0x00,0x4c,0x6f,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x68,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x6a,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x6c,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x6e,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x70,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x72,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x74,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x76,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x79,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x00,
+    0x05,0x00,0x04,0x00,0x7b,0x02,0x00,0x00,0x76,0x5f,0x63,0x6c,0x69,0x70,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x7e,0x02,0x00,0x00,0x5f,0x36,0x39,0x38,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x7f,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,
+    0x05,0x00,0x03,0x00,0x83,0x02,0x00,0x00,0x69,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x8e,0x02,0x00,0x00,0x5f,0x37,0x32,0x34,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x93,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x00,0x05,0x00,0x06,0x00,
+    0x94,0x02,0x00,0x00,0x70,0x75,0x6e,0x63,0x74,0x75,0x61,0x6c,0x5f,0x6c,0x69,0x67,
+    0x68,0x74,0x00,0x00,0x06,0x00,0x07,0x00,0x94,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x72,0x61,0x6e,0x67,0x65,0x00,0x00,
+    0x06,0x00,0x08,0x00,0x94,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x63,0x6f,0x6c,0x6f,
+    0x72,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x73,0x63,0x61,0x6c,0x65,0x00,0x00,0x00,0x00,
+    0x06,0x00,0x09,0x00,0x94,0x02,0x00,0x00,0x02,0x00,0x00,0x00,0x64,0x69,0x72,0x65,
+    0x63,0x74,0x69,0x6f,0x6e,0x5f,0x73,0x70,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0x96,0x02,0x00,0x00,0x70,0x75,0x6e,0x63,
+    0x74,0x75,0x61,0x6c,0x5f,0x6c,0x69,0x67,0x68,0x74,0x73,0x00,0x06,0x00,0x05,0x00,
+    0x96,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x6c,0x69,0x67,0x68,0x74,0x73,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x98,0x02,0x00,0x00,0x5f,0x37,0x31,0x35,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x05,0x00,0x99,0x02,0x00,0x00,0x6c,0x69,0x67,0x68,0x74,0x5f,0x69,0x6e,
+    0x64,0x65,0x78,0x00,0x06,0x00,0x05,0x00,0x99,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x6c,0x69,0x67,0x68,0x74,0x00,0x00,0x00,0x05,0x00,0x07,0x00,0x9b,0x02,0x00,0x00,
+    0x6c,0x69,0x67,0x68,0x74,0x5f,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6c,0x69,0x73,0x74,
+    0x00,0x00,0x00,0x00,0x06,0x00,0x07,0x00,0x9b,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x6c,0x69,0x67,0x68,0x74,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x9d,0x02,0x00,0x00,0x5f,0x37,0x32,0x30,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x05,0x00,0xaf,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xb1,0x02,0x00,0x00,0x5f,0x37,0x34,0x34,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0xb2,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x31,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xb3,0x02,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xb5,0x02,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xb7,0x02,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0xbf,0x02,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,
+    0xc1,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x05,0x00,0xc3,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x34,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0xc5,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x35,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0xc7,0x02,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x36,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,
+    0xc9,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x37,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x05,0x00,0xcb,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x38,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0xcd,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x39,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xcf,0x02,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xd1,0x02,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xd3,0x02,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xd5,0x02,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xd7,0x02,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xd9,0x02,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xdb,0x02,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xdd,0x02,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0xed,0x02,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x30,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,
+    0xef,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x31,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x05,0x00,0xf1,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x32,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xf3,0x02,0x00,0x00,0x5f,0x37,0x38,0x34,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xf4,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xf6,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xf8,0x02,0x00,0x00,0x70,0x61,0x72,0x61,
+    0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xfb,0x02,0x00,0x00,0x5f,0x38,0x33,0x31,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0xfc,0x02,0x00,0x00,0x62,0x72,0x64,0x66,
+    0x5f,0x6c,0x75,0x74,0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0xfe,0x02,0x00,0x00,
+    0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,0x5f,0x73,0x6d,0x70,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x05,0x00,0x05,0x03,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x33,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0x0c,0x03,0x00,0x00,0x69,0x72,0x72,0x61,
+    0x64,0x69,0x61,0x6e,0x63,0x65,0x5f,0x6d,0x61,0x70,0x00,0x00,0x05,0x00,0x06,0x00,
+    0x0e,0x03,0x00,0x00,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5f,0x73,
+    0x6d,0x70,0x00,0x00,0x05,0x00,0x06,0x00,0x1a,0x03,0x00,0x00,0x70,0x72,0x65,0x66,
+    0x69,0x6c,0x74,0x65,0x72,0x5f,0x6d,0x61,0x70,0x00,0x00,0x00,0x05,0x00,0x06,0x00,
+    0x1c,0x03,0x00,0x00,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,0x73,0x6d,
+    0x70,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0x33,0x03,0x00,0x00,0x6f,0x63,0x63,0x6c,
+    0x75,0x73,0x69,0x6f,0x6e,0x5f,0x74,0x65,0x78,0x00,0x00,0x00,0x05,0x00,0x06,0x00,
+    0x35,0x03,0x00,0x00,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x73,0x6d,
+    0x70,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x3c,0x03,0x00,0x00,0x76,0x5f,0x6f,0x63,
+    0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x00,0x05,0x00,0x06,0x00,0x42,0x03,0x00,0x00,
+    0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x74,0x65,0x78,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x06,0x00,0x44,0x03,0x00,0x00,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,
+    0x5f,0x73,0x6d,0x70,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x4f,0x03,0x00,0x00,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x34,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x50,0x03,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x05,0x00,
+    0x54,0x03,0x00,0x00,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x55,0x03,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,
+    0x47,0x00,0x03,0x00,0x30,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
+    0x30,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x48,0x00,0x05,0x00,0x30,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x32,0x01,0x00,0x00,0x21,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x32,0x01,0x00,0x00,0x22,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x67,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x67,0x01,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x68,0x01,0x00,0x00,0x06,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x47,0x00,0x03,0x00,
+    0x69,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x48,0x00,0x04,0x00,0x69,0x01,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x69,0x01,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x03,0x00,
+    0x6b,0x01,0x00,0x00,0x18,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x6b,0x01,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x6b,0x01,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xee,0x01,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xee,0x01,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xf2,0x01,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xf2,0x01,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xf7,0x01,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x47,0x00,0x03,0x00,0xfa,0x01,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0xfa,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0xfa,0x01,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
+    0xfa,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
+    0x48,0x00,0x05,0x00,0xfa,0x01,0x00,0x00,0x03,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+    0x20,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0xfa,0x01,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x23,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0xfa,0x01,0x00,0x00,
+    0x05,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
+    0xfa,0x01,0x00,0x00,0x06,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0xfc,0x01,0x00,0x00,0x21,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0xfc,0x01,0x00,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x01,0x02,0x00,0x00,0x21,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x01,0x02,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x03,0x02,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x03,0x02,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x18,0x02,0x00,0x00,0x1e,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x1a,0x02,0x00,0x00,0x1e,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x1c,0x02,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x2c,0x02,0x00,0x00,0x21,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x2c,0x02,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x2e,0x02,0x00,0x00,0x21,0x00,0x00,0x00,0x22,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x2e,0x02,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x3d,0x02,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x7b,0x02,0x00,0x00,0x1e,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x48,0x00,0x05,0x00,0x94,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x94,0x02,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x23,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x94,0x02,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x95,0x02,0x00,0x00,0x06,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x47,0x00,0x03,0x00,
+    0x96,0x02,0x00,0x00,0x02,0x00,0x00,0x00,0x48,0x00,0x04,0x00,0x96,0x02,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x96,0x02,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x03,0x00,
+    0x98,0x02,0x00,0x00,0x18,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x98,0x02,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x98,0x02,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x99,0x02,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,
+    0x9a,0x02,0x00,0x00,0x06,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x47,0x00,0x03,0x00,
+    0x9b,0x02,0x00,0x00,0x02,0x00,0x00,0x00,0x48,0x00,0x04,0x00,0x9b,0x02,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x9b,0x02,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x03,0x00,
+    0x9d,0x02,0x00,0x00,0x18,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x9d,0x02,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x9d,0x02,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xfc,0x02,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xfc,0x02,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xfe,0x02,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xfe,0x02,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x0c,0x03,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x0c,0x03,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x0e,0x03,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x1a,0x03,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x1a,0x03,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x1c,0x03,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x1c,0x03,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x33,0x03,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x33,0x03,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x35,0x03,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x35,0x03,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x3c,0x03,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x42,0x03,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x42,0x03,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x44,0x03,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x44,0x03,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x54,0x03,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x02,0x00,0x02,0x00,0x00,0x00,
+    0x21,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x16,0x00,0x03,0x00,
+    0x06,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x21,0x00,0x05,0x00,0x08,0x00,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x21,0x00,0x06,0x00,
+    0x0d,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x21,0x00,0x04,0x00,0x13,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x17,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x17,0x00,0x00,0x00,0x21,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0x17,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x21,0x00,0x07,0x00,0x1e,0x00,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x21,0x00,0x0b,0x00,0x25,0x00,0x00,0x00,0x17,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x17,0x00,0x04,0x00,0x30,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x31,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x30,0x00,0x00,0x00,
+    0x15,0x00,0x04,0x00,0x32,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x17,0x00,0x04,0x00,0x33,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x21,0x00,0x04,0x00,0x34,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x31,0x00,0x00,0x00,
+    0x1e,0x00,0x05,0x00,0x38,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x30,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x39,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x38,0x00,0x00,0x00,0x21,0x00,0x06,0x00,0x3a,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x39,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x21,0x00,0x06,0x00,
+    0x40,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x21,0x00,0x04,0x00,0x46,0x00,0x00,0x00,0x17,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,
+    0x00,0x00,0x80,0x3f,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,
+    0xdb,0x0f,0x49,0x40,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x72,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x3f,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x88,0x00,0x00,0x00,
+    0x17,0xb7,0xd1,0x38,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x90,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0xa0,0x00,0x00,0x00,
+    0x5a,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x2b,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xc7,0x00,0x00,0x00,0x53,0x89,0x29,0x3f,0x15,0x00,0x04,0x00,
+    0x21,0x01,0x00,0x00,0x20,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x17,0x00,0x04,0x00,
+    0x22,0x01,0x00,0x00,0x21,0x01,0x00,0x00,0x03,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
+    0x23,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x17,0x00,0x04,0x00,
+    0x25,0x01,0x00,0x00,0x06,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,
+    0x32,0x00,0x00,0x00,0x28,0x01,0x00,0x00,0x03,0x00,0x00,0x00,0x2c,0x00,0x05,0x00,
+    0x25,0x01,0x00,0x00,0x2e,0x01,0x00,0x00,0x72,0x00,0x00,0x00,0x72,0x00,0x00,0x00,
+    0x1e,0x00,0x04,0x00,0x30,0x01,0x00,0x00,0x30,0x00,0x00,0x00,0x30,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x31,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x30,0x01,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x31,0x01,0x00,0x00,0x32,0x01,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x2b,0x00,0x04,0x00,0x21,0x01,0x00,0x00,0x33,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x34,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x30,0x00,0x00,0x00,
+    0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x3b,0x01,0x00,0x00,0xbd,0x37,0x86,0x35,
+    0x2b,0x00,0x04,0x00,0x21,0x01,0x00,0x00,0x3e,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x2b,0x00,0x04,0x00,0x32,0x00,0x00,0x00,0x3f,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x40,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x2b,0x00,0x04,0x00,0x32,0x00,0x00,0x00,0x44,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x2c,0x00,0x06,0x00,0x22,0x01,0x00,0x00,0x4c,0x01,0x00,0x00,0x33,0x01,0x00,0x00,
+    0x33,0x01,0x00,0x00,0x33,0x01,0x00,0x00,0x2c,0x00,0x06,0x00,0x22,0x01,0x00,0x00,
+    0x51,0x01,0x00,0x00,0x3e,0x01,0x00,0x00,0x3e,0x01,0x00,0x00,0x3e,0x01,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x54,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x21,0x01,0x00,0x00,
+    0x2b,0x00,0x04,0x00,0x32,0x00,0x00,0x00,0x56,0x01,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x1e,0x00,0x04,0x00,0x67,0x01,0x00,0x00,0x32,0x00,0x00,0x00,0x32,0x00,0x00,0x00,
+    0x1d,0x00,0x03,0x00,0x68,0x01,0x00,0x00,0x67,0x01,0x00,0x00,0x1e,0x00,0x03,0x00,
+    0x69,0x01,0x00,0x00,0x68,0x01,0x00,0x00,0x20,0x00,0x04,0x00,0x6a,0x01,0x00,0x00,
+    0x0c,0x00,0x00,0x00,0x69,0x01,0x00,0x00,0x3b,0x00,0x04,0x00,0x6a,0x01,0x00,0x00,
+    0x6b,0x01,0x00,0x00,0x0c,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x6d,0x01,0x00,0x00,
+    0x0c,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x80,0x01,0x00,0x00,0x77,0xcc,0x2b,0x32,0x2b,0x00,0x04,0x00,0x21,0x01,0x00,0x00,
+    0x95,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xc1,0x01,0x00,0x00,0xd7,0xa3,0x20,0x40,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xc3,0x01,0x00,0x00,0x8f,0xc2,0xf5,0x3c,0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,
+    0xc4,0x01,0x00,0x00,0xc3,0x01,0x00,0x00,0xc3,0x01,0x00,0x00,0xc3,0x01,0x00,0x00,
+    0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xc9,0x01,0x00,0x00,0x1f,0x85,0x1b,0x40,
+    0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xcb,0x01,0x00,0x00,0x3d,0x0a,0x17,0x3f,
+    0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0xcc,0x01,0x00,0x00,0xcb,0x01,0x00,0x00,
+    0xcb,0x01,0x00,0x00,0xcb,0x01,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xcf,0x01,0x00,0x00,0x29,0x5c,0x0f,0x3e,0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,
+    0xd0,0x01,0x00,0x00,0xcf,0x01,0x00,0x00,0xcf,0x01,0x00,0x00,0xcf,0x01,0x00,0x00,
+    0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0xd3,0x01,0x00,0x00,0x90,0x00,0x00,0x00,
+    0x90,0x00,0x00,0x00,0x90,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xd8,0x01,0x00,0x00,0x52,0xb8,0x4e,0x41,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xdc,0x01,0x00,0x00,0x55,0x55,0xd5,0x3e,0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,
+    0xdd,0x01,0x00,0x00,0xdc,0x01,0x00,0x00,0xdc,0x01,0x00,0x00,0xdc,0x01,0x00,0x00,
+    0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xdf,0x01,0x00,0x00,0x3d,0x0a,0x87,0x3f,
+    0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xe1,0x01,0x00,0x00,0xae,0x47,0x61,0x3d,
+    0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0xe2,0x01,0x00,0x00,0xe1,0x01,0x00,0x00,
+    0xe1,0x01,0x00,0x00,0xe1,0x01,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xe4,0x01,0x00,0x00,0x1c,0x2e,0x4d,0x3b,0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,
+    0xe5,0x01,0x00,0x00,0xe4,0x01,0x00,0x00,0xe4,0x01,0x00,0x00,0xe4,0x01,0x00,0x00,
+    0x19,0x00,0x09,0x00,0xec,0x01,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0xed,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xec,0x01,0x00,0x00,0x3b,0x00,0x04,0x00,0xed,0x01,0x00,0x00,0xee,0x01,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x1a,0x00,0x02,0x00,0xf0,0x01,0x00,0x00,0x20,0x00,0x04,0x00,
+    0xf1,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x01,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0xf1,0x01,0x00,0x00,0xf2,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x00,0x03,0x00,
+    0xf4,0x01,0x00,0x00,0xec,0x01,0x00,0x00,0x20,0x00,0x04,0x00,0xf6,0x01,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x25,0x01,0x00,0x00,0x3b,0x00,0x04,0x00,0xf6,0x01,0x00,0x00,
+    0xf7,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x1e,0x00,0x09,0x00,0xfa,0x01,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x17,0x00,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
+    0xfb,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0xfa,0x01,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0xfb,0x01,0x00,0x00,0xfc,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0xed,0x01,0x00,0x00,0x01,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0xf1,0x01,0x00,0x00,0x03,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x14,0x02,0x00,0x00,0x0a,0xd7,0x23,0x3d,0x20,0x00,0x04,0x00,
+    0x17,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x17,0x02,0x00,0x00,0x18,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x17,0x02,0x00,0x00,0x1a,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x17,0x02,0x00,0x00,0x1c,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x18,0x00,0x04,0x00,
+    0x1e,0x02,0x00,0x00,0x17,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0xed,0x01,0x00,0x00,0x2c,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0xf1,0x01,0x00,0x00,0x2e,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,
+    0x21,0x01,0x00,0x00,0x39,0x02,0x00,0x00,0x05,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
+    0x3a,0x02,0x00,0x00,0x02,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x17,0x02,0x00,0x00,0x3d,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x2c,0x00,0x06,0x00,
+    0x17,0x00,0x00,0x00,0x4a,0x02,0x00,0x00,0x14,0x02,0x00,0x00,0x14,0x02,0x00,0x00,
+    0x14,0x02,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x5b,0x02,0x00,0x00,
+    0x3a,0xcd,0x13,0x3f,0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0x5c,0x02,0x00,0x00,
+    0x5b,0x02,0x00,0x00,0x5b,0x02,0x00,0x00,0x5b,0x02,0x00,0x00,0x20,0x00,0x04,0x00,
+    0x7a,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x7a,0x02,0x00,0x00,0x7b,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
+    0x7d,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
+    0x82,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x14,0x00,0x02,0x00,
+    0x8c,0x02,0x00,0x00,0x1e,0x00,0x05,0x00,0x94,0x02,0x00,0x00,0x30,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x1d,0x00,0x03,0x00,0x95,0x02,0x00,0x00,
+    0x94,0x02,0x00,0x00,0x1e,0x00,0x03,0x00,0x96,0x02,0x00,0x00,0x95,0x02,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x97,0x02,0x00,0x00,0x0c,0x00,0x00,0x00,0x96,0x02,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x97,0x02,0x00,0x00,0x98,0x02,0x00,0x00,0x0c,0x00,0x00,0x00,
+    0x1e,0x00,0x03,0x00,0x99,0x02,0x00,0x00,0x32,0x00,0x00,0x00,0x1d,0x00,0x03,0x00,
+    0x9a,0x02,0x00,0x00,0x99,0x02,0x00,0x00,0x1e,0x00,0x03,0x00,0x9b,0x02,0x00,0x00,
+    0x9a,0x02,0x00,0x00,0x20,0x00,0x04,0x00,0x9c,0x02,0x00,0x00,0x0c,0x00,0x00,0x00,
+    0x9b,0x02,0x00,0x00,0x3b,0x00,0x04,0x00,0x9c,0x02,0x00,0x00,0x9d,0x02,0x00,0x00,
+    0x0c,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0xa1,0x02,0x00,0x00,0x0c,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xed,0x01,0x00,0x00,0xfc,0x02,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xf1,0x01,0x00,0x00,0xfe,0x02,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x19,0x00,0x09,0x00,0x0a,0x03,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x0b,0x03,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x0a,0x03,0x00,0x00,0x3b,0x00,0x04,0x00,0x0b,0x03,0x00,0x00,
+    0x0c,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xf1,0x01,0x00,0x00,
+    0x0e,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x00,0x03,0x00,0x10,0x03,0x00,0x00,
+    0x0a,0x03,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x17,0x03,0x00,0x00,
+    0x9a,0x99,0x99,0x3e,0x3b,0x00,0x04,0x00,0x0b,0x03,0x00,0x00,0x1a,0x03,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xf1,0x01,0x00,0x00,0x1c,0x03,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x24,0x03,0x00,0x00,
+    0x00,0x00,0x80,0x40,0x3b,0x00,0x04,0x00,0xed,0x01,0x00,0x00,0x33,0x03,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xf1,0x01,0x00,0x00,0x35,0x03,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x3b,0x03,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x3b,0x03,0x00,0x00,0x3c,0x03,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xed,0x01,0x00,0x00,0x42,0x03,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xf1,0x01,0x00,0x00,0x44,0x03,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x21,0x01,0x00,0x00,0x4a,0x03,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x53,0x03,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x30,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x53,0x03,0x00,0x00,0x54,0x03,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x36,0x00,0x05,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x05,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x31,0x00,0x00,0x00,0xeb,0x01,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x31,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x08,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x0e,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x16,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x38,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x41,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x46,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x49,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x4f,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x52,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x56,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x58,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x5a,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x5d,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x5f,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x61,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x63,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x65,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x67,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x68,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x6a,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x6c,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x6e,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x70,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x72,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x74,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x76,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x31,0x00,0x00,0x00,0x79,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x7d,0x02,0x00,0x00,0x7e,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x31,0x00,0x00,0x00,0x7f,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x82,0x02,0x00,0x00,0x83,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x82,0x02,0x00,0x00,0x8e,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x39,0x00,0x00,0x00,0x93,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xaf,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xb1,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xb2,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x39,0x00,0x00,0x00,0xb3,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xb5,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xb7,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xbf,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xc1,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xc3,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xc5,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xc7,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xc9,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xcb,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xcd,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xcf,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xd1,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xd3,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xd5,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xd7,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xd9,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xdb,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xdd,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xed,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xef,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xf1,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xf3,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xf4,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xf6,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xf8,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x31,0x00,0x00,0x00,0xfb,0x02,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x05,0x03,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x4f,0x03,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x50,0x03,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x55,0x03,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0xec,0x01,0x00,0x00,0xef,0x01,0x00,0x00,0xee,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0xf0,0x01,0x00,0x00,0xf3,0x01,0x00,0x00,0xf2,0x01,0x00,0x00,
+    0x56,0x00,0x05,0x00,0xf4,0x01,0x00,0x00,0xf5,0x01,0x00,0x00,0xef,0x01,0x00,0x00,
+    0xf3,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x25,0x01,0x00,0x00,0xf8,0x01,0x00,0x00,
+    0xf7,0x01,0x00,0x00,0x57,0x00,0x05,0x00,0x30,0x00,0x00,0x00,0xf9,0x01,0x00,0x00,
+    0xf5,0x01,0x00,0x00,0xf8,0x01,0x00,0x00,0x41,0x00,0x05,0x00,0x34,0x01,0x00,0x00,
+    0xfd,0x01,0x00,0x00,0xfc,0x01,0x00,0x00,0x33,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x30,0x00,0x00,0x00,0xfe,0x01,0x00,0x00,0xfd,0x01,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x30,0x00,0x00,0x00,0xff,0x01,0x00,0x00,0xf9,0x01,0x00,0x00,0xfe,0x01,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xeb,0x01,0x00,0x00,0xff,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0xec,0x01,0x00,0x00,0x02,0x02,0x00,0x00,0x01,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0xf0,0x01,0x00,0x00,0x04,0x02,0x00,0x00,0x03,0x02,0x00,0x00,0x56,0x00,0x05,0x00,
+    0xf4,0x01,0x00,0x00,0x05,0x02,0x00,0x00,0x02,0x02,0x00,0x00,0x04,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x25,0x01,0x00,0x00,0x06,0x02,0x00,0x00,0xf7,0x01,0x00,0x00,
+    0x57,0x00,0x05,0x00,0x30,0x00,0x00,0x00,0x07,0x02,0x00,0x00,0x05,0x02,0x00,0x00,
+    0x06,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0x00,0x02,0x00,0x00,0x07,0x02,0x00,0x00,
+    0x41,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x09,0x02,0x00,0x00,0x00,0x02,0x00,0x00,
+    0x56,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x0a,0x02,0x00,0x00,
+    0x09,0x02,0x00,0x00,0x41,0x00,0x05,0x00,0x40,0x01,0x00,0x00,0x0b,0x02,0x00,0x00,
+    0xfc,0x01,0x00,0x00,0x3e,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x0c,0x02,0x00,0x00,0x0b,0x02,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x0d,0x02,0x00,0x00,0x0a,0x02,0x00,0x00,0x0c,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x08,0x02,0x00,0x00,0x0d,0x02,0x00,0x00,0x41,0x00,0x05,0x00,0x07,0x00,0x00,0x00,
+    0x0f,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x44,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x10,0x02,0x00,0x00,0x0f,0x02,0x00,0x00,0x41,0x00,0x05,0x00,
+    0x40,0x01,0x00,0x00,0x11,0x02,0x00,0x00,0xfc,0x01,0x00,0x00,0x95,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x12,0x02,0x00,0x00,0x11,0x02,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x13,0x02,0x00,0x00,0x10,0x02,0x00,0x00,
+    0x12,0x02,0x00,0x00,0x0c,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x15,0x02,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x13,0x02,0x00,0x00,0x14,0x02,0x00,0x00,
+    0x5a,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x0e,0x02,0x00,0x00,0x15,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x19,0x02,0x00,0x00,0x18,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x1b,0x02,0x00,0x00,0x1a,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x1d,0x02,0x00,0x00,0x1c,0x02,0x00,0x00,
+    0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x1f,0x02,0x00,0x00,0x19,0x02,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x20,0x02,0x00,0x00,
+    0x19,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x21,0x02,0x00,0x00,0x19,0x02,0x00,0x00,0x02,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x1b,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x23,0x02,0x00,0x00,0x1b,0x02,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x24,0x02,0x00,0x00,
+    0x1b,0x02,0x00,0x00,0x02,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x25,0x02,0x00,0x00,0x1d,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x26,0x02,0x00,0x00,0x1d,0x02,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x27,0x02,0x00,0x00,0x1d,0x02,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x50,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0x28,0x02,0x00,0x00,
+    0x1f,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x21,0x02,0x00,0x00,0x50,0x00,0x06,0x00,
+    0x17,0x00,0x00,0x00,0x29,0x02,0x00,0x00,0x22,0x02,0x00,0x00,0x23,0x02,0x00,0x00,
+    0x24,0x02,0x00,0x00,0x50,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0x2a,0x02,0x00,0x00,
+    0x25,0x02,0x00,0x00,0x26,0x02,0x00,0x00,0x27,0x02,0x00,0x00,0x50,0x00,0x06,0x00,
+    0x1e,0x02,0x00,0x00,0x2b,0x02,0x00,0x00,0x28,0x02,0x00,0x00,0x29,0x02,0x00,0x00,
+    0x2a,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0xec,0x01,0x00,0x00,0x2d,0x02,0x00,0x00,
+    0x2c,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0xf0,0x01,0x00,0x00,0x2f,0x02,0x00,0x00,
+    0x2e,0x02,0x00,0x00,0x56,0x00,0x05,0x00,0xf4,0x01,0x00,0x00,0x30,0x02,0x00,0x00,
+    0x2d,0x02,0x00,0x00,0x2f,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x25,0x01,0x00,0x00,
+    0x31,0x02,0x00,0x00,0xf7,0x01,0x00,0x00,0x57,0x00,0x05,0x00,0x30,0x00,0x00,0x00,
+    0x32,0x02,0x00,0x00,0x30,0x02,0x00,0x00,0x31,0x02,0x00,0x00,0x4f,0x00,0x08,0x00,
+    0x17,0x00,0x00,0x00,0x33,0x02,0x00,0x00,0x32,0x02,0x00,0x00,0x32,0x02,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x8e,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0x34,0x02,0x00,0x00,0x33,0x02,0x00,0x00,0xad,0x00,0x00,0x00,
+    0x83,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x35,0x02,0x00,0x00,0x34,0x02,0x00,0x00,
+    0xa0,0x00,0x00,0x00,0x91,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x36,0x02,0x00,0x00,
+    0x2b,0x02,0x00,0x00,0x35,0x02,0x00,0x00,0x0c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,
+    0x37,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x36,0x02,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x16,0x02,0x00,0x00,0x37,0x02,0x00,0x00,0x41,0x00,0x05,0x00,
+    0x3a,0x02,0x00,0x00,0x3b,0x02,0x00,0x00,0xfc,0x01,0x00,0x00,0x39,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x3c,0x02,0x00,0x00,0x3b,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x3e,0x02,0x00,0x00,0x3d,0x02,0x00,0x00,
+    0x83,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x3f,0x02,0x00,0x00,0x3c,0x02,0x00,0x00,
+    0x3e,0x02,0x00,0x00,0x0c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0x40,0x02,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x3f,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x38,0x02,0x00,0x00,0x40,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0x42,0x02,0x00,0x00,0x16,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0x43,0x02,0x00,0x00,0x38,0x02,0x00,0x00,0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x44,0x02,0x00,0x00,0x42,0x02,0x00,0x00,0x43,0x02,0x00,0x00,0x0c,0x00,0x07,0x00,
+    0x06,0x00,0x00,0x00,0x45,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,
+    0x44,0x02,0x00,0x00,0x88,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x41,0x02,0x00,0x00,
+    0x45,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x30,0x00,0x00,0x00,0x47,0x02,0x00,0x00,
+    0xeb,0x01,0x00,0x00,0x4f,0x00,0x08,0x00,0x17,0x00,0x00,0x00,0x48,0x02,0x00,0x00,
+    0x47,0x02,0x00,0x00,0x47,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x46,0x02,0x00,0x00,0x48,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x4b,0x02,0x00,0x00,0x46,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x4c,0x02,0x00,0x00,0x08,0x02,0x00,0x00,
+    0x50,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0x4d,0x02,0x00,0x00,0x4c,0x02,0x00,0x00,
+    0x4c,0x02,0x00,0x00,0x4c,0x02,0x00,0x00,0x0c,0x00,0x08,0x00,0x17,0x00,0x00,0x00,
+    0x4e,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x4a,0x02,0x00,0x00,
+    0x4b,0x02,0x00,0x00,0x4d,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0x49,0x02,0x00,0x00,
+    0x4e,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x50,0x02,0x00,0x00,
+    0x08,0x02,0x00,0x00,0x83,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x51,0x02,0x00,0x00,
+    0x5a,0x00,0x00,0x00,0x50,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0x4f,0x02,0x00,0x00,
+    0x51,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x53,0x02,0x00,0x00,
+    0x46,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x54,0x02,0x00,0x00,
+    0x4f,0x02,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x55,0x02,0x00,0x00,
+    0x53,0x02,0x00,0x00,0x54,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0x52,0x02,0x00,0x00,
+    0x55,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x57,0x02,0x00,0x00,
+    0x16,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0x56,0x02,0x00,0x00,0x57,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x59,0x02,0x00,0x00,0x38,0x02,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x58,0x02,0x00,0x00,0x59,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x5a,0x02,0x00,0x00,0x5c,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0x5e,0x02,0x00,0x00,0x49,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0x5d,0x02,0x00,0x00,
+    0x5e,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x60,0x02,0x00,0x00,
+    0x52,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0x5f,0x02,0x00,0x00,0x60,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x62,0x02,0x00,0x00,0x08,0x02,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x61,0x02,0x00,0x00,0x62,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x64,0x02,0x00,0x00,0x0e,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x63,0x02,0x00,0x00,0x64,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x66,0x02,0x00,0x00,0x41,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0x65,0x02,0x00,0x00,
+    0x66,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x69,0x02,0x00,0x00,
+    0x56,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0x68,0x02,0x00,0x00,0x69,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x6b,0x02,0x00,0x00,0x58,0x02,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x6a,0x02,0x00,0x00,0x6b,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0x6d,0x02,0x00,0x00,0x5a,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x6c,0x02,0x00,0x00,0x6d,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0x6f,0x02,0x00,0x00,0x5d,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0x6e,0x02,0x00,0x00,
+    0x6f,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x71,0x02,0x00,0x00,
+    0x5f,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0x70,0x02,0x00,0x00,0x71,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x73,0x02,0x00,0x00,0x61,0x02,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x72,0x02,0x00,0x00,0x73,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x75,0x02,0x00,0x00,0x63,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x74,0x02,0x00,0x00,0x75,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x77,0x02,0x00,0x00,0x65,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0x76,0x02,0x00,0x00,
+    0x77,0x02,0x00,0x00,0x39,0x00,0x0c,0x00,0x17,0x00,0x00,0x00,0x78,0x02,0x00,0x00,
+    0x2e,0x00,0x00,0x00,0x68,0x02,0x00,0x00,0x6a,0x02,0x00,0x00,0x6c,0x02,0x00,0x00,
+    0x6e,0x02,0x00,0x00,0x70,0x02,0x00,0x00,0x72,0x02,0x00,0x00,0x74,0x02,0x00,0x00,
+    0x76,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0x67,0x02,0x00,0x00,0x78,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x30,0x00,0x00,0x00,0x7c,0x02,0x00,0x00,0x7b,0x02,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x79,0x02,0x00,0x00,0x7c,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x30,0x00,0x00,0x00,0x80,0x02,0x00,0x00,0x79,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x7f,0x02,0x00,0x00,0x80,0x02,0x00,0x00,0x39,0x00,0x05,0x00,0x33,0x00,0x00,0x00,
+    0x81,0x02,0x00,0x00,0x36,0x00,0x00,0x00,0x7f,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x7e,0x02,0x00,0x00,0x81,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0x83,0x02,0x00,0x00,
+    0x3f,0x01,0x00,0x00,0xf9,0x00,0x02,0x00,0x84,0x02,0x00,0x00,0xf8,0x00,0x02,0x00,
+    0x84,0x02,0x00,0x00,0xf6,0x00,0x04,0x00,0x86,0x02,0x00,0x00,0x87,0x02,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xf9,0x00,0x02,0x00,0x88,0x02,0x00,0x00,0xf8,0x00,0x02,0x00,
+    0x88,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x32,0x00,0x00,0x00,0x89,0x02,0x00,0x00,
+    0x83,0x02,0x00,0x00,0x41,0x00,0x05,0x00,0x82,0x02,0x00,0x00,0x8a,0x02,0x00,0x00,
+    0x7e,0x02,0x00,0x00,0x44,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x32,0x00,0x00,0x00,
+    0x8b,0x02,0x00,0x00,0x8a,0x02,0x00,0x00,0xb0,0x00,0x05,0x00,0x8c,0x02,0x00,0x00,
+    0x8d,0x02,0x00,0x00,0x89,0x02,0x00,0x00,0x8b,0x02,0x00,0x00,0xfa,0x00,0x04,0x00,
+    0x8d,0x02,0x00,0x00,0x85,0x02,0x00,0x00,0x86,0x02,0x00,0x00,0xf8,0x00,0x02,0x00,
+    0x85,0x02,0x00,0x00,0x41,0x00,0x05,0x00,0x82,0x02,0x00,0x00,0x8f,0x02,0x00,0x00,
+    0x7e,0x02,0x00,0x00,0x3f,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x32,0x00,0x00,0x00,
+    0x90,0x02,0x00,0x00,0x8f,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x32,0x00,0x00,0x00,
+    0x91,0x02,0x00,0x00,0x83,0x02,0x00,0x00,0x80,0x00,0x05,0x00,0x32,0x00,0x00,0x00,
+    0x92,0x02,0x00,0x00,0x90,0x02,0x00,0x00,0x91,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x8e,0x02,0x00,0x00,0x92,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x32,0x00,0x00,0x00,
+    0x9e,0x02,0x00,0x00,0x8e,0x02,0x00,0x00,0x41,0x00,0x07,0x00,0x6d,0x01,0x00,0x00,
+    0x9f,0x02,0x00,0x00,0x9d,0x02,0x00,0x00,0x33,0x01,0x00,0x00,0x9e,0x02,0x00,0x00,
+    0x33,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x32,0x00,0x00,0x00,0xa0,0x02,0x00,0x00,
+    0x9f,0x02,0x00,0x00,0x41,0x00,0x07,0x00,0xa1,0x02,0x00,0x00,0xa2,0x02,0x00,0x00,
+    0x98,0x02,0x00,0x00,0x33,0x01,0x00,0x00,0xa0,0x02,0x00,0x00,0x33,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x30,0x00,0x00,0x00,0xa3,0x02,0x00,0x00,0xa2,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x32,0x00,0x00,0x00,0xa4,0x02,0x00,0x00,0x8e,0x02,0x00,0x00,
+    0x41,0x00,0x07,0x00,0x6d,0x01,0x00,0x00,0xa5,0x02,0x00,0x00,0x9d,0x02,0x00,0x00,
+    0x33,0x01,0x00,0x00,0xa4,0x02,0x00,0x00,0x33,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x32,0x00,0x00,0x00,0xa6,0x02,0x00,0x00,0xa5,0x02,0x00,0x00,0x41,0x00,0x07,0x00,
+    0xa1,0x02,0x00,0x00,0xa7,0x02,0x00,0x00,0x98,0x02,0x00,0x00,0x33,0x01,0x00,0x00,
+    0xa6,0x02,0x00,0x00,0x3e,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x30,0x00,0x00,0x00,
+    0xa8,0x02,0x00,0x00,0xa7,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x32,0x00,0x00,0x00,
+    0xa9,0x02,0x00,0x00,0x8e,0x02,0x00,0x00,0x41,0x00,0x07,0x00,0x6d,0x01,0x00,0x00,
+    0xaa,0x02,0x00,0x00,0x9d,0x02,0x00,0x00,0x33,0x01,0x00,0x00,0xa9,0x02,0x00,0x00,
+    0x33,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x32,0x00,0x00,0x00,0xab,0x02,0x00,0x00,
+    0xaa,0x02,0x00,0x00,0x41,0x00,0x07,0x00,0xa1,0x02,0x00,0x00,0xac,0x02,0x00,0x00,
+    0x98,0x02,0x00,0x00,0x33,0x01,0x00,0x00,0xab,0x02,0x00,0x00,0x95,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x30,0x00,0x00,0x00,0xad,0x02,0x00,0x00,0xac,0x02,0x00,0x00,
+    0x50,0x00,0x06,0x00,0x38,0x00,0x00,0x00,0xae,0x02,0x00,0x00,0xa3,0x02,0x00,0x00,
+    0xa8,0x02,0x00,0x00,0xad,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0x93,0x02,0x00,0x00,
+    0xae,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xb0,0x02,0x00,0x00,
+    0x3d,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0xaf,0x02,0x00,0x00,0xb0,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x38,0x00,0x00,0x00,0xb4,0x02,0x00,0x00,0x93,0x02,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xb3,0x02,0x00,0x00,0xb4,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0xb6,0x02,0x00,0x00,0xaf,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xb5,0x02,0x00,0x00,0xb6,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0xb8,0x02,0x00,0x00,0xb2,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0xb7,0x02,0x00,0x00,
+    0xb8,0x02,0x00,0x00,0x39,0x00,0x07,0x00,0x06,0x00,0x00,0x00,0xb9,0x02,0x00,0x00,
+    0x3e,0x00,0x00,0x00,0xb3,0x02,0x00,0x00,0xb5,0x02,0x00,0x00,0xb7,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xba,0x02,0x00,0x00,0xb7,0x02,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xb2,0x02,0x00,0x00,0xba,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xb1,0x02,0x00,0x00,0xb9,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xbb,0x02,0x00,0x00,0xb1,0x02,0x00,0x00,0xba,0x00,0x05,0x00,0x8c,0x02,0x00,0x00,
+    0xbc,0x02,0x00,0x00,0xbb,0x02,0x00,0x00,0x90,0x00,0x00,0x00,0xf7,0x00,0x03,0x00,
+    0xbe,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xfa,0x00,0x04,0x00,0xbc,0x02,0x00,0x00,
+    0xbd,0x02,0x00,0x00,0xbe,0x02,0x00,0x00,0xf8,0x00,0x02,0x00,0xbd,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xc0,0x02,0x00,0x00,0x16,0x02,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xbf,0x02,0x00,0x00,0xc0,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0xc2,0x02,0x00,0x00,0x38,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xc1,0x02,0x00,0x00,0xc2,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0xc4,0x02,0x00,0x00,0xb2,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0xc3,0x02,0x00,0x00,
+    0xc4,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xc6,0x02,0x00,0x00,
+    0x49,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0xc5,0x02,0x00,0x00,0xc6,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xc8,0x02,0x00,0x00,0x52,0x02,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xc7,0x02,0x00,0x00,0xc8,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xca,0x02,0x00,0x00,0x08,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xc9,0x02,0x00,0x00,0xca,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xcc,0x02,0x00,0x00,0x0e,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0xcb,0x02,0x00,0x00,
+    0xcc,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xce,0x02,0x00,0x00,
+    0x41,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0xcd,0x02,0x00,0x00,0xce,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xd0,0x02,0x00,0x00,0xbf,0x02,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xcf,0x02,0x00,0x00,0xd0,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0xd2,0x02,0x00,0x00,0xc1,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xd1,0x02,0x00,0x00,0xd2,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0xd4,0x02,0x00,0x00,0xc3,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0xd3,0x02,0x00,0x00,
+    0xd4,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xd6,0x02,0x00,0x00,
+    0xc5,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0xd5,0x02,0x00,0x00,0xd6,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xd8,0x02,0x00,0x00,0xc7,0x02,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xd7,0x02,0x00,0x00,0xd8,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xda,0x02,0x00,0x00,0xc9,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xd9,0x02,0x00,0x00,0xda,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xdc,0x02,0x00,0x00,0xcb,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0xdb,0x02,0x00,0x00,
+    0xdc,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xde,0x02,0x00,0x00,
+    0xcd,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0xdd,0x02,0x00,0x00,0xde,0x02,0x00,0x00,
+    0x39,0x00,0x0c,0x00,0x17,0x00,0x00,0x00,0xdf,0x02,0x00,0x00,0x2e,0x00,0x00,0x00,
+    0xcf,0x02,0x00,0x00,0xd1,0x02,0x00,0x00,0xd3,0x02,0x00,0x00,0xd5,0x02,0x00,0x00,
+    0xd7,0x02,0x00,0x00,0xd9,0x02,0x00,0x00,0xdb,0x02,0x00,0x00,0xdd,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x32,0x00,0x00,0x00,0xe0,0x02,0x00,0x00,0x8e,0x02,0x00,0x00,
+    0x41,0x00,0x07,0x00,0x6d,0x01,0x00,0x00,0xe1,0x02,0x00,0x00,0x9d,0x02,0x00,0x00,
+    0x33,0x01,0x00,0x00,0xe0,0x02,0x00,0x00,0x33,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x32,0x00,0x00,0x00,0xe2,0x02,0x00,0x00,0xe1,0x02,0x00,0x00,0x41,0x00,0x07,0x00,
+    0xa1,0x02,0x00,0x00,0xe3,0x02,0x00,0x00,0x98,0x02,0x00,0x00,0x33,0x01,0x00,0x00,
+    0xe2,0x02,0x00,0x00,0x3e,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x30,0x00,0x00,0x00,
+    0xe4,0x02,0x00,0x00,0xe3,0x02,0x00,0x00,0x4f,0x00,0x08,0x00,0x17,0x00,0x00,0x00,
+    0xe5,0x02,0x00,0x00,0xe4,0x02,0x00,0x00,0xe4,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0xe6,0x02,0x00,0x00,0xdf,0x02,0x00,0x00,0xe5,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xe7,0x02,0x00,0x00,0xb1,0x02,0x00,0x00,0x8e,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0xe8,0x02,0x00,0x00,0xe6,0x02,0x00,0x00,0xe7,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xe9,0x02,0x00,0x00,0x67,0x02,0x00,0x00,
+    0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xea,0x02,0x00,0x00,0xe9,0x02,0x00,0x00,
+    0xe8,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0x67,0x02,0x00,0x00,0xea,0x02,0x00,0x00,
+    0xf9,0x00,0x02,0x00,0xbe,0x02,0x00,0x00,0xf8,0x00,0x02,0x00,0xbe,0x02,0x00,0x00,
+    0xf9,0x00,0x02,0x00,0x87,0x02,0x00,0x00,0xf8,0x00,0x02,0x00,0x87,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x32,0x00,0x00,0x00,0xeb,0x02,0x00,0x00,0x83,0x02,0x00,0x00,
+    0x80,0x00,0x05,0x00,0x32,0x00,0x00,0x00,0xec,0x02,0x00,0x00,0xeb,0x02,0x00,0x00,
+    0x3e,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x83,0x02,0x00,0x00,0xec,0x02,0x00,0x00,
+    0xf9,0x00,0x02,0x00,0x84,0x02,0x00,0x00,0xf8,0x00,0x02,0x00,0x86,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xee,0x02,0x00,0x00,0x41,0x02,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xed,0x02,0x00,0x00,0xee,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0xf0,0x02,0x00,0x00,0x49,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xef,0x02,0x00,0x00,0xf0,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xf2,0x02,0x00,0x00,0x0e,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0xf1,0x02,0x00,0x00,
+    0xf2,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xf5,0x02,0x00,0x00,
+    0xed,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0xf4,0x02,0x00,0x00,0xf5,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xf7,0x02,0x00,0x00,0xef,0x02,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xf6,0x02,0x00,0x00,0xf7,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xf9,0x02,0x00,0x00,0xf1,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xf8,0x02,0x00,0x00,0xf9,0x02,0x00,0x00,0x39,0x00,0x07,0x00,0x17,0x00,0x00,0x00,
+    0xfa,0x02,0x00,0x00,0x44,0x00,0x00,0x00,0xf4,0x02,0x00,0x00,0xf6,0x02,0x00,0x00,
+    0xf8,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0xf3,0x02,0x00,0x00,0xfa,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0xec,0x01,0x00,0x00,0xfd,0x02,0x00,0x00,0xfc,0x02,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0xf0,0x01,0x00,0x00,0xff,0x02,0x00,0x00,0xfe,0x02,0x00,0x00,
+    0x56,0x00,0x05,0x00,0xf4,0x01,0x00,0x00,0x00,0x03,0x00,0x00,0xfd,0x02,0x00,0x00,
+    0xff,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x01,0x03,0x00,0x00,
+    0x41,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x02,0x03,0x00,0x00,
+    0x0e,0x02,0x00,0x00,0x50,0x00,0x05,0x00,0x25,0x01,0x00,0x00,0x03,0x03,0x00,0x00,
+    0x01,0x03,0x00,0x00,0x02,0x03,0x00,0x00,0x57,0x00,0x05,0x00,0x30,0x00,0x00,0x00,
+    0x04,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x03,0x03,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xfb,0x02,0x00,0x00,0x04,0x03,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0x06,0x03,0x00,0x00,0xf3,0x02,0x00,0x00,0x83,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x07,0x03,0x00,0x00,0xa0,0x00,0x00,0x00,0x06,0x03,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x08,0x03,0x00,0x00,0x4f,0x02,0x00,0x00,0x8e,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0x09,0x03,0x00,0x00,0x07,0x03,0x00,0x00,0x08,0x03,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x0a,0x03,0x00,0x00,0x0d,0x03,0x00,0x00,0x0c,0x03,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0xf0,0x01,0x00,0x00,0x0f,0x03,0x00,0x00,0x0e,0x03,0x00,0x00,
+    0x56,0x00,0x05,0x00,0x10,0x03,0x00,0x00,0x11,0x03,0x00,0x00,0x0d,0x03,0x00,0x00,
+    0x0f,0x03,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x12,0x03,0x00,0x00,
+    0x16,0x02,0x00,0x00,0x57,0x00,0x05,0x00,0x30,0x00,0x00,0x00,0x13,0x03,0x00,0x00,
+    0x11,0x03,0x00,0x00,0x12,0x03,0x00,0x00,0x4f,0x00,0x08,0x00,0x17,0x00,0x00,0x00,
+    0x14,0x03,0x00,0x00,0x13,0x03,0x00,0x00,0x13,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0x15,0x03,0x00,0x00,0x52,0x02,0x00,0x00,0x85,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x16,0x03,0x00,0x00,0x14,0x03,0x00,0x00,0x15,0x03,0x00,0x00,0x8e,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0x18,0x03,0x00,0x00,0x16,0x03,0x00,0x00,0x17,0x03,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x19,0x03,0x00,0x00,0x09,0x03,0x00,0x00,
+    0x18,0x03,0x00,0x00,0x3d,0x00,0x04,0x00,0x0a,0x03,0x00,0x00,0x1b,0x03,0x00,0x00,
+    0x1a,0x03,0x00,0x00,0x3d,0x00,0x04,0x00,0xf0,0x01,0x00,0x00,0x1d,0x03,0x00,0x00,
+    0x1c,0x03,0x00,0x00,0x56,0x00,0x05,0x00,0x10,0x03,0x00,0x00,0x1e,0x03,0x00,0x00,
+    0x1b,0x03,0x00,0x00,0x1d,0x03,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0x1f,0x03,0x00,0x00,0x38,0x02,0x00,0x00,0x7f,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0x20,0x03,0x00,0x00,0x1f,0x03,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0x21,0x03,0x00,0x00,0x16,0x02,0x00,0x00,0x0c,0x00,0x07,0x00,0x17,0x00,0x00,0x00,
+    0x22,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0x20,0x03,0x00,0x00,
+    0x21,0x03,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x23,0x03,0x00,0x00,
+    0x0e,0x02,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x25,0x03,0x00,0x00,
+    0x23,0x03,0x00,0x00,0x24,0x03,0x00,0x00,0x58,0x00,0x07,0x00,0x30,0x00,0x00,0x00,
+    0x26,0x03,0x00,0x00,0x1e,0x03,0x00,0x00,0x22,0x03,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x25,0x03,0x00,0x00,0x4f,0x00,0x08,0x00,0x17,0x00,0x00,0x00,0x27,0x03,0x00,0x00,
+    0x26,0x03,0x00,0x00,0x26,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x28,0x03,0x00,0x00,
+    0xf3,0x02,0x00,0x00,0x41,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x29,0x03,0x00,0x00,
+    0xfb,0x02,0x00,0x00,0x3f,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x2a,0x03,0x00,0x00,0x29,0x03,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x2b,0x03,0x00,0x00,0x28,0x03,0x00,0x00,0x2a,0x03,0x00,0x00,0x41,0x00,0x05,0x00,
+    0x07,0x00,0x00,0x00,0x2c,0x03,0x00,0x00,0xfb,0x02,0x00,0x00,0x44,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x2d,0x03,0x00,0x00,0x2c,0x03,0x00,0x00,
+    0x50,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0x2e,0x03,0x00,0x00,0x2d,0x03,0x00,0x00,
+    0x2d,0x03,0x00,0x00,0x2d,0x03,0x00,0x00,0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x2f,0x03,0x00,0x00,0x2b,0x03,0x00,0x00,0x2e,0x03,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0x30,0x03,0x00,0x00,0x27,0x03,0x00,0x00,0x2f,0x03,0x00,0x00,
+    0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x31,0x03,0x00,0x00,0x30,0x03,0x00,0x00,
+    0x72,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x32,0x03,0x00,0x00,
+    0x19,0x03,0x00,0x00,0x31,0x03,0x00,0x00,0x3d,0x00,0x04,0x00,0xec,0x01,0x00,0x00,
+    0x34,0x03,0x00,0x00,0x33,0x03,0x00,0x00,0x3d,0x00,0x04,0x00,0xf0,0x01,0x00,0x00,
+    0x36,0x03,0x00,0x00,0x35,0x03,0x00,0x00,0x56,0x00,0x05,0x00,0xf4,0x01,0x00,0x00,
+    0x37,0x03,0x00,0x00,0x34,0x03,0x00,0x00,0x36,0x03,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x25,0x01,0x00,0x00,0x38,0x03,0x00,0x00,0xf7,0x01,0x00,0x00,0x57,0x00,0x05,0x00,
+    0x30,0x00,0x00,0x00,0x39,0x03,0x00,0x00,0x37,0x03,0x00,0x00,0x38,0x03,0x00,0x00,
+    0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x3a,0x03,0x00,0x00,0x39,0x03,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x3d,0x03,0x00,0x00,
+    0x3c,0x03,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x3e,0x03,0x00,0x00,
+    0x3a,0x03,0x00,0x00,0x3d,0x03,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x3f,0x03,0x00,0x00,0x32,0x03,0x00,0x00,0x3e,0x03,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0x40,0x03,0x00,0x00,0x67,0x02,0x00,0x00,0x81,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0x41,0x03,0x00,0x00,0x3f,0x03,0x00,0x00,0x40,0x03,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0xec,0x01,0x00,0x00,0x43,0x03,0x00,0x00,0x42,0x03,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0xf0,0x01,0x00,0x00,0x45,0x03,0x00,0x00,0x44,0x03,0x00,0x00,
+    0x56,0x00,0x05,0x00,0xf4,0x01,0x00,0x00,0x46,0x03,0x00,0x00,0x43,0x03,0x00,0x00,
+    0x45,0x03,0x00,0x00,0x3d,0x00,0x04,0x00,0x25,0x01,0x00,0x00,0x47,0x03,0x00,0x00,
+    0xf7,0x01,0x00,0x00,0x57,0x00,0x05,0x00,0x30,0x00,0x00,0x00,0x48,0x03,0x00,0x00,
+    0x46,0x03,0x00,0x00,0x47,0x03,0x00,0x00,0x4f,0x00,0x08,0x00,0x17,0x00,0x00,0x00,
+    0x49,0x03,0x00,0x00,0x48,0x03,0x00,0x00,0x48,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x3a,0x02,0x00,0x00,
+    0x4b,0x03,0x00,0x00,0xfc,0x01,0x00,0x00,0x4a,0x03,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0x4c,0x03,0x00,0x00,0x4b,0x03,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0x4d,0x03,0x00,0x00,0x49,0x03,0x00,0x00,0x4c,0x03,0x00,0x00,
+    0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x4e,0x03,0x00,0x00,0x41,0x03,0x00,0x00,
+    0x4d,0x03,0x00,0x00,0x3e,0x00,0x03,0x00,0x05,0x03,0x00,0x00,0x4e,0x03,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x51,0x03,0x00,0x00,0x05,0x03,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x50,0x03,0x00,0x00,0x51,0x03,0x00,0x00,0x39,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0x52,0x03,0x00,0x00,0x48,0x00,0x00,0x00,0x50,0x03,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x4f,0x03,0x00,0x00,0x52,0x03,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0x56,0x03,0x00,0x00,0x4f,0x03,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x55,0x03,0x00,0x00,0x56,0x03,0x00,0x00,0x39,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x57,0x03,0x00,0x00,0x4b,0x00,0x00,0x00,0x55,0x03,0x00,0x00,0x41,0x00,0x05,0x00,
+    0x07,0x00,0x00,0x00,0x58,0x03,0x00,0x00,0xeb,0x01,0x00,0x00,0x28,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x59,0x03,0x00,0x00,0x58,0x03,0x00,0x00,
+    0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x5a,0x03,0x00,0x00,0x57,0x03,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x5b,0x03,0x00,0x00,
+    0x57,0x03,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x5c,0x03,0x00,0x00,0x57,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x50,0x00,0x07,0x00,
+    0x30,0x00,0x00,0x00,0x5d,0x03,0x00,0x00,0x5a,0x03,0x00,0x00,0x5b,0x03,0x00,0x00,
+    0x5c,0x03,0x00,0x00,0x59,0x03,0x00,0x00,0x3e,0x00,0x03,0x00,0x54,0x03,0x00,0x00,
+    0x5d,0x03,0x00,0x00,0xfd,0x00,0x01,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,
+    0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
+    0x07,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x0c,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x4d,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x51,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x55,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x4e,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x4e,0x00,0x00,0x00,
+    0x4f,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x4d,0x00,0x00,0x00,0x50,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x52,0x00,0x00,0x00,0x4d,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x53,0x00,0x00,0x00,0x4d,0x00,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x54,0x00,0x00,0x00,0x52,0x00,0x00,0x00,
+    0x53,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x51,0x00,0x00,0x00,0x54,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x56,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x57,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x56,0x00,0x00,0x00,
+    0x57,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x59,0x00,0x00,0x00,
+    0x51,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,
+    0x59,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x5c,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x81,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x55,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x5e,0x00,0x00,0x00,0x51,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x55,0x00,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x60,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x62,0x00,0x00,0x00,0x55,0x00,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x61,0x00,0x00,0x00,
+    0x62,0x00,0x00,0x00,0x88,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x64,0x00,0x00,0x00,
+    0x5e,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0xfe,0x00,0x02,0x00,0x64,0x00,0x00,0x00,
+    0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x11,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,
+    0x0e,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,
+    0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,
+    0x12,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x67,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x6b,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x6f,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x68,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x69,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x6a,0x00,0x00,0x00,
+    0x68,0x00,0x00,0x00,0x69,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x67,0x00,0x00,0x00,
+    0x6a,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x6c,0x00,0x00,0x00,
+    0x67,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x6d,0x00,0x00,0x00,
+    0x67,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x6e,0x00,0x00,0x00,
+    0x6c,0x00,0x00,0x00,0x6d,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x6b,0x00,0x00,0x00,
+    0x6e,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x70,0x00,0x00,0x00,
+    0x6b,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x71,0x00,0x00,0x00,
+    0x5a,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x6f,0x00,0x00,0x00,
+    0x71,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x73,0x00,0x00,0x00,
+    0x0f,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x74,0x00,0x00,0x00,
+    0x0e,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x75,0x00,0x00,0x00,
+    0x0e,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x76,0x00,0x00,0x00,
+    0x74,0x00,0x00,0x00,0x75,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x77,0x00,0x00,0x00,0x6f,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x78,0x00,0x00,0x00,0x76,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x79,0x00,0x00,0x00,0x6b,0x00,0x00,0x00,0x81,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x7a,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x79,0x00,0x00,0x00,
+    0x0c,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x7b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x1f,0x00,0x00,0x00,0x7a,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x7c,0x00,0x00,0x00,0x73,0x00,0x00,0x00,0x7b,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x7d,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x81,0x00,0x00,0x00,0x6f,0x00,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x82,0x00,0x00,0x00,0x80,0x00,0x00,0x00,
+    0x81,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x83,0x00,0x00,0x00,
+    0x6b,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x84,0x00,0x00,0x00,
+    0x82,0x00,0x00,0x00,0x83,0x00,0x00,0x00,0x0c,0x00,0x06,0x00,0x06,0x00,0x00,0x00,
+    0x85,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x84,0x00,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x86,0x00,0x00,0x00,0x7d,0x00,0x00,0x00,
+    0x85,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x87,0x00,0x00,0x00,
+    0x7c,0x00,0x00,0x00,0x86,0x00,0x00,0x00,0x0c,0x00,0x07,0x00,0x06,0x00,0x00,0x00,
+    0x89,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x87,0x00,0x00,0x00,
+    0x88,0x00,0x00,0x00,0x88,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x8a,0x00,0x00,0x00,
+    0x72,0x00,0x00,0x00,0x89,0x00,0x00,0x00,0xfe,0x00,0x02,0x00,0x8a,0x00,0x00,0x00,
+    0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,
+    0x14,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x16,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x8d,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x92,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x8e,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x8f,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0x8e,0x00,0x00,0x00,
+    0x0c,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x91,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x2b,0x00,0x00,0x00,0x8f,0x00,0x00,0x00,0x90,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x8d,0x00,0x00,0x00,0x91,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x93,0x00,0x00,0x00,0x8d,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x94,0x00,0x00,0x00,0x8d,0x00,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x95,0x00,0x00,0x00,0x93,0x00,0x00,0x00,0x94,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x92,0x00,0x00,0x00,0x95,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x96,0x00,0x00,0x00,0x92,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x97,0x00,0x00,0x00,0x92,0x00,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x98,0x00,0x00,0x00,0x96,0x00,0x00,0x00,0x97,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x99,0x00,0x00,0x00,0x8d,0x00,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x9a,0x00,0x00,0x00,0x98,0x00,0x00,0x00,
+    0x99,0x00,0x00,0x00,0xfe,0x00,0x02,0x00,0x9a,0x00,0x00,0x00,0x38,0x00,0x01,0x00,
+    0x36,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x19,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,
+    0x37,0x00,0x03,0x00,0x18,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,
+    0x1d,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x9d,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xa3,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x9e,0x00,0x00,0x00,
+    0x1a,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x9d,0x00,0x00,0x00,0x9e,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x9f,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xa1,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,
+    0x83,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xa2,0x00,0x00,0x00,0xa0,0x00,0x00,0x00,
+    0xa1,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xa4,0x00,0x00,0x00,
+    0x9d,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xa3,0x00,0x00,0x00,0xa4,0x00,0x00,0x00,
+    0x39,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xa5,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+    0xa3,0x00,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xa6,0x00,0x00,0x00,
+    0xa2,0x00,0x00,0x00,0xa5,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0xa7,0x00,0x00,0x00,0x9f,0x00,0x00,0x00,0xa6,0x00,0x00,0x00,0xfe,0x00,0x02,0x00,
+    0xa7,0x00,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
+    0x07,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,
+    0x20,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
+    0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,
+    0x24,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xaa,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xb6,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xb8,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xbb,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xc1,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xab,0x00,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x0c,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0xac,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x90,0x00,0x00,0x00,0x72,0x00,0x00,0x00,
+    0xab,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xae,0x00,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xaf,0x00,0x00,0x00,
+    0xad,0x00,0x00,0x00,0xae,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xb0,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0xb1,0x00,0x00,0x00,0xaf,0x00,0x00,0x00,0xb0,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xb2,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0xb3,0x00,0x00,0x00,0xb1,0x00,0x00,0x00,0xb2,0x00,0x00,0x00,
+    0x81,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xb4,0x00,0x00,0x00,0xac,0x00,0x00,0x00,
+    0xb3,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xb5,0x00,0x00,0x00,
+    0xb4,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xaa,0x00,0x00,0x00,
+    0xb5,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xb7,0x00,0x00,0x00,
+    0x1f,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xb6,0x00,0x00,0x00,0xb7,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xb9,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xb8,0x00,0x00,0x00,0xb9,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xba,0x00,0x00,0x00,0xaa,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xbc,0x00,0x00,0x00,0xb6,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xbb,0x00,0x00,0x00,0xbc,0x00,0x00,0x00,0x39,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0xbd,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0xbb,0x00,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0xbe,0x00,0x00,0x00,0xba,0x00,0x00,0x00,0xbd,0x00,0x00,0x00,
+    0x81,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xbf,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,
+    0xbe,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,
+    0xaa,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xc2,0x00,0x00,0x00,
+    0xb8,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xc1,0x00,0x00,0x00,0xc2,0x00,0x00,0x00,
+    0x39,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xc3,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+    0xc1,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xc4,0x00,0x00,0x00,
+    0xc0,0x00,0x00,0x00,0xc3,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0xc5,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0xc4,0x00,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0xc6,0x00,0x00,0x00,0xbf,0x00,0x00,0x00,0xc5,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xc8,0x00,0x00,0x00,0x22,0x00,0x00,0x00,
+    0x0c,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0xc9,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x2e,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0xc7,0x00,0x00,0x00,0xc8,0x00,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xca,0x00,0x00,0x00,0xc6,0x00,0x00,0x00,
+    0xc9,0x00,0x00,0x00,0xfe,0x00,0x02,0x00,0xca,0x00,0x00,0x00,0x38,0x00,0x01,0x00,
+    0x36,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x25,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x18,0x00,0x00,0x00,0x26,0x00,0x00,0x00,
+    0x37,0x00,0x03,0x00,0x18,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
+    0x18,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x18,0x00,0x00,0x00,
+    0x29,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x18,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,
+    0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
+    0x07,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,
+    0x2d,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x2f,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x18,0x00,0x00,0x00,0xcd,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0xd2,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0xd7,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0xdc,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0xde,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0xe2,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0xe4,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x18,0x00,0x00,0x00,0xe9,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x18,0x00,0x00,0x00,0xeb,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0xec,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x18,0x00,0x00,0x00,0xee,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0xf1,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0xf3,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0xf5,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0xfa,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x04,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x06,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x0e,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x10,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x13,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x17,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0xce,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0xcf,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x81,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0xd0,0x00,0x00,0x00,0xce,0x00,0x00,0x00,0xcf,0x00,0x00,0x00,
+    0x0c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0xd1,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x45,0x00,0x00,0x00,0xd0,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xcd,0x00,0x00,0x00,
+    0xd1,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xd3,0x00,0x00,0x00,
+    0x26,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xd4,0x00,0x00,0x00,
+    0x28,0x00,0x00,0x00,0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xd5,0x00,0x00,0x00,
+    0xd3,0x00,0x00,0x00,0xd4,0x00,0x00,0x00,0x0c,0x00,0x07,0x00,0x06,0x00,0x00,0x00,
+    0xd6,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0xd5,0x00,0x00,0x00,
+    0x88,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xd2,0x00,0x00,0x00,0xd6,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xd8,0x00,0x00,0x00,0x26,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xd9,0x00,0x00,0x00,0xcd,0x00,0x00,0x00,
+    0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xda,0x00,0x00,0x00,0xd8,0x00,0x00,0x00,
+    0xd9,0x00,0x00,0x00,0x0c,0x00,0x07,0x00,0x06,0x00,0x00,0x00,0xdb,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0xda,0x00,0x00,0x00,0x90,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xd7,0x00,0x00,0x00,0xdb,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xdd,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xdc,0x00,0x00,0x00,0xdd,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xdf,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xde,0x00,0x00,0x00,
+    0xdf,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xe1,0x00,0x00,0x00,
+    0xd2,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xe0,0x00,0x00,0x00,0xe1,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xe3,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xe2,0x00,0x00,0x00,0xe3,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0xe5,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0xe6,0x00,0x00,0x00,0xcd,0x00,0x00,0x00,0x94,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0xe5,0x00,0x00,0x00,0xe6,0x00,0x00,0x00,
+    0x0c,0x00,0x07,0x00,0x06,0x00,0x00,0x00,0xe8,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x28,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x90,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xe4,0x00,0x00,0x00,0xe8,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0xea,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xe9,0x00,0x00,0x00,
+    0xea,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xed,0x00,0x00,0x00,
+    0xe4,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xec,0x00,0x00,0x00,0xed,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xef,0x00,0x00,0x00,0xe9,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xee,0x00,0x00,0x00,0xef,0x00,0x00,0x00,0x39,0x00,0x06,0x00,
+    0x17,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0xec,0x00,0x00,0x00,
+    0xee,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xeb,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xf2,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xf1,0x00,0x00,0x00,0xf2,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xf4,0x00,0x00,0x00,0xd2,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0xf3,0x00,0x00,0x00,0xf4,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0xf6,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0xf7,0x00,0x00,0x00,0xcd,0x00,0x00,0x00,0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0xf8,0x00,0x00,0x00,0xf6,0x00,0x00,0x00,0xf7,0x00,0x00,0x00,0x0c,0x00,0x07,0x00,
+    0x06,0x00,0x00,0x00,0xf9,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,
+    0xf8,0x00,0x00,0x00,0x90,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xf5,0x00,0x00,0x00,
+    0xf9,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xfb,0x00,0x00,0x00,
+    0x2c,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xfa,0x00,0x00,0x00,0xfb,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0xeb,0x00,0x00,0x00,
+    0x83,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xfd,0x00,0x00,0x00,0xa0,0x00,0x00,0x00,
+    0xfc,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xfe,0x00,0x00,0x00,
+    0x2b,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xff,0x00,0x00,0x00,
+    0x5a,0x00,0x00,0x00,0xfe,0x00,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x00,0x01,0x00,0x00,0xfd,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x2a,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x03,0x01,0x00,0x00,0xf1,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x02,0x01,0x00,0x00,0x03,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x05,0x01,0x00,0x00,0xf3,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x04,0x01,0x00,0x00,
+    0x05,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x07,0x01,0x00,0x00,
+    0xf5,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x06,0x01,0x00,0x00,0x07,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x09,0x01,0x00,0x00,0xfa,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x08,0x01,0x00,0x00,0x09,0x01,0x00,0x00,0x39,0x00,0x08,0x00,
+    0x06,0x00,0x00,0x00,0x0a,0x01,0x00,0x00,0x23,0x00,0x00,0x00,0x02,0x01,0x00,0x00,
+    0x04,0x01,0x00,0x00,0x06,0x01,0x00,0x00,0x08,0x01,0x00,0x00,0x8e,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0x0b,0x01,0x00,0x00,0x01,0x01,0x00,0x00,0x0a,0x01,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x0c,0x01,0x00,0x00,0x00,0x01,0x00,0x00,
+    0x0b,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+    0xeb,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x0f,0x01,0x00,0x00,
+    0xd7,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x0e,0x01,0x00,0x00,0x0f,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x11,0x01,0x00,0x00,0xdc,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x10,0x01,0x00,0x00,0x11,0x01,0x00,0x00,0x39,0x00,0x06,0x00,
+    0x06,0x00,0x00,0x00,0x12,0x01,0x00,0x00,0x0b,0x00,0x00,0x00,0x0e,0x01,0x00,0x00,
+    0x10,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x14,0x01,0x00,0x00,
+    0xde,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x13,0x01,0x00,0x00,0x14,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x16,0x01,0x00,0x00,0xe0,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x15,0x01,0x00,0x00,0x16,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x18,0x01,0x00,0x00,0xe2,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x17,0x01,0x00,0x00,0x18,0x01,0x00,0x00,0x39,0x00,0x07,0x00,0x06,0x00,0x00,0x00,
+    0x19,0x01,0x00,0x00,0x11,0x00,0x00,0x00,0x13,0x01,0x00,0x00,0x15,0x01,0x00,0x00,
+    0x17,0x01,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x1a,0x01,0x00,0x00,
+    0x12,0x01,0x00,0x00,0x19,0x01,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x1b,0x01,0x00,0x00,0x0d,0x01,0x00,0x00,0x1a,0x01,0x00,0x00,0x81,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0x1c,0x01,0x00,0x00,0x0c,0x01,0x00,0x00,0x1b,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x1d,0x01,0x00,0x00,0xd2,0x00,0x00,0x00,
+    0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x1e,0x01,0x00,0x00,0x1c,0x01,0x00,0x00,
+    0x1d,0x01,0x00,0x00,0xfe,0x00,0x02,0x00,0x1e,0x01,0x00,0x00,0x38,0x00,0x01,0x00,
+    0x36,0x00,0x05,0x00,0x33,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x34,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x31,0x00,0x00,0x00,0x35,0x00,0x00,0x00,
+    0xf8,0x00,0x02,0x00,0x37,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x23,0x01,0x00,0x00,
+    0x24,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x54,0x01,0x00,0x00,
+    0x55,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x30,0x00,0x00,0x00,
+    0x26,0x01,0x00,0x00,0x35,0x00,0x00,0x00,0x4f,0x00,0x07,0x00,0x25,0x01,0x00,0x00,
+    0x27,0x01,0x00,0x00,0x26,0x01,0x00,0x00,0x26,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x29,0x01,0x00,0x00,
+    0x35,0x00,0x00,0x00,0x28,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x2a,0x01,0x00,0x00,0x29,0x01,0x00,0x00,0x50,0x00,0x05,0x00,0x25,0x01,0x00,0x00,
+    0x2b,0x01,0x00,0x00,0x2a,0x01,0x00,0x00,0x2a,0x01,0x00,0x00,0x88,0x00,0x05,0x00,
+    0x25,0x01,0x00,0x00,0x2c,0x01,0x00,0x00,0x27,0x01,0x00,0x00,0x2b,0x01,0x00,0x00,
+    0x8e,0x00,0x05,0x00,0x25,0x01,0x00,0x00,0x2d,0x01,0x00,0x00,0x2c,0x01,0x00,0x00,
+    0x72,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x25,0x01,0x00,0x00,0x2f,0x01,0x00,0x00,
+    0x2d,0x01,0x00,0x00,0x2e,0x01,0x00,0x00,0x41,0x00,0x05,0x00,0x34,0x01,0x00,0x00,
+    0x35,0x01,0x00,0x00,0x32,0x01,0x00,0x00,0x33,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x30,0x00,0x00,0x00,0x36,0x01,0x00,0x00,0x35,0x01,0x00,0x00,0x4f,0x00,0x07,0x00,
+    0x25,0x01,0x00,0x00,0x37,0x01,0x00,0x00,0x36,0x01,0x00,0x00,0x36,0x01,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x25,0x01,0x00,0x00,
+    0x38,0x01,0x00,0x00,0x2f,0x01,0x00,0x00,0x37,0x01,0x00,0x00,0x41,0x00,0x05,0x00,
+    0x07,0x00,0x00,0x00,0x39,0x01,0x00,0x00,0x35,0x00,0x00,0x00,0x28,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x3a,0x01,0x00,0x00,0x39,0x01,0x00,0x00,
+    0x0c,0x00,0x07,0x00,0x06,0x00,0x00,0x00,0x3c,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x28,0x00,0x00,0x00,0x3a,0x01,0x00,0x00,0x3b,0x01,0x00,0x00,0x0c,0x00,0x06,0x00,
+    0x06,0x00,0x00,0x00,0x3d,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,
+    0x3c,0x01,0x00,0x00,0x41,0x00,0x06,0x00,0x40,0x01,0x00,0x00,0x41,0x01,0x00,0x00,
+    0x32,0x01,0x00,0x00,0x3e,0x01,0x00,0x00,0x3f,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x42,0x01,0x00,0x00,0x41,0x01,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x43,0x01,0x00,0x00,0x3d,0x01,0x00,0x00,0x42,0x01,0x00,0x00,
+    0x41,0x00,0x06,0x00,0x40,0x01,0x00,0x00,0x45,0x01,0x00,0x00,0x32,0x01,0x00,0x00,
+    0x3e,0x01,0x00,0x00,0x44,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x46,0x01,0x00,0x00,0x45,0x01,0x00,0x00,0x81,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x47,0x01,0x00,0x00,0x43,0x01,0x00,0x00,0x46,0x01,0x00,0x00,0x51,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x48,0x01,0x00,0x00,0x38,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x49,0x01,0x00,0x00,0x38,0x01,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x50,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0x4a,0x01,0x00,0x00,
+    0x48,0x01,0x00,0x00,0x49,0x01,0x00,0x00,0x47,0x01,0x00,0x00,0x6e,0x00,0x04,0x00,
+    0x22,0x01,0x00,0x00,0x4b,0x01,0x00,0x00,0x4a,0x01,0x00,0x00,0x41,0x00,0x05,0x00,
+    0x34,0x01,0x00,0x00,0x4d,0x01,0x00,0x00,0x32,0x01,0x00,0x00,0x33,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x30,0x00,0x00,0x00,0x4e,0x01,0x00,0x00,0x4d,0x01,0x00,0x00,
+    0x4f,0x00,0x08,0x00,0x17,0x00,0x00,0x00,0x4f,0x01,0x00,0x00,0x4e,0x01,0x00,0x00,
+    0x4e,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x6e,0x00,0x04,0x00,0x22,0x01,0x00,0x00,0x50,0x01,0x00,0x00,0x4f,0x01,0x00,0x00,
+    0x82,0x00,0x05,0x00,0x22,0x01,0x00,0x00,0x52,0x01,0x00,0x00,0x50,0x01,0x00,0x00,
+    0x51,0x01,0x00,0x00,0x0c,0x00,0x08,0x00,0x22,0x01,0x00,0x00,0x53,0x01,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,0x4b,0x01,0x00,0x00,0x4c,0x01,0x00,0x00,
+    0x52,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x24,0x01,0x00,0x00,0x53,0x01,0x00,0x00,
+    0x41,0x00,0x05,0x00,0x54,0x01,0x00,0x00,0x57,0x01,0x00,0x00,0x24,0x01,0x00,0x00,
+    0x56,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x21,0x01,0x00,0x00,0x58,0x01,0x00,0x00,
+    0x57,0x01,0x00,0x00,0x41,0x00,0x06,0x00,0x40,0x01,0x00,0x00,0x59,0x01,0x00,0x00,
+    0x32,0x01,0x00,0x00,0x33,0x01,0x00,0x00,0x44,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x5a,0x01,0x00,0x00,0x59,0x01,0x00,0x00,0x6e,0x00,0x04,0x00,
+    0x21,0x01,0x00,0x00,0x5b,0x01,0x00,0x00,0x5a,0x01,0x00,0x00,0x84,0x00,0x05,0x00,
+    0x21,0x01,0x00,0x00,0x5c,0x01,0x00,0x00,0x58,0x01,0x00,0x00,0x5b,0x01,0x00,0x00,
+    0x41,0x00,0x05,0x00,0x54,0x01,0x00,0x00,0x5d,0x01,0x00,0x00,0x24,0x01,0x00,0x00,
+    0x44,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x21,0x01,0x00,0x00,0x5e,0x01,0x00,0x00,
+    0x5d,0x01,0x00,0x00,0x80,0x00,0x05,0x00,0x21,0x01,0x00,0x00,0x5f,0x01,0x00,0x00,
+    0x5c,0x01,0x00,0x00,0x5e,0x01,0x00,0x00,0x41,0x00,0x06,0x00,0x40,0x01,0x00,0x00,
+    0x60,0x01,0x00,0x00,0x32,0x01,0x00,0x00,0x33,0x01,0x00,0x00,0x3f,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x61,0x01,0x00,0x00,0x60,0x01,0x00,0x00,
+    0x6e,0x00,0x04,0x00,0x21,0x01,0x00,0x00,0x62,0x01,0x00,0x00,0x61,0x01,0x00,0x00,
+    0x84,0x00,0x05,0x00,0x21,0x01,0x00,0x00,0x63,0x01,0x00,0x00,0x5f,0x01,0x00,0x00,
+    0x62,0x01,0x00,0x00,0x41,0x00,0x05,0x00,0x54,0x01,0x00,0x00,0x64,0x01,0x00,0x00,
+    0x24,0x01,0x00,0x00,0x3f,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x21,0x01,0x00,0x00,
+    0x65,0x01,0x00,0x00,0x64,0x01,0x00,0x00,0x80,0x00,0x05,0x00,0x21,0x01,0x00,0x00,
+    0x66,0x01,0x00,0x00,0x63,0x01,0x00,0x00,0x65,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x55,0x01,0x00,0x00,0x66,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x21,0x01,0x00,0x00,
+    0x6c,0x01,0x00,0x00,0x55,0x01,0x00,0x00,0x41,0x00,0x07,0x00,0x6d,0x01,0x00,0x00,
+    0x6e,0x01,0x00,0x00,0x6b,0x01,0x00,0x00,0x33,0x01,0x00,0x00,0x6c,0x01,0x00,0x00,
+    0x33,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x32,0x00,0x00,0x00,0x6f,0x01,0x00,0x00,
+    0x6e,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x21,0x01,0x00,0x00,0x70,0x01,0x00,0x00,
+    0x55,0x01,0x00,0x00,0x41,0x00,0x07,0x00,0x6d,0x01,0x00,0x00,0x71,0x01,0x00,0x00,
+    0x6b,0x01,0x00,0x00,0x33,0x01,0x00,0x00,0x70,0x01,0x00,0x00,0x3e,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x32,0x00,0x00,0x00,0x72,0x01,0x00,0x00,0x71,0x01,0x00,0x00,
+    0x50,0x00,0x05,0x00,0x33,0x00,0x00,0x00,0x73,0x01,0x00,0x00,0x6f,0x01,0x00,0x00,
+    0x72,0x01,0x00,0x00,0xfe,0x00,0x02,0x00,0x73,0x01,0x00,0x00,0x38,0x00,0x01,0x00,
+    0x36,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x3a,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x39,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,
+    0x37,0x00,0x03,0x00,0x18,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
+    0x18,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x3f,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x76,0x01,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x7c,0x01,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x86,0x01,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x8e,0x01,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x94,0x01,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x41,0x00,0x05,0x00,0x31,0x00,0x00,0x00,0x77,0x01,0x00,0x00,0x3b,0x00,0x00,0x00,
+    0x33,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x30,0x00,0x00,0x00,0x78,0x01,0x00,0x00,
+    0x77,0x01,0x00,0x00,0x4f,0x00,0x08,0x00,0x17,0x00,0x00,0x00,0x79,0x01,0x00,0x00,
+    0x78,0x01,0x00,0x00,0x78,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x7a,0x01,0x00,0x00,
+    0x3c,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x7b,0x01,0x00,0x00,
+    0x79,0x01,0x00,0x00,0x7a,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x76,0x01,0x00,0x00,
+    0x7b,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x7d,0x01,0x00,0x00,
+    0x76,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x7e,0x01,0x00,0x00,
+    0x76,0x01,0x00,0x00,0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x7f,0x01,0x00,0x00,
+    0x7d,0x01,0x00,0x00,0x7e,0x01,0x00,0x00,0x0c,0x00,0x07,0x00,0x06,0x00,0x00,0x00,
+    0x81,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x7f,0x01,0x00,0x00,
+    0x80,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x7c,0x01,0x00,0x00,0x81,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x82,0x01,0x00,0x00,0x76,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x83,0x01,0x00,0x00,0x7c,0x01,0x00,0x00,
+    0x0c,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x84,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x20,0x00,0x00,0x00,0x83,0x01,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x85,0x01,0x00,0x00,0x82,0x01,0x00,0x00,0x84,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x3d,0x00,0x00,0x00,0x85,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x87,0x01,0x00,0x00,0x7c,0x01,0x00,0x00,0x41,0x00,0x06,0x00,0x07,0x00,0x00,0x00,
+    0x88,0x01,0x00,0x00,0x3b,0x00,0x00,0x00,0x33,0x01,0x00,0x00,0x28,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x89,0x01,0x00,0x00,0x88,0x01,0x00,0x00,
+    0x41,0x00,0x06,0x00,0x07,0x00,0x00,0x00,0x8a,0x01,0x00,0x00,0x3b,0x00,0x00,0x00,
+    0x33,0x01,0x00,0x00,0x28,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x8b,0x01,0x00,0x00,0x8a,0x01,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x8c,0x01,0x00,0x00,0x89,0x01,0x00,0x00,0x8b,0x01,0x00,0x00,0x88,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x8d,0x01,0x00,0x00,0x87,0x01,0x00,0x00,0x8c,0x01,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x86,0x01,0x00,0x00,0x8d,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x8f,0x01,0x00,0x00,0x86,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0x90,0x01,0x00,0x00,0x86,0x01,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x91,0x01,0x00,0x00,0x8f,0x01,0x00,0x00,0x90,0x01,0x00,0x00,
+    0x83,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x92,0x01,0x00,0x00,0x5a,0x00,0x00,0x00,
+    0x91,0x01,0x00,0x00,0x0c,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x93,0x01,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x92,0x01,0x00,0x00,0x90,0x00,0x00,0x00,
+    0x5a,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x8e,0x01,0x00,0x00,0x93,0x01,0x00,0x00,
+    0x41,0x00,0x05,0x00,0x31,0x00,0x00,0x00,0x96,0x01,0x00,0x00,0x3b,0x00,0x00,0x00,
+    0x95,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x30,0x00,0x00,0x00,0x97,0x01,0x00,0x00,
+    0x96,0x01,0x00,0x00,0x4f,0x00,0x08,0x00,0x17,0x00,0x00,0x00,0x98,0x01,0x00,0x00,
+    0x97,0x01,0x00,0x00,0x97,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x99,0x01,0x00,0x00,
+    0x3d,0x00,0x00,0x00,0x7f,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x9a,0x01,0x00,0x00,
+    0x99,0x01,0x00,0x00,0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x9b,0x01,0x00,0x00,
+    0x98,0x01,0x00,0x00,0x9a,0x01,0x00,0x00,0x41,0x00,0x06,0x00,0x07,0x00,0x00,0x00,
+    0x9c,0x01,0x00,0x00,0x3b,0x00,0x00,0x00,0x3e,0x01,0x00,0x00,0x28,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x9d,0x01,0x00,0x00,0x9c,0x01,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x9e,0x01,0x00,0x00,0x9b,0x01,0x00,0x00,
+    0x9d,0x01,0x00,0x00,0x41,0x00,0x06,0x00,0x07,0x00,0x00,0x00,0x9f,0x01,0x00,0x00,
+    0x3b,0x00,0x00,0x00,0x95,0x01,0x00,0x00,0x28,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xa0,0x01,0x00,0x00,0x9f,0x01,0x00,0x00,0x81,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0xa1,0x01,0x00,0x00,0x9e,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,
+    0x0c,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0xa2,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x2b,0x00,0x00,0x00,0xa1,0x01,0x00,0x00,0x90,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x94,0x01,0x00,0x00,0xa2,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xa3,0x01,0x00,0x00,0x8e,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x06,0x00,0x00,0x00,0xa4,0x01,0x00,0x00,0x8e,0x01,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0xa5,0x01,0x00,0x00,0xa3,0x01,0x00,0x00,0xa4,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xa6,0x01,0x00,0x00,0x94,0x01,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xa7,0x01,0x00,0x00,0xa5,0x01,0x00,0x00,
+    0xa6,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xa8,0x01,0x00,0x00,
+    0x94,0x01,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xa9,0x01,0x00,0x00,
+    0xa7,0x01,0x00,0x00,0xa8,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xaa,0x01,0x00,0x00,0x7c,0x01,0x00,0x00,0x88,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0xab,0x01,0x00,0x00,0xa9,0x01,0x00,0x00,0xaa,0x01,0x00,0x00,0xfe,0x00,0x02,0x00,
+    0xab,0x01,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
+    0x07,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x18,0x00,0x00,0x00,
+    0x42,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x43,0x00,0x00,0x00,
+    0xf8,0x00,0x02,0x00,0x45,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
+    0xae,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
+    0xb8,0x01,0x00,0x00,0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0xaf,0x01,0x00,0x00,0x41,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xae,0x01,0x00,0x00,
+    0xaf,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xb0,0x01,0x00,0x00,
+    0x42,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xb1,0x01,0x00,0x00,
+    0x43,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xb2,0x01,0x00,0x00,
+    0x5a,0x00,0x00,0x00,0xb1,0x01,0x00,0x00,0x50,0x00,0x06,0x00,0x17,0x00,0x00,0x00,
+    0xb3,0x01,0x00,0x00,0xb2,0x01,0x00,0x00,0xb2,0x01,0x00,0x00,0xb2,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xb4,0x01,0x00,0x00,0x42,0x00,0x00,0x00,
+    0x0c,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0xb5,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x28,0x00,0x00,0x00,0xb3,0x01,0x00,0x00,0xb4,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0xb6,0x01,0x00,0x00,0x42,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0xb7,0x01,0x00,0x00,0xb5,0x01,0x00,0x00,0xb6,0x01,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xb9,0x01,0x00,0x00,0xae,0x01,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0xb8,0x01,0x00,0x00,0xb9,0x01,0x00,0x00,0x39,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0xba,0x01,0x00,0x00,0x15,0x00,0x00,0x00,0xb8,0x01,0x00,0x00,
+    0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xbb,0x01,0x00,0x00,0xb7,0x01,0x00,0x00,
+    0xba,0x01,0x00,0x00,0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xbc,0x01,0x00,0x00,
+    0xb0,0x01,0x00,0x00,0xbb,0x01,0x00,0x00,0xfe,0x00,0x02,0x00,0xbc,0x01,0x00,0x00,
+    0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x48,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x46,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x18,0x00,0x00,0x00,
+    0x47,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x49,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0xbf,0x01,0x00,0x00,0x47,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x17,0x00,0x00,0x00,0xc0,0x01,0x00,0x00,0x47,0x00,0x00,0x00,0x8e,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0xc2,0x01,0x00,0x00,0xc0,0x01,0x00,0x00,0xc1,0x01,0x00,0x00,
+    0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xc5,0x01,0x00,0x00,0xc2,0x01,0x00,0x00,
+    0xc4,0x01,0x00,0x00,0x85,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xc6,0x01,0x00,0x00,
+    0xbf,0x01,0x00,0x00,0xc5,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0xc7,0x01,0x00,0x00,0x47,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0xc8,0x01,0x00,0x00,0x47,0x00,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0xca,0x01,0x00,0x00,0xc8,0x01,0x00,0x00,0xc9,0x01,0x00,0x00,0x81,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0xcd,0x01,0x00,0x00,0xca,0x01,0x00,0x00,0xcc,0x01,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xce,0x01,0x00,0x00,0xc7,0x01,0x00,0x00,
+    0xcd,0x01,0x00,0x00,0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xd1,0x01,0x00,0x00,
+    0xce,0x01,0x00,0x00,0xd0,0x01,0x00,0x00,0x88,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0xd2,0x01,0x00,0x00,0xc6,0x01,0x00,0x00,0xd1,0x01,0x00,0x00,0x0c,0x00,0x08,0x00,
+    0x17,0x00,0x00,0x00,0xd4,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,
+    0xd2,0x01,0x00,0x00,0xd3,0x01,0x00,0x00,0xa0,0x00,0x00,0x00,0xfe,0x00,0x02,0x00,
+    0xd4,0x01,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
+    0x4b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
+    0x18,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x4c,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xd7,0x01,0x00,0x00,0x4a,0x00,0x00,0x00,
+    0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xd9,0x01,0x00,0x00,0xd7,0x01,0x00,0x00,
+    0xd8,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xda,0x01,0x00,0x00,
+    0x4a,0x00,0x00,0x00,0x0c,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0xdb,0x01,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0xda,0x01,0x00,0x00,0xd3,0x01,0x00,0x00,
+    0x0c,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0xde,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x1a,0x00,0x00,0x00,0xdb,0x01,0x00,0x00,0xdd,0x01,0x00,0x00,0x8e,0x00,0x05,0x00,
+    0x17,0x00,0x00,0x00,0xe0,0x01,0x00,0x00,0xde,0x01,0x00,0x00,0xdf,0x01,0x00,0x00,
+    0x83,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xe3,0x01,0x00,0x00,0xe0,0x01,0x00,0x00,
+    0xe2,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xe6,0x01,0x00,0x00,
+    0x4a,0x00,0x00,0x00,0x0c,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0xe7,0x01,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0xe5,0x01,0x00,0x00,0xe6,0x01,0x00,0x00,
+    0x0c,0x00,0x08,0x00,0x17,0x00,0x00,0x00,0xe8,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x2e,0x00,0x00,0x00,0xd9,0x01,0x00,0x00,0xe3,0x01,0x00,0x00,0xe7,0x01,0x00,0x00,
+    0xfe,0x00,0x02,0x00,0xe8,0x01,0x00,0x00,0x38,0x00,0x01,0x00,
+};
+static inline const sg_shader_desc* pbr_pbr_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pbr_vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pbr_fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "pos";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "normal";
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].glsl_name = "uv";
+            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[3].glsl_name = "tangent";
+            desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[4].glsl_name = "occlusion";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 13;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 64;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 4;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "fs_params";
+            desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[0].texture.multisampled = false;
+            desc.views[1].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[1].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[1].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[1].texture.multisampled = false;
+            desc.views[2].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[2].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[2].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[2].texture.multisampled = false;
+            desc.views[3].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[3].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[3].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[3].texture.multisampled = false;
+            desc.views[4].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[4].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[4].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[4].texture.multisampled = false;
+            desc.views[5].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[5].texture.image_type = SG_IMAGETYPE_CUBE;
+            desc.views[5].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[5].texture.multisampled = false;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_CUBE;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.views[7].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[7].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[7].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[7].texture.multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[3].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[4].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[5].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[5].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[6].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[6].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[7].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[0].view_slot = 0;
+            desc.texture_sampler_pairs[0].sampler_slot = 0;
+            desc.texture_sampler_pairs[0].glsl_name = "base_color_tex_base_color_smp";
+            desc.texture_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[1].view_slot = 1;
+            desc.texture_sampler_pairs[1].sampler_slot = 1;
+            desc.texture_sampler_pairs[1].glsl_name = "metallic_roughness_tex_metallic_roughness_smp";
+            desc.texture_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[2].view_slot = 3;
+            desc.texture_sampler_pairs[2].sampler_slot = 3;
+            desc.texture_sampler_pairs[2].glsl_name = "occlusion_tex_occlusion_smp";
+            desc.texture_sampler_pairs[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[3].view_slot = 4;
+            desc.texture_sampler_pairs[3].sampler_slot = 4;
+            desc.texture_sampler_pairs[3].glsl_name = "emissive_tex_emissive_smp";
+            desc.texture_sampler_pairs[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[4].view_slot = 2;
+            desc.texture_sampler_pairs[4].sampler_slot = 2;
+            desc.texture_sampler_pairs[4].glsl_name = "normal_tex_normal_smp";
+            desc.texture_sampler_pairs[5].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[5].view_slot = 5;
+            desc.texture_sampler_pairs[5].sampler_slot = 5;
+            desc.texture_sampler_pairs[5].glsl_name = "irradiance_map_irradiance_smp";
+            desc.texture_sampler_pairs[6].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[6].view_slot = 6;
+            desc.texture_sampler_pairs[6].sampler_slot = 6;
+            desc.texture_sampler_pairs[6].glsl_name = "prefilter_map_prefilter_smp";
+            desc.texture_sampler_pairs[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[7].view_slot = 7;
+            desc.texture_sampler_pairs[7].sampler_slot = 7;
+            desc.texture_sampler_pairs[7].glsl_name = "brdf_lut_brdf_lut_smp";
+            desc.label = "pbr_pbr_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_D3D11) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pbr_vs_source_hlsl5;
+            desc.vertex_func.d3d11_target = "vs_5_0";
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)pbr_fs_source_hlsl5;
+            desc.fragment_func.d3d11_target = "ps_5_0";
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[0].hlsl_sem_index = 0;
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[1].hlsl_sem_index = 1;
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[2].hlsl_sem_index = 2;
+            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[3].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[3].hlsl_sem_index = 3;
+            desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[4].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[4].hlsl_sem_index = 4;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].hlsl_register_b_n = 0;
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 64;
+            desc.uniform_blocks[1].hlsl_register_b_n = 1;
+            desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[0].texture.multisampled = false;
+            desc.views[0].texture.hlsl_register_t_n = 0;
+            desc.views[1].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[1].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[1].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[1].texture.multisampled = false;
+            desc.views[1].texture.hlsl_register_t_n = 1;
+            desc.views[2].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[2].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[2].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[2].texture.multisampled = false;
+            desc.views[2].texture.hlsl_register_t_n = 2;
+            desc.views[3].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[3].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[3].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[3].texture.multisampled = false;
+            desc.views[3].texture.hlsl_register_t_n = 3;
+            desc.views[4].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[4].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[4].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[4].texture.multisampled = false;
+            desc.views[4].texture.hlsl_register_t_n = 4;
+            desc.views[5].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[5].texture.image_type = SG_IMAGETYPE_CUBE;
+            desc.views[5].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[5].texture.multisampled = false;
+            desc.views[5].texture.hlsl_register_t_n = 5;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_CUBE;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.views[6].texture.hlsl_register_t_n = 6;
+            desc.views[7].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[7].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[7].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[7].texture.multisampled = false;
+            desc.views[7].texture.hlsl_register_t_n = 7;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].hlsl_register_s_n = 0;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].hlsl_register_s_n = 1;
+            desc.samplers[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[2].hlsl_register_s_n = 2;
+            desc.samplers[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[3].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[3].hlsl_register_s_n = 3;
+            desc.samplers[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[4].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[4].hlsl_register_s_n = 4;
+            desc.samplers[5].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[5].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[5].hlsl_register_s_n = 5;
+            desc.samplers[6].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[6].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[6].hlsl_register_s_n = 6;
+            desc.samplers[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[7].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[7].hlsl_register_s_n = 7;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[0].view_slot = 0;
+            desc.texture_sampler_pairs[0].sampler_slot = 0;
+            desc.texture_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[1].view_slot = 1;
+            desc.texture_sampler_pairs[1].sampler_slot = 1;
+            desc.texture_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[2].view_slot = 3;
+            desc.texture_sampler_pairs[2].sampler_slot = 3;
+            desc.texture_sampler_pairs[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[3].view_slot = 4;
+            desc.texture_sampler_pairs[3].sampler_slot = 4;
+            desc.texture_sampler_pairs[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[4].view_slot = 2;
+            desc.texture_sampler_pairs[4].sampler_slot = 2;
+            desc.texture_sampler_pairs[5].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[5].view_slot = 5;
+            desc.texture_sampler_pairs[5].sampler_slot = 5;
+            desc.texture_sampler_pairs[6].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[6].view_slot = 6;
+            desc.texture_sampler_pairs[6].sampler_slot = 6;
+            desc.texture_sampler_pairs[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[7].view_slot = 7;
+            desc.texture_sampler_pairs[7].sampler_slot = 7;
+            desc.label = "pbr_pbr_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_MACOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)pbr_vs_source_metal_macos;
+            desc.vertex_func.entry = "main0";
+            desc.fragment_func.source = (const char*)pbr_fs_source_metal_macos;
+            desc.fragment_func.entry = "main0";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 64;
+            desc.uniform_blocks[1].msl_buffer_n = 1;
+            desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[0].texture.multisampled = false;
+            desc.views[0].texture.msl_texture_n = 0;
+            desc.views[1].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[1].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[1].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[1].texture.multisampled = false;
+            desc.views[1].texture.msl_texture_n = 1;
+            desc.views[2].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[2].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[2].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[2].texture.multisampled = false;
+            desc.views[2].texture.msl_texture_n = 2;
+            desc.views[3].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[3].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[3].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[3].texture.multisampled = false;
+            desc.views[3].texture.msl_texture_n = 3;
+            desc.views[4].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[4].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[4].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[4].texture.multisampled = false;
+            desc.views[4].texture.msl_texture_n = 4;
+            desc.views[5].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[5].texture.image_type = SG_IMAGETYPE_CUBE;
+            desc.views[5].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[5].texture.multisampled = false;
+            desc.views[5].texture.msl_texture_n = 5;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_CUBE;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.views[6].texture.msl_texture_n = 6;
+            desc.views[7].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[7].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[7].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[7].texture.multisampled = false;
+            desc.views[7].texture.msl_texture_n = 7;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].msl_sampler_n = 0;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].msl_sampler_n = 1;
+            desc.samplers[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[2].msl_sampler_n = 2;
+            desc.samplers[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[3].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[3].msl_sampler_n = 3;
+            desc.samplers[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[4].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[4].msl_sampler_n = 4;
+            desc.samplers[5].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[5].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[5].msl_sampler_n = 5;
+            desc.samplers[6].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[6].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[6].msl_sampler_n = 6;
+            desc.samplers[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[7].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[7].msl_sampler_n = 7;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[0].view_slot = 0;
+            desc.texture_sampler_pairs[0].sampler_slot = 0;
+            desc.texture_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[1].view_slot = 1;
+            desc.texture_sampler_pairs[1].sampler_slot = 1;
+            desc.texture_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[2].view_slot = 3;
+            desc.texture_sampler_pairs[2].sampler_slot = 3;
+            desc.texture_sampler_pairs[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[3].view_slot = 4;
+            desc.texture_sampler_pairs[3].sampler_slot = 4;
+            desc.texture_sampler_pairs[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[4].view_slot = 2;
+            desc.texture_sampler_pairs[4].sampler_slot = 2;
+            desc.texture_sampler_pairs[5].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[5].view_slot = 5;
+            desc.texture_sampler_pairs[5].sampler_slot = 5;
+            desc.texture_sampler_pairs[6].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[6].view_slot = 6;
+            desc.texture_sampler_pairs[6].sampler_slot = 6;
+            desc.texture_sampler_pairs[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[7].view_slot = 7;
+            desc.texture_sampler_pairs[7].sampler_slot = 7;
+            desc.label = "pbr_pbr_shader";
+        }
+        return &desc;
     }
-
-    void main()
-    {
-        vec4 _287 = texture(sampler2D(base_color_tex, base_color_smp), v_uv) * _281.base_color_factor;
-        vec4 _295 = texture(sampler2D(metallic_roughness_tex, metallic_roughness_smp), v_uv);
-        float _306 = _295.z * _281.metallic_factor;
-        float _316 = clamp(_295.y * _281.roughness_factor, 0.039999999105930328369140625, 1.0);
-        vec3 _381 = normalize(mat3(v_tangent, v_bitangent, v_normal) * ((texture(sampler2D(normal_tex, normal_smp), v_uv).xyz * 2.0) - vec3(1.0)));
-        vec3 _389 = normalize(_281.cam_pos - v_world_pos);
-        float _399 = max(dot(_381, _389), 9.9999997473787516355514526367188e-05);
-        vec3 _403 = _287.xyz;
-        vec3 _406 = mix(vec3(0.039999999105930328369140625), _403, vec3(_306));
-        float _411 = 1.0 - _306;
-        vec3 _412 = _403 * _411;
-        vec3 _420 = normalize(_389 + vec3(0.57735025882720947265625));
-        float _425 = max(dot(_381, vec3(0.57735025882720947265625)), 9.9999997473787516355514526367188e-05);
-        float param = max(dot(_381, _420), 0.0);
-        float param_1 = _316;
-        float param_2 = _399;
-        float param_3 = _425;
-        float param_4 = _316;
-        float param_5 = max(dot(_389, _420), 0.0);
-        vec3 param_6 = _406;
-        vec3 _460 = F_Schlick(param_5, param_6);
-        float param_7 = _399;
-        float param_8 = _425;
-        float param_9 = max(dot(vec3(0.57735025882720947265625), _420), 0.0);
-        float param_10 = _316;
-        float param_11 = _399;
-        vec3 param_12 = _406;
-        float param_13 = _316;
-        vec3 _507 = F_SchlickRoughness(param_11, param_12, param_13);
-        vec4 _555 = texture(sampler2D(brdf_lut, brdf_lut_smp), vec2(_399, _316));
-        vec3 param_14 = ((((((vec3(1.0) - _507) * _411) * ((texture(samplerCube(irradiance_map, irradiance_smp), _381).xyz * _412) * 0.300000011920928955078125)) + ((textureLod(samplerCube(prefilter_map, prefilter_smp), reflect(-_389, _381), _316 * 4.0).xyz * ((_507 * _555.x) + vec3(_555.y))) * 0.5)) * texture(sampler2D(occlusion_tex, occlusion_smp), v_uv).x) + (((((vec3(1.0) - _460) * _411) * (_412 * Fd_DisneyDiffuse(param_7, param_8, param_9, param_10))) + (_460 * (D_GGX(param, param_1) * G_SmithGGX(param_2, param_3, param_4)))) * _425)) + (texture(sampler2D(emissive_tex, emissive_smp), v_uv).xyz * _281.emissive_factor);
-        vec3 param_15 = ACESFilm(param_14);
-        frag_color = vec4(linearToSRGB(param_15), _287.w);
+    if (backend == SG_BACKEND_VULKAN) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.bytecode.ptr = pbr_vs_bytecode_spirv_vk;
+            desc.vertex_func.bytecode.size = 2936;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.bytecode.ptr = pbr_fs_bytecode_spirv_vk;
+            desc.fragment_func.bytecode.size = 15292;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 208;
+            desc.uniform_blocks[0].spirv_set0_binding_n = 0;
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 64;
+            desc.uniform_blocks[1].spirv_set0_binding_n = 1;
+            desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[0].texture.multisampled = false;
+            desc.views[0].texture.spirv_set1_binding_n = 0;
+            desc.views[1].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[1].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[1].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[1].texture.multisampled = false;
+            desc.views[1].texture.spirv_set1_binding_n = 1;
+            desc.views[2].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[2].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[2].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[2].texture.multisampled = false;
+            desc.views[2].texture.spirv_set1_binding_n = 2;
+            desc.views[3].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[3].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[3].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[3].texture.multisampled = false;
+            desc.views[3].texture.spirv_set1_binding_n = 3;
+            desc.views[4].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[4].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[4].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[4].texture.multisampled = false;
+            desc.views[4].texture.spirv_set1_binding_n = 4;
+            desc.views[5].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[5].texture.image_type = SG_IMAGETYPE_CUBE;
+            desc.views[5].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[5].texture.multisampled = false;
+            desc.views[5].texture.spirv_set1_binding_n = 5;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_CUBE;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.views[6].texture.spirv_set1_binding_n = 6;
+            desc.views[7].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[7].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[7].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[7].texture.multisampled = false;
+            desc.views[7].texture.spirv_set1_binding_n = 7;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].spirv_set1_binding_n = 32;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].spirv_set1_binding_n = 33;
+            desc.samplers[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[2].spirv_set1_binding_n = 34;
+            desc.samplers[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[3].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[3].spirv_set1_binding_n = 35;
+            desc.samplers[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[4].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[4].spirv_set1_binding_n = 36;
+            desc.samplers[5].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[5].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[5].spirv_set1_binding_n = 37;
+            desc.samplers[6].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[6].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[6].spirv_set1_binding_n = 38;
+            desc.samplers[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[7].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[7].spirv_set1_binding_n = 39;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[0].view_slot = 0;
+            desc.texture_sampler_pairs[0].sampler_slot = 0;
+            desc.texture_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[1].view_slot = 1;
+            desc.texture_sampler_pairs[1].sampler_slot = 1;
+            desc.texture_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[2].view_slot = 3;
+            desc.texture_sampler_pairs[2].sampler_slot = 3;
+            desc.texture_sampler_pairs[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[3].view_slot = 4;
+            desc.texture_sampler_pairs[3].sampler_slot = 4;
+            desc.texture_sampler_pairs[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[4].view_slot = 2;
+            desc.texture_sampler_pairs[4].sampler_slot = 2;
+            desc.texture_sampler_pairs[5].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[5].view_slot = 5;
+            desc.texture_sampler_pairs[5].sampler_slot = 5;
+            desc.texture_sampler_pairs[6].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[6].view_slot = 6;
+            desc.texture_sampler_pairs[6].sampler_slot = 6;
+            desc.texture_sampler_pairs[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[7].view_slot = 7;
+            desc.texture_sampler_pairs[7].sampler_slot = 7;
+            desc.label = "pbr_pbr_shader";
+        }
+        return &desc;
     }
-
-*/
-static const uint8_t pbr_fs_bytecode_spirv_vk[13772] = {
-    0x03,0x02,0x23,0x07,0x00,0x04,0x01,0x00,0x0b,0x00,0x08,0x00,0x24,0x02,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x11,0x00,0x02,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x06,0x00,
-    0x01,0x00,0x00,0x00,0x47,0x4c,0x53,0x4c,0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,
-    0x00,0x00,0x00,0x00,0x0e,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-    0x0f,0x00,0x1c,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6d,0x61,0x69,0x6e,
-    0x00,0x00,0x00,0x00,0xf4,0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0xfe,0x00,0x00,0x00,
-    0x03,0x01,0x00,0x00,0x0b,0x01,0x00,0x00,0x0d,0x01,0x00,0x00,0x28,0x01,0x00,0x00,
-    0x2a,0x01,0x00,0x00,0x2c,0x01,0x00,0x00,0x3c,0x01,0x00,0x00,0x3e,0x01,0x00,0x00,
-    0x4d,0x01,0x00,0x00,0xa3,0x01,0x00,0x00,0xa5,0x01,0x00,0x00,0xb3,0x01,0x00,0x00,
-    0xb5,0x01,0x00,0x00,0xc1,0x01,0x00,0x00,0xc3,0x01,0x00,0x00,0xdb,0x01,0x00,0x00,
-    0xdd,0x01,0x00,0x00,0x07,0x02,0x00,0x00,0x09,0x02,0x00,0x00,0x19,0x02,0x00,0x00,
-    0x10,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x03,0x00,0x03,0x00,
-    0x02,0x00,0x00,0x00,0xcc,0x01,0x00,0x00,0x05,0x00,0x04,0x00,0x04,0x00,0x00,0x00,
-    0x6d,0x61,0x69,0x6e,0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0x0b,0x00,0x00,0x00,
-    0x44,0x5f,0x47,0x47,0x58,0x28,0x66,0x31,0x3b,0x66,0x31,0x3b,0x00,0x00,0x00,0x00,
-    0x05,0x00,0x04,0x00,0x09,0x00,0x00,0x00,0x4e,0x64,0x6f,0x74,0x48,0x00,0x00,0x00,
-    0x05,0x00,0x05,0x00,0x0a,0x00,0x00,0x00,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,
-    0x73,0x00,0x00,0x00,0x05,0x00,0x08,0x00,0x11,0x00,0x00,0x00,0x47,0x5f,0x53,0x6d,
-    0x69,0x74,0x68,0x47,0x47,0x58,0x28,0x66,0x31,0x3b,0x66,0x31,0x3b,0x66,0x31,0x3b,
-    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x0e,0x00,0x00,0x00,0x4e,0x64,0x6f,0x74,
-    0x56,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x0f,0x00,0x00,0x00,0x4e,0x64,0x6f,0x74,
-    0x4c,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x10,0x00,0x00,0x00,0x72,0x6f,0x75,0x67,
-    0x68,0x6e,0x65,0x73,0x73,0x00,0x00,0x00,0x05,0x00,0x07,0x00,0x15,0x00,0x00,0x00,
-    0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x28,0x66,
-    0x31,0x3b,0x00,0x00,0x05,0x00,0x03,0x00,0x14,0x00,0x00,0x00,0x75,0x00,0x00,0x00,
-    0x05,0x00,0x07,0x00,0x1c,0x00,0x00,0x00,0x46,0x5f,0x53,0x63,0x68,0x6c,0x69,0x63,
-    0x6b,0x28,0x66,0x31,0x3b,0x76,0x66,0x33,0x3b,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
-    0x1a,0x00,0x00,0x00,0x56,0x64,0x6f,0x74,0x48,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
-    0x1b,0x00,0x00,0x00,0x46,0x30,0x00,0x00,0x05,0x00,0x0a,0x00,0x23,0x00,0x00,0x00,
-    0x46,0x64,0x5f,0x44,0x69,0x73,0x6e,0x65,0x79,0x44,0x69,0x66,0x66,0x75,0x73,0x65,
-    0x28,0x66,0x31,0x3b,0x66,0x31,0x3b,0x66,0x31,0x3b,0x66,0x31,0x3b,0x00,0x00,0x00,
-    0x05,0x00,0x04,0x00,0x1f,0x00,0x00,0x00,0x4e,0x64,0x6f,0x74,0x56,0x00,0x00,0x00,
-    0x05,0x00,0x04,0x00,0x20,0x00,0x00,0x00,0x4e,0x64,0x6f,0x74,0x4c,0x00,0x00,0x00,
-    0x05,0x00,0x04,0x00,0x21,0x00,0x00,0x00,0x4c,0x64,0x6f,0x74,0x48,0x00,0x00,0x00,
-    0x05,0x00,0x05,0x00,0x22,0x00,0x00,0x00,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,
-    0x73,0x00,0x00,0x00,0x05,0x00,0x0a,0x00,0x29,0x00,0x00,0x00,0x46,0x5f,0x53,0x63,
-    0x68,0x6c,0x69,0x63,0x6b,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x28,0x66,
-    0x31,0x3b,0x76,0x66,0x33,0x3b,0x66,0x31,0x3b,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
-    0x26,0x00,0x00,0x00,0x4e,0x64,0x6f,0x74,0x56,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
-    0x27,0x00,0x00,0x00,0x46,0x30,0x00,0x00,0x05,0x00,0x05,0x00,0x28,0x00,0x00,0x00,
-    0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x00,0x00,0x00,0x05,0x00,0x06,0x00,
-    0x2d,0x00,0x00,0x00,0x41,0x43,0x45,0x53,0x46,0x69,0x6c,0x6d,0x28,0x76,0x66,0x33,
-    0x3b,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x2c,0x00,0x00,0x00,0x78,0x00,0x00,0x00,
-    0x05,0x00,0x07,0x00,0x30,0x00,0x00,0x00,0x6c,0x69,0x6e,0x65,0x61,0x72,0x54,0x6f,
-    0x53,0x52,0x47,0x42,0x28,0x76,0x66,0x33,0x3b,0x00,0x00,0x00,0x05,0x00,0x03,0x00,
-    0x2f,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x32,0x00,0x00,0x00,
-    0x5f,0x31,0x33,0x30,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x36,0x00,0x00,0x00,
-    0x5f,0x31,0x33,0x34,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x3a,0x00,0x00,0x00,
-    0x5f,0x31,0x34,0x34,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x4c,0x00,0x00,0x00,
-    0x5f,0x31,0x35,0x37,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x50,0x00,0x00,0x00,
-    0x5f,0x31,0x36,0x31,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x54,0x00,0x00,0x00,
-    0x5f,0x31,0x36,0x38,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x72,0x00,0x00,0x00,
-    0x5f,0x31,0x31,0x35,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x77,0x00,0x00,0x00,
-    0x5f,0x31,0x31,0x39,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x82,0x00,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x88,0x00,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x8f,0x00,0x00,0x00,
-    0x5f,0x32,0x34,0x30,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x9b,0x00,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x9d,0x00,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x00,0x05,0x00,0x04,0x00,0xa0,0x00,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xa6,0x00,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xb2,0x00,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xbc,0x00,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xf1,0x00,0x00,0x00,
-    0x5f,0x32,0x38,0x37,0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0xf4,0x00,0x00,0x00,
-    0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x74,0x65,0x78,0x00,0x00,
-    0x05,0x00,0x06,0x00,0xf8,0x00,0x00,0x00,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,
-    0x6f,0x72,0x5f,0x73,0x6d,0x70,0x00,0x00,0x05,0x00,0x04,0x00,0xfe,0x00,0x00,0x00,
-    0x76,0x5f,0x75,0x76,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x01,0x01,0x00,0x00,
-    0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x00,0x00,0x00,0x06,0x00,0x08,0x00,
-    0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,
-    0x6f,0x72,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x00,0x00,0x00,0x06,0x00,0x07,0x00,
-    0x01,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,
-    0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x00,0x06,0x00,0x08,0x00,0x01,0x01,0x00,0x00,
-    0x02,0x00,0x00,0x00,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x66,0x61,
-    0x63,0x74,0x6f,0x72,0x00,0x00,0x00,0x00,0x06,0x00,0x07,0x00,0x01,0x01,0x00,0x00,
-    0x03,0x00,0x00,0x00,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x66,0x61,0x63,
-    0x74,0x6f,0x72,0x00,0x06,0x00,0x05,0x00,0x01,0x01,0x00,0x00,0x04,0x00,0x00,0x00,
-    0x5f,0x70,0x61,0x64,0x30,0x00,0x00,0x00,0x06,0x00,0x05,0x00,0x01,0x01,0x00,0x00,
-    0x05,0x00,0x00,0x00,0x63,0x61,0x6d,0x5f,0x70,0x6f,0x73,0x00,0x06,0x00,0x05,0x00,
-    0x01,0x01,0x00,0x00,0x06,0x00,0x00,0x00,0x5f,0x70,0x61,0x64,0x31,0x00,0x00,0x00,
-    0x05,0x00,0x04,0x00,0x03,0x01,0x00,0x00,0x5f,0x32,0x38,0x31,0x00,0x00,0x00,0x00,
-    0x05,0x00,0x04,0x00,0x0a,0x01,0x00,0x00,0x5f,0x32,0x39,0x35,0x00,0x00,0x00,0x00,
-    0x05,0x00,0x08,0x00,0x0b,0x01,0x00,0x00,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,
-    0x5f,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x74,0x65,0x78,0x00,0x00,
-    0x05,0x00,0x08,0x00,0x0d,0x01,0x00,0x00,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,
-    0x5f,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,0x73,0x6d,0x70,0x00,0x00,
-    0x05,0x00,0x04,0x00,0x12,0x01,0x00,0x00,0x5f,0x33,0x30,0x36,0x00,0x00,0x00,0x00,
-    0x05,0x00,0x04,0x00,0x1c,0x01,0x00,0x00,0x5f,0x33,0x31,0x36,0x00,0x00,0x00,0x00,
-    0x05,0x00,0x04,0x00,0x26,0x01,0x00,0x00,0x5f,0x33,0x38,0x31,0x00,0x00,0x00,0x00,
-    0x05,0x00,0x05,0x00,0x28,0x01,0x00,0x00,0x76,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,
-    0x74,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x2a,0x01,0x00,0x00,0x76,0x5f,0x62,0x69,
-    0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x00,0x05,0x00,0x05,0x00,0x2c,0x01,0x00,0x00,
-    0x76,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,
-    0x3c,0x01,0x00,0x00,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x74,0x65,0x78,0x00,0x00,
-    0x05,0x00,0x05,0x00,0x3e,0x01,0x00,0x00,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x73,
-    0x6d,0x70,0x00,0x00,0x05,0x00,0x04,0x00,0x48,0x01,0x00,0x00,0x5f,0x33,0x38,0x39,
-    0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x4d,0x01,0x00,0x00,0x76,0x5f,0x77,0x6f,
-    0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x00,0x05,0x00,0x04,0x00,0x51,0x01,0x00,0x00,
-    0x5f,0x33,0x39,0x39,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x56,0x01,0x00,0x00,
-    0x5f,0x34,0x30,0x33,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x59,0x01,0x00,0x00,
-    0x5f,0x34,0x30,0x36,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x5f,0x01,0x00,0x00,
-    0x5f,0x34,0x31,0x31,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x62,0x01,0x00,0x00,
-    0x5f,0x34,0x31,0x32,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x66,0x01,0x00,0x00,
-    0x5f,0x34,0x32,0x30,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x6c,0x01,0x00,0x00,
-    0x5f,0x34,0x32,0x35,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x70,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x75,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x00,0x05,0x00,0x04,0x00,0x77,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x00,0x05,0x00,0x04,0x00,0x79,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x00,0x05,0x00,0x04,0x00,0x7b,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x00,0x05,0x00,0x04,0x00,0x7d,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x00,0x05,0x00,0x04,0x00,0x82,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x00,0x05,0x00,0x04,0x00,0x84,0x01,0x00,0x00,
-    0x5f,0x34,0x36,0x30,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x85,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x87,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x8a,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x00,0x05,0x00,0x04,0x00,0x8c,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x00,0x05,0x00,0x04,0x00,0x8e,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x00,0x05,0x00,0x05,0x00,0x92,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,
-    0x94,0x01,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x00,0x00,0x00,0x00,
-    0x05,0x00,0x05,0x00,0x96,0x01,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,
-    0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x98,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x31,0x33,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x9a,0x01,0x00,0x00,
-    0x5f,0x35,0x30,0x37,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x9b,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x9d,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x9f,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xa2,0x01,0x00,0x00,
-    0x5f,0x35,0x35,0x35,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0xa3,0x01,0x00,0x00,
-    0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,
-    0xa5,0x01,0x00,0x00,0x62,0x72,0x64,0x66,0x5f,0x6c,0x75,0x74,0x5f,0x73,0x6d,0x70,
-    0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0xac,0x01,0x00,0x00,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x31,0x34,0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0xb3,0x01,0x00,0x00,
-    0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5f,0x6d,0x61,0x70,0x00,0x00,
-    0x05,0x00,0x06,0x00,0xb5,0x01,0x00,0x00,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,
-    0x63,0x65,0x5f,0x73,0x6d,0x70,0x00,0x00,0x05,0x00,0x06,0x00,0xc1,0x01,0x00,0x00,
-    0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,0x72,0x5f,0x6d,0x61,0x70,0x00,0x00,0x00,
-    0x05,0x00,0x06,0x00,0xc3,0x01,0x00,0x00,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,0x65,
-    0x72,0x5f,0x73,0x6d,0x70,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0xdb,0x01,0x00,0x00,
-    0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x5f,0x74,0x65,0x78,0x00,0x00,0x00,
-    0x05,0x00,0x06,0x00,0xdd,0x01,0x00,0x00,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,
-    0x6e,0x5f,0x73,0x6d,0x70,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xe9,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xeb,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xed,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xef,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xf5,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xf7,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xfa,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xfc,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0xfe,0x01,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0x07,0x02,0x00,0x00,
-    0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x74,0x65,0x78,0x00,0x00,0x00,0x00,
-    0x05,0x00,0x06,0x00,0x09,0x02,0x00,0x00,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,
-    0x5f,0x73,0x6d,0x70,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x14,0x02,0x00,0x00,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x35,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,
-    0x15,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,0x05,0x00,0x05,0x00,
-    0x19,0x02,0x00,0x00,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x00,0x00,
-    0x05,0x00,0x04,0x00,0x1a,0x02,0x00,0x00,0x70,0x61,0x72,0x61,0x6d,0x00,0x00,0x00,
-    0x47,0x00,0x04,0x00,0xf4,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x47,0x00,0x04,0x00,0xf4,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-    0x47,0x00,0x04,0x00,0xf8,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-    0x47,0x00,0x04,0x00,0xf8,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-    0x47,0x00,0x04,0x00,0xfe,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
-    0x47,0x00,0x03,0x00,0x01,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
-    0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x48,0x00,0x05,0x00,0x01,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
-    0x10,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x01,0x01,0x00,0x00,0x02,0x00,0x00,0x00,
-    0x23,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x01,0x01,0x00,0x00,
-    0x03,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
-    0x01,0x01,0x00,0x00,0x04,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,
-    0x48,0x00,0x05,0x00,0x01,0x01,0x00,0x00,0x05,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
-    0x30,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x01,0x01,0x00,0x00,0x06,0x00,0x00,0x00,
-    0x23,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x03,0x01,0x00,0x00,
-    0x21,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x03,0x01,0x00,0x00,
-    0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x0b,0x01,0x00,0x00,
-    0x21,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x0b,0x01,0x00,0x00,
-    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x0d,0x01,0x00,0x00,
-    0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x0d,0x01,0x00,0x00,
-    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x28,0x01,0x00,0x00,
-    0x1e,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x2a,0x01,0x00,0x00,
-    0x1e,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x2c,0x01,0x00,0x00,
-    0x1e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x3c,0x01,0x00,0x00,
-    0x21,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x3c,0x01,0x00,0x00,
-    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x3e,0x01,0x00,0x00,
-    0x21,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x3e,0x01,0x00,0x00,
-    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x4d,0x01,0x00,0x00,
-    0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xa3,0x01,0x00,0x00,
-    0x21,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xa3,0x01,0x00,0x00,
-    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xa5,0x01,0x00,0x00,
-    0x21,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xa5,0x01,0x00,0x00,
-    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xb3,0x01,0x00,0x00,
-    0x21,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xb3,0x01,0x00,0x00,
-    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xb5,0x01,0x00,0x00,
-    0x21,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xb5,0x01,0x00,0x00,
-    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xc1,0x01,0x00,0x00,
-    0x21,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xc1,0x01,0x00,0x00,
-    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xc3,0x01,0x00,0x00,
-    0x21,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xc3,0x01,0x00,0x00,
-    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xdb,0x01,0x00,0x00,
-    0x21,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xdb,0x01,0x00,0x00,
-    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xdd,0x01,0x00,0x00,
-    0x21,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0xdd,0x01,0x00,0x00,
-    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x07,0x02,0x00,0x00,
-    0x21,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x07,0x02,0x00,0x00,
-    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x09,0x02,0x00,0x00,
-    0x21,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x09,0x02,0x00,0x00,
-    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x19,0x02,0x00,0x00,
-    0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x02,0x00,0x02,0x00,0x00,0x00,
-    0x21,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x16,0x00,0x03,0x00,
-    0x06,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x21,0x00,0x05,0x00,0x08,0x00,0x00,0x00,
-    0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x21,0x00,0x06,0x00,
-    0x0d,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x21,0x00,0x04,0x00,0x13,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x17,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
-    0x03,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
-    0x17,0x00,0x00,0x00,0x21,0x00,0x05,0x00,0x19,0x00,0x00,0x00,0x17,0x00,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x21,0x00,0x07,0x00,0x1e,0x00,0x00,0x00,
-    0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x21,0x00,0x06,0x00,0x25,0x00,0x00,0x00,0x17,0x00,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x21,0x00,0x04,0x00,
-    0x2b,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x80,0x3f,0x2b,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x44,0x00,0x00,0x00,0xdb,0x0f,0x49,0x40,0x2b,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x57,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x2b,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x6d,0x00,0x00,0x00,0x17,0xb7,0xd1,0x38,0x2b,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x75,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x06,0x00,
-    0x17,0x00,0x00,0x00,0x85,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,
-    0x3f,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x92,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x40,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xac,0x00,0x00,0x00,
-    0x53,0x89,0x29,0x3f,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xc5,0x00,0x00,0x00,
-    0xd7,0xa3,0x20,0x40,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xc7,0x00,0x00,0x00,
-    0x8f,0xc2,0xf5,0x3c,0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0xc8,0x00,0x00,0x00,
-    0xc7,0x00,0x00,0x00,0xc7,0x00,0x00,0x00,0xc7,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0xcd,0x00,0x00,0x00,0x1f,0x85,0x1b,0x40,0x2b,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0xcf,0x00,0x00,0x00,0x3d,0x0a,0x17,0x3f,0x2c,0x00,0x06,0x00,
-    0x17,0x00,0x00,0x00,0xd0,0x00,0x00,0x00,0xcf,0x00,0x00,0x00,0xcf,0x00,0x00,0x00,
-    0xcf,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xd3,0x00,0x00,0x00,
-    0x29,0x5c,0x0f,0x3e,0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0xd4,0x00,0x00,0x00,
-    0xd3,0x00,0x00,0x00,0xd3,0x00,0x00,0x00,0xd3,0x00,0x00,0x00,0x2c,0x00,0x06,0x00,
-    0x17,0x00,0x00,0x00,0xd7,0x00,0x00,0x00,0x75,0x00,0x00,0x00,0x75,0x00,0x00,0x00,
-    0x75,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xdc,0x00,0x00,0x00,
-    0x52,0xb8,0x4e,0x41,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,
-    0x55,0x55,0xd5,0x3e,0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0xe1,0x00,0x00,0x00,
-    0xe0,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0xe3,0x00,0x00,0x00,0x3d,0x0a,0x87,0x3f,0x2b,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0xe5,0x00,0x00,0x00,0xae,0x47,0x61,0x3d,0x2c,0x00,0x06,0x00,
-    0x17,0x00,0x00,0x00,0xe6,0x00,0x00,0x00,0xe5,0x00,0x00,0x00,0xe5,0x00,0x00,0x00,
-    0xe5,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xe8,0x00,0x00,0x00,
-    0x1c,0x2e,0x4d,0x3b,0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0xe9,0x00,0x00,0x00,
-    0xe8,0x00,0x00,0x00,0xe8,0x00,0x00,0x00,0xe8,0x00,0x00,0x00,0x17,0x00,0x04,0x00,
-    0xef,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
-    0xf0,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0xef,0x00,0x00,0x00,0x19,0x00,0x09,0x00,
-    0xf2,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x20,0x00,0x04,0x00,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf2,0x00,0x00,0x00,
-    0x3b,0x00,0x04,0x00,0xf3,0x00,0x00,0x00,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x1a,0x00,0x02,0x00,0xf6,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0xf7,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xf6,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xf7,0x00,0x00,0x00,
-    0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x00,0x03,0x00,0xfa,0x00,0x00,0x00,
-    0xf2,0x00,0x00,0x00,0x17,0x00,0x04,0x00,0xfc,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
-    0x02,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0xfd,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-    0xfc,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xfd,0x00,0x00,0x00,0xfe,0x00,0x00,0x00,
-    0x01,0x00,0x00,0x00,0x1e,0x00,0x09,0x00,0x01,0x01,0x00,0x00,0xef,0x00,0x00,0x00,
-    0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
-    0x17,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x02,0x01,0x00,0x00,
-    0x02,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x3b,0x00,0x04,0x00,0x02,0x01,0x00,0x00,
-    0x03,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x15,0x00,0x04,0x00,0x04,0x01,0x00,0x00,
-    0x20,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x04,0x01,0x00,0x00,
-    0x05,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x06,0x01,0x00,0x00,
-    0x02,0x00,0x00,0x00,0xef,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xf3,0x00,0x00,0x00,
-    0x0b,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xf7,0x00,0x00,0x00,
-    0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x04,0x00,0x13,0x01,0x00,0x00,
-    0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x13,0x01,0x00,0x00,
-    0x14,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x04,0x01,0x00,0x00,
-    0x17,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x18,0x01,0x00,0x00,
-    0x02,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x13,0x01,0x00,0x00,
-    0x1d,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x04,0x01,0x00,0x00,
-    0x20,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0x24,0x01,0x00,0x00,0x0a,0xd7,0x23,0x3d,0x20,0x00,0x04,0x00,0x27,0x01,0x00,0x00,
-    0x01,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x27,0x01,0x00,0x00,
-    0x28,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x27,0x01,0x00,0x00,
-    0x2a,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x27,0x01,0x00,0x00,
-    0x2c,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x18,0x00,0x04,0x00,0x2e,0x01,0x00,0x00,
-    0x17,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xf3,0x00,0x00,0x00,
-    0x3c,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xf7,0x00,0x00,0x00,
-    0x3e,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x04,0x01,0x00,0x00,
-    0x49,0x01,0x00,0x00,0x05,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x4a,0x01,0x00,0x00,
-    0x02,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x27,0x01,0x00,0x00,
-    0x4d,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,
-    0x5a,0x01,0x00,0x00,0x24,0x01,0x00,0x00,0x24,0x01,0x00,0x00,0x24,0x01,0x00,0x00,
-    0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x68,0x01,0x00,0x00,0x3a,0xcd,0x13,0x3f,
-    0x2c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0x69,0x01,0x00,0x00,0x68,0x01,0x00,0x00,
-    0x68,0x01,0x00,0x00,0x68,0x01,0x00,0x00,0x3b,0x00,0x04,0x00,0xf3,0x00,0x00,0x00,
-    0xa3,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xf7,0x00,0x00,0x00,
-    0xa5,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x00,0x09,0x00,0xb1,0x01,0x00,0x00,
-    0x06,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
-    0xb2,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xb1,0x01,0x00,0x00,0x3b,0x00,0x04,0x00,
-    0xb2,0x01,0x00,0x00,0xb3,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
-    0xf7,0x00,0x00,0x00,0xb5,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x00,0x03,0x00,
-    0xb7,0x01,0x00,0x00,0xb1,0x01,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0xbe,0x01,0x00,0x00,0x9a,0x99,0x99,0x3e,0x3b,0x00,0x04,0x00,0xb2,0x01,0x00,0x00,
-    0xc1,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xf7,0x00,0x00,0x00,
-    0xc3,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0xcb,0x01,0x00,0x00,0x00,0x00,0x80,0x40,0x2b,0x00,0x04,0x00,0x13,0x01,0x00,0x00,
-    0xd0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xf3,0x00,0x00,0x00,
-    0xdb,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xf7,0x00,0x00,0x00,
-    0xdd,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xf3,0x00,0x00,0x00,
-    0x07,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xf7,0x00,0x00,0x00,
-    0x09,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x04,0x01,0x00,0x00,
-    0x0f,0x02,0x00,0x00,0x03,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x18,0x02,0x00,0x00,
-    0x03,0x00,0x00,0x00,0xef,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x02,0x00,0x00,
-    0x19,0x02,0x00,0x00,0x03,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x13,0x01,0x00,0x00,
-    0x1d,0x02,0x00,0x00,0x03,0x00,0x00,0x00,0x36,0x00,0x05,0x00,0x02,0x00,0x00,0x00,
-    0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,
-    0x05,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xf0,0x00,0x00,0x00,0xf1,0x00,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xf0,0x00,0x00,0x00,0x0a,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x12,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x1c,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x26,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x48,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x51,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x56,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x59,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x5f,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x62,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x66,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x6c,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x70,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x75,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x77,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x79,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x7b,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x7d,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x82,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x84,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x85,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x87,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x8a,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x8c,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x8e,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x92,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x94,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x96,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x98,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x9a,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x9b,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x9d,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x9f,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0xf0,0x00,0x00,0x00,0xa2,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0xac,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xe9,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xeb,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xed,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xef,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xf5,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xf7,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xfa,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xfc,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0xfe,0x01,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x14,0x02,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x15,0x02,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x1a,0x02,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0xf2,0x00,0x00,0x00,0xf5,0x00,0x00,0x00,
-    0xf4,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0xf6,0x00,0x00,0x00,0xf9,0x00,0x00,0x00,
-    0xf8,0x00,0x00,0x00,0x56,0x00,0x05,0x00,0xfa,0x00,0x00,0x00,0xfb,0x00,0x00,0x00,
-    0xf5,0x00,0x00,0x00,0xf9,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0xfc,0x00,0x00,0x00,
-    0xff,0x00,0x00,0x00,0xfe,0x00,0x00,0x00,0x57,0x00,0x05,0x00,0xef,0x00,0x00,0x00,
-    0x00,0x01,0x00,0x00,0xfb,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
-    0x06,0x01,0x00,0x00,0x07,0x01,0x00,0x00,0x03,0x01,0x00,0x00,0x05,0x01,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0xef,0x00,0x00,0x00,0x08,0x01,0x00,0x00,0x07,0x01,0x00,0x00,
-    0x85,0x00,0x05,0x00,0xef,0x00,0x00,0x00,0x09,0x01,0x00,0x00,0x00,0x01,0x00,0x00,
-    0x08,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0xf1,0x00,0x00,0x00,0x09,0x01,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0xf2,0x00,0x00,0x00,0x0c,0x01,0x00,0x00,0x0b,0x01,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0xf6,0x00,0x00,0x00,0x0e,0x01,0x00,0x00,0x0d,0x01,0x00,0x00,
-    0x56,0x00,0x05,0x00,0xfa,0x00,0x00,0x00,0x0f,0x01,0x00,0x00,0x0c,0x01,0x00,0x00,
-    0x0e,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0xfc,0x00,0x00,0x00,0x10,0x01,0x00,0x00,
-    0xfe,0x00,0x00,0x00,0x57,0x00,0x05,0x00,0xef,0x00,0x00,0x00,0x11,0x01,0x00,0x00,
-    0x0f,0x01,0x00,0x00,0x10,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x0a,0x01,0x00,0x00,
-    0x11,0x01,0x00,0x00,0x41,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x15,0x01,0x00,0x00,
-    0x0a,0x01,0x00,0x00,0x14,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0x16,0x01,0x00,0x00,0x15,0x01,0x00,0x00,0x41,0x00,0x05,0x00,0x18,0x01,0x00,0x00,
-    0x19,0x01,0x00,0x00,0x03,0x01,0x00,0x00,0x17,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x1a,0x01,0x00,0x00,0x19,0x01,0x00,0x00,0x85,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0x1b,0x01,0x00,0x00,0x16,0x01,0x00,0x00,0x1a,0x01,0x00,0x00,
-    0x3e,0x00,0x03,0x00,0x12,0x01,0x00,0x00,0x1b,0x01,0x00,0x00,0x41,0x00,0x05,0x00,
-    0x07,0x00,0x00,0x00,0x1e,0x01,0x00,0x00,0x0a,0x01,0x00,0x00,0x1d,0x01,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x1f,0x01,0x00,0x00,0x1e,0x01,0x00,0x00,
-    0x41,0x00,0x05,0x00,0x18,0x01,0x00,0x00,0x21,0x01,0x00,0x00,0x03,0x01,0x00,0x00,
-    0x20,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
-    0x21,0x01,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x23,0x01,0x00,0x00,
-    0x1f,0x01,0x00,0x00,0x22,0x01,0x00,0x00,0x0c,0x00,0x08,0x00,0x06,0x00,0x00,0x00,
-    0x25,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x23,0x01,0x00,0x00,
-    0x24,0x01,0x00,0x00,0x3f,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x1c,0x01,0x00,0x00,
-    0x25,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x29,0x01,0x00,0x00,
-    0x28,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x2b,0x01,0x00,0x00,
-    0x2a,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x2d,0x01,0x00,0x00,
-    0x2c,0x01,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x2f,0x01,0x00,0x00,
-    0x29,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-    0x30,0x01,0x00,0x00,0x29,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0x31,0x01,0x00,0x00,0x29,0x01,0x00,0x00,0x02,0x00,0x00,0x00,
-    0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x32,0x01,0x00,0x00,0x2b,0x01,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x33,0x01,0x00,0x00,
-    0x2b,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-    0x34,0x01,0x00,0x00,0x2b,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0x35,0x01,0x00,0x00,0x2d,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x36,0x01,0x00,0x00,0x2d,0x01,0x00,0x00,
-    0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x37,0x01,0x00,0x00,
-    0x2d,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x50,0x00,0x06,0x00,0x17,0x00,0x00,0x00,
-    0x38,0x01,0x00,0x00,0x2f,0x01,0x00,0x00,0x30,0x01,0x00,0x00,0x31,0x01,0x00,0x00,
-    0x50,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0x39,0x01,0x00,0x00,0x32,0x01,0x00,0x00,
-    0x33,0x01,0x00,0x00,0x34,0x01,0x00,0x00,0x50,0x00,0x06,0x00,0x17,0x00,0x00,0x00,
-    0x3a,0x01,0x00,0x00,0x35,0x01,0x00,0x00,0x36,0x01,0x00,0x00,0x37,0x01,0x00,0x00,
-    0x50,0x00,0x06,0x00,0x2e,0x01,0x00,0x00,0x3b,0x01,0x00,0x00,0x38,0x01,0x00,0x00,
-    0x39,0x01,0x00,0x00,0x3a,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0xf2,0x00,0x00,0x00,
-    0x3d,0x01,0x00,0x00,0x3c,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0xf6,0x00,0x00,0x00,
-    0x3f,0x01,0x00,0x00,0x3e,0x01,0x00,0x00,0x56,0x00,0x05,0x00,0xfa,0x00,0x00,0x00,
-    0x40,0x01,0x00,0x00,0x3d,0x01,0x00,0x00,0x3f,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0xfc,0x00,0x00,0x00,0x41,0x01,0x00,0x00,0xfe,0x00,0x00,0x00,0x57,0x00,0x05,0x00,
-    0xef,0x00,0x00,0x00,0x42,0x01,0x00,0x00,0x40,0x01,0x00,0x00,0x41,0x01,0x00,0x00,
-    0x4f,0x00,0x08,0x00,0x17,0x00,0x00,0x00,0x43,0x01,0x00,0x00,0x42,0x01,0x00,0x00,
-    0x42,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
-    0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x44,0x01,0x00,0x00,0x43,0x01,0x00,0x00,
-    0x92,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x45,0x01,0x00,0x00,
-    0x44,0x01,0x00,0x00,0x85,0x00,0x00,0x00,0x91,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
-    0x46,0x01,0x00,0x00,0x3b,0x01,0x00,0x00,0x45,0x01,0x00,0x00,0x0c,0x00,0x06,0x00,
-    0x17,0x00,0x00,0x00,0x47,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x45,0x00,0x00,0x00,
-    0x46,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x26,0x01,0x00,0x00,0x47,0x01,0x00,0x00,
-    0x41,0x00,0x05,0x00,0x4a,0x01,0x00,0x00,0x4b,0x01,0x00,0x00,0x03,0x01,0x00,0x00,
-    0x49,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x4c,0x01,0x00,0x00,
-    0x4b,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x4e,0x01,0x00,0x00,
-    0x4d,0x01,0x00,0x00,0x83,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x4f,0x01,0x00,0x00,
-    0x4c,0x01,0x00,0x00,0x4e,0x01,0x00,0x00,0x0c,0x00,0x06,0x00,0x17,0x00,0x00,0x00,
-    0x50,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x4f,0x01,0x00,0x00,
-    0x3e,0x00,0x03,0x00,0x48,0x01,0x00,0x00,0x50,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x17,0x00,0x00,0x00,0x52,0x01,0x00,0x00,0x26,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x17,0x00,0x00,0x00,0x53,0x01,0x00,0x00,0x48,0x01,0x00,0x00,0x94,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0x54,0x01,0x00,0x00,0x52,0x01,0x00,0x00,0x53,0x01,0x00,0x00,
-    0x0c,0x00,0x07,0x00,0x06,0x00,0x00,0x00,0x55,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
-    0x28,0x00,0x00,0x00,0x54,0x01,0x00,0x00,0x6d,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
-    0x51,0x01,0x00,0x00,0x55,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0xef,0x00,0x00,0x00,
-    0x57,0x01,0x00,0x00,0xf1,0x00,0x00,0x00,0x4f,0x00,0x08,0x00,0x17,0x00,0x00,0x00,
-    0x58,0x01,0x00,0x00,0x57,0x01,0x00,0x00,0x57,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x56,0x01,0x00,0x00,
-    0x58,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x5b,0x01,0x00,0x00,
-    0x56,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x5c,0x01,0x00,0x00,
-    0x12,0x01,0x00,0x00,0x50,0x00,0x06,0x00,0x17,0x00,0x00,0x00,0x5d,0x01,0x00,0x00,
-    0x5c,0x01,0x00,0x00,0x5c,0x01,0x00,0x00,0x5c,0x01,0x00,0x00,0x0c,0x00,0x08,0x00,
-    0x17,0x00,0x00,0x00,0x5e,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,
-    0x5a,0x01,0x00,0x00,0x5b,0x01,0x00,0x00,0x5d,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
-    0x59,0x01,0x00,0x00,0x5e,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0x60,0x01,0x00,0x00,0x12,0x01,0x00,0x00,0x83,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-    0x61,0x01,0x00,0x00,0x3f,0x00,0x00,0x00,0x60,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
-    0x5f,0x01,0x00,0x00,0x61,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
-    0x63,0x01,0x00,0x00,0x56,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0x64,0x01,0x00,0x00,0x5f,0x01,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
-    0x65,0x01,0x00,0x00,0x63,0x01,0x00,0x00,0x64,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
-    0x62,0x01,0x00,0x00,0x65,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
-    0x67,0x01,0x00,0x00,0x48,0x01,0x00,0x00,0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
-    0x6a,0x01,0x00,0x00,0x67,0x01,0x00,0x00,0x69,0x01,0x00,0x00,0x0c,0x00,0x06,0x00,
-    0x17,0x00,0x00,0x00,0x6b,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x45,0x00,0x00,0x00,
-    0x6a,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x66,0x01,0x00,0x00,0x6b,0x01,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x6d,0x01,0x00,0x00,0x26,0x01,0x00,0x00,
-    0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x6e,0x01,0x00,0x00,0x6d,0x01,0x00,0x00,
-    0x69,0x01,0x00,0x00,0x0c,0x00,0x07,0x00,0x06,0x00,0x00,0x00,0x6f,0x01,0x00,0x00,
-    0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x6e,0x01,0x00,0x00,0x6d,0x00,0x00,0x00,
-    0x3e,0x00,0x03,0x00,0x6c,0x01,0x00,0x00,0x6f,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x17,0x00,0x00,0x00,0x71,0x01,0x00,0x00,0x26,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x17,0x00,0x00,0x00,0x72,0x01,0x00,0x00,0x66,0x01,0x00,0x00,0x94,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0x73,0x01,0x00,0x00,0x71,0x01,0x00,0x00,0x72,0x01,0x00,0x00,
-    0x0c,0x00,0x07,0x00,0x06,0x00,0x00,0x00,0x74,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
-    0x28,0x00,0x00,0x00,0x73,0x01,0x00,0x00,0x75,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
-    0x70,0x01,0x00,0x00,0x74,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0x76,0x01,0x00,0x00,0x1c,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x75,0x01,0x00,0x00,
-    0x76,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x78,0x01,0x00,0x00,
-    0x51,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x77,0x01,0x00,0x00,0x78,0x01,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x7a,0x01,0x00,0x00,0x6c,0x01,0x00,0x00,
-    0x3e,0x00,0x03,0x00,0x79,0x01,0x00,0x00,0x7a,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x7c,0x01,0x00,0x00,0x1c,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
-    0x7b,0x01,0x00,0x00,0x7c,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
-    0x7e,0x01,0x00,0x00,0x48,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
-    0x7f,0x01,0x00,0x00,0x66,0x01,0x00,0x00,0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-    0x80,0x01,0x00,0x00,0x7e,0x01,0x00,0x00,0x7f,0x01,0x00,0x00,0x0c,0x00,0x07,0x00,
-    0x06,0x00,0x00,0x00,0x81,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,
-    0x80,0x01,0x00,0x00,0x75,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x7d,0x01,0x00,0x00,
-    0x81,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x83,0x01,0x00,0x00,
-    0x59,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x82,0x01,0x00,0x00,0x83,0x01,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x86,0x01,0x00,0x00,0x7d,0x01,0x00,0x00,
-    0x3e,0x00,0x03,0x00,0x85,0x01,0x00,0x00,0x86,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x17,0x00,0x00,0x00,0x88,0x01,0x00,0x00,0x82,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
-    0x87,0x01,0x00,0x00,0x88,0x01,0x00,0x00,0x39,0x00,0x06,0x00,0x17,0x00,0x00,0x00,
-    0x89,0x01,0x00,0x00,0x1c,0x00,0x00,0x00,0x85,0x01,0x00,0x00,0x87,0x01,0x00,0x00,
-    0x3e,0x00,0x03,0x00,0x84,0x01,0x00,0x00,0x89,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x8b,0x01,0x00,0x00,0x51,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
-    0x8a,0x01,0x00,0x00,0x8b,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0x8d,0x01,0x00,0x00,0x6c,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x8c,0x01,0x00,0x00,
-    0x8d,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x8f,0x01,0x00,0x00,
-    0x66,0x01,0x00,0x00,0x94,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x90,0x01,0x00,0x00,
-    0x69,0x01,0x00,0x00,0x8f,0x01,0x00,0x00,0x0c,0x00,0x07,0x00,0x06,0x00,0x00,0x00,
-    0x91,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x90,0x01,0x00,0x00,
-    0x75,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x8e,0x01,0x00,0x00,0x91,0x01,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x93,0x01,0x00,0x00,0x1c,0x01,0x00,0x00,
-    0x3e,0x00,0x03,0x00,0x92,0x01,0x00,0x00,0x93,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x95,0x01,0x00,0x00,0x51,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
-    0x94,0x01,0x00,0x00,0x95,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
-    0x97,0x01,0x00,0x00,0x59,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x96,0x01,0x00,0x00,
-    0x97,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x99,0x01,0x00,0x00,
-    0x1c,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x98,0x01,0x00,0x00,0x99,0x01,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x9c,0x01,0x00,0x00,0x94,0x01,0x00,0x00,
-    0x3e,0x00,0x03,0x00,0x9b,0x01,0x00,0x00,0x9c,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x17,0x00,0x00,0x00,0x9e,0x01,0x00,0x00,0x96,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
-    0x9d,0x01,0x00,0x00,0x9e,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0xa0,0x01,0x00,0x00,0x98,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x9f,0x01,0x00,0x00,
-    0xa0,0x01,0x00,0x00,0x39,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0xa1,0x01,0x00,0x00,
-    0x29,0x00,0x00,0x00,0x9b,0x01,0x00,0x00,0x9d,0x01,0x00,0x00,0x9f,0x01,0x00,0x00,
-    0x3e,0x00,0x03,0x00,0x9a,0x01,0x00,0x00,0xa1,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0xf2,0x00,0x00,0x00,0xa4,0x01,0x00,0x00,0xa3,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0xf6,0x00,0x00,0x00,0xa6,0x01,0x00,0x00,0xa5,0x01,0x00,0x00,0x56,0x00,0x05,0x00,
-    0xfa,0x00,0x00,0x00,0xa7,0x01,0x00,0x00,0xa4,0x01,0x00,0x00,0xa6,0x01,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xa8,0x01,0x00,0x00,0x51,0x01,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xa9,0x01,0x00,0x00,0x1c,0x01,0x00,0x00,
-    0x50,0x00,0x05,0x00,0xfc,0x00,0x00,0x00,0xaa,0x01,0x00,0x00,0xa8,0x01,0x00,0x00,
-    0xa9,0x01,0x00,0x00,0x57,0x00,0x05,0x00,0xef,0x00,0x00,0x00,0xab,0x01,0x00,0x00,
-    0xa7,0x01,0x00,0x00,0xaa,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0xa2,0x01,0x00,0x00,
-    0xab,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xad,0x01,0x00,0x00,
-    0x9a,0x01,0x00,0x00,0x83,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xae,0x01,0x00,0x00,
-    0x85,0x00,0x00,0x00,0xad,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0xaf,0x01,0x00,0x00,0x5f,0x01,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
-    0xb0,0x01,0x00,0x00,0xae,0x01,0x00,0x00,0xaf,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0xb1,0x01,0x00,0x00,0xb4,0x01,0x00,0x00,0xb3,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0xf6,0x00,0x00,0x00,0xb6,0x01,0x00,0x00,0xb5,0x01,0x00,0x00,0x56,0x00,0x05,0x00,
-    0xb7,0x01,0x00,0x00,0xb8,0x01,0x00,0x00,0xb4,0x01,0x00,0x00,0xb6,0x01,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xb9,0x01,0x00,0x00,0x26,0x01,0x00,0x00,
-    0x57,0x00,0x05,0x00,0xef,0x00,0x00,0x00,0xba,0x01,0x00,0x00,0xb8,0x01,0x00,0x00,
-    0xb9,0x01,0x00,0x00,0x4f,0x00,0x08,0x00,0x17,0x00,0x00,0x00,0xbb,0x01,0x00,0x00,
-    0xba,0x01,0x00,0x00,0xba,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-    0x02,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xbc,0x01,0x00,0x00,
-    0x62,0x01,0x00,0x00,0x85,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xbd,0x01,0x00,0x00,
-    0xbb,0x01,0x00,0x00,0xbc,0x01,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
-    0xbf,0x01,0x00,0x00,0xbd,0x01,0x00,0x00,0xbe,0x01,0x00,0x00,0x85,0x00,0x05,0x00,
-    0x17,0x00,0x00,0x00,0xc0,0x01,0x00,0x00,0xb0,0x01,0x00,0x00,0xbf,0x01,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0xb1,0x01,0x00,0x00,0xc2,0x01,0x00,0x00,0xc1,0x01,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0xf6,0x00,0x00,0x00,0xc4,0x01,0x00,0x00,0xc3,0x01,0x00,0x00,
-    0x56,0x00,0x05,0x00,0xb7,0x01,0x00,0x00,0xc5,0x01,0x00,0x00,0xc2,0x01,0x00,0x00,
-    0xc4,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xc6,0x01,0x00,0x00,
-    0x48,0x01,0x00,0x00,0x7f,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xc7,0x01,0x00,0x00,
-    0xc6,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xc8,0x01,0x00,0x00,
-    0x26,0x01,0x00,0x00,0x0c,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0xc9,0x01,0x00,0x00,
-    0x01,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0xc7,0x01,0x00,0x00,0xc8,0x01,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xca,0x01,0x00,0x00,0x1c,0x01,0x00,0x00,
-    0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xcc,0x01,0x00,0x00,0xca,0x01,0x00,0x00,
-    0xcb,0x01,0x00,0x00,0x58,0x00,0x07,0x00,0xef,0x00,0x00,0x00,0xcd,0x01,0x00,0x00,
-    0xc5,0x01,0x00,0x00,0xc9,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0xcc,0x01,0x00,0x00,
-    0x4f,0x00,0x08,0x00,0x17,0x00,0x00,0x00,0xce,0x01,0x00,0x00,0xcd,0x01,0x00,0x00,
-    0xcd,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xcf,0x01,0x00,0x00,0x9a,0x01,0x00,0x00,
-    0x41,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0xd1,0x01,0x00,0x00,0xa2,0x01,0x00,0x00,
-    0xd0,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xd2,0x01,0x00,0x00,
-    0xd1,0x01,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xd3,0x01,0x00,0x00,
-    0xcf,0x01,0x00,0x00,0xd2,0x01,0x00,0x00,0x41,0x00,0x05,0x00,0x07,0x00,0x00,0x00,
-    0xd4,0x01,0x00,0x00,0xa2,0x01,0x00,0x00,0x1d,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0xd5,0x01,0x00,0x00,0xd4,0x01,0x00,0x00,0x50,0x00,0x06,0x00,
-    0x17,0x00,0x00,0x00,0xd6,0x01,0x00,0x00,0xd5,0x01,0x00,0x00,0xd5,0x01,0x00,0x00,
-    0xd5,0x01,0x00,0x00,0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xd7,0x01,0x00,0x00,
-    0xd3,0x01,0x00,0x00,0xd6,0x01,0x00,0x00,0x85,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
-    0xd8,0x01,0x00,0x00,0xce,0x01,0x00,0x00,0xd7,0x01,0x00,0x00,0x8e,0x00,0x05,0x00,
-    0x17,0x00,0x00,0x00,0xd9,0x01,0x00,0x00,0xd8,0x01,0x00,0x00,0x57,0x00,0x00,0x00,
-    0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xda,0x01,0x00,0x00,0xc0,0x01,0x00,0x00,
-    0xd9,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0xf2,0x00,0x00,0x00,0xdc,0x01,0x00,0x00,
-    0xdb,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0xf6,0x00,0x00,0x00,0xde,0x01,0x00,0x00,
-    0xdd,0x01,0x00,0x00,0x56,0x00,0x05,0x00,0xfa,0x00,0x00,0x00,0xdf,0x01,0x00,0x00,
-    0xdc,0x01,0x00,0x00,0xde,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0xfc,0x00,0x00,0x00,
-    0xe0,0x01,0x00,0x00,0xfe,0x00,0x00,0x00,0x57,0x00,0x05,0x00,0xef,0x00,0x00,0x00,
-    0xe1,0x01,0x00,0x00,0xdf,0x01,0x00,0x00,0xe0,0x01,0x00,0x00,0x51,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0xe2,0x01,0x00,0x00,0xe1,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xe3,0x01,0x00,0x00,0xda,0x01,0x00,0x00,
-    0xe2,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xe4,0x01,0x00,0x00,
-    0x84,0x01,0x00,0x00,0x83,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xe5,0x01,0x00,0x00,
-    0x85,0x00,0x00,0x00,0xe4,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0xe6,0x01,0x00,0x00,0x5f,0x01,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
-    0xe7,0x01,0x00,0x00,0xe5,0x01,0x00,0x00,0xe6,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x17,0x00,0x00,0x00,0xe8,0x01,0x00,0x00,0x62,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0xea,0x01,0x00,0x00,0x8a,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
-    0xe9,0x01,0x00,0x00,0xea,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0xec,0x01,0x00,0x00,0x8c,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0xeb,0x01,0x00,0x00,
-    0xec,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xee,0x01,0x00,0x00,
-    0x8e,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0xed,0x01,0x00,0x00,0xee,0x01,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xf0,0x01,0x00,0x00,0x92,0x01,0x00,0x00,
-    0x3e,0x00,0x03,0x00,0xef,0x01,0x00,0x00,0xf0,0x01,0x00,0x00,0x39,0x00,0x08,0x00,
-    0x06,0x00,0x00,0x00,0xf1,0x01,0x00,0x00,0x23,0x00,0x00,0x00,0xe9,0x01,0x00,0x00,
-    0xeb,0x01,0x00,0x00,0xed,0x01,0x00,0x00,0xef,0x01,0x00,0x00,0x8e,0x00,0x05,0x00,
-    0x17,0x00,0x00,0x00,0xf2,0x01,0x00,0x00,0xe8,0x01,0x00,0x00,0xf1,0x01,0x00,0x00,
-    0x85,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xf3,0x01,0x00,0x00,0xe7,0x01,0x00,0x00,
-    0xf2,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xf4,0x01,0x00,0x00,
-    0x84,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xf6,0x01,0x00,0x00,
-    0x70,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0xf5,0x01,0x00,0x00,0xf6,0x01,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xf8,0x01,0x00,0x00,0x75,0x01,0x00,0x00,
-    0x3e,0x00,0x03,0x00,0xf7,0x01,0x00,0x00,0xf8,0x01,0x00,0x00,0x39,0x00,0x06,0x00,
-    0x06,0x00,0x00,0x00,0xf9,0x01,0x00,0x00,0x0b,0x00,0x00,0x00,0xf5,0x01,0x00,0x00,
-    0xf7,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xfb,0x01,0x00,0x00,
-    0x77,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0xfa,0x01,0x00,0x00,0xfb,0x01,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xfd,0x01,0x00,0x00,0x79,0x01,0x00,0x00,
-    0x3e,0x00,0x03,0x00,0xfc,0x01,0x00,0x00,0xfd,0x01,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0xff,0x01,0x00,0x00,0x7b,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,
-    0xfe,0x01,0x00,0x00,0xff,0x01,0x00,0x00,0x39,0x00,0x07,0x00,0x06,0x00,0x00,0x00,
-    0x00,0x02,0x00,0x00,0x11,0x00,0x00,0x00,0xfa,0x01,0x00,0x00,0xfc,0x01,0x00,0x00,
-    0xfe,0x01,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x01,0x02,0x00,0x00,
-    0xf9,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
-    0x02,0x02,0x00,0x00,0xf4,0x01,0x00,0x00,0x01,0x02,0x00,0x00,0x81,0x00,0x05,0x00,
-    0x17,0x00,0x00,0x00,0x03,0x02,0x00,0x00,0xf3,0x01,0x00,0x00,0x02,0x02,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x04,0x02,0x00,0x00,0x6c,0x01,0x00,0x00,
-    0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x03,0x02,0x00,0x00,
-    0x04,0x02,0x00,0x00,0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x06,0x02,0x00,0x00,
-    0xe3,0x01,0x00,0x00,0x05,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0xf2,0x00,0x00,0x00,
-    0x08,0x02,0x00,0x00,0x07,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0xf6,0x00,0x00,0x00,
-    0x0a,0x02,0x00,0x00,0x09,0x02,0x00,0x00,0x56,0x00,0x05,0x00,0xfa,0x00,0x00,0x00,
-    0x0b,0x02,0x00,0x00,0x08,0x02,0x00,0x00,0x0a,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0xfc,0x00,0x00,0x00,0x0c,0x02,0x00,0x00,0xfe,0x00,0x00,0x00,0x57,0x00,0x05,0x00,
-    0xef,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x0b,0x02,0x00,0x00,0x0c,0x02,0x00,0x00,
-    0x4f,0x00,0x08,0x00,0x17,0x00,0x00,0x00,0x0e,0x02,0x00,0x00,0x0d,0x02,0x00,0x00,
-    0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
-    0x41,0x00,0x05,0x00,0x4a,0x01,0x00,0x00,0x10,0x02,0x00,0x00,0x03,0x01,0x00,0x00,
-    0x0f,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x11,0x02,0x00,0x00,
-    0x10,0x02,0x00,0x00,0x85,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x12,0x02,0x00,0x00,
-    0x0e,0x02,0x00,0x00,0x11,0x02,0x00,0x00,0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
-    0x13,0x02,0x00,0x00,0x06,0x02,0x00,0x00,0x12,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,
-    0xac,0x01,0x00,0x00,0x13,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
-    0x16,0x02,0x00,0x00,0xac,0x01,0x00,0x00,0x3e,0x00,0x03,0x00,0x15,0x02,0x00,0x00,
-    0x16,0x02,0x00,0x00,0x39,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x17,0x02,0x00,0x00,
-    0x2d,0x00,0x00,0x00,0x15,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0x14,0x02,0x00,0x00,
-    0x17,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x1b,0x02,0x00,0x00,
-    0x14,0x02,0x00,0x00,0x3e,0x00,0x03,0x00,0x1a,0x02,0x00,0x00,0x1b,0x02,0x00,0x00,
-    0x39,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x1c,0x02,0x00,0x00,0x30,0x00,0x00,0x00,
-    0x1a,0x02,0x00,0x00,0x41,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x1e,0x02,0x00,0x00,
-    0xf1,0x00,0x00,0x00,0x1d,0x02,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0x1f,0x02,0x00,0x00,0x1e,0x02,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-    0x20,0x02,0x00,0x00,0x1c,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0x21,0x02,0x00,0x00,0x1c,0x02,0x00,0x00,0x01,0x00,0x00,0x00,
-    0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x1c,0x02,0x00,0x00,
-    0x02,0x00,0x00,0x00,0x50,0x00,0x07,0x00,0xef,0x00,0x00,0x00,0x23,0x02,0x00,0x00,
-    0x20,0x02,0x00,0x00,0x21,0x02,0x00,0x00,0x22,0x02,0x00,0x00,0x1f,0x02,0x00,0x00,
-    0x3e,0x00,0x03,0x00,0x19,0x02,0x00,0x00,0x23,0x02,0x00,0x00,0xfd,0x00,0x01,0x00,
-    0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,
-    0x09,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
-    0xf8,0x00,0x02,0x00,0x0c,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
-    0x32,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
-    0x36,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
-    0x3a,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0x33,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0x34,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-    0x35,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
-    0x32,0x00,0x00,0x00,0x35,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0x37,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0x38,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-    0x39,0x00,0x00,0x00,0x37,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
-    0x36,0x00,0x00,0x00,0x39,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0x3b,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0x3c,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-    0x3d,0x00,0x00,0x00,0x3b,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,
-    0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,
-    0x40,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x42,0x00,0x00,0x00,
-    0x41,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x3a,0x00,0x00,0x00,
-    0x42,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x43,0x00,0x00,0x00,
-    0x36,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x45,0x00,0x00,0x00,
-    0x3a,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x46,0x00,0x00,0x00,
-    0x44,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0x47,0x00,0x00,0x00,0x3a,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-    0x48,0x00,0x00,0x00,0x46,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0x88,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0x49,0x00,0x00,0x00,0x43,0x00,0x00,0x00,0x48,0x00,0x00,0x00,
-    0xfe,0x00,0x02,0x00,0x49,0x00,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,
-    0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
-    0x07,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,
-    0x10,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x12,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
-    0x07,0x00,0x00,0x00,0x4c,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
-    0x07,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
-    0x07,0x00,0x00,0x00,0x54,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x4d,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x4e,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x85,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0x4d,0x00,0x00,0x00,0x4e,0x00,0x00,0x00,
-    0x3e,0x00,0x03,0x00,0x4c,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x51,0x00,0x00,0x00,0x4c,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x52,0x00,0x00,0x00,0x4c,0x00,0x00,0x00,0x85,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0x53,0x00,0x00,0x00,0x51,0x00,0x00,0x00,0x52,0x00,0x00,0x00,
-    0x3e,0x00,0x03,0x00,0x50,0x00,0x00,0x00,0x53,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x55,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0x56,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x55,0x00,0x00,0x00,
-    0x3e,0x00,0x03,0x00,0x54,0x00,0x00,0x00,0x56,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x85,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x54,0x00,0x00,0x00,
-    0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,
-    0x5c,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x5e,0x00,0x00,0x00,
-    0x50,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,
-    0x5d,0x00,0x00,0x00,0x5e,0x00,0x00,0x00,0x0c,0x00,0x06,0x00,0x06,0x00,0x00,0x00,
-    0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,
-    0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x58,0x00,0x00,0x00,
-    0x60,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x62,0x00,0x00,0x00,
-    0x0e,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x63,0x00,0x00,0x00,
-    0x0f,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x64,0x00,0x00,0x00,
-    0x0f,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x65,0x00,0x00,0x00,
-    0x63,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0x66,0x00,0x00,0x00,0x54,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-    0x67,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x66,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x68,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x81,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0x69,0x00,0x00,0x00,0x67,0x00,0x00,0x00,0x68,0x00,0x00,0x00,
-    0x0c,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x6a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-    0x1f,0x00,0x00,0x00,0x69,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-    0x6b,0x00,0x00,0x00,0x62,0x00,0x00,0x00,0x6a,0x00,0x00,0x00,0x81,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0x6c,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x6b,0x00,0x00,0x00,
-    0x0c,0x00,0x07,0x00,0x06,0x00,0x00,0x00,0x6e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-    0x28,0x00,0x00,0x00,0x6c,0x00,0x00,0x00,0x6d,0x00,0x00,0x00,0x88,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0x6f,0x00,0x00,0x00,0x57,0x00,0x00,0x00,0x6e,0x00,0x00,0x00,
-    0xfe,0x00,0x02,0x00,0x6f,0x00,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x00,0x00,
-    0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,
-    0x16,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x72,0x00,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x77,0x00,0x00,0x00,
-    0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x73,0x00,0x00,0x00,
-    0x14,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x74,0x00,0x00,0x00,
-    0x3f,0x00,0x00,0x00,0x73,0x00,0x00,0x00,0x0c,0x00,0x08,0x00,0x06,0x00,0x00,0x00,
-    0x76,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x74,0x00,0x00,0x00,
-    0x75,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x72,0x00,0x00,0x00,
-    0x76,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x78,0x00,0x00,0x00,
-    0x72,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x79,0x00,0x00,0x00,
-    0x72,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x7a,0x00,0x00,0x00,
-    0x78,0x00,0x00,0x00,0x79,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x77,0x00,0x00,0x00,
-    0x7a,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x7b,0x00,0x00,0x00,
-    0x77,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,
-    0x77,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x7d,0x00,0x00,0x00,
-    0x7b,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0x7e,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-    0x7f,0x00,0x00,0x00,0x7d,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,0xfe,0x00,0x02,0x00,
-    0x7f,0x00,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
-    0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
-    0x07,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x18,0x00,0x00,0x00,
-    0x1b,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x1d,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
-    0x07,0x00,0x00,0x00,0x82,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
-    0x07,0x00,0x00,0x00,0x88,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x83,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
-    0x82,0x00,0x00,0x00,0x83,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
-    0x84,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
-    0x86,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
-    0x87,0x00,0x00,0x00,0x85,0x00,0x00,0x00,0x86,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x89,0x00,0x00,0x00,0x82,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
-    0x88,0x00,0x00,0x00,0x89,0x00,0x00,0x00,0x39,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-    0x8a,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x88,0x00,0x00,0x00,0x8e,0x00,0x05,0x00,
-    0x17,0x00,0x00,0x00,0x8b,0x00,0x00,0x00,0x87,0x00,0x00,0x00,0x8a,0x00,0x00,0x00,
-    0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x8c,0x00,0x00,0x00,0x84,0x00,0x00,0x00,
-    0x8b,0x00,0x00,0x00,0xfe,0x00,0x02,0x00,0x8c,0x00,0x00,0x00,0x38,0x00,0x01,0x00,
-    0x36,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x1e,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,
-    0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
-    0x07,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,
-    0x22,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x24,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
-    0x07,0x00,0x00,0x00,0x8f,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
-    0x07,0x00,0x00,0x00,0x9b,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
-    0x07,0x00,0x00,0x00,0x9d,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
-    0x07,0x00,0x00,0x00,0xa0,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
-    0x07,0x00,0x00,0x00,0xa6,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x90,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x0c,0x00,0x08,0x00,
-    0x06,0x00,0x00,0x00,0x91,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,
-    0x75,0x00,0x00,0x00,0x57,0x00,0x00,0x00,0x90,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x93,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x85,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0x94,0x00,0x00,0x00,0x92,0x00,0x00,0x00,0x93,0x00,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x95,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-    0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x96,0x00,0x00,0x00,0x94,0x00,0x00,0x00,
-    0x95,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x97,0x00,0x00,0x00,
-    0x22,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x98,0x00,0x00,0x00,
-    0x96,0x00,0x00,0x00,0x97,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-    0x99,0x00,0x00,0x00,0x91,0x00,0x00,0x00,0x98,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0x9a,0x00,0x00,0x00,0x99,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,
-    0x3e,0x00,0x03,0x00,0x8f,0x00,0x00,0x00,0x9a,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0x9c,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
-    0x9b,0x00,0x00,0x00,0x9c,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0x9e,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x9d,0x00,0x00,0x00,
-    0x9e,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x9f,0x00,0x00,0x00,
-    0x8f,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xa1,0x00,0x00,0x00,
-    0x9b,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xa0,0x00,0x00,0x00,0xa1,0x00,0x00,0x00,
-    0x39,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xa2,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
-    0xa0,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xa3,0x00,0x00,0x00,
-    0x9f,0x00,0x00,0x00,0xa2,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-    0xa4,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0xa3,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0xa5,0x00,0x00,0x00,0x8f,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x06,0x00,0x00,0x00,0xa7,0x00,0x00,0x00,0x9d,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
-    0xa6,0x00,0x00,0x00,0xa7,0x00,0x00,0x00,0x39,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-    0xa8,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0xa6,0x00,0x00,0x00,0x85,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0xa9,0x00,0x00,0x00,0xa5,0x00,0x00,0x00,0xa8,0x00,0x00,0x00,
-    0x81,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xaa,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,
-    0xa9,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xab,0x00,0x00,0x00,
-    0xa4,0x00,0x00,0x00,0xaa,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0xad,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x0c,0x00,0x08,0x00,0x06,0x00,0x00,0x00,
-    0xae,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,
-    0xac,0x00,0x00,0x00,0xad,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
-    0xaf,0x00,0x00,0x00,0xab,0x00,0x00,0x00,0xae,0x00,0x00,0x00,0xfe,0x00,0x02,0x00,
-    0xaf,0x00,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
-    0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
-    0x07,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x18,0x00,0x00,0x00,
-    0x27,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x28,0x00,0x00,0x00,
-    0xf8,0x00,0x02,0x00,0x2a,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
-    0xb2,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
-    0xbc,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
-    0xb3,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0xb2,0x00,0x00,0x00,
-    0xb3,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xb4,0x00,0x00,0x00,
-    0x27,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xb5,0x00,0x00,0x00,
-    0x28,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0xb6,0x00,0x00,0x00,
-    0x3f,0x00,0x00,0x00,0xb5,0x00,0x00,0x00,0x50,0x00,0x06,0x00,0x17,0x00,0x00,0x00,
-    0xb7,0x00,0x00,0x00,0xb6,0x00,0x00,0x00,0xb6,0x00,0x00,0x00,0xb6,0x00,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xb8,0x00,0x00,0x00,0x27,0x00,0x00,0x00,
-    0x0c,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0xb9,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-    0x28,0x00,0x00,0x00,0xb7,0x00,0x00,0x00,0xb8,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x17,0x00,0x00,0x00,0xba,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x83,0x00,0x05,0x00,
-    0x17,0x00,0x00,0x00,0xbb,0x00,0x00,0x00,0xb9,0x00,0x00,0x00,0xba,0x00,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0xbd,0x00,0x00,0x00,0xb2,0x00,0x00,0x00,
-    0x3e,0x00,0x03,0x00,0xbc,0x00,0x00,0x00,0xbd,0x00,0x00,0x00,0x39,0x00,0x05,0x00,
-    0x06,0x00,0x00,0x00,0xbe,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0xbc,0x00,0x00,0x00,
-    0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xbf,0x00,0x00,0x00,0xbb,0x00,0x00,0x00,
-    0xbe,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,
-    0xb4,0x00,0x00,0x00,0xbf,0x00,0x00,0x00,0xfe,0x00,0x02,0x00,0xc0,0x00,0x00,0x00,
-    0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x18,0x00,0x00,0x00,
-    0x2c,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x2e,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x17,0x00,0x00,0x00,0xc3,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
-    0x17,0x00,0x00,0x00,0xc4,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x8e,0x00,0x05,0x00,
-    0x17,0x00,0x00,0x00,0xc6,0x00,0x00,0x00,0xc4,0x00,0x00,0x00,0xc5,0x00,0x00,0x00,
-    0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xc9,0x00,0x00,0x00,0xc6,0x00,0x00,0x00,
-    0xc8,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xca,0x00,0x00,0x00,
-    0xc3,0x00,0x00,0x00,0xc9,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
-    0xcb,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
-    0xcc,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
-    0xce,0x00,0x00,0x00,0xcc,0x00,0x00,0x00,0xcd,0x00,0x00,0x00,0x81,0x00,0x05,0x00,
-    0x17,0x00,0x00,0x00,0xd1,0x00,0x00,0x00,0xce,0x00,0x00,0x00,0xd0,0x00,0x00,0x00,
-    0x85,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xd2,0x00,0x00,0x00,0xcb,0x00,0x00,0x00,
-    0xd1,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xd5,0x00,0x00,0x00,
-    0xd2,0x00,0x00,0x00,0xd4,0x00,0x00,0x00,0x88,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
-    0xd6,0x00,0x00,0x00,0xca,0x00,0x00,0x00,0xd5,0x00,0x00,0x00,0x0c,0x00,0x08,0x00,
-    0x17,0x00,0x00,0x00,0xd8,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,
-    0xd6,0x00,0x00,0x00,0xd7,0x00,0x00,0x00,0x85,0x00,0x00,0x00,0xfe,0x00,0x02,0x00,
-    0xd8,0x00,0x00,0x00,0x38,0x00,0x01,0x00,0x36,0x00,0x05,0x00,0x17,0x00,0x00,0x00,
-    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x37,0x00,0x03,0x00,
-    0x18,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x31,0x00,0x00,0x00,
-    0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xdb,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,
-    0x8e,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xdd,0x00,0x00,0x00,0xdb,0x00,0x00,0x00,
-    0xdc,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xde,0x00,0x00,0x00,
-    0x2f,0x00,0x00,0x00,0x0c,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0xdf,0x00,0x00,0x00,
-    0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0xde,0x00,0x00,0x00,0xd7,0x00,0x00,0x00,
-    0x0c,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0xe2,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-    0x1a,0x00,0x00,0x00,0xdf,0x00,0x00,0x00,0xe1,0x00,0x00,0x00,0x8e,0x00,0x05,0x00,
-    0x17,0x00,0x00,0x00,0xe4,0x00,0x00,0x00,0xe2,0x00,0x00,0x00,0xe3,0x00,0x00,0x00,
-    0x83,0x00,0x05,0x00,0x17,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0xe4,0x00,0x00,0x00,
-    0xe6,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0xea,0x00,0x00,0x00,
-    0x2f,0x00,0x00,0x00,0x0c,0x00,0x07,0x00,0x17,0x00,0x00,0x00,0xeb,0x00,0x00,0x00,
-    0x01,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0xe9,0x00,0x00,0x00,0xea,0x00,0x00,0x00,
-    0x0c,0x00,0x08,0x00,0x17,0x00,0x00,0x00,0xec,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-    0x2e,0x00,0x00,0x00,0xdd,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0xeb,0x00,0x00,0x00,
-    0xfe,0x00,0x02,0x00,0xec,0x00,0x00,0x00,0x38,0x00,0x01,0x00,
-};
-static inline const sg_shader_desc* pbr_pbr_shader_desc(sg_backend backend) {
+    return 0;
+}
+static inline const sg_shader_desc* pbr_pbr_clustered_shader_desc(sg_backend backend) {
     if (backend == SG_BACKEND_GLCORE) {
         static sg_shader_desc desc;
         static bool valid;
         if (!valid) {
             valid = true;
-            desc.vertex_func.source = (const char*)pbr_vs_source_glsl430;
+            desc.vertex_func.source = (const char*)pbr_vs_clustered_source_glsl430;
             desc.vertex_func.entry = "main";
-            desc.fragment_func.source = (const char*)pbr_fs_source_glsl430;
+            desc.fragment_func.source = (const char*)pbr_fs_clustered_source_glsl430;
             desc.fragment_func.entry = "main";
             desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[0].glsl_name = "pos";
@@ -3241,6 +8825,8 @@ static inline const sg_shader_desc* pbr_pbr_shader_desc(sg_backend backend) {
             desc.attrs[2].glsl_name = "uv";
             desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[3].glsl_name = "tangent";
+            desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[4].glsl_name = "occlusion";
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
             desc.uniform_blocks[0].size = 208;
@@ -3253,6 +8839,12 @@ static inline const sg_shader_desc* pbr_pbr_shader_desc(sg_backend backend) {
             desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
             desc.uniform_blocks[1].glsl_uniforms[0].array_count = 4;
             desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "fs_params";
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 32;
+            desc.uniform_blocks[3].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[3].glsl_uniforms[0].array_count = 2;
+            desc.uniform_blocks[3].glsl_uniforms[0].glsl_name = "light_params";
             desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
             desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
             desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
@@ -3285,6 +8877,15 @@ static inline const sg_shader_desc* pbr_pbr_shader_desc(sg_backend backend) {
             desc.views[7].texture.image_type = SG_IMAGETYPE_2D;
             desc.views[7].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
             desc.views[7].texture.multisampled = false;
+            desc.views[9].storage_buffer.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[9].storage_buffer.readonly = true;
+            desc.views[9].storage_buffer.glsl_binding_n = 9;
+            desc.views[10].storage_buffer.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[10].storage_buffer.readonly = true;
+            desc.views[10].storage_buffer.glsl_binding_n = 10;
+            desc.views[11].storage_buffer.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[11].storage_buffer.readonly = true;
+            desc.views[11].storage_buffer.glsl_binding_n = 11;
             desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
             desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
@@ -3333,7 +8934,7 @@ static inline const sg_shader_desc* pbr_pbr_shader_desc(sg_backend backend) {
             desc.texture_sampler_pairs[7].view_slot = 7;
             desc.texture_sampler_pairs[7].sampler_slot = 7;
             desc.texture_sampler_pairs[7].glsl_name = "brdf_lut_brdf_lut_smp";
-            desc.label = "pbr_pbr_shader";
+            desc.label = "pbr_pbr_clustered_shader";
         }
         return &desc;
     }
@@ -3342,10 +8943,10 @@ static inline const sg_shader_desc* pbr_pbr_shader_desc(sg_backend backend) {
         static bool valid;
         if (!valid) {
             valid = true;
-            desc.vertex_func.source = (const char*)pbr_vs_source_hlsl5;
+            desc.vertex_func.source = (const char*)pbr_vs_clustered_source_hlsl5;
             desc.vertex_func.d3d11_target = "vs_5_0";
             desc.vertex_func.entry = "main";
-            desc.fragment_func.source = (const char*)pbr_fs_source_hlsl5;
+            desc.fragment_func.source = (const char*)pbr_fs_clustered_source_hlsl5;
             desc.fragment_func.d3d11_target = "ps_5_0";
             desc.fragment_func.entry = "main";
             desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
@@ -3360,6 +8961,9 @@ static inline const sg_shader_desc* pbr_pbr_shader_desc(sg_backend backend) {
             desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[3].hlsl_sem_name = "TEXCOORD";
             desc.attrs[3].hlsl_sem_index = 3;
+            desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[4].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[4].hlsl_sem_index = 4;
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
             desc.uniform_blocks[0].size = 208;
@@ -3368,6 +8972,10 @@ static inline const sg_shader_desc* pbr_pbr_shader_desc(sg_backend backend) {
             desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
             desc.uniform_blocks[1].size = 64;
             desc.uniform_blocks[1].hlsl_register_b_n = 1;
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 32;
+            desc.uniform_blocks[3].hlsl_register_b_n = 3;
             desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
             desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
             desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
@@ -3408,6 +9016,15 @@ static inline const sg_shader_desc* pbr_pbr_shader_desc(sg_backend backend) {
             desc.views[7].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
             desc.views[7].texture.multisampled = false;
             desc.views[7].texture.hlsl_register_t_n = 7;
+            desc.views[9].storage_buffer.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[9].storage_buffer.readonly = true;
+            desc.views[9].storage_buffer.hlsl_register_t_n = 8;
+            desc.views[10].storage_buffer.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[10].storage_buffer.readonly = true;
+            desc.views[10].storage_buffer.hlsl_register_t_n = 9;
+            desc.views[11].storage_buffer.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[11].storage_buffer.readonly = true;
+            desc.views[11].storage_buffer.hlsl_register_t_n = 10;
             desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
             desc.samplers[0].hlsl_register_s_n = 0;
@@ -3456,7 +9073,7 @@ static inline const sg_shader_desc* pbr_pbr_shader_desc(sg_backend backend) {
             desc.texture_sampler_pairs[7].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.texture_sampler_pairs[7].view_slot = 7;
             desc.texture_sampler_pairs[7].sampler_slot = 7;
-            desc.label = "pbr_pbr_shader";
+            desc.label = "pbr_pbr_clustered_shader";
         }
         return &desc;
     }
@@ -3465,14 +9082,15 @@ static inline const sg_shader_desc* pbr_pbr_shader_desc(sg_backend backend) {
         static bool valid;
         if (!valid) {
             valid = true;
-            desc.vertex_func.source = (const char*)pbr_vs_source_metal_macos;
+            desc.vertex_func.source = (const char*)pbr_vs_clustered_source_metal_macos;
             desc.vertex_func.entry = "main0";
-            desc.fragment_func.source = (const char*)pbr_fs_source_metal_macos;
+            desc.fragment_func.source = (const char*)pbr_fs_clustered_source_metal_macos;
             desc.fragment_func.entry = "main0";
             desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
             desc.uniform_blocks[0].size = 208;
@@ -3481,6 +9099,10 @@ static inline const sg_shader_desc* pbr_pbr_shader_desc(sg_backend backend) {
             desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
             desc.uniform_blocks[1].size = 64;
             desc.uniform_blocks[1].msl_buffer_n = 1;
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 32;
+            desc.uniform_blocks[3].msl_buffer_n = 3;
             desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
             desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
             desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
@@ -3521,6 +9143,15 @@ static inline const sg_shader_desc* pbr_pbr_shader_desc(sg_backend backend) {
             desc.views[7].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
             desc.views[7].texture.multisampled = false;
             desc.views[7].texture.msl_texture_n = 7;
+            desc.views[9].storage_buffer.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[9].storage_buffer.readonly = true;
+            desc.views[9].storage_buffer.msl_buffer_n = 8;
+            desc.views[10].storage_buffer.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[10].storage_buffer.readonly = true;
+            desc.views[10].storage_buffer.msl_buffer_n = 9;
+            desc.views[11].storage_buffer.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[11].storage_buffer.readonly = true;
+            desc.views[11].storage_buffer.msl_buffer_n = 10;
             desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
             desc.samplers[0].msl_sampler_n = 0;
@@ -3569,7 +9200,7 @@ static inline const sg_shader_desc* pbr_pbr_shader_desc(sg_backend backend) {
             desc.texture_sampler_pairs[7].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.texture_sampler_pairs[7].view_slot = 7;
             desc.texture_sampler_pairs[7].sampler_slot = 7;
-            desc.label = "pbr_pbr_shader";
+            desc.label = "pbr_pbr_clustered_shader";
         }
         return &desc;
     }
@@ -3578,16 +9209,17 @@ static inline const sg_shader_desc* pbr_pbr_shader_desc(sg_backend backend) {
         static bool valid;
         if (!valid) {
             valid = true;
-            desc.vertex_func.bytecode.ptr = pbr_vs_bytecode_spirv_vk;
-            desc.vertex_func.bytecode.size = 2780;
+            desc.vertex_func.bytecode.ptr = pbr_vs_clustered_bytecode_spirv_vk;
+            desc.vertex_func.bytecode.size = 3036;
             desc.vertex_func.entry = "main";
-            desc.fragment_func.bytecode.ptr = pbr_fs_bytecode_spirv_vk;
-            desc.fragment_func.bytecode.size = 13772;
+            desc.fragment_func.bytecode.ptr = pbr_fs_clustered_bytecode_spirv_vk;
+            desc.fragment_func.bytecode.size = 22524;
             desc.fragment_func.entry = "main";
             desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.attrs[3].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[4].base_type = SG_SHADERATTRBASETYPE_FLOAT;
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
             desc.uniform_blocks[0].size = 208;
@@ -3596,6 +9228,10 @@ static inline const sg_shader_desc* pbr_pbr_shader_desc(sg_backend backend) {
             desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
             desc.uniform_blocks[1].size = 64;
             desc.uniform_blocks[1].spirv_set0_binding_n = 1;
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 32;
+            desc.uniform_blocks[3].spirv_set0_binding_n = 3;
             desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
             desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
             desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
@@ -3636,6 +9272,15 @@ static inline const sg_shader_desc* pbr_pbr_shader_desc(sg_backend backend) {
             desc.views[7].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
             desc.views[7].texture.multisampled = false;
             desc.views[7].texture.spirv_set1_binding_n = 7;
+            desc.views[9].storage_buffer.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[9].storage_buffer.readonly = true;
+            desc.views[9].storage_buffer.spirv_set1_binding_n = 9;
+            desc.views[10].storage_buffer.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[10].storage_buffer.readonly = true;
+            desc.views[10].storage_buffer.spirv_set1_binding_n = 10;
+            desc.views[11].storage_buffer.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[11].storage_buffer.readonly = true;
+            desc.views[11].storage_buffer.spirv_set1_binding_n = 11;
             desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
             desc.samplers[0].spirv_set1_binding_n = 32;
@@ -3684,7 +9329,7 @@ static inline const sg_shader_desc* pbr_pbr_shader_desc(sg_backend backend) {
             desc.texture_sampler_pairs[7].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.texture_sampler_pairs[7].view_slot = 7;
             desc.texture_sampler_pairs[7].sampler_slot = 7;
-            desc.label = "pbr_pbr_shader";
+            desc.label = "pbr_pbr_clustered_shader";
         }
         return &desc;
     }
@@ -1,6 +1,14 @@
 // Stylized Realistic Toon Shader
 // A hybrid approach combining PBR lighting with anime-style aesthetics
 // Features: Soft ramp shadows, stylized specular, rim light, material-aware shading
+//
+// Materials imported from VRMC_materials_mtoon / VRM 0.x MToon are shaded with
+// their own parameters, read from a per-model storage buffer indexed per draw.
+// Programs:
+//   toon  - parametric MToon only (no shade/rim/matcap textures)
+//   mtoon - adds shade multiply, rim multiply and matcap textures
+// and their *_clustered variants, which add the scene's point/spot lights
+// by looping over the light list of the pixel's froxel (see clustered.h)
 
 @module toon
 
@@ -8,7 +16,9 @@
 @ctype vec4 HMM_Vec4
 @ctype vec3 HMM_Vec3
 
-@vs vs
+@include clustered.glsl
+
+@block vs_common
 layout(binding=0) uniform vs_params {
     mat4 mvp;
     mat4 model;
@@ -21,12 +31,17 @@ in vec3 pos;
 in vec3 normal;
 in vec2 uv;
 in vec4 tangent;
+in float occlusion;
 
 out vec3 v_world_pos;
 out vec3 v_normal;
 out vec3 v_tangent;
 out vec3 v_bitangent;
 out vec2 v_uv;
+out float v_occlusion;
+#ifdef CLUSTERED_LIGHTS
+out vec4 v_clip;
+#endif
 
 void main() {
     v_world_pos = (model * vec4(pos, 1.0)).xyz;
@@ -34,11 +49,15 @@ void main() {
     v_tangent = normalize((normal_matrix * vec4(tangent.xyz, 0.0)).xyz);
     v_bitangent = cross(v_normal, v_tangent) * tangent.w;
     v_uv = uv;
+    v_occlusion = occlusion;
     gl_Position = mvp * vec4(pos, 1.0);
+#ifdef CLUSTERED_LIGHTS
+    v_clip = gl_Position;
+#endif
 }
 @end
 
-@fs fs
+@block fs_common
 layout(binding=0) uniform texture2D base_color_tex;
 layout(binding=0) uniform sampler base_color_smp;
 layout(binding=1) uniform texture2D metallic_roughness_tex;
@@ -52,15 +71,45 @@ layout(binding=3) uniform sampler irradiance_smp;
 layout(binding=4) uniform textureCube prefilter_map;
 layout(binding=4) uniform sampler prefilter_smp;
 
+// Per-material parameters, uploaded once per model
+struct toon_material {
+    vec4 base_color_factor;     // rgba
+    vec4 shade_color_factor;    // rgb = shade color, a = shading shift
+    vec4 rim_color_factor;      // rgb = parametric rim color, a = rim fresnel power
+    vec4 matcap_factor;         // rgb = matcap color, a = rim lift
+    vec4 emissive_factor;       // rgb = emissive color, a = rim lighting mix
+    vec4 params;                // x = metallic, y = roughness, z = shading toony, w = GI equalization
+    vec4 flags;                 // x = 1 for authored MToon, 0 for the stylized fallback
+};
+
+layout(binding=5) readonly buffer toon_materials {
+    toon_material materials[];
+};
+
+#ifdef MTOON_TEXTURES
+// Sampled with base_color_smp
+layout(binding=6) uniform texture2D shade_multiply_tex;
+layout(binding=7) uniform texture2D rim_multiply_tex;
+layout(binding=8) uniform texture2D matcap_tex;
+#endif
+
+// Per-frame settings (GUI)
 layout(binding=1) uniform fs_params {
-    vec4 base_color_factor;
-    float metallic_factor;
-    float roughness_factor;
-    float toon_ramp_steps;      // Unused, kept for compatibility
-    float toon_rim_power;
-    float toon_rim_strength;
     vec3 cam_pos;
+    float light_intensity;
+    float shade_toony;          // Stylized fallback only
+    float shade_strength;       // Stylized fallback only
+    float rim_threshold;        // Stylized fallback only
+    float rim_softness;         // Stylized fallback only
+    float spec_intensity;
     float _pad0;
+    float _pad1;
+    float _pad2;
+};
+
+// Per-draw material selection
+layout(binding=2) uniform draw_params {
+    int material_index;
 };
 
 in vec3 v_world_pos;
@@ -68,9 +117,16 @@ in vec3 v_normal;
 in vec3 v_tangent;
 in vec3 v_bitangent;
 in vec2 v_uv;
+in float v_occlusion;
 
 out vec4 frag_color;
 
+#ifdef CLUSTERED_LIGHTS
+in vec4 v_clip;
+
+@include_block clustered_lights
+#endif
+
 const float PI = 3.14159265359;
 
 // ============================================================================
@@ -80,21 +136,15 @@ const float PI = 3.14159265359;
 // Main directional light
 const vec3 LIGHT_DIR = normalize(vec3(0.5, 1.0, 0.3));
 const vec3 LIGHT_COLOR = vec3(1.0, 1.0, 1.0);
-const float LIGHT_INTENSITY = 1.0;          // Neutral intensity
 
 // Shade settings (MToon style - softer than cel-shading)
 const float SHADE_SHIFT = 0.0;              // Shift shade boundary (-1 to 1)
-const float SHADE_TOONY = 0.5;              // 0 = smooth gradient, 1 = hard edge
-const float SHADE_STRENGTH = 0.65;          // How much darker shade is (0 = same as lit)
 
 // Specular settings (subtle for VRM)
-const float SPEC_INTENSITY = 0.3;           // Lower specular
 const float SPEC_SHARPNESS = 0.9;
 
 // Rim light settings (subtle)
 const vec3 RIM_TINT = vec3(1.0, 1.0, 1.0);
-const float RIM_WIDTH = 0.4;
-const float RIM_SOFTNESS = 0.25;
 const float RIM_LIFT = 0.0;                 // Lift rim into shadow areas
 
 // Environment/IBL settings (minimal for VRM)
@@ -127,6 +177,11 @@ float softStep(float edge, float x, float softness) {
     return smoothstep(edge - softness, edge + softness, x);
 }
 
+// Linear ramp used by MToon for the shade boundary
+float linearStep(float a, float b, float t) {
+    return clamp((t - a) / max(b - a, 0.0001), 0.0, 1.0);
+}
+
 // Schlick Fresnel
 float fresnelSchlick(float cosTheta) {
     return pow(max(1.0 - cosTheta, 0.0), 5.0);
@@ -165,7 +220,7 @@ vec3 calculateDiffuse(vec3 baseColor, float NdotL, float ao) {
     // MToon-style shading: shift and toony parameters
     // Shift moves the boundary, toony controls the hardness
     float shadeShift = SHADE_SHIFT;
-    float shadeToony = SHADE_TOONY;
+    float shadeToony = shade_toony;
     
     // Calculate shade factor with shift
     float halfLambert = NdotL * 0.5 + 0.5;  // Remap -1..1 to 0..1
@@ -176,7 +231,7 @@ vec3 calculateDiffuse(vec3 baseColor, float NdotL, float ao) {
     float shadeFactor = smoothstep(0.5 - shadeWidth * 0.5, 0.5 + shadeWidth * 0.5, shadeValue);
     
     // Shade color is darkened base color (no tint, keeps original hue)
-    vec3 shadeColor = baseColor * (1.0 - SHADE_STRENGTH);
+    vec3 shadeColor = baseColor * (1.0 - shade_strength);
     
     // Lit color: base color as-is
     vec3 litColor = baseColor;
@@ -215,23 +270,22 @@ vec3 calculateSpecular(vec3 N, vec3 V, vec3 L, vec3 baseColor, float roughness,
     float specMask = softStep(SPEC_SHARPNESS, NdotH, 0.05);
     specular *= mix(1.0, specMask * 2.0, 0.3);  // Blend physical and stylized
     
-    return specular * SPEC_INTENSITY * NdotL;
+    return specular * spec_intensity * NdotL;
 }
 
 // ============================================================================
 // Rim Light (MToon style)
 // ============================================================================
 
-vec3 calculateRim(vec3 N, vec3 V, vec3 baseColor, float NdotL) {
+vec3 calculateRim(vec3 N, vec3 V, vec3 baseColor, float NdotL, float rimPower, float rimStrength) {
     float NdotV = max(dot(N, V), 0.0);
     
     // Fresnel-based rim
     float rim = 1.0 - NdotV;
-    rim = pow(max(rim, 0.0), toon_rim_power);
+    rim = pow(max(rim, 0.0), rimPower);
     
     // Soft threshold with width control
-    float rimThreshold = 1.0 - RIM_WIDTH;
-    rim = softStep(rimThreshold, rim, RIM_SOFTNESS);
+    rim = softStep(rim_threshold, rim, rim_softness);
     
     // MToon style: rim can be lifted into shadow or only in lit areas
     float halfLambert = NdotL * 0.5 + 0.5;
@@ -241,7 +295,7 @@ vec3 calculateRim(vec3 N, vec3 V, vec3 baseColor, float NdotL) {
     // Rim color: white-ish, subtle influence from base
     vec3 rimColor = RIM_TINT;
     
-    return rimColor * rim * toon_rim_strength;
+    return rimColor * rim * rimStrength;
 }
 
 // ============================================================================
@@ -271,6 +325,37 @@ vec3 calculateEnvironment(vec3 N, vec3 V, vec3 R, vec3 baseColor, float roughnes
     return (diffuseEnv + specularEnv) * ao;
 }
 
+// ============================================================================
+// Authored MToon (VRMC_materials_mtoon 1.0 shading model)
+// ============================================================================
+
+vec3 calculateMToon(toon_material m, vec3 N, vec3 V, vec3 L, vec3 litColor, vec3 shadeColor,
+                    vec3 rimMultiply, vec3 matcap) {
+    // Shade boundary: shift moves it, toony narrows the ramp
+    float toony = m.params.z;
+    float shading = dot(N, L) + m.shade_color_factor.a;
+    shading = linearStep(-1.0 + toony, 1.0 - toony, shading);
+    vec3 lighting = LIGHT_COLOR * light_intensity;
+    vec3 color = mix(shadeColor, litColor, shading) * lighting;
+    
+    // Global illumination, equalized towards the average of up/down irradiance
+    vec3 irradiance = texture(samplerCube(irradiance_map, irradiance_smp), N).rgb;
+    vec3 irradianceUp = texture(samplerCube(irradiance_map, irradiance_smp), vec3(0.0, 1.0, 0.0)).rgb;
+    vec3 irradianceDown = texture(samplerCube(irradiance_map, irradiance_smp), vec3(0.0, -1.0, 0.0)).rgb;
+    vec3 gi = mix(irradiance, (irradianceUp + irradianceDown) * 0.5, m.params.w);
+    color += gi * litColor * ENV_DIFFUSE_STRENGTH;
+    
+    // Parametric rim + matcap, optionally modulated by direct lighting
+    float rimLift = m.matcap_factor.a;
+    float fresnelPower = max(m.rim_color_factor.a, 0.0001);
+    vec3 rim = m.rim_color_factor.rgb * pow(clamp(1.0 - dot(N, V) + rimLift, 0.0, 1.0), fresnelPower);
+    rim += matcap;
+    rim *= rimMultiply;
+    color += mix(rim, rim * lighting, m.emissive_factor.a);
+    
+    return color;
+}
+
 // ============================================================================
 // Tonemapping and Color Grading
 // ============================================================================
@@ -294,20 +379,18 @@ vec3 colorGrade(vec3 color) {
 // ============================================================================
 
 void main() {
+    toon_material m = materials[material_index];
+    
     // ------------------------------------------------------------------------
     // Sample Textures
     // ------------------------------------------------------------------------
     vec4 baseColorSample = texture(sampler2D(base_color_tex, base_color_smp), v_uv);
-    vec3 baseColor = baseColorSample.rgb * base_color_factor.rgb;
-    float alpha = baseColorSample.a * base_color_factor.a;
-    
-    // Assume base color texture is sRGB, convert to linear
-    baseColor = sRGBToLinear(baseColor);
+    float alpha = baseColorSample.a * m.base_color_factor.a;
     
     vec3 mrSample = texture(sampler2D(metallic_roughness_tex, metallic_roughness_smp), v_uv).rgb;
-    float metallic = mrSample.b * metallic_factor;
-    float roughness = clamp(mrSample.g * roughness_factor, 0.04, 1.0);
-    float ao = mrSample.r;  // Often AO is in R channel
+    float metallic = mrSample.b * m.params.x;
+    float roughness = clamp(mrSample.g * m.params.y, 0.04, 1.0);
+    float ao = mrSample.r * v_occlusion;  // Often AO is in R channel; times baked vertex AO
     
     // Normal mapping
     vec3 normalMap = texture(sampler2D(normal_tex, normal_smp), v_uv).rgb;
@@ -321,25 +404,68 @@ void main() {
     vec3 R = reflect(-V, N);
     
     float NdotL = dot(N, L);
-    float NdotV = max(dot(N, V), 0.0);
+    
+    vec3 color = vec3(0.0);
+    if (m.flags.x > 0.5) {
+        // --------------------------------------------------------------------
+        // Authored MToon
+        // --------------------------------------------------------------------
+        vec3 litColor = sRGBToLinear(baseColorSample.rgb) * m.base_color_factor.rgb;
+        vec3 shadeColor = m.shade_color_factor.rgb;
+        vec3 rimMultiply = vec3(1.0);
+        vec3 matcap = vec3(0.0);
+#ifdef MTOON_TEXTURES
+        shadeColor *= sRGBToLinear(texture(sampler2D(shade_multiply_tex, base_color_smp), v_uv).rgb);
+        rimMultiply = sRGBToLinear(texture(sampler2D(rim_multiply_tex, base_color_smp), v_uv).rgb);
+        vec3 viewNormal = normalize(N - V * dot(N, V));
+        vec3 viewUp = normalize(vec3(0.0, 1.0, 0.0) - V * V.y);
+        vec3 viewRight = cross(viewUp, V);
+        vec2 matcapUV = vec2(dot(viewNormal, viewRight), dot(viewNormal, viewUp)) * 0.495 + 0.5;
+        matcap = m.matcap_factor.rgb * sRGBToLinear(texture(sampler2D(matcap_tex, base_color_smp), matcapUV).rgb);
+#endif
+        color = calculateMToon(m, N, V, L, litColor, shadeColor, rimMultiply, matcap);
+#ifdef CLUSTERED_LIGHTS
+        // Point and spot lights: the lit color through the same shade ramp,
+        // without a shade color floor so they only add where they face
+        uvec2 lightRange = clusterLightRange(v_clip);
+        for (uint i = 0u; i < lightRange.y; i++) {
+            punctual_light light = lights[light_indices[lightRange.x + i].light];
+            vec3 Lp;
+            float attenuation = punctualAttenuation(light, v_world_pos, Lp);
+            if (attenuation > 0.0) {
+                float shading = linearStep(-1.0 + m.params.z, 1.0 - m.params.z, dot(N, Lp) + m.shade_color_factor.a);
+                color += litColor * shading * light.color_spot_scale.rgb * attenuation;
+            }
+        }
+#endif
+        color += m.emissive_factor.rgb;
+        
+        color = tonemapReinhard(color);
+        frag_color = vec4(linearToSRGB(color), alpha);
+        return;
+    }
     
     // ------------------------------------------------------------------------
-    // Lighting Calculation
+    // Stylized fallback (non-MToon materials, tuned from the GUI)
     // ------------------------------------------------------------------------
+    vec3 baseColor = baseColorSample.rgb * m.base_color_factor.rgb;
+    
+    // Assume base color texture is sRGB, convert to linear
+    baseColor = sRGBToLinear(baseColor);
     
     // Diffuse (stylized ramp)
     vec3 diffuse = calculateDiffuse(baseColor, NdotL, ao);
     
     // Specular (GGX-based, slightly stylized)
     vec3 specular = calculateSpecular(N, V, L, baseColor, roughness, metallic);
-    specular *= LIGHT_COLOR * LIGHT_INTENSITY;
+    specular *= LIGHT_COLOR * light_intensity;
     
     // Only show specular in lit areas
     float specMask = softStep(0.0, NdotL, 0.1);
     specular *= specMask;
     
     // Rim light
-    vec3 rim = calculateRim(N, V, baseColor, NdotL);
+    vec3 rim = calculateRim(N, V, baseColor, NdotL, m.rim_color_factor.a, m.rim_color_factor.r);
     
     // Environment/IBL
     vec3 env = calculateEnvironment(N, V, R, baseColor, roughness, metallic, ao);
@@ -347,14 +473,29 @@ void main() {
     // ------------------------------------------------------------------------
     // Compose Final Color
     // ------------------------------------------------------------------------
-    vec3 color = vec3(0.0);
     
     // Main diffuse (already includes shading)
-    color = diffuse * LIGHT_COLOR * LIGHT_INTENSITY;
+    color = diffuse * LIGHT_COLOR * light_intensity;
     
     // Add specular (subtle)
     color += specular;
     
+#ifdef CLUSTERED_LIGHTS
+    // Point and spot lights reaching this pixel's cluster, ramped like the key light
+    uvec2 lightRange = clusterLightRange(v_clip);
+    for (uint i = 0u; i < lightRange.y; i++) {
+        punctual_light light = lights[light_indices[lightRange.x + i].light];
+        vec3 Lp;
+        float attenuation = punctualAttenuation(light, v_world_pos, Lp);
+        if (attenuation > 0.0) {
+            float NdotLp = dot(N, Lp);
+            vec3 lighting = light.color_spot_scale.rgb * attenuation;
+            color += baseColor * softStep(0.0, NdotLp, (1.0 - shade_toony) * 0.5 + 0.01) * lighting;
+            color += calculateSpecular(N, V, Lp, baseColor, roughness, metallic) * softStep(0.0, NdotLp, 0.1) * lighting;
+        }
+    }
+#endif
+    
     // Add rim light
     color += rim;
     
@@ -385,4 +526,36 @@ void main() {
 }
 @end
 
+@vs vs
+@include_block vs_common
+@end
+
+@vs vs_clustered
+#define CLUSTERED_LIGHTS
+@include_block vs_common
+@end
+
+@fs fs
+@include_block fs_common
+@end
+
+@fs fs_mtoon
+#define MTOON_TEXTURES
+@include_block fs_common
+@end
+
+@fs fs_clustered
+#define CLUSTERED_LIGHTS
+@include_block fs_common
+@end
+
+@fs fs_mtoon_clustered
+#define MTOON_TEXTURES
+#define CLUSTERED_LIGHTS
+@include_block fs_common
+@end
+
 @program toon vs fs
+@program mtoon vs fs_mtoon
+@program toon_clustered vs_clustered fs_clustered
+@program mtoon_clustered vs_clustered fs_mtoon_clustered
@@ -0,0 +1,722 @@
+// Synthetic GLB/VRM models
+
+#include "synth.h"
+#include "importer.h"
+#include "trace.h"
+
+#include "nlohmann/json.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include "parallel-util.hpp"
+
+using nlohmann::json;
+
+namespace {
+
+const float PI = 3.14159265358979f;
+
+// ============================================================================
+// PNG encoding
+// ============================================================================
+
+struct BitWriter {
+    std::vector<uint8_t>& out;
+    uint32_t bits = 0;
+    int count = 0;
+
+    explicit BitWriter(std::vector<uint8_t>& out) : out(out) {}
+
+    // Least significant bit first, the order of deflate's extra bits
+    void put(uint32_t value, int n) {
+        bits |= value << count;
+        count += n;
+        while (count >= 8) {
+            out.push_back((uint8_t)bits);
+            bits >>= 8;
+            count -= 8;
+        }
+    }
+
+    // Huffman codes go out most significant bit first
+    void put_code(uint32_t code, int n) {
+        uint32_t reversed = 0;
+        for (int i = 0; i < n; i++) {
+            reversed |= ((code >> i) & 1) << (n - 1 - i);
+        }
+        put(reversed, n);
+    }
+
+    void flush() {
+        if (count > 0) {
+            out.push_back((uint8_t)bits);
+        }
+        bits = 0;
+        count = 0;
+    }
+};
+
+const uint16_t length_base[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                   35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+const uint8_t length_extra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+const uint16_t distance_base[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                     257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+const uint8_t distance_extra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                                     7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+// Fixed literal/length code (RFC 1951, 3.2.6)
+void put_symbol(BitWriter& w, int symbol) {
+    if (symbol < 144) {
+        w.put_code(0x30 + symbol, 8);
+    } else if (symbol < 256) {
+        w.put_code(0x190 + symbol - 144, 9);
+    } else if (symbol < 280) {
+        w.put_code(symbol - 256, 7);
+    } else {
+        w.put_code(0xC0 + symbol - 280, 8);
+    }
+}
+
+void put_match(BitWriter& w, int length, int distance) {
+    int lc = 28;
+    while (length_base[lc] > length) {
+        lc--;
+    }
+    put_symbol(w, 257 + lc);
+    w.put(length - length_base[lc], length_extra[lc]);
+    int dc = 29;
+    while (distance_base[dc] > distance) {
+        dc--;
+    }
+    w.put_code(dc, 5);
+    w.put(distance - distance_base[dc], distance_extra[dc]);
+}
+
+// One fixed-Huffman block. Only the previous pixel and the previous row are
+// searched for matches, which is where the generated textures repeat.
+void deflate_fixed(const uint8_t* data, size_t size, int pixel_distance, int row_distance, std::vector<uint8_t>& out) {
+    BitWriter w(out);
+    w.put(1, 1);  // Final block
+    w.put(1, 2);  // Fixed Huffman codes
+    const int distances[2] = { pixel_distance, row_distance <= 32768 ? row_distance : pixel_distance };
+    size_t i = 0;
+    while (i < size) {
+        int best_length = 0, best_distance = 0;
+        for (int distance : distances) {
+            if (i < (size_t)distance) {
+                continue;
+            }
+            int length = 0;
+            while (length < 258 && i + length < size && data[i + length] == data[i + length - distance]) {
+                length++;
+            }
+            if (length > best_length) {
+                best_length = length;
+                best_distance = distance;
+            }
+        }
+        if (best_length >= 3) {
+            put_match(w, best_length, best_distance);
+            i += best_length;
+        } else {
+            put_symbol(w, data[i]);
+            i++;
+        }
+    }
+    put_symbol(w, 256);
+    w.flush();
+}
+
+uint32_t crc32(const uint8_t* data, size_t size) {
+    // Built once, thread-safely, on first use
+    static const std::array<uint32_t, 256> table = [] {
+        std::array<uint32_t, 256> t;
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            t[n] = c;
+        }
+        return t;
+    }();
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; i++) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+void put_u32_be(std::vector<uint8_t>& out, uint32_t v) {
+    uint8_t b[4] = { (uint8_t)(v >> 24), (uint8_t)(v >> 16), (uint8_t)(v >> 8), (uint8_t)v };
+    out.insert(out.end(), b, b + 4);
+}
+
+void put_png_chunk(std::vector<uint8_t>& out, const char type[4], const std::vector<uint8_t>& payload) {
+    put_u32_be(out, (uint32_t)payload.size());
+    size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), payload.begin(), payload.end());
+    put_u32_be(out, crc32(&out[start], out.size() - start));
+}
+
+// ============================================================================
+// Content
+// ============================================================================
+
+uint32_t hash_u32(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7FEB352Du;
+    x ^= x >> 15;
+    x *= 0x846CA68Bu;
+    x ^= x >> 16;
+    return x;
+}
+
+// Checkerboard of hashed cell colours with a ramp across each cell
+void texture_pixels(int index, int size, std::vector<uint8_t>& rgba) {
+    rgba.resize((size_t)size * size * 4);
+    int cell = std::max(4, size / 16);
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            uint32_t h = hash_u32((uint32_t)index * 7919u + (uint32_t)(y / cell) * 131u + (uint32_t)(x / cell));
+            int ramp = (x % cell) * 64 / cell;
+            uint8_t* p = &rgba[((size_t)y * size + x) * 4];
+            p[0] = (uint8_t)std::min(255, 96 + (int)(h & 0x7F) + ramp);
+            p[1] = (uint8_t)std::min(255, 96 + (int)((h >> 8) & 0x7F) + ramp);
+            p[2] = (uint8_t)std::min(255, 96 + (int)((h >> 16) & 0x7F) + ramp);
+            p[3] = 255;
+        }
+    }
+}
+
+// Wavy sheet of a grid_size^2 vertex primitive: band `band` of `bands`
+// stacked along y, rippled along z with a phase per mesh
+struct SheetPoint {
+    float pos[3], normal[3], tangent[3];
+};
+
+SheetPoint sheet_point(float u, float v, int band, int bands, int mesh) {
+    const float width = 0.8f, height = 1.6f, amplitude = 0.04f;
+    float band_height = height / bands;
+    float phase = mesh * 0.37f;
+    float su = sinf(2.0f * PI * (3.0f * u + phase)), cu = cosf(2.0f * PI * (3.0f * u + phase));
+    float sv = sinf(2.0f * PI * 2.0f * ((band + v) / bands)), cv = cosf(2.0f * PI * 2.0f * ((band + v) / bands));
+    SheetPoint p;
+    p.pos[0] = (u - 0.5f) * width;
+    p.pos[1] = (band + v) * band_height;
+    p.pos[2] = amplitude * su * cv;
+    // Partial derivatives along u and v; the normal is their cross product
+    float du[3] = { width, 0.0f, amplitude * 2.0f * PI * 3.0f * cu * cv };
+    float dv[3] = { 0.0f, band_height, -amplitude * 2.0f * PI * 2.0f / bands * su * sv };
+    float n[3] = { du[1] * dv[2] - du[2] * dv[1], du[2] * dv[0] - du[0] * dv[2], du[0] * dv[1] - du[1] * dv[0] };
+    float nl = sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+    float tl = sqrtf(du[0] * du[0] + du[2] * du[2]);
+    for (int a = 0; a < 3; a++) {
+        p.normal[a] = n[a] / nl;
+        p.tangent[a] = du[a] / tl;
+    }
+    return p;
+}
+
+// Humanoid bones VRM 1.0 requires: parent bone (-1 for the root) and the
+// offset from it. Left is +x.
+struct HumanBone {
+    const char* name;
+    int parent;
+    float offset[3];
+};
+
+const HumanBone human_bones[] = {
+    { "hips", -1, { 0.0f, 0.9f, 0.0f } },
+    { "spine", 0, { 0.0f, 0.1f, 0.0f } },
+    { "head", 1, { 0.0f, 0.5f, 0.0f } },
+    { "leftUpperArm", 1, { 0.15f, 0.4f, 0.0f } },
+    { "leftLowerArm", 3, { 0.25f, 0.0f, 0.0f } },
+    { "leftHand", 4, { 0.25f, 0.0f, 0.0f } },
+    { "rightUpperArm", 1, { -0.15f, 0.4f, 0.0f } },
+    { "rightLowerArm", 6, { -0.25f, 0.0f, 0.0f } },
+    { "rightHand", 7, { -0.25f, 0.0f, 0.0f } },
+    { "leftUpperLeg", 0, { 0.1f, -0.05f, 0.0f } },
+    { "leftLowerLeg", 9, { 0.0f, -0.4f, 0.0f } },
+    { "leftFoot", 10, { 0.0f, -0.4f, 0.0f } },
+    { "rightUpperLeg", 0, { -0.1f, -0.05f, 0.0f } },
+    { "rightLowerLeg", 12, { 0.0f, -0.4f, 0.0f } },
+    { "rightFoot", 13, { 0.0f, -0.4f, 0.0f } },
+};
+const int human_bone_count = (int)(sizeof(human_bones) / sizeof(human_bones[0]));
+
+// ============================================================================
+// GLB assembly
+// ============================================================================
+
+enum {
+    COMPONENT_UNSIGNED_BYTE = 5121,
+    COMPONENT_UNSIGNED_SHORT = 5123,
+    COMPONENT_UNSIGNED_INT = 5125,
+    COMPONENT_FLOAT = 5126,
+    TARGET_ARRAY_BUFFER = 34962,
+    TARGET_ELEMENT_ARRAY_BUFFER = 34963,
+};
+
+struct GlbBuilder {
+    std::vector<uint8_t>& bin;
+    json buffer_views = json::array();
+    json accessors = json::array();
+
+    explicit GlbBuilder(std::vector<uint8_t>& bin) : bin(bin) {}
+
+    int add_view(const void* data, size_t size, int target) {
+        while (bin.size() % 4 != 0) {
+            bin.push_back(0);
+        }
+        json view = { { "buffer", 0 }, { "byteOffset", bin.size() }, { "byteLength", size } };
+        if (target != 0) {
+            view["target"] = target;
+        }
+        const uint8_t* bytes = (const uint8_t*)data;
+        bin.insert(bin.end(), bytes, bytes + size);
+        buffer_views.push_back(view);
+        return (int)buffer_views.size() - 1;
+    }
+
+    int add_accessor(const void* data, size_t count, int component_type, size_t component_size, int components,
+                     int target) {
+        const char* type = components == 16 ? "MAT4" : components == 4 ? "VEC4" : components == 3 ? "VEC3"
+                         : components == 2 ? "VEC2" : "SCALAR";
+        int view = add_view(data, count * component_size * components, target);
+        accessors.push_back({ { "bufferView", view }, { "componentType", component_type }, { "count", count },
+                              { "type", type } });
+        return (int)accessors.size() - 1;
+    }
+
+    // Float accessor with the min/max glTF requires for positions
+    int add_floats(const std::vector<float>& values, int components, int target, bool bounds) {
+        int index = add_accessor(values.data(), values.size() / components, COMPONENT_FLOAT, sizeof(float), components,
+                                 target);
+        if (bounds) {
+            std::vector<float> lo(components, INFINITY), hi(components, -INFINITY);
+            for (size_t i = 0; i < values.size(); i++) {
+                lo[i % components] = std::min(lo[i % components], values[i]);
+                hi[i % components] = std::max(hi[i % components], values[i]);
+            }
+            accessors[index]["min"] = lo;
+            accessors[index]["max"] = hi;
+        }
+        return index;
+    }
+};
+
+int grid_size(int vertices) {
+    return std::max(2, (int)ceil(sqrt((double)std::max(vertices, 4))));
+}
+
+// One primitive's attribute accessors
+json build_primitive(GlbBuilder& builder, const SynthConfig& config, int mesh, int band, int joint_count, int material) {
+    int n = grid_size(config.vertices);
+    size_t vertex_count = (size_t)n * n;
+    std::vector<float> positions(vertex_count * 3), normals(vertex_count * 3), uvs(vertex_count * 2),
+        tangents(vertex_count * 4);
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < n; i++) {
+            size_t v = (size_t)j * n + i;
+            float u = (float)i / (n - 1), w = (float)j / (n - 1);
+            SheetPoint p = sheet_point(u, w, band, config.primitives, mesh);
+            memcpy(&positions[v * 3], p.pos, sizeof(p.pos));
+            memcpy(&normals[v * 3], p.normal, sizeof(p.normal));
+            memcpy(&tangents[v * 4], p.tangent, sizeof(p.tangent));
+            tangents[v * 4 + 3] = 1.0f;
+            uvs[v * 2 + 0] = u;
+            uvs[v * 2 + 1] = 1.0f - w;
+        }
+    }
+
+    json attributes = json::object();
+    attributes["POSITION"] = builder.add_floats(positions, 3, TARGET_ARRAY_BUFFER, true);
+    if (config.normals) {
+        attributes["NORMAL"] = builder.add_floats(normals, 3, TARGET_ARRAY_BUFFER, false);
+    }
+    if (config.tangents) {
+        attributes["TANGENT"] = builder.add_floats(tangents, 4, TARGET_ARRAY_BUFFER, false);
+    }
+    attributes["TEXCOORD_0"] = builder.add_floats(uvs, 2, TARGET_ARRAY_BUFFER, false);
+
+    // Joints spread along the sheet's height, two per vertex
+    if (joint_count > 0) {
+        std::vector<uint16_t> joints(vertex_count * 4, 0);
+        std::vector<float> weights(vertex_count * 4, 0.0f);
+        for (size_t v = 0; v < vertex_count; v++) {
+            float s = (band + (float)(v / n) / (n - 1)) / config.primitives * (joint_count - 1);
+            int j0 = std::min((int)s, joint_count - 1);
+            joints[v * 4 + 0] = (uint16_t)j0;
+            joints[v * 4 + 1] = (uint16_t)std::min(j0 + 1, joint_count - 1);
+            weights[v * 4 + 0] = 1.0f - (s - j0);
+            weights[v * 4 + 1] = s - j0;
+        }
+        if (joint_count <= 256) {
+            std::vector<uint8_t> joints8(joints.begin(), joints.end());
+            attributes["JOINTS_0"] = builder.add_accessor(joints8.data(), vertex_count, COMPONENT_UNSIGNED_BYTE, 1, 4,
+                                                          TARGET_ARRAY_BUFFER);
+        } else {
+            attributes["JOINTS_0"] = builder.add_accessor(joints.data(), vertex_count, COMPONENT_UNSIGNED_SHORT, 2, 4,
+                                                          TARGET_ARRAY_BUFFER);
+        }
+        attributes["WEIGHTS_0"] = builder.add_floats(weights, 4, TARGET_ARRAY_BUFFER, false);
+    }
+
+    std::vector<uint32_t> indices;
+    indices.reserve((size_t)(n - 1) * (n - 1) * 6);
+    for (int j = 0; j + 1 < n; j++) {
+        for (int i = 0; i + 1 < n; i++) {
+            uint32_t a = (uint32_t)(j * n + i), b = a + 1, c = a + n, d = c + 1;
+            uint32_t quad[6] = { a, b, c, b, d, c };
+            indices.insert(indices.end(), quad, quad + 6);
+        }
+    }
+    json primitive = { { "attributes", attributes }, { "material", material } };
+    if (vertex_count <= 65536) {
+        std::vector<uint16_t> indices16(indices.begin(), indices.end());
+        primitive["indices"] = builder.add_accessor(indices16.data(), indices16.size(), COMPONENT_UNSIGNED_SHORT, 2, 1,
+                                                    TARGET_ELEMENT_ARRAY_BUFFER);
+    } else {
+        primitive["indices"] = builder.add_accessor(indices.data(), indices.size(), COMPONENT_UNSIGNED_INT, 4, 1,
+                                                    TARGET_ELEMENT_ARRAY_BUFFER);
+    }
+
+    // Each target raises a bump somewhere on the sheet
+    json targets = json::array();
+    for (int t = 0; t < config.morph_targets; t++) {
+        uint32_t h = hash_u32((uint32_t)t * 31u + 17u);
+        float cu = (h & 0xFFFF) / 65535.0f, cv = (h >> 16) / 65535.0f;
+        std::vector<float> deltas(vertex_count * 3, 0.0f);
+        for (size_t v = 0; v < vertex_count; v++) {
+            float du = (float)(v % n) / (n - 1) - cu, dv = (float)(v / n) / (n - 1) - cv;
+            deltas[v * 3 + 2] = 0.05f * expf(-(du * du + dv * dv) / 0.02f);
+        }
+        targets.push_back({ { "POSITION", builder.add_floats(deltas, 3, TARGET_ARRAY_BUFFER, true) } });
+    }
+    if (!targets.empty()) {
+        primitive["targets"] = targets;
+    }
+    return primitive;
+}
+
+// ============================================================================
+// Presets
+// ============================================================================
+
+struct SynthPreset {
+    const char* name;
+    SynthConfig config;
+};
+
+SynthConfig make_config(int meshes, int primitives, int vertices, int textures, int texture_size, int node_depth,
+                        int instances, int morph_targets, int joints, bool vrm) {
+    SynthConfig config;
+    config.meshes = meshes;
+    config.primitives = primitives;
+    config.vertices = vertices;
+    config.textures = textures;
+    config.texture_size = texture_size;
+    config.node_depth = node_depth;
+    config.instances = instances;
+    config.morph_targets = morph_targets;
+    config.joints = joints;
+    config.vrm = vrm;
+    return config;
+}
+
+// Each preset stresses one path, except "avatar" (a typical VRM) and the
+// everything-at-once "huge"
+const SynthPreset presets[] = {
+    { "tiny", make_config(1, 1, 256, 1, 64, 1, 1, 0, 0, false) },
+    { "small", make_config(4, 2, 4096, 4, 256, 2, 1, 0, 0, false) },
+    { "avatar", make_config(16, 2, 1024, 16, 1024, 4, 1, 16, 64, true) },
+    { "dense", make_config(1, 4, 262144, 0, 256, 1, 1, 0, 0, false) },
+    { "instanced", make_config(4, 1, 16384, 4, 256, 1, 64, 0, 0, false) },
+    { "deep", make_config(16, 1, 1024, 0, 256, 512, 4, 0, 0, false) },
+    { "morphs", make_config(2, 1, 65536, 0, 256, 1, 1, 64, 0, false) },
+    { "skinned", make_config(8, 2, 16384, 0, 256, 1, 1, 0, 512, false) },
+    { "textures", make_config(200, 1, 256, 200, 1024, 1, 1, 0, 0, false) },
+    { "huge", make_config(100, 2, 25281, 200, 512, 8, 1, 1, 64, true) },
+};
+const int preset_count = (int)(sizeof(presets) / sizeof(presets[0]));
+
+} // namespace
+
+int synth_preset_count() {
+    return preset_count;
+}
+
+const char* synth_preset_name(int index) {
+    return index >= 0 && index < preset_count ? presets[index].name : nullptr;
+}
+
+bool synth_preset(const char* name, SynthConfig& config) {
+    for (const SynthPreset& preset : presets) {
+        if (strcmp(preset.name, name) == 0) {
+            config = preset.config;
+            return true;
+        }
+    }
+    return false;
+}
+
+// ============================================================================
+// Generation
+// ============================================================================
+
+void synth_encode_png(const uint8_t* rgba, int width, int height, std::vector<uint8_t>& out) {
+    // Scanlines with filter type 0 (none)
+    size_t stride = (size_t)width * 4 + 1;
+    std::vector<uint8_t> raw(stride * height);
+    for (int y = 0; y < height; y++) {
+        raw[y * stride] = 0;
+        memcpy(&raw[y * stride + 1], &rgba[(size_t)y * width * 4], (size_t)width * 4);
+    }
+
+    std::vector<uint8_t> zlib = { 0x78, 0x01 };
+    deflate_fixed(raw.data(), raw.size(), 4, (int)std::min(stride, (size_t)INT32_MAX), zlib);
+    uint32_t a = 1, b = 0;
+    for (uint8_t byte : raw) {
+        a = (a + byte) % 65521;
+        b = (b + a) % 65521;
+    }
+    put_u32_be(zlib, (b << 16) | a);
+
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    out.assign(signature, signature + 8);
+    std::vector<uint8_t> header;
+    put_u32_be(header, (uint32_t)width);
+    put_u32_be(header, (uint32_t)height);
+    uint8_t format[5] = { 8, 6, 0, 0, 0 };  // 8 bits, RGBA, deflate, adaptive filtering, no interlace
+    header.insert(header.end(), format, format + 5);
+    put_png_chunk(out, "IHDR", header);
+    put_png_chunk(out, "IDAT", zlib);
+    put_png_chunk(out, "IEND", {});
+}
+
+void synth_generate(const SynthConfig& input, SynthModel& model) {
+    TRACE_ZONE("synth_generate");
+    SynthConfig config = input;
+    config.meshes = std::max(config.meshes, 1);
+    config.primitives = std::max(config.primitives, 1);
+    config.node_depth = std::max(config.node_depth, 1);
+    config.instances = std::max(config.instances, 1);
+    config.textures = std::max(config.textures, 0);
+    config.texture_size = std::max(config.texture_size, 1);
+    config.morph_targets = std::max(config.morph_targets, 0);
+    config.joints = std::max(config.joints, config.vrm ? human_bone_count : 0);
+
+    model.bin.clear();
+    model.stats = {};
+    GlbBuilder builder(model.bin);
+    json root;
+    root["asset"] = { { "version", "2.0" }, { "generator", "vrm_synth" } };
+    json nodes = json::array();
+    json scene_nodes = json::array();
+
+    // Skeleton: the VRM humanoid first, the remaining joints a chain
+    // (under the head for VRM). Joints only translate, so each inverse bind
+    // matrix is the negated world position.
+    std::vector<float> joint_world((size_t)config.joints * 3, 0.0f);
+    std::vector<float> inverse_binds;
+    json joint_indices = json::array();
+    for (int j = 0; j < config.joints; j++) {
+        int parent = j - 1;
+        float offset[3] = { 0.0f, 1.6f / config.joints, 0.0f };
+        json node = { { "name", "joint" + std::to_string(j) } };
+        if (config.vrm && j < human_bone_count) {
+            parent = human_bones[j].parent;
+            memcpy(offset, human_bones[j].offset, sizeof(offset));
+            node["name"] = human_bones[j].name;
+        } else if (config.vrm) {
+            parent = j == human_bone_count ? 2 : j - 1;
+            offset[1] = 0.3f / (config.joints - human_bone_count);
+        }
+        for (int a = 0; a < 3; a++) {
+            joint_world[j * 3 + a] = (parent >= 0 ? joint_world[parent * 3 + a] : 0.0f) + offset[a];
+        }
+        node["translation"] = { offset[0], offset[1], offset[2] };
+        nodes.push_back(node);
+        if (parent >= 0) {
+            nodes[parent]["children"].push_back(j);
+        } else {
+            scene_nodes.push_back(j);
+        }
+        joint_indices.push_back(j);
+        float m[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, -joint_world[j * 3], -joint_world[j * 3 + 1],
+                        -joint_world[j * 3 + 2], 1 };
+        inverse_binds.insert(inverse_binds.end(), m, m + 16);
+    }
+    if (config.joints > 0) {
+        int ibm = builder.add_floats(inverse_binds, 16, 0, false);
+        root["skins"] = json::array({ { { "joints", joint_indices }, { "inverseBindMatrices", ibm } } });
+    }
+
+    // Textures, encoded in parallel, then one material per texture
+    std::vector<std::vector<uint8_t>> pngs(config.textures);
+    parallelutil::queue_based_parallel_for(config.textures, [&](int t) {
+        TRACE_ZONE("synth texture");
+        std::vector<uint8_t> pixels;
+        texture_pixels(t, config.texture_size, pixels);
+        synth_encode_png(pixels.data(), config.texture_size, config.texture_size, pngs[t]);
+    });
+    json images = json::array(), textures = json::array(), materials = json::array();
+    for (int t = 0; t < config.textures; t++) {
+        images.push_back({ { "bufferView", builder.add_view(pngs[t].data(), pngs[t].size(), 0) },
+                           { "mimeType", "image/png" } });
+        textures.push_back({ { "source", t }, { "sampler", 0 } });
+        std::vector<uint8_t>().swap(pngs[t]);
+    }
+    int material_count = std::max(config.textures, 1);
+    for (int m = 0; m < material_count; m++) {
+        uint32_t h = hash_u32((uint32_t)m + 1u);
+        float tint[4] = { 0.6f + (h & 0xFF) / 640.0f, 0.6f + ((h >> 8) & 0xFF) / 640.0f,
+                          0.6f + ((h >> 16) & 0xFF) / 640.0f, 1.0f };
+        json pbr = { { "baseColorFactor", tint }, { "metallicFactor", 0.0f }, { "roughnessFactor", 0.8f } };
+        if (config.textures > 0) {
+            pbr["baseColorTexture"] = { { "index", m } };
+        }
+        json material = { { "name", "material" + std::to_string(m) }, { "pbrMetallicRoughness", pbr } };
+        if (config.vrm) {
+            material["extensions"]["VRMC_materials_mtoon"] = {
+                { "specVersion", "1.0" },
+                { "shadeColorFactor", { tint[0] * 0.6f, tint[1] * 0.5f, tint[2] * 0.6f } },
+                { "shadingToonyFactor", 0.9f },
+            };
+        }
+        materials.push_back(material);
+    }
+    if (config.textures > 0) {
+        root["images"] = images;
+        root["textures"] = textures;
+        root["samplers"] = json::array({ { { "magFilter", 9729 }, { "minFilter", 9987 }, { "wrapS", 10497 },
+                                           { "wrapT", 10497 } } });
+    }
+    root["materials"] = materials;
+
+    int n = grid_size(config.vertices);
+    json meshes = json::array();
+    for (int m = 0; m < config.meshes; m++) {
+        json primitives = json::array();
+        for (int p = 0; p < config.primitives; p++) {
+            int material = (m * config.primitives + p) % material_count;
+            primitives.push_back(build_primitive(builder, config, m, p, config.joints, material));
+        }
+        json mesh = { { "name", "mesh" + std::to_string(m) }, { "primitives", primitives } };
+        if (config.morph_targets > 0) {
+            mesh["weights"] = std::vector<float>(config.morph_targets, 0.0f);
+            json names = json::array();
+            for (int t = 0; t < config.morph_targets; t++) {
+                names.push_back("target" + std::to_string(t));
+            }
+            mesh["extras"] = { { "targetNames", names } };
+        }
+        meshes.push_back(mesh);
+    }
+    root["meshes"] = meshes;
+
+    // Every instance hangs at the end of its own node_depth chain; the chain
+    // roots are laid out on a grid. Glancing rotations along the chain keep
+    // the transforms from being identities.
+    int chains = config.meshes * config.instances;
+    int columns = (int)ceil(sqrt((double)chains));
+    std::vector<int> mesh_nodes;
+    for (int c = 0; c < chains; c++) {
+        int parent = -1;
+        for (int d = 0; d < config.node_depth; d++) {
+            int index = (int)nodes.size();
+            json node = { { "name", "node" + std::to_string(c) + "_" + std::to_string(d) } };
+            if (d == 0) {
+                node["translation"] = { (c % columns) * 1.0f, 0.0f, (c / columns) * -1.0f };
+            } else {
+                float half = 0.5f * 0.5f * PI / 180.0f;  // Half of 0.5 degrees about y
+                node["rotation"] = { 0.0f, sinf(half), 0.0f, cosf(half) };
+            }
+            if (d + 1 == config.node_depth) {
+                node["mesh"] = c / config.instances;
+                if (config.joints > 0) {
+                    node["skin"] = 0;
+                }
+                mesh_nodes.push_back(index);
+            }
+            nodes.push_back(node);
+            if (parent >= 0) {
+                nodes[parent]["children"].push_back(index);
+            } else {
+                scene_nodes.push_back(index);
+            }
+            parent = index;
+        }
+    }
+    root["nodes"] = nodes;
+    root["scenes"] = json::array({ { { "nodes", scene_nodes } } });
+    root["scene"] = 0;
+
+    if (config.vrm) {
+        json human_bones_json = json::object();
+        for (int b = 0; b < human_bone_count; b++) {
+            human_bones_json[human_bones[b].name] = { { "node", b } };
+        }
+        json annotations = json::array();
+        for (int node : mesh_nodes) {
+            annotations.push_back({ { "node", node }, { "type", "auto" } });
+        }
+        json vrm = {
+            { "specVersion", "1.0" },
+            { "meta", { { "name", "vrm_synth" }, { "version", "1" }, { "authors", { "vrm_synth" } },
+                        { "licenseUrl", "https://vrm.dev/licenses/1.0/" } } },
+            { "humanoid", { { "humanBones", human_bones_json } } },
+            { "firstPerson", { { "meshAnnotations", annotations } } },
+        };
+        if (config.morph_targets > 0) {
+            vrm["expressions"]["preset"]["happy"]["morphTargetBinds"] =
+                json::array({ { { "node", mesh_nodes[0] }, { "index", 0 }, { "weight", 1.0f } } });
+        }
+        root["extensions"]["VRMC_vrm"] = vrm;
+        root["extensionsUsed"] = { "VRMC_vrm", "VRMC_materials_mtoon" };
+    }
+
+    while (model.bin.size() % 4 != 0) {
+        model.bin.push_back(0);
+    }
+    root["buffers"] = json::array({ { { "byteLength", model.bin.size() } } });
+    root["bufferViews"] = builder.buffer_views;
+    root["accessors"] = builder.accessors;
+    model.json = root.dump();
+    while (model.json.size() % 4 != 0) {
+        model.json.push_back(' ');
+    }
+
+    model.stats.nodes = nodes.size();
+    model.stats.primitives = (size_t)config.meshes * config.primitives;
+    model.stats.vertices = model.stats.primitives * n * n;
+    model.stats.triangles = model.stats.primitives * 2 * (n - 1) * (n - 1) * config.instances;
+    model.stats.textures = config.textures;
+}
+
+bool synth_write_glb(const char* path, const SynthModel& model) {
+    FILE* file = fopen_utf8(path, "wb");
+    if (!file) {
+        return false;
+    }
+    uint32_t header[5] = {
+        0x46546C67,  // "glTF"
+        2,
+        (uint32_t)(12 + 8 + model.json.size() + (model.bin.empty() ? 0 : 8 + model.bin.size())),
+        (uint32_t)model.json.size(),
+        0x4E4F534A,  // "JSON"
+    };
+    uint32_t bin_header[2] = { (uint32_t)model.bin.size(), 0x004E4942 };  // "BIN\0"
+    // GLB is little-endian, like every platform the viewer targets
+    bool ok = fwrite(header, sizeof(header), 1, file) == 1 &&
+              fwrite(model.json.data(), 1, model.json.size(), file) == model.json.size();
+    if (ok && !model.bin.empty()) {
+        ok = fwrite(bin_header, sizeof(bin_header), 1, file) == 1 &&
+             fwrite(model.bin.data(), 1, model.bin.size(), file) == model.bin.size();
+    }
+    return fclose(file) == 0 && ok;
+}
@@ -0,0 +1,58 @@
+// Synthetic GLB/VRM models for scale testing (no sokol dependency). Every
+// knob scales one load or render path on its own: primitives and vertices
+// the geometry conversion, textures the decoders, node depth the transform
+// walk, instances the draw count, morph targets and joints the animated
+// paths. Output is deterministic, byte for byte, for a given config.
+#ifndef SYNTH_H
+#define SYNTH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct SynthConfig {
+    int meshes = 1;
+    int primitives = 1;  // Per mesh
+    int vertices = 1024;  // Per primitive, rounded up to a square grid
+    int textures = 0;  // Base color textures, one material each
+    int texture_size = 256;
+    int node_depth = 1;  // Nodes from each scene root down to its mesh
+    int instances = 1;  // Nodes drawing each mesh
+    int morph_targets = 0;  // Position targets per primitive
+    int joints = 0;  // Skin joints; 0 leaves the meshes unskinned
+    bool normals = true;  // Without them the importer generates normals
+    bool tangents = false;
+    bool vrm = false;  // VRMC_vrm 1.0 humanoid (at least 15 joints) and MToon materials
+};
+
+struct SynthStats {
+    size_t nodes;
+    size_t primitives;  // Distinct primitives in the file
+    size_t vertices;
+    size_t triangles;  // Drawn, instances included
+    size_t textures;
+};
+
+// GLB contents: the JSON chunk and the binary chunk
+struct SynthModel {
+    std::string json;
+    std::vector<uint8_t> bin;
+    SynthStats stats;
+};
+
+// Named configs from "tiny" up to "huge" (10M triangles, 200 textures)
+int synth_preset_count();
+const char* synth_preset_name(int index);
+bool synth_preset(const char* name, SynthConfig& config);
+
+void synth_generate(const SynthConfig& config, SynthModel& model);
+
+// Write as GLB; use a .vrm name for VRM configs
+bool synth_write_glb(const char* path, const SynthModel& model);
+
+// RGBA8 image as PNG, deflated with the fixed Huffman code and matches
+// against the previous pixel and row (no zlib dependency)
+void synth_encode_png(const uint8_t* rgba, int width, int height, std::vector<uint8_t>& out);
+
+#endif // SYNTH_H
@@ -0,0 +1,165 @@
+// Ambient occlusion bake benchmark: BVH build time and ray throughput
+//
+//   vrm_ao_bench [-r <rays>] [-n <runs>] [-d <fraction>] <file>...
+//
+// Every mesh instance of each input is flattened into one world-space
+// triangle list, the way the viewer sees the model, and baked with the
+// viewer's per-vertex occlusion settings. Normals are regenerated so files
+// without them measure the same work. Timings are the best and median of
+// the runs.
+
+#include "importer.h"
+#include "bvh.h"
+#include "geometry.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct Options {
+    int rays = 32;
+    int runs = 3;
+    float distance_fraction = 0.1f;
+};
+
+// World-space positions and triangle indices of every mesh instance
+static void flatten_model(const cgltf_data* data, std::vector<float>& positions, std::vector<uint32_t>& indices) {
+    for (size_t ni = 0; ni < data->nodes_count; ni++) {
+        const cgltf_node* node = &data->nodes[ni];
+        if (!node->mesh) {
+            continue;
+        }
+        float m[16];
+        cgltf_node_transform_world(node, m);
+        for (size_t pi = 0; pi < node->mesh->primitives_count; pi++) {
+            const cgltf_primitive* prim = &node->mesh->primitives[pi];
+            const cgltf_accessor* pos_accessor = nullptr;
+            for (size_t ai = 0; ai < prim->attributes_count; ai++) {
+                if (prim->attributes[ai].type == cgltf_attribute_type_position) {
+                    pos_accessor = prim->attributes[ai].data;
+                }
+            }
+            if (prim->type != cgltf_primitive_type_triangles || !pos_accessor) {
+                continue;
+            }
+            uint32_t base = (uint32_t)(positions.size() / 3);
+            for (size_t vi = 0; vi < pos_accessor->count; vi++) {
+                float p[3] = { 0, 0, 0 };
+                cgltf_accessor_read_float(pos_accessor, vi, p, 3);
+                positions.push_back(m[0] * p[0] + m[4] * p[1] + m[8] * p[2] + m[12]);
+                positions.push_back(m[1] * p[0] + m[5] * p[1] + m[9] * p[2] + m[13]);
+                positions.push_back(m[2] * p[0] + m[6] * p[1] + m[10] * p[2] + m[14]);
+            }
+            size_t index_count = prim->indices ? prim->indices->count : pos_accessor->count;
+            for (size_t ii = 0; ii + 2 < index_count; ii += 3) {
+                for (int c = 0; c < 3; c++) {
+                    size_t index = prim->indices ? cgltf_accessor_read_index(prim->indices, ii + c) : ii + c;
+                    indices.push_back(base + (uint32_t)index);
+                }
+            }
+        }
+    }
+}
+
+static double median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+static bool bench_file(const Options& options, const char* path) {
+    std::string error;
+    cgltf_data* data = import_gltf(path, error);
+    if (!data) {
+        printf("%-40s FAILED: %s\n", path, error.c_str());
+        return false;
+    }
+    std::vector<float> positions;
+    std::vector<uint32_t> indices;
+    flatten_model(data, positions, indices);
+    cgltf_free(data);
+
+    size_t vertex_count = positions.size() / 3;
+    float min_bounds[3] = { INFINITY, INFINITY, INFINITY }, max_bounds[3] = { -INFINITY, -INFINITY, -INFINITY };
+    for (size_t v = 0; v < vertex_count; v++) {
+        for (int a = 0; a < 3; a++) {
+            min_bounds[a] = std::min(min_bounds[a], positions[v * 3 + a]);
+            max_bounds[a] = std::max(max_bounds[a], positions[v * 3 + a]);
+        }
+    }
+    float diagonal = vertex_count > 0 ? sqrtf((max_bounds[0] - min_bounds[0]) * (max_bounds[0] - min_bounds[0]) +
+                                              (max_bounds[1] - min_bounds[1]) * (max_bounds[1] - min_bounds[1]) +
+                                              (max_bounds[2] - min_bounds[2]) * (max_bounds[2] - min_bounds[2]))
+                                      : 0.0f;
+    std::vector<float> normals(positions.size()), occlusion(vertex_count);
+    generate_normals(positions.data(), vertex_count, indices.data(), indices.size(), normals.data());
+
+    std::vector<double> build_ms, mrays;
+    uint64_t rays = 0;
+    Bvh bvh;
+    for (int run = 0; run < options.runs; run++) {
+        auto start = std::chrono::steady_clock::now();
+        bvh_build(bvh, positions.data(), vertex_count, indices.data(), indices.size());
+        build_ms.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        OcclusionBakeStats stats = bake_vertex_occlusion(bvh, positions.data(), normals.data(), vertex_count,
+                                                         options.rays, diagonal * options.distance_fraction,
+                                                         occlusion.data());
+        rays = stats.rays;
+        mrays.push_back(stats.rays / std::max(stats.seconds, 1e-9) * 1e-6);
+    }
+
+    double mean_occlusion = 0.0;
+    for (float o : occlusion) {
+        mean_occlusion += o;
+    }
+    printf("%-40s %9zu %9zu %8zu %9.2f %9.2f %11llu %8.2f %8.2f %6.3f\n", path, indices.size() / 3, vertex_count,
+           bvh.nodes.size(), *std::min_element(build_ms.begin(), build_ms.end()), median(build_ms),
+           (unsigned long long)rays, *std::max_element(mrays.begin(), mrays.end()), median(mrays),
+           vertex_count > 0 ? mean_occlusion / vertex_count : 1.0);
+    return true;
+}
+
+static void print_usage() {
+    printf("Usage: vrm_ao_bench [options] <file.vrm|glb|gltf>...\n");
+    printf("  -r <rays>       Rays per vertex (default: 32)\n");
+    printf("  -n <runs>       Build and bake runs per file (default: 3)\n");
+    printf("  -d <fraction>   Ray length as a fraction of the bounds diagonal (default: 0.1)\n");
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    std::vector<const char*> files;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-r" && i + 1 < argc) {
+            options.rays = std::max(1, atoi(argv[++i]));
+        } else if (arg == "-n" && i + 1 < argc) {
+            options.runs = std::max(1, atoi(argv[++i]));
+        } else if (arg == "-d" && i + 1 < argc) {
+            options.distance_fraction = (float)atof(argv[++i]);
+        } else if (arg == "-h" || arg == "--help") {
+            print_usage();
+            return 0;
+        } else if (!arg.empty() && arg[0] == '-') {
+            fprintf(stderr, "Unknown option: %s\n", arg.c_str());
+            print_usage();
+            return 2;
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+    if (files.empty()) {
+        print_usage();
+        return 2;
+    }
+
+    printf("%-40s %9s %9s %8s %9s %9s %11s %8s %8s %6s\n", "file", "tris", "verts", "nodes", "build ms", "median",
+           "rays", "Mrays/s", "median", "AO");
+    int failures = 0;
+    for (const char* file : files) {
+        failures += bench_file(options, file) ? 0 : 1;
+    }
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,375 @@
+// Micro-benchmarks of the viewer's CPU stages: model file reading, cgltf
+// parsing, texture decoding, vertex and index conversion, each IBL bake and
+// the parallel-util scheduling overhead
+//
+//   vrm_bench [-n <reps>] [-w <warmup>] [-f <filter>] [-o <out.json>] [--hdr <file>] [--quick] [<file>...]
+//
+// Every benchmark runs its warmup iterations untimed, then its repetitions
+// timed one by one. Names are "<stage>/<input>" and stay stable across
+// commits, so JSON reports from two builds run with the same options can be
+// compared benchmark by benchmark. Without model files only the IBL and
+// scheduling benchmarks run; without --hdr the IBL bakes read a procedural
+// environment of the viewer's HDR size, so no assets are needed. Build with
+// CMAKE_BUILD_TYPE=Release for numbers worth comparing.
+
+#include "importer.h"
+#include "bench_report.h"
+#include "ibl.h"
+
+#include "stb_image.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+#include "parallel-util.hpp"
+
+struct Options {
+    int repetitions = 5;
+    int warmup = 1;
+    std::string filter;
+    std::string json_path;
+    std::string hdr_path;
+    bool quick = false;
+};
+
+static void run_bench(const Options& options, const std::string& name, double items, const std::function<void()>& body,
+                      std::vector<BenchResult>& results) {
+    if (!options.filter.empty() && name.find(options.filter) == std::string::npos) {
+        return;
+    }
+    for (int i = 0; i < options.warmup; i++) {
+        body();
+    }
+    BenchResult result = { name, items, {} };
+    for (int i = 0; i < options.repetitions; i++) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        result.samples_ms.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    BenchStats stats = bench_stats(result.samples_ms);
+    printf("%-44s %10.0f %10.3f %10.3f %10.3f %9.3f %10.3f\n", name.c_str(), items, stats.min, stats.median, stats.mean,
+           stats.stddev, stats.p90);
+    fflush(stdout);
+    results.push_back(std::move(result));
+}
+
+// ============================================================================
+// Model stages
+// ============================================================================
+
+static const cgltf_accessor* find_attribute(const cgltf_primitive* prim, cgltf_attribute_type type) {
+    for (size_t ai = 0; ai < prim->attributes_count; ai++) {
+        if (prim->attributes[ai].type == type && prim->attributes[ai].index == 0) {
+            return prim->attributes[ai].data;
+        }
+    }
+    return nullptr;
+}
+
+// The viewer's convert_vertices for every triangle primitive instance
+static size_t convert_model_vertices(const cgltf_data* data, std::vector<Vertex>& vertices) {
+    size_t total = 0;
+    float bounds_min[3] = { 1e10f, 1e10f, 1e10f }, bounds_max[3] = { -1e10f, -1e10f, -1e10f };
+    for (size_t ni = 0; ni < data->nodes_count; ni++) {
+        const cgltf_node* node = &data->nodes[ni];
+        if (!node->mesh) {
+            continue;
+        }
+        float m[16];
+        cgltf_node_transform_world(node, m);
+        for (size_t pi = 0; pi < node->mesh->primitives_count; pi++) {
+            const cgltf_primitive* prim = &node->mesh->primitives[pi];
+            const cgltf_accessor* pos_accessor = find_attribute(prim, cgltf_attribute_type_position);
+            if (prim->type != cgltf_primitive_type_triangles || !pos_accessor) {
+                continue;
+            }
+            convert_vertices(pos_accessor, find_attribute(prim, cgltf_attribute_type_normal),
+                             find_attribute(prim, cgltf_attribute_type_texcoord),
+                             find_attribute(prim, cgltf_attribute_type_tangent), nullptr, nullptr, m, nullptr,
+                             vertices, bounds_min, bounds_max);
+            total += pos_accessor->count;
+        }
+    }
+    return total;
+}
+
+// The viewer's convert_indices for every indexed primitive
+static size_t convert_model_indices(const cgltf_data* data, std::vector<uint32_t>& indices) {
+    size_t total = 0;
+    for (size_t mi = 0; mi < data->meshes_count; mi++) {
+        const cgltf_mesh* mesh = &data->meshes[mi];
+        for (size_t pi = 0; pi < mesh->primitives_count; pi++) {
+            const cgltf_accessor* accessor = mesh->primitives[pi].indices;
+            if (!accessor) {
+                continue;
+            }
+            convert_indices(accessor, 0, indices);
+            total += accessor->count;
+        }
+    }
+    return total;
+}
+
+static std::string base_name(const char* path) {
+    const char* slash = strrchr(path, '/');
+    const char* backslash = strrchr(path, '\\');
+    const char* base = std::max(slash ? slash + 1 : path, backslash ? backslash + 1 : path);
+    return base;
+}
+
+static bool bench_model(const Options& options, const char* path, std::vector<BenchResult>& results) {
+    std::string name = base_name(path);
+    std::vector<uint8_t> file;
+    if (!read_file_utf8(path, file)) {
+        fprintf(stderr, "%s: cannot read file\n", path);
+        return false;
+    }
+    run_bench(options, "read_file/" + name, (double)file.size(), [&]() {
+        std::vector<uint8_t> bytes;
+        read_file_utf8(path, bytes);
+    }, results);
+
+    // Parse from memory so the stage excludes the file read above
+    cgltf_options parse_options = {};
+    cgltf_data* data = nullptr;
+    if (cgltf_parse(&parse_options, file.data(), file.size(), &data) != cgltf_result_success ||
+        cgltf_load_buffers(&parse_options, data, path) != cgltf_result_success) {
+        fprintf(stderr, "%s: cannot parse file\n", path);
+        cgltf_free(data);
+        return false;
+    }
+    run_bench(options, "cgltf_parse/" + name, (double)file.size(), [&]() {
+        cgltf_data* parsed = nullptr;
+        if (cgltf_parse(&parse_options, file.data(), file.size(), &parsed) == cgltf_result_success) {
+            cgltf_load_buffers(&parse_options, parsed, path);
+        }
+        cgltf_free(parsed);
+    }, results);
+
+    // Encoded images are gathered first so decoding is timed alone
+    std::vector<std::vector<uint8_t>> encoded;
+    size_t decoded_pixels = 0;
+    for (size_t i = 0; i < data->images_count; i++) {
+        size_t size = 0;
+        const uint8_t* bytes = image_buffer_view_bytes(&data->images[i], &size);
+        std::vector<uint8_t> image;
+        if (bytes) {
+            image.assign(bytes, bytes + size);
+        } else if (data->images[i].uri && strncmp(data->images[i].uri, "data:", 5) != 0) {
+            read_file_utf8(resolve_uri_path(path, data->images[i].uri).c_str(), image);
+        }
+        int width, height, channels;
+        if (!image.empty() && stbi_info_from_memory(image.data(), (int)image.size(), &width, &height, &channels)) {
+            decoded_pixels += (size_t)width * height;
+            encoded.push_back(std::move(image));
+        }
+    }
+    if (!encoded.empty()) {
+        run_bench(options, "texture_decode/" + name, (double)decoded_pixels, [&]() {
+            for (const std::vector<uint8_t>& image : encoded) {
+                int width, height, channels;
+                stbi_image_free(stbi_load_from_memory(image.data(), (int)image.size(), &width, &height, &channels, 4));
+            }
+        }, results);
+    }
+
+    std::vector<Vertex> vertices;
+    double vertex_count = (double)convert_model_vertices(data, vertices);
+    run_bench(options, "vertex_convert/" + name, vertex_count, [&]() { convert_model_vertices(data, vertices); },
+              results);
+    std::vector<uint32_t> indices;
+    double index_count = (double)convert_model_indices(data, indices);
+    run_bench(options, "index_convert/" + name, index_count, [&]() { convert_model_indices(data, indices); },
+              results);
+
+    cgltf_free(data);
+    return true;
+}
+
+// ============================================================================
+// IBL stages
+// ============================================================================
+
+// Smooth sky gradient with a bright sun, so importance sampling sees the
+// contrast of a real environment
+static void procedural_environment(int width, int height, std::vector<float>& rgb) {
+    rgb.resize((size_t)width * height * 3);
+    for (int y = 0; y < height; y++) {
+        float elevation = 1.0f - 2.0f * (y + 0.5f) / height;
+        for (int x = 0; x < width; x++) {
+            float* p = &rgb[((size_t)y * width + x) * 3];
+            float sky = std::max(elevation, 0.0f);
+            p[0] = 0.3f + 0.4f * sky;
+            p[1] = 0.35f + 0.5f * sky;
+            p[2] = 0.4f + 0.8f * sky;
+            float dx = (float)x / width - 0.3f, dy = (float)y / height - 0.25f;
+            if (dx * dx + dy * dy < 0.0004f) {
+                p[0] = p[1] = p[2] = 200.0f;
+            }
+        }
+    }
+}
+
+static bool bench_ibl(const Options& options, std::vector<BenchResult>& results) {
+    // The viewer's default bake, quartered by --quick
+    IblSettings ibl;
+    ibl_settings_preset("medium", ibl);
+    int shift = options.quick ? 2 : 0;
+    int environment_size = ibl.environment_size >> shift, irradiance_size = ibl.irradiance_size >> std::min(shift, 1);
+    int prefilter_size = ibl.prefilter_size >> shift;
+    int lut_size = 512 >> shift;
+
+    int hdr_width = 2048, hdr_height = 1024;
+    std::vector<float> hdr;
+    if (!options.hdr_path.empty()) {
+        std::vector<uint8_t> file;
+        if (!read_file_utf8(options.hdr_path.c_str(), file)) {
+            fprintf(stderr, "%s: cannot read file\n", options.hdr_path.c_str());
+            return false;
+        }
+        int channels;
+        float* pixels = stbi_loadf_from_memory(file.data(), (int)file.size(), &hdr_width, &hdr_height, &channels, 3);
+        if (!pixels) {
+            fprintf(stderr, "%s: cannot decode HDR\n", options.hdr_path.c_str());
+            return false;
+        }
+        hdr.assign(pixels, pixels + (size_t)hdr_width * hdr_height * 3);
+        stbi_image_free(pixels);
+        run_bench(options, "hdr_decode/" + base_name(options.hdr_path.c_str()), (double)hdr_width * hdr_height, [&]() {
+            int w, h, c;
+            stbi_image_free(stbi_loadf_from_memory(file.data(), (int)file.size(), &w, &h, &c, 3));
+        }, results);
+    } else {
+        procedural_environment(hdr_width, hdr_height, hdr);
+    }
+
+    std::vector<float> cubemap;
+    run_bench(options, "ibl_environment/" + std::to_string(environment_size), 6.0 * environment_size * environment_size,
+              [&]() { ibl_environment_cubemap(hdr.data(), hdr_width, hdr_height, environment_size, cubemap); },
+              results);
+    run_bench(options, "ibl_irradiance/" + std::to_string(irradiance_size), 6.0 * irradiance_size * irradiance_size,
+              [&]() {
+                  ibl_irradiance_map(hdr.data(), hdr_width, hdr_height, irradiance_size, ibl.irradiance_samples,
+                                     cubemap);
+              },
+              results);
+    int num_mips = ibl_prefilter_mip_count(prefilter_size);
+    for (int mip = 0; mip < num_mips; mip++) {
+        int mip_size = prefilter_size >> mip;
+        float roughness = ibl_prefilter_roughness(mip, num_mips);
+        cubemap.resize((size_t)mip_size * mip_size * 4 * 6);
+        run_bench(options, "ibl_prefilter/" + std::to_string(prefilter_size) + "_mip" + std::to_string(mip),
+                  6.0 * mip_size * mip_size,
+                  [&]() {
+                      ibl_prefilter_mip(hdr.data(), hdr_width, hdr_height, mip_size, roughness, ibl.prefilter_samples,
+                                        cubemap.data());
+                  },
+                  results);
+    }
+    std::vector<uint8_t> lut;
+    run_bench(options, "ibl_brdf_lut/" + std::to_string(lut_size), (double)lut_size * lut_size,
+              [&]() { ibl_brdf_lut(lut_size, lut); }, results);
+    return true;
+}
+
+// ============================================================================
+// Scheduling
+// ============================================================================
+
+// Near-empty tasks, so the time is the fork/join cost of each scheduler
+static void bench_scheduling(const Options& options, std::vector<BenchResult>& results) {
+    const int tasks = 4096;
+    std::vector<uint32_t> out(tasks);
+    run_bench(options, "parallel_for/" + std::to_string(tasks), tasks,
+              [&]() { parallelutil::parallel_for(tasks, [&](int i) { out[i] += (uint32_t)i; }); }, results);
+    run_bench(options, "queue_based_parallel_for/" + std::to_string(tasks), tasks,
+              [&]() { parallelutil::queue_based_parallel_for(tasks, [&](int i) { out[i] += (uint32_t)i; }); },
+              results);
+    run_bench(options, "parallel_for_2d/64x64", tasks, [&]() {
+        parallelutil::parallel_for_2d(64, 64, [&](int x, int y) { out[y * 64 + x] += (uint32_t)x; });
+    }, results);
+    // Fork/join of one task per call, the overhead small jobs pay
+    run_bench(options, "parallel_for/1x1000", 1000, [&]() {
+        for (int call = 0; call < 1000; call++) {
+            parallelutil::parallel_for(1, [&](int i) { out[i]++; });
+        }
+    }, results);
+}
+
+// ============================================================================
+// Report
+// ============================================================================
+
+static bool write_json(const Options& options, const std::vector<BenchResult>& results) {
+    nlohmann::ordered_json settings;
+    settings["repetitions"] = options.repetitions;
+    settings["warmup"] = options.warmup;
+    settings["quick"] = options.quick;
+    if (!bench_write_json(options.json_path.c_str(), settings, results)) {
+        fprintf(stderr, "%s: cannot write file\n", options.json_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+static void print_usage() {
+    printf("Usage: vrm_bench [options] [<file.vrm|glb|gltf>...]\n");
+    printf("  -n <reps>       Timed repetitions per benchmark (default: 5)\n");
+    printf("  -w <warmup>     Untimed iterations before them (default: 1)\n");
+    printf("  -f <filter>     Only run benchmarks whose name contains filter\n");
+    printf("  -o <file>       Write the results as JSON\n");
+    printf("  --hdr <file>    Equirectangular HDR for the IBL benchmarks (default: procedural)\n");
+    printf("  --quick         Quarter-size IBL bakes, for smoke runs\n");
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    std::vector<const char*> files;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-n" && i + 1 < argc) {
+            options.repetitions = std::max(1, atoi(argv[++i]));
+        } else if (arg == "-w" && i + 1 < argc) {
+            options.warmup = std::max(0, atoi(argv[++i]));
+        } else if (arg == "-f" && i + 1 < argc) {
+            options.filter = argv[++i];
+        } else if (arg == "-o" && i + 1 < argc) {
+            options.json_path = argv[++i];
+        } else if (arg == "--hdr" && i + 1 < argc) {
+            options.hdr_path = argv[++i];
+        } else if (arg == "--quick") {
+            options.quick = true;
+        } else if (arg == "-h" || arg == "--help") {
+            print_usage();
+            return 0;
+        } else if (!arg.empty() && arg[0] == '-') {
+            fprintf(stderr, "Unknown option: %s\n", arg.c_str());
+            print_usage();
+            return 2;
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+
+#ifndef NDEBUG
+    fprintf(stderr, "Warning: unoptimized build, timings are not representative\n");
+#endif
+    printf("%-44s %10s %10s %10s %10s %9s %10s\n", "benchmark", "items", "min ms", "median", "mean", "stddev", "p90");
+    std::vector<BenchResult> results;
+    int failures = 0;
+    for (const char* file : files) {
+        failures += bench_model(options, file, results) ? 0 : 1;
+    }
+    failures += bench_ibl(options, results) ? 0 : 1;
+    bench_scheduling(options, results);
+
+    if (!options.json_path.empty() && !write_json(options, results)) {
+        failures++;
+    }
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,299 @@
+// Regression gate over two benchmark reports (vrm_bench -o, or a viewer
+// replay run with --bench): matches benchmarks by name and compares their
+// samples, baseline against candidate
+//
+//   vrm_bench_compare [-t <percent>] [--min-delta-ms <ms>] [-a <alpha>] [-f <filter>] [--allow-missing]
+//                     <baseline.json> <candidate.json>
+//
+// Every benchmark gets a median row, tested with the two-sided Mann-Whitney
+// U test over the repetitions (exact for up to 20 samples a side without
+// ties, normal approximation otherwise). Benchmarks with enough samples to
+// have tails, such as per-frame replay timings, also get p90 and p99 rows,
+// tested with a bootstrap of the percentile difference. A row regresses
+// when the candidate is slower by more than the threshold, both relative and
+// in milliseconds, and the difference is significant at alpha; the exit
+// code is 1 if any row did. The absolute floor keeps sub-microsecond
+// benchmarks, whose few ticks of jitter are large percentages, quiet. A
+// benchmark in only one report, renamed or crashed, also fails the gate
+// unless --allow-missing is given.
+
+#include "importer.h"
+#include "bench_report.h"
+
+#include "nlohmann/json.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+struct Options {
+    double threshold = 0.05;  // Relative slowdown that counts
+    double min_delta_ms = 0.05;  // And the absolute one
+    double alpha = 0.05;
+    std::string filter;
+    bool allow_missing = false;  // Benchmarks in only one report do not fail the gate
+};
+
+// Fewest samples a side for p90/p99 rows
+#define TAIL_MIN_SAMPLES 50
+
+// Per side, the largest exact Mann-Whitney distribution computed
+#define EXACT_MAX_SAMPLES 20
+
+#define BOOTSTRAP_RESAMPLES 2000
+
+struct Report {
+    std::string build;
+    int hardware_threads = 0;
+    std::vector<std::string> names;  // In file order
+    std::map<std::string, std::vector<double>> samples;
+};
+
+static bool read_report(const char* path, Report& report) {
+    std::vector<uint8_t> bytes;
+    if (!read_file_utf8(path, bytes)) {
+        fprintf(stderr, "%s: cannot read file\n", path);
+        return false;
+    }
+    try {
+        nlohmann::json json = nlohmann::json::parse(bytes.begin(), bytes.end());
+        if (json.value("schema", "") != "vrm_bench/1") {
+            fprintf(stderr, "%s: not a vrm_bench/1 report\n", path);
+            return false;
+        }
+        report.build = json.value("build", "");
+        report.hardware_threads = json.value("hardware_threads", 0);
+        for (const nlohmann::json& benchmark : json.at("benchmarks")) {
+            std::string name = benchmark.at("name").get<std::string>();
+            report.names.push_back(name);
+            report.samples[name] = benchmark.at("samples").get<std::vector<double>>();
+        }
+    } catch (const std::exception& e) {
+        fprintf(stderr, "%s: %s\n", path, e.what());
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// Significance
+// ============================================================================
+
+// Number of orderings of n1 + n2 distinct values giving each U, for all
+// n1, n2 up to EXACT_MAX_SAMPLES, by f(i, j, u) = f(i - 1, j, u - j) + f(i, j - 1, u)
+static const std::vector<double>& exact_u_counts(int n1, int n2) {
+    static std::vector<std::vector<double>> table;
+    const int side = EXACT_MAX_SAMPLES + 1;
+    if (table.empty()) {
+        table.resize(side * side);
+        for (int i = 0; i < side; i++) {
+            for (int j = 0; j < side; j++) {
+                std::vector<double>& counts = table[i * side + j];
+                counts.assign(i * j + 1, 0.0);
+                if (i == 0 || j == 0) {
+                    counts[0] = 1.0;
+                    continue;
+                }
+                const std::vector<double>& take_a = table[(i - 1) * side + j];
+                const std::vector<double>& take_b = table[i * side + j - 1];
+                for (int u = 0; u <= i * j; u++) {
+                    counts[u] = (u >= j && u - j < (int)take_a.size() ? take_a[u - j] : 0.0) +
+                                (u < (int)take_b.size() ? take_b[u] : 0.0);
+                }
+            }
+        }
+    }
+    return table[n1 * side + n2];
+}
+
+// Two-sided p-value that a and b come from the same distribution
+static double mann_whitney_p(const std::vector<double>& a, const std::vector<double>& b) {
+    size_t n1 = a.size(), n2 = b.size(), n = n1 + n2;
+    if (n1 == 0 || n2 == 0) {
+        return 1.0;
+    }
+    std::vector<std::pair<double, int>> all;
+    all.reserve(n);
+    for (double v : a) all.push_back({ v, 0 });
+    for (double v : b) all.push_back({ v, 1 });
+    std::sort(all.begin(), all.end());
+
+    // Midranks for ties, and the tie correction of the variance
+    double rank_sum_a = 0.0, tie_term = 0.0;
+    for (size_t i = 0; i < n;) {
+        size_t j = i;
+        while (j < n && all[j].first == all[i].first) {
+            j++;
+        }
+        double rank = (i + 1 + j) * 0.5;
+        for (size_t k = i; k < j; k++) {
+            rank_sum_a += all[k].second == 0 ? rank : 0.0;
+        }
+        double t = (double)(j - i);
+        tie_term += t * t * t - t;
+        i = j;
+    }
+    double u = rank_sum_a - n1 * (n1 + 1) * 0.5;
+
+    if (tie_term == 0.0 && n1 <= EXACT_MAX_SAMPLES && n2 <= EXACT_MAX_SAMPLES) {
+        const std::vector<double>& counts = exact_u_counts((int)n1, (int)n2);
+        double total = 0.0, below = 0.0, above = 0.0;
+        for (size_t k = 0; k < counts.size(); k++) {
+            total += counts[k];
+            below += k <= u ? counts[k] : 0.0;
+            above += k >= u ? counts[k] : 0.0;
+        }
+        return std::min(1.0, 2.0 * std::min(below, above) / total);
+    }
+
+    double mean = n1 * n2 * 0.5;
+    double variance = n1 * n2 / 12.0 * ((n + 1) - tie_term / ((double)n * (n - 1)));
+    if (variance <= 0.0) {
+        return 1.0;
+    }
+    double z = std::max(0.0, fabs(u - mean) - 0.5) / sqrt(variance);
+    return std::min(1.0, erfc(z / sqrt(2.0)));
+}
+
+// Two-sided bootstrap p-value for a difference in the p-th percentile;
+// seeded, so a report pair always gets the same answer
+static double bootstrap_percentile_p(const std::vector<double>& a, const std::vector<double>& b, double p) {
+    std::mt19937 rng(12345);
+    std::vector<double> resample_a(a.size()), resample_b(b.size());
+    std::uniform_int_distribution<size_t> pick_a(0, a.size() - 1), pick_b(0, b.size() - 1);
+    int at_most_zero = 0, at_least_zero = 0;
+    for (int r = 0; r < BOOTSTRAP_RESAMPLES; r++) {
+        for (double& v : resample_a) v = a[pick_a(rng)];
+        for (double& v : resample_b) v = b[pick_b(rng)];
+        std::sort(resample_a.begin(), resample_a.end());
+        std::sort(resample_b.begin(), resample_b.end());
+        double diff = bench_percentile(resample_b, p) - bench_percentile(resample_a, p);
+        at_most_zero += diff <= 0.0 ? 1 : 0;
+        at_least_zero += diff >= 0.0 ? 1 : 0;
+    }
+    return std::min(1.0, 2.0 * std::min(at_most_zero, at_least_zero) / BOOTSTRAP_RESAMPLES);
+}
+
+// ============================================================================
+// Comparison
+// ============================================================================
+
+struct Totals {
+    int rows = 0;
+    int regressed = 0;
+    int improved = 0;
+};
+
+static void compare_row(const Options& options, const std::string& name, const char* metric, double base,
+                        double candidate, double p, Totals& totals) {
+    double delta = base > 0.0 ? (candidate - base) / base : 0.0;
+    bool large = fabs(candidate - base) >= options.min_delta_ms;
+    const char* verdict = "";
+    if (p < options.alpha && large && delta > options.threshold) {
+        verdict = "REGRESSED";
+        totals.regressed++;
+    } else if (p < options.alpha && large && delta < -options.threshold) {
+        verdict = "improved";
+        totals.improved++;
+    }
+    totals.rows++;
+    printf("%-44s %-6s %10.3f %10.3f %+8.1f%% %8.4f  %s\n", name.c_str(), metric, base, candidate, delta * 100.0, p,
+           verdict);
+}
+
+static void print_usage() {
+    printf("Usage: vrm_bench_compare [options] <baseline.json> <candidate.json>\n");
+    printf("  -t <percent>         Slowdown that fails the gate (default: 5)\n");
+    printf("  --min-delta-ms <ms>  Smallest change in ms that counts as well (default: 0.05)\n");
+    printf("  -a <alpha>           Significance level (default: 0.05)\n");
+    printf("  -f <filter>          Only compare benchmarks whose name contains filter\n");
+    printf("  --allow-missing      Pass benchmarks found in only one report instead of failing\n");
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    std::vector<const char*> files;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-t" && i + 1 < argc) {
+            options.threshold = std::max(0.0, atof(argv[++i]) / 100.0);
+        } else if (arg == "--min-delta-ms" && i + 1 < argc) {
+            options.min_delta_ms = std::max(0.0, atof(argv[++i]));
+        } else if (arg == "-a" && i + 1 < argc) {
+            options.alpha = atof(argv[++i]);
+        } else if (arg == "-f" && i + 1 < argc) {
+            options.filter = argv[++i];
+        } else if (arg == "--allow-missing") {
+            options.allow_missing = true;
+        } else if (arg == "-h" || arg == "--help") {
+            print_usage();
+            return 0;
+        } else if (!arg.empty() && arg[0] == '-') {
+            fprintf(stderr, "Unknown option: %s\n", arg.c_str());
+            print_usage();
+            return 2;
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+    if (files.size() != 2) {
+        print_usage();
+        return 2;
+    }
+
+    Report base, candidate;
+    if (!read_report(files[0], base) || !read_report(files[1], candidate)) {
+        return 2;
+    }
+    if (base.build != candidate.build || base.hardware_threads != candidate.hardware_threads) {
+        fprintf(stderr, "Warning: reports differ in build (%s, %s) or hardware threads (%d, %d)\n", base.build.c_str(),
+                candidate.build.c_str(), base.hardware_threads, candidate.hardware_threads);
+    }
+    if (base.build == "debug" || candidate.build == "debug") {
+        fprintf(stderr, "Warning: unoptimized build, timings are not representative\n");
+    }
+
+    printf("%-44s %-6s %10s %10s %9s %8s\n", "benchmark", "metric", "base ms", "new ms", "delta", "p");
+    Totals totals;
+    std::vector<std::string> missing;
+    for (const std::string& name : base.names) {
+        if (!options.filter.empty() && name.find(options.filter) == std::string::npos) {
+            continue;
+        }
+        auto it = candidate.samples.find(name);
+        if (it == candidate.samples.end()) {
+            missing.push_back(name + " (only in baseline)");
+            continue;
+        }
+        const std::vector<double>& a = base.samples[name];
+        const std::vector<double>& b = it->second;
+        BenchStats stats_a = bench_stats(a), stats_b = bench_stats(b);
+        compare_row(options, name, "median", stats_a.median, stats_b.median, mann_whitney_p(a, b), totals);
+        if (a.size() >= TAIL_MIN_SAMPLES && b.size() >= TAIL_MIN_SAMPLES) {
+            compare_row(options, name, "p90", stats_a.p90, stats_b.p90, bootstrap_percentile_p(a, b, 0.9), totals);
+            compare_row(options, name, "p99", stats_a.p99, stats_b.p99, bootstrap_percentile_p(a, b, 0.99), totals);
+        }
+    }
+    for (const std::string& name : candidate.names) {
+        if ((options.filter.empty() || name.find(options.filter) != std::string::npos) && !base.samples.count(name)) {
+            missing.push_back(name + " (only in candidate)");
+        }
+    }
+    for (const std::string& line : missing) {
+        printf("%-44s not compared%s\n", line.c_str(), options.allow_missing ? "" : "  MISSING");
+    }
+
+    printf("\n%d metric(s) compared: %d regressed, %d improved (threshold %.1f%% and %g ms, alpha %g)\n",
+           totals.rows, totals.regressed, totals.improved, options.threshold * 100.0, options.min_delta_ms,
+           options.alpha);
+    if (!missing.empty()) {
+        printf("%zu benchmark(s) in only one report%s\n", missing.size(),
+               options.allow_missing ? ", allowed by --allow-missing" : "");
+    }
+    return totals.regressed > 0 || (!missing.empty() && !options.allow_missing) ? 1 : 0;
+}
@@ -0,0 +1,720 @@
+// Offline GLB/VRM optimizer: rewrites models into a faster-loading GLB
+//
+//   vrm_optimize [-o <dir>] [-j <threads>] [--no-dedup] [--no-reorder] [--no-quantize] <file>...
+//
+// Each input is parsed with the viewer's importer and written as
+// <name>.opt.glb (next to the input, or into -o <dir>):
+//   - byte-identical images and accessor data share one buffer view, and
+//     textures are pointed at the first copy of an image
+//   - all buffers, external images and accessor data are packed into one
+//     tightly laid out GLB binary chunk
+//   - triangle index lists are reordered for the post-transform vertex cache
+//   - normals, tangents and texcoords are quantized (KHR_mesh_quantization)
+//   - VRM extensions are validated and re-serialized through VRMC to_json
+// Accessor, image, texture, material, mesh and node indices are unchanged,
+// so everything that references them (VRM extensions included) stays valid.
+
+#include "importer.h"
+#include "geometry.h"
+
+#include "nlohmann/json.hpp"
+
+#define USE_VRMC_VRM_0_0
+#define USE_VRMC_VRM_1_0
+#include <VRMC/VRM.h>
+
+#include "stb_image.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "parallel-util.hpp"
+
+using nlohmann::json;
+
+// ============================================================================
+// Options and reporting
+// ============================================================================
+
+struct Options {
+    std::string output_dir;
+    int threads = 0;  // 0 = hardware concurrency
+    bool dedup = true;
+    bool reorder = true;
+    bool quantize = true;
+};
+
+struct FileReport {
+    std::string input;
+    std::string output;
+    std::string error;
+    size_t size_before = 0;
+    size_t size_after = 0;
+    double load_ms_before = 0.0;
+    double load_ms_after = 0.0;
+    int shared_images = 0;
+    int shared_accessors = 0;
+    int reordered_index_lists = 0;
+    int quantized_accessors = 0;
+    int vrm_extensions = 0;
+    float acmr_before = 0.0f;  // Average cache miss ratio over triangle index lists
+    float acmr_after = 0.0f;
+};
+
+// ============================================================================
+// Load-time measurement
+// ============================================================================
+
+// CPU work the viewer does per model: parse, read every mesh accessor and
+// decode every image. Best of three runs.
+static double measure_load_ms(const char* path) {
+    double best = 0.0;
+    for (int run = 0; run < 3; run++) {
+        auto start = std::chrono::steady_clock::now();
+
+        std::string error;
+        cgltf_data* data = import_gltf(path, error);
+        if (!data) {
+            return 0.0;
+        }
+        std::vector<float> floats;
+        for (size_t mi = 0; mi < data->meshes_count; mi++) {
+            const cgltf_mesh* mesh = &data->meshes[mi];
+            for (size_t pi = 0; pi < mesh->primitives_count; pi++) {
+                const cgltf_primitive* prim = &mesh->primitives[pi];
+                for (size_t ai = 0; ai < prim->attributes_count; ai++) {
+                    const cgltf_accessor* accessor = prim->attributes[ai].data;
+                    floats.resize(accessor->count * cgltf_num_components(accessor->type));
+                    cgltf_accessor_unpack_floats(accessor, floats.data(), floats.size());
+                }
+                for (size_t i = 0; prim->indices && i < prim->indices->count; i++) {
+                    floats.push_back((float)cgltf_accessor_read_index(prim->indices, i));
+                }
+            }
+        }
+        for (size_t i = 0; i < data->images_count; i++) {
+            size_t size = 0;
+            const uint8_t* bytes = image_buffer_view_bytes(&data->images[i], &size);
+            std::vector<uint8_t> file_bytes;
+            if (!bytes && data->images[i].uri && read_file_utf8(resolve_uri_path(path, data->images[i].uri).c_str(), file_bytes)) {
+                bytes = file_bytes.data();
+                size = file_bytes.size();
+            }
+            int width, height, channels;
+            uint8_t* pixels = bytes ? stbi_load_from_memory(bytes, (int)size, &width, &height, &channels, 4) : nullptr;
+            stbi_image_free(pixels);
+        }
+        cgltf_free(data);
+
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        best = run == 0 ? ms : std::min(best, ms);
+    }
+    return best;
+}
+
+// ============================================================================
+// GLB binary chunk builder
+// ============================================================================
+
+enum {
+    TARGET_ARRAY_BUFFER = 34962,
+    TARGET_ELEMENT_ARRAY_BUFFER = 34963,
+};
+
+struct BinaryBuilder {
+    std::vector<uint8_t> bin;
+    json buffer_views = json::array();
+    std::unordered_map<uint64_t, std::vector<int>> views_by_hash;
+    bool dedup = true;
+    int shared_views = 0;
+
+    // Appends a buffer view, or returns an identical existing one
+    int add_view(const uint8_t* bytes, size_t size, int target, int stride) {
+        uint64_t hash = hash_bytes(bytes, size) ^ ((uint64_t)target << 32) ^ (uint64_t)stride;
+        if (dedup) {
+            for (int index : views_by_hash[hash]) {
+                const json& view = buffer_views[index];
+                size_t offset = view["byteOffset"].get<size_t>();
+                if (view["byteLength"].get<size_t>() == size && memcmp(&bin[offset], bytes, size) == 0) {
+                    shared_views++;
+                    return index;
+                }
+            }
+        }
+
+        while (bin.size() % 4 != 0) {
+            bin.push_back(0);
+        }
+        json view = { { "buffer", 0 }, { "byteOffset", bin.size() }, { "byteLength", size } };
+        if (target != 0) {
+            view["target"] = target;
+        }
+        if (stride != 0) {
+            view["byteStride"] = stride;
+        }
+        bin.insert(bin.end(), bytes, bytes + size);
+        buffer_views.push_back(view);
+        views_by_hash[hash].push_back((int)buffer_views.size() - 1);
+        return (int)buffer_views.size() - 1;
+    }
+};
+
+static size_t component_size(cgltf_component_type type) {
+    switch (type) {
+        case cgltf_component_type_r_8:
+        case cgltf_component_type_r_8u:
+            return 1;
+        case cgltf_component_type_r_16:
+        case cgltf_component_type_r_16u:
+            return 2;
+        default:
+            return 4;
+    }
+}
+
+// Copies a whole source buffer view, keeping its stride and target
+static int copy_buffer_view(BinaryBuilder& builder, const cgltf_buffer_view* view) {
+    const uint8_t* bytes = (const uint8_t*)view->buffer->data + view->offset;
+    int target = view->type == cgltf_buffer_view_type_vertices ? TARGET_ARRAY_BUFFER
+               : view->type == cgltf_buffer_view_type_indices ? TARGET_ELEMENT_ARRAY_BUFFER : 0;
+    return builder.add_view(bytes, view->size, target, (int)view->stride);
+}
+
+// ============================================================================
+// Accessor rewriting
+// ============================================================================
+
+// How the mesh primitives use an accessor
+struct AccessorUse {
+    std::string semantic;   // Vertex attribute semantic, empty if none
+    bool mixed = false;     // Used with several semantics or as a morph target
+    bool index = false;
+    bool non_triangles = false;  // Index list of a non-triangle primitive
+};
+
+static std::vector<AccessorUse> collect_accessor_uses(const cgltf_data* data) {
+    std::vector<AccessorUse> uses(data->accessors_count);
+    for (size_t mi = 0; mi < data->meshes_count; mi++) {
+        const cgltf_mesh* mesh = &data->meshes[mi];
+        for (size_t pi = 0; pi < mesh->primitives_count; pi++) {
+            const cgltf_primitive* prim = &mesh->primitives[pi];
+            for (size_t ai = 0; ai < prim->attributes_count; ai++) {
+                AccessorUse& use = uses[prim->attributes[ai].data - data->accessors];
+                const char* name = prim->attributes[ai].name;
+                if (!use.semantic.empty() && use.semantic != name) {
+                    use.mixed = true;
+                }
+                use.semantic = name;
+            }
+            for (size_t ti = 0; ti < prim->targets_count; ti++) {
+                for (size_t ai = 0; ai < prim->targets[ti].attributes_count; ai++) {
+                    uses[prim->targets[ti].attributes[ai].data - data->accessors].mixed = true;
+                }
+            }
+            if (prim->indices) {
+                AccessorUse& use = uses[prim->indices - data->accessors];
+                use.index = true;
+                use.non_triangles |= prim->type != cgltf_primitive_type_triangles;
+            }
+        }
+    }
+    return uses;
+}
+
+static int16_t quantize_snorm16(float v) {
+    return (int16_t)lroundf(std::clamp(v, -1.0f, 1.0f) * 32767.0f);
+}
+
+static int8_t quantize_snorm8(float v) {
+    return (int8_t)lroundf(std::clamp(v, -1.0f, 1.0f) * 127.0f);
+}
+
+// Quantized layout for NORMAL, TANGENT and TEXCOORD_n float accessors
+// (KHR_mesh_quantization). Returns false if the accessor stays float.
+static bool quantize_accessor(const cgltf_accessor* accessor, const std::string& semantic,
+                              std::vector<uint8_t>& out, json& json_accessor, int& stride) {
+    if (accessor->component_type != cgltf_component_type_r_32f) {
+        return false;
+    }
+    size_t components = cgltf_num_components(accessor->type);
+    std::vector<float> values(accessor->count * components);
+    cgltf_accessor_unpack_floats(accessor, values.data(), values.size());
+
+    if (semantic == "NORMAL" && accessor->type == cgltf_type_vec3) {
+        // Three snorm16 padded to the 4-byte vertex attribute alignment
+        stride = 8;
+        out.assign(accessor->count * stride, 0);
+        for (size_t i = 0; i < accessor->count; i++) {
+            int16_t q[3] = { quantize_snorm16(values[i * 3]), quantize_snorm16(values[i * 3 + 1]),
+                             quantize_snorm16(values[i * 3 + 2]) };
+            memcpy(&out[i * stride], q, sizeof(q));
+        }
+        json_accessor["componentType"] = 5122;  // SHORT
+    } else if (semantic == "TANGENT" && accessor->type == cgltf_type_vec4) {
+        stride = 4;
+        out.resize(accessor->count * stride);
+        for (size_t i = 0; i < accessor->count * 4; i++) {
+            out[i] = (uint8_t)quantize_snorm8(values[i]);
+        }
+        json_accessor["componentType"] = 5120;  // BYTE
+    } else if (semantic.rfind("TEXCOORD_", 0) == 0 && accessor->type == cgltf_type_vec2) {
+        // unorm16 only covers UVs inside [0, 1]; tiled UVs stay float
+        for (float v : values) {
+            if (v < 0.0f || v > 1.0f) {
+                return false;
+            }
+        }
+        stride = 4;
+        out.resize(accessor->count * stride);
+        for (size_t i = 0; i < accessor->count * 2; i++) {
+            uint16_t q = (uint16_t)lroundf(values[i] * 65535.0f);
+            memcpy(&out[i * 2], &q, sizeof(q));
+        }
+        json_accessor["componentType"] = 5123;  // UNSIGNED_SHORT
+    } else {
+        return false;
+    }
+    json_accessor["normalized"] = true;
+    json_accessor.erase("min");
+    json_accessor.erase("max");
+    return true;
+}
+
+// Tightly packed copy of an accessor's elements, vertex attributes padded
+// to 4-byte strides
+static void pack_accessor(const cgltf_accessor* accessor, bool vertex_attribute, std::vector<uint8_t>& out, int& stride) {
+    size_t element_size = component_size(accessor->component_type) * cgltf_num_components(accessor->type);
+    size_t packed_size = vertex_attribute ? (element_size + 3) & ~(size_t)3 : element_size;
+    stride = vertex_attribute && packed_size != element_size ? (int)packed_size : 0;
+
+    const uint8_t* src = (const uint8_t*)accessor->buffer_view->buffer->data + accessor->buffer_view->offset + accessor->offset;
+    out.assign(accessor->count * packed_size, 0);
+    for (size_t i = 0; i < accessor->count; i++) {
+        memcpy(&out[i * packed_size], src + i * accessor->stride, element_size);
+    }
+}
+
+// ============================================================================
+// VRM extensions
+// ============================================================================
+
+// The VRMC types drop keys they do not model (extras, vendor fields) and
+// write some optional fields unconditionally, so their output is reconciled
+// against the source: keys the source lacks are removed, dropped keys are
+// restored, and numbers keep their source spelling when equal as floats.
+static void reconcile_json(json& out, const json& source) {
+    if (out.is_object() && source.is_object()) {
+        for (auto it = out.begin(); it != out.end();) {
+            if (!source.contains(it.key())) {
+                it = out.erase(it);
+            } else {
+                reconcile_json(it.value(), source[it.key()]);
+                ++it;
+            }
+        }
+        for (auto it = source.begin(); it != source.end(); ++it) {
+            if (!out.contains(it.key())) {
+                out[it.key()] = it.value();
+            }
+        }
+    } else if (out.is_array() && source.is_array() && out.size() == source.size()) {
+        for (size_t i = 0; i < out.size(); i++) {
+            reconcile_json(out[i], source[i]);
+        }
+    } else if (out.is_number() && source.is_number()) {
+        if (out.get<float>() == source.get<float>()) {
+            out = source;
+        }
+    } else if (out != source) {
+        out = source;  // Not representable by the typed model
+    }
+}
+
+template <typename T>
+static bool reserialize_extension(json& extension) {
+    try {
+        T value = extension.get<T>();
+        json out = value;
+        reconcile_json(out, extension);
+        extension = std::move(out);
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+// Round-trips every VRM extension through VRM.h. Returns the number of
+// extensions re-serialized; invalid ones are kept verbatim and reported.
+static int reserialize_vrm_extensions(json& root, std::string& warnings) {
+    struct Tag0 { using type = VRMC_VRM_0_0::Vrm; };
+    struct Tag1 { using type = VRMC_VRM_1_0::Vrm; };
+    struct TagSpring { using type = VRMC_VRM_1_0::SpringBone; };
+    struct TagMtoon { using type = VRMC_VRM_1_0::MaterialsMtoon; };
+    struct TagConstraint { using type = VRMC_VRM_1_0::NodeConstraintextension; };
+
+    int count = 0;
+    auto visit = [&](json& owner, const char* name, auto tag) {
+        using T = typename decltype(tag)::type;
+        if (!owner.contains("extensions") || !owner["extensions"].contains(name)) {
+            return;
+        }
+        if (reserialize_extension<T>(owner["extensions"][name])) {
+            count++;
+        } else {
+            warnings += std::string(" invalid ") + name + " kept verbatim;";
+        }
+    };
+    visit(root, "VRM", Tag0{});
+    visit(root, "VRMC_vrm", Tag1{});
+    visit(root, "VRMC_springBone", TagSpring{});
+    if (root.contains("materials")) {
+        for (json& material : root["materials"]) {
+            visit(material, "VRMC_materials_mtoon", TagMtoon{});
+        }
+    }
+    if (root.contains("nodes")) {
+        for (json& node : root["nodes"]) {
+            visit(node, "VRMC_node_constraint", TagConstraint{});
+        }
+    }
+    return count;
+}
+
+// ============================================================================
+// Optimizer
+// ============================================================================
+
+static void add_extension_used(json& root, const char* name, bool required) {
+    for (const char* key : { "extensionsUsed", "extensionsRequired" }) {
+        if (!required && strcmp(key, "extensionsRequired") == 0) {
+            continue;
+        }
+        json& list = root[key];
+        if (!list.is_array()) {
+            list = json::array();
+        }
+        if (std::find(list.begin(), list.end(), name) == list.end()) {
+            list.push_back(name);
+        }
+    }
+}
+
+static std::string output_path_for(const Options& options, const std::string& input) {
+    size_t slash = input.find_last_of("/\\");
+    std::string dir = slash == std::string::npos ? "" : input.substr(0, slash + 1);
+    std::string name = slash == std::string::npos ? input : input.substr(slash + 1);
+    size_t dot = name.find_last_of('.');
+    std::string stem = dot == std::string::npos ? name : name.substr(0, dot);
+    if (!options.output_dir.empty()) {
+        dir = options.output_dir;
+        if (dir.back() != '/' && dir.back() != '\\') {
+            dir += '/';
+        }
+    }
+    return dir + stem + ".opt.glb";
+}
+
+static bool write_glb(const char* path, const json& root, const std::vector<uint8_t>& bin, size_t& out_size) {
+    std::string text = root.dump();
+    while (text.size() % 4 != 0) {
+        text.push_back(' ');
+    }
+    std::vector<uint8_t> padded_bin = bin;
+    while (padded_bin.size() % 4 != 0) {
+        padded_bin.push_back(0);
+    }
+
+    std::vector<uint8_t> glb;
+    auto put_u32 = [&](uint32_t v) {
+        uint8_t b[4] = { (uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16), (uint8_t)(v >> 24) };
+        glb.insert(glb.end(), b, b + 4);
+    };
+    size_t total = 12 + 8 + text.size() + (padded_bin.empty() ? 0 : 8 + padded_bin.size());
+    put_u32(0x46546C67);  // "glTF"
+    put_u32(2);
+    put_u32((uint32_t)total);
+    put_u32((uint32_t)text.size());
+    put_u32(0x4E4F534A);  // "JSON"
+    glb.insert(glb.end(), text.begin(), text.end());
+    if (!padded_bin.empty()) {
+        put_u32((uint32_t)padded_bin.size());
+        put_u32(0x004E4942);  // "BIN\0"
+        glb.insert(glb.end(), padded_bin.begin(), padded_bin.end());
+    }
+    out_size = glb.size();
+    return write_file_utf8(path, glb.data(), glb.size());
+}
+
+static void optimize_file(const Options& options, FileReport& report) {
+    const char* path = report.input.c_str();
+    std::vector<uint8_t> source;
+    if (!read_file_utf8(path, source)) {
+        report.error = "cannot read file";
+        return;
+    }
+    report.size_before = source.size();
+
+    std::string error;
+    cgltf_data* data = import_gltf(path, error);
+    if (!data) {
+        report.error = error;
+        return;
+    }
+
+    json root = json::parse(data->json, data->json + data->json_size, nullptr, false);
+    if (root.is_discarded()) {
+        report.error = "invalid JSON chunk";
+        cgltf_free(data);
+        return;
+    }
+    // Compressed buffer views cannot be repacked without their decoder
+    for (const char* unsupported : { "EXT_meshopt_compression", "KHR_draco_mesh_compression" }) {
+        if (root.contains("extensionsUsed") &&
+            std::find(root["extensionsUsed"].begin(), root["extensionsUsed"].end(), unsupported) != root["extensionsUsed"].end()) {
+            report.error = std::string("already uses ") + unsupported;
+            cgltf_free(data);
+            return;
+        }
+    }
+    report.load_ms_before = measure_load_ms(path);
+
+    BinaryBuilder builder;
+    builder.dedup = options.dedup;
+
+    // Images: embed external files, point textures at the first identical copy
+    std::vector<size_t> canonical_image(data->images_count);
+    std::unordered_map<uint64_t, size_t> image_by_hash;
+    std::vector<std::vector<uint8_t>> external_images(data->images_count);
+    for (size_t i = 0; i < data->images_count; i++) {
+        const cgltf_image* image = &data->images[i];
+        json& json_image = root["images"][i];
+        canonical_image[i] = i;
+
+        size_t size = 0;
+        const uint8_t* bytes = image_buffer_view_bytes(image, &size);
+        if (!bytes && image->uri && strncmp(image->uri, "data:", 5) != 0 &&
+            read_file_utf8(resolve_uri_path(path, image->uri).c_str(), external_images[i])) {
+            bytes = external_images[i].data();
+            size = external_images[i].size();
+            if (!json_image.contains("mimeType")) {
+                std::string uri = image->uri;
+                bool jpeg = uri.size() > 4 && (uri.rfind(".jpg") == uri.size() - 4 || uri.rfind(".jpeg") == uri.size() - 5);
+                json_image["mimeType"] = jpeg ? "image/jpeg" : "image/png";
+            }
+        }
+        if (!bytes) {
+            continue;  // data: URIs stay in the JSON
+        }
+        json_image.erase("uri");
+        json_image["bufferView"] = builder.add_view(bytes, size, 0, 0);
+
+        uint64_t hash = hash_bytes(bytes, size);
+        auto cached = image_by_hash.find(hash);
+        if (cached == image_by_hash.end()) {
+            image_by_hash[hash] = i;
+        } else if (options.dedup && root["images"][cached->second]["bufferView"] == json_image["bufferView"]) {
+            canonical_image[i] = cached->second;
+            report.shared_images++;
+        }
+    }
+    if (root.contains("textures")) {
+        for (json& texture : root["textures"]) {
+            if (texture.contains("source")) {
+                texture["source"] = canonical_image[texture["source"].get<size_t>()];
+            }
+        }
+    }
+
+    // Accessors: repack, reorder index lists, quantize attributes
+    std::vector<AccessorUse> uses = collect_accessor_uses(data);
+    int index_lists = 0;
+    int views_before_accessors = builder.shared_views;
+    for (size_t ai = 0; ai < data->accessors_count; ai++) {
+        const cgltf_accessor* accessor = &data->accessors[ai];
+        json& json_accessor = root["accessors"][ai];
+        const AccessorUse& use = uses[ai];
+
+        if (accessor->is_sparse) {
+            if (accessor->buffer_view) {
+                json_accessor["bufferView"] = copy_buffer_view(builder, accessor->buffer_view);
+            }
+            json& sparse = json_accessor["sparse"];
+            sparse["indices"]["bufferView"] = copy_buffer_view(builder, accessor->sparse.indices_buffer_view);
+            sparse["values"]["bufferView"] = copy_buffer_view(builder, accessor->sparse.values_buffer_view);
+            continue;
+        }
+        if (!accessor->buffer_view) {
+            continue;
+        }
+
+        std::vector<uint8_t> bytes;
+        int stride = 0;
+        int target = 0;
+        if (use.index && !use.non_triangles && options.reorder && accessor->count % 3 == 0 && accessor->count > 0) {
+            std::vector<uint32_t> indices(accessor->count);
+            uint32_t max_index = 0;
+            for (size_t i = 0; i < accessor->count; i++) {
+                indices[i] = (uint32_t)cgltf_accessor_read_index(accessor, i);
+                max_index = std::max(max_index, indices[i]);
+            }
+            // Keep the source order when it already beats the reordering
+            std::vector<uint32_t> reordered = indices;
+            optimize_vertex_cache(reordered, max_index + 1);
+            float acmr_before = average_cache_miss_ratio(indices, max_index + 1);
+            float acmr_after = average_cache_miss_ratio(reordered, max_index + 1);
+            if (acmr_after < acmr_before) {
+                indices.swap(reordered);
+                report.reordered_index_lists++;
+            }
+            report.acmr_before += acmr_before;
+            report.acmr_after += std::min(acmr_before, acmr_after);
+            index_lists++;
+
+            size_t size = component_size(accessor->component_type);
+            bytes.resize(indices.size() * size);
+            for (size_t i = 0; i < indices.size(); i++) {
+                if (size == 1) bytes[i] = (uint8_t)indices[i];
+                else if (size == 2) { uint16_t v = (uint16_t)indices[i]; memcpy(&bytes[i * 2], &v, 2); }
+                else memcpy(&bytes[i * 4], &indices[i], 4);
+            }
+            target = TARGET_ELEMENT_ARRAY_BUFFER;
+        } else if (options.quantize && !use.semantic.empty() && !use.mixed &&
+                   quantize_accessor(accessor, use.semantic, bytes, json_accessor, stride)) {
+            report.quantized_accessors++;
+            target = TARGET_ARRAY_BUFFER;
+        } else {
+            bool vertex_attribute = !use.semantic.empty() || use.mixed;
+            pack_accessor(accessor, vertex_attribute, bytes, stride);
+            target = use.index ? TARGET_ELEMENT_ARRAY_BUFFER : vertex_attribute ? TARGET_ARRAY_BUFFER : 0;
+        }
+        json_accessor["bufferView"] = builder.add_view(bytes.data(), bytes.size(), target, stride);
+        json_accessor.erase("byteOffset");
+    }
+    report.shared_accessors = builder.shared_views - views_before_accessors;
+    if (index_lists > 0) {
+        report.acmr_before /= index_lists;
+        report.acmr_after /= index_lists;
+    }
+    if (report.quantized_accessors > 0) {
+        add_extension_used(root, "KHR_mesh_quantization", true);
+    }
+
+    root["bufferViews"] = builder.buffer_views;
+    if (builder.bin.empty()) {
+        root.erase("buffers");
+    } else {
+        root["buffers"] = json::array({ { { "byteLength", builder.bin.size() } } });
+    }
+
+    std::string warnings;
+    report.vrm_extensions = reserialize_vrm_extensions(root, warnings);
+    cgltf_free(data);
+
+    if (!write_glb(report.output.c_str(), root, builder.bin, report.size_after)) {
+        report.error = "cannot write " + report.output;
+        return;
+    }
+    report.load_ms_after = measure_load_ms(report.output.c_str());
+    if (report.load_ms_after == 0.0) {
+        report.error = "output does not load back";
+    } else if (!warnings.empty()) {
+        report.error = "warning:" + warnings;
+    }
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+static void print_usage() {
+    printf("Usage: vrm_optimize [options] <file.vrm|glb|gltf>...\n");
+    printf("  -o <dir>        Output directory (default: next to each input)\n");
+    printf("  -j <threads>    Files processed in parallel (default: all cores)\n");
+    printf("  --no-dedup      Keep duplicate images and accessor data\n");
+    printf("  --no-reorder    Keep index order\n");
+    printf("  --no-quantize   Keep float normals, tangents and texcoords\n");
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    std::vector<FileReport> reports;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc) {
+            options.output_dir = argv[++i];
+        } else if (arg == "-j" && i + 1 < argc) {
+            options.threads = std::max(1, atoi(argv[++i]));
+        } else if (arg == "--no-dedup") {
+            options.dedup = false;
+        } else if (arg == "--no-reorder") {
+            options.reorder = false;
+        } else if (arg == "--no-quantize") {
+            options.quantize = false;
+        } else if (arg == "-h" || arg == "--help") {
+            print_usage();
+            return 0;
+        } else if (!arg.empty() && arg[0] == '-') {
+            fprintf(stderr, "Unknown option: %s\n", arg.c_str());
+            print_usage();
+            return 2;
+        } else {
+            FileReport report;
+            report.input = arg;
+            reports.push_back(report);
+        }
+    }
+    if (reports.empty()) {
+        print_usage();
+        return 2;
+    }
+
+    // Inputs with the same name from different directories get a suffix
+    for (size_t i = 0; i < reports.size(); i++) {
+        std::string path = output_path_for(options, reports[i].input);
+        std::string stem = path.substr(0, path.size() - strlen(".opt.glb"));
+        for (int n = 2; std::any_of(reports.begin(), reports.begin() + i, [&](const FileReport& r) { return r.output == path; }); n++) {
+            path = stem + "-" + std::to_string(n) + ".opt.glb";
+        }
+        reports[i].output = path;
+    }
+
+    // One file per task; load-time measurements run alongside other files
+    // when -j > 1, so compare them with -j 1 for precise numbers
+    parallelutil::queue_based_parallel_for((int)reports.size(), [&](int i) {
+        optimize_file(options, reports[i]);
+    }, options.threads);
+
+    printf("%-40s %10s %10s %7s %9s %9s %6s %6s\n", "file", "size", "optimized", "ratio", "load ms", "opt ms",
+           "ACMR", "opt");
+    int failures = 0;
+    size_t total_before = 0, total_after = 0;
+    for (const FileReport& report : reports) {
+        bool failed = !report.error.empty() && report.error.rfind("warning:", 0) != 0;
+        if (failed) {
+            printf("%-40s FAILED: %s\n", report.input.c_str(), report.error.c_str());
+            failures++;
+            continue;
+        }
+        total_before += report.size_before;
+        total_after += report.size_after;
+        printf("%-40s %10zu %10zu %6.1f%% %9.2f %9.2f %6.3f %6.3f\n", report.input.c_str(), report.size_before,
+               report.size_after, 100.0 * report.size_after / std::max<size_t>(report.size_before, 1),
+               report.load_ms_before, report.load_ms_after, report.acmr_before, report.acmr_after);
+        printf("    -> %s: %d shared image(s), %d shared accessor(s), %d index list(s) reordered, "
+               "%d accessor(s) quantized, %d VRM extension(s) re-serialized\n",
+               report.output.c_str(), report.shared_images, report.shared_accessors, report.reordered_index_lists,
+               report.quantized_accessors, report.vrm_extensions);
+        if (!report.error.empty()) {
+            printf("    %s\n", report.error.c_str());
+        }
+    }
+    if (reports.size() > 1) {
+        printf("total: %zu -> %zu bytes\n", total_before, total_after);
+    }
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,139 @@
+// Synthetic model generator: writes GLB/VRM files for scale testing
+//
+//   vrm_synth [-p <preset>] [options] -o <file.glb|vrm>
+//   vrm_synth --suite <dir>
+//
+// Options override the preset (default "tiny"). --suite writes every preset
+// into dir as <preset>.glb or <preset>.vrm. Files are deterministic, so a
+// suite generated on two machines holds the same bytes.
+
+#include "importer.h"
+#include "synth.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+static bool generate(const SynthConfig& config, const std::string& path, const char* label) {
+    auto start = std::chrono::steady_clock::now();
+    SynthModel model;
+    synth_generate(config, model);
+    if (!synth_write_glb(path.c_str(), model)) {
+        fprintf(stderr, "%s: cannot write file\n", path.c_str());
+        return false;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    size_t size = 12 + 8 + model.json.size() + 8 + model.bin.size();
+    printf("%-10s %8zu %8zu %11zu %11zu %8zu %10.1f %8.2f  %s\n", label, model.stats.nodes, model.stats.primitives,
+           model.stats.vertices, model.stats.triangles, model.stats.textures, size / (1024.0 * 1024.0), seconds,
+           path.c_str());
+    return true;
+}
+
+static void print_usage() {
+    printf("Usage: vrm_synth [-p <preset>] [options] -o <file.glb|vrm>\n");
+    printf("       vrm_synth --suite <dir>\n");
+    printf("  -p <preset>          Starting config (default: tiny):");
+    for (int i = 0; i < synth_preset_count(); i++) {
+        printf(" %s", synth_preset_name(i));
+    }
+    printf("\n");
+    printf("  --meshes <n>         Meshes\n");
+    printf("  --primitives <n>     Primitives per mesh\n");
+    printf("  --vertices <n>       Vertices per primitive (rounded up to a square grid)\n");
+    printf("  --textures <n>       Base color textures, one material each\n");
+    printf("  --texture-size <n>   Texture width and height\n");
+    printf("  --depth <n>          Nodes from each scene root down to its mesh\n");
+    printf("  --instances <n>      Nodes drawing each mesh\n");
+    printf("  --morphs <n>         Morph targets per primitive\n");
+    printf("  --joints <n>         Skin joints (0: unskinned)\n");
+    printf("  --vrm / --no-vrm     VRM 1.0 humanoid and MToon materials\n");
+    printf("  --no-normals         Leave normals to the importer\n");
+    printf("  --tangents           Write tangents\n");
+}
+
+int main(int argc, char** argv) {
+    SynthConfig config;
+    synth_preset("tiny", config);
+    std::string output, suite_dir, preset = "tiny";
+
+    // The preset comes first so options apply on top of it wherever they are
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "-p") == 0) {
+            preset = argv[i + 1];
+            if (!synth_preset(preset.c_str(), config)) {
+                fprintf(stderr, "Unknown preset: %s\n", preset.c_str());
+                print_usage();
+                return 2;
+            }
+        }
+    }
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto count = [&]() { return std::max(0, atoi(argv[++i])); };
+        if (arg == "-p" && i + 1 < argc) {
+            i++;
+        } else if (arg == "-o" && i + 1 < argc) {
+            output = argv[++i];
+        } else if (arg == "--suite" && i + 1 < argc) {
+            suite_dir = argv[++i];
+        } else if (arg == "--meshes" && i + 1 < argc) {
+            config.meshes = count();
+        } else if (arg == "--primitives" && i + 1 < argc) {
+            config.primitives = count();
+        } else if (arg == "--vertices" && i + 1 < argc) {
+            config.vertices = count();
+        } else if (arg == "--textures" && i + 1 < argc) {
+            config.textures = count();
+        } else if (arg == "--texture-size" && i + 1 < argc) {
+            config.texture_size = count();
+        } else if (arg == "--depth" && i + 1 < argc) {
+            config.node_depth = count();
+        } else if (arg == "--instances" && i + 1 < argc) {
+            config.instances = count();
+        } else if (arg == "--morphs" && i + 1 < argc) {
+            config.morph_targets = count();
+        } else if (arg == "--joints" && i + 1 < argc) {
+            config.joints = count();
+        } else if (arg == "--vrm") {
+            config.vrm = true;
+        } else if (arg == "--no-vrm") {
+            config.vrm = false;
+        } else if (arg == "--no-normals") {
+            config.normals = false;
+        } else if (arg == "--tangents") {
+            config.tangents = true;
+        } else if (arg == "-h" || arg == "--help") {
+            print_usage();
+            return 0;
+        } else {
+            fprintf(stderr, "Unknown option: %s\n", arg.c_str());
+            print_usage();
+            return 2;
+        }
+    }
+    if (output.empty() == suite_dir.empty()) {
+        print_usage();
+        return 2;
+    }
+
+    printf("%-10s %8s %8s %11s %11s %8s %10s %8s\n", "preset", "nodes", "prims", "vertices", "triangles", "textures",
+           "MB", "seconds");
+    if (!output.empty()) {
+        return generate(config, output, preset.c_str()) ? 0 : 1;
+    }
+    int failures = 0;
+    for (int i = 0; i < synth_preset_count(); i++) {
+        SynthConfig suite_config;
+        synth_preset(synth_preset_name(i), suite_config);
+        std::string dir = suite_dir;
+        if (!dir.empty() && dir.back() != '/' && dir.back() != '\\') {
+            dir += '/';
+        }
+        std::string path = dir + synth_preset_name(i) + (suite_config.vrm ? ".vrm" : ".glb");
+        failures += generate(suite_config, path, synth_preset_name(i)) ? 0 : 1;
+    }
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,169 @@
+// Timeline tracing
+
+#include "trace.h"
+#include "importer.h"
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+std::atomic<bool> g_trace_enabled{ false };
+
+// Bumped by trace_start(); lanes still holding an older session are stale
+std::atomic<uint32_t> g_trace_session{ 0 };
+
+namespace {
+
+struct TraceEvent {
+    const char* name;
+    uint64_t start_ns, end_ns;
+};
+
+// Written by the owning thread only; written counts every zone recorded in
+// session, so the ring holds the last min(written, capacity) of them. The
+// owner clears the lane itself when it sees a new session, so no other
+// thread ever stores into a lane that a worker may be writing.
+struct TraceLane {
+    std::vector<TraceEvent> events;
+    std::atomic<uint64_t> written{ 0 };
+    std::atomic<uint32_t> session{ 0 };
+    std::string name;
+    bool in_use = false;
+};
+
+std::mutex g_lanes_mutex;
+std::vector<std::unique_ptr<TraceLane>> g_lanes;
+uint64_t g_trace_epoch_ns = 0;
+
+// Frees the thread's lane when the thread exits
+struct LaneHandle {
+    TraceLane* lane = nullptr;
+
+    ~LaneHandle() {
+        if (lane) {
+            std::lock_guard<std::mutex> lock(g_lanes_mutex);
+            lane->in_use = false;
+        }
+    }
+};
+
+thread_local LaneHandle t_lane;
+
+TraceLane* thread_lane() {
+    if (t_lane.lane) {
+        return t_lane.lane;
+    }
+    std::lock_guard<std::mutex> lock(g_lanes_mutex);
+    for (const std::unique_ptr<TraceLane>& lane : g_lanes) {
+        if (!lane->in_use) {
+            t_lane.lane = lane.get();
+            break;
+        }
+    }
+    if (!t_lane.lane) {
+        g_lanes.push_back(std::make_unique<TraceLane>());
+        t_lane.lane = g_lanes.back().get();
+        t_lane.lane->events.resize(TRACE_EVENTS_PER_LANE);
+        t_lane.lane->name = "worker " + std::to_string(g_lanes.size() - 1);
+    }
+    t_lane.lane->in_use = true;
+    return t_lane.lane;
+}
+
+// Zone names are string literals; escape them anyway to keep the JSON valid
+void write_json_string(FILE* file, const char* s) {
+    fputc('"', file);
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') {
+            fputc('\\', file);
+        }
+        fputc((unsigned char)*s < 0x20 ? ' ' : *s, file);
+    }
+    fputc('"', file);
+}
+
+} // namespace
+
+uint64_t trace_now_ns() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void trace_record(const char* name, uint64_t start_ns, uint64_t end_ns) {
+    if (!trace_enabled()) {
+        return;
+    }
+    TraceLane* lane = thread_lane();
+    uint32_t session = g_trace_session.load(std::memory_order_acquire);
+    if (lane->session.load(std::memory_order_relaxed) != session) {
+        lane->written.store(0, std::memory_order_relaxed);
+        lane->session.store(session, std::memory_order_release);
+    }
+    uint64_t index = lane->written.load(std::memory_order_relaxed);
+    lane->events[index % TRACE_EVENTS_PER_LANE] = { name, start_ns, end_ns };
+    lane->written.store(index + 1, std::memory_order_release);
+}
+
+void trace_set_thread_name(const char* name) {
+    TraceLane* lane = thread_lane();
+    std::lock_guard<std::mutex> lock(g_lanes_mutex);
+    lane->name = name;
+}
+
+void trace_start() {
+    // A zone that passed the enabled check before this lands in the old
+    // session, which the export skips
+    std::lock_guard<std::mutex> lock(g_lanes_mutex);
+    g_trace_enabled.store(false);
+    g_trace_epoch_ns = trace_now_ns();
+    g_trace_session.fetch_add(1, std::memory_order_release);
+    g_trace_enabled.store(true);
+}
+
+int trace_write_chrome_json(const char* path) {
+    // Zones still open on other threads are dropped. A thread that passed
+    // the enabled check just before this can still write one zone, at index
+    // written, which is the oldest slot once the ring is full; that slot is
+    // skipped below.
+    g_trace_enabled.store(false);
+    uint32_t session = g_trace_session.load(std::memory_order_acquire);
+    std::lock_guard<std::mutex> lock(g_lanes_mutex);
+    FILE* file = fopen_utf8(path, "wb");
+    if (!file) {
+        return -1;
+    }
+
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    int count = 0;
+    bool first = true;
+    for (size_t l = 0; l < g_lanes.size(); l++) {
+        const TraceLane& lane = *g_lanes[l];
+        fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%zu,\"args\":{\"name\":",
+                first ? "" : ",\n", l);
+        write_json_string(file, lane.name.c_str());
+        fprintf(file, "}},\n{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":%zu,\"args\":{\"sort_index\":%zu}}",
+                l, l);
+        first = false;
+
+        if (lane.session.load(std::memory_order_acquire) != session) {
+            continue;
+        }
+        uint64_t written = lane.written.load(std::memory_order_acquire);
+        uint64_t begin = written >= TRACE_EVENTS_PER_LANE ? written - TRACE_EVENTS_PER_LANE + 1 : 0;
+        for (uint64_t i = begin; i < written; i++) {
+            const TraceEvent& event = lane.events[i % TRACE_EVENTS_PER_LANE];
+            if (event.start_ns < g_trace_epoch_ns) {
+                continue;
+            }
+            fprintf(file, ",\n{\"name\":");
+            write_json_string(file, event.name);
+            fprintf(file, ",\"ph\":\"X\",\"pid\":1,\"tid\":%zu,\"ts\":%.3f,\"dur\":%.3f}", l,
+                    (event.start_ns - g_trace_epoch_ns) * 1e-3, (event.end_ns - event.start_ns) * 1e-3);
+            count++;
+        }
+    }
+    fprintf(file, "\n]}\n");
+    return fclose(file) == 0 ? count : -1;
+}
@@ -0,0 +1,61 @@
+// Timeline tracing (no sokol dependency): scoped zones are recorded into
+// per-thread ring buffers and written as Chrome trace JSON, which
+// ui.perfetto.dev and chrome://tracing open. Recording is off until
+// trace_start(); a zone then costs one relaxed atomic load.
+//
+// parallel-util starts fresh threads on every call, so ring buffers belong
+// to lanes rather than threads: a thread takes the lowest free lane on its
+// first zone and frees it when it exits. Each lane shows up as one track,
+// and the number of busy tracks at any moment is the number of busy cores.
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <atomic>
+#include <cstdint>
+
+// Zones kept per lane; the oldest are overwritten
+#define TRACE_EVENTS_PER_LANE 65536
+
+extern std::atomic<bool> g_trace_enabled;
+
+inline bool trace_enabled() {
+    return g_trace_enabled.load(std::memory_order_relaxed);
+}
+
+// Start a new session (earlier zones are dropped) and start recording
+void trace_start();
+
+// Stop recording and write the zones recorded since trace_start(). Returns
+// the number of zones written, or -1 if the file cannot be written.
+int trace_write_chrome_json(const char* path);
+
+// Track label of the calling thread's lane (default "worker <lane>")
+void trace_set_thread_name(const char* name);
+
+uint64_t trace_now_ns();
+void trace_record(const char* name, uint64_t start_ns, uint64_t end_ns);
+
+// Zone from construction to end() or the end of the scope. name must
+// outlive the trace (string literals).
+struct TraceZone {
+    const char* name;
+    uint64_t start_ns;  // 0 when not recording
+
+    explicit TraceZone(const char* zone_name) : name(zone_name), start_ns(trace_enabled() ? trace_now_ns() : 0) {}
+    ~TraceZone() { end(); }
+    TraceZone(const TraceZone&) = delete;
+    TraceZone& operator=(const TraceZone&) = delete;
+
+    void end() {
+        if (start_ns != 0) {
+            trace_record(name, start_ns, trace_now_ns());
+            start_ns = 0;
+        }
+    }
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_ZONE(name) TraceZone TRACE_CONCAT(trace_zone_, __LINE__)(name)
+
+#endif // TRACE_H
@@ -0,0 +1,200 @@
+// Viewer command line
+
+#include "viewer_options.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+const char* env_or_empty(const char* name) {
+    const char* value = getenv(name);
+    return value ? value : "";
+}
+
+bool is_power_of_two(int value) {
+    return value > 0 && (value & (value - 1)) == 0;
+}
+
+// Whole-string integer in [min, max]
+bool parse_int(const char* text, int min, int max, int& out) {
+    char* end = nullptr;
+    long value = strtol(text, &end, 10);
+    if (end == text || *end != '\0' || value < min || value > max) {
+        return false;
+    }
+    out = (int)value;
+    return true;
+}
+
+} // namespace
+
+void viewer_options_default(ViewerOptions& options) {
+    options.model.clear();
+    options.hdr_path = "assets/hdr/modern_evening_street_2k.hdr";
+    ibl_settings_preset("medium", options.ibl);
+    options.shader = SHADER_AUTO;
+    options.width = 1280;
+    options.height = 720;
+    options.texture_max_size = 4096;
+    options.texture_detail_max_size = 2048;
+    options.texture_budget_mb = 512;
+    options.texture_min_size = 256;
+    options.atlas_max_size = 1024;
+    options.atlas_padding = 2;
+    options.occlusion_rays = 32;
+    options.staging_lights = 0;
+    options.trace_path = env_or_empty("VRM_VIEWER_TRACE");
+    options.record_path = env_or_empty("VRM_VIEWER_RECORD");
+    options.replay_path = env_or_empty("VRM_VIEWER_REPLAY");
+    options.bench_path = env_or_empty("VRM_VIEWER_BENCH");
+    options.bench_frames = 600;
+    options.log_level = LOG_INFO;
+    options.log_json_path.clear();
+}
+
+bool viewer_options_parse(int argc, char** argv, ViewerOptions& options, bool& help, std::string& error) {
+    help = false;
+    // Explicit sizes and sample counts win over --quality wherever they appear
+    int environment_size = 0, irradiance_size = 0, irradiance_samples = 0;
+    int prefilter_size = 0, prefilter_samples = 0;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        auto int_option = [&](int min, int max, int& out) {
+            if (!value || !parse_int(value, min, max, out)) {
+                error = arg + " expects a number from " + std::to_string(min) + " to " + std::to_string(max);
+                return false;
+            }
+            i++;
+            return true;
+        };
+        auto string_option = [&](std::string& out) {
+            if (!value) {
+                error = arg + " expects a value";
+                return false;
+            }
+            out = value;
+            i++;
+            return true;
+        };
+
+        bool ok = true;
+        if (arg == "--hdr") {
+            ok = string_option(options.hdr_path);
+        } else if (arg == "--quality") {
+            if (!value || !ibl_settings_preset(value, options.ibl)) {
+                error = "--quality expects low, medium or high";
+                return false;
+            }
+            i++;
+        } else if (arg == "--env-size") {
+            ok = int_option(16, 4096, environment_size);
+        } else if (arg == "--irradiance-size") {
+            ok = int_option(4, 256, irradiance_size);
+        } else if (arg == "--irradiance-samples") {
+            ok = int_option(1, 65536, irradiance_samples);
+        } else if (arg == "--prefilter-size") {
+            ok = int_option(128, 2048, prefilter_size);
+        } else if (arg == "--prefilter-samples") {
+            ok = int_option(1, 16384, prefilter_samples);
+        } else if (arg == "--toon" || arg == "--pbr") {
+            options.shader = arg == "--toon" ? SHADER_TOON : SHADER_PBR;
+        } else if (arg == "--size") {
+            if (!value || sscanf(value, "%dx%d", &options.width, &options.height) != 2 ||
+                options.width <= 0 || options.height <= 0) {
+                error = "--size expects <width>x<height>";
+                return false;
+            }
+            i++;
+        } else if (arg == "--max-texture-size") {
+            ok = int_option(16, 16384, options.texture_max_size);
+        } else if (arg == "--max-detail-texture-size") {
+            ok = int_option(16, 16384, options.texture_detail_max_size);
+        } else if (arg == "--texture-budget") {
+            ok = int_option(1, 65536, options.texture_budget_mb);
+        } else if (arg == "--min-texture-size") {
+            ok = int_option(1, 16384, options.texture_min_size);
+        } else if (arg == "--atlas-max-size") {
+            ok = int_option(0, 16384, options.atlas_max_size);
+        } else if (arg == "--atlas-padding") {
+            ok = int_option(0, 64, options.atlas_padding);
+        } else if (arg == "--occlusion-rays") {
+            ok = int_option(0, 1024, options.occlusion_rays);
+        } else if (arg == "--lights") {
+            ok = int_option(0, 256, options.staging_lights);
+        } else if (arg == "--trace") {
+            ok = string_option(options.trace_path);
+        } else if (arg == "--record") {
+            ok = string_option(options.record_path);
+        } else if (arg == "--replay") {
+            ok = string_option(options.replay_path);
+        } else if (arg == "--bench") {
+            ok = string_option(options.bench_path);
+        } else if (arg == "--bench-frames") {
+            ok = int_option(1, 1000000, options.bench_frames);
+        } else if (arg == "--log-level") {
+            if (!value || !log_parse_level(value, options.log_level)) {
+                error = "--log-level expects debug, info, warn or error";
+                return false;
+            }
+            i++;
+        } else if (arg == "--log-json") {
+            ok = string_option(options.log_json_path);
+        } else if (arg == "-h" || arg == "--help") {
+            help = true;
+        } else if (arg[0] != '-' && options.model.empty()) {
+            options.model = arg;
+        } else {
+            error = "Unknown option: " + arg;
+            return false;
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+
+    if (environment_size) options.ibl.environment_size = environment_size;
+    if (irradiance_size) options.ibl.irradiance_size = irradiance_size;
+    if (irradiance_samples) options.ibl.irradiance_samples = irradiance_samples;
+    if (prefilter_size) options.ibl.prefilter_size = prefilter_size;
+    if (prefilter_samples) options.ibl.prefilter_samples = prefilter_samples;
+    // Cubemap faces halve cleanly down the prefilter mip chain only for powers of two
+    if (!is_power_of_two(options.ibl.environment_size) || !is_power_of_two(options.ibl.irradiance_size) ||
+        !is_power_of_two(options.ibl.prefilter_size)) {
+        error = "IBL sizes must be powers of two";
+        return false;
+    }
+    return true;
+}
+
+void viewer_options_print_usage() {
+    printf("  --hdr <file.hdr>             Environment map (default: assets/hdr/modern_evening_street_2k.hdr)\n");
+    printf("  --quality low|medium|high    IBL bake preset (default: medium, 512/32/256)\n");
+    printf("  --env-size <n>               Skybox cubemap size\n");
+    printf("  --irradiance-size <n>        Irradiance cubemap size\n");
+    printf("  --irradiance-samples <n>     Irradiance samples per texel\n");
+    printf("  --prefilter-size <n>         Prefilter cubemap base size, 128 or more\n");
+    printf("  --prefilter-samples <n>      Prefilter samples per texel at roughness 0\n");
+    printf("  --toon, --pbr                Shader for every model (default: toon for VRM, else PBR)\n");
+    printf("  --size <W>x<H>               Window size (default: 1280x720)\n");
+    printf("  --max-texture-size <n>       Base color and normal map size cap (default: 4096)\n");
+    printf("  --max-detail-texture-size <n>\n");
+    printf("                               Cap for the other texture roles (default: 2048)\n");
+    printf("  --texture-budget <MB>        Texture memory budget (default: 512)\n");
+    printf("  --min-texture-size <n>       Smallest size the budget shrinks a texture to (default: 256)\n");
+    printf("  --atlas-max-size <n>         Largest base color image to atlas, 0 disables (default: 1024)\n");
+    printf("  --atlas-padding <n>          Texels around each atlased image (default: 2)\n");
+    printf("  --occlusion-rays <n>         Rays per vertex for the vertex occlusion bake, paid on a\n");
+    printf("                               model's first load; 0 disables it (default: 32)\n");
+    printf("  --lights <n>                 Staging point lights, up to 256, as set in the GUI (default: 0)\n");
+    printf("  --trace <file.json>          Trace from startup (VRM_VIEWER_TRACE)\n");
+    printf("  --record <file>              Record input (VRM_VIEWER_RECORD)\n");
+    printf("  --replay <file>              Replay recorded input (VRM_VIEWER_REPLAY)\n");
+    printf("  --bench <out.json>           Write frame timings of the replay, or of --bench-frames\n");
+    printf("                               frames without one, then quit (VRM_VIEWER_BENCH)\n");
+    printf("  --bench-frames <n>           Frames to time without a replay (default: 600)\n");
+    printf("  --log-level <level>          debug, info, warn or error (default: info)\n");
+    printf("  --log-json <file>            Also write the log as JSON lines\n");
+}
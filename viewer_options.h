@@ -0,0 +1,54 @@
+// Viewer command line: the model to open, the environment and how finely
+// to bake it, shader choice, window size, and input capture, tracing and
+// benchmark runs. Options left out fall back to the VRM_VIEWER_*
+// environment variables where one exists, then to the built-in defaults.
+//
+//   vrm_viewer [options] [model.vrm|glb|gltf]
+#ifndef VIEWER_OPTIONS_H
+#define VIEWER_OPTIONS_H
+
+#include "ibl.h"
+#include "log.h"
+
+#include <string>
+
+enum ShaderChoice {
+    SHADER_AUTO,  // Toon for VRM models, PBR otherwise
+    SHADER_TOON,
+    SHADER_PBR,
+};
+
+struct ViewerOptions {
+    std::string model;  // Loaded at startup
+    std::string hdr_path;
+    IblSettings ibl;
+    ShaderChoice shader;
+    int width, height;  // Window, or the headless swapchain
+    int texture_max_size;  // Base color and normal maps
+    int texture_detail_max_size;  // Metallic-roughness, occlusion, emissive and MToon maps
+    int texture_budget_mb;  // Textures are halved, largest first, to fit
+    int texture_min_size;  // Budget reduction stops at this size
+    int atlas_max_size;  // Larger base color images are not atlased, 0 disables atlasing
+    int atlas_padding;
+    int occlusion_rays;  // Per vertex for the import-time occlusion bake, 0 disables it
+    int staging_lights;  // Animated point lights at startup, as the GUI's light count
+    std::string trace_path;  // Trace from startup into this file
+    std::string record_path;
+    std::string replay_path;
+    std::string bench_path;  // Benchmark report of the replay, or of bench_frames idle frames
+    int bench_frames;
+    LogLevel log_level;
+    std::string log_json_path;  // JSON-lines copy of the log
+};
+
+// Defaults and environment variables
+void viewer_options_default(ViewerOptions& options);
+
+// Applies argv[1..argc) over options. False with error set for a malformed
+// or unknown option; help is set for -h/--help.
+bool viewer_options_parse(int argc, char** argv, ViewerOptions& options, bool& help, std::string& error);
+
+// Option lines for a usage message
+void viewer_options_print_usage();
+
+#endif // VIEWER_OPTIONS_H